@@ -2107,11 +2107,16 @@ typedef struct {
 #  endif
 #endif /* HAVE_GSSAPI */
 
-   char         buf[2][SOCKD_BUFSIZE];
+   /*
+    * Memory for the buffers is only attached while there is data in them,
+    * and is NULL otherwise.  See socks_addtobuffer().
+    */
+   char         *buf[2];
 
    struct {
       size_t   len;        /* length of decoded/plaintext data in buffer      */
       size_t   enclen;     /* length of encoded data in buffer.               */
+      size_t   memsize;    /* size of memory currently attached to buf.       */
 
       int      mode;       /* buffering mode.  Default is no buffering.       */
       ssize_t  size;       /*
@@ -2137,8 +2142,13 @@ typedef struct route_t {
       unsigned char autoadded;/* autoadded route?                             */
       size_t        failed;   /* route is bad?  How many times it has failed. */
       time_t        badtime;  /* if route is bad, time last marked as such.   */
+      long          current;  /* weighted round-robin counter.                */
+      time_t        probetime;/* time route was last probed, if bad.          */
    } state;
 
+   size_t           weight;   /* weight relative to equivalent routes.        */
+   unsigned char    weight_isset; /* weight set in config?                    */
+
    socketoption_t   *socketoptionv;
    size_t           socketoptionc;
 
@@ -2196,7 +2206,10 @@ typedef enum { id_name = 1, id_addr } hostent_id_t;
 
 typedef struct {
    unsigned       allocated:1;      /* entry allocated?                       */
+   unsigned       resolved:1;       /* added by our own resolver?             */
    time_t         written;          /* time this entry was created.           */
+   time_t         lifetime;         /* seconds after written entry is valid.  */
+   time_t         refreshing;       /* when refresh started, if resolved.     */
 
    /* if looked up address/name was found, 0.  Otherwise errorcode.  */
    int            gai_rc;
@@ -3189,6 +3202,10 @@ socks_connectroute(const int s, socks_t *packet,
  * the packet->method members to point to the methods the gateway
  * should be offered.
  *
+ * In the server the connect is only started; on success the connect may
+ * still be in progress and the caller must wait for "s" to become
+ * writable before using it.
+ *
  * Returns:
  *      On success: the route that was used.
  *      On failure: NULL.  See emsg for reason.
@@ -3830,7 +3847,11 @@ size_t socks_addtobuffer(const int s, const whichbuf_t which,
  * READ_BUF : data that has been read from the socket.
  * WRITE_BUF: data that should be written to the socket.
  *
- * Returns the number of bytes added.
+ * Memory to hold the data is attached to the buffer as needed, and
+ * detached again once the buffer has been emptied.
+ *
+ * Returns the number of bytes added.  This is less than "datalen" only
+ * if we failed to allocate memory for the data.
  */
 
 size_t
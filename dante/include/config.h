@@ -170,6 +170,18 @@
 #endif /* !HAVE_GSSAPI */
 #endif /* SOCKD_BUFSIZE */
 
+/*
+ * The memory for the above buffers is only attached to a socket while
+ * data has to be held back for it.  It is taken from a per-process pool
+ * with a few size classes, using the smallest size that can hold the data.
+ * SOCKD_BUFSIZE is always the largest class.
+ * At most SOCKD_BUFPOOLMAX unused buffers of each size are kept in the
+ * pool for reuse.
+ */
+#define SOCKD_BUFSIZE_SMALL        (1024 * 4)
+#define SOCKD_BUFSIZE_MEDIUM       (1024 * 16)
+#define SOCKD_BUFPOOLMAX           (32)
+
 /* max number of clients pending to server (argument to listen()).
  * The Apache people say:
  *   It defaults to 511 instead of 512 because some systems store it
@@ -186,12 +198,105 @@
  * values affect this.
  */
 
-/* cache entries we should allocate for caching hostnames/addresses. */
+/*
+ * cache entries we should allocate for caching hostnames/addresses.
+ * This is only the default; it can be changed in sockd.conf via
+ * hostcache.entries.
+ */
 #define SOCKD_HOSTCACHE            (512)
 
-/* seconds a cache entry is to be considered valid.  Don't set below 1. */
+/*
+ * The hostcache is split into buckets of this many entries each.  A
+ * hostname or address can only be cached in one bucket, so this is
+ * how many entries a lookup needs to look at.  Max 256.
+ */
+#define SOCKD_HOSTCACHE_WAYS       (8)
+
+/*
+ * seconds a cache entry is to be considered valid when we do not know
+ * the TTL of the DNS records it was made from, as is the case for
+ * everything resolved by the system resolver.  Don't set below 1.
+ */
 #define SOCKD_CACHETIMEOUT         (60 * 5)
 
+/*
+ * Same, but for failed lookups, and for negative answers from the
+ * nameserver that do not include the SOA record to take the lifetime
+ * from.  Don't set below 1.
+ */
+#define SOCKD_CACHETIMEOUT_NEGATIVE (60)
+
+/*
+ * The lifetime of cache entries is clamped to this range, whatever the
+ * TTL says.  These are only the defaults; they can be changed in
+ * sockd.conf via hostcache.ttl.min and hostcache.ttl.max.
+ */
+#define SOCKD_HOSTCACHE_TTLMIN     (5)
+#define SOCKD_HOSTCACHE_TTLMAX     (60 * 60)
+
+/*
+ * seconds an entry added by our own resolver may still be used after
+ * it has expired, while it is being refreshed in the background.
+ */
+#define SOCKD_HOSTCACHE_STALE      (60)
+
+/*
+ * milliseconds to wait for a connect(2) to one address of a hostname
+ * before also trying the next; RFC 8305 ("Happy Eyeballs").  Can be
+ * changed in sockd.conf via happyeyeballs.delay.
+ */
+#define SOCKD_HAPPYEYEBALLS_DELAY  (250)
+
+/*
+ * If set, hostnames in requests are resolved by our own asynchronous
+ * resolver, so a request child can go on with other requests while
+ * waiting for the nameserver.  Only used if the hostcache is enabled,
+ * as that is where the results go.
+ */
+#ifndef SOCKD_RESOLVER_ASYNC
+#define SOCKD_RESOLVER_ASYNC       (1)
+#endif /* SOCKD_RESOLVER_ASYNC */
+
+/*
+ * If set, a negotiate child performs connect requests that need nothing
+ * that can block (no hostname to resolve, no upstream proxy, no external
+ * authentication or redirection) itself, and passes the session directly
+ * on to an i/o child via mother, skipping the request child.
+ * Dante only.
+ */
+#ifndef SOCKD_FASTCONNECT
+#define SOCKD_FASTCONNECT          (SOCKS_SERVER && !COVENANT)
+#endif /* SOCKD_FASTCONNECT */
+
+/*
+ * If set, child.allinone can be used to have each i/o child also accept,
+ * negotiate with, and perform the requests of clients itself, handing
+ * them from one stage to the next inside the process instead of via
+ * mother.
+ * Dante only.
+ */
+#ifndef SOCKD_ALLINONE
+#define SOCKD_ALLINONE             (SOCKS_SERVER && !COVENANT)
+#endif /* SOCKD_ALLINONE */
+
+/* where our resolver reads its nameservers and the local hostnames from. */
+#define SOCKD_RESOLVCONF           "/etc/resolv.conf"
+#define SOCKD_HOSTSFILE            "/etc/hosts"
+
+/*
+ * seconds to remember that no nameserver answered our resolver, so that
+ * requests for the same hostname fail at once rather than wait again.
+ */
+#define SOCKD_RESOLVER_FAILTIMEOUT (5)
+
+/*
+ * seconds between each time a request process checks whether the
+ * upstream proxy of a route marked as bad can be connected to again,
+ * and max number of such checks it does at the same time.
+ */
+#define SOCKD_ROUTEPROBE_INTERVAL  (10)
+#define SOCKD_ROUTEPROBE_MAX       (4)
+
 /* print some statistics for every SOCKD_CACHESTAT lookup.  0 to disable. */
 #define SOCKD_LDAPCACHE_STAT       (0)
 
@@ -200,10 +305,15 @@
  * Dante supports one process handling N clients, where the max value for
  * 'N' is limited by your system.
  *
- * There are two defines that govern this; SOCKD_NEGOTIATEMAX and SOCKD_IOMAX.
+ * There are three defines that govern this; SOCKD_NEGOTIATEMAX,
+ * SOCKD_REQUESTMAX and SOCKD_IOMAX.
  * Note that these only govern how many clients a process can handle,
  * Dante will automatically create as many processes as it needs as
  * the need arises.
+ *
+ * These are only the defaults; they can be changed in sockd.conf via
+ * child.maxclients.negotiate, child.maxclients.request and
+ * child.maxclients.io.
  */
 
 /*
@@ -219,6 +329,17 @@
 #endif /* !PRERELEASE */
 #endif /* SOCKD_NEGOTIATEMAX */
 
+/*
+ * max number of clients each request process will handle at a time.
+ * Each client occupies one or two file descriptors while its request is
+ * being processed, but only until the connection or association has been
+ * set up and passed on to an i/o process.
+ * The default of one keeps the traditional blocking request process.
+ */
+#ifndef SOCKD_REQUESTMAX
+#define SOCKD_REQUESTMAX           (1)
+#endif /* SOCKD_REQUESTMAX */
+
 /*
  * max number of clients each i/o process will handle.
  * Each client will occupy up to three file descriptors.
@@ -236,8 +357,8 @@
 #endif /* !PRERELEASE */
 #endif /* SOCKD_IOMAX */
 
-#if SOCKD_NEGOTIATEMAX < 1 ||  SOCKD_IOMAX < 1
-#error "SOCKD_NEGOTIATEMAX and SOCKD_IOMAX can not be less than 1"
+#if SOCKD_NEGOTIATEMAX < 1 || SOCKD_REQUESTMAX < 1 || SOCKD_IOMAX < 1
+#error "SOCKD_NEGOTIATEMAX, SOCKD_REQUESTMAX and SOCKD_IOMAX can not be less than 1"
 #endif
 
 /*
@@ -254,6 +375,108 @@
 #error "SOCKD_FREESLOTS_* can not be less than 1"
 #endif /* SOCKD_FREESLOTS < 1 */
 
+/*
+ * If set, the i/o processes will use the kernel's readiness-notification
+ * mechanism (epoll(7)) rather than select(2) when the platform supports it.
+ * The descriptors are then only registered with the kernel when the events
+ * we are interested in for them change, rather than on every loop.
+ * If creating the epoll-descriptor fails at runtime, select(2) is used.
+ */
+#ifndef SOCKD_IOPOLL
+#define SOCKD_IOPOLL               (1)
+#endif /* SOCKD_IOPOLL */
+
+/*
+ * If set, the i/o processes will use splice(2) to move data between the
+ * sockets of a tcp session when the platform supports it and the data
+ * does not need to be inspected by us (no gssapi encapsulation and no
+ * logging of the data).  The data is then moved via a pipe in the kernel,
+ * rather than being copied to and from our own buffers.
+ */
+#ifndef SOCKD_SPLICE
+#define SOCKD_SPLICE               (1)
+#endif /* SOCKD_SPLICE */
+
+/*
+ * Max number of new clients mother will accept(2) before passing them on
+ * to the negotiate processes, and max number of clients passed on to a
+ * negotiate process in one message.  During connection storms this
+ * reduces the number of messages sent per client.
+ */
+#ifndef SOCKD_HANDOFFMAX
+#define SOCKD_HANDOFFMAX           (16)
+#endif /* SOCKD_HANDOFFMAX */
+
+#if SOCKD_HANDOFFMAX < 1
+#error "SOCKD_HANDOFFMAX can not be less than 1"
+#endif
+
+/*
+ * Max number of udp packets the i/o processes will read from a socket in
+ * one system call, where recvmmsg(2) is available.  Each packet read
+ * needs a buffer of SOCKD_BUFSIZE bytes, so the memory used for this is
+ * SOCKD_UDPBATCH * SOCKD_BUFSIZE, allocated the first time a udp packet
+ * is read.  Setting it to 1 disables reading of multiple packets.
+ */
+#ifndef SOCKD_UDPBATCH
+#define SOCKD_UDPBATCH             (16)
+#endif /* SOCKD_UDPBATCH */
+
+#if SOCKD_UDPBATCH < 1
+#error "SOCKD_UDPBATCH can not be less than 1"
+#endif
+
+/*
+ * If set, the i/o processes will let the kernel coalesce udp packets
+ * received (UDP_GRO), and write several udp packets of the same size to
+ * the same destination in one go (UDP_SEGMENT), where the kernel supports
+ * it.  Requires SOCKD_UDPBATCH to be larger than 1.
+ */
+#ifndef SOCKD_UDPOFFLOAD
+#define SOCKD_UDPOFFLOAD           (1)
+#endif /* SOCKD_UDPOFFLOAD */
+
+/*
+ * The i/o processes add the data counted for monitors to the monitors
+ * in shared memory at most every SOCKD_MONITORSYNC_MS milliseconds, or
+ * when more than SOCKD_MONITORSYNC_BYTES bytes have accumulated, rather
+ * than after each i/o operation.  Counters for at most
+ * SOCKD_MONITORSYNC_MAX different monitors are kept by each process;
+ * counters for any others are added immediately.
+ *
+ * The data-alarms checked by the monitor process may thus be based on
+ * counters up to SOCKD_MONITORSYNC_MS milliseconds old.
+ */
+#ifndef SOCKD_MONITORSYNC_MS
+#define SOCKD_MONITORSYNC_MS       (500)
+#endif /* SOCKD_MONITORSYNC_MS */
+
+#ifndef SOCKD_MONITORSYNC_BYTES
+#define SOCKD_MONITORSYNC_BYTES    (1024 * 1024)
+#endif /* SOCKD_MONITORSYNC_BYTES */
+
+#ifndef SOCKD_MONITORSYNC_MAX
+#define SOCKD_MONITORSYNC_MAX      (16)
+#endif /* SOCKD_MONITORSYNC_MAX */
+
+/*
+ * If there are at least this many rules of a given type, build an index
+ * over their addresses so each rule lookup only needs to check the rules
+ * that can match the addresses in question.
+ */
+#ifndef SOCKD_RULEINDEX_MINRULES
+#define SOCKD_RULEINDEX_MINRULES   (32)
+#endif /* SOCKD_RULEINDEX_MINRULES */
+
+/*
+ * Max number of rule decisions each process caches.  Only requests that
+ * can be decided on addresses, ports, command and authmethod alone,
+ * without e.g. checking any credentials, are cached.
+ */
+#ifndef SOCKD_RULECACHE_SIZE
+#define SOCKD_RULECACHE_SIZE       (512)
+#endif /* SOCKD_RULECACHE_SIZE */
+
    /*
     * LDAP variables.
     */
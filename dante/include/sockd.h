@@ -60,6 +60,12 @@
 #if HAVE_SYS_SHM_H
 #include <sys/shm.h>
 #endif /* HAVE_SYS_SHM_H */
+#if HAVE_SYS_EPOLL_H
+#include <sys/epoll.h>
+#endif /* HAVE_SYS_EPOLL_H */
+#if HAVE_GETRANDOM && !HAVE_ARC4RANDOM_BUF
+#include <sys/random.h>
+#endif /* HAVE_GETRANDOM && !HAVE_ARC4RANDOM_BUF */
 
 #include <regex.h>
 
@@ -185,6 +191,75 @@
 
 #endif
 
+/*
+ * The i/o process in Dante can use epoll(7) rather than select(2), if
+ * available.  Barefoot's and Covenant's i/o handling differ enough that
+ * they still use select(2) only.
+ */
+#if SOCKS_SERVER && HAVE_SYS_EPOLL_H && SOCKD_IOPOLL
+#define HAVE_IOPOLL                       (1)
+#else
+#define HAVE_IOPOLL                       (0)
+#endif /* SOCKS_SERVER && HAVE_SYS_EPOLL_H && SOCKD_IOPOLL */
+
+/*
+ * tcp data can be spliced(2) from socket to socket if available.  Not in
+ * Covenant though, as it needs to parse the data from the client.
+ */
+#if !COVENANT && HAVE_SPLICE && SOCKD_SPLICE
+#define HAVE_SPLICE_RELAY                 (1)
+#else
+#define HAVE_SPLICE_RELAY                 (0)
+#endif /* !COVENANT && HAVE_SPLICE && SOCKD_SPLICE */
+
+/*
+ * udp packets can be read several at a time if recvmmsg(2) is available.
+ */
+#if SOCKS_SERVER && HAVE_RECVMMSG && SOCKD_UDPBATCH > 1
+#define HAVE_UDP_BATCHRECV                (1)
+#else
+#define HAVE_UDP_BATCHRECV                (0)
+#endif /* SOCKS_SERVER && HAVE_RECVMMSG && SOCKD_UDPBATCH > 1 */
+
+#if HAVE_UDP_BATCHRECV && SOCKD_UDPOFFLOAD                                     \
+&& defined(UDP_GRO) && defined(UDP_SEGMENT)
+#define HAVE_UDP_OFFLOAD                  (1)
+#else
+#define HAVE_UDP_OFFLOAD                  (0)
+#endif /* HAVE_UDP_BATCHRECV && SOCKD_UDPOFFLOAD && UDP_GRO && UDP_SEGMENT */
+
+/*
+ * Counters in shmem objects are updated with atomic operations, rather
+ * than while holding the shmem lock, if the compiler provides lock-free
+ * atomics for them.  Without that, the SHMEM_ATOMIC_* macros are plain
+ * operations, and the caller must hold the lock.
+ */
+#if SOCKS_SERVER                                                               \
+&& defined(__GCC_ATOMIC_LONG_LOCK_FREE) && __GCC_ATOMIC_LONG_LOCK_FREE == 2    \
+&& defined(__GCC_ATOMIC_LLONG_LOCK_FREE) && __GCC_ATOMIC_LLONG_LOCK_FREE == 2
+#define HAVE_SHMEM_ATOMICS                (1)
+
+#define SHMEM_ATOMIC_LOAD(p)       __atomic_load_n((p), __ATOMIC_RELAXED)
+#define SHMEM_ATOMIC_ADD(p, v)     __atomic_add_fetch((p), (v), __ATOMIC_RELAXED)
+#define SHMEM_ATOMIC_SUB(p, v)     __atomic_sub_fetch((p), (v), __ATOMIC_RELAXED)
+
+/*
+ * If "*p" is "*expected", sets it to "desired" and returns true.
+ * Otherwise sets "*expected" to the current value of "*p" and returns false.
+ */
+#define SHMEM_ATOMIC_CAS(p, expected, desired)                                 \
+   __atomic_compare_exchange_n((p), (expected), (desired), 0,                  \
+                               __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+#else /* !HAVE_SHMEM_ATOMICS */
+#define HAVE_SHMEM_ATOMICS                (0)
+
+#define SHMEM_ATOMIC_LOAD(p)       (*(p))
+#define SHMEM_ATOMIC_ADD(p, v)     (*(p) += (v))
+#define SHMEM_ATOMIC_SUB(p, v)     (*(p) -= (v))
+#define SHMEM_ATOMIC_CAS(p, expected, desired)                                 \
+   (*(p) == *(expected) ? (*(p) = (desired), 1) : (*(expected) = *(p), 0))
+#endif /* !HAVE_SHMEM_ATOMICS */
+
 
 /*
  * use caching versions, avoiding a lot of overhead.
@@ -829,18 +904,13 @@ do {                                                                           \
 #define SOCKD_NOP                (0)   /* No command/op.       */
 #define SOCKD_FREESLOT_TCP       (1)   /* free'd a tcp slot.   */
 #define SOCKD_FREESLOT_UDP       (2)   /* free'd a udp slot.   */
+#define SOCKD_NEWCLIENT_TCP      (3)   /* accepted a client.   */
 
 /*
  * info sent by mother to sockd children.
  */
 #define SOCKD_EXITNORMALLY       (1)
 
-/*
- * a request child can currently handle a maximum of one client, so can't
- * be changed and is therefor #defined here rather than in config.h.
- */
-#define SOCKD_REQUESTMAX   1
-
 /*
  * Max number of tests a monitor process can have queued.
  */
@@ -1187,8 +1257,17 @@ typedef struct {
 } shmem_header_t;
 
 typedef struct {
-   size_t              bytes;             /* bytes transferred since iotime.  */
-   struct timeval      iotime;
+   /*
+    * Token bucket, refilled at "maxbps" b/s, holding at most "maxbps" bytes.
+    * Kept as the theoretical arrival time (GCRA) so it can be updated
+    * atomically: "tat" is the monotonic time, in microseconds, at which
+    * all bytes transferred so far have been paid for.  The bucket is
+    * empty when "tat" is one second or more into the future, and full
+    * when "tat" is in the past.  A client may transfer more than what was
+    * left in the bucket; nobody gets to do i/o again before the debt has
+    * been paid back.
+    */
+   int64_t             tat;
 
    unsigned char       maxbps_isset;
    size_t              maxbps;            /* max  b/s allowed.                */
@@ -1235,7 +1314,14 @@ typedef struct {
        * The rest is only applicable if key is not "key_unset".
        */
 
-     time_t lastexpirescan;   /* time of last scan for entries to expire.     */
+      size_t expirenext;      /* next index in keyv to check for expiry.      */
+
+      /*
+       * Set if entries in keyv have been moved around (table grown and
+       * rehashed, or entries shifted back on removal) since the map was
+       * opened, so keystate_closemap() can not msync(2) just one index.
+       */
+      unsigned char movedentries;
 
       /* extra info needed for some keys. */
       union {
@@ -1251,8 +1337,13 @@ typedef struct {
        * the other processes will see that the keymap pointer is no
        * longer NULL, but that other process will not (yet) have mapped
        * the keymap.
+       *
+       * keyv is a hash table with keyc slots (a power of two), using
+       * linear probing, hashed on the address/hostid of the client.
        */
       struct {
+         unsigned char inuse;         /* is this slot in use?                 */
+
          union { /* data for the key. */
             struct {
                sa_family_t        safamily; /* which union member is set.     */
@@ -1279,6 +1370,7 @@ typedef struct {
 
       } *keyv;
       size_t keyc;                  /* number of elements in keyv.            */
+      size_t keyinuse;              /* number of elements in keyv in use.     */
 } keystate_t;
 
 typedef struct {
@@ -1604,6 +1696,12 @@ typedef struct {
 
 #if HAVE_SCHED_SETAFFINITY
    cpu_set_t            mask;
+
+   /*
+    * bind each process to one cpu in mask, rather than letting all
+    * processes float over all cpus in mask?  Only used for i/o processes.
+    */
+   unsigned char        percpu;
 #endif /* HAVE_SCHED_SETAFFINITY */
 
 } cpusetting_t;
@@ -1700,6 +1798,27 @@ typedef struct {
    struct rusage       rusage_io;
 
    cpusetting_t   cpu;                  /* current cpusettings, if any set.   */
+   int            cpuid;                /*
+                                         * cpu this process has been bound
+                                         * to by mother if "percpu" is set,
+                                         * or -1.
+                                         */
+
+   unsigned char  reuseport;            /*
+                                         * child.reuseport as set at startup.
+                                         * Can not be changed by a reload.
+                                         */
+
+   unsigned char  allinone;             /*
+                                         * child.allinone as set at startup.
+                                         * Can not be changed by a reload.
+                                         */
+
+   size_t         hostcacheentries;     /*
+                                         * hostcache.entries as set at
+                                         * startup.  Can not be changed by
+                                         * a reload.
+                                         */
 
    pid_t          *motherpidv;          /* pid of mothers.                    */
    pid_t          pid;                  /* pid of current process.            */
@@ -1860,6 +1979,31 @@ typedef struct {
                                                  * max # of requests to handle
                                                  * before quitting.
                                                  */
+
+   struct {
+      size_t               negotiate;           /* per negotiate child.       */
+      size_t               request;             /* per request child.         */
+      size_t               io;                  /* per i/o child.             */
+   } maxclients;                                /*
+                                                 * max # of clients to handle
+                                                 * at a time.  A child fixes
+                                                 * this when it starts.
+                                                 */
+
+   unsigned char           reuseport;           /*
+                                                 * negotiate children bind
+                                                 * the internal addresses
+                                                 * with SO_REUSEPORT and
+                                                 * accept(2) clients
+                                                 * themselves?
+                                                 */
+
+   unsigned char           allinone;            /*
+                                                 * i/o children accept,
+                                                 * negotiate with, and perform
+                                                 * the requests of clients
+                                                 * themselves?
+                                                 */
 } childstate_t;
 
 typedef struct {
@@ -1925,6 +2069,31 @@ struct config {
                                                     * hostcache.
                                                     */
 
+   struct {
+      size_t                  entries;             /*
+                                                    * # of hostnames/addresses
+                                                    * to cache.  0 disables.
+                                                    */
+
+      struct {
+         time_t               min;                 /*
+                                                    * lifetime of entries is
+                                                    * clamped to this range,
+                                                    * whatever the TTL.
+                                                    */
+         time_t               max;
+      } ttl;
+   } hostcache;
+
+   struct {
+      long                    delay;               /*
+                                                    * ms between starting
+                                                    * connects to the
+                                                    * addresses of a
+                                                    * hostname.  0 disables.
+                                                    */
+   } happyeyeballs;
+
 #if HAVE_LDAP
    int                        ldapfd;              /*
                                                     * shmem file/lock for
@@ -2060,6 +2229,12 @@ typedef struct {
                                * read over ack-pipe, but if sent here,
                                * will not be sent over ack-pipe.
                                */
+
+   unsigned char isio;        /*
+                               * Set if the packet is a sockd_io_t object.
+                               * Lets mother tell the i/o objects a negotiate
+                               * child may send from its request objects.
+                               */
 } reqinfo_t;
 
 typedef struct {
@@ -2195,9 +2370,13 @@ typedef struct {
 
 
 typedef struct sockd_io_t {
-   unsigned char          allocated; /* object currently allocated?           */
+   reqinfo_t              reqinfo;   /*
+                                      * info from child about this request.
+                                      * Must be first, same as in
+                                      * sockd_request_t.
+                                      */
 
-   reqinfo_t              reqinfo;   /* info from child about this request.   */
+   unsigned char          allocated; /* object currently allocated?           */
 
    connectionstate_t      state;
    authmethod_t           cauth;     /* client authentication in use.         */
@@ -2318,6 +2497,14 @@ typedef struct negotiate_state_t {
                                                      * ever added.
                                                      */
                            ];
+
+   /*
+    * Replies we have not sent yet because the client has already sent us
+    * what comes next.  They are sent together with our next reply.
+    */
+   unsigned char        reply[  1 + 1                /* VER, METHOD           */
+                              + 1 + 1];              /* VER, STATUS (uname)   */
+   size_t               replylen;
 #elif COVENANT
    /* no fixed limit in the http protocol?  Try this for now. */
    unsigned char        mem[MAXREQLEN];
@@ -2418,8 +2605,11 @@ typedef struct {
 
    time_t           created;        /* time created.                          */
    size_t           freec;          /* free slots at the moment.              */
+   size_t           maxfreec;       /* slots child was created with.          */
    size_t           sentc;          /* clients sent to this child.            */
 
+   int              cpuid;          /* cpu child is bound to, or -1.          */
+
 #if BAREFOOTD
    unsigned char    hasudpsession;  /*
                                      * is one of the slots taken by an udp
@@ -2522,6 +2712,60 @@ doio_udp(sockd_io_t *io, fd_set *rset, int *badfd);
  * "badfd" contains the fd related to the error (io->src.s or io->dst.s).
  */
 
+ssize_t
+udp_recvfrom(const int s, void *buf, const size_t len,
+             struct sockaddr_storage *from, socklen_t *fromlen,
+             recvfrom_info_t *recvflags, authmethod_t *auth)
+             __ATTRIBUTE__((__BOUNDED__(__buffer__, 2, 3)));
+/*
+ * Like socks_recvfrom(), for reading udp packets in the i/o processes.
+ * Where possible, up to SOCKD_UDPBATCH packets are read from "s" at a
+ * time, and returned one by one on the following calls for "s".
+ * Packets read but not yet returned are discarded if udp_recvfrom() is
+ * called for another socket, so the caller should keep calling it for
+ * "s" until udp_recvpending() returns 0.
+ */
+
+size_t
+udp_recvpending(const int s);
+/*
+ * Returns the number of packets read from "s" but not yet returned
+ * by udp_recvfrom().
+ */
+
+void
+udp_recvflush(void);
+/*
+ * Discards any packets read but not yet returned by udp_recvfrom().
+ */
+
+ssize_t
+udp_sendto(const int s, const void *buf, const size_t len,
+           const struct sockaddr_storage *to, const socklen_t tolen,
+           sendto_info_t *sendtoflags, authmethod_t *auth)
+           __ATTRIBUTE__((__BOUNDED__(__buffer__, 2, 3)));
+/*
+ * Like socks_sendto(), for writing udp packets in the i/o processes.
+ * Where possible, packets of the same size written to the same
+ * destination are collected and written together by udp_sendflush(),
+ * in which case the packet is reported as written, and any error
+ * writing it later is only logged.
+ */
+
+void
+udp_sendflush(void);
+/*
+ * Writes any packets collected by udp_sendto().  Must be called before
+ * returning to wait for more i/o.
+ */
+
+void
+udp_enableoffload(const int s);
+/*
+ * Lets the kernel coalesce packets received on the udp socket "s", if
+ * supported.  Only for sockets read with udp_recvfrom().
+ */
+
 iostatus_t
 io_packet_received(const recvfrom_info_t *recvflags,
                    const size_t bytesreceived,
@@ -2795,10 +3039,127 @@ sockd_rstonclose(const int s);
  * a RST from the other end.
  */
 
+typedef struct {
+   int                     s;        /* -1 if not started, or failed.      */
+   struct sockaddr_storage laddr;
+   struct sockaddr_storage raddr;
+} connectattempt_t;
+
+/*
+ * Connects to the addresses of a hostname in progress, as started by
+ * sockd_connecthost().
+ */
+typedef struct {
+   int                     s;            /* socket the winner ends up on.  */
+   int                     flags;        /* original file flags of "s".    */
+   struct sockaddr_storage laddr;        /* address "s" is bound to.       */
+   struct sockaddr_storage client_l;     /* client we are connecting for.  */
+   struct sockaddr_storage client_r;
+   sockshost_t             host;         /* host we are connecting to.     */
+
+   connectattempt_t        attemptv[1 + MAX_ADDRINFO_NEXT];
+   size_t                  attemptc;     /* addresses to try.              */
+   size_t                  started;      /* attempts started so far.       */
+   size_t                  pending;      /* started and still in progress. */
+   struct timeval          nextstart;    /* when to start the next one.    */
+   int                     failed_errno; /* errno of the last failure.     */
+   unsigned char           useds;        /* "s" used by an attempt.        */
+} connecthost_t;
+
+int
+sockd_connecthost(const int s, const sockshost_t *host,
+                  const char *hostname, const ruleaddr_t *dst,
+                  const struct sockaddr_storage *client_l,
+                  const struct sockaddr_storage *client_r,
+                  struct sockaddr_storage *laddr,
+                  struct sockaddr_storage *raddr,
+                  connecthost_t *state, char *emsg, const size_t emsglen);
+/*
+ * Like socks_connecthost() with a timeout of 0, for connecting the bound
+ * external socket "s" of a CONNECT request to "host".
+ *
+ * If "host" is a hostname that resolves to several addresses, connects
+ * to them in parallel as per RFC 8305 ("Happy Eyeballs"), alternating
+ * between address families and starting a new attempt every
+ * sockscf.happyeyeballs.delay milliseconds until one succeeds.  The first
+ * attempt of the same family as "s" is made on "s", the others on new
+ * sockets bound to an external address we can use for them.
+ *
+ * If "host" is an address resolved from the hostname "hostname", the
+ * other addresses of "hostname" are tried the same way, after "host",
+ * if they match the rule address "dst".  "hostname" may be NULL.
+ *
+ * "client_l" and "client_r" are the local and remote addresses of the
+ * client we are connecting for.
+ *
+ * We do not wait for the attempts here.  While they are in progress,
+ * they are kept in "state", and the caller should call
+ * connecthost_process() when one of the descriptors added by
+ * connecthost_fdset() becomes writable, or when the time returned by
+ * connecthost_gettimeout() has passed.
+ *
+ * The connection that wins is moved to "s", with "laddr" and "raddr"
+ * updated to its addresses, and the others are closed.  If only one
+ * attempt is left in progress, it is moved to "s" without waiting for it,
+ * and errno is set to EINPROGRESS, as for socks_connecthost().
+ *
+ * Returns:
+ *      0 if connected.
+ *      1 if the attempts are in progress in "state".
+ *     -1 if not connected.
+ */
+
+int
+connecthost_fdset(const connecthost_t *state, int fdbits, fd_set *wset);
+/*
+ * Adds the descriptors of the attempts in progress in "state" to "wset".
+ * Returns the highest descriptor set, or "fdbits" if that is higher.
+ */
+
+struct timeval *
+connecthost_gettimeout(const connecthost_t *state, struct timeval *timeout);
+/*
+ * Fills in "timeout" with the time until the next attempt in "state"
+ * should be started.  Returns "timeout", or NULL if there is none to
+ * start.
+ */
+
+int
+connecthost_process(connecthost_t *state, fd_set *wset,
+                    struct sockaddr_storage *laddr,
+                    struct sockaddr_storage *raddr,
+                    char *emsg, const size_t emsglen);
+/*
+ * Checks the attempts in "state" whose descriptors are set in "wset",
+ * and starts the next attempt if it is due.
+ *
+ * Returns as sockd_connecthost().
+ */
+
+void
+connecthost_cancel(connecthost_t *state, char *emsg, const size_t emsglen);
+/*
+ * Cancels the attempts in progress in "state" because timeout.connect
+ * expired, filling in "emsg" and setting errno accordingly.
+ */
+
 int
 bindinternal(const int protocol);
 /*
  * Binds all internal addresses using protocol "protocol".
+ * If sockscf.state.reuseport is set, the addresses are only bound, as
+ * the negotiate children are the ones that will listen on them.
+ * Returns 0 on success, -1 on failure.
+ */
+
+int
+bindlistenaddress(listenaddress_t *l, const int reuseport, const int dolisten);
+/*
+ * Creates a tcp socket for the internal address "l", binds it, and
+ * stores it in l->s.  If "reuseport" is set, SO_REUSEPORT is set on the
+ * socket so that several processes can bind the same address.  If
+ * "dolisten" is set, the socket is also made a non-blocking listening
+ * socket.
  * Returns 0 on success, -1 on failure.
  */
 
@@ -3199,6 +3560,20 @@ rulespermit(int s, const struct sockaddr_storage *peer,
  *      Returns false otherwise.
  */
 
+void
+ruleindex_free(void);
+/*
+ * Frees the index rulespermit() builds over the rules, and flushes the
+ * cache of its decisions.  Must be called before the rules are changed,
+ * and a new index will be built as needed.
+ */
+
+void
+log_rulecachestats(void);
+/*
+ * Logs statistics for this process's cache of rulespermit() decisions.
+ */
+
 int
 command_matches(const int command, const command_t *commands);
 /*
@@ -3321,6 +3696,19 @@ send_client(int s, const sockd_client_t *client,
  *      On failure: -1
  */
 
+int
+send_clients(int s, const sockd_client_t *clientv, const size_t clientc);
+/*
+ * Sends the "clientc" clients in "clientv" to the process connected to
+ * "s", all in one message.  "clientc" can not be more than
+ * SOCKD_HANDOFFMAX.
+ * Either all the clients are sent, or none are.
+ *
+ * Returns:
+ *      On success: 0
+ *      On failure: -1
+ */
+
 /*
  * Returns a value indicating whether relaying from "src" to "dst" should
  * be permitted.
@@ -3498,6 +3886,236 @@ close_iodescriptors(const sockd_io_t *io);
  * "io".
  */
 
+#if HAVE_IOPOLL
+
+#define IOPOLL_READ                 (0x1)
+#define IOPOLL_WRITE                (0x2)
+#define IOPOLL_EXCEPTION            (0x4)
+
+typedef struct {
+   int  fd;
+   int  events;  /* IOPOLL_* events that are ready on fd.         */
+   void *data;   /* data registered with fd via iopoll_set().    */
+} iopollevent_t;
+
+int
+iopoll_init(void);
+/*
+ * Initializes the epoll(7)-based event notification for the current process.
+ * Any previous state, e.g. inherited from mother, is discarded.
+ *
+ * Returns:
+ *      On success: 0.
+ *      On failure: -1.  The caller should then use select(2) instead.
+ */
+
+int
+iopoll_isactive(void);
+/*
+ * Returns true if iopoll_init() has been successfully called in this
+ * process, false otherwise.
+ */
+
+int
+iopoll_set(const int fd, const int events, void *data);
+/*
+ * Sets the events we want to be notified about on the descriptor "fd"
+ * to "events", which is a bitmask of IOPOLL_* flags.  "data" will be
+ * returned together with any events reported for "fd".
+ * If "events" is 0, "fd" is removed from the set of descriptors we poll;
+ * this should be done before "fd" is closed.
+ * The kernel is only contacted if the events for "fd" change.
+ *
+ * Returns:
+ *      On success: 0.
+ *      On failure: -1.
+ */
+
+int
+iopoll_wait(iopollevent_t *eventv, const size_t eventc,
+            struct timeval *timeout);
+/*
+ * Waits until any of the registered descriptors are ready, or "timeout"
+ * expires.  If "timeout" is NULL, we wait until a descriptor is ready.
+ * Up to "eventc" ready descriptors are stored in "eventv".
+ * Like selectn(), signals are only delivered while waiting.
+ *
+ * Returns:
+ *      On success: the number of descriptors stored in "eventv".  0 on
+ *                  timeout.
+ *      On failure: -1.  If a signal was handled, errno is set to EINTR.
+ */
+
+#endif /* HAVE_IOPOLL */
+
+#if HAVE_SPLICE_RELAY
+
+int
+splice_isavailable(void);
+/*
+ * Returns true if we can splice(2) data in this process, creating the
+ * pipe needed for it if not already done.  Returns false if not.
+ */
+
+ssize_t
+splice_read(const int s, const size_t len);
+/*
+ * Moves up to "len" bytes from the socket "s" into the splice pipe.
+ * The pipe must be empty, and the caller must pass all data moved
+ * on to splice_write() before the next call.
+ *
+ * Returns:
+ *      On success: the number of bytes moved.  0 on EOF.
+ *      On failure: -1.
+ */
+
+ssize_t
+splice_write(const int s, const size_t len, sendto_info_t *sendtoflags,
+             char *buf, const size_t bufsize);
+/*
+ * Moves the "len" bytes previously spliced into the pipe to the socket "s".
+ * Whatever can not be written to "s" now is added to the write buffer of
+ * "s", using "buf", of size "bufsize", as a temporary buffer.
+ * Upon return, the pipe is empty.  "sendtoflags" is set as with
+ * socks_sendto().
+ *
+ * Returns:
+ *      On success: "len".
+ *      On failure: -1.
+ */
+
+#endif /* HAVE_SPLICE_RELAY */
+
+/*
+ * Timer wheel for keeping track of session timeouts.  Times are in
+ * seconds, as returned by time_monotonic().
+ */
+#define TIMERWHEEL_LEVELS           (4)
+#define TIMERWHEEL_SLOTBITS         (6)
+#define TIMERWHEEL_SLOTS            (1 << TIMERWHEEL_SLOTBITS)
+
+typedef struct sockd_timer_t {
+   struct sockd_timer_t *next;
+   struct sockd_timer_t *prev;
+   struct sockd_timer_t **head;    /* list we are on; NULL if not armed.    */
+   int                  level;     /* wheel level, or -1 if expired.        */
+   time_t               expires;   /* when timer expires, if armed.         */
+} sockd_timer_t;
+
+typedef struct {
+   time_t        now;                         /* next second to process.   */
+   size_t        armedc;                      /* number of timers armed.   */
+   size_t        levelc[TIMERWHEEL_LEVELS];   /* timers in each level.     */
+   sockd_timer_t *expired;                    /* expired, not collected.   */
+   sockd_timer_t *slotv[TIMERWHEEL_LEVELS][TIMERWHEEL_SLOTS];
+} timerwheel_t;
+
+void
+timerwheel_init(timerwheel_t *wheel, const time_t tnow);
+/*
+ * Initializes "wheel", with "tnow" as the current time.
+ */
+
+void
+timer_arm(timerwheel_t *wheel, sockd_timer_t *timer, const time_t expires);
+/*
+ * Arms "timer" in "wheel", to expire at the time "expires".  If "timer"
+ * is already armed, it is rearmed.  "timer" must be zeroed before first
+ * use.
+ */
+
+void
+timer_disarm(timerwheel_t *wheel, sockd_timer_t *timer);
+/*
+ * Disarms "timer" in "wheel".  Does nothing if "timer" is not armed.
+ */
+
+time_t
+timerwheel_timeuntil(const timerwheel_t *wheel, const time_t tnow);
+/*
+ * Returns the number of seconds, relative to "tnow", until the first
+ * timer in "wheel" may expire.  The real time may be later, but never
+ * earlier.  0 if some have already expired.  -1 if no timers are armed.
+ */
+
+sockd_timer_t *
+timerwheel_getexpired(timerwheel_t *wheel, const time_t tnow);
+/*
+ * Returns a timer in "wheel" that has expired at "tnow", or NULL if none.
+ * The returned timer is disarmed.
+ */
+
+int
+resolver_init(const size_t maxqueries, const size_t maxrefreshes);
+/*
+ * Initializes our asynchronous resolver, to handle at most "maxqueries"
+ * hostnames at a time for our caller, plus "maxrefreshes" background
+ * refreshes of expired hostcache entries.  The results of the lookups
+ * are added to the hostcache.
+ *
+ * Returns 0 on success, -1 if the resolver can not be used.
+ */
+
+int
+resolver_canresolve(const char *name);
+/*
+ * Returns true if the hostname "name" should be resolved by our resolver,
+ * i.e. it is a name the system resolver would look up in the DNS as is.
+ */
+
+void
+resolver_start(const size_t id, const char *name);
+/*
+ * Starts resolving the hostname "name".  "id" is an index below
+ * "maxqueries" identifying the lookup, and must not be in use.
+ * The lookup may have completed already when we return.
+ */
+
+void
+resolver_cancel(const size_t id);
+/*
+ * Cancels the lookup identified by "id", if any.
+ */
+
+void
+resolver_refresh(const char *name);
+/*
+ * Starts resolving the hostname "name" in the background, to refresh
+ * its entry in the hostcache.  Nobody waits for the result.  Does nothing
+ * if too many refreshes are in progress already.
+ */
+
+int
+resolver_fdset(int fdbits, fd_set *rset, fd_set *wset);
+/*
+ * Sets the descriptors our resolver needs to wait for in "rset" and
+ * "wset".  Returns the max of "fdbits" and the highest descriptor set.
+ */
+
+time_t
+resolver_timeuntil(const time_t tnow);
+/*
+ * Returns the number of seconds, relative to "tnow", until our resolver
+ * next needs to retransmit, or -1 if never.
+ */
+
+void
+resolver_process(const fd_set *rset, const fd_set *wset);
+/*
+ * Handles the answers that are ready according to "rset" and "wset",
+ * and the questions that have timed out.
+ */
+
+ssize_t
+resolver_getcompleted(int *gai_rc);
+/*
+ * Returns the id of a lookup that has completed, and frees the id.
+ * "gai_rc" is set to 0 if the hostname resolved, or to an errorcode of
+ * the same type as getaddrinfo(3) if not.
+ *
+ * Returns -1 if no lookups have completed.
+ */
+
 int
 sockdnegotiate(int s);
 /*
@@ -3538,6 +4156,104 @@ run_request(void);
  * indefinitely for mother to send at least one.
  */
 
+void
+negotiate_init(const size_t maxclients);
+/*
+ * Sets up the negotiate stage to handle up to "maxclients" clients at
+ * a time, listening for them ourselves if child.reuseport is set.
+ */
+
+void
+request_init(const size_t maxclients);
+/*
+ * Sets up the request stage to handle up to "maxclients" requests at
+ * a time.
+ */
+
+int
+request_fdset(int fdbits, fd_set *rset, fd_set *wset);
+/*
+ * Adds the descriptors the request stage is waiting for to "rset" and
+ * "wset".
+ * Returns the highest descriptor set, or "fdbits" if that is higher.
+ */
+
+struct timeval *
+request_gettimeout(struct timeval *timeout);
+/*
+ * Fills in "timeout" with the time until request_process() should be
+ * called.  Returns "timeout", or NULL if there is nothing to wait for.
+ */
+
+void
+request_process(fd_set *rset, fd_set *wset);
+/*
+ * Continues the requests whose descriptors are set in "rset" or "wset",
+ * and the ones that have timed out.
+ */
+
+#if SOCKD_ALLINONE
+/*
+ * The negotiate and request stages, when run as part of an i/o process
+ * with child.allinone set.  Clients are then handed from one stage to the
+ * next inside the process rather than via mother.
+ */
+
+int
+negotiate_fdset(int fdbits, fd_set *rset, fd_set *bufrset, const size_t freec);
+/*
+ * Adds the descriptors of the clients we are negotiating with to "rset"
+ * and "bufrset", and our listen sockets to "rset" if "freec", the number
+ * of new clients we have room for, is not zero.  If it is zero, the
+ * listen sockets are closed until it is not.
+ * Returns the highest descriptor set, or "fdbits" if that is higher.
+ */
+
+struct timeval *
+negotiate_gettimeout(struct timeval *timeout);
+/*
+ * Fills in "timeout" with the time until the first client times out.
+ * Returns "timeout", or NULL if there are no clients.
+ */
+
+void
+negotiate_process(fd_set *rset, size_t freec);
+/*
+ * Accepts up to "freec" new clients on the listen sockets set in "rset",
+ * continues negotiating with the clients set in "rset", and deletes the
+ * clients that have timed out.
+ */
+
+size_t
+negotiate_allocated(void);
+/*
+ * Returns the number of clients we are negotiating with.
+ */
+
+void
+add_request(const sockd_request_t *request);
+/*
+ * Adds "request", which has completed negotiation, to the requests we
+ * are handling.  There must be a free slot for it.
+ */
+
+size_t
+request_allocated(void);
+/*
+ * Returns the number of requests we are handling.
+ */
+
+int
+add_io(const sockd_io_t *io);
+/*
+ * Adds "io", set up by the request stage, to the sessions we do i/o for.
+ * The descriptors in "io" belong to the i/o stage on return.
+ * Returns:
+ *      On success: 0
+ *      On failure: -1.  There is no free slot for "io".
+ */
+#endif /* SOCKD_ALLINONE */
+
 void mother_preconfigload(void);
 void monitor_preconfigload(void);
 void negotiate_preconfigload(void);
@@ -3600,6 +4316,14 @@ send_io(int s, sockd_io_t *io);
  */
 
 
+int
+recv_isio(int s);
+/*
+ * Checks, without reading it, whether the next object to be read from
+ * the child connected to "s" is a sockd_io_t object.
+ * Returns true if it is, false otherwise.
+ */
+
 int
 recv_io(int mother, sockd_io_t *io);
 /*
@@ -3619,6 +4343,19 @@ recv_req(int s, sockd_request_t *req);
  *      On failure: -1
  */
 
+int
+request_fastpath(const sockd_request_t *request);
+/*
+ * Performs the request "request" in the calling (negotiate) process,
+ * as a request child would, sending the resulting io object to mother.
+ * Only to be used for requests that need nothing that can block.
+ * The client descriptor in "request" is closed when we return.
+ *
+ * Returns:
+ *      On success: 0
+ *      On failure: -1.  Mother has been told the slot is free again.
+ */
+
 negotiate_result_t
 recv_clientrequest(int s, request_t *request, negotiate_state_t *state);
 /*
@@ -3636,6 +4373,31 @@ recv_sockspacket(int s, request_t *request, negotiate_state_t *state);
  * is called to receive the actual packet.
  */
 
+#if SOCKS_SERVER
+int
+send_negotiatereply(int s, const unsigned char *reply, const size_t replylen,
+                    request_t *request, negotiate_state_t *state);
+/*
+ * Sends the reply "reply", of length "replylen", to the client connected
+ * to "s", as part of the negotiation of "request".
+ *
+ * If the client has pipelined its requests, i.e. already sent us what
+ * comes next, the reply is instead saved in "state", so that it can be
+ * sent together with our next reply.  Saved replies are sent by
+ * recv_clientrequest() before it returns.
+ *
+ * Returns 0 on success, -1 on failure.
+ */
+
+int
+negotiate_ispipelined(int s, const request_t *request);
+/*
+ * Returns true if the client connected to "s" has already sent us the
+ * next part of the negotiation of "request", so that we can go on with
+ * it without waiting.
+ */
+#endif /* SOCKS_SERVER */
+
 void
 disable_childcreate(int err, const char *reason);
 /*
@@ -3708,6 +4470,20 @@ nextchild(const int type, const int protocol);
  *      On failure: NULL.
  */
 
+sockd_child_t *
+nextiochild(const pid_t pid, const int s);
+/*
+ * Returns the i/o child that the client on the socket "s" should be
+ * sent to.  If i/o children are bound to a cpu each, this is, if possible,
+ * a child with a free slot that is bound to the cpu the kernel processed
+ * the client's traffic on.  Otherwise it is the child with pid "pid",
+ * previously returned by nextchild().
+ *
+ * Returns:
+ *      On success: pointer to the child.
+ *      On failure: NULL.
+ */
+
 #if HAVE_SCHED_SETAFFINITY
 /*
  * Modelled after the CPU_SET() macros.
@@ -4069,8 +4845,9 @@ redirect(int s, struct sockaddr_storage *addr,
 void
 hostcachesetup(void);
 /*
- * Initializes the hostcache.  Must be called before any calls to
- * cgethostby*().
+ * Initializes the hostcache, sized according to sockscf.hostcache, so
+ * must be called after the config has been read.  Until then, the
+ * cgethostby*() functions work, but do not cache anything.
  */
 
 void
@@ -4079,6 +4856,40 @@ hostcacheinvalidate(void);
  * Invalidates all entries in the hostcache.
  */
 
+int
+hostcache_isresolved(const char *name, int *dorefresh);
+/*
+ * Returns true if the hostcache has a usable entry for the hostname "name"
+ * added by hostcache_addresolved().
+ *
+ * If the entry has expired and is only still served because it is to be
+ * refreshed, "dorefresh" is set to true if the caller should start the
+ * refresh, and false if somebody else already has.
+ */
+
+time_t
+hostcache_lifetime(const time_t ttl);
+/*
+ * Returns the lifetime to use for a hostcache entry made from DNS records
+ * with the TTL "ttl", i.e. "ttl" clamped to the range configured.
+ */
+
+void
+hostcache_addresolved(const char *name, const int gai_rc,
+                      const struct addrinfo *ai, const time_t lifetime);
+/*
+ * Adds the result of resolving the hostname "name" with our own resolver
+ * to the hostcache, to be valid for "lifetime" seconds.  "gai_rc" is 0 and
+ * "ai" the addresses if the name resolved, or an errorcode of the same
+ * type as getaddrinfo(3) otherwise.
+ *
+ * If "gai_rc" is EAI_AGAIN and the hostcache has an expired, but still
+ * usable, result for "name", that result is kept instead.
+ *
+ * Later cgetaddrinfo() calls for "name" without a service will be answered
+ * from the entry, whatever their hints.
+ */
+
 void
 ldapcachesetup(void);
 /*
@@ -4263,8 +5074,8 @@ keystate_index(shmem_object_t *shmem, const clientinfo_t *cinfo,
 /*
  * Returns the index of "cinfo" in shmem's keystate array,
  * or -1 if no such index exists.
- * If "expireoldtoo" is set, expired old keystate entries in shmem,
- * if any, too.
+ * If "expireoldtoo" is set, also checks the next few entries in shmem
+ * for having expired, removing those that have and are no longer in use.
  */
 
 int
@@ -4290,8 +5101,10 @@ keystate_closemap(const unsigned long id, keystate_t *keystate,
  * Also truncates the file used if the current size is different from
  * the size mapped.
  *
- * If "datawaschanged" is true it means some of the data was changed, and
- * a msync(2) may have to be done.
+ * If "changedindex" is not -1, it is the index of the only entry that
+ * was changed, and only the part of the map containing it may need to be
+ * msync(2)-ed.  If keystate's "movedentries" is set however, entries may
+ * have been moved anywhere in the map, and all of it will be msync(2)-ed.
  */
 
 int
@@ -4337,7 +5150,8 @@ ssize_t
 bw_left(const shmem_object_t *bw, const int lock);
 /*
  * Returns how many bytes we should read if the client is restricted
- * by "bw".
+ * by "bw".  Never more than SOCKD_BUFSIZE, and 0 if the bucket is
+ * currently empty.
  */
 
 void
@@ -4345,7 +5159,7 @@ bw_update(shmem_object_t *bw, size_t bwused, const struct timeval *bwusedtime,
           const int lock);
 /*
  * Updates "bw".  "bwused" is the bandwidth used (in bytes) at time
- * "bwusedtime".
+ * "bwusedtime", as returned by gettimeofday_monotonic().
  */
 
 int
@@ -4509,6 +5323,13 @@ maxfreeslots(const int childtype);
  * can have.
  */
 
+size_t
+minfreeslots(const int childtype);
+/*
+ * Returns the minimum number of free slots we want to have available
+ * in children of type "childtype".
+ */
+
 void
 sockd_print_child_ready_message(const size_t freefds);
 /*
@@ -4585,6 +5406,12 @@ typedef struct {
     */
    size_t freefds;
 
+   /*
+    * number of clients we have room for; child.maxclients.io as it was
+    * when we started, regardless of later reloads.
+    */
+   size_t maxclients;
+
    /*
     * do any active i/o objects have a connect that we do not know whether
     * have completed or not yet?
@@ -47,6 +47,38 @@
 static const char rcsid[] =
 "$Id: config.c,v 1.464.4.2.2.3 2017/02/03 06:26:44 michaels Exp $";
 
+static int
+routematches(route_t *route, const request_t *req, const sockshost_t *src,
+             const sockshost_t *dst);
+/*
+ * Returns true if the route "route" can be used for the request "req"
+ * from "src" to "dst".  If "src" or "dst" is NULL, that argument is ignored.
+ */
+
+static int
+routeisequivalent(route_t *route, const route_t *to, const request_t *req,
+                  const sockshost_t *src, const sockshost_t *dst);
+/*
+ * Returns true if the route "route" is equivalent to the route "to" for
+ * the request "req" from "src" to "dst".  That is the case if they have the
+ * same src and dst addresses, and both match the request.  "to" must match.
+ */
+
+static route_t *
+routebalance(route_t *route, const request_t *req, const sockshost_t *src,
+             const sockshost_t *dst, const int commit);
+/*
+ * "route" is the first route matching the request "req" from "src" to
+ * "dst".  If a weight is set for "route" or any of the routes equivalent
+ * to it, returns the route to use for the request among them, picked by
+ * weighted round-robin.  Otherwise returns "route", so routes following
+ * it are only used as backups for when it is marked as bad.
+ *
+ * If "commit" is set, the route returned is counted as used, so that the
+ * next call returns the next route in turn.  If not, calling again returns
+ * the same route.
+ */
+
 void
 genericinit(void)
 {
@@ -212,6 +244,11 @@ postconfigloadinit(void)
       newcpu.mask           = sockscf.initial.cpu.mask;
       newcpu.affinity_isset = sockscf.initial.cpu.affinity_isset;
    }
+   else if (newcpu.percpu && sockscf.state.cpuid != -1) {
+      /* mother has given us a cpu of our own; bind to that only. */
+      cpu_zero(&newcpu.mask);
+      cpu_set(sockscf.state.cpuid, &newcpu.mask);
+   }
 #endif /* HAVE_SCHED_SETAFFINITY */
 
    if (!sockscf.option.verifyonly)
@@ -257,6 +294,9 @@ socks_addroute(newroute, last)
    *route = *newroute;
    bzero(&nilstate, sizeof(nilstate));
 
+   if (route->weight == 0)
+      route->weight = 1;
+
    if (route->gw.state.proxyprotocol.upnp) {
       if (route->gw.addr.atype == SOCKS_ADDR_DOMAIN
       &&  strcmp(route->gw.addr.addr.domain, PROXY_BROADCASTs) == 0)
@@ -831,284 +871,380 @@ socks_autoadd_directroute(command, protocol, saddr, netmask)
    return socks_addroute(&route, 0);
 }
 
-route_t *
-socks_getroute(req, src, dst)
+static int
+routematches(route, req, src, dst)
+   route_t *route;
    const request_t *req;
    const sockshost_t *src;
    const sockshost_t *dst;
 {
-   const char *function = "socks_getroute()";
-   route_t *route;
-   char srcbuf[MAXSOCKSHOSTSTRING], dstbuf[MAXSOCKSHOSTSTRING];
-
-#if SOCKS_CLIENT
-   clientinit();
-#endif /* SOCKS_CLIENT */
+   const char *function = "routematches()";
 
-   slog(LOG_DEBUG,
-        "%s: searching for %s route for %s, protocol %s, src %s, dst %s, ...",
-        function,
-        proxyprotocol2string(req->version),
-        command2string(req->command), protocol2string(req->protocol),
-        src == NULL ? "<NONE>" : sockshost2string(src, srcbuf, sizeof(srcbuf)),
-        dst == NULL ? "<NONE>" : sockshost2string(dst, dstbuf, sizeof(dstbuf)));
+   socks_showroute(route);
 
-   for (route = sockscf.route; route != NULL; route = route->next) {
-      socks_showroute(route);
-
-      if (sockscf.routeoptions.maxfail != 0
-      &&  route->state.failed >= sockscf.routeoptions.maxfail) {
-         if (sockscf.routeoptions.badexpire == 0
-         ||  socks_difftime(time_monotonic(NULL), route->state.badtime)
-             <= sockscf.routeoptions.badexpire) {
-            slog(LOG_DEBUG, "%s: route does not match; badtime", function);
-            continue;
-         }
-         else
-            route->state.failed = 0; /* reset. */
+   if (sockscf.routeoptions.maxfail != 0
+   &&  route->state.failed >= sockscf.routeoptions.maxfail) {
+      if (sockscf.routeoptions.badexpire == 0
+      ||  socks_difftime(time_monotonic(NULL), route->state.badtime)
+          <= sockscf.routeoptions.badexpire) {
+         slog(LOG_DEBUG, "%s: route does not match; badtime", function);
+         return 0;
       }
+      else
+         route->state.failed = 0; /* reset. */
+   }
 
-      switch (req->version) {
-         /*
-          * First check if this rule can provide requested proxyprotocol
-          * version with necessary functionality.
-          */
+   switch (req->version) {
+      /*
+       * First check if this rule can provide requested proxyprotocol
+       * version with necessary functionality.
+       */
 
-         case PROXY_SOCKS_V4:
-            if (!route->gw.state.proxyprotocol.socks_v4) {
-               slog(LOG_DEBUG, "%s: route does not match; version", function);
-               continue;
-            }
+      case PROXY_SOCKS_V4:
+         if (!route->gw.state.proxyprotocol.socks_v4) {
+            slog(LOG_DEBUG, "%s: route does not match; version", function);
+            return 0;
+         }
 
-            switch (req->host.atype) {
-               case SOCKS_ADDR_IPV4:
-                  break;
+         switch (req->host.atype) {
+            case SOCKS_ADDR_IPV4:
+               break;
 
-               default:
-                  slog(LOG_DEBUG, "%s: route does not match; atype", function);
-                  continue;  /* not supported by v4. */
-            }
+            default:
+               slog(LOG_DEBUG, "%s: route does not match; atype", function);
+               return 0;  /* not supported by v4. */
+         }
 
-            switch (req->command) {
-               case SOCKS_BIND:
-               case SOCKS_CONNECT:
-                  break;
+         switch (req->command) {
+            case SOCKS_BIND:
+            case SOCKS_CONNECT:
+               break;
 
-               default:
-                  slog(LOG_DEBUG, "%s: route does not match; cmd", function);
-                  continue; /* not supported by v4. */
-            }
+            default:
+               slog(LOG_DEBUG, "%s: route does not match; cmd", function);
+               return 0; /* not supported by v4. */
+         }
 
-            break;
+         break;
 
-         case PROXY_SOCKS_V5:
-            if (!route->gw.state.proxyprotocol.socks_v5) {
-               slog(LOG_DEBUG, "%s: route does not match; version", function);
-               continue;
-            }
+      case PROXY_SOCKS_V5:
+         if (!route->gw.state.proxyprotocol.socks_v5) {
+            slog(LOG_DEBUG, "%s: route does not match; version", function);
+            return 0;
+         }
 
-            switch (req->host.atype) {
-               case SOCKS_ADDR_IPV4:
-               case SOCKS_ADDR_IPV6:
-               case SOCKS_ADDR_DOMAIN:
-                  break;
+         switch (req->host.atype) {
+            case SOCKS_ADDR_IPV4:
+            case SOCKS_ADDR_IPV6:
+            case SOCKS_ADDR_DOMAIN:
+               break;
 
-               default:
-                  SERRX(req->host.atype); /* failure, nothing else exists. */
-            }
-            break;
+            default:
+               SERRX(req->host.atype); /* failure, nothing else exists. */
+         }
+         break;
 
-         case PROXY_HTTP_10:
-         case PROXY_HTTP_11:
-            if (!route->gw.state.proxyprotocol.http) {
-               slog(LOG_DEBUG, "%s: route does not match; version", function);
-               continue;
-            }
+      case PROXY_HTTP_10:
+      case PROXY_HTTP_11:
+         if (!route->gw.state.proxyprotocol.http) {
+            slog(LOG_DEBUG, "%s: route does not match; version", function);
+            return 0;
+         }
 
-            switch (req->command) {
-               case SOCKS_CONNECT:
-                  break;
+         switch (req->command) {
+            case SOCKS_CONNECT:
+               break;
 
-               default:
-                  slog(LOG_DEBUG, "%s: route does not match; cmd", function);
-                  continue; /* not supported by http. */
-            }
+            default:
+               slog(LOG_DEBUG, "%s: route does not match; cmd", function);
+               return 0; /* not supported by http. */
+         }
 
-            break;
+         break;
 
-         case PROXY_UPNP:
-            if (!route->gw.state.proxyprotocol.upnp) {
-               slog(LOG_DEBUG, "%s: route does not match; version", function);
-               continue;
-            }
-            break;
+      case PROXY_UPNP:
+         if (!route->gw.state.proxyprotocol.upnp) {
+            slog(LOG_DEBUG, "%s: route does not match; version", function);
+            return 0;
+         }
+         break;
 
-         case PROXY_DIRECT:
-            if (!route->gw.state.proxyprotocol.direct) {
-               slog(LOG_DEBUG, "%s: route does not match; version", function);
-               continue;
-            }
-            break;
+      case PROXY_DIRECT:
+         if (!route->gw.state.proxyprotocol.direct) {
+            slog(LOG_DEBUG, "%s: route does not match; version", function);
+            return 0;
+         }
+         break;
 
-         default:
-            SERRX(req->version);
-      }
+      default:
+         SERRX(req->version);
+   }
 
-      switch (req->command) {
-         case SOCKS_BIND:
-            if (!route->gw.state.command.bind) {
-               slog(LOG_DEBUG, "%s: route does not match; cmd", function);
-               continue;
-            }
+   switch (req->command) {
+      case SOCKS_BIND:
+         if (!route->gw.state.command.bind) {
+            slog(LOG_DEBUG, "%s: route does not match; cmd", function);
+            return 0;
+         }
 
-            /*
-             * Need to check protocol and proxyprotocol also.  Even if
-             * bind is supported for one protocol (e.g., tcp) it does
-             * not mean it is supported for another protocol (e.g., udp).
-             */
-            switch (req->version) {
-               case PROXY_SOCKS_V4:
-               case PROXY_SOCKS_V5:
-                  if (req->protocol == SOCKS_TCP)
-                     break; /* yes, supported. */
-                  else {
-                     SASSERTX(req->protocol == SOCKS_UDP);
-                     /* and fallthrough.  Not supported. */
-                  }
+         /*
+          * Need to check protocol and proxyprotocol also.  Even if
+          * bind is supported for one protocol (e.g., tcp) it does
+          * not mean it is supported for another protocol (e.g., udp).
+          */
+         switch (req->version) {
+            case PROXY_SOCKS_V4:
+            case PROXY_SOCKS_V5:
+               if (req->protocol == SOCKS_TCP)
+                  break; /* yes, supported. */
+               else {
+                  SASSERTX(req->protocol == SOCKS_UDP);
+                  /* and fallthrough.  Not supported. */
+               }
 
-               case PROXY_HTTP_10:
-               case PROXY_HTTP_11:
-                  slog(LOG_DEBUG,
-                       "%s: route does not match; bind command is not "
-                       "supported by proxyprotocol",
-                       function);
+            case PROXY_HTTP_10:
+            case PROXY_HTTP_11:
+               slog(LOG_DEBUG,
+                    "%s: route does not match; bind command is not "
+                    "supported by proxyprotocol",
+                    function);
 
-                  continue;
+               return 0;
 
-               case PROXY_UPNP:
-               case PROXY_DIRECT:
-                  break;
+            case PROXY_UPNP:
+            case PROXY_DIRECT:
+               break;
 
-               default:
-                  SERRX(req->version);
-            }
+            default:
+               SERRX(req->version);
+         }
 
-            break;
+         break;
 
-         case SOCKS_CONNECT:
-            if (!route->gw.state.command.connect) {
-               slog(LOG_DEBUG, "%s: route does not match; cmd", function);
-               continue;
-            }
-            break;
+      case SOCKS_CONNECT:
+         if (!route->gw.state.command.connect) {
+            slog(LOG_DEBUG, "%s: route does not match; cmd", function);
+            return 0;
+         }
+         break;
 
-         case SOCKS_UDPASSOCIATE:
-            if (!route->gw.state.command.udpassociate) {
-               slog(LOG_DEBUG, "%s: route does not match; cmd", function);
-               continue;
-            }
-            break;
+      case SOCKS_UDPASSOCIATE:
+         if (!route->gw.state.command.udpassociate) {
+            slog(LOG_DEBUG, "%s: route does not match; cmd", function);
+            return 0;
+         }
+         break;
 
-         default:
-            SERRX(req->command);
-      }
+      default:
+         SERRX(req->command);
+   }
 
-      /*
-       * server supports protocol?
-       */
-      if ((req->protocol == SOCKS_TCP && !route->gw.state.protocol.tcp)
-      ||  (req->protocol == SOCKS_UDP && !route->gw.state.protocol.udp)) {
-         slog(LOG_DEBUG, "%s: route does not match; protocol", function);
-         continue;
-      }
+   /*
+    * server supports protocol?
+    */
+   if ((req->protocol == SOCKS_TCP && !route->gw.state.protocol.tcp)
+   ||  (req->protocol == SOCKS_UDP && !route->gw.state.protocol.udp)) {
+      slog(LOG_DEBUG, "%s: route does not match; protocol", function);
+      return 0;
+   }
 
+   /*
+    * server supports method?
+    */
+   switch (req->version) {
       /*
-       * server supports method?
+       * These proxyprotocols do not support authentication, or
+       * we do not support the authentication part of them.
+       * So if the requested proxyprotocol is one of the below, the
+       * the route must not require authentication if we should be
+       * able to use it.  If it does not, there is no point in
+       * checking what auth we have set for the client (if any).
        */
-      switch (req->version) {
-         /*
-          * These proxyprotocols do not support authentication, or
-          * we do not support the authentication part of them.
-          * So if the requested proxyprotocol is one of the below, the
-          * the route must not require authentication if we should be
-          * able to use it.  If it does not, there is no point in
-          * checking what auth we have set for the client (if any).
-          */
-         case PROXY_DIRECT:
-         case PROXY_HTTP_10:
-         case PROXY_HTTP_11:
-         case PROXY_SOCKS_V4:
-         case PROXY_UPNP:
-            if (!methodisset(AUTHMETHOD_NONE,
-                             route->gw.state.smethodv,
-                             route->gw.state.smethodc)) {
-               slog(LOG_DEBUG, "%s: route does not match; method", function);
-               continue;
-            }
+      case PROXY_DIRECT:
+      case PROXY_HTTP_10:
+      case PROXY_HTTP_11:
+      case PROXY_SOCKS_V4:
+      case PROXY_UPNP:
+         if (!methodisset(AUTHMETHOD_NONE,
+                          route->gw.state.smethodv,
+                          route->gw.state.smethodc)) {
+            slog(LOG_DEBUG, "%s: route does not match; method", function);
+            return 0;
+         }
 
-            break;
+         break;
 
-         case PROXY_SOCKS_V5: /* v5 supports all methods we can support. */
-            break;
+      case PROXY_SOCKS_V5: /* v5 supports all methods we can support. */
+         break;
 
-         default:
-            SERRX(req->version);
-      }
+      default:
+         SERRX(req->version);
+   }
 
-      if (req->auth != NULL && req->auth->method != AUTHMETHOD_NOTSET) {
-         /*
-          * authmethod is already set.  Must be serverchaining.
-          */
-         SASSERTX(!SOCKS_CLIENT);
+   if (req->auth != NULL && req->auth->method != AUTHMETHOD_NOTSET) {
+      /*
+       * authmethod is already set.  Must be serverchaining.
+       */
+      SASSERTX(!SOCKS_CLIENT);
 
-         slog(LOG_DEBUG,
-              "%s: authmethod already set to %s.  Checking route for support",
-              function, method2string(req->auth->method));
+      slog(LOG_DEBUG,
+           "%s: authmethod already set to %s.  Checking route for support",
+           function, method2string(req->auth->method));
 
-         if (!methodisset(req->auth->method,
+      if (!methodisset(req->auth->method,
+                       route->gw.state.smethodv,
+                       route->gw.state.smethodc)) {
+         if (methodisset(AUTHMETHOD_NONE,
                           route->gw.state.smethodv,
                           route->gw.state.smethodc)) {
-            if (methodisset(AUTHMETHOD_NONE,
-                             route->gw.state.smethodv,
-                             route->gw.state.smethodc)) {
-               slog(LOG_DEBUG,
-                    "%s: route #%lu supports authmethod %s, meaning it "
-                    "should work regardless of the authinfo we have "
-                    "received from the client",
-                    function,
-                    (unsigned long)route->number,
-                    method2string(AUTHMETHOD_NONE));
-            }
-            else {
-               slog(LOG_DEBUG, "%s: route does not match; method", function);
-               continue;
-            }
+            slog(LOG_DEBUG,
+                 "%s: route #%lu supports authmethod %s, meaning it "
+                 "should work regardless of the authinfo we have "
+                 "received from the client",
+                 function,
+                 (unsigned long)route->number,
+                 method2string(AUTHMETHOD_NONE));
+         }
+         else {
+            slog(LOG_DEBUG, "%s: route does not match; method", function);
+            return 0;
          }
       }
+   }
 
-      if (src != NULL) {
-         slog(LOG_DEBUG, "%s: checking for src match ...", function);
-         if (!addrmatch(&route->src, src, NULL, req->protocol, 0)) {
-            slog(LOG_DEBUG, "%s: route does not match; src addr", function);
-            continue;
-         }
+   if (src != NULL) {
+      slog(LOG_DEBUG, "%s: checking for src match ...", function);
+      if (!addrmatch(&route->src, src, NULL, req->protocol, 0)) {
+         slog(LOG_DEBUG, "%s: route does not match; src addr", function);
+         return 0;
       }
+   }
 
-      if (dst != NULL) {
-         slog(LOG_DEBUG, "%s: checking for dst match ...", function);
-         if (!addrmatch(&route->dst, dst, NULL, req->protocol, 0)) {
-            slog(LOG_DEBUG, "%s: route does not match; dst addr", function);
-            continue;
-         }
+   if (dst != NULL) {
+      slog(LOG_DEBUG, "%s: checking for dst match ...", function);
+      if (!addrmatch(&route->dst, dst, NULL, req->protocol, 0)) {
+         slog(LOG_DEBUG, "%s: route does not match; dst addr", function);
+         return 0;
       }
+   }
+
+   return 1;   /* all matched */
+}
+
+static route_t *
+routebalance(route, req, src, dst, commit)
+   route_t *route;
+   const request_t *req;
+   const sockshost_t *src;
+   const sockshost_t *dst;
+   const int commit;
+{
+   const char *function = "routebalance()";
+   route_t *best, *r;
+   long total;
+   int weighted;
+
+   /*
+    * Smooth weighted round-robin: every time a route is used, all the
+    * equivalent routes gain their weight, and the route used loses the
+    * sum of the weights.  The route to use is the one with the most.
+    */
+   best     = NULL;
+   total    = 0;
+   weighted = 0;
+
+   for (r = sockscf.route; r != NULL; r = r->next) {
+      if (!routeisequivalent(r, route, req, src, dst))
+         continue;
+
+      if (r->weight_isset)
+         weighted = 1;
 
-      break;   /* all matched */
+      total += (long)r->weight;
+
+      if (best == NULL
+      ||  r->state.current + (long)r->weight
+          > best->state.current + (long)best->weight)
+         best = r;
+   }
+
+   SASSERTX(best != NULL);
+
+   if (!weighted)
+      return route; /* first match, as without balancing. */
+
+   if (best == route && (long)route->weight == total)
+      return route; /* no equivalent routes. */
+
+   slog(LOG_DEBUG, "%s: route #%d selected among equivalents to route #%d%s",
+        function, best->number, route->number, commit ? "" : " (peek)");
+
+   if (commit) {
+      for (r = sockscf.route; r != NULL; r = r->next)
+         if (routeisequivalent(r, route, req, src, dst))
+            r->state.current += (long)r->weight;
+
+      best->state.current -= total;
    }
 
+   return best;
+}
+
+static int
+routeisequivalent(route, to, req, src, dst)
+   route_t *route;
+   const route_t *to;
+   const request_t *req;
+   const sockshost_t *src;
+   const sockshost_t *dst;
+{
+
+   if (route == to)
+      return 1;
+
+   /*
+    * Routes are zeroed before they are parsed, so comparing the addresses
+    * with memcmp(3) is fine.
+    */
+   if (memcmp(&route->src, &to->src, sizeof(route->src)) != 0
+   ||  memcmp(&route->dst, &to->dst, sizeof(route->dst)) != 0)
+      return 0;
+
+   return routematches(route, req, src, dst);
+}
+
+route_t *
+socks_getroute(req, src, dst)
+   const request_t *req;
+   const sockshost_t *src;
+   const sockshost_t *dst;
+{
+   const char *function = "socks_getroute()";
+   route_t *route;
+   char srcbuf[MAXSOCKSHOSTSTRING], dstbuf[MAXSOCKSHOSTSTRING];
+
+#if SOCKS_CLIENT
+   clientinit();
+#endif /* SOCKS_CLIENT */
+
+   slog(LOG_DEBUG,
+        "%s: searching for %s route for %s, protocol %s, src %s, dst %s, ...",
+        function,
+        proxyprotocol2string(req->version),
+        command2string(req->command), protocol2string(req->protocol),
+        src == NULL ? "<NONE>" : sockshost2string(src, srcbuf, sizeof(srcbuf)),
+        dst == NULL ? "<NONE>" : sockshost2string(dst, dstbuf, sizeof(dstbuf)));
+
+   for (route = sockscf.route; route != NULL; route = route->next)
+      if (routematches(route, req, src, dst))
+         break;
+
    if (route == NULL)
       slog(LOG_DEBUG, "%s: no %s route found",
            function, proxyprotocol2string(req->version));
    else {
+      route = routebalance(route, req, src, dst, 0);
+
       slog(LOG_DEBUG, "%s: %s route found, route #%d",
            function, proxyprotocol2string(req->version), route->number);
 
@@ -1259,6 +1395,12 @@ socks_connectroute(s, packet, src, dst, emsg, emsglen)
    if ((route = socks_getroute(&packet->req, src, dst)) == NULL)
       SERRX(0); /* should only be called if there is a route. */
 
+   /*
+    * We are going to use this route, so let the next request get the
+    * next of the equivalent routes, if any.
+    */
+   route = routebalance(route, &packet->req, src, dst, 1);
+
    slog(LOG_NEGOTIATE, "%s: have %s route (route #%d) to %s via %s",
         function,
         proxyprotocols2string(&route->gw.state.proxyprotocol, NULL, 0),
@@ -1368,8 +1510,17 @@ socks_connectroute(s, packet, src, dst, emsg, emsglen)
                                &route->gw.addr,
                                NULL,
                                NULL,
+#if SOCKS_CLIENT
                                sockscf.timeout.connect ?
                                  (long)sockscf.timeout.connect : (long)-1,
+#else /* !SOCKS_CLIENT */
+                               /*
+                                * the request child waits for the connect
+                                * to complete together with its other
+                                * requests, and times it out itself.
+                                */
+                               (long)0,
+#endif /* !SOCKS_CLIENT */
                                emsg,
                                emsglen)) == 0
    || (rc == -1 && errno == EINPROGRESS)) {
@@ -1565,6 +1716,15 @@ optioninit(void)
    sockscf.timeout.udpio         = SOCKD_IOTIMEOUT_UDP;
    sockscf.timeout.tcp_fin_wait  = SOCKD_FIN_WAIT_2_TIMEOUT;
 
+   sockscf.child.maxclients.negotiate = SOCKD_NEGOTIATEMAX;
+   sockscf.child.maxclients.request   = SOCKD_REQUESTMAX;
+   sockscf.child.maxclients.io        = SOCKD_IOMAX;
+
+   sockscf.hostcache.entries     = SOCKD_HOSTCACHE;
+   sockscf.hostcache.ttl.min     = SOCKD_HOSTCACHE_TTLMIN;
+   sockscf.hostcache.ttl.max     = SOCKD_HOSTCACHE_TTLMAX;
+   sockscf.happyeyeballs.delay   = SOCKD_HAPPYEYEBALLS_DELAY;
+
    sockscf.external.rotation     = ROTATION_NONE;
 
 #if HAVE_PAM
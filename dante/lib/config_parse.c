@@ -1,42 +1,82 @@
 #include "common.h"
-#include <stdlib.h>
-#include <string.h>
-#define YYBYACC 1
-#define YYMAJOR 1
-#define YYMINOR 9
-#define YYLEX yylex()
-#define YYEMPTY -1
-#define yyclearin (yychar=(YYEMPTY))
-#define yyerrok (yyerrflag=0)
-#define YYRECOVERING() (yyerrflag!=0)
-#define yyparse socks_yyparse
-#define yylex socks_yylex
-#define yyerror socks_yyerror
-#define yychar socks_yychar
-#define yyval socks_yyval
-#define yylval socks_yylval
-#define yydebug socks_yydebug
-#define yynerrs socks_yynerrs
-#define yyerrflag socks_yyerrflag
-#define yyss socks_yyss
-#define yysslim socks_yysslim
-#define yyssp socks_yyssp
-#define yyvs socks_yyvs
-#define yyvsp socks_yyvsp
-#define yystacksize socks_yystacksize
-#define yylhs socks_yylhs
-#define yylen socks_yylen
-#define yydefred socks_yydefred
-#define yydgoto socks_yydgoto
-#define yysindex socks_yysindex
-#define yyrindex socks_yyrindex
-#define yygindex socks_yygindex
-#define yytable socks_yytable
-#define yycheck socks_yycheck
-#define yyname socks_yyname
-#define yyrule socks_yyrule
-#define YYPREFIX "socks_yy"
-#line 46 "config_parse.y"
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+/* Substitute the variable and function names.  */
+#define yyparse         socks_yyparse
+#define yylex           socks_yylex
+#define yyerror         socks_yyerror
+#define yydebug         socks_yydebug
+#define yynerrs         socks_yynerrs
+#define yylval          socks_yylval
+#define yychar          socks_yychar
+
+/* First part of user prologue.  */
+#line 45 "config_parse.y"
+
 
 #include "yacconfig.h"
 
@@ -384,10 +424,522 @@ do {                                                                           \
             ASSIGN_NUMBER((number), >, 0, obj, issigned)
 #define ASSIGN_MAXSESSIONS(number, obj, issigned)          \
             ASSIGN_NUMBER((number), >, 0, obj, issigned)
+
+#line 428 "config_parse.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+/* Use api.header.include to #include this header
+   instead of duplicating it here.  */
+#ifndef YY_SOCKS_YY_Y_TAB_H_INCLUDED
+# define YY_SOCKS_YY_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int socks_yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    ALARM = 258,                   /* ALARM  */
+    ALARMTYPE_DATA = 259,          /* ALARMTYPE_DATA  */
+    ALARMTYPE_DISCONNECT = 260,    /* ALARMTYPE_DISCONNECT  */
+    ALARMIF_INTERNAL = 261,        /* ALARMIF_INTERNAL  */
+    ALARMIF_EXTERNAL = 262,        /* ALARMIF_EXTERNAL  */
+    TCPOPTION_DISABLED = 263,      /* TCPOPTION_DISABLED  */
+    ECN = 264,                     /* ECN  */
+    SACK = 265,                    /* SACK  */
+    TIMESTAMPS = 266,              /* TIMESTAMPS  */
+    WSCALE = 267,                  /* WSCALE  */
+    MTU_ERROR = 268,               /* MTU_ERROR  */
+    CLIENTCOMPATIBILITY = 269,     /* CLIENTCOMPATIBILITY  */
+    NECGSSAPI = 270,               /* NECGSSAPI  */
+    CLIENTRULE = 271,              /* CLIENTRULE  */
+    HOSTIDRULE = 272,              /* HOSTIDRULE  */
+    SOCKSRULE = 273,               /* SOCKSRULE  */
+    COMPATIBILITY = 274,           /* COMPATIBILITY  */
+    SAMEPORT = 275,                /* SAMEPORT  */
+    DRAFT_5_05 = 276,              /* DRAFT_5_05  */
+    CONNECTTIMEOUT = 277,          /* CONNECTTIMEOUT  */
+    TCP_FIN_WAIT = 278,            /* TCP_FIN_WAIT  */
+    CPU = 279,                     /* CPU  */
+    MASK = 280,                    /* MASK  */
+    SCHEDULE = 281,                /* SCHEDULE  */
+    CPUMASK_ANYCPU = 282,          /* CPUMASK_ANYCPU  */
+    CPUMASK_PERCPU = 283,          /* CPUMASK_PERCPU  */
+    DEBUGGING = 284,               /* DEBUGGING  */
+    DEPRECATED = 285,              /* DEPRECATED  */
+    ERRORLOG = 286,                /* ERRORLOG  */
+    LOGOUTPUT = 287,               /* LOGOUTPUT  */
+    LOGFILE = 288,                 /* LOGFILE  */
+    LOGTYPE_ERROR = 289,           /* LOGTYPE_ERROR  */
+    LOGTYPE_TCP_DISABLED = 290,    /* LOGTYPE_TCP_DISABLED  */
+    LOGTYPE_TCP_ENABLED = 291,     /* LOGTYPE_TCP_ENABLED  */
+    LOGIF_INTERNAL = 292,          /* LOGIF_INTERNAL  */
+    LOGIF_EXTERNAL = 293,          /* LOGIF_EXTERNAL  */
+    ERRORVALUE = 294,              /* ERRORVALUE  */
+    EXTENSION = 295,               /* EXTENSION  */
+    BIND = 296,                    /* BIND  */
+    PRIVILEGED = 297,              /* PRIVILEGED  */
+    EXTERNAL_PROTOCOL = 298,       /* EXTERNAL_PROTOCOL  */
+    INTERNAL_PROTOCOL = 299,       /* INTERNAL_PROTOCOL  */
+    EXTERNAL_ROTATION = 300,       /* EXTERNAL_ROTATION  */
+    SAMESAME = 301,                /* SAMESAME  */
+    GROUPNAME = 302,               /* GROUPNAME  */
+    HOSTID = 303,                  /* HOSTID  */
+    HOSTINDEX = 304,               /* HOSTINDEX  */
+    INTERFACE = 305,               /* INTERFACE  */
+    SOCKETOPTION_SYMBOLICVALUE = 306, /* SOCKETOPTION_SYMBOLICVALUE  */
+    INTERNAL = 307,                /* INTERNAL  */
+    EXTERNAL = 308,                /* EXTERNAL  */
+    INTERNALSOCKET = 309,          /* INTERNALSOCKET  */
+    EXTERNALSOCKET = 310,          /* EXTERNALSOCKET  */
+    IOTIMEOUT = 311,               /* IOTIMEOUT  */
+    IOTIMEOUT_TCP = 312,           /* IOTIMEOUT_TCP  */
+    IOTIMEOUT_UDP = 313,           /* IOTIMEOUT_UDP  */
+    NEGOTIATETIMEOUT = 314,        /* NEGOTIATETIMEOUT  */
+    LIBWRAP_FILE = 315,            /* LIBWRAP_FILE  */
+    LOGLEVEL = 316,                /* LOGLEVEL  */
+    SOCKSMETHOD = 317,             /* SOCKSMETHOD  */
+    CLIENTMETHOD = 318,            /* CLIENTMETHOD  */
+    METHOD = 319,                  /* METHOD  */
+    METHODNAME = 320,              /* METHODNAME  */
+    NONE = 321,                    /* NONE  */
+    BSDAUTH = 322,                 /* BSDAUTH  */
+    GSSAPI = 323,                  /* GSSAPI  */
+    PAM_ADDRESS = 324,             /* PAM_ADDRESS  */
+    PAM_ANY = 325,                 /* PAM_ANY  */
+    PAM_USERNAME = 326,            /* PAM_USERNAME  */
+    RFC931 = 327,                  /* RFC931  */
+    UNAME = 328,                   /* UNAME  */
+    MONITOR = 329,                 /* MONITOR  */
+    PROCESSTYPE = 330,             /* PROCESSTYPE  */
+    PROC_MAXREQUESTS = 331,        /* PROC_MAXREQUESTS  */
+    PROC_MAXCLIENTS_NEGOTIATE = 332, /* PROC_MAXCLIENTS_NEGOTIATE  */
+    PROC_MAXCLIENTS_IO = 333,      /* PROC_MAXCLIENTS_IO  */
+    PROC_MAXCLIENTS_REQUEST = 334, /* PROC_MAXCLIENTS_REQUEST  */
+    PROC_REUSEPORT = 335,          /* PROC_REUSEPORT  */
+    PROC_ALLINONE = 336,           /* PROC_ALLINONE  */
+    HOSTCACHE_ENTRIES = 337,       /* HOSTCACHE_ENTRIES  */
+    HOSTCACHE_TTL_MIN = 338,       /* HOSTCACHE_TTL_MIN  */
+    HOSTCACHE_TTL_MAX = 339,       /* HOSTCACHE_TTL_MAX  */
+    HAPPYEYEBALLS_DELAY = 340,     /* HAPPYEYEBALLS_DELAY  */
+    REALM = 341,                   /* REALM  */
+    REALNAME = 342,                /* REALNAME  */
+    RESOLVEPROTOCOL = 343,         /* RESOLVEPROTOCOL  */
+    REQUIRED = 344,                /* REQUIRED  */
+    SCHEDULEPOLICY = 345,          /* SCHEDULEPOLICY  */
+    SERVERCONFIG = 346,            /* SERVERCONFIG  */
+    CLIENTCONFIG = 347,            /* CLIENTCONFIG  */
+    SOCKET = 348,                  /* SOCKET  */
+    CLIENTSIDE_SOCKET = 349,       /* CLIENTSIDE_SOCKET  */
+    SNDBUF = 350,                  /* SNDBUF  */
+    RCVBUF = 351,                  /* RCVBUF  */
+    SOCKETPROTOCOL = 352,          /* SOCKETPROTOCOL  */
+    SOCKETOPTION_OPTID = 353,      /* SOCKETOPTION_OPTID  */
+    SRCHOST = 354,                 /* SRCHOST  */
+    NODNSMISMATCH = 355,           /* NODNSMISMATCH  */
+    NODNSUNKNOWN = 356,            /* NODNSUNKNOWN  */
+    CHECKREPLYAUTH = 357,          /* CHECKREPLYAUTH  */
+    USERNAME = 358,                /* USERNAME  */
+    USER_PRIVILEGED = 359,         /* USER_PRIVILEGED  */
+    USER_UNPRIVILEGED = 360,       /* USER_UNPRIVILEGED  */
+    USER_LIBWRAP = 361,            /* USER_LIBWRAP  */
+    WORD__IN = 362,                /* WORD__IN  */
+    ROUTE = 363,                   /* ROUTE  */
+    VIA = 364,                     /* VIA  */
+    GLOBALROUTEOPTION = 365,       /* GLOBALROUTEOPTION  */
+    BADROUTE_EXPIRE = 366,         /* BADROUTE_EXPIRE  */
+    MAXFAIL = 367,                 /* MAXFAIL  */
+    ROUTE_WEIGHT = 368,            /* ROUTE_WEIGHT  */
+    PORT = 369,                    /* PORT  */
+    NUMBER = 370,                  /* NUMBER  */
+    BANDWIDTH = 371,               /* BANDWIDTH  */
+    BOUNCE = 372,                  /* BOUNCE  */
+    BSDAUTHSTYLE = 373,            /* BSDAUTHSTYLE  */
+    BSDAUTHSTYLENAME = 374,        /* BSDAUTHSTYLENAME  */
+    COMMAND = 375,                 /* COMMAND  */
+    COMMAND_BIND = 376,            /* COMMAND_BIND  */
+    COMMAND_CONNECT = 377,         /* COMMAND_CONNECT  */
+    COMMAND_UDPASSOCIATE = 378,    /* COMMAND_UDPASSOCIATE  */
+    COMMAND_BINDREPLY = 379,       /* COMMAND_BINDREPLY  */
+    COMMAND_UDPREPLY = 380,        /* COMMAND_UDPREPLY  */
+    ACTION = 381,                  /* ACTION  */
+    FROM = 382,                    /* FROM  */
+    TO = 383,                      /* TO  */
+    GSSAPIENCTYPE = 384,           /* GSSAPIENCTYPE  */
+    GSSAPIENC_ANY = 385,           /* GSSAPIENC_ANY  */
+    GSSAPIENC_CLEAR = 386,         /* GSSAPIENC_CLEAR  */
+    GSSAPIENC_INTEGRITY = 387,     /* GSSAPIENC_INTEGRITY  */
+    GSSAPIENC_CONFIDENTIALITY = 388, /* GSSAPIENC_CONFIDENTIALITY  */
+    GSSAPIENC_PERMESSAGE = 389,    /* GSSAPIENC_PERMESSAGE  */
+    GSSAPIKEYTAB = 390,            /* GSSAPIKEYTAB  */
+    GSSAPISERVICE = 391,           /* GSSAPISERVICE  */
+    GSSAPISERVICENAME = 392,       /* GSSAPISERVICENAME  */
+    GSSAPIKEYTABNAME = 393,        /* GSSAPIKEYTABNAME  */
+    IPV4 = 394,                    /* IPV4  */
+    IPV6 = 395,                    /* IPV6  */
+    IPVANY = 396,                  /* IPVANY  */
+    DOMAINNAME = 397,              /* DOMAINNAME  */
+    IFNAME = 398,                  /* IFNAME  */
+    URL = 399,                     /* URL  */
+    LDAPATTRIBUTE = 400,           /* LDAPATTRIBUTE  */
+    LDAPATTRIBUTE_AD = 401,        /* LDAPATTRIBUTE_AD  */
+    LDAPATTRIBUTE_HEX = 402,       /* LDAPATTRIBUTE_HEX  */
+    LDAPATTRIBUTE_AD_HEX = 403,    /* LDAPATTRIBUTE_AD_HEX  */
+    LDAPBASEDN = 404,              /* LDAPBASEDN  */
+    LDAP_BASEDN = 405,             /* LDAP_BASEDN  */
+    LDAPBASEDN_HEX = 406,          /* LDAPBASEDN_HEX  */
+    LDAPBASEDN_HEX_ALL = 407,      /* LDAPBASEDN_HEX_ALL  */
+    LDAPCERTFILE = 408,            /* LDAPCERTFILE  */
+    LDAPCERTPATH = 409,            /* LDAPCERTPATH  */
+    LDAPPORT = 410,                /* LDAPPORT  */
+    LDAPPORTSSL = 411,             /* LDAPPORTSSL  */
+    LDAPDEBUG = 412,               /* LDAPDEBUG  */
+    LDAPDEPTH = 413,               /* LDAPDEPTH  */
+    LDAPAUTO = 414,                /* LDAPAUTO  */
+    LDAPSEARCHTIME = 415,          /* LDAPSEARCHTIME  */
+    LDAPDOMAIN = 416,              /* LDAPDOMAIN  */
+    LDAP_DOMAIN = 417,             /* LDAP_DOMAIN  */
+    LDAPFILTER = 418,              /* LDAPFILTER  */
+    LDAPFILTER_AD = 419,           /* LDAPFILTER_AD  */
+    LDAPFILTER_HEX = 420,          /* LDAPFILTER_HEX  */
+    LDAPFILTER_AD_HEX = 421,       /* LDAPFILTER_AD_HEX  */
+    LDAPGROUP = 422,               /* LDAPGROUP  */
+    LDAPGROUP_NAME = 423,          /* LDAPGROUP_NAME  */
+    LDAPGROUP_HEX = 424,           /* LDAPGROUP_HEX  */
+    LDAPGROUP_HEX_ALL = 425,       /* LDAPGROUP_HEX_ALL  */
+    LDAPKEYTAB = 426,              /* LDAPKEYTAB  */
+    LDAPKEYTABNAME = 427,          /* LDAPKEYTABNAME  */
+    LDAPDEADTIME = 428,            /* LDAPDEADTIME  */
+    LDAPSERVER = 429,              /* LDAPSERVER  */
+    LDAPSERVER_NAME = 430,         /* LDAPSERVER_NAME  */
+    LDAPSSL = 431,                 /* LDAPSSL  */
+    LDAPCERTCHECK = 432,           /* LDAPCERTCHECK  */
+    LDAPKEEPREALM = 433,           /* LDAPKEEPREALM  */
+    LDAPTIMEOUT = 434,             /* LDAPTIMEOUT  */
+    LDAPCACHE = 435,               /* LDAPCACHE  */
+    LDAPCACHEPOS = 436,            /* LDAPCACHEPOS  */
+    LDAPCACHENEG = 437,            /* LDAPCACHENEG  */
+    LDAPURL = 438,                 /* LDAPURL  */
+    LDAP_URL = 439,                /* LDAP_URL  */
+    LDAP_FILTER = 440,             /* LDAP_FILTER  */
+    LDAP_ATTRIBUTE = 441,          /* LDAP_ATTRIBUTE  */
+    LDAP_CERTFILE = 442,           /* LDAP_CERTFILE  */
+    LDAP_CERTPATH = 443,           /* LDAP_CERTPATH  */
+    LIBWRAPSTART = 444,            /* LIBWRAPSTART  */
+    LIBWRAP_ALLOW = 445,           /* LIBWRAP_ALLOW  */
+    LIBWRAP_DENY = 446,            /* LIBWRAP_DENY  */
+    LIBWRAP_HOSTS_ACCESS = 447,    /* LIBWRAP_HOSTS_ACCESS  */
+    LINE = 448,                    /* LINE  */
+    OPERATOR = 449,                /* OPERATOR  */
+    PAMSERVICENAME = 450,          /* PAMSERVICENAME  */
+    PROTOCOL = 451,                /* PROTOCOL  */
+    PROTOCOL_TCP = 452,            /* PROTOCOL_TCP  */
+    PROTOCOL_UDP = 453,            /* PROTOCOL_UDP  */
+    PROTOCOL_FAKE = 454,           /* PROTOCOL_FAKE  */
+    PROXYPROTOCOL = 455,           /* PROXYPROTOCOL  */
+    PROXYPROTOCOL_SOCKS_V4 = 456,  /* PROXYPROTOCOL_SOCKS_V4  */
+    PROXYPROTOCOL_SOCKS_V5 = 457,  /* PROXYPROTOCOL_SOCKS_V5  */
+    PROXYPROTOCOL_HTTP = 458,      /* PROXYPROTOCOL_HTTP  */
+    PROXYPROTOCOL_UPNP = 459,      /* PROXYPROTOCOL_UPNP  */
+    REDIRECT = 460,                /* REDIRECT  */
+    SENDSIDE = 461,                /* SENDSIDE  */
+    RECVSIDE = 462,                /* RECVSIDE  */
+    SERVICENAME = 463,             /* SERVICENAME  */
+    SESSION_INHERITABLE = 464,     /* SESSION_INHERITABLE  */
+    SESSIONMAX = 465,              /* SESSIONMAX  */
+    SESSIONTHROTTLE = 466,         /* SESSIONTHROTTLE  */
+    SESSIONSTATE_KEY = 467,        /* SESSIONSTATE_KEY  */
+    SESSIONSTATE_MAX = 468,        /* SESSIONSTATE_MAX  */
+    SESSIONSTATE_THROTTLE = 469,   /* SESSIONSTATE_THROTTLE  */
+    RULE_LOG = 470,                /* RULE_LOG  */
+    RULE_LOG_CONNECT = 471,        /* RULE_LOG_CONNECT  */
+    RULE_LOG_DATA = 472,           /* RULE_LOG_DATA  */
+    RULE_LOG_DISCONNECT = 473,     /* RULE_LOG_DISCONNECT  */
+    RULE_LOG_ERROR = 474,          /* RULE_LOG_ERROR  */
+    RULE_LOG_IOOPERATION = 475,    /* RULE_LOG_IOOPERATION  */
+    RULE_LOG_TCPINFO = 476,        /* RULE_LOG_TCPINFO  */
+    STATEKEY = 477,                /* STATEKEY  */
+    UDPPORTRANGE = 478,            /* UDPPORTRANGE  */
+    UDPCONNECTDST = 479,           /* UDPCONNECTDST  */
+    USER = 480,                    /* USER  */
+    GROUP = 481,                   /* GROUP  */
+    VERDICT_BLOCK = 482,           /* VERDICT_BLOCK  */
+    VERDICT_PASS = 483,            /* VERDICT_PASS  */
+    YES = 484,                     /* YES  */
+    NO = 485                       /* NO  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
+#define ALARM 258
+#define ALARMTYPE_DATA 259
+#define ALARMTYPE_DISCONNECT 260
+#define ALARMIF_INTERNAL 261
+#define ALARMIF_EXTERNAL 262
+#define TCPOPTION_DISABLED 263
+#define ECN 264
+#define SACK 265
+#define TIMESTAMPS 266
+#define WSCALE 267
+#define MTU_ERROR 268
+#define CLIENTCOMPATIBILITY 269
+#define NECGSSAPI 270
+#define CLIENTRULE 271
+#define HOSTIDRULE 272
+#define SOCKSRULE 273
+#define COMPATIBILITY 274
+#define SAMEPORT 275
+#define DRAFT_5_05 276
+#define CONNECTTIMEOUT 277
+#define TCP_FIN_WAIT 278
+#define CPU 279
+#define MASK 280
+#define SCHEDULE 281
+#define CPUMASK_ANYCPU 282
+#define CPUMASK_PERCPU 283
+#define DEBUGGING 284
+#define DEPRECATED 285
+#define ERRORLOG 286
+#define LOGOUTPUT 287
+#define LOGFILE 288
+#define LOGTYPE_ERROR 289
+#define LOGTYPE_TCP_DISABLED 290
+#define LOGTYPE_TCP_ENABLED 291
+#define LOGIF_INTERNAL 292
+#define LOGIF_EXTERNAL 293
+#define ERRORVALUE 294
+#define EXTENSION 295
+#define BIND 296
+#define PRIVILEGED 297
+#define EXTERNAL_PROTOCOL 298
+#define INTERNAL_PROTOCOL 299
+#define EXTERNAL_ROTATION 300
+#define SAMESAME 301
+#define GROUPNAME 302
+#define HOSTID 303
+#define HOSTINDEX 304
+#define INTERFACE 305
+#define SOCKETOPTION_SYMBOLICVALUE 306
+#define INTERNAL 307
+#define EXTERNAL 308
+#define INTERNALSOCKET 309
+#define EXTERNALSOCKET 310
+#define IOTIMEOUT 311
+#define IOTIMEOUT_TCP 312
+#define IOTIMEOUT_UDP 313
+#define NEGOTIATETIMEOUT 314
+#define LIBWRAP_FILE 315
+#define LOGLEVEL 316
+#define SOCKSMETHOD 317
+#define CLIENTMETHOD 318
+#define METHOD 319
+#define METHODNAME 320
+#define NONE 321
+#define BSDAUTH 322
+#define GSSAPI 323
+#define PAM_ADDRESS 324
+#define PAM_ANY 325
+#define PAM_USERNAME 326
+#define RFC931 327
+#define UNAME 328
+#define MONITOR 329
+#define PROCESSTYPE 330
+#define PROC_MAXREQUESTS 331
+#define PROC_MAXCLIENTS_NEGOTIATE 332
+#define PROC_MAXCLIENTS_IO 333
+#define PROC_MAXCLIENTS_REQUEST 334
+#define PROC_REUSEPORT 335
+#define PROC_ALLINONE 336
+#define HOSTCACHE_ENTRIES 337
+#define HOSTCACHE_TTL_MIN 338
+#define HOSTCACHE_TTL_MAX 339
+#define HAPPYEYEBALLS_DELAY 340
+#define REALM 341
+#define REALNAME 342
+#define RESOLVEPROTOCOL 343
+#define REQUIRED 344
+#define SCHEDULEPOLICY 345
+#define SERVERCONFIG 346
+#define CLIENTCONFIG 347
+#define SOCKET 348
+#define CLIENTSIDE_SOCKET 349
+#define SNDBUF 350
+#define RCVBUF 351
+#define SOCKETPROTOCOL 352
+#define SOCKETOPTION_OPTID 353
+#define SRCHOST 354
+#define NODNSMISMATCH 355
+#define NODNSUNKNOWN 356
+#define CHECKREPLYAUTH 357
+#define USERNAME 358
+#define USER_PRIVILEGED 359
+#define USER_UNPRIVILEGED 360
+#define USER_LIBWRAP 361
+#define WORD__IN 362
+#define ROUTE 363
+#define VIA 364
+#define GLOBALROUTEOPTION 365
+#define BADROUTE_EXPIRE 366
+#define MAXFAIL 367
+#define ROUTE_WEIGHT 368
+#define PORT 369
+#define NUMBER 370
+#define BANDWIDTH 371
+#define BOUNCE 372
+#define BSDAUTHSTYLE 373
+#define BSDAUTHSTYLENAME 374
+#define COMMAND 375
+#define COMMAND_BIND 376
+#define COMMAND_CONNECT 377
+#define COMMAND_UDPASSOCIATE 378
+#define COMMAND_BINDREPLY 379
+#define COMMAND_UDPREPLY 380
+#define ACTION 381
+#define FROM 382
+#define TO 383
+#define GSSAPIENCTYPE 384
+#define GSSAPIENC_ANY 385
+#define GSSAPIENC_CLEAR 386
+#define GSSAPIENC_INTEGRITY 387
+#define GSSAPIENC_CONFIDENTIALITY 388
+#define GSSAPIENC_PERMESSAGE 389
+#define GSSAPIKEYTAB 390
+#define GSSAPISERVICE 391
+#define GSSAPISERVICENAME 392
+#define GSSAPIKEYTABNAME 393
+#define IPV4 394
+#define IPV6 395
+#define IPVANY 396
+#define DOMAINNAME 397
+#define IFNAME 398
+#define URL 399
+#define LDAPATTRIBUTE 400
+#define LDAPATTRIBUTE_AD 401
+#define LDAPATTRIBUTE_HEX 402
+#define LDAPATTRIBUTE_AD_HEX 403
+#define LDAPBASEDN 404
+#define LDAP_BASEDN 405
+#define LDAPBASEDN_HEX 406
+#define LDAPBASEDN_HEX_ALL 407
+#define LDAPCERTFILE 408
+#define LDAPCERTPATH 409
+#define LDAPPORT 410
+#define LDAPPORTSSL 411
+#define LDAPDEBUG 412
+#define LDAPDEPTH 413
+#define LDAPAUTO 414
+#define LDAPSEARCHTIME 415
+#define LDAPDOMAIN 416
+#define LDAP_DOMAIN 417
+#define LDAPFILTER 418
+#define LDAPFILTER_AD 419
+#define LDAPFILTER_HEX 420
+#define LDAPFILTER_AD_HEX 421
+#define LDAPGROUP 422
+#define LDAPGROUP_NAME 423
+#define LDAPGROUP_HEX 424
+#define LDAPGROUP_HEX_ALL 425
+#define LDAPKEYTAB 426
+#define LDAPKEYTABNAME 427
+#define LDAPDEADTIME 428
+#define LDAPSERVER 429
+#define LDAPSERVER_NAME 430
+#define LDAPSSL 431
+#define LDAPCERTCHECK 432
+#define LDAPKEEPREALM 433
+#define LDAPTIMEOUT 434
+#define LDAPCACHE 435
+#define LDAPCACHEPOS 436
+#define LDAPCACHENEG 437
+#define LDAPURL 438
+#define LDAP_URL 439
+#define LDAP_FILTER 440
+#define LDAP_ATTRIBUTE 441
+#define LDAP_CERTFILE 442
+#define LDAP_CERTPATH 443
+#define LIBWRAPSTART 444
+#define LIBWRAP_ALLOW 445
+#define LIBWRAP_DENY 446
+#define LIBWRAP_HOSTS_ACCESS 447
+#define LINE 448
+#define OPERATOR 449
+#define PAMSERVICENAME 450
+#define PROTOCOL 451
+#define PROTOCOL_TCP 452
+#define PROTOCOL_UDP 453
+#define PROTOCOL_FAKE 454
+#define PROXYPROTOCOL 455
+#define PROXYPROTOCOL_SOCKS_V4 456
+#define PROXYPROTOCOL_SOCKS_V5 457
+#define PROXYPROTOCOL_HTTP 458
+#define PROXYPROTOCOL_UPNP 459
+#define REDIRECT 460
+#define SENDSIDE 461
+#define RECVSIDE 462
+#define SERVICENAME 463
+#define SESSION_INHERITABLE 464
+#define SESSIONMAX 465
+#define SESSIONTHROTTLE 466
+#define SESSIONSTATE_KEY 467
+#define SESSIONSTATE_MAX 468
+#define SESSIONSTATE_THROTTLE 469
+#define RULE_LOG 470
+#define RULE_LOG_CONNECT 471
+#define RULE_LOG_DATA 472
+#define RULE_LOG_DISCONNECT 473
+#define RULE_LOG_ERROR 474
+#define RULE_LOG_IOOPERATION 475
+#define RULE_LOG_TCPINFO 476
+#define STATEKEY 477
+#define UDPPORTRANGE 478
+#define UDPCONNECTDST 479
+#define USER 480
+#define GROUP 481
+#define VERDICT_BLOCK 482
+#define VERDICT_PASS 483
+#define YES 484
+#define NO 485
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
 #line 396 "config_parse.y"
-#ifndef YYSTYPE_DEFINED
-#define YYSTYPE_DEFINED
-typedef union {
+
    struct {
       uid_t   uid;
       gid_t   gid;
@@ -406,3984 +958,3160 @@ typedef union {
    char       *string;
    int        method;
    long long  number;
-} YYSTYPE;
-#endif /* YYSTYPE_DEFINED */
-#line 411 "config_parse.c"
-#define ALARM 257
-#define ALARMTYPE_DATA 258
-#define ALARMTYPE_DISCONNECT 259
-#define ALARMIF_INTERNAL 260
-#define ALARMIF_EXTERNAL 261
-#define TCPOPTION_DISABLED 262
-#define ECN 263
-#define SACK 264
-#define TIMESTAMPS 265
-#define WSCALE 266
-#define MTU_ERROR 267
-#define CLIENTCOMPATIBILITY 268
-#define NECGSSAPI 269
-#define CLIENTRULE 270
-#define HOSTIDRULE 271
-#define SOCKSRULE 272
-#define COMPATIBILITY 273
-#define SAMEPORT 274
-#define DRAFT_5_05 275
-#define CONNECTTIMEOUT 276
-#define TCP_FIN_WAIT 277
-#define CPU 278
-#define MASK 279
-#define SCHEDULE 280
-#define CPUMASK_ANYCPU 281
-#define DEBUGGING 282
-#define DEPRECATED 283
-#define ERRORLOG 284
-#define LOGOUTPUT 285
-#define LOGFILE 286
-#define LOGTYPE_ERROR 287
-#define LOGTYPE_TCP_DISABLED 288
-#define LOGTYPE_TCP_ENABLED 289
-#define LOGIF_INTERNAL 290
-#define LOGIF_EXTERNAL 291
-#define ERRORVALUE 292
-#define EXTENSION 293
-#define BIND 294
-#define PRIVILEGED 295
-#define EXTERNAL_PROTOCOL 296
-#define INTERNAL_PROTOCOL 297
-#define EXTERNAL_ROTATION 298
-#define SAMESAME 299
-#define GROUPNAME 300
-#define HOSTID 301
-#define HOSTINDEX 302
-#define INTERFACE 303
-#define SOCKETOPTION_SYMBOLICVALUE 304
-#define INTERNAL 305
-#define EXTERNAL 306
-#define INTERNALSOCKET 307
-#define EXTERNALSOCKET 308
-#define IOTIMEOUT 309
-#define IOTIMEOUT_TCP 310
-#define IOTIMEOUT_UDP 311
-#define NEGOTIATETIMEOUT 312
-#define LIBWRAP_FILE 313
-#define LOGLEVEL 314
-#define SOCKSMETHOD 315
-#define CLIENTMETHOD 316
-#define METHOD 317
-#define METHODNAME 318
-#define NONE 319
-#define BSDAUTH 320
-#define GSSAPI 321
-#define PAM_ADDRESS 322
-#define PAM_ANY 323
-#define PAM_USERNAME 324
-#define RFC931 325
-#define UNAME 326
-#define MONITOR 327
-#define PROCESSTYPE 328
-#define PROC_MAXREQUESTS 329
-#define REALM 330
-#define REALNAME 331
-#define RESOLVEPROTOCOL 332
-#define REQUIRED 333
-#define SCHEDULEPOLICY 334
-#define SERVERCONFIG 335
-#define CLIENTCONFIG 336
-#define SOCKET 337
-#define CLIENTSIDE_SOCKET 338
-#define SNDBUF 339
-#define RCVBUF 340
-#define SOCKETPROTOCOL 341
-#define SOCKETOPTION_OPTID 342
-#define SRCHOST 343
-#define NODNSMISMATCH 344
-#define NODNSUNKNOWN 345
-#define CHECKREPLYAUTH 346
-#define USERNAME 347
-#define USER_PRIVILEGED 348
-#define USER_UNPRIVILEGED 349
-#define USER_LIBWRAP 350
-#define WORD__IN 351
-#define ROUTE 352
-#define VIA 353
-#define GLOBALROUTEOPTION 354
-#define BADROUTE_EXPIRE 355
-#define MAXFAIL 356
-#define PORT 357
-#define NUMBER 358
-#define BANDWIDTH 359
-#define BOUNCE 360
-#define BSDAUTHSTYLE 361
-#define BSDAUTHSTYLENAME 362
-#define COMMAND 363
-#define COMMAND_BIND 364
-#define COMMAND_CONNECT 365
-#define COMMAND_UDPASSOCIATE 366
-#define COMMAND_BINDREPLY 367
-#define COMMAND_UDPREPLY 368
-#define ACTION 369
-#define FROM 370
-#define TO 371
-#define GSSAPIENCTYPE 372
-#define GSSAPIENC_ANY 373
-#define GSSAPIENC_CLEAR 374
-#define GSSAPIENC_INTEGRITY 375
-#define GSSAPIENC_CONFIDENTIALITY 376
-#define GSSAPIENC_PERMESSAGE 377
-#define GSSAPIKEYTAB 378
-#define GSSAPISERVICE 379
-#define GSSAPISERVICENAME 380
-#define GSSAPIKEYTABNAME 381
-#define IPV4 382
-#define IPV6 383
-#define IPVANY 384
-#define DOMAINNAME 385
-#define IFNAME 386
-#define URL 387
-#define LDAPATTRIBUTE 388
-#define LDAPATTRIBUTE_AD 389
-#define LDAPATTRIBUTE_HEX 390
-#define LDAPATTRIBUTE_AD_HEX 391
-#define LDAPBASEDN 392
-#define LDAP_BASEDN 393
-#define LDAPBASEDN_HEX 394
-#define LDAPBASEDN_HEX_ALL 395
-#define LDAPCERTFILE 396
-#define LDAPCERTPATH 397
-#define LDAPPORT 398
-#define LDAPPORTSSL 399
-#define LDAPDEBUG 400
-#define LDAPDEPTH 401
-#define LDAPAUTO 402
-#define LDAPSEARCHTIME 403
-#define LDAPDOMAIN 404
-#define LDAP_DOMAIN 405
-#define LDAPFILTER 406
-#define LDAPFILTER_AD 407
-#define LDAPFILTER_HEX 408
-#define LDAPFILTER_AD_HEX 409
-#define LDAPGROUP 410
-#define LDAPGROUP_NAME 411
-#define LDAPGROUP_HEX 412
-#define LDAPGROUP_HEX_ALL 413
-#define LDAPKEYTAB 414
-#define LDAPKEYTABNAME 415
-#define LDAPDEADTIME 416
-#define LDAPSERVER 417
-#define LDAPSERVER_NAME 418
-#define LDAPSSL 419
-#define LDAPCERTCHECK 420
-#define LDAPKEEPREALM 421
-#define LDAPTIMEOUT 422
-#define LDAPCACHE 423
-#define LDAPCACHEPOS 424
-#define LDAPCACHENEG 425
-#define LDAPURL 426
-#define LDAP_URL 427
-#define LDAP_FILTER 428
-#define LDAP_ATTRIBUTE 429
-#define LDAP_CERTFILE 430
-#define LDAP_CERTPATH 431
-#define LIBWRAPSTART 432
-#define LIBWRAP_ALLOW 433
-#define LIBWRAP_DENY 434
-#define LIBWRAP_HOSTS_ACCESS 435
-#define LINE 436
-#define OPERATOR 437
-#define PAMSERVICENAME 438
-#define PROTOCOL 439
-#define PROTOCOL_TCP 440
-#define PROTOCOL_UDP 441
-#define PROTOCOL_FAKE 442
-#define PROXYPROTOCOL 443
-#define PROXYPROTOCOL_SOCKS_V4 444
-#define PROXYPROTOCOL_SOCKS_V5 445
-#define PROXYPROTOCOL_HTTP 446
-#define PROXYPROTOCOL_UPNP 447
-#define REDIRECT 448
-#define SENDSIDE 449
-#define RECVSIDE 450
-#define SERVICENAME 451
-#define SESSION_INHERITABLE 452
-#define SESSIONMAX 453
-#define SESSIONTHROTTLE 454
-#define SESSIONSTATE_KEY 455
-#define SESSIONSTATE_MAX 456
-#define SESSIONSTATE_THROTTLE 457
-#define RULE_LOG 458
-#define RULE_LOG_CONNECT 459
-#define RULE_LOG_DATA 460
-#define RULE_LOG_DISCONNECT 461
-#define RULE_LOG_ERROR 462
-#define RULE_LOG_IOOPERATION 463
-#define RULE_LOG_TCPINFO 464
-#define STATEKEY 465
-#define UDPPORTRANGE 466
-#define UDPCONNECTDST 467
-#define USER 468
-#define GROUP 469
-#define VERDICT_BLOCK 470
-#define VERDICT_PASS 471
-#define YES 472
-#define NO 473
-#define YYERRCODE 256
-const short socks_yylhs[] =
-	{                                        -1,
-  206,    0,    0,  126,  126,  125,  125,  125,  125,  125,
-  124,  124,  123,  123,  123,  123,  123,  123,  123,  123,
-  123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
-  123,  123,  123,  123,  123,  123,  123,  123,  123,  106,
-  208,  106,  209,  106,  210,  104,  211,  105,  212,  204,
-  213,  205,  107,  207,  207,  214,  214,  214,  214,  108,
-  108,  109,  138,  138,  138,  138,    5,  215,  216,  152,
-  153,  153,   19,   20,   20,   20,   20,   20,   21,   21,
-   35,   36,   37,   37,    9,   10,   11,   11,   66,   67,
-   68,   68,    8,    8,    7,    7,   75,   76,  217,   77,
-   69,   70,  218,   71,   72,   72,   72,   39,   39,   39,
-   39,   39,   39,   39,   38,   38,  149,  149,  220,  103,
-  221,  102,  222,  219,  219,   56,  144,  144,  144,  145,
-  146,  147,  148,  139,  139,  139,  140,  141,  142,    6,
-   99,   99,  100,  101,   98,   98,  143,  143,   60,   61,
-   61,   62,   62,   23,   24,   24,   24,   63,   63,   64,
-   65,  223,   26,   27,   27,   28,   28,   25,   25,   29,
-   30,   30,   30,   31,   31,   22,  224,   74,  225,   73,
-   52,   53,   53,   54,   49,   50,   50,   51,  226,  227,
-  118,  228,  179,   40,   40,   40,  121,  121,  121,   46,
-   46,   46,  229,   41,   43,   44,   42,   45,   45,  119,
-  119,  119,  119,  120,  120,  180,  180,  180,  180,  180,
-  230,  187,  181,  181,  188,  188,  231,  190,  189,  232,
-  200,  202,  202,  201,  201,  201,  201,  201,  201,  201,
-  201,  191,  191,  191,  191,  191,  191,  191,  191,  191,
-  191,  191,  191,  191,  191,  191,  191,  191,  192,  192,
-  192,  192,  192,  192,  192,  192,  192,  192,  192,  192,
-  192,  192,  192,  192,  192,  192,  192,  192,  192,  192,
-  192,  192,  192,  192,  192,  192,   86,   86,   93,   87,
-   90,   91,  114,   78,   79,   80,   88,   89,  115,  115,
-   85,   85,  116,  116,  117,  117,   94,   95,   96,   97,
-   81,   82,   83,   84,  112,  113,  111,  110,   92,   57,
-   58,   59,   59,  203,  203,    2,    3,    3,    4,    4,
-    4,    4,    4,   16,   17,   17,   18,   18,  185,  186,
-  122,  122,  122,  127,  127,  127,  129,  128,  128,  131,
-  131,  130,  132,  133,  133,  133,  133,  134,  235,  135,
-  137,  136,   55,  194,  196,  196,  196,  196,  196,  196,
-  195,  195,   15,    1,   14,   13,   12,  237,  237,  237,
-  237,  237,  236,  236,  177,  193,  174,  175,  176,  233,
-  234,  151,  154,  154,  154,  154,  154,  154,  154,  154,
-  154,  154,  154,  155,  155,  156,  183,  184,  238,  239,
-  178,  150,  182,  182,  182,  182,  173,  173,  173,  163,
-  164,  164,  164,  164,  164,  164,  171,  171,  171,  171,
-  172,  172,  165,  197,  197,  166,  198,  167,  240,  168,
-  169,  170,  157,  157,  157,  157,  158,  158,  161,  161,
-  159,  160,  241,  162,  199,   32,   33,   34,   47,   48,
-   48,
-};
-const short socks_yylen[] =
-	{                                         2,
-    0,    4,    3,    0,    2,    1,    1,    1,    1,    1,
-    0,    2,    1,    1,    1,    1,    1,    1,    1,    1,
-    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-    1,    1,    1,    1,    1,    1,    1,    1,    1,    3,
-    0,    4,    0,    4,    0,    6,    0,    6,    0,    6,
-    0,    6,    1,    1,    2,    1,    1,    1,    1,    1,
-    2,    1,    1,    1,    1,    1,    1,    0,    0,    9,
-    0,    2,    3,    1,    1,    1,    1,    1,    1,    2,
-    3,    1,    1,    2,    3,    1,    1,    2,    3,    1,
-    1,    2,    1,    2,    1,    1,    4,    0,    0,    4,
-    4,    0,    0,    4,    3,    3,    3,    1,    1,    1,
-    1,    1,    1,    1,    0,    2,    4,    4,    0,    4,
-    0,    4,    1,    1,    2,    3,    1,    1,    1,    3,
-    3,    3,    1,    3,    3,    3,    3,    3,    3,    3,
-    1,    1,    3,    3,    3,    3,    3,    3,    3,    1,
-    1,    1,    2,    3,    1,    1,    1,    1,    1,    9,
-    7,    0,    7,    1,    1,    1,    1,    1,    1,    3,
-    1,    1,    1,    1,    2,    3,    0,    4,    0,    4,
-    3,    1,    2,    1,    3,    1,    2,    1,    0,    0,
-    8,    0,    8,    1,    1,    1,    0,    1,    1,    0,
-    1,    1,    0,    8,    4,    1,    7,    0,    2,    1,
-    1,    1,    1,    0,    2,    1,    1,    1,    1,    1,
-    0,    8,    0,    2,    1,    1,    0,    4,    3,    0,
-    8,    0,    2,    1,    1,    1,    1,    1,    1,    1,
-    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-    1,    1,    1,    1,    1,    1,    3,    4,    3,    3,
-    3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-    3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-    3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-    1,    1,    2,    1,    1,    3,    1,    2,    1,    1,
-    1,    1,    1,    3,    1,    2,    1,    1,    2,    2,
-    3,    2,    2,    1,    1,    1,    1,    1,    1,    3,
-    3,    3,    5,    1,    1,    1,    1,    3,    0,    4,
-    3,    5,    3,    3,    1,    1,    1,    1,    1,    1,
-    1,    2,    3,    3,    3,    3,    3,    1,    1,    1,
-    1,    1,    1,    2,    4,    3,    3,    3,    3,    3,
-    3,    3,    1,    1,    1,    1,    1,    1,    1,    1,
-    1,    2,    1,    0,    2,    3,    1,    1,    1,    1,
-    1,    1,    1,    1,    1,    1,    1,    1,    1,    2,
-    3,    1,    3,    1,    3,    1,    2,    2,    1,    1,
-    2,    2,    1,    1,    1,    1,    1,    1,    1,    1,
-    1,    1,    0,    3,    3,    2,    0,    3,    1,    1,
-    3,    1,    1,    1,    1,    5,    1,    1,    1,    1,
-    2,
-};
-const short socks_yydefred[] =
-	{                                      0,
-    1,    0,    0,    0,    0,    0,    0,   67,    0,    0,
-    0,    0,    0,    0,    0,    0,  109,  108,  113,   71,
-    0,  112,  111,  114,   64,   65,   63,   66,  110,    0,
-    0,   45,   47,    0,    0,    0,    0,   98,  102,  168,
-  169,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,   17,   16,   33,   34,    0,   39,   35,
-   13,   14,   15,  158,  159,   19,   20,   21,   22,   25,
-   24,   27,   28,   30,   31,  141,  142,   32,   18,   29,
-   23,    0,    4,   36,   37,   38,  127,  128,  129,   26,
-    0,    0,    0,  119,  121,    0,    0,    0,    0,    0,
-    0,    0,    0,  116,    0,    0,    0,    0,    0,  103,
-   99,    0,    0,    0,  179,  177,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,   12,    0,  138,
-  139,  140,    0,    0,  134,  135,  136,  137,  156,  157,
-  155,  154,    0,    0,   68,   72,  150,  151,    0,  149,
-    0,    0,    0,    0,   90,    0,   89,    0,    0,  106,
-  105,  107,    0,    0,    0,    0,  126,  176,  171,  172,
-  173,    0,  170,  133,  130,  131,  132,  143,  144,  145,
-  146,  147,  148,  162,  192,  221,  230,  189,    9,    5,
-   10,    6,    7,    8,  123,  120,    0,  122,  118,  117,
-    0,  153,    0,    0,   53,    0,    0,   92,   95,   96,
-    0,  104,  100,  433,  436,  438,  440,  441,   97,  417,
-    0,    0,    0,  418,  419,    0,  413,  414,  415,  416,
-  101,  184,  180,    0,  188,  178,    0,  175,    0,    0,
-    0,    0,    0,  125,   69,    0,    0,    0,    0,   94,
-    0,    0,    0,    0,  420,  183,  187,  165,  164,    0,
-  324,  325,    0,    0,    0,  190,    0,    0,    0,    0,
-    0,    0,   46,   48,  434,  435,  421,  437,  423,  439,
-  425,  452,  455,    0,  446,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,  394,  400,  399,  398,  397,  401,  403,  395,  396,
-    0,    0,  393,  459,    0,  161,    0,    0,   41,   43,
-  454,  450,  444,  449,    0,  445,  167,  166,  163,   49,
-   51,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,  246,
-  247,  248,  249,  254,  217,  256,  258,  243,  244,  242,
-  218,  255,  349,  219,  344,  348,  345,  346,  354,  355,
-  356,  357,  257,  216,    0,    0,  250,  226,  225,  220,
-  252,  253,  251,  245,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,  234,  235,  238,  239,  241,
-  264,  265,  266,  259,  260,  262,  261,  263,  270,  271,
-  279,  280,  268,  269,  278,  272,  273,  274,  276,  275,
-  285,  282,  283,  284,  286,  281,  267,  277,  347,  240,
-  236,  237,    0,    0,  198,  199,  211,  213,  210,  194,
-  195,  196,    0,    0,    0,  212,    0,    0,    0,    0,
-    0,    0,    0,    0,  409,  402,    0,  405,  407,    0,
-    0,    0,  461,    0,   62,   40,    0,    0,    0,  453,
-  451,    0,    0,  227,    0,    0,    0,    0,  411,    0,
-    0,    0,  410,    0,  343,    0,    0,    0,    0,    0,
-  359,    0,    0,    0,    0,    0,  224,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,  233,    0,  215,    0,    0,  203,    0,  321,    0,
-  320,  406,  329,  330,  331,  332,  333,  326,    0,  378,
-  379,  380,  381,  382,  377,    0,  376,  375,  337,  338,
-  334,    0,   74,   75,   76,   77,   78,    0,   73,    0,
-  408,  339,    0,    0,  412,    0,    0,  160,   61,   56,
-   57,   58,   59,   42,    0,   44,    0,    0,    0,  229,
-  181,  185,  363,    0,  386,  373,  341,    0,  350,  351,
-  352,    0,  358,    0,  361,    0,  365,  366,  367,  368,
-  369,  370,  364,    0,   82,   83,    0,   86,   87,    0,
-    0,  340,    0,    0,  374,  311,  312,  313,  314,  294,
-  295,  296,  291,  292,  297,  298,  287,    0,  290,  301,
-  302,  289,  307,  308,  309,  310,  317,  315,  316,  319,
-  318,  299,  300,  303,  304,  305,  306,  293,  457,    0,
-    0,    0,    0,    0,    0,  323,  328,  384,  336,   80,
-  390,    0,  387,    0,    0,   55,    0,    0,  228,    0,
-    0,  385,  391,    0,  360,    0,  372,   84,   88,  193,
-  388,  222,  288,    0,  231,  191,  206,  205,  202,  201,
-    0,    0,  389,  442,    0,    0,  429,  430,  392,   70,
-    0,    0,    0,  431,  432,  353,  362,  458,  456,    0,
-    0,  427,  428,   50,   52,    0,    0,    0,  448,    0,
-    0,  207,  204,  209,
-};
-const short socks_yydgoto[] =
-	{                                       3,
-  416,  302,  568,  569,   17,   18,  211,  212,  350,  639,
-  640,  351,  352,  353,  354,  355,  581,  582,  307,  588,
-  589,   56,   19,  142,   58,  356,  260,  329,   60,  172,
-  173,  420,  680,  739,  357,  636,  637,   20,   21,  459,
-  460,  461,  462,  718,  752,  721,  315,  316,  358,  236,
-  237,  359,  233,  234,  360,   61,  361,  560,  561,   62,
-  149,  150,   63,   64,   65,  310,  156,  157,   67,  114,
-   68,   69,   70,   71,   72,  113,   73,  421,  422,  423,
-  424,  425,  426,  427,  428,  429,  430,  431,  432,  433,
-  434,  435,  436,  437,  438,  439,  440,   74,   75,   76,
-   77,   22,   23,   80,   81,  273,  206,  486,  487,  441,
-  442,  443,  444,  445,  446,  447,  448,  189,  463,  464,
-  465,  362,   82,   83,  190,  129,  363,  364,  450,  365,
-  366,  367,  368,  369,  370,  371,  372,  373,   25,   26,
-   27,   28,   85,   86,   87,   88,   89,  175,   29,  596,
-  597,  146,  103,  311,  312,  313,  255,  734,  285,  322,
-  323,  324,  219,  220,  221,  222,  223,  224,  225,  728,
-  729,  702,  226,  480,  519,  592,  374,  500,  192,  375,
-  376,  231,  481,  593,  482,  521,  193,  377,  378,  379,
-  380,  452,  381,  382,  633,  634,  277,  279,  287,  194,
-  453,  454,  263,  383,  384,    4,  604,  488,  489,  107,
-  108,  492,  493,  605,  201,  267,  159,  158,  196,  133,
-  134,  197,  239,  166,  165,  243,  292,  240,  684,  241,
-  609,  242,  476,  505,  624,  575,  576,  477,  506,  281,
-  491,
-};
-const short socks_yysindex[] =
-	{                                   -145,
-    0, 1741,    0, 3926,   16,   23,   41,    0,   52,   54,
-   60,   69,   78,   86,  101, -155,    0,    0,    0,    0,
- 1741,    0,    0,    0,    0,    0,    0,    0,    0,  113,
-    8,    0,    0,  129,  140,  150,  166,    0,    0,    0,
-    0,  168,  176,  187,  195,  200,  202,  213,  228,  235,
-  253,  268,  280,    0,    0,    0,    0, -248,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0, 3926,    0,    0,    0,    0,    0,    0,    0,    0,
- -107,  -18,    4,    0,    0,   11,   36,   42,   67, -337,
-  296,  307,   28,    0,  -53,  -43,  364,  366,  124,    0,
-    0, -230,  378,  379,    0,    0,   80,  112, -134,   97,
-   97,   97,  134,  135, -216, -203,  403,    0, -163,    0,
-    0,    0,  167,  167,    0,    0,    0,    0,    0,    0,
-    0,    0,   96,   98,    0,    0,    0,    0,  -53,    0,
-  411,  412,  152,  152,    0,  124,    0, -135, -135,    0,
-    0,    0, -217, -244,  154,  159,    0,    0,    0,    0,
-    0, -134,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,  167,    0,    0,    0,
-  347,    0,  151,  153,    0,  432,  434,    0,    0,    0,
- -135,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-  435,  436,  437,    0,    0,  128,    0,    0,    0,    0,
-    0,    0,    0,  154,    0,    0,  159,    0, -213, -150,
- -150, -150,  365,    0,    0,  431,  433, -105, -105,    0,
- -287,  132,  136,  -48,    0,    0,    0,    0,    0,  442,
-    0,    0,  369,  370,  380,    0, -193,  143,  170,  444,
-  447,  449,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0, -326,    0,  467, -326, -237, -225, -225,
- 3977, -200,  455,  459,  460,  461,  466,  468,  469,  472,
-  155,    0,    0,    0,    0,    0,    0,    0,    0,    0,
- -193,  171,    0,    0,  143,    0,  490,  246,    0,    0,
-    0,    0,    0,    0,  184,    0,    0,    0,    0,    0,
-    0,  493,  494,  498,  499,  500,  188,  502,  503,  -42,
-  504,  505,  506,   22,  508,  511,  513,  514,  515,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0, -225,  171,    0,    0,    0,    0,
-    0,    0,    0,    0,  171,  516,  517,  519,  520,  521,
-  522,  524,  525,  526,  531,  536,  538,  542,  544,  545,
-  546,  547,  548,  549,  553,  554,  555,  556,  557,  560,
-  561,  562,  563,  564,  565,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0, 3977,  171,    0,    0,    0,    0,    0,    0,
-    0,    0, -200,  171,  -17,    0,  355,  154,  -19,   -2,
-  244,  251,  -88, -250,    0,    0,  583,    0,    0,  272,
-  591,  300,    0,  298,    0,    0,  246,  -60,  -60,    0,
-    0,  614,  615,    0,  304,  154,  159,  305,    0,  607,
-  230,  216,    0,  297,    0,  611, -140,  316,  317,  214,
-    0,  320,  322, -286,  335,  383,    0, -225,  272,  626,
- -225,  323,  258,  259,  260,  269,  306,  308,  309,  267,
-  282,  342,  345,  -27,  356,  -85,  311,  287,  289,  290,
-  292,  314,  315,  319,  324,  313,  -82,  -80,  -50,  318,
-  374,    0, 3977,    0, -200,  691,    0,  680,    0,  355,
-    0,    0,    0,    0,    0,    0,    0,    0,  -19,    0,
-    0,    0,    0,    0,    0,   -2,    0,    0,    0,    0,
-    0,  -88,    0,    0,    0,    0,    0, -250,    0, -217,
-    0,    0,  682, -217,    0,  685, -193,    0,    0,    0,
-    0,    0,    0,    0,  -60,    0,  152,  152, -217,    0,
-    0,    0,    0,   -1,    0,    0,    0, -217,    0,    0,
-    0,  699,    0,  448,    0,  704,    0,    0,    0,    0,
-    0,    0,    0, -286,    0,    0,  335,    0,    0,  383,
-  629,    0, -217,  630,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,  406,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,  720,
-  644,  645,  507,  -20,  413,    0,    0,    0,    0,    0,
-    0, -217,    0, -167,  647,    0,  727,  729,    0,  419,
-  419,    0,    0,  424,    0,  426,    0,    0,    0,    0,
-    0,    0,    0,  427,    0,    0,    0,    0,    0,    0,
-  719,  739,    0,    0,  419,  419,    0,    0,    0,    0,
- -105, -105,  350,    0,    0,    0,    0,    0,    0,  430,
-  438,    0,    0,    0,    0, -326,  439,  440,    0,  457,
-  458,    0,    0,    0,};
-const short socks_yyrindex[] =
-	{                                      0,
-    0,    6,    0,   24,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    6,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,   24,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,  789,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,  792,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0, 1863,    0,
-    0,    0,    0,    0,    0, 1684,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0, 1951,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0, 2044,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
- 2137,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    7,  238,  451,    0,    0,  654,    0,    0,    0,    0,
-    0,    0,    0,  862,    0,    0, 1065,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,  423,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,  425,  425,
-  428, -212,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
- -108,    0,    0,    0, 2225,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,  -96,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,  -94,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,  -97,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0, 1273,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0, 2865,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,  672,    0,    0,
-  672,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,  677,    0, -102,    0,    0,    0,    0, 3710,
-    0,    0,    0,    0,    0,    0,    0,    0, 2527,    0,
-    0,    0,    0,    0,    0, 2696,    0,    0,    0,    0,
-    0, 2325,    0,    0,    0,    0,    0, 3034,    0,    0,
-    0,    0,    0,    0,    0,    0,  681,    0,    0,    0,
-    0,    0,    0,    0, 1476,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0, 3203,    0,    0, 3372,    0,    0, 3541,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,  749,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0, 3738,
- 3738,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0, 2506, 2506,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0, -109,    0,    0,
-    0,    0,    0,    0,};
-const short socks_yygindex[] =
-	{                                      0,
-    0, -228,  240,    0,   -3,   35,    0,  -71,    0,  173,
-    0, -262, -256, -255,    0, -254,  236,    0, -272,    0,
-  229,    0,   37,    0,    0,   -4,    0,    0,    0,    0,
-  648,    0,    0,    0,    0,  182,    0,  803,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,  510,    0, -215,
-    0,    0, -209,    0,    0,    0, -253,    0,  266,    0,
-    0,  678,    0,    0,    0,   38,    0,  675,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,   46,   49,    0,    0, -245, -139,  341,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0, -429,
-    0,    0,    0,  750,    0,    0, -265,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,   90,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,  310,   55,    0,
-    0,  705,    0,    0, -291,    0,    0, -628,    0,  579,
- -279,    0, -546, -578,  671,  673,    0, -162, -161,    0,
-    0,    0, -547,    0,    0,  325,    0,    0,    0,    0,
- -269,    0,  453,    0, -341,    0,    0, -283,  212,    0,
- -251,    0,    0,    0,  220,    0,    0,    0,  123,    0,
-    0, -423,  193,    0,    0,    0, -462,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,  -64,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,  527,  362,    0,  293,    0,    0,    0,    0,
-    0,
-};
-#define YYTABLESIZE 4446
-const short socks_yytable[] =
-	{                                      59,
-   54,  229,  230,  274,  303,  115,  422,  326,  466,  284,
-  304,  305,  306,  309,  207,  208,  404,  658,  419,  478,
-  385,  257,  214,   11,  256,  449,  606,  214,  223,  552,
-  232,  282,    8,  554,  518,  700,  418,  458,   55,  451,
-   57,   66,  293,  691,  197,  197,  197,  693,  303,   78,
-    5,    6,   79,  106,  304,  305,  306,  309,   90,  455,
-  456,  699,  417,  457,  330,  331,  327,  511,  160,  198,
-  275,  703,  735,   91,  293,  332,  333,   59,   54,  510,
-   92,   40,   41,   11,   12,   13,   14,  213,  161,  334,
-  335,   24,  127,   84,  276,  711,  742,  743,   93,   34,
-  332,  333,  139,  140,  141,  517,  185,  186,  187,   94,
-   24,   95,  553,   40,   41,  725,   55,   96,   57,   66,
-  328,  162,  555,  294,  321,  682,   97,   78,  258,  681,
-   79,  422,  244,  336,  337,   98,   90,  214,  215,  250,
-  217,  218,  696,   99,  259,  723,  296,  208,  208,  208,
-  208,  208,  297,  298,  197,  197,  197,  214,  100,  197,
-  197,  197,  295,  188,  214,  215,  216,  217,  218,  295,
-  105,   84,  627,  628,  629,  630,  631,  632,  296,  466,
-  419,  270,  271,  272,  297,  298,  109,  449,  145,    1,
-    2,  208,  208,  583,  584,  585,  586,  110,  418,  101,
-  102,  451,  600,  601,  602,  603,  338,  111,  458,  169,
-  170,  171,  339,  299,  214,  215,  216,  217,  218,  724,
-  147,  148,  340,  112,  417,  115,  341,  342,  343,  344,
-  345,  346,  347,  116,  457,  151,  152,  424,  299,  556,
-  557,  558,  348,  349,  117,  299,  209,  210,  641,  300,
-  130,  644,  118,  208,  301,  180,  181,  119,  562,  120,
-  208,  404,  308,  422,  422,  422,  422,  422,  182,  183,
-  121,  466,  214,  223,  422,  232,  422,  422,  422,  422,
-  419,  612,  422,  422,  422,  122,  611,  449,  422,  422,
-  422,  422,  123,   11,   11,   11,  422,  422,  418,  422,
-  458,  451,  422,  422,  422,  695,  308,  422,  422,  282,
-  124,  422,  422,  422,  422,  422,  422,  422,  422,  261,
-  262,  422,  422,  422,  417,  125,  457,  475,  503,  208,
-  657,  619,  620,  422,  303,  422,  422,  126,  422,  131,
-  304,  305,  306,  309,  563,  564,  565,  566,  567,  422,
-   11,  579,  580,  143,  422,  422,  422,  115,  422,  422,
-  422,  132,  424,  422,  144,  422,  422,  422,  135,  422,
-  570,  571,  572,  573,  574,   11,  422,  422,  422,  145,
-  214,  215,  216,  217,  422,  422,  660,  661,  283,  672,
-  673,  674,  675,  136,  422,  422,  422,  422,  422,  137,
-  422,  422,  422,  422,  422,  422,  422,  422,  422,  153,
-  422,  154,  422,  422,  422,  422,  422,  155,  422,  422,
-  422,  676,  677,  422,  138,  422,  422,  422,  719,  720,
-  176,  177,  422,  264,  265,  163,  164,  167,  422,  422,
-  422,  422,  168,  174,  422,  422,  178,  179,  184,  422,
-  426,  701,  195,  199,  422,  200,  203,  204,  422,  422,
-  422,  422,  422,  422,  422,  205,  749,  697,  698,  245,
-  587,  232,  422,  422,  422,  422,  235,  248,  246,  249,
-  247,  251,  252,  253,  254,  744,  745,  266,  268,  278,
-  269,  289,  290,  280,  424,  424,  424,  424,  424,  288,
-  314,  318,  291,  317,  319,  424,  320,  424,  424,  424,
-  424,  325,  467,  424,  424,  424,  468,  469,  470,  424,
-  424,  424,  424,  471,  475,  472,  473,  424,  424,  474,
-  424,  726,  727,  424,  424,  424,  484,  485,  424,  424,
-  479,  490,  424,  424,  424,  424,  424,  424,  424,  424,
-  494,  495,  424,  424,  424,  496,  497,  498,  499,  501,
-  502,  507,  508,  509,  424,  512,  424,  424,  513,  424,
-  514,  515,  516,  522,  523,  426,  524,  525,  526,  527,
-  424,  528,  529,  530,  587,  424,  424,  424,  531,  424,
-  424,  424,  308,  532,  424,  533,  424,  424,  424,  534,
-  424,  535,  536,  537,  538,  539,  540,  424,  424,  424,
-  541,  542,  543,  544,  545,  424,  424,  546,  547,  548,
-  549,  550,  551,  559,  577,  424,  424,  424,  424,  424,
-  578,  424,  424,  424,  424,  424,  424,  424,  424,  424,
-  590,  424,  591,  424,  424,  424,  424,  424,  594,  424,
-  424,  424,  595,  443,  424,  598,  424,  424,  424,  607,
-  608,  610,  613,  424,  614,  615,  616,  503,  618,  424,
-  424,  424,  424,  621,  622,  424,  424,  625,  623,  626,
-  424,  635,  638,  643,  645,  424,  646,  647,  648,  424,
-  424,  424,  424,  424,  424,  424,  653,  649,  650,  655,
-  651,  652,  656,  424,  424,  424,  424,  426,  426,  426,
-  426,  426,  654,  659,  663,  662,  664,  665,  426,  666,
-  426,  426,  426,  426,  667,  668,  426,  426,  426,  669,
-  671,  679,  426,  426,  426,  426,  683,  685,  670,  692,
-  426,  426,  694,  426,  678,  704,  426,  426,  426,  333,
-  706,  426,  426,  710,  712,  426,  426,  426,  426,  426,
-  426,  426,  426,  713,  714,  426,  426,  426,  715,  716,
-  722,  730,  731,  717,  732,  733,  740,  426,  443,  426,
-  426,  736,  426,  737,  738,  741,  283,  747,    3,  750,
-  751,    2,  404,  426,  223,  748,  223,  232,  426,  426,
-  426,  232,  426,  426,  426,  404,  200,  426,  687,  426,
-  426,  426,  709,  426,  753,  754,  690,  689,  708,  238,
-  426,  426,  426,  104,  483,  686,  202,  599,  426,  426,
-  208,  128,  286,  191,  227,  705,  228,  520,  426,  426,
-  426,  426,  426,  642,  426,  426,  426,  426,  426,  426,
-  426,  426,  426,  707,  426,  746,  426,  426,  426,  426,
-  426,  182,  426,  426,  426,  617,  504,  426,  688,  426,
-  426,  426,    0,    0,    0,    0,  426,    0,    0,    0,
-    0,    0,  426,  426,  426,  426,    0,    0,  426,  426,
-    0,    0,    0,  426,    0,    0,    0,    0,  426,    0,
-    0,    0,  426,  426,  426,  426,  426,  426,  426,    0,
-  443,  443,  443,  443,  443,    0,  426,  426,  426,  426,
-    0,  443,    0,  443,  443,  443,  443,    0,    0,  443,
-  443,  443,    0,    0,    0,  443,  443,  443,  443,    0,
-    0,    0,    0,  443,  443,    0,  443,    0,    0,  443,
-  443,  443,    0,    0,  443,  443,    0,    0,  443,  443,
-  443,  443,  443,  443,  443,  443,    0,    0,  443,  443,
-  443,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-  443,    0,  443,  443,    0,  443,  182,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,  443,    0,    0,    0,
-    0,  443,  443,  443,    0,  443,  443,  443,    0,    0,
-    0,    0,  443,  443,  443,    0,  443,    0,    0,    0,
-    0,    0,    0,  443,  443,  443,    0,    0,    0,    0,
-    0,  443,  443,    0,    0,    0,    0,    0,    0,    0,
-    0,  443,  443,  443,  443,  443,    0,  443,  443,  443,
-  443,  443,  443,  443,  443,  443,    0,  443,    0,  443,
-  443,  443,  443,  443,  186,  443,  443,  443,    0,    0,
-  443,    0,  443,  443,  443,    0,    0,    0,    0,  443,
-    0,    0,    0,    0,    0,  443,  443,  443,  443,    0,
-    0,  443,  443,    0,    0,    0,  443,    0,    0,    0,
-    0,  443,    0,    0,    0,  443,  443,  443,  443,  443,
-  443,  443,    0,    0,    0,    0,    0,    0,    0,  443,
-  443,  443,  443,    0,    0,    0,    0,    0,    0,  182,
-    0,  182,  182,  182,  182,    0,    0,  182,  182,  182,
-    0,    0,    0,  182,  182,  182,  182,    0,    0,    0,
-    0,  182,  182,    0,  182,    0,    0,  182,  182,  182,
-    0,    0,  182,  182,    0,    0,  182,  182,  182,  182,
-  182,  182,  182,  182,    0,    0,  182,  182,  182,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,  182,  186,
-  182,  182,    0,  182,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,  182,    0,    0,    0,    0,  182,
-  182,  182,    0,  182,    0,  182,    0,    0,    0,    0,
-  182,  182,  182,    0,  182,    0,    0,    0,    0,    0,
-    0,  182,    0,  182,    0,    0,    0,    0,    0,  182,
-  182,    0,    0,    0,    0,    0,    0,    0,    0,  182,
-  182,  182,  182,  182,    0,  182,  182,  182,  182,  182,
-  182,  182,  182,  182,    0,  182,    0,  182,  182,  182,
-  182,  182,   60,  182,  182,  182,    0,    0,  182,    0,
-  182,  182,  182,    0,    0,    0,    0,  182,    0,    0,
-    0,    0,    0,  182,  182,  182,  182,    0,    0,  182,
-  182,    0,    0,    0,  182,    0,    0,    0,    0,  182,
-    0,    0,    0,  182,  182,  182,  182,  182,  182,  182,
-    0,    0,    0,    0,    0,    0,    0,  182,  182,  182,
-  182,    0,  186,    0,  186,  186,  186,  186,    0,    0,
-  186,  186,  186,    0,    0,    0,  186,  186,  186,  186,
-    0,    0,    0,    0,  186,  186,    0,  186,    0,    0,
-  186,  186,  186,    0,    0,  186,  186,    0,    0,  186,
-  186,  186,  186,  186,  186,  186,  186,    0,    0,  186,
-  186,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,  186,    0,  186,  186,    0,  186,   60,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,  186,    0,    0,
-    0,    0,  186,  186,  186,    0,  186,    0,  186,    0,
-    0,    0,    0,  186,  186,  186,    0,  186,    0,    0,
-    0,    0,    0,    0,  186,    0,  186,    0,    0,    0,
-    0,    0,  186,  186,    0,    0,    0,    0,    0,    0,
-    0,    0,  186,  186,  186,  186,  186,    0,  186,  186,
-  186,  186,  186,  186,  186,  186,  186,    0,  186,    0,
-  186,  186,  186,  186,  186,   54,  186,  186,  186,    0,
-    0,  186,    0,  186,  186,  186,    0,    0,    0,    0,
-  186,    0,    0,    0,    0,    0,  186,  186,  186,  186,
-    0,    0,  186,  186,    0,    0,    0,  186,    0,    0,
-    0,    0,  186,    0,    0,    0,  186,  186,  186,  186,
-  186,  186,  186,    0,    0,    0,    0,    0,    0,    0,
-  186,  186,  186,  186,    0,    0,    0,    0,    0,    0,
-   60,    0,   60,   60,   60,   60,    0,    0,   60,   60,
-   60,    0,    0,    0,   60,   60,   60,   60,    0,    0,
-    0,    0,   60,   60,    0,   60,    0,    0,   60,   60,
-   60,    0,    0,   60,   60,    0,    0,   60,   60,   60,
-   60,   60,   60,   60,   60,    0,    0,   60,   60,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,   60,
-   54,   60,   60,    0,   60,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,   60,    0,    0,    0,    0,
-   60,   60,   60,    0,   60,    0,   60,    0,    0,    0,
-    0,   60,   60,   60,    0,   60,    0,    0,    0,    0,
-    0,    0,   60,    0,   60,    0,    0,    0,    0,    0,
-   60,   60,    0,    0,    0,    0,    0,    0,    0,    0,
-   60,   60,   60,   60,   60,    0,   60,   60,   60,   60,
-   60,   60,   60,   60,   60,    0,   60,    0,   60,   60,
-   60,   60,   60,   91,   60,   60,   60,    0,    0,   60,
-    0,   60,   60,   60,    0,    0,    0,    0,   60,    0,
-    0,    0,    0,    0,   60,   60,   60,   60,    0,    0,
-   60,   60,    0,    0,    0,   60,    0,    0,    0,    0,
-   60,    0,    0,    0,   60,   60,   60,   60,   60,   60,
-   60,    0,    0,    0,    0,    0,    0,    0,   60,   60,
-   60,   60,    0,   54,    0,   54,   54,   54,   54,    0,
-    0,   54,   54,   54,    0,    0,    0,   54,   54,   54,
-   54,    0,    0,    0,    0,   54,   54,    0,   54,    0,
-    0,   54,   54,   54,    0,    0,   54,   54,    0,    0,
-   54,   54,   54,   54,   54,   54,   54,   54,    0,    0,
-   54,   54,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,   54,    0,   54,   54,    0,   54,   91,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,   54,    0,
-    0,    0,    0,   54,   54,   54,    0,   54,    0,   54,
-    0,    0,    0,    0,   54,   54,   54,    0,   54,    0,
-    0,    0,    0,    0,    0,   54,    0,   54,    0,    0,
-    0,    0,    0,   54,   54,    0,    0,    0,    0,    0,
-    0,    0,  152,   54,   54,   54,   54,   54,    0,   54,
-   54,   54,   54,   54,   54,   54,   54,   54,    0,   54,
-    0,   54,   54,   54,   54,   54,    0,   54,   54,   54,
-    0,    0,   54,    0,   54,   54,   54,    0,    0,    0,
-    0,   54,    0,    0,    0,    0,    0,   54,   54,   54,
-   54,    0,    0,   54,   54,    0,    0,    0,   54,    0,
-    0,    0,    0,   54,    0,    0,    0,   54,   54,   54,
-   54,   54,   54,   54,    0,    0,    0,    0,    0,    0,
-    0,   54,   54,   54,   54,    0,    0,    0,    0,    0,
-  174,   91,    0,   91,   91,   91,   91,    0,    0,   91,
-   91,   91,    0,    0,    0,   91,   91,   91,   91,    0,
-    0,    0,    0,   91,   91,    0,   91,    0,    0,   91,
-   91,   91,    0,    0,    0,    0,    0,    0,   91,   91,
-   91,   91,   91,   91,   91,   91,    0,    0,   91,   91,
-   91,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-   91,    0,   91,   91,    0,   91,    5,    6,    0,    0,
-    0,    0,    7,    8,    9,   10,   91,    0,    0,    0,
-    0,   91,   91,   91,    0,   91,    0,   91,    0,    0,
-    0,    0,    0,  124,    0,    0,   91,    0,    0,   11,
-   12,   13,   14,   91,    0,   91,    0,    0,    0,    0,
-    0,   91,   91,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,   15,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,   16,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,   91,   91,   91,    0,
-    0,    0,   91,    0,    0,    0,   91,    0,    0,    0,
-    0,   91,  152,  152,  152,  152,   93,    0,  152,  152,
-  152,    0,    0,    0,  152,  152,  152,  152,    0,    0,
-   91,    0,  152,  152,    0,  152,    0,    0,  152,  152,
-  152,    0,    0,    0,    0,    0,    0,  152,  152,  152,
-  152,  152,  152,  152,  152,    0,    0,  152,  152,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,  152,
-    0,  152,  152,    0,  152,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,  152,    0,    0,    0,    0,
-  152,  152,  152,    0,  152,    0,  152,    0,    0,    0,
-  174,  174,  174,  174,  460,    0,  174,  174,  174,    0,
-    0,    0,  174,  174,  174,  174,    0,    0,    0,    0,
-  174,  174,    0,  174,    0,    0,  174,  174,  174,    0,
-    0,    0,    0,    0,    0,  174,  174,  174,  174,  174,
-  174,  174,  174,    0,    0,  174,  174,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,  174,    0,  174,
-  174,    0,  174,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,  174,    0,  152,  152,  152,  174,  174,
-  174,    0,  174,    0,  174,    0,    0,    0,    0,    0,
-    0,    0,    0,  124,  124,  124,  124,    0,    0,  124,
-  124,  124,    0,    0,    0,  124,  124,  124,  124,  152,
-    0,    0,    0,  124,  124,    0,  124,    0,    0,  124,
-  124,  124,    0,    0,    0,    0,    0,    0,  124,  124,
-  124,  124,  124,  124,  124,  124,    0,    0,  124,  124,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-  124,    0,  124,  124,    0,  124,    0,    0,    0,    0,
-    0,    0,    0,  174,  174,  174,  124,    0,    0,    0,
-    0,  124,  124,  124,    0,  124,    0,  124,    0,    0,
-    0,    0,    0,    0,    0,    0,   93,   93,   93,   93,
-    0,    0,   93,   93,   93,    0,    0,  174,   93,   93,
-   93,   93,    0,    0,    0,    0,   93,   93,    0,   93,
-    0,    0,   93,   93,   93,    0,    0,    0,    0,    0,
-    0,   93,   93,   93,   93,   93,   93,   93,   93,  335,
-    0,   93,   93,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,   93,    0,   93,   93,    0,   93,    0,
-    0,    0,    0,    0,    0,    0,  124,  124,  124,   93,
-    0,    0,    0,    0,   93,   93,   93,    0,   93,    0,
-   93,    0,    0,    0,  460,  460,  460,  460,    0,    0,
-  460,  460,  460,    0,    0,    0,  460,  460,  460,  460,
-  124,    0,    0,    0,  460,  460,    0,  460,    0,    0,
-  460,  460,  460,    0,    0,    0,    0,    0,    0,  460,
-  460,  460,  460,  460,  460,  460,  460,    0,    0,  460,
-  460,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,  460,    0,  460,  460,    0,  460,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,  460,    0,   93,
-   93,   93,  460,  460,  460,    0,  460,    0,  460,    0,
-    0,  335,  335,  335,  335,  335,    0,    0,    0,    0,
-    0,    0,  335,    0,    0,    0,    0,    0,    0,    0,
-  335,  335,    0,   93,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,  335,  335,    0,  335,    0,    0,
-    0,    0,    0,    0,    0,  335,  335,    0,    0,    0,
-  447,  335,  335,  335,  335,  335,  335,    0,    0,  335,
-  335,  335,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,  327,    0,    0,    0,    0,    0,  460,  460,  460,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,  335,  335,  335,    0,  335,    0,    0,
-    0,  460,    0,    0,  335,    0,  335,    0,    0,    0,
-    0,    0,  335,  335,    0,    0,    0,    0,    0,    0,
-    0,    0,  335,  335,  335,  335,  335,    0,  335,  335,
-  335,  335,  335,  335,  335,  335,  335,    0,  335,    0,
-  335,  335,  335,  335,  335,    0,  335,  335,  335,    0,
-    0,  335,    0,  335,  335,  335,    0,    0,    0,    0,
-  335,    0,    0,    0,    0,    0,  335,    0,    0,    0,
-    0,    0,  335,  335,    0,    0,    0,  335,    0,    0,
-    0,    0,  335,  447,    0,    0,  335,  335,  335,  335,
-  335,  335,  335,  327,  327,  327,  327,  327,    0,    0,
-  335,    0,  335,  335,  327,    0,    0,    0,  447,    0,
-    0,    0,  327,  327,    0,    0,    0,    0,    0,    0,
-    0,    0,  447,  447,    0,    0,  327,  327,    0,  327,
-  383,    0,  447,    0,    0,    0,    0,  327,  327,    0,
-    0,    0,    0,  327,  327,  327,  327,  327,  327,    0,
-    0,  327,  327,  327,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,  447,    0,
-    0,    0,    0,    0,    0,    0,    0,  447,    0,    0,
-    0,    0,    0,  447,  447,  327,    0,  327,    0,  327,
-    0,    0,    0,    0,    0,    0,  327,    0,  327,    0,
-    0,    0,    0,    0,  327,  327,    0,    0,    0,    0,
-    0,    0,    0,    0,  327,  327,  327,  327,  327,    0,
-  327,  327,  327,  327,  327,  327,  327,  327,  327,    0,
-  327,    0,  327,  327,  327,  327,  327,    0,  327,  327,
-  327,    0,    0,  327,  447,  327,  327,  327,  447,    0,
-    0,    0,  327,  447,    0,    0,    0,    0,  327,    0,
-    0,    0,    0,  383,  327,  327,    0,    0,    0,  327,
-    0,  383,  383,    0,  327,    0,    0,    0,    0,  327,
-  327,  327,  327,  327,  327,  383,  383,    0,  383,  342,
-    0,    0,  327,    0,  327,  327,  383,  383,    0,    0,
-    0,    0,  383,  383,  383,  383,  383,  383,    0,    0,
-  383,  383,  383,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,  383,  383,  383,    0,  383,    0,
-    0,    0,    0,    0,    0,  383,    0,  383,    0,    0,
-    0,    0,    0,  383,  383,    0,    0,    0,    0,    0,
-    0,    0,    0,  383,  383,  383,  383,  383,    0,  383,
-  383,  383,  383,  383,  383,  383,  383,  383,    0,  383,
-    0,  383,  383,  383,  383,  383,    0,  383,  383,  383,
-    0,    0,  383,    0,  383,  383,  383,    0,    0,    0,
-    0,  383,    0,    0,    0,    0,    0,  383,    0,    0,
-    0,    0,  342,  383,  383,    0,    0,    0,  383,    0,
-  342,  342,    0,  383,    0,    0,    0,  383,  383,  383,
-  383,  383,  383,  383,  342,  342,    0,    0,   79,    0,
-    0,  383,    0,  383,  383,  342,  342,    0,    0,    0,
-    0,  342,  342,  342,  342,  342,  342,    0,    0,  342,
-  342,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,  342,  342,  342,    0,  342,    0,    0,
-    0,    0,    0,    0,  342,    0,  342,    0,    0,    0,
-    0,    0,  342,  342,    0,    0,    0,    0,    0,    0,
-    0,    0,  342,  342,  342,  342,  342,    0,  342,  342,
-  342,  342,  342,  342,  342,  342,  342,    0,  342,    0,
-  342,  342,  342,  342,  342,    0,  342,  342,  342,    0,
-    0,  342,    0,  342,  342,  342,    0,    0,    0,    0,
-  342,    0,    0,    0,    0,    0,  342,    0,    0,    0,
-    0,   79,  342,  342,    0,    0,    0,  342,    0,   79,
-   79,    0,  342,    0,    0,    0,  342,  342,  342,  342,
-  342,  342,  342,   79,   79,    0,   79,  371,    0,    0,
-  342,    0,  342,  342,   79,   79,    0,    0,    0,    0,
-   79,   79,   79,   79,   79,   79,    0,    0,   79,   79,
-   79,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,   79,    0,   79,    0,   79,    0,    0,    0,
-    0,    0,    0,   79,    0,   79,    0,    0,    0,    0,
-    0,   79,   79,    0,    0,    0,    0,    0,    0,    0,
-    0,   79,   79,   79,   79,   79,    0,   79,   79,   79,
-   79,   79,   79,   79,   79,   79,    0,   79,    0,   79,
-   79,   79,   79,   79,    0,   79,   79,   79,    0,    0,
-   79,    0,   79,   79,   79,    0,    0,    0,    0,   79,
-    0,    0,    0,    0,    0,   79,    0,    0,    0,    0,
-  371,   79,   79,    0,    0,    0,   79,    0,  371,  371,
-    0,   79,    0,    0,    0,    0,   79,   79,   79,   79,
-   79,   79,  371,  371,    0,    0,   81,    0,    0,   79,
-    0,   79,   79,  371,  371,    0,    0,    0,    0,  371,
-  371,  371,  371,  371,  371,    0,    0,  371,  371,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,  371,  371,  371,    0,  371,    0,    0,    0,    0,
-    0,    0,  371,    0,  371,    0,    0,    0,    0,    0,
-  371,  371,    0,    0,    0,    0,    0,    0,    0,    0,
-  371,  371,  371,  371,  371,    0,  371,  371,  371,  371,
-  371,  371,  371,  371,  371,    0,  371,    0,  371,  371,
-  371,  371,  371,    0,  371,  371,  371,    0,    0,  371,
-    0,  371,  371,  371,    0,    0,    0,    0,  371,    0,
-    0,    0,    0,    0,  371,    0,    0,    0,    0,   81,
-  371,  371,    0,    0,    0,  371,    0,   81,   81,    0,
-  371,    0,    0,    0,  371,  371,  371,  371,  371,  371,
-  371,   81,   81,    0,    0,   85,    0,    0,  371,    0,
-  371,  371,   81,   81,    0,    0,    0,    0,   81,   81,
-   81,   81,   81,   81,    0,    0,   81,   81,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-   81,   81,   81,    0,   81,    0,    0,    0,    0,    0,
-    0,   81,    0,   81,    0,    0,    0,    0,    0,   81,
-   81,    0,    0,    0,    0,    0,    0,    0,    0,   81,
-   81,   81,   81,   81,    0,   81,   81,   81,   81,   81,
-   81,   81,   81,   81,    0,   81,    0,   81,   81,   81,
-   81,   81,    0,   81,   81,   81,    0,    0,   81,    0,
-   81,   81,   81,    0,    0,    0,    0,   81,    0,    0,
-    0,    0,    0,   81,    0,    0,    0,    0,   85,   81,
-   81,    0,    0,    0,   81,    0,   85,   85,    0,   81,
-    0,    0,    0,   81,   81,   81,   81,   81,   81,   81,
-   85,   85,    0,    0,  322,    0,    0,   81,    0,   81,
-   81,   85,   85,    0,    0,    0,    0,   85,   85,   85,
-   85,   85,   85,    0,    0,   85,   85,    0,    0,    0,
-    0,    0,  447,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,   85,
-   85,   85,    0,   85,    0,    0,    0,    0,    0,    0,
-   85,    0,   85,    0,    0,    0,    0,    0,   85,   85,
-    0,    0,    0,    0,    0,    0,    0,    0,   85,   85,
-   85,   85,   85,    0,   85,   85,   85,   85,   85,   85,
-   85,   85,   85,    0,   85,    0,   85,   85,   85,   85,
-   85,    0,   85,   85,   85,    0,    0,   85,    0,   85,
-   85,   85,    0,    0,    0,    0,   85,    0,    0,    0,
-    0,    0,   85,    0,    0,    0,    0,  322,   85,   85,
-    0,    0,    0,   85,    0,  322,  322,    0,   85,    0,
-    0,    0,   85,   85,   85,   85,   85,   85,   85,  322,
-  322,    0,  322,    0,    0,  447,   85,    0,   85,   85,
-  322,  322,    0,  447,  447,    0,  322,  322,  322,  322,
-  322,  322,    0,    0,  322,  322,  322,  447,  447,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,  447,  447,
-    0,    0,    0,    0,  447,  447,  447,  447,  447,  447,
-    0,    0,  447,  447,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,  322,  322,
-    0,    0,  322,    0,    0,    0,    0,    0,    0,  322,
-    0,  322,    0,    0,    0,    0,    0,  322,  322,    0,
-    0,    0,    0,    0,    0,    0,  447,  447,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,  447,    0,  447,
-    0,    0,    0,    0,    0,  447,  447,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,  322,    0,    0,    0,    0,    0,  322,  322,    0,
-    0,    0,  322,    0,    0,    0,    0,  322,    0,    0,
-    0,  322,  322,  322,  322,  322,  322,  322,    0,  447,
-    0,    0,    0,    0,    0,  447,  447,  322,  322,    0,
-    0,    0,    0,    0,    0,  447,    0,    0,    0,  447,
-  447,  447,  447,  447,  447,  447,    0,    0,   30,    0,
-    0,    5,    6,   31,    0,  447,  447,    7,    8,    9,
-   10,    0,    0,    0,    0,   32,   33,    0,   34,    0,
-    0,   35,   36,   37,    0,    0,    0,    0,    0,    0,
-   38,   39,   40,   41,   11,   12,   13,   14,    0,    0,
-   42,   43,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    5,    6,   44,   45,    0,   15,    0,    0,
-    0,    0,    0,    0,    0,    0,  330,  331,   46,    0,
-    0,    0,    0,   47,   48,   49,    0,  332,  333,   16,
-    0,    0,    0,   40,   41,   11,   12,   13,   14,    0,
-    0,  334,  335,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,  336,    0,  386,    0,  295,
-    0,    0,    0,    0,    0,    0,    0,    0,  296,    0,
-    0,    0,    0,    0,  297,  298,    0,    0,   50,   51,
-   52,    0,    0,    0,  387,  388,  389,  390,  391,    0,
-  392,  393,  394,  395,  396,  397,  398,  399,  400,    0,
-  401,    0,  402,  403,  404,  405,  406,    0,  407,  408,
-  409,    0,   53,  410,    0,  411,  412,  413,    0,    0,
-    0,    0,  414,    0,    0,    0,    0,    0,  338,    0,
-    0,    0,    0,    0,  339,  299,    0,    0,    0,  300,
-    0,    0,    0,    0,  340,    0,    0,    0,    0,  342,
-  343,  344,  345,  346,  347,    0,    0,    0,    0,    0,
-    0,    0,  415,    0,  348,  349,
-};
-const short socks_yycheck[] =
-	{                                       4,
-    4,  164,  164,  249,  267,    0,    0,  287,  292,   58,
-  267,  267,  267,  267,  154,  125,  125,   45,  291,  311,
-  290,  237,  125,    0,  234,  291,  489,  125,  125,  453,
-  125,  358,  283,  463,  376,  614,  291,  292,    4,  291,
-    4,    4,  268,  590,  257,  258,  259,  594,  311,    4,
-  276,  277,    4,   46,  311,  311,  311,  311,    4,  260,
-  261,  609,  291,  292,  290,  291,  304,   46,  299,  134,
-  358,  618,  701,   58,  268,  301,  302,   82,   82,   58,
-   58,  307,  308,  309,  310,  311,  312,  159,  319,  315,
-  316,    2,  341,    4,  382,  643,  725,  726,   58,  293,
-  301,  302,  440,  441,  442,  375,  270,  271,  272,   58,
-   21,   58,  454,  307,  308,  694,   82,   58,   82,   82,
-  358,  352,  464,  317,  451,  555,   58,   82,  342,  553,
-   82,  125,  197,  359,  360,   58,   82,  382,  383,  211,
-  385,  386,  605,   58,  358,  692,  372,  257,  258,  259,
-  260,  261,  378,  379,  257,  258,  259,  370,   58,  257,
-  258,  259,  363,  327,  382,  383,  384,  385,  386,  363,
-   58,   82,  459,  460,  461,  462,  463,  464,  372,  463,
-  453,  287,  288,  289,  378,  379,   58,  453,  352,  335,
-  336,  301,  302,  444,  445,  446,  447,   58,  453,  355,
-  356,  453,  263,  264,  265,  266,  432,   58,  463,  344,
-  345,  346,  438,  439,  382,  383,  384,  385,  386,  387,
-  274,  275,  448,   58,  453,   58,  452,  453,  454,  455,
-  456,  457,  458,   58,  463,  279,  280,    0,  439,  257,
-  258,  259,  468,  469,   58,  439,  382,  383,  518,  443,
-  358,  521,   58,  363,  448,  472,  473,   58,  468,   58,
-  370,  370,  267,  257,  258,  259,  260,  261,  472,  473,
-   58,  555,  370,  370,  268,  370,  270,  271,  272,  273,
-  553,  497,  276,  277,  278,   58,  496,  553,  282,  283,
-  284,  285,   58,  270,  271,  272,  290,  291,  553,  293,
-  555,  553,  296,  297,  298,  597,  311,  301,  302,  358,
-   58,  305,  306,  307,  308,  309,  310,  311,  312,  470,
-  471,  315,  316,  317,  553,   58,  555,  370,  371,  439,
-  358,  472,  473,  327,  597,  329,  330,   58,  332,  358,
-  597,  597,  597,  597,  364,  365,  366,  367,  368,  343,
-  327,  440,  441,   58,  348,  349,  350,  352,  352,  353,
-  354,  358,  125,  357,   58,  359,  360,  361,  358,  363,
-  373,  374,  375,  376,  377,  352,  370,  371,  372,  352,
-  382,  383,  384,  385,  378,  379,  472,  473,  437,  472,
-  473,  472,  473,  358,  388,  389,  390,  391,  392,  358,
-  394,  395,  396,  397,  398,  399,  400,  401,  402,   46,
-  404,   46,  406,  407,  408,  409,  410,  294,  412,  413,
-  414,  472,  473,  417,  358,  419,  420,  421,  449,  450,
-  121,  122,  426,  241,  242,   58,   58,  358,  432,  433,
-  434,  435,  331,  347,  438,  439,  313,  313,   46,  443,
-    0,  614,  286,  358,  448,  358,   46,   46,  452,  453,
-  454,  455,  456,  457,  458,  314,  746,  607,  608,  123,
-  474,  318,  466,  467,  468,  469,  318,   46,  328,   46,
-  328,   47,   47,   47,  357,  731,  732,  123,   58,  358,
-   58,  123,  123,  358,  257,  258,  259,  260,  261,   58,
-  358,   58,  123,  334,   58,  268,   58,  270,  271,  272,
-  273,   45,   58,  276,  277,  278,   58,   58,   58,  282,
-  283,  284,  285,   58,  370,   58,   58,  290,  291,   58,
-  293,  694,  694,  296,  297,  298,   47,  292,  301,  302,
-  370,  358,  305,  306,  307,  308,  309,  310,  311,  312,
-   58,   58,  315,  316,  317,   58,   58,   58,  371,   58,
-   58,   58,   58,   58,  327,   58,  329,  330,   58,  332,
-   58,   58,   58,   58,   58,  125,   58,   58,   58,   58,
-  343,   58,   58,   58,  588,  348,  349,  350,   58,  352,
-  353,  354,  597,   58,  357,   58,  359,  360,  361,   58,
-  363,   58,   58,   58,   58,   58,   58,  370,  371,  372,
-   58,   58,   58,   58,   58,  378,  379,   58,   58,   58,
-   58,   58,   58,  269,  381,  388,  389,  390,  391,  392,
-  380,  394,  395,  396,  397,  398,  399,  400,  401,  402,
-   58,  404,  371,  406,  407,  408,  409,  410,   58,  412,
-  413,  414,  353,    0,  417,  358,  419,  420,  421,   46,
-   46,  358,  358,  426,   58,  436,  451,  371,   58,  432,
-  433,  434,  435,  358,  358,  438,  439,  358,  465,  358,
-  443,  347,  300,   58,  362,  448,  429,  429,  429,  452,
-  453,  454,  455,  456,  457,  458,  430,  429,  393,  358,
-  393,  393,  358,  466,  467,  468,  469,  257,  258,  259,
-  260,  261,  431,  358,  428,  405,  428,  428,  268,  428,
-  270,  271,  272,  273,  411,  411,  276,  277,  278,  411,
-  418,  358,  282,  283,  284,  285,   46,   58,  415,   58,
-  290,  291,   58,  293,  427,   47,  296,  297,  298,  302,
-   47,  301,  302,  125,  125,  305,  306,  307,  308,  309,
-  310,  311,  312,  358,   45,  315,  316,  317,  125,  125,
-  358,  125,   46,  267,   46,  357,   58,  327,  125,  329,
-  330,  358,  332,  358,  358,   47,  437,  358,    0,  351,
-  351,    0,  370,  343,  370,  358,  125,  370,  348,  349,
-  350,  125,  352,  353,  354,  125,   58,  357,  569,  359,
-  360,  361,  640,  363,  358,  358,  588,  582,  637,  172,
-  370,  371,  372,   21,  315,  560,  149,  487,  378,  379,
-  156,   82,  254,  129,  164,  624,  164,  385,  388,  389,
-  390,  391,  392,  519,  394,  395,  396,  397,  398,  399,
-  400,  401,  402,  634,  404,  733,  406,  407,  408,  409,
-  410,    0,  412,  413,  414,  504,  340,  417,  576,  419,
-  420,  421,   -1,   -1,   -1,   -1,  426,   -1,   -1,   -1,
-   -1,   -1,  432,  433,  434,  435,   -1,   -1,  438,  439,
-   -1,   -1,   -1,  443,   -1,   -1,   -1,   -1,  448,   -1,
-   -1,   -1,  452,  453,  454,  455,  456,  457,  458,   -1,
-  257,  258,  259,  260,  261,   -1,  466,  467,  468,  469,
-   -1,  268,   -1,  270,  271,  272,  273,   -1,   -1,  276,
-  277,  278,   -1,   -1,   -1,  282,  283,  284,  285,   -1,
-   -1,   -1,   -1,  290,  291,   -1,  293,   -1,   -1,  296,
-  297,  298,   -1,   -1,  301,  302,   -1,   -1,  305,  306,
-  307,  308,  309,  310,  311,  312,   -1,   -1,  315,  316,
-  317,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-  327,   -1,  329,  330,   -1,  332,  125,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,  343,   -1,   -1,   -1,
-   -1,  348,  349,  350,   -1,  352,  353,  354,   -1,   -1,
-   -1,   -1,  359,  360,  361,   -1,  363,   -1,   -1,   -1,
-   -1,   -1,   -1,  370,  371,  372,   -1,   -1,   -1,   -1,
-   -1,  378,  379,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,  388,  389,  390,  391,  392,   -1,  394,  395,  396,
-  397,  398,  399,  400,  401,  402,   -1,  404,   -1,  406,
-  407,  408,  409,  410,    0,  412,  413,  414,   -1,   -1,
-  417,   -1,  419,  420,  421,   -1,   -1,   -1,   -1,  426,
-   -1,   -1,   -1,   -1,   -1,  432,  433,  434,  435,   -1,
-   -1,  438,  439,   -1,   -1,   -1,  443,   -1,   -1,   -1,
-   -1,  448,   -1,   -1,   -1,  452,  453,  454,  455,  456,
-  457,  458,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  466,
-  467,  468,  469,   -1,   -1,   -1,   -1,   -1,   -1,  268,
-   -1,  270,  271,  272,  273,   -1,   -1,  276,  277,  278,
-   -1,   -1,   -1,  282,  283,  284,  285,   -1,   -1,   -1,
-   -1,  290,  291,   -1,  293,   -1,   -1,  296,  297,  298,
-   -1,   -1,  301,  302,   -1,   -1,  305,  306,  307,  308,
-  309,  310,  311,  312,   -1,   -1,  315,  316,  317,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  327,  125,
-  329,  330,   -1,  332,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,  343,   -1,   -1,   -1,   -1,  348,
-  349,  350,   -1,  352,   -1,  354,   -1,   -1,   -1,   -1,
-  359,  360,  361,   -1,  363,   -1,   -1,   -1,   -1,   -1,
-   -1,  370,   -1,  372,   -1,   -1,   -1,   -1,   -1,  378,
-  379,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  388,
-  389,  390,  391,  392,   -1,  394,  395,  396,  397,  398,
-  399,  400,  401,  402,   -1,  404,   -1,  406,  407,  408,
-  409,  410,    0,  412,  413,  414,   -1,   -1,  417,   -1,
-  419,  420,  421,   -1,   -1,   -1,   -1,  426,   -1,   -1,
-   -1,   -1,   -1,  432,  433,  434,  435,   -1,   -1,  438,
-  439,   -1,   -1,   -1,  443,   -1,   -1,   -1,   -1,  448,
-   -1,   -1,   -1,  452,  453,  454,  455,  456,  457,  458,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,  466,  467,  468,
-  469,   -1,  268,   -1,  270,  271,  272,  273,   -1,   -1,
-  276,  277,  278,   -1,   -1,   -1,  282,  283,  284,  285,
-   -1,   -1,   -1,   -1,  290,  291,   -1,  293,   -1,   -1,
-  296,  297,  298,   -1,   -1,  301,  302,   -1,   -1,  305,
-  306,  307,  308,  309,  310,  311,  312,   -1,   -1,  315,
-  316,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,  327,   -1,  329,  330,   -1,  332,  125,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,  343,   -1,   -1,
-   -1,   -1,  348,  349,  350,   -1,  352,   -1,  354,   -1,
-   -1,   -1,   -1,  359,  360,  361,   -1,  363,   -1,   -1,
-   -1,   -1,   -1,   -1,  370,   -1,  372,   -1,   -1,   -1,
-   -1,   -1,  378,  379,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,  388,  389,  390,  391,  392,   -1,  394,  395,
-  396,  397,  398,  399,  400,  401,  402,   -1,  404,   -1,
-  406,  407,  408,  409,  410,    0,  412,  413,  414,   -1,
-   -1,  417,   -1,  419,  420,  421,   -1,   -1,   -1,   -1,
-  426,   -1,   -1,   -1,   -1,   -1,  432,  433,  434,  435,
-   -1,   -1,  438,  439,   -1,   -1,   -1,  443,   -1,   -1,
-   -1,   -1,  448,   -1,   -1,   -1,  452,  453,  454,  455,
-  456,  457,  458,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-  466,  467,  468,  469,   -1,   -1,   -1,   -1,   -1,   -1,
-  268,   -1,  270,  271,  272,  273,   -1,   -1,  276,  277,
-  278,   -1,   -1,   -1,  282,  283,  284,  285,   -1,   -1,
-   -1,   -1,  290,  291,   -1,  293,   -1,   -1,  296,  297,
-  298,   -1,   -1,  301,  302,   -1,   -1,  305,  306,  307,
-  308,  309,  310,  311,  312,   -1,   -1,  315,  316,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  327,
-  125,  329,  330,   -1,  332,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,  343,   -1,   -1,   -1,   -1,
-  348,  349,  350,   -1,  352,   -1,  354,   -1,   -1,   -1,
-   -1,  359,  360,  361,   -1,  363,   -1,   -1,   -1,   -1,
-   -1,   -1,  370,   -1,  372,   -1,   -1,   -1,   -1,   -1,
-  378,  379,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-  388,  389,  390,  391,  392,   -1,  394,  395,  396,  397,
-  398,  399,  400,  401,  402,   -1,  404,   -1,  406,  407,
-  408,  409,  410,    0,  412,  413,  414,   -1,   -1,  417,
-   -1,  419,  420,  421,   -1,   -1,   -1,   -1,  426,   -1,
-   -1,   -1,   -1,   -1,  432,  433,  434,  435,   -1,   -1,
-  438,  439,   -1,   -1,   -1,  443,   -1,   -1,   -1,   -1,
-  448,   -1,   -1,   -1,  452,  453,  454,  455,  456,  457,
-  458,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  466,  467,
-  468,  469,   -1,  268,   -1,  270,  271,  272,  273,   -1,
-   -1,  276,  277,  278,   -1,   -1,   -1,  282,  283,  284,
-  285,   -1,   -1,   -1,   -1,  290,  291,   -1,  293,   -1,
-   -1,  296,  297,  298,   -1,   -1,  301,  302,   -1,   -1,
-  305,  306,  307,  308,  309,  310,  311,  312,   -1,   -1,
-  315,  316,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,  327,   -1,  329,  330,   -1,  332,  125,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  343,   -1,
-   -1,   -1,   -1,  348,  349,  350,   -1,  352,   -1,  354,
-   -1,   -1,   -1,   -1,  359,  360,  361,   -1,  363,   -1,
-   -1,   -1,   -1,   -1,   -1,  370,   -1,  372,   -1,   -1,
-   -1,   -1,   -1,  378,  379,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,    0,  388,  389,  390,  391,  392,   -1,  394,
-  395,  396,  397,  398,  399,  400,  401,  402,   -1,  404,
-   -1,  406,  407,  408,  409,  410,   -1,  412,  413,  414,
-   -1,   -1,  417,   -1,  419,  420,  421,   -1,   -1,   -1,
-   -1,  426,   -1,   -1,   -1,   -1,   -1,  432,  433,  434,
-  435,   -1,   -1,  438,  439,   -1,   -1,   -1,  443,   -1,
-   -1,   -1,   -1,  448,   -1,   -1,   -1,  452,  453,  454,
-  455,  456,  457,  458,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,  466,  467,  468,  469,   -1,   -1,   -1,   -1,   -1,
-    0,  268,   -1,  270,  271,  272,  273,   -1,   -1,  276,
-  277,  278,   -1,   -1,   -1,  282,  283,  284,  285,   -1,
-   -1,   -1,   -1,  290,  291,   -1,  293,   -1,   -1,  296,
-  297,  298,   -1,   -1,   -1,   -1,   -1,   -1,  305,  306,
-  307,  308,  309,  310,  311,  312,   -1,   -1,  315,  316,
-  317,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-  327,   -1,  329,  330,   -1,  332,  276,  277,   -1,   -1,
-   -1,   -1,  282,  283,  284,  285,  343,   -1,   -1,   -1,
-   -1,  348,  349,  350,   -1,  352,   -1,  354,   -1,   -1,
-   -1,   -1,   -1,    0,   -1,   -1,  363,   -1,   -1,  309,
-  310,  311,  312,  370,   -1,  372,   -1,   -1,   -1,   -1,
-   -1,  378,  379,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,  332,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,  354,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,  433,  434,  435,   -1,
-   -1,   -1,  439,   -1,   -1,   -1,  443,   -1,   -1,   -1,
-   -1,  448,  270,  271,  272,  273,    0,   -1,  276,  277,
-  278,   -1,   -1,   -1,  282,  283,  284,  285,   -1,   -1,
-  467,   -1,  290,  291,   -1,  293,   -1,   -1,  296,  297,
-  298,   -1,   -1,   -1,   -1,   -1,   -1,  305,  306,  307,
-  308,  309,  310,  311,  312,   -1,   -1,  315,  316,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  327,
-   -1,  329,  330,   -1,  332,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,  343,   -1,   -1,   -1,   -1,
-  348,  349,  350,   -1,  352,   -1,  354,   -1,   -1,   -1,
-  270,  271,  272,  273,    0,   -1,  276,  277,  278,   -1,
-   -1,   -1,  282,  283,  284,  285,   -1,   -1,   -1,   -1,
-  290,  291,   -1,  293,   -1,   -1,  296,  297,  298,   -1,
-   -1,   -1,   -1,   -1,   -1,  305,  306,  307,  308,  309,
-  310,  311,  312,   -1,   -1,  315,  316,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,  327,   -1,  329,
-  330,   -1,  332,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,  343,   -1,  433,  434,  435,  348,  349,
-  350,   -1,  352,   -1,  354,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,  270,  271,  272,  273,   -1,   -1,  276,
-  277,  278,   -1,   -1,   -1,  282,  283,  284,  285,  467,
-   -1,   -1,   -1,  290,  291,   -1,  293,   -1,   -1,  296,
-  297,  298,   -1,   -1,   -1,   -1,   -1,   -1,  305,  306,
-  307,  308,  309,  310,  311,  312,   -1,   -1,  315,  316,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-  327,   -1,  329,  330,   -1,  332,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,  433,  434,  435,  343,   -1,   -1,   -1,
-   -1,  348,  349,  350,   -1,  352,   -1,  354,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,  270,  271,  272,  273,
-   -1,   -1,  276,  277,  278,   -1,   -1,  467,  282,  283,
-  284,  285,   -1,   -1,   -1,   -1,  290,  291,   -1,  293,
-   -1,   -1,  296,  297,  298,   -1,   -1,   -1,   -1,   -1,
-   -1,  305,  306,  307,  308,  309,  310,  311,  312,  125,
-   -1,  315,  316,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,  327,   -1,  329,  330,   -1,  332,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,  433,  434,  435,  343,
-   -1,   -1,   -1,   -1,  348,  349,  350,   -1,  352,   -1,
-  354,   -1,   -1,   -1,  270,  271,  272,  273,   -1,   -1,
-  276,  277,  278,   -1,   -1,   -1,  282,  283,  284,  285,
-  467,   -1,   -1,   -1,  290,  291,   -1,  293,   -1,   -1,
-  296,  297,  298,   -1,   -1,   -1,   -1,   -1,   -1,  305,
-  306,  307,  308,  309,  310,  311,  312,   -1,   -1,  315,
-  316,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,  327,   -1,  329,  330,   -1,  332,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,  343,   -1,  433,
-  434,  435,  348,  349,  350,   -1,  352,   -1,  354,   -1,
-   -1,  257,  258,  259,  260,  261,   -1,   -1,   -1,   -1,
-   -1,   -1,  268,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-  276,  277,   -1,  467,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,  290,  291,   -1,  293,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,  301,  302,   -1,   -1,   -1,
-  125,  307,  308,  309,  310,  311,  312,   -1,   -1,  315,
-  316,  317,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,  125,   -1,   -1,   -1,   -1,   -1,  433,  434,  435,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,  359,  360,  361,   -1,  363,   -1,   -1,
-   -1,  467,   -1,   -1,  370,   -1,  372,   -1,   -1,   -1,
-   -1,   -1,  378,  379,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,  388,  389,  390,  391,  392,   -1,  394,  395,
-  396,  397,  398,  399,  400,  401,  402,   -1,  404,   -1,
-  406,  407,  408,  409,  410,   -1,  412,  413,  414,   -1,
-   -1,  417,   -1,  419,  420,  421,   -1,   -1,   -1,   -1,
-  426,   -1,   -1,   -1,   -1,   -1,  432,   -1,   -1,   -1,
-   -1,   -1,  438,  439,   -1,   -1,   -1,  443,   -1,   -1,
-   -1,   -1,  448,  268,   -1,   -1,  452,  453,  454,  455,
-  456,  457,  458,  257,  258,  259,  260,  261,   -1,   -1,
-  466,   -1,  468,  469,  268,   -1,   -1,   -1,  293,   -1,
-   -1,   -1,  276,  277,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,  307,  308,   -1,   -1,  290,  291,   -1,  293,
-  125,   -1,  317,   -1,   -1,   -1,   -1,  301,  302,   -1,
-   -1,   -1,   -1,  307,  308,  309,  310,  311,  312,   -1,
-   -1,  315,  316,  317,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  363,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,  372,   -1,   -1,
-   -1,   -1,   -1,  378,  379,  359,   -1,  361,   -1,  363,
-   -1,   -1,   -1,   -1,   -1,   -1,  370,   -1,  372,   -1,
-   -1,   -1,   -1,   -1,  378,  379,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,  388,  389,  390,  391,  392,   -1,
-  394,  395,  396,  397,  398,  399,  400,  401,  402,   -1,
-  404,   -1,  406,  407,  408,  409,  410,   -1,  412,  413,
-  414,   -1,   -1,  417,  439,  419,  420,  421,  443,   -1,
-   -1,   -1,  426,  448,   -1,   -1,   -1,   -1,  432,   -1,
-   -1,   -1,   -1,  268,  438,  439,   -1,   -1,   -1,  443,
-   -1,  276,  277,   -1,  448,   -1,   -1,   -1,   -1,  453,
-  454,  455,  456,  457,  458,  290,  291,   -1,  293,  125,
-   -1,   -1,  466,   -1,  468,  469,  301,  302,   -1,   -1,
-   -1,   -1,  307,  308,  309,  310,  311,  312,   -1,   -1,
-  315,  316,  317,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,  359,  360,  361,   -1,  363,   -1,
-   -1,   -1,   -1,   -1,   -1,  370,   -1,  372,   -1,   -1,
-   -1,   -1,   -1,  378,  379,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,  388,  389,  390,  391,  392,   -1,  394,
-  395,  396,  397,  398,  399,  400,  401,  402,   -1,  404,
-   -1,  406,  407,  408,  409,  410,   -1,  412,  413,  414,
-   -1,   -1,  417,   -1,  419,  420,  421,   -1,   -1,   -1,
-   -1,  426,   -1,   -1,   -1,   -1,   -1,  432,   -1,   -1,
-   -1,   -1,  268,  438,  439,   -1,   -1,   -1,  443,   -1,
-  276,  277,   -1,  448,   -1,   -1,   -1,  452,  453,  454,
-  455,  456,  457,  458,  290,  291,   -1,   -1,  125,   -1,
-   -1,  466,   -1,  468,  469,  301,  302,   -1,   -1,   -1,
-   -1,  307,  308,  309,  310,  311,  312,   -1,   -1,  315,
-  316,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,  359,  360,  361,   -1,  363,   -1,   -1,
-   -1,   -1,   -1,   -1,  370,   -1,  372,   -1,   -1,   -1,
-   -1,   -1,  378,  379,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,  388,  389,  390,  391,  392,   -1,  394,  395,
-  396,  397,  398,  399,  400,  401,  402,   -1,  404,   -1,
-  406,  407,  408,  409,  410,   -1,  412,  413,  414,   -1,
-   -1,  417,   -1,  419,  420,  421,   -1,   -1,   -1,   -1,
-  426,   -1,   -1,   -1,   -1,   -1,  432,   -1,   -1,   -1,
-   -1,  268,  438,  439,   -1,   -1,   -1,  443,   -1,  276,
-  277,   -1,  448,   -1,   -1,   -1,  452,  453,  454,  455,
-  456,  457,  458,  290,  291,   -1,  293,  125,   -1,   -1,
-  466,   -1,  468,  469,  301,  302,   -1,   -1,   -1,   -1,
-  307,  308,  309,  310,  311,  312,   -1,   -1,  315,  316,
-  317,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,  359,   -1,  361,   -1,  363,   -1,   -1,   -1,
-   -1,   -1,   -1,  370,   -1,  372,   -1,   -1,   -1,   -1,
-   -1,  378,  379,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,  388,  389,  390,  391,  392,   -1,  394,  395,  396,
-  397,  398,  399,  400,  401,  402,   -1,  404,   -1,  406,
-  407,  408,  409,  410,   -1,  412,  413,  414,   -1,   -1,
-  417,   -1,  419,  420,  421,   -1,   -1,   -1,   -1,  426,
-   -1,   -1,   -1,   -1,   -1,  432,   -1,   -1,   -1,   -1,
-  268,  438,  439,   -1,   -1,   -1,  443,   -1,  276,  277,
-   -1,  448,   -1,   -1,   -1,   -1,  453,  454,  455,  456,
-  457,  458,  290,  291,   -1,   -1,  125,   -1,   -1,  466,
-   -1,  468,  469,  301,  302,   -1,   -1,   -1,   -1,  307,
-  308,  309,  310,  311,  312,   -1,   -1,  315,  316,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,  359,  360,  361,   -1,  363,   -1,   -1,   -1,   -1,
-   -1,   -1,  370,   -1,  372,   -1,   -1,   -1,   -1,   -1,
-  378,  379,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-  388,  389,  390,  391,  392,   -1,  394,  395,  396,  397,
-  398,  399,  400,  401,  402,   -1,  404,   -1,  406,  407,
-  408,  409,  410,   -1,  412,  413,  414,   -1,   -1,  417,
-   -1,  419,  420,  421,   -1,   -1,   -1,   -1,  426,   -1,
-   -1,   -1,   -1,   -1,  432,   -1,   -1,   -1,   -1,  268,
-  438,  439,   -1,   -1,   -1,  443,   -1,  276,  277,   -1,
-  448,   -1,   -1,   -1,  452,  453,  454,  455,  456,  457,
-  458,  290,  291,   -1,   -1,  125,   -1,   -1,  466,   -1,
-  468,  469,  301,  302,   -1,   -1,   -1,   -1,  307,  308,
-  309,  310,  311,  312,   -1,   -1,  315,  316,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-  359,  360,  361,   -1,  363,   -1,   -1,   -1,   -1,   -1,
-   -1,  370,   -1,  372,   -1,   -1,   -1,   -1,   -1,  378,
-  379,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  388,
-  389,  390,  391,  392,   -1,  394,  395,  396,  397,  398,
-  399,  400,  401,  402,   -1,  404,   -1,  406,  407,  408,
-  409,  410,   -1,  412,  413,  414,   -1,   -1,  417,   -1,
-  419,  420,  421,   -1,   -1,   -1,   -1,  426,   -1,   -1,
-   -1,   -1,   -1,  432,   -1,   -1,   -1,   -1,  268,  438,
-  439,   -1,   -1,   -1,  443,   -1,  276,  277,   -1,  448,
-   -1,   -1,   -1,  452,  453,  454,  455,  456,  457,  458,
-  290,  291,   -1,   -1,  125,   -1,   -1,  466,   -1,  468,
-  469,  301,  302,   -1,   -1,   -1,   -1,  307,  308,  309,
-  310,  311,  312,   -1,   -1,  315,  316,   -1,   -1,   -1,
-   -1,   -1,  125,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  359,
-  360,  361,   -1,  363,   -1,   -1,   -1,   -1,   -1,   -1,
-  370,   -1,  372,   -1,   -1,   -1,   -1,   -1,  378,  379,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  388,  389,
-  390,  391,  392,   -1,  394,  395,  396,  397,  398,  399,
-  400,  401,  402,   -1,  404,   -1,  406,  407,  408,  409,
-  410,   -1,  412,  413,  414,   -1,   -1,  417,   -1,  419,
-  420,  421,   -1,   -1,   -1,   -1,  426,   -1,   -1,   -1,
-   -1,   -1,  432,   -1,   -1,   -1,   -1,  268,  438,  439,
-   -1,   -1,   -1,  443,   -1,  276,  277,   -1,  448,   -1,
-   -1,   -1,  452,  453,  454,  455,  456,  457,  458,  290,
-  291,   -1,  293,   -1,   -1,  268,  466,   -1,  468,  469,
-  301,  302,   -1,  276,  277,   -1,  307,  308,  309,  310,
-  311,  312,   -1,   -1,  315,  316,  317,  290,  291,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  301,  302,
-   -1,   -1,   -1,   -1,  307,  308,  309,  310,  311,  312,
-   -1,   -1,  315,  316,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  359,  360,
-   -1,   -1,  363,   -1,   -1,   -1,   -1,   -1,   -1,  370,
-   -1,  372,   -1,   -1,   -1,   -1,   -1,  378,  379,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,  359,  360,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,  370,   -1,  372,
-   -1,   -1,   -1,   -1,   -1,  378,  379,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,  432,   -1,   -1,   -1,   -1,   -1,  438,  439,   -1,
-   -1,   -1,  443,   -1,   -1,   -1,   -1,  448,   -1,   -1,
-   -1,  452,  453,  454,  455,  456,  457,  458,   -1,  432,
-   -1,   -1,   -1,   -1,   -1,  438,  439,  468,  469,   -1,
-   -1,   -1,   -1,   -1,   -1,  448,   -1,   -1,   -1,  452,
-  453,  454,  455,  456,  457,  458,   -1,   -1,  273,   -1,
-   -1,  276,  277,  278,   -1,  468,  469,  282,  283,  284,
-  285,   -1,   -1,   -1,   -1,  290,  291,   -1,  293,   -1,
-   -1,  296,  297,  298,   -1,   -1,   -1,   -1,   -1,   -1,
-  305,  306,  307,  308,  309,  310,  311,  312,   -1,   -1,
-  315,  316,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,  276,  277,  329,  330,   -1,  332,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,  290,  291,  343,   -1,
-   -1,   -1,   -1,  348,  349,  350,   -1,  301,  302,  354,
-   -1,   -1,   -1,  307,  308,  309,  310,  311,  312,   -1,
-   -1,  315,  316,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,  359,   -1,  361,   -1,  363,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  372,   -1,
-   -1,   -1,   -1,   -1,  378,  379,   -1,   -1,  433,  434,
-  435,   -1,   -1,   -1,  388,  389,  390,  391,  392,   -1,
-  394,  395,  396,  397,  398,  399,  400,  401,  402,   -1,
-  404,   -1,  406,  407,  408,  409,  410,   -1,  412,  413,
-  414,   -1,  467,  417,   -1,  419,  420,  421,   -1,   -1,
-   -1,   -1,  426,   -1,   -1,   -1,   -1,   -1,  432,   -1,
-   -1,   -1,   -1,   -1,  438,  439,   -1,   -1,   -1,  443,
-   -1,   -1,   -1,   -1,  448,   -1,   -1,   -1,   -1,  453,
-  454,  455,  456,  457,  458,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,  466,   -1,  468,  469,
+
+#line 962 "config_parse.c"
+
 };
-#define YYFINAL 3
-#ifndef YYDEBUG
-#define YYDEBUG 0
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
 #endif
-#define YYMAXTOKEN 473
-#if YYDEBUG
-const char * const socks_yyname[] =
-	{
-"end-of-file",0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,"'-'","'.'","'/'",0,0,0,0,0,0,0,0,0,0,"':'",0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,"'{'",0,"'}'",0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,"ALARM",
-"ALARMTYPE_DATA","ALARMTYPE_DISCONNECT","ALARMIF_INTERNAL","ALARMIF_EXTERNAL",
-"TCPOPTION_DISABLED","ECN","SACK","TIMESTAMPS","WSCALE","MTU_ERROR",
-"CLIENTCOMPATIBILITY","NECGSSAPI","CLIENTRULE","HOSTIDRULE","SOCKSRULE",
-"COMPATIBILITY","SAMEPORT","DRAFT_5_05","CONNECTTIMEOUT","TCP_FIN_WAIT","CPU",
-"MASK","SCHEDULE","CPUMASK_ANYCPU","DEBUGGING","DEPRECATED","ERRORLOG",
-"LOGOUTPUT","LOGFILE","LOGTYPE_ERROR","LOGTYPE_TCP_DISABLED",
-"LOGTYPE_TCP_ENABLED","LOGIF_INTERNAL","LOGIF_EXTERNAL","ERRORVALUE",
-"EXTENSION","BIND","PRIVILEGED","EXTERNAL_PROTOCOL","INTERNAL_PROTOCOL",
-"EXTERNAL_ROTATION","SAMESAME","GROUPNAME","HOSTID","HOSTINDEX","INTERFACE",
-"SOCKETOPTION_SYMBOLICVALUE","INTERNAL","EXTERNAL","INTERNALSOCKET",
-"EXTERNALSOCKET","IOTIMEOUT","IOTIMEOUT_TCP","IOTIMEOUT_UDP","NEGOTIATETIMEOUT",
-"LIBWRAP_FILE","LOGLEVEL","SOCKSMETHOD","CLIENTMETHOD","METHOD","METHODNAME",
-"NONE","BSDAUTH","GSSAPI","PAM_ADDRESS","PAM_ANY","PAM_USERNAME","RFC931",
-"UNAME","MONITOR","PROCESSTYPE","PROC_MAXREQUESTS","REALM","REALNAME",
-"RESOLVEPROTOCOL","REQUIRED","SCHEDULEPOLICY","SERVERCONFIG","CLIENTCONFIG",
-"SOCKET","CLIENTSIDE_SOCKET","SNDBUF","RCVBUF","SOCKETPROTOCOL",
-"SOCKETOPTION_OPTID","SRCHOST","NODNSMISMATCH","NODNSUNKNOWN","CHECKREPLYAUTH",
-"USERNAME","USER_PRIVILEGED","USER_UNPRIVILEGED","USER_LIBWRAP","WORD__IN",
-"ROUTE","VIA","GLOBALROUTEOPTION","BADROUTE_EXPIRE","MAXFAIL","PORT","NUMBER",
-"BANDWIDTH","BOUNCE","BSDAUTHSTYLE","BSDAUTHSTYLENAME","COMMAND","COMMAND_BIND",
-"COMMAND_CONNECT","COMMAND_UDPASSOCIATE","COMMAND_BINDREPLY","COMMAND_UDPREPLY",
-"ACTION","FROM","TO","GSSAPIENCTYPE","GSSAPIENC_ANY","GSSAPIENC_CLEAR",
-"GSSAPIENC_INTEGRITY","GSSAPIENC_CONFIDENTIALITY","GSSAPIENC_PERMESSAGE",
-"GSSAPIKEYTAB","GSSAPISERVICE","GSSAPISERVICENAME","GSSAPIKEYTABNAME","IPV4",
-"IPV6","IPVANY","DOMAINNAME","IFNAME","URL","LDAPATTRIBUTE","LDAPATTRIBUTE_AD",
-"LDAPATTRIBUTE_HEX","LDAPATTRIBUTE_AD_HEX","LDAPBASEDN","LDAP_BASEDN",
-"LDAPBASEDN_HEX","LDAPBASEDN_HEX_ALL","LDAPCERTFILE","LDAPCERTPATH","LDAPPORT",
-"LDAPPORTSSL","LDAPDEBUG","LDAPDEPTH","LDAPAUTO","LDAPSEARCHTIME","LDAPDOMAIN",
-"LDAP_DOMAIN","LDAPFILTER","LDAPFILTER_AD","LDAPFILTER_HEX","LDAPFILTER_AD_HEX",
-"LDAPGROUP","LDAPGROUP_NAME","LDAPGROUP_HEX","LDAPGROUP_HEX_ALL","LDAPKEYTAB",
-"LDAPKEYTABNAME","LDAPDEADTIME","LDAPSERVER","LDAPSERVER_NAME","LDAPSSL",
-"LDAPCERTCHECK","LDAPKEEPREALM","LDAPTIMEOUT","LDAPCACHE","LDAPCACHEPOS",
-"LDAPCACHENEG","LDAPURL","LDAP_URL","LDAP_FILTER","LDAP_ATTRIBUTE",
-"LDAP_CERTFILE","LDAP_CERTPATH","LIBWRAPSTART","LIBWRAP_ALLOW","LIBWRAP_DENY",
-"LIBWRAP_HOSTS_ACCESS","LINE","OPERATOR","PAMSERVICENAME","PROTOCOL",
-"PROTOCOL_TCP","PROTOCOL_UDP","PROTOCOL_FAKE","PROXYPROTOCOL",
-"PROXYPROTOCOL_SOCKS_V4","PROXYPROTOCOL_SOCKS_V5","PROXYPROTOCOL_HTTP",
-"PROXYPROTOCOL_UPNP","REDIRECT","SENDSIDE","RECVSIDE","SERVICENAME",
-"SESSION_INHERITABLE","SESSIONMAX","SESSIONTHROTTLE","SESSIONSTATE_KEY",
-"SESSIONSTATE_MAX","SESSIONSTATE_THROTTLE","RULE_LOG","RULE_LOG_CONNECT",
-"RULE_LOG_DATA","RULE_LOG_DISCONNECT","RULE_LOG_ERROR","RULE_LOG_IOOPERATION",
-"RULE_LOG_TCPINFO","STATEKEY","UDPPORTRANGE","UDPCONNECTDST","USER","GROUP",
-"VERDICT_BLOCK","VERDICT_PASS","YES","NO",
-};
-const char * const socks_yyrule[] =
-	{"$accept : configtype",
-"$$1 :",
-"configtype : SERVERCONFIG $$1 serveroptions serverobjects",
-"configtype : CLIENTCONFIG clientoptions routes",
-"serverobjects :",
-"serverobjects : serverobjects serverobject",
-"serverobject : crule",
-"serverobject : hrule",
-"serverobject : srule",
-"serverobject : monitor",
-"serverobject : route",
-"serveroptions :",
-"serveroptions : serveroption serveroptions",
-"serveroption : childstate",
-"serveroption : compatibility",
-"serveroption : cpu",
-"serveroption : debugging",
-"serveroption : deprecated",
-"serveroption : errorlog",
-"serveroption : extension",
-"serveroption : external",
-"serveroption : external_protocol",
-"serveroption : external_rotation",
-"serveroption : external_if_logoption",
-"serveroption : global_clientmethod",
-"serveroption : global_socksmethod",
-"serveroption : global_routeoption",
-"serveroption : internal",
-"serveroption : internal_protocol",
-"serveroption : internal_if_logoption",
-"serveroption : libwrap_hosts_access",
-"serveroption : libwrapfiles",
-"serveroption : logoutput",
-"serveroption : realm",
-"serveroption : resolveprotocol",
-"serveroption : srchost",
-"serveroption : timeout",
-"serveroption : udpconnectdst",
-"serveroption : userids",
-"serveroption : socketoption",
-"logspecial : LOGTYPE_ERROR ':' errors",
-"$$2 :",
-"logspecial : LOGTYPE_TCP_DISABLED ':' $$2 tcpoptions",
-"$$3 :",
-"logspecial : LOGTYPE_TCP_ENABLED ':' $$3 tcpoptions",
-"$$4 :",
-"internal_if_logoption : LOGIF_INTERNAL $$4 '.' loglevel '.' logspecial",
-"$$5 :",
-"external_if_logoption : LOGIF_EXTERNAL $$5 '.' loglevel '.' logspecial",
-"$$6 :",
-"rule_internal_logoption : LOGIF_INTERNAL $$6 '.' loglevel '.' logspecial",
-"$$7 :",
-"rule_external_logoption : LOGIF_EXTERNAL $$7 '.' loglevel '.' logspecial",
-"loglevel : LOGLEVEL",
-"tcpoptions : tcpoption",
-"tcpoptions : tcpoption tcpoptions",
-"tcpoption : ECN",
-"tcpoption : SACK",
-"tcpoption : TIMESTAMPS",
-"tcpoption : WSCALE",
-"errors : errorobject",
-"errors : errorobject errors",
-"errorobject : ERRORVALUE",
-"timeout : connecttimeout",
-"timeout : iotimeout",
-"timeout : negotiatetimeout",
-"timeout : tcp_fin_timeout",
-"deprecated : DEPRECATED",
-"$$8 :",
-"$$9 :",
-"route : ROUTE $$8 '{' $$9 routeoptions fromto gateway routeoptions '}'",
-"routes :",
-"routes : routes route",
-"proxyprotocol : PROXYPROTOCOL ':' proxyprotocols",
-"proxyprotocolname : PROXYPROTOCOL_SOCKS_V4",
-"proxyprotocolname : PROXYPROTOCOL_SOCKS_V5",
-"proxyprotocolname : PROXYPROTOCOL_HTTP",
-"proxyprotocolname : PROXYPROTOCOL_UPNP",
-"proxyprotocolname : deprecated",
-"proxyprotocols : proxyprotocolname",
-"proxyprotocols : proxyprotocolname proxyprotocols",
-"user : USER ':' usernames",
-"username : USERNAME",
-"usernames : username",
-"usernames : usernames username",
-"group : GROUP ':' groupnames",
-"groupname : GROUPNAME",
-"groupnames : groupname",
-"groupnames : groupnames groupname",
-"extension : EXTENSION ':' extensions",
-"extensionname : BIND",
-"extensions : extensionname",
-"extensions : extensionname extensions",
-"ifprotocols : ifprotocol",
-"ifprotocols : ifprotocol ifprotocols",
-"ifprotocol : IPV4",
-"ifprotocol : IPV6",
-"internal : INTERNAL internalinit ':' address",
-"internalinit :",
-"$$10 :",
-"internal_protocol : INTERNAL_PROTOCOL ':' $$10 ifprotocols",
-"external : EXTERNAL externalinit ':' externaladdress",
-"externalinit :",
-"$$11 :",
-"external_protocol : EXTERNAL_PROTOCOL ':' $$11 ifprotocols",
-"external_rotation : EXTERNAL_ROTATION ':' NONE",
-"external_rotation : EXTERNAL_ROTATION ':' SAMESAME",
-"external_rotation : EXTERNAL_ROTATION ':' ROUTE",
-"clientoption : debugging",
-"clientoption : deprecated",
-"clientoption : global_routeoption",
-"clientoption : errorlog",
-"clientoption : logoutput",
-"clientoption : resolveprotocol",
-"clientoption : timeout",
-"clientoptions :",
-"clientoptions : clientoption clientoptions",
-"global_routeoption : GLOBALROUTEOPTION MAXFAIL ':' NUMBER",
-"global_routeoption : GLOBALROUTEOPTION BADROUTE_EXPIRE ':' NUMBER",
-"$$12 :",
-"errorlog : ERRORLOG ':' $$12 logoutputdevices",
-"$$13 :",
-"logoutput : LOGOUTPUT ':' $$13 logoutputdevices",
-"logoutputdevice : LOGFILE",
-"logoutputdevices : logoutputdevice",
-"logoutputdevices : logoutputdevice logoutputdevices",
-"childstate : PROC_MAXREQUESTS ':' NUMBER",
-"userids : user_privileged",
-"userids : user_unprivileged",
-"userids : user_libwrap",
-"user_privileged : USER_PRIVILEGED ':' userid",
-"user_unprivileged : USER_UNPRIVILEGED ':' userid",
-"user_libwrap : USER_LIBWRAP ':' userid",
-"userid : USERNAME",
-"iotimeout : IOTIMEOUT ':' NUMBER",
-"iotimeout : IOTIMEOUT_TCP ':' NUMBER",
-"iotimeout : IOTIMEOUT_UDP ':' NUMBER",
-"negotiatetimeout : NEGOTIATETIMEOUT ':' NUMBER",
-"connecttimeout : CONNECTTIMEOUT ':' NUMBER",
-"tcp_fin_timeout : TCP_FIN_WAIT ':' NUMBER",
-"debugging : DEBUGGING ':' NUMBER",
-"libwrapfiles : libwrap_allowfile",
-"libwrapfiles : libwrap_denyfile",
-"libwrap_allowfile : LIBWRAP_ALLOW ':' LIBWRAP_FILE",
-"libwrap_denyfile : LIBWRAP_DENY ':' LIBWRAP_FILE",
-"libwrap_hosts_access : LIBWRAP_HOSTS_ACCESS ':' YES",
-"libwrap_hosts_access : LIBWRAP_HOSTS_ACCESS ':' NO",
-"udpconnectdst : UDPCONNECTDST ':' YES",
-"udpconnectdst : UDPCONNECTDST ':' NO",
-"compatibility : COMPATIBILITY ':' compatibilitynames",
-"compatibilityname : SAMEPORT",
-"compatibilityname : DRAFT_5_05",
-"compatibilitynames : compatibilityname",
-"compatibilitynames : compatibilityname compatibilitynames",
-"resolveprotocol : RESOLVEPROTOCOL ':' resolveprotocolname",
-"resolveprotocolname : PROTOCOL_FAKE",
-"resolveprotocolname : PROTOCOL_TCP",
-"resolveprotocolname : PROTOCOL_UDP",
-"cpu : cpuschedule",
-"cpu : cpuaffinity",
-"cpuschedule : CPU '.' SCHEDULE '.' PROCESSTYPE ':' SCHEDULEPOLICY '/' NUMBER",
-"cpuaffinity : CPU '.' MASK '.' PROCESSTYPE ':' numbers",
-"$$14 :",
-"socketoption : socketside SOCKETPROTOCOL '.' $$14 socketoptionname ':' socketoptionvalue",
-"socketoptionname : NUMBER",
-"socketoptionname : SOCKETOPTION_OPTID",
-"socketoptionvalue : NUMBER",
-"socketoptionvalue : SOCKETOPTION_SYMBOLICVALUE",
-"socketside : INTERNALSOCKET",
-"socketside : EXTERNALSOCKET",
-"srchost : SRCHOST ':' srchostoptions",
-"srchostoption : NODNSMISMATCH",
-"srchostoption : NODNSUNKNOWN",
-"srchostoption : CHECKREPLYAUTH",
-"srchostoptions : srchostoption",
-"srchostoptions : srchostoption srchostoptions",
-"realm : REALM ':' REALNAME",
-"$$15 :",
-"global_clientmethod : CLIENTMETHOD ':' $$15 clientmethods",
-"$$16 :",
-"global_socksmethod : SOCKSMETHOD ':' $$16 socksmethods",
-"socksmethod : SOCKSMETHOD ':' socksmethods",
-"socksmethods : socksmethodname",
-"socksmethods : socksmethodname socksmethods",
-"socksmethodname : METHODNAME",
-"clientmethod : CLIENTMETHOD ':' clientmethods",
-"clientmethods : clientmethodname",
-"clientmethods : clientmethodname clientmethods",
-"clientmethodname : METHODNAME",
-"$$17 :",
-"$$18 :",
-"monitor : MONITOR $$17 '{' $$18 monitoroptions fromto monitoroptions '}'",
-"$$19 :",
-"crule : CLIENTRULE $$19 verdict '{' cruleoptions fromto cruleoptions '}'",
-"alarm : alarm_data",
-"alarm : alarm_disconnect",
-"alarm : alarm_test",
-"monitorside :",
-"monitorside : ALARMIF_INTERNAL",
-"monitorside : ALARMIF_EXTERNAL",
-"alarmside :",
-"alarmside : RECVSIDE",
-"alarmside : SENDSIDE",
-"$$20 :",
-"alarm_data : monitorside ALARMTYPE_DATA $$20 alarmside ':' NUMBER WORD__IN NUMBER",
-"alarm_test : monitorside ALARM '.' networkproblem",
-"networkproblem : MTU_ERROR",
-"alarm_disconnect : monitorside ALARMTYPE_DISCONNECT ':' NUMBER '/' NUMBER alarmperiod",
-"alarmperiod :",
-"alarmperiod : WORD__IN NUMBER",
-"monitoroption : alarm",
-"monitoroption : command",
-"monitoroption : hostidoption",
-"monitoroption : protocol",
-"monitoroptions :",
-"monitoroptions : monitoroption monitoroptions",
-"cruleoption : bounce",
-"cruleoption : protocol",
-"cruleoption : clientcompatibility",
-"cruleoption : crulesessionoption",
-"cruleoption : genericruleoption",
-"$$21 :",
-"hrule : HOSTIDRULE $$21 verdict '{' cruleoptions hostid_fromto cruleoptions '}'",
-"cruleoptions :",
-"cruleoptions : cruleoption cruleoptions",
-"hostidoption : hostid",
-"hostidoption : hostindex",
-"$$22 :",
-"hostid : HOSTID ':' $$22 address_without_port",
-"hostindex : HOSTINDEX ':' NUMBER",
-"$$23 :",
-"srule : SOCKSRULE $$23 verdict '{' sruleoptions fromto sruleoptions '}'",
-"sruleoptions :",
-"sruleoptions : sruleoption sruleoptions",
-"sruleoption : bsdauthstylename",
-"sruleoption : command",
-"sruleoption : genericruleoption",
-"sruleoption : ldapoption",
-"sruleoption : protocol",
-"sruleoption : proxyprotocol",
-"sruleoption : sockssessionoption",
-"sruleoption : udpportrange",
-"genericruleoption : bandwidth",
-"genericruleoption : clientmethod",
-"genericruleoption : socksmethod",
-"genericruleoption : rule_external_logoption",
-"genericruleoption : group",
-"genericruleoption : gssapienctype",
-"genericruleoption : gssapikeytab",
-"genericruleoption : gssapiservicename",
-"genericruleoption : hostidoption",
-"genericruleoption : rule_internal_logoption",
-"genericruleoption : libwrap",
-"genericruleoption : log",
-"genericruleoption : pamservicename",
-"genericruleoption : redirect",
-"genericruleoption : socketoption",
-"genericruleoption : timeout",
-"genericruleoption : user",
-"ldapoption : ldapattribute",
-"ldapoption : ldapattribute_ad",
-"ldapoption : ldapattribute_ad_hex",
-"ldapoption : ldapattribute_hex",
-"ldapoption : ldapauto",
-"ldapoption : lbasedn",
-"ldapoption : lbasedn_hex",
-"ldapoption : lbasedn_hex_all",
-"ldapoption : ldapcertcheck",
-"ldapoption : ldapcertfile",
-"ldapoption : ldapcertpath",
-"ldapoption : ldapdebug",
-"ldapoption : ldapdepth",
-"ldapoption : ldapdomain",
-"ldapoption : ldapfilter",
-"ldapoption : ldapfilter_ad",
-"ldapoption : ldapfilter_ad_hex",
-"ldapoption : ldapfilter_hex",
-"ldapoption : ldapkeeprealm",
-"ldapoption : ldapkeytab",
-"ldapoption : ldapport",
-"ldapoption : ldapportssl",
-"ldapoption : ldapssl",
-"ldapoption : lgroup",
-"ldapoption : lgroup_hex",
-"ldapoption : lgroup_hex_all",
-"ldapoption : lserver",
-"ldapoption : lurl",
-"ldapdebug : LDAPDEBUG ':' NUMBER",
-"ldapdebug : LDAPDEBUG ':' '-' NUMBER",
-"ldapdomain : LDAPDOMAIN ':' LDAP_DOMAIN",
-"ldapdepth : LDAPDEPTH ':' NUMBER",
-"ldapcertfile : LDAPCERTFILE ':' LDAP_CERTFILE",
-"ldapcertpath : LDAPCERTPATH ':' LDAP_CERTPATH",
-"lurl : LDAPURL ':' LDAP_URL",
-"lbasedn : LDAPBASEDN ':' LDAP_BASEDN",
-"lbasedn_hex : LDAPBASEDN_HEX ':' LDAP_BASEDN",
-"lbasedn_hex_all : LDAPBASEDN_HEX_ALL ':' LDAP_BASEDN",
-"ldapport : LDAPPORT ':' NUMBER",
-"ldapportssl : LDAPPORTSSL ':' NUMBER",
-"ldapssl : LDAPSSL ':' YES",
-"ldapssl : LDAPSSL ':' NO",
-"ldapauto : LDAPAUTO ':' YES",
-"ldapauto : LDAPAUTO ':' NO",
-"ldapcertcheck : LDAPCERTCHECK ':' YES",
-"ldapcertcheck : LDAPCERTCHECK ':' NO",
-"ldapkeeprealm : LDAPKEEPREALM ':' YES",
-"ldapkeeprealm : LDAPKEEPREALM ':' NO",
-"ldapfilter : LDAPFILTER ':' LDAP_FILTER",
-"ldapfilter_ad : LDAPFILTER_AD ':' LDAP_FILTER",
-"ldapfilter_hex : LDAPFILTER_HEX ':' LDAP_FILTER",
-"ldapfilter_ad_hex : LDAPFILTER_AD_HEX ':' LDAP_FILTER",
-"ldapattribute : LDAPATTRIBUTE ':' LDAP_ATTRIBUTE",
-"ldapattribute_ad : LDAPATTRIBUTE_AD ':' LDAP_ATTRIBUTE",
-"ldapattribute_hex : LDAPATTRIBUTE_HEX ':' LDAP_ATTRIBUTE",
-"ldapattribute_ad_hex : LDAPATTRIBUTE_AD_HEX ':' LDAP_ATTRIBUTE",
-"lgroup_hex : LDAPGROUP_HEX ':' LDAPGROUP_NAME",
-"lgroup_hex_all : LDAPGROUP_HEX_ALL ':' LDAPGROUP_NAME",
-"lgroup : LDAPGROUP ':' LDAPGROUP_NAME",
-"lserver : LDAPSERVER ':' LDAPSERVER_NAME",
-"ldapkeytab : LDAPKEYTAB ':' LDAPKEYTABNAME",
-"clientcompatibility : CLIENTCOMPATIBILITY ':' clientcompatibilitynames",
-"clientcompatibilityname : NECGSSAPI",
-"clientcompatibilitynames : clientcompatibilityname",
-"clientcompatibilitynames : clientcompatibilityname clientcompatibilitynames",
-"verdict : VERDICT_BLOCK",
-"verdict : VERDICT_PASS",
-"command : COMMAND ':' commands",
-"commands : commandname",
-"commands : commandname commands",
-"commandname : COMMAND_BIND",
-"commandname : COMMAND_CONNECT",
-"commandname : COMMAND_UDPASSOCIATE",
-"commandname : COMMAND_BINDREPLY",
-"commandname : COMMAND_UDPREPLY",
-"protocol : PROTOCOL ':' protocols",
-"protocols : protocolname",
-"protocols : protocolname protocols",
-"protocolname : PROTOCOL_TCP",
-"protocolname : PROTOCOL_UDP",
-"fromto : srcaddress dstaddress",
-"hostid_fromto : hostid_srcaddress dstaddress",
-"redirect : REDIRECT rdr_fromaddress rdr_toaddress",
-"redirect : REDIRECT rdr_fromaddress",
-"redirect : REDIRECT rdr_toaddress",
-"sessionoption : sessionmax",
-"sessionoption : sessionthrottle",
-"sessionoption : sessionstate",
-"sockssessionoption : sessionoption",
-"crulesessionoption : sessioninheritable",
-"crulesessionoption : sessionoption",
-"sessioninheritable : SESSION_INHERITABLE ':' YES",
-"sessioninheritable : SESSION_INHERITABLE ':' NO",
-"sessionmax : SESSIONMAX ':' NUMBER",
-"sessionthrottle : SESSIONTHROTTLE ':' NUMBER '/' NUMBER",
-"sessionstate : sessionstate_key",
-"sessionstate : sessionstate_keyinfo",
-"sessionstate : sessionstate_throttle",
-"sessionstate : sessionstate_max",
-"sessionstate_key : SESSIONSTATE_KEY ':' STATEKEY",
-"$$24 :",
-"sessionstate_keyinfo : SESSIONSTATE_KEY '.' $$24 hostindex",
-"sessionstate_max : SESSIONSTATE_MAX ':' NUMBER",
-"sessionstate_throttle : SESSIONSTATE_THROTTLE ':' NUMBER '/' NUMBER",
-"bandwidth : BANDWIDTH ':' NUMBER",
-"log : RULE_LOG ':' logs",
-"logname : RULE_LOG_CONNECT",
-"logname : RULE_LOG_DATA",
-"logname : RULE_LOG_DISCONNECT",
-"logname : RULE_LOG_ERROR",
-"logname : RULE_LOG_IOOPERATION",
-"logname : RULE_LOG_TCPINFO",
-"logs : logname",
-"logs : logname logs",
-"pamservicename : PAMSERVICENAME ':' SERVICENAME",
-"bsdauthstylename : BSDAUTHSTYLE ':' BSDAUTHSTYLENAME",
-"gssapiservicename : GSSAPISERVICE ':' GSSAPISERVICENAME",
-"gssapikeytab : GSSAPIKEYTAB ':' GSSAPIKEYTABNAME",
-"gssapienctype : GSSAPIENCTYPE ':' gssapienctypes",
-"gssapienctypename : GSSAPIENC_ANY",
-"gssapienctypename : GSSAPIENC_CLEAR",
-"gssapienctypename : GSSAPIENC_INTEGRITY",
-"gssapienctypename : GSSAPIENC_CONFIDENTIALITY",
-"gssapienctypename : GSSAPIENC_PERMESSAGE",
-"gssapienctypes : gssapienctypename",
-"gssapienctypes : gssapienctypename gssapienctypes",
-"bounce : BOUNCE bounceto ':' bouncetoaddress",
-"libwrap : LIBWRAPSTART ':' LINE",
-"srcaddress : from ':' address",
-"hostid_srcaddress : from ':' address_without_port",
-"dstaddress : to ':' address",
-"rdr_fromaddress : rdr_from ':' address",
-"rdr_toaddress : rdr_to ':' address",
-"gateway : via ':' gwaddress",
-"routeoption : routemethod",
-"routeoption : command",
-"routeoption : clientcompatibility",
-"routeoption : extension",
-"routeoption : protocol",
-"routeoption : gssapiservicename",
-"routeoption : gssapikeytab",
-"routeoption : gssapienctype",
-"routeoption : proxyprotocol",
-"routeoption : REDIRECT rdr_fromaddress",
-"routeoption : socketoption",
-"routeoptions :",
-"routeoptions : routeoption routeoptions",
-"routemethod : METHOD ':' socksmethods",
-"from : FROM",
-"to : TO",
-"rdr_from : FROM",
-"rdr_to : TO",
-"bounceto : TO",
-"via : VIA",
-"externaladdress : ipv4",
-"externaladdress : ipv6",
-"externaladdress : domain",
-"externaladdress : ifname",
-"address_without_port : ipaddress",
-"address_without_port : domain",
-"address_without_port : ifname",
-"address : address_without_port port",
-"ipaddress : ipv4 '/' netmask_v4",
-"ipaddress : ipv4",
-"ipaddress : ipv6 '/' netmask_v6",
-"ipaddress : ipv6",
-"ipaddress : ipvany '/' netmask_vany",
-"ipaddress : ipvany",
-"gwaddress : ipaddress gwport",
-"gwaddress : domain gwport",
-"gwaddress : ifname",
-"gwaddress : url",
-"bouncetoaddress : ipaddress gwport",
-"bouncetoaddress : domain gwport",
-"ipv4 : IPV4",
-"netmask_v4 : NUMBER",
-"netmask_v4 : IPV4",
-"ipv6 : IPV6",
-"netmask_v6 : NUMBER",
-"ipvany : IPVANY",
-"netmask_vany : NUMBER",
-"domain : DOMAINNAME",
-"ifname : IFNAME",
-"url : URL",
-"port :",
-"port : PORT ':' portnumber",
-"port : PORT portoperator portnumber",
-"port : PORT portrange",
-"gwport :",
-"gwport : PORT portoperator portnumber",
-"portnumber : portservice",
-"portnumber : portstart",
-"portrange : portstart '-' portend",
-"portstart : NUMBER",
-"portend : NUMBER",
-"portservice : SERVICENAME",
-"portoperator : OPERATOR",
-"udpportrange : UDPPORTRANGE ':' udpportrange_start '-' udpportrange_end",
-"udpportrange_start : NUMBER",
-"udpportrange_end : NUMBER",
-"number : NUMBER",
-"numbers : number",
-"numbers : number numbers",
+
+
+extern YYSTYPE socks_yylval;
+
+
+int socks_yyparse (void);
+
+
+#endif /* !YY_SOCKS_YY_Y_TAB_H_INCLUDED  */
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_ALARM = 3,                      /* ALARM  */
+  YYSYMBOL_ALARMTYPE_DATA = 4,             /* ALARMTYPE_DATA  */
+  YYSYMBOL_ALARMTYPE_DISCONNECT = 5,       /* ALARMTYPE_DISCONNECT  */
+  YYSYMBOL_ALARMIF_INTERNAL = 6,           /* ALARMIF_INTERNAL  */
+  YYSYMBOL_ALARMIF_EXTERNAL = 7,           /* ALARMIF_EXTERNAL  */
+  YYSYMBOL_TCPOPTION_DISABLED = 8,         /* TCPOPTION_DISABLED  */
+  YYSYMBOL_ECN = 9,                        /* ECN  */
+  YYSYMBOL_SACK = 10,                      /* SACK  */
+  YYSYMBOL_TIMESTAMPS = 11,                /* TIMESTAMPS  */
+  YYSYMBOL_WSCALE = 12,                    /* WSCALE  */
+  YYSYMBOL_MTU_ERROR = 13,                 /* MTU_ERROR  */
+  YYSYMBOL_CLIENTCOMPATIBILITY = 14,       /* CLIENTCOMPATIBILITY  */
+  YYSYMBOL_NECGSSAPI = 15,                 /* NECGSSAPI  */
+  YYSYMBOL_CLIENTRULE = 16,                /* CLIENTRULE  */
+  YYSYMBOL_HOSTIDRULE = 17,                /* HOSTIDRULE  */
+  YYSYMBOL_SOCKSRULE = 18,                 /* SOCKSRULE  */
+  YYSYMBOL_COMPATIBILITY = 19,             /* COMPATIBILITY  */
+  YYSYMBOL_SAMEPORT = 20,                  /* SAMEPORT  */
+  YYSYMBOL_DRAFT_5_05 = 21,                /* DRAFT_5_05  */
+  YYSYMBOL_CONNECTTIMEOUT = 22,            /* CONNECTTIMEOUT  */
+  YYSYMBOL_TCP_FIN_WAIT = 23,              /* TCP_FIN_WAIT  */
+  YYSYMBOL_CPU = 24,                       /* CPU  */
+  YYSYMBOL_MASK = 25,                      /* MASK  */
+  YYSYMBOL_SCHEDULE = 26,                  /* SCHEDULE  */
+  YYSYMBOL_CPUMASK_ANYCPU = 27,            /* CPUMASK_ANYCPU  */
+  YYSYMBOL_CPUMASK_PERCPU = 28,            /* CPUMASK_PERCPU  */
+  YYSYMBOL_DEBUGGING = 29,                 /* DEBUGGING  */
+  YYSYMBOL_DEPRECATED = 30,                /* DEPRECATED  */
+  YYSYMBOL_ERRORLOG = 31,                  /* ERRORLOG  */
+  YYSYMBOL_LOGOUTPUT = 32,                 /* LOGOUTPUT  */
+  YYSYMBOL_LOGFILE = 33,                   /* LOGFILE  */
+  YYSYMBOL_LOGTYPE_ERROR = 34,             /* LOGTYPE_ERROR  */
+  YYSYMBOL_LOGTYPE_TCP_DISABLED = 35,      /* LOGTYPE_TCP_DISABLED  */
+  YYSYMBOL_LOGTYPE_TCP_ENABLED = 36,       /* LOGTYPE_TCP_ENABLED  */
+  YYSYMBOL_LOGIF_INTERNAL = 37,            /* LOGIF_INTERNAL  */
+  YYSYMBOL_LOGIF_EXTERNAL = 38,            /* LOGIF_EXTERNAL  */
+  YYSYMBOL_ERRORVALUE = 39,                /* ERRORVALUE  */
+  YYSYMBOL_EXTENSION = 40,                 /* EXTENSION  */
+  YYSYMBOL_BIND = 41,                      /* BIND  */
+  YYSYMBOL_PRIVILEGED = 42,                /* PRIVILEGED  */
+  YYSYMBOL_EXTERNAL_PROTOCOL = 43,         /* EXTERNAL_PROTOCOL  */
+  YYSYMBOL_INTERNAL_PROTOCOL = 44,         /* INTERNAL_PROTOCOL  */
+  YYSYMBOL_EXTERNAL_ROTATION = 45,         /* EXTERNAL_ROTATION  */
+  YYSYMBOL_SAMESAME = 46,                  /* SAMESAME  */
+  YYSYMBOL_GROUPNAME = 47,                 /* GROUPNAME  */
+  YYSYMBOL_HOSTID = 48,                    /* HOSTID  */
+  YYSYMBOL_HOSTINDEX = 49,                 /* HOSTINDEX  */
+  YYSYMBOL_INTERFACE = 50,                 /* INTERFACE  */
+  YYSYMBOL_SOCKETOPTION_SYMBOLICVALUE = 51, /* SOCKETOPTION_SYMBOLICVALUE  */
+  YYSYMBOL_INTERNAL = 52,                  /* INTERNAL  */
+  YYSYMBOL_EXTERNAL = 53,                  /* EXTERNAL  */
+  YYSYMBOL_INTERNALSOCKET = 54,            /* INTERNALSOCKET  */
+  YYSYMBOL_EXTERNALSOCKET = 55,            /* EXTERNALSOCKET  */
+  YYSYMBOL_IOTIMEOUT = 56,                 /* IOTIMEOUT  */
+  YYSYMBOL_IOTIMEOUT_TCP = 57,             /* IOTIMEOUT_TCP  */
+  YYSYMBOL_IOTIMEOUT_UDP = 58,             /* IOTIMEOUT_UDP  */
+  YYSYMBOL_NEGOTIATETIMEOUT = 59,          /* NEGOTIATETIMEOUT  */
+  YYSYMBOL_LIBWRAP_FILE = 60,              /* LIBWRAP_FILE  */
+  YYSYMBOL_LOGLEVEL = 61,                  /* LOGLEVEL  */
+  YYSYMBOL_SOCKSMETHOD = 62,               /* SOCKSMETHOD  */
+  YYSYMBOL_CLIENTMETHOD = 63,              /* CLIENTMETHOD  */
+  YYSYMBOL_METHOD = 64,                    /* METHOD  */
+  YYSYMBOL_METHODNAME = 65,                /* METHODNAME  */
+  YYSYMBOL_NONE = 66,                      /* NONE  */
+  YYSYMBOL_BSDAUTH = 67,                   /* BSDAUTH  */
+  YYSYMBOL_GSSAPI = 68,                    /* GSSAPI  */
+  YYSYMBOL_PAM_ADDRESS = 69,               /* PAM_ADDRESS  */
+  YYSYMBOL_PAM_ANY = 70,                   /* PAM_ANY  */
+  YYSYMBOL_PAM_USERNAME = 71,              /* PAM_USERNAME  */
+  YYSYMBOL_RFC931 = 72,                    /* RFC931  */
+  YYSYMBOL_UNAME = 73,                     /* UNAME  */
+  YYSYMBOL_MONITOR = 74,                   /* MONITOR  */
+  YYSYMBOL_PROCESSTYPE = 75,               /* PROCESSTYPE  */
+  YYSYMBOL_PROC_MAXREQUESTS = 76,          /* PROC_MAXREQUESTS  */
+  YYSYMBOL_PROC_MAXCLIENTS_NEGOTIATE = 77, /* PROC_MAXCLIENTS_NEGOTIATE  */
+  YYSYMBOL_PROC_MAXCLIENTS_IO = 78,        /* PROC_MAXCLIENTS_IO  */
+  YYSYMBOL_PROC_MAXCLIENTS_REQUEST = 79,   /* PROC_MAXCLIENTS_REQUEST  */
+  YYSYMBOL_PROC_REUSEPORT = 80,            /* PROC_REUSEPORT  */
+  YYSYMBOL_PROC_ALLINONE = 81,             /* PROC_ALLINONE  */
+  YYSYMBOL_HOSTCACHE_ENTRIES = 82,         /* HOSTCACHE_ENTRIES  */
+  YYSYMBOL_HOSTCACHE_TTL_MIN = 83,         /* HOSTCACHE_TTL_MIN  */
+  YYSYMBOL_HOSTCACHE_TTL_MAX = 84,         /* HOSTCACHE_TTL_MAX  */
+  YYSYMBOL_HAPPYEYEBALLS_DELAY = 85,       /* HAPPYEYEBALLS_DELAY  */
+  YYSYMBOL_REALM = 86,                     /* REALM  */
+  YYSYMBOL_REALNAME = 87,                  /* REALNAME  */
+  YYSYMBOL_RESOLVEPROTOCOL = 88,           /* RESOLVEPROTOCOL  */
+  YYSYMBOL_REQUIRED = 89,                  /* REQUIRED  */
+  YYSYMBOL_SCHEDULEPOLICY = 90,            /* SCHEDULEPOLICY  */
+  YYSYMBOL_SERVERCONFIG = 91,              /* SERVERCONFIG  */
+  YYSYMBOL_CLIENTCONFIG = 92,              /* CLIENTCONFIG  */
+  YYSYMBOL_SOCKET = 93,                    /* SOCKET  */
+  YYSYMBOL_CLIENTSIDE_SOCKET = 94,         /* CLIENTSIDE_SOCKET  */
+  YYSYMBOL_SNDBUF = 95,                    /* SNDBUF  */
+  YYSYMBOL_RCVBUF = 96,                    /* RCVBUF  */
+  YYSYMBOL_SOCKETPROTOCOL = 97,            /* SOCKETPROTOCOL  */
+  YYSYMBOL_SOCKETOPTION_OPTID = 98,        /* SOCKETOPTION_OPTID  */
+  YYSYMBOL_SRCHOST = 99,                   /* SRCHOST  */
+  YYSYMBOL_NODNSMISMATCH = 100,            /* NODNSMISMATCH  */
+  YYSYMBOL_NODNSUNKNOWN = 101,             /* NODNSUNKNOWN  */
+  YYSYMBOL_CHECKREPLYAUTH = 102,           /* CHECKREPLYAUTH  */
+  YYSYMBOL_USERNAME = 103,                 /* USERNAME  */
+  YYSYMBOL_USER_PRIVILEGED = 104,          /* USER_PRIVILEGED  */
+  YYSYMBOL_USER_UNPRIVILEGED = 105,        /* USER_UNPRIVILEGED  */
+  YYSYMBOL_USER_LIBWRAP = 106,             /* USER_LIBWRAP  */
+  YYSYMBOL_WORD__IN = 107,                 /* WORD__IN  */
+  YYSYMBOL_ROUTE = 108,                    /* ROUTE  */
+  YYSYMBOL_VIA = 109,                      /* VIA  */
+  YYSYMBOL_GLOBALROUTEOPTION = 110,        /* GLOBALROUTEOPTION  */
+  YYSYMBOL_BADROUTE_EXPIRE = 111,          /* BADROUTE_EXPIRE  */
+  YYSYMBOL_MAXFAIL = 112,                  /* MAXFAIL  */
+  YYSYMBOL_ROUTE_WEIGHT = 113,             /* ROUTE_WEIGHT  */
+  YYSYMBOL_PORT = 114,                     /* PORT  */
+  YYSYMBOL_NUMBER = 115,                   /* NUMBER  */
+  YYSYMBOL_BANDWIDTH = 116,                /* BANDWIDTH  */
+  YYSYMBOL_BOUNCE = 117,                   /* BOUNCE  */
+  YYSYMBOL_BSDAUTHSTYLE = 118,             /* BSDAUTHSTYLE  */
+  YYSYMBOL_BSDAUTHSTYLENAME = 119,         /* BSDAUTHSTYLENAME  */
+  YYSYMBOL_COMMAND = 120,                  /* COMMAND  */
+  YYSYMBOL_COMMAND_BIND = 121,             /* COMMAND_BIND  */
+  YYSYMBOL_COMMAND_CONNECT = 122,          /* COMMAND_CONNECT  */
+  YYSYMBOL_COMMAND_UDPASSOCIATE = 123,     /* COMMAND_UDPASSOCIATE  */
+  YYSYMBOL_COMMAND_BINDREPLY = 124,        /* COMMAND_BINDREPLY  */
+  YYSYMBOL_COMMAND_UDPREPLY = 125,         /* COMMAND_UDPREPLY  */
+  YYSYMBOL_ACTION = 126,                   /* ACTION  */
+  YYSYMBOL_FROM = 127,                     /* FROM  */
+  YYSYMBOL_TO = 128,                       /* TO  */
+  YYSYMBOL_GSSAPIENCTYPE = 129,            /* GSSAPIENCTYPE  */
+  YYSYMBOL_GSSAPIENC_ANY = 130,            /* GSSAPIENC_ANY  */
+  YYSYMBOL_GSSAPIENC_CLEAR = 131,          /* GSSAPIENC_CLEAR  */
+  YYSYMBOL_GSSAPIENC_INTEGRITY = 132,      /* GSSAPIENC_INTEGRITY  */
+  YYSYMBOL_GSSAPIENC_CONFIDENTIALITY = 133, /* GSSAPIENC_CONFIDENTIALITY  */
+  YYSYMBOL_GSSAPIENC_PERMESSAGE = 134,     /* GSSAPIENC_PERMESSAGE  */
+  YYSYMBOL_GSSAPIKEYTAB = 135,             /* GSSAPIKEYTAB  */
+  YYSYMBOL_GSSAPISERVICE = 136,            /* GSSAPISERVICE  */
+  YYSYMBOL_GSSAPISERVICENAME = 137,        /* GSSAPISERVICENAME  */
+  YYSYMBOL_GSSAPIKEYTABNAME = 138,         /* GSSAPIKEYTABNAME  */
+  YYSYMBOL_IPV4 = 139,                     /* IPV4  */
+  YYSYMBOL_IPV6 = 140,                     /* IPV6  */
+  YYSYMBOL_IPVANY = 141,                   /* IPVANY  */
+  YYSYMBOL_DOMAINNAME = 142,               /* DOMAINNAME  */
+  YYSYMBOL_IFNAME = 143,                   /* IFNAME  */
+  YYSYMBOL_URL = 144,                      /* URL  */
+  YYSYMBOL_LDAPATTRIBUTE = 145,            /* LDAPATTRIBUTE  */
+  YYSYMBOL_LDAPATTRIBUTE_AD = 146,         /* LDAPATTRIBUTE_AD  */
+  YYSYMBOL_LDAPATTRIBUTE_HEX = 147,        /* LDAPATTRIBUTE_HEX  */
+  YYSYMBOL_LDAPATTRIBUTE_AD_HEX = 148,     /* LDAPATTRIBUTE_AD_HEX  */
+  YYSYMBOL_LDAPBASEDN = 149,               /* LDAPBASEDN  */
+  YYSYMBOL_LDAP_BASEDN = 150,              /* LDAP_BASEDN  */
+  YYSYMBOL_LDAPBASEDN_HEX = 151,           /* LDAPBASEDN_HEX  */
+  YYSYMBOL_LDAPBASEDN_HEX_ALL = 152,       /* LDAPBASEDN_HEX_ALL  */
+  YYSYMBOL_LDAPCERTFILE = 153,             /* LDAPCERTFILE  */
+  YYSYMBOL_LDAPCERTPATH = 154,             /* LDAPCERTPATH  */
+  YYSYMBOL_LDAPPORT = 155,                 /* LDAPPORT  */
+  YYSYMBOL_LDAPPORTSSL = 156,              /* LDAPPORTSSL  */
+  YYSYMBOL_LDAPDEBUG = 157,                /* LDAPDEBUG  */
+  YYSYMBOL_LDAPDEPTH = 158,                /* LDAPDEPTH  */
+  YYSYMBOL_LDAPAUTO = 159,                 /* LDAPAUTO  */
+  YYSYMBOL_LDAPSEARCHTIME = 160,           /* LDAPSEARCHTIME  */
+  YYSYMBOL_LDAPDOMAIN = 161,               /* LDAPDOMAIN  */
+  YYSYMBOL_LDAP_DOMAIN = 162,              /* LDAP_DOMAIN  */
+  YYSYMBOL_LDAPFILTER = 163,               /* LDAPFILTER  */
+  YYSYMBOL_LDAPFILTER_AD = 164,            /* LDAPFILTER_AD  */
+  YYSYMBOL_LDAPFILTER_HEX = 165,           /* LDAPFILTER_HEX  */
+  YYSYMBOL_LDAPFILTER_AD_HEX = 166,        /* LDAPFILTER_AD_HEX  */
+  YYSYMBOL_LDAPGROUP = 167,                /* LDAPGROUP  */
+  YYSYMBOL_LDAPGROUP_NAME = 168,           /* LDAPGROUP_NAME  */
+  YYSYMBOL_LDAPGROUP_HEX = 169,            /* LDAPGROUP_HEX  */
+  YYSYMBOL_LDAPGROUP_HEX_ALL = 170,        /* LDAPGROUP_HEX_ALL  */
+  YYSYMBOL_LDAPKEYTAB = 171,               /* LDAPKEYTAB  */
+  YYSYMBOL_LDAPKEYTABNAME = 172,           /* LDAPKEYTABNAME  */
+  YYSYMBOL_LDAPDEADTIME = 173,             /* LDAPDEADTIME  */
+  YYSYMBOL_LDAPSERVER = 174,               /* LDAPSERVER  */
+  YYSYMBOL_LDAPSERVER_NAME = 175,          /* LDAPSERVER_NAME  */
+  YYSYMBOL_LDAPSSL = 176,                  /* LDAPSSL  */
+  YYSYMBOL_LDAPCERTCHECK = 177,            /* LDAPCERTCHECK  */
+  YYSYMBOL_LDAPKEEPREALM = 178,            /* LDAPKEEPREALM  */
+  YYSYMBOL_LDAPTIMEOUT = 179,              /* LDAPTIMEOUT  */
+  YYSYMBOL_LDAPCACHE = 180,                /* LDAPCACHE  */
+  YYSYMBOL_LDAPCACHEPOS = 181,             /* LDAPCACHEPOS  */
+  YYSYMBOL_LDAPCACHENEG = 182,             /* LDAPCACHENEG  */
+  YYSYMBOL_LDAPURL = 183,                  /* LDAPURL  */
+  YYSYMBOL_LDAP_URL = 184,                 /* LDAP_URL  */
+  YYSYMBOL_LDAP_FILTER = 185,              /* LDAP_FILTER  */
+  YYSYMBOL_LDAP_ATTRIBUTE = 186,           /* LDAP_ATTRIBUTE  */
+  YYSYMBOL_LDAP_CERTFILE = 187,            /* LDAP_CERTFILE  */
+  YYSYMBOL_LDAP_CERTPATH = 188,            /* LDAP_CERTPATH  */
+  YYSYMBOL_LIBWRAPSTART = 189,             /* LIBWRAPSTART  */
+  YYSYMBOL_LIBWRAP_ALLOW = 190,            /* LIBWRAP_ALLOW  */
+  YYSYMBOL_LIBWRAP_DENY = 191,             /* LIBWRAP_DENY  */
+  YYSYMBOL_LIBWRAP_HOSTS_ACCESS = 192,     /* LIBWRAP_HOSTS_ACCESS  */
+  YYSYMBOL_LINE = 193,                     /* LINE  */
+  YYSYMBOL_OPERATOR = 194,                 /* OPERATOR  */
+  YYSYMBOL_PAMSERVICENAME = 195,           /* PAMSERVICENAME  */
+  YYSYMBOL_PROTOCOL = 196,                 /* PROTOCOL  */
+  YYSYMBOL_PROTOCOL_TCP = 197,             /* PROTOCOL_TCP  */
+  YYSYMBOL_PROTOCOL_UDP = 198,             /* PROTOCOL_UDP  */
+  YYSYMBOL_PROTOCOL_FAKE = 199,            /* PROTOCOL_FAKE  */
+  YYSYMBOL_PROXYPROTOCOL = 200,            /* PROXYPROTOCOL  */
+  YYSYMBOL_PROXYPROTOCOL_SOCKS_V4 = 201,   /* PROXYPROTOCOL_SOCKS_V4  */
+  YYSYMBOL_PROXYPROTOCOL_SOCKS_V5 = 202,   /* PROXYPROTOCOL_SOCKS_V5  */
+  YYSYMBOL_PROXYPROTOCOL_HTTP = 203,       /* PROXYPROTOCOL_HTTP  */
+  YYSYMBOL_PROXYPROTOCOL_UPNP = 204,       /* PROXYPROTOCOL_UPNP  */
+  YYSYMBOL_REDIRECT = 205,                 /* REDIRECT  */
+  YYSYMBOL_SENDSIDE = 206,                 /* SENDSIDE  */
+  YYSYMBOL_RECVSIDE = 207,                 /* RECVSIDE  */
+  YYSYMBOL_SERVICENAME = 208,              /* SERVICENAME  */
+  YYSYMBOL_SESSION_INHERITABLE = 209,      /* SESSION_INHERITABLE  */
+  YYSYMBOL_SESSIONMAX = 210,               /* SESSIONMAX  */
+  YYSYMBOL_SESSIONTHROTTLE = 211,          /* SESSIONTHROTTLE  */
+  YYSYMBOL_SESSIONSTATE_KEY = 212,         /* SESSIONSTATE_KEY  */
+  YYSYMBOL_SESSIONSTATE_MAX = 213,         /* SESSIONSTATE_MAX  */
+  YYSYMBOL_SESSIONSTATE_THROTTLE = 214,    /* SESSIONSTATE_THROTTLE  */
+  YYSYMBOL_RULE_LOG = 215,                 /* RULE_LOG  */
+  YYSYMBOL_RULE_LOG_CONNECT = 216,         /* RULE_LOG_CONNECT  */
+  YYSYMBOL_RULE_LOG_DATA = 217,            /* RULE_LOG_DATA  */
+  YYSYMBOL_RULE_LOG_DISCONNECT = 218,      /* RULE_LOG_DISCONNECT  */
+  YYSYMBOL_RULE_LOG_ERROR = 219,           /* RULE_LOG_ERROR  */
+  YYSYMBOL_RULE_LOG_IOOPERATION = 220,     /* RULE_LOG_IOOPERATION  */
+  YYSYMBOL_RULE_LOG_TCPINFO = 221,         /* RULE_LOG_TCPINFO  */
+  YYSYMBOL_STATEKEY = 222,                 /* STATEKEY  */
+  YYSYMBOL_UDPPORTRANGE = 223,             /* UDPPORTRANGE  */
+  YYSYMBOL_UDPCONNECTDST = 224,            /* UDPCONNECTDST  */
+  YYSYMBOL_USER = 225,                     /* USER  */
+  YYSYMBOL_GROUP = 226,                    /* GROUP  */
+  YYSYMBOL_VERDICT_BLOCK = 227,            /* VERDICT_BLOCK  */
+  YYSYMBOL_VERDICT_PASS = 228,             /* VERDICT_PASS  */
+  YYSYMBOL_YES = 229,                      /* YES  */
+  YYSYMBOL_NO = 230,                       /* NO  */
+  YYSYMBOL_231_ = 231,                     /* ':'  */
+  YYSYMBOL_232_ = 232,                     /* '.'  */
+  YYSYMBOL_233_ = 233,                     /* '{'  */
+  YYSYMBOL_234_ = 234,                     /* '}'  */
+  YYSYMBOL_235_ = 235,                     /* '/'  */
+  YYSYMBOL_236_ = 236,                     /* '-'  */
+  YYSYMBOL_YYACCEPT = 237,                 /* $accept  */
+  YYSYMBOL_configtype = 238,               /* configtype  */
+  YYSYMBOL_239_1 = 239,                    /* $@1  */
+  YYSYMBOL_serverobjects = 240,            /* serverobjects  */
+  YYSYMBOL_serverobject = 241,             /* serverobject  */
+  YYSYMBOL_serveroptions = 242,            /* serveroptions  */
+  YYSYMBOL_serveroption = 243,             /* serveroption  */
+  YYSYMBOL_logspecial = 244,               /* logspecial  */
+  YYSYMBOL_245_2 = 245,                    /* $@2  */
+  YYSYMBOL_246_3 = 246,                    /* $@3  */
+  YYSYMBOL_internal_if_logoption = 247,    /* internal_if_logoption  */
+  YYSYMBOL_248_4 = 248,                    /* $@4  */
+  YYSYMBOL_external_if_logoption = 249,    /* external_if_logoption  */
+  YYSYMBOL_250_5 = 250,                    /* $@5  */
+  YYSYMBOL_rule_internal_logoption = 251,  /* rule_internal_logoption  */
+  YYSYMBOL_252_6 = 252,                    /* $@6  */
+  YYSYMBOL_rule_external_logoption = 253,  /* rule_external_logoption  */
+  YYSYMBOL_254_7 = 254,                    /* $@7  */
+  YYSYMBOL_loglevel = 255,                 /* loglevel  */
+  YYSYMBOL_tcpoptions = 256,               /* tcpoptions  */
+  YYSYMBOL_tcpoption = 257,                /* tcpoption  */
+  YYSYMBOL_errors = 258,                   /* errors  */
+  YYSYMBOL_errorobject = 259,              /* errorobject  */
+  YYSYMBOL_timeout = 260,                  /* timeout  */
+  YYSYMBOL_deprecated = 261,               /* deprecated  */
+  YYSYMBOL_route = 262,                    /* route  */
+  YYSYMBOL_263_8 = 263,                    /* $@8  */
+  YYSYMBOL_264_9 = 264,                    /* $@9  */
+  YYSYMBOL_routes = 265,                   /* routes  */
+  YYSYMBOL_proxyprotocol = 266,            /* proxyprotocol  */
+  YYSYMBOL_proxyprotocolname = 267,        /* proxyprotocolname  */
+  YYSYMBOL_proxyprotocols = 268,           /* proxyprotocols  */
+  YYSYMBOL_user = 269,                     /* user  */
+  YYSYMBOL_username = 270,                 /* username  */
+  YYSYMBOL_usernames = 271,                /* usernames  */
+  YYSYMBOL_group = 272,                    /* group  */
+  YYSYMBOL_groupname = 273,                /* groupname  */
+  YYSYMBOL_groupnames = 274,               /* groupnames  */
+  YYSYMBOL_extension = 275,                /* extension  */
+  YYSYMBOL_extensionname = 276,            /* extensionname  */
+  YYSYMBOL_extensions = 277,               /* extensions  */
+  YYSYMBOL_ifprotocols = 278,              /* ifprotocols  */
+  YYSYMBOL_ifprotocol = 279,               /* ifprotocol  */
+  YYSYMBOL_internal = 280,                 /* internal  */
+  YYSYMBOL_internalinit = 281,             /* internalinit  */
+  YYSYMBOL_internal_protocol = 282,        /* internal_protocol  */
+  YYSYMBOL_283_10 = 283,                   /* $@10  */
+  YYSYMBOL_external = 284,                 /* external  */
+  YYSYMBOL_externalinit = 285,             /* externalinit  */
+  YYSYMBOL_external_protocol = 286,        /* external_protocol  */
+  YYSYMBOL_287_11 = 287,                   /* $@11  */
+  YYSYMBOL_external_rotation = 288,        /* external_rotation  */
+  YYSYMBOL_clientoption = 289,             /* clientoption  */
+  YYSYMBOL_clientoptions = 290,            /* clientoptions  */
+  YYSYMBOL_global_routeoption = 291,       /* global_routeoption  */
+  YYSYMBOL_errorlog = 292,                 /* errorlog  */
+  YYSYMBOL_293_12 = 293,                   /* $@12  */
+  YYSYMBOL_logoutput = 294,                /* logoutput  */
+  YYSYMBOL_295_13 = 295,                   /* $@13  */
+  YYSYMBOL_logoutputdevice = 296,          /* logoutputdevice  */
+  YYSYMBOL_logoutputdevices = 297,         /* logoutputdevices  */
+  YYSYMBOL_childstate = 298,               /* childstate  */
+  YYSYMBOL_hostcache = 299,                /* hostcache  */
+  YYSYMBOL_happyeyeballs = 300,            /* happyeyeballs  */
+  YYSYMBOL_userids = 301,                  /* userids  */
+  YYSYMBOL_user_privileged = 302,          /* user_privileged  */
+  YYSYMBOL_user_unprivileged = 303,        /* user_unprivileged  */
+  YYSYMBOL_user_libwrap = 304,             /* user_libwrap  */
+  YYSYMBOL_userid = 305,                   /* userid  */
+  YYSYMBOL_iotimeout = 306,                /* iotimeout  */
+  YYSYMBOL_negotiatetimeout = 307,         /* negotiatetimeout  */
+  YYSYMBOL_connecttimeout = 308,           /* connecttimeout  */
+  YYSYMBOL_tcp_fin_timeout = 309,          /* tcp_fin_timeout  */
+  YYSYMBOL_debugging = 310,                /* debugging  */
+  YYSYMBOL_libwrapfiles = 311,             /* libwrapfiles  */
+  YYSYMBOL_libwrap_allowfile = 312,        /* libwrap_allowfile  */
+  YYSYMBOL_libwrap_denyfile = 313,         /* libwrap_denyfile  */
+  YYSYMBOL_libwrap_hosts_access = 314,     /* libwrap_hosts_access  */
+  YYSYMBOL_udpconnectdst = 315,            /* udpconnectdst  */
+  YYSYMBOL_compatibility = 316,            /* compatibility  */
+  YYSYMBOL_compatibilityname = 317,        /* compatibilityname  */
+  YYSYMBOL_compatibilitynames = 318,       /* compatibilitynames  */
+  YYSYMBOL_resolveprotocol = 319,          /* resolveprotocol  */
+  YYSYMBOL_resolveprotocolname = 320,      /* resolveprotocolname  */
+  YYSYMBOL_cpu = 321,                      /* cpu  */
+  YYSYMBOL_cpuschedule = 322,              /* cpuschedule  */
+  YYSYMBOL_cpuaffinity = 323,              /* cpuaffinity  */
+  YYSYMBOL_socketoption = 324,             /* socketoption  */
+  YYSYMBOL_325_14 = 325,                   /* $@14  */
+  YYSYMBOL_socketoptionname = 326,         /* socketoptionname  */
+  YYSYMBOL_socketoptionvalue = 327,        /* socketoptionvalue  */
+  YYSYMBOL_socketside = 328,               /* socketside  */
+  YYSYMBOL_srchost = 329,                  /* srchost  */
+  YYSYMBOL_srchostoption = 330,            /* srchostoption  */
+  YYSYMBOL_srchostoptions = 331,           /* srchostoptions  */
+  YYSYMBOL_realm = 332,                    /* realm  */
+  YYSYMBOL_global_clientmethod = 333,      /* global_clientmethod  */
+  YYSYMBOL_334_15 = 334,                   /* $@15  */
+  YYSYMBOL_global_socksmethod = 335,       /* global_socksmethod  */
+  YYSYMBOL_336_16 = 336,                   /* $@16  */
+  YYSYMBOL_socksmethod = 337,              /* socksmethod  */
+  YYSYMBOL_socksmethods = 338,             /* socksmethods  */
+  YYSYMBOL_socksmethodname = 339,          /* socksmethodname  */
+  YYSYMBOL_clientmethod = 340,             /* clientmethod  */
+  YYSYMBOL_clientmethods = 341,            /* clientmethods  */
+  YYSYMBOL_clientmethodname = 342,         /* clientmethodname  */
+  YYSYMBOL_monitor = 343,                  /* monitor  */
+  YYSYMBOL_344_17 = 344,                   /* $@17  */
+  YYSYMBOL_345_18 = 345,                   /* $@18  */
+  YYSYMBOL_crule = 346,                    /* crule  */
+  YYSYMBOL_347_19 = 347,                   /* $@19  */
+  YYSYMBOL_alarm = 348,                    /* alarm  */
+  YYSYMBOL_monitorside = 349,              /* monitorside  */
+  YYSYMBOL_alarmside = 350,                /* alarmside  */
+  YYSYMBOL_alarm_data = 351,               /* alarm_data  */
+  YYSYMBOL_352_20 = 352,                   /* $@20  */
+  YYSYMBOL_alarm_test = 353,               /* alarm_test  */
+  YYSYMBOL_networkproblem = 354,           /* networkproblem  */
+  YYSYMBOL_alarm_disconnect = 355,         /* alarm_disconnect  */
+  YYSYMBOL_alarmperiod = 356,              /* alarmperiod  */
+  YYSYMBOL_monitoroption = 357,            /* monitoroption  */
+  YYSYMBOL_monitoroptions = 358,           /* monitoroptions  */
+  YYSYMBOL_cruleoption = 359,              /* cruleoption  */
+  YYSYMBOL_hrule = 360,                    /* hrule  */
+  YYSYMBOL_361_21 = 361,                   /* $@21  */
+  YYSYMBOL_cruleoptions = 362,             /* cruleoptions  */
+  YYSYMBOL_hostidoption = 363,             /* hostidoption  */
+  YYSYMBOL_hostid = 364,                   /* hostid  */
+  YYSYMBOL_365_22 = 365,                   /* $@22  */
+  YYSYMBOL_hostindex = 366,                /* hostindex  */
+  YYSYMBOL_srule = 367,                    /* srule  */
+  YYSYMBOL_368_23 = 368,                   /* $@23  */
+  YYSYMBOL_sruleoptions = 369,             /* sruleoptions  */
+  YYSYMBOL_sruleoption = 370,              /* sruleoption  */
+  YYSYMBOL_genericruleoption = 371,        /* genericruleoption  */
+  YYSYMBOL_ldapoption = 372,               /* ldapoption  */
+  YYSYMBOL_ldapdebug = 373,                /* ldapdebug  */
+  YYSYMBOL_ldapdomain = 374,               /* ldapdomain  */
+  YYSYMBOL_ldapdepth = 375,                /* ldapdepth  */
+  YYSYMBOL_ldapcertfile = 376,             /* ldapcertfile  */
+  YYSYMBOL_ldapcertpath = 377,             /* ldapcertpath  */
+  YYSYMBOL_lurl = 378,                     /* lurl  */
+  YYSYMBOL_lbasedn = 379,                  /* lbasedn  */
+  YYSYMBOL_lbasedn_hex = 380,              /* lbasedn_hex  */
+  YYSYMBOL_lbasedn_hex_all = 381,          /* lbasedn_hex_all  */
+  YYSYMBOL_ldapport = 382,                 /* ldapport  */
+  YYSYMBOL_ldapportssl = 383,              /* ldapportssl  */
+  YYSYMBOL_ldapssl = 384,                  /* ldapssl  */
+  YYSYMBOL_ldapauto = 385,                 /* ldapauto  */
+  YYSYMBOL_ldapcertcheck = 386,            /* ldapcertcheck  */
+  YYSYMBOL_ldapkeeprealm = 387,            /* ldapkeeprealm  */
+  YYSYMBOL_ldapfilter = 388,               /* ldapfilter  */
+  YYSYMBOL_ldapfilter_ad = 389,            /* ldapfilter_ad  */
+  YYSYMBOL_ldapfilter_hex = 390,           /* ldapfilter_hex  */
+  YYSYMBOL_ldapfilter_ad_hex = 391,        /* ldapfilter_ad_hex  */
+  YYSYMBOL_ldapattribute = 392,            /* ldapattribute  */
+  YYSYMBOL_ldapattribute_ad = 393,         /* ldapattribute_ad  */
+  YYSYMBOL_ldapattribute_hex = 394,        /* ldapattribute_hex  */
+  YYSYMBOL_ldapattribute_ad_hex = 395,     /* ldapattribute_ad_hex  */
+  YYSYMBOL_lgroup_hex = 396,               /* lgroup_hex  */
+  YYSYMBOL_lgroup_hex_all = 397,           /* lgroup_hex_all  */
+  YYSYMBOL_lgroup = 398,                   /* lgroup  */
+  YYSYMBOL_lserver = 399,                  /* lserver  */
+  YYSYMBOL_ldapkeytab = 400,               /* ldapkeytab  */
+  YYSYMBOL_clientcompatibility = 401,      /* clientcompatibility  */
+  YYSYMBOL_clientcompatibilityname = 402,  /* clientcompatibilityname  */
+  YYSYMBOL_clientcompatibilitynames = 403, /* clientcompatibilitynames  */
+  YYSYMBOL_verdict = 404,                  /* verdict  */
+  YYSYMBOL_command = 405,                  /* command  */
+  YYSYMBOL_commands = 406,                 /* commands  */
+  YYSYMBOL_commandname = 407,              /* commandname  */
+  YYSYMBOL_protocol = 408,                 /* protocol  */
+  YYSYMBOL_protocols = 409,                /* protocols  */
+  YYSYMBOL_protocolname = 410,             /* protocolname  */
+  YYSYMBOL_fromto = 411,                   /* fromto  */
+  YYSYMBOL_hostid_fromto = 412,            /* hostid_fromto  */
+  YYSYMBOL_redirect = 413,                 /* redirect  */
+  YYSYMBOL_sessionoption = 414,            /* sessionoption  */
+  YYSYMBOL_sockssessionoption = 415,       /* sockssessionoption  */
+  YYSYMBOL_crulesessionoption = 416,       /* crulesessionoption  */
+  YYSYMBOL_sessioninheritable = 417,       /* sessioninheritable  */
+  YYSYMBOL_sessionmax = 418,               /* sessionmax  */
+  YYSYMBOL_sessionthrottle = 419,          /* sessionthrottle  */
+  YYSYMBOL_sessionstate = 420,             /* sessionstate  */
+  YYSYMBOL_sessionstate_key = 421,         /* sessionstate_key  */
+  YYSYMBOL_sessionstate_keyinfo = 422,     /* sessionstate_keyinfo  */
+  YYSYMBOL_423_24 = 423,                   /* $@24  */
+  YYSYMBOL_sessionstate_max = 424,         /* sessionstate_max  */
+  YYSYMBOL_sessionstate_throttle = 425,    /* sessionstate_throttle  */
+  YYSYMBOL_bandwidth = 426,                /* bandwidth  */
+  YYSYMBOL_log = 427,                      /* log  */
+  YYSYMBOL_logname = 428,                  /* logname  */
+  YYSYMBOL_logs = 429,                     /* logs  */
+  YYSYMBOL_pamservicename = 430,           /* pamservicename  */
+  YYSYMBOL_bsdauthstylename = 431,         /* bsdauthstylename  */
+  YYSYMBOL_gssapiservicename = 432,        /* gssapiservicename  */
+  YYSYMBOL_gssapikeytab = 433,             /* gssapikeytab  */
+  YYSYMBOL_gssapienctype = 434,            /* gssapienctype  */
+  YYSYMBOL_gssapienctypename = 435,        /* gssapienctypename  */
+  YYSYMBOL_gssapienctypes = 436,           /* gssapienctypes  */
+  YYSYMBOL_bounce = 437,                   /* bounce  */
+  YYSYMBOL_libwrap = 438,                  /* libwrap  */
+  YYSYMBOL_srcaddress = 439,               /* srcaddress  */
+  YYSYMBOL_hostid_srcaddress = 440,        /* hostid_srcaddress  */
+  YYSYMBOL_dstaddress = 441,               /* dstaddress  */
+  YYSYMBOL_rdr_fromaddress = 442,          /* rdr_fromaddress  */
+  YYSYMBOL_rdr_toaddress = 443,            /* rdr_toaddress  */
+  YYSYMBOL_gateway = 444,                  /* gateway  */
+  YYSYMBOL_routeoption = 445,              /* routeoption  */
+  YYSYMBOL_routeoptions = 446,             /* routeoptions  */
+  YYSYMBOL_routemethod = 447,              /* routemethod  */
+  YYSYMBOL_routeweight = 448,              /* routeweight  */
+  YYSYMBOL_from = 449,                     /* from  */
+  YYSYMBOL_to = 450,                       /* to  */
+  YYSYMBOL_rdr_from = 451,                 /* rdr_from  */
+  YYSYMBOL_rdr_to = 452,                   /* rdr_to  */
+  YYSYMBOL_bounceto = 453,                 /* bounceto  */
+  YYSYMBOL_via = 454,                      /* via  */
+  YYSYMBOL_externaladdress = 455,          /* externaladdress  */
+  YYSYMBOL_address_without_port = 456,     /* address_without_port  */
+  YYSYMBOL_address = 457,                  /* address  */
+  YYSYMBOL_ipaddress = 458,                /* ipaddress  */
+  YYSYMBOL_gwaddress = 459,                /* gwaddress  */
+  YYSYMBOL_bouncetoaddress = 460,          /* bouncetoaddress  */
+  YYSYMBOL_ipv4 = 461,                     /* ipv4  */
+  YYSYMBOL_netmask_v4 = 462,               /* netmask_v4  */
+  YYSYMBOL_ipv6 = 463,                     /* ipv6  */
+  YYSYMBOL_netmask_v6 = 464,               /* netmask_v6  */
+  YYSYMBOL_ipvany = 465,                   /* ipvany  */
+  YYSYMBOL_netmask_vany = 466,             /* netmask_vany  */
+  YYSYMBOL_domain = 467,                   /* domain  */
+  YYSYMBOL_ifname = 468,                   /* ifname  */
+  YYSYMBOL_url = 469,                      /* url  */
+  YYSYMBOL_port = 470,                     /* port  */
+  YYSYMBOL_gwport = 471,                   /* gwport  */
+  YYSYMBOL_portnumber = 472,               /* portnumber  */
+  YYSYMBOL_portrange = 473,                /* portrange  */
+  YYSYMBOL_portstart = 474,                /* portstart  */
+  YYSYMBOL_portend = 475,                  /* portend  */
+  YYSYMBOL_portservice = 476,              /* portservice  */
+  YYSYMBOL_portoperator = 477,             /* portoperator  */
+  YYSYMBOL_udpportrange = 478,             /* udpportrange  */
+  YYSYMBOL_udpportrange_start = 479,       /* udpportrange_start  */
+  YYSYMBOL_udpportrange_end = 480,         /* udpportrange_end  */
+  YYSYMBOL_number = 481,                   /* number  */
+  YYSYMBOL_numbers = 482                   /* numbers  */
 };
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
-#ifdef YYSTACKSIZE
-#undef YYMAXDEPTH
-#define YYMAXDEPTH YYSTACKSIZE
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
 #else
-#ifdef YYMAXDEPTH
-#define YYSTACKSIZE YYMAXDEPTH
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-#define YYSTACKSIZE 10000
-#define YYMAXDEPTH 10000
+typedef short yytype_int16;
 #endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
-#define YYINITSTACKSIZE 200
-/* LINTUSED */
-int yydebug;
-int yynerrs;
-int yyerrflag;
-int yychar;
-short *yyssp;
-YYSTYPE *yyvsp;
-YYSTYPE yyval;
-YYSTYPE yylval;
-short *yyss;
-short *yysslim;
-YYSTYPE *yyvs;
-unsigned int yystacksize;
-int yyparse(void);
-#line 3072 "config_parse.y"
 
-#define INTERACTIVE      0
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
 
-extern FILE *yyin;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
 
-int lex_dorestart; /* global for Lex. */
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
 
-int
-parseconfig(filename)
-   const char *filename;
-{
-   const char *function = "parseconfig()";
-   struct stat statbuf;
-   int haveconfig;
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
 
-#if SOCKS_CLIENT /* assume server admin can set things up correctly himself. */
-   parseclientenv(&haveconfig);
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
 
-   if (haveconfig)
-      return 0;
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
 
-#else /* !SOCKS_CLIENT */
-   SASSERTX(pidismainmother(sockscf.state.pid));
 
-   if (sockscf.state.inited)
-      /* in case we need something special to (re)open config-file. */
-      sockd_priv(SOCKD_PRIV_PRIVILEGED, PRIV_ON);
-#endif /* !SOCKS_CLIENT */
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
 
-   yyin = fopen(filename, "r");
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
-#if !SOCKS_CLIENT
-   if (sockscf.state.inited)
-      sockd_priv(SOCKD_PRIV_PRIVILEGED, PRIV_OFF);
-#endif /* SERVER */
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
 
-   if (yyin == NULL
-   ||  (stat(filename, &statbuf) == 0 && statbuf.st_size == 0)) {
-      if (yyin == NULL)
-         slog(sockscf.state.inited ? LOG_WARNING : LOG_ERR,
-              "%s: could not open config file %s", function, filename);
-      else
-         slog((sockscf.state.inited || SOCKS_CLIENT) ? LOG_WARNING : LOG_ERR,
-              "%s: config file %s is empty.  Not parsing", function, filename);
 
-#if SOCKS_CLIENT
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
 
-      if (yyin == NULL) {
-         if (sockscf.option.directfallback)
-            slog(LOG_DEBUG,
-                 "%s: no %s, but direct fallback enabled, continuing",
-                 function, filename);
-         else
-            exit(0);
-      }
-      else {
-         slog(LOG_DEBUG, "%s: empty %s, assuming direct fallback wanted",
-              function, filename);
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
 
-         sockscf.option.directfallback = 1;
-      }
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
 
-      SASSERTX(sockscf.option.directfallback == 1);
-#else /* !SOCKS_CLIENT */
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
 
-      if (!sockscf.state.inited)
-         sockdexit(EXIT_FAILURE);
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
 
-      /*
-       * Might possibly continue with old config.
-       */
 
-#endif /* !SOCKS_CLIENT */
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
 
-      haveconfig = 0;
-   }
-   else {
-#if YYDEBUG
-      yydebug       = 0;
-#endif /* YYDEBUG */
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
-      yylineno      = 1;
-      errno         = 0;   /* don't report old errors in yyparse(). */
-      haveconfig    = 1;
+#endif
 
-      /*
-       * Special and delayed as long as we can, till immediately before
-       * parsing new config.
-       * Want to keep a backup of old ones until we know there were no
-       * errors adding new logfiles.
-       */
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  30
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   707
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  237
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  246
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  477
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  791
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   485
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_uint8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,   236,   232,   235,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   231,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   233,     2,   234,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
+     175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
+     195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
+     225,   226,   227,   228,   229,   230
+};
 
-#if !SOCKS_CLIENT
-      old_log              = sockscf.log;
-      old_errlog           = sockscf.errlog;
-#endif /* !SOCKS_CLIENT */
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   627,   627,   627,   632,   635,   636,   639,   640,   641,
+     642,   643,   646,   647,   649,   650,   651,   652,   653,   654,
+     655,   656,   657,   658,   659,   660,   661,   662,   663,   664,
+     665,   666,   667,   668,   669,   670,   671,   672,   673,   674,
+     675,   676,   677,   685,   686,   686,   691,   691,   699,   699,
+     709,   709,   719,   719,   729,   729,   740,   750,   751,   754,
+     761,   768,   775,   784,   785,   788,   840,   841,   842,   843,
+     846,   853,   854,   853,   865,   866,   868,   871,   874,   877,
+     880,   883,   886,   887,   890,   893,   901,   902,   905,   908,
+     916,   917,   920,   923,   932,   933,   936,   937,   941,   945,
+     951,   976,  1000,  1000,  1025,  1032,  1054,  1054,  1067,  1071,
+    1074,  1080,  1081,  1082,  1083,  1084,  1085,  1086,  1089,  1090,
+    1093,  1101,  1111,  1111,  1114,  1114,  1117,  1174,  1175,  1178,
+    1183,  1188,  1193,  1198,  1207,  1212,  1221,  1228,  1233,  1238,
+    1245,  1252,  1253,  1254,  1257,  1270,  1283,  1302,  1318,  1323,
+    1326,  1332,  1339,  1344,  1352,  1372,  1373,  1376,  1390,  1404,
+    1412,  1422,  1426,  1433,  1436,  1440,  1446,  1447,  1450,  1453,
+    1456,  1463,  1468,  1469,  1472,  1514,  1601,  1601,  1608,  1620,
+    1631,  1635,  1652,  1655,  1661,  1664,  1668,  1671,  1677,  1678,
+    1681,  1693,  1693,  1704,  1704,  1719,  1722,  1723,  1726,  1735,
+    1738,  1739,  1743,  1751,  1751,  1751,  1768,  1768,  1797,  1798,
+    1799,  1802,  1806,  1809,  1815,  1819,  1822,  1828,  1828,  1890,
+    1893,  1911,  1942,  1947,  1950,  1951,  1952,  1953,  1956,  1957,
+    1960,  1965,  1970,  1971,  1976,  1979,  1979,  2004,  2005,  2008,
+    2009,  2012,  2012,  2023,  2035,  2035,  2050,  2051,  2055,  2056,
+    2057,  2058,  2059,  2060,  2061,  2066,  2070,  2075,  2076,  2077,
+    2078,  2079,  2080,  2081,  2082,  2083,  2084,  2085,  2086,  2087,
+    2092,  2115,  2116,  2121,  2122,  2123,  2124,  2125,  2126,  2127,
+    2128,  2129,  2130,  2131,  2132,  2133,  2134,  2135,  2136,  2137,
+    2138,  2139,  2140,  2141,  2142,  2143,  2144,  2145,  2146,  2147,
+    2148,  2152,  2157,  2166,  2180,  2191,  2205,  2219,  2231,  2243,
+    2255,  2267,  2278,  2289,  2294,  2303,  2308,  2317,  2322,  2331,
+    2336,  2345,  2356,  2371,  2385,  2399,  2414,  2428,  2442,  2456,
+    2468,  2482,  2496,  2508,  2523,  2526,  2535,  2536,  2540,  2545,
+    2552,  2555,  2556,  2559,  2562,  2565,  2571,  2575,  2581,  2584,
+    2585,  2588,  2591,  2597,  2600,  2603,  2604,  2605,  2608,  2609,
+    2610,  2613,  2616,  2617,  2620,  2624,  2630,  2639,  2648,  2649,
+    2650,  2651,  2654,  2682,  2682,  2693,  2701,  2710,  2719,  2722,
+    2726,  2729,  2732,  2735,  2738,  2744,  2745,  2749,  2761,  2774,
+    2786,  2802,  2805,  2811,  2814,  2817,  2820,  2828,  2829,  2832,
+    2835,  2875,  2878,  2881,  2884,  2887,  2897,  2900,  2901,  2902,
+    2903,  2904,  2905,  2906,  2907,  2908,  2909,  2910,  2911,  2919,
+    2920,  2923,  2926,  2935,  2940,  2945,  2950,  2955,  2963,  2968,
+    2969,  2970,  2971,  2974,  2975,  2976,  2979,  2983,  2984,  2985,
+    2986,  2987,  2989,  2991,  2992,  2993,  2994,  2997,  2998,  3002,
+    3010,  3017,  3023,  3031,  3040,  3048,  3058,  3064,  3071,  3078,
+    3079,  3080,  3081,  3084,  3085,  3088,  3089,  3092,  3100,  3106,
+    3112,  3147,  3153,  3156,  3163,  3175,  3180,  3181
+};
+#endif
 
-      failed_to_add_errlog = failed_to_add_log = 0;
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "ALARM",
+  "ALARMTYPE_DATA", "ALARMTYPE_DISCONNECT", "ALARMIF_INTERNAL",
+  "ALARMIF_EXTERNAL", "TCPOPTION_DISABLED", "ECN", "SACK", "TIMESTAMPS",
+  "WSCALE", "MTU_ERROR", "CLIENTCOMPATIBILITY", "NECGSSAPI", "CLIENTRULE",
+  "HOSTIDRULE", "SOCKSRULE", "COMPATIBILITY", "SAMEPORT", "DRAFT_5_05",
+  "CONNECTTIMEOUT", "TCP_FIN_WAIT", "CPU", "MASK", "SCHEDULE",
+  "CPUMASK_ANYCPU", "CPUMASK_PERCPU", "DEBUGGING", "DEPRECATED",
+  "ERRORLOG", "LOGOUTPUT", "LOGFILE", "LOGTYPE_ERROR",
+  "LOGTYPE_TCP_DISABLED", "LOGTYPE_TCP_ENABLED", "LOGIF_INTERNAL",
+  "LOGIF_EXTERNAL", "ERRORVALUE", "EXTENSION", "BIND", "PRIVILEGED",
+  "EXTERNAL_PROTOCOL", "INTERNAL_PROTOCOL", "EXTERNAL_ROTATION",
+  "SAMESAME", "GROUPNAME", "HOSTID", "HOSTINDEX", "INTERFACE",
+  "SOCKETOPTION_SYMBOLICVALUE", "INTERNAL", "EXTERNAL", "INTERNALSOCKET",
+  "EXTERNALSOCKET", "IOTIMEOUT", "IOTIMEOUT_TCP", "IOTIMEOUT_UDP",
+  "NEGOTIATETIMEOUT", "LIBWRAP_FILE", "LOGLEVEL", "SOCKSMETHOD",
+  "CLIENTMETHOD", "METHOD", "METHODNAME", "NONE", "BSDAUTH", "GSSAPI",
+  "PAM_ADDRESS", "PAM_ANY", "PAM_USERNAME", "RFC931", "UNAME", "MONITOR",
+  "PROCESSTYPE", "PROC_MAXREQUESTS", "PROC_MAXCLIENTS_NEGOTIATE",
+  "PROC_MAXCLIENTS_IO", "PROC_MAXCLIENTS_REQUEST", "PROC_REUSEPORT",
+  "PROC_ALLINONE", "HOSTCACHE_ENTRIES", "HOSTCACHE_TTL_MIN",
+  "HOSTCACHE_TTL_MAX", "HAPPYEYEBALLS_DELAY", "REALM", "REALNAME",
+  "RESOLVEPROTOCOL", "REQUIRED", "SCHEDULEPOLICY", "SERVERCONFIG",
+  "CLIENTCONFIG", "SOCKET", "CLIENTSIDE_SOCKET", "SNDBUF", "RCVBUF",
+  "SOCKETPROTOCOL", "SOCKETOPTION_OPTID", "SRCHOST", "NODNSMISMATCH",
+  "NODNSUNKNOWN", "CHECKREPLYAUTH", "USERNAME", "USER_PRIVILEGED",
+  "USER_UNPRIVILEGED", "USER_LIBWRAP", "WORD__IN", "ROUTE", "VIA",
+  "GLOBALROUTEOPTION", "BADROUTE_EXPIRE", "MAXFAIL", "ROUTE_WEIGHT",
+  "PORT", "NUMBER", "BANDWIDTH", "BOUNCE", "BSDAUTHSTYLE",
+  "BSDAUTHSTYLENAME", "COMMAND", "COMMAND_BIND", "COMMAND_CONNECT",
+  "COMMAND_UDPASSOCIATE", "COMMAND_BINDREPLY", "COMMAND_UDPREPLY",
+  "ACTION", "FROM", "TO", "GSSAPIENCTYPE", "GSSAPIENC_ANY",
+  "GSSAPIENC_CLEAR", "GSSAPIENC_INTEGRITY", "GSSAPIENC_CONFIDENTIALITY",
+  "GSSAPIENC_PERMESSAGE", "GSSAPIKEYTAB", "GSSAPISERVICE",
+  "GSSAPISERVICENAME", "GSSAPIKEYTABNAME", "IPV4", "IPV6", "IPVANY",
+  "DOMAINNAME", "IFNAME", "URL", "LDAPATTRIBUTE", "LDAPATTRIBUTE_AD",
+  "LDAPATTRIBUTE_HEX", "LDAPATTRIBUTE_AD_HEX", "LDAPBASEDN", "LDAP_BASEDN",
+  "LDAPBASEDN_HEX", "LDAPBASEDN_HEX_ALL", "LDAPCERTFILE", "LDAPCERTPATH",
+  "LDAPPORT", "LDAPPORTSSL", "LDAPDEBUG", "LDAPDEPTH", "LDAPAUTO",
+  "LDAPSEARCHTIME", "LDAPDOMAIN", "LDAP_DOMAIN", "LDAPFILTER",
+  "LDAPFILTER_AD", "LDAPFILTER_HEX", "LDAPFILTER_AD_HEX", "LDAPGROUP",
+  "LDAPGROUP_NAME", "LDAPGROUP_HEX", "LDAPGROUP_HEX_ALL", "LDAPKEYTAB",
+  "LDAPKEYTABNAME", "LDAPDEADTIME", "LDAPSERVER", "LDAPSERVER_NAME",
+  "LDAPSSL", "LDAPCERTCHECK", "LDAPKEEPREALM", "LDAPTIMEOUT", "LDAPCACHE",
+  "LDAPCACHEPOS", "LDAPCACHENEG", "LDAPURL", "LDAP_URL", "LDAP_FILTER",
+  "LDAP_ATTRIBUTE", "LDAP_CERTFILE", "LDAP_CERTPATH", "LIBWRAPSTART",
+  "LIBWRAP_ALLOW", "LIBWRAP_DENY", "LIBWRAP_HOSTS_ACCESS", "LINE",
+  "OPERATOR", "PAMSERVICENAME", "PROTOCOL", "PROTOCOL_TCP", "PROTOCOL_UDP",
+  "PROTOCOL_FAKE", "PROXYPROTOCOL", "PROXYPROTOCOL_SOCKS_V4",
+  "PROXYPROTOCOL_SOCKS_V5", "PROXYPROTOCOL_HTTP", "PROXYPROTOCOL_UPNP",
+  "REDIRECT", "SENDSIDE", "RECVSIDE", "SERVICENAME", "SESSION_INHERITABLE",
+  "SESSIONMAX", "SESSIONTHROTTLE", "SESSIONSTATE_KEY", "SESSIONSTATE_MAX",
+  "SESSIONSTATE_THROTTLE", "RULE_LOG", "RULE_LOG_CONNECT", "RULE_LOG_DATA",
+  "RULE_LOG_DISCONNECT", "RULE_LOG_ERROR", "RULE_LOG_IOOPERATION",
+  "RULE_LOG_TCPINFO", "STATEKEY", "UDPPORTRANGE", "UDPCONNECTDST", "USER",
+  "GROUP", "VERDICT_BLOCK", "VERDICT_PASS", "YES", "NO", "':'", "'.'",
+  "'{'", "'}'", "'/'", "'-'", "$accept", "configtype", "$@1",
+  "serverobjects", "serverobject", "serveroptions", "serveroption",
+  "logspecial", "$@2", "$@3", "internal_if_logoption", "$@4",
+  "external_if_logoption", "$@5", "rule_internal_logoption", "$@6",
+  "rule_external_logoption", "$@7", "loglevel", "tcpoptions", "tcpoption",
+  "errors", "errorobject", "timeout", "deprecated", "route", "$@8", "$@9",
+  "routes", "proxyprotocol", "proxyprotocolname", "proxyprotocols", "user",
+  "username", "usernames", "group", "groupname", "groupnames", "extension",
+  "extensionname", "extensions", "ifprotocols", "ifprotocol", "internal",
+  "internalinit", "internal_protocol", "$@10", "external", "externalinit",
+  "external_protocol", "$@11", "external_rotation", "clientoption",
+  "clientoptions", "global_routeoption", "errorlog", "$@12", "logoutput",
+  "$@13", "logoutputdevice", "logoutputdevices", "childstate", "hostcache",
+  "happyeyeballs", "userids", "user_privileged", "user_unprivileged",
+  "user_libwrap", "userid", "iotimeout", "negotiatetimeout",
+  "connecttimeout", "tcp_fin_timeout", "debugging", "libwrapfiles",
+  "libwrap_allowfile", "libwrap_denyfile", "libwrap_hosts_access",
+  "udpconnectdst", "compatibility", "compatibilityname",
+  "compatibilitynames", "resolveprotocol", "resolveprotocolname", "cpu",
+  "cpuschedule", "cpuaffinity", "socketoption", "$@14", "socketoptionname",
+  "socketoptionvalue", "socketside", "srchost", "srchostoption",
+  "srchostoptions", "realm", "global_clientmethod", "$@15",
+  "global_socksmethod", "$@16", "socksmethod", "socksmethods",
+  "socksmethodname", "clientmethod", "clientmethods", "clientmethodname",
+  "monitor", "$@17", "$@18", "crule", "$@19", "alarm", "monitorside",
+  "alarmside", "alarm_data", "$@20", "alarm_test", "networkproblem",
+  "alarm_disconnect", "alarmperiod", "monitoroption", "monitoroptions",
+  "cruleoption", "hrule", "$@21", "cruleoptions", "hostidoption", "hostid",
+  "$@22", "hostindex", "srule", "$@23", "sruleoptions", "sruleoption",
+  "genericruleoption", "ldapoption", "ldapdebug", "ldapdomain",
+  "ldapdepth", "ldapcertfile", "ldapcertpath", "lurl", "lbasedn",
+  "lbasedn_hex", "lbasedn_hex_all", "ldapport", "ldapportssl", "ldapssl",
+  "ldapauto", "ldapcertcheck", "ldapkeeprealm", "ldapfilter",
+  "ldapfilter_ad", "ldapfilter_hex", "ldapfilter_ad_hex", "ldapattribute",
+  "ldapattribute_ad", "ldapattribute_hex", "ldapattribute_ad_hex",
+  "lgroup_hex", "lgroup_hex_all", "lgroup", "lserver", "ldapkeytab",
+  "clientcompatibility", "clientcompatibilityname",
+  "clientcompatibilitynames", "verdict", "command", "commands",
+  "commandname", "protocol", "protocols", "protocolname", "fromto",
+  "hostid_fromto", "redirect", "sessionoption", "sockssessionoption",
+  "crulesessionoption", "sessioninheritable", "sessionmax",
+  "sessionthrottle", "sessionstate", "sessionstate_key",
+  "sessionstate_keyinfo", "$@24", "sessionstate_max",
+  "sessionstate_throttle", "bandwidth", "log", "logname", "logs",
+  "pamservicename", "bsdauthstylename", "gssapiservicename",
+  "gssapikeytab", "gssapienctype", "gssapienctypename", "gssapienctypes",
+  "bounce", "libwrap", "srcaddress", "hostid_srcaddress", "dstaddress",
+  "rdr_fromaddress", "rdr_toaddress", "gateway", "routeoption",
+  "routeoptions", "routemethod", "routeweight", "from", "to", "rdr_from",
+  "rdr_to", "bounceto", "via", "externaladdress", "address_without_port",
+  "address", "ipaddress", "gwaddress", "bouncetoaddress", "ipv4",
+  "netmask_v4", "ipv6", "netmask_v6", "ipvany", "netmask_vany", "domain",
+  "ifname", "url", "port", "gwport", "portnumber", "portrange",
+  "portstart", "portend", "portservice", "portoperator", "udpportrange",
+  "udpportrange_start", "udpportrange_end", "number", "numbers", YY_NULLPTR
+};
 
-      slog(LOG_DEBUG, "%s: parsing config in file %s", function, filename);
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
 
-      bzero(&sockscf.log,    sizeof(sockscf.log));
-      bzero(&sockscf.errlog, sizeof(sockscf.errlog));
+#define YYPACT_NINF (-675)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-229)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+       3,  -675,    79,    70,   374,  -154,  -151,  -147,  -675,  -143,
+    -141,  -124,  -104,  -102,   -91,   -41,   -13,  -675,  -675,    79,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,   -36,   -25,  -675,  -675,    10,    49,    62,    67,  -675,
+    -675,  -675,  -675,    71,    73,    74,    75,    76,    77,    80,
+      81,    84,    86,    87,    89,    90,    91,    92,    93,    94,
+      96,    97,    98,    99,  -675,   374,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,   113,  -675,
+    -675,  -675,  -675,   159,   177,   181,  -675,  -675,   184,   186,
+     198,   199,  -149,   100,   101,  -675,   119,    83,   154,   102,
+     105,   275,  -675,  -675,    17,   111,   114,  -675,  -675,   204,
+     211,   218,   228,   -43,   -31,   229,   231,   232,   233,   262,
+      22,   247,   247,   247,   291,   292,   -21,   -16,    26,  -675,
+     122,  -675,  -675,  -675,   320,   320,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,   240,   241,  -675,  -675,  -675,  -675,
+      83,  -675,   125,   126,   298,   298,  -675,   275,  -675,    85,
+      85,  -675,  -675,  -675,    33,   -24,   295,   296,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,    22,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,   320,  -675,
+    -675,  -675,  -675,   129,  -675,   289,   290,  -675,   136,   139,
+    -675,  -675,  -675,  -675,    85,  -675,  -675,  -675,  -675,  -675,
+    -675,   252,  -675,  -675,   132,   137,   138,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,   295,  -675,  -675,   296,
+    -675,     7,     7,     7,   141,   -22,  -675,  -675,   144,   145,
+     134,   134,  -675,   -82,  -675,   -68,   263,   265,  -675,  -675,
+    -675,  -675,   148,   157,   158,  -675,  -675,  -675,   146,    42,
+     267,   302,   163,   164,   170,  -675,  -675,  -675,  -675,   -76,
+    -675,   166,   -76,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+     174,   174,   481,    30,     2,   176,   178,   182,   185,   189,
+     190,   191,   192,   193,   281,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,    42,   283,  -675,  -675,  -675,   267,
+    -675,   180,   386,  -675,  -675,  -675,  -675,  -675,  -675,   319,
+    -675,  -675,  -675,   207,   208,   209,   210,   212,   307,   213,
+     214,   112,   215,   216,   217,    12,   230,   234,   235,   237,
+     238,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,   174,
+     283,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,   283,   239,   243,   250,
+     251,   254,   255,   256,   257,   258,   261,   264,   266,   268,
+     269,   270,   271,   274,   276,   277,   278,   279,   280,   282,
+     284,   285,   286,   293,   294,   297,   300,  -675,   283,   481,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,   179,
+    -675,  -675,  -675,    25,   283,  -675,  -675,  -675,  -675,  -675,
+    -675,   427,   295,   334,    95,   118,   325,   327,    48,   -10,
+    -675,  -675,   301,  -675,  -675,   362,   344,   303,  -675,   368,
+    -675,  -675,   386,   149,   149,  -675,  -675,   288,   309,  -675,
+     378,   295,   296,   379,  -675,   311,   305,   304,  -675,   393,
+    -675,   314,    28,   381,   399,   326,  -675,   407,   408,   -15,
+     423,   480,  -675,   174,   174,   344,   318,   414,   364,   365,
+     366,   367,   404,   405,   406,   370,   371,   443,   445,   -93,
+     446,    37,   400,   382,   383,   384,   385,   395,   403,   409,
+     401,   397,    39,    41,    43,   390,   460,   481,  -675,   346,
+    -675,   345,  -675,    19,  -675,   427,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,    95,  -675,  -675,  -675,  -675,
+    -675,   118,  -675,  -675,  -675,  -675,  -675,  -675,    48,  -675,
+    -675,  -675,  -675,  -675,   -10,  -675,    33,  -675,    42,   348,
+    -675,  -675,   349,    33,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,   149,  -675,   298,   298,    33,  -675,  -675,  -675,  -675,
+      24,  -675,  -675,  -675,    33,  -675,  -675,  -675,   347,  -675,
+     532,  -675,   350,  -675,  -675,  -675,  -675,  -675,  -675,   -15,
+    -675,  -675,  -675,   423,  -675,  -675,   480,   352,   353,  -675,
+      33,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,   468,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,   354,   355,   571,    69,
+     473,   357,  -675,  -675,  -675,  -675,  -675,  -675,   358,   121,
+      33,  -675,  -675,   361,   363,  -675,   482,  -675,   482,  -675,
+     479,  -675,   485,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+     487,  -675,  -675,  -675,  -675,  -675,   372,   369,  -675,  -675,
+    -675,   482,  -675,   482,  -675,  -675,  -675,   134,   134,   411,
+    -675,  -675,  -675,  -675,  -675,  -675,   491,   492,  -675,  -675,
+    -675,  -675,   -76,   501,   502,  -675,   496,   497,  -675,  -675,
+    -675
+};
 
-      lex_dorestart = 1;
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       0,     2,   118,     0,    12,     0,     0,     0,    70,     0,
+       0,     0,     0,     0,     0,     0,     0,   117,   112,   118,
+      74,   113,   114,   115,    67,    68,    66,    69,   111,   116,
+       1,     0,     0,    48,    50,     0,     0,     0,     0,   101,
+     105,   182,   183,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     5,    12,    32,    24,    39,    18,
+      20,    30,    31,    21,    22,    23,    27,    19,    35,    14,
+      29,    28,    41,   141,   142,   143,    17,    34,   155,   156,
+      33,    40,    15,    37,    16,   172,   173,    42,     0,    38,
+      36,    25,    26,     0,     0,     0,   122,   124,     0,     0,
+       0,     0,     0,     0,     0,   119,     4,     0,     0,     0,
+       0,     0,   106,   102,     0,     0,     0,   193,   191,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     3,    13,
+       0,   152,   153,   154,     0,     0,   148,   149,   150,   151,
+     170,   171,   169,   168,     0,     0,    71,    75,   164,   165,
+     166,   163,     0,     0,     0,     0,    93,    94,    92,     0,
+       0,   109,   108,   110,     0,     0,     0,     0,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     190,   185,   186,   187,   188,   184,   147,   144,   145,   146,
+     157,   158,   159,   160,   161,   162,   206,   235,   244,   203,
+       6,    11,    10,     7,     8,     9,   176,   126,   127,   123,
+     125,   121,   120,     0,   167,     0,     0,    56,     0,     0,
+      95,    98,    99,   107,    96,   103,   449,   452,   454,   456,
+     457,   459,   100,   433,   438,   440,   442,   434,   435,   104,
+     429,   430,   431,   432,   198,   194,   196,   202,   192,   200,
+     189,     0,     0,     0,     0,     0,   128,    72,     0,     0,
+       0,     0,    97,     0,   436,     0,     0,     0,   197,   201,
+     338,   339,     0,     0,     0,   204,   179,   178,     0,   419,
+       0,     0,     0,     0,     0,    49,    51,   468,   471,     0,
+     462,     0,     0,   450,   451,   437,   453,   439,   455,   441,
+     237,   237,   246,   211,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   415,   410,   418,   409,   408,
+     411,   412,   413,   414,   419,     0,   407,   417,   475,   476,
+     175,     0,     0,    44,    46,   470,   460,   466,   465,     0,
+     461,    52,    54,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   265,   259,   271,   272,   260,   270,   258,   257,   237,
+       0,   264,   239,   240,   234,   232,   231,   269,   363,   233,
+     362,   358,   359,   360,   368,   369,   371,   370,   256,   267,
+     268,   263,   262,   261,   230,   266,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   253,     0,   246,
+     250,   251,   284,   286,   285,   282,   283,   300,   278,   279,
+     280,   293,   294,   295,   277,   281,   291,   287,   288,   290,
+     289,   273,   274,   276,   275,   297,   298,   296,   299,   292,
+     249,   252,   361,   254,   248,   255,   212,   213,   224,     0,
+     208,   210,   209,   211,     0,   226,   225,   227,   181,   180,
+     177,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     425,   416,     0,   420,   423,     0,     0,     0,   477,     0,
+      65,    43,    63,     0,     0,   469,   467,     0,     0,   241,
+       0,     0,     0,     0,   427,     0,     0,     0,   426,   356,
+     357,     0,     0,     0,     0,     0,   373,     0,     0,     0,
+       0,     0,   238,   237,   237,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   246,   247,     0,
+     217,     0,   229,   211,   335,   336,   334,   421,   422,   343,
+     344,   345,   346,   347,   340,   341,   392,   393,   394,   395,
+     396,   397,   391,   390,   389,   351,   352,   348,   349,    77,
+      78,    79,    80,    81,    82,    76,     0,   428,   419,     0,
+     424,   353,     0,     0,   174,    64,    59,    60,    61,    62,
+      45,    57,    47,     0,     0,     0,   243,   195,   199,   377,
+       0,   400,   387,   355,     0,   364,   365,   366,     0,   372,
+       0,   375,     0,   379,   380,   381,   382,   383,   384,   385,
+     378,    85,    86,    84,    89,    90,    88,     0,     0,   354,
+       0,   388,   325,   326,   327,   328,   308,   309,   310,   305,
+     306,   311,   312,   301,     0,   304,   315,   316,   303,   321,
+     322,   323,   324,   331,   329,   330,   333,   332,   313,   314,
+     317,   318,   319,   320,   307,   473,     0,     0,     0,   214,
+       0,     0,   337,   342,   398,   350,    83,   404,     0,     0,
+       0,   401,    58,     0,     0,   242,   463,   399,   463,   405,
+       0,   374,     0,   386,    87,    91,   207,   236,   402,   302,
+       0,   245,   220,   219,   216,   215,     0,     0,   205,    73,
+     458,   463,   406,   463,   445,   446,   403,     0,     0,     0,
+     447,   448,   367,   376,   474,   472,     0,     0,   443,   444,
+      53,    55,     0,     0,   222,   464,     0,     0,   221,   218,
+     223
+};
 
-      parsingconfig = 1;
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -675,  -675,  -675,  -675,  -675,   548,  -675,  -277,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -167,  -490,
+    -675,   103,  -675,    56,    -3,   466,  -675,  -675,  -675,  -305,
+    -675,    -9,  -675,   -55,  -675,  -675,   -57,  -675,    55,  -675,
+     454,  -139,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,   601,    61,    65,  -675,    68,  -675,  -675,
+    -115,  -675,  -675,  -675,  -675,  -675,  -675,  -675,   135,  -675,
+    -675,  -675,  -675,    82,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,   452,    88,  -675,  -675,  -675,  -675,    -4,  -675,  -675,
+    -675,  -675,  -675,  -675,   419,  -675,  -675,  -675,  -675,  -675,
+    -675,  -248,  -675,  -675,  -245,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -465,  -675,  -675,  -675,  -298,  -312,  -675,  -675,   -19,
+    -675,  -675,  -433,  -675,  -303,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -292,  -675,    54,    16,  -308,    38,
+    -675,  -293,    35,  -675,  -363,  -675,  -675,  -301,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,    -8,  -675,  -675,  -290,  -289,  -287,  -675,    45,
+    -675,  -675,  -675,  -675,   107,   308,   115,  -675,  -675,  -331,
+    -675,  -675,   244,  -675,  -675,  -675,  -675,  -675,  -675,  -599,
+    -588,  -615,  -675,  -675,   478,  -675,   483,  -675,  -675,  -675,
+    -183,  -182,  -675,  -675,  -674,  -307,  -675,   388,  -675,  -675,
+    -103,  -675,  -675,  -675,  -675,   316
+};
 
-#if SOCKSLIBRARY_DYNAMIC
-      socks_markasnative("*");
-#endif /* SOCKSLIBRARY_DYNAMIC */
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     3,     4,   148,   220,    64,    65,   305,   523,   524,
+      66,   119,    67,   120,   381,   527,   382,   528,   238,   640,
+     641,   521,   522,   383,    18,   167,   233,   299,   116,   335,
+     624,   625,   384,   672,   673,   385,   675,   676,   336,   177,
+     178,   243,   244,    71,   125,    72,   180,    73,   126,    74,
+     179,    75,    19,    20,    21,    22,   154,    23,   155,   228,
+     229,    79,    80,    81,    82,    83,    84,    85,   207,    24,
+      25,    26,    27,    28,    87,    88,    89,    90,    91,    92,
+     170,   171,    29,   163,    94,    95,    96,   386,   275,   298,
+     500,    98,    99,   204,   205,   100,   101,   187,   102,   186,
+     387,   265,   266,   388,   268,   269,   222,   274,   323,   223,
+     271,   488,   489,   756,   490,   719,   491,   753,   492,   788,
+     493,   494,   389,   224,   272,   390,   391,   392,   645,   393,
+     225,   273,   448,   449,   394,   451,   452,   453,   454,   455,
+     456,   457,   458,   459,   460,   461,   462,   463,   464,   465,
+     466,   467,   468,   469,   470,   471,   472,   473,   474,   475,
+     476,   477,   478,   479,   395,   595,   596,   292,   339,   604,
+     605,   396,   617,   618,   515,   554,   397,   398,   483,   399,
+     400,   401,   402,   403,   404,   405,   660,   406,   407,   408,
+     409,   669,   670,   410,   484,   411,   412,   413,   611,   612,
+     414,   415,   516,   555,   631,   511,   540,   628,   344,   345,
+     346,   347,   517,   632,   512,   541,   535,   629,   259,   251,
+     252,   253,   762,   737,   254,   315,   255,   317,   256,   319,
+     257,   258,   765,   284,   770,   356,   310,   357,   526,   358,
+     312,   485,   716,   775,   349,   350
+};
 
-      yyparse();
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      97,    69,   262,   263,   306,   360,   340,   338,   239,   341,
+     342,   495,   343,   513,   480,   496,   588,   447,   288,   450,
+       8,   482,   693,   416,   289,   486,   487,   553,   592,   481,
+     497,   486,   487,   307,   642,   736,   486,   487,   727,   307,
+     230,   245,   216,   217,   218,   731,   735,   313,   160,   161,
+     162,   340,   338,   498,   341,   342,   325,   343,    17,    70,
+      68,    97,    69,   181,   771,    76,   739,   363,   364,    77,
+      30,   314,    78,   363,   364,    17,   296,   103,   363,   364,
+     104,   748,    35,   182,   105,   587,    86,   778,   106,   779,
+     107,   552,    93,   297,     1,     2,    41,    42,   113,   114,
+     219,     5,     6,   168,   169,   282,   326,   108,     7,     8,
+       9,    10,   308,   276,   761,   246,   247,   499,   249,   250,
+      70,    68,   201,   202,   203,   183,    76,   109,   721,   110,
+      77,   593,   355,    78,   166,    11,    12,    13,    14,   328,
+     111,   480,   766,   694,   447,   328,   450,    86,   482,   309,
+     328,   732,  -228,    93,   717,   327,   481,  -228,   636,   637,
+     638,   639,   328,   246,   247,   248,   249,    15,   302,   303,
+     304,   329,   246,   247,   248,   249,   250,   330,   331,   172,
+     173,   495,   589,   590,   591,   496,   192,   193,   325,    16,
+     112,   619,   620,   621,   622,   117,     5,     6,   194,   195,
+     497,   663,   664,   665,   666,   667,   668,   118,   212,   213,
+     150,   361,   362,   214,   215,   332,   599,   600,   601,   602,
+     603,   332,   363,   364,   241,   242,   332,   166,    41,    42,
+      11,    12,    13,    14,   290,   291,   365,   366,   332,   510,
+     538,   121,   333,   545,   546,   615,   616,   334,   606,   607,
+     608,   609,   610,  -228,   597,   677,   678,   655,   656,  -228,
+     246,   247,   248,   249,   250,   760,   696,   697,   708,   709,
+     710,   711,   712,   713,   151,   754,   755,   208,   209,   480,
+     122,   495,   447,   647,   450,   496,   482,   648,   293,   294,
+     367,   368,   152,   123,   481,   337,   153,   728,   124,   156,
+     497,   157,   127,   329,   128,   129,   130,   131,   132,   330,
+     331,   133,   134,   158,   159,   135,   176,   136,   137,   188,
+     138,   139,   140,   141,   142,   143,   189,   144,   145,   146,
+     147,   164,   165,   190,   174,   340,   338,   175,   341,   342,
+     337,   343,   184,   191,   196,   185,   197,   198,   199,   200,
+     206,   210,   211,   227,   226,   231,   232,   235,   236,   237,
+     264,   267,   277,   369,   278,   279,   283,   285,   280,   370,
+     332,   281,   286,   287,   295,   300,   301,   324,   316,   371,
+     318,   320,   348,   372,   373,   374,   375,   376,   377,   378,
+     321,   322,   351,    31,   352,   353,     5,     6,    32,   379,
+     380,   354,   359,     7,     8,     9,    10,   501,   510,   502,
+     514,    33,    34,   503,    35,   519,   504,    36,    37,    38,
+     505,   506,   507,   508,   509,   520,    39,    40,    41,    42,
+      11,    12,    13,    14,   525,   534,    43,    44,   529,   530,
+     531,   532,   594,   533,   536,   537,   542,   543,   544,   598,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,   547,    15,   613,   614,   548,   549,   738,   550,   551,
+     557,   627,   630,    56,   558,   785,   733,   734,    57,    58,
+      59,   559,   560,   634,    16,   561,   562,   563,   564,   565,
+     780,   781,   566,   646,   649,   567,   657,   568,   651,   569,
+     570,   571,   572,     5,     6,   573,   623,   574,   575,   576,
+     577,   578,   652,   579,   658,   580,   581,   582,   361,   362,
+     643,   538,   661,   662,   583,   584,   671,   674,   585,   363,
+     364,   586,   626,   681,   633,    41,    42,    11,    12,    13,
+      14,   644,   650,   365,   366,   654,   763,   764,   659,   680,
+     682,   683,   684,   685,   686,   687,   688,   689,   691,   690,
+     692,   695,   698,   703,    60,    61,    62,   699,   700,   701,
+     702,   704,   707,   706,   714,   715,   720,   705,   718,   729,
+     730,   364,   740,   749,   752,   742,   746,   747,   757,   751,
+     750,   758,   759,   767,   772,   768,   769,   367,    63,   417,
+     773,   328,   774,   776,   777,   308,   783,   784,   786,   787,
+     329,   789,   790,   149,   221,   726,   330,   331,   744,   745,
+     115,   623,   234,   270,   337,   635,   418,   419,   420,   421,
+     422,   240,   423,   424,   425,   426,   427,   428,   429,   430,
+     431,   741,   432,   723,   433,   434,   435,   436,   437,   722,
+     438,   439,   440,   725,   653,   441,   724,   442,   443,   444,
+     556,   743,   679,   260,   445,   518,   782,     0,   261,     0,
+     369,   311,     0,     0,     0,     0,   370,   332,     0,   539,
+       0,   333,     0,     0,     0,     0,   371,     0,     0,     0,
+       0,   373,   374,   375,   376,   377,   378,     0,     0,     0,
+       0,     0,     0,     0,   446,     0,   379,   380
+};
 
-#if SOCKSLIBRARY_DYNAMIC
-      socks_markasnormal("*");
-#endif /* SOCKSLIBRARY_DYNAMIC */
+static const yytype_int16 yycheck[] =
+{
+       4,     4,   185,   185,   281,   312,   299,   299,   175,   299,
+     299,   323,   299,   344,   322,   323,   449,   322,   266,   322,
+      30,   322,   115,   321,   269,     6,     7,   390,   493,   322,
+     323,     6,     7,   115,   524,   650,     6,     7,   626,   115,
+     155,   180,    16,    17,    18,   633,   645,   115,   197,   198,
+     199,   344,   344,    51,   344,   344,    14,   344,     2,     4,
+       4,    65,    65,    46,   738,     4,   654,    48,    49,     4,
+       0,   139,     4,    48,    49,    19,    98,   231,    48,    49,
+     231,   680,    40,    66,   231,   448,     4,   761,   231,   763,
+     231,   389,     4,   115,    91,    92,    54,    55,   111,   112,
+      74,    22,    23,    20,    21,   244,    64,   231,    29,    30,
+      31,    32,   194,   228,   729,   139,   140,   115,   142,   143,
+      65,    65,   100,   101,   102,   108,    65,   231,   593,   231,
+      65,   494,   208,    65,   108,    56,    57,    58,    59,   120,
+     231,   449,   730,   236,   449,   120,   449,    65,   449,   231,
+     120,   641,   127,    65,   587,   113,   449,   127,     9,    10,
+      11,    12,   120,   139,   140,   141,   142,    88,    34,    35,
+      36,   129,   139,   140,   141,   142,   143,   135,   136,    25,
+      26,   493,     3,     4,     5,   493,   229,   230,    14,   110,
+     231,   201,   202,   203,   204,   231,    22,    23,   229,   230,
+     493,   216,   217,   218,   219,   220,   221,   232,   229,   230,
+      97,    37,    38,   229,   230,   196,   121,   122,   123,   124,
+     125,   196,    48,    49,   139,   140,   196,   108,    54,    55,
+      56,    57,    58,    59,   227,   228,    62,    63,   196,   127,
+     128,   231,   200,   231,   232,   197,   198,   205,   130,   131,
+     132,   133,   134,   234,   502,   553,   554,   229,   230,   234,
+     139,   140,   141,   142,   143,   144,   229,   230,   229,   230,
+     229,   230,   229,   230,   115,   206,   207,   142,   143,   587,
+     231,   593,   587,   531,   587,   593,   587,   532,   272,   273,
+     116,   117,   115,   231,   587,   299,   115,   628,   231,   115,
+     593,   115,   231,   129,   231,   231,   231,   231,   231,   135,
+     136,   231,   231,   115,   115,   231,    41,   231,   231,   115,
+     231,   231,   231,   231,   231,   231,   115,   231,   231,   231,
+     231,   231,   231,   115,   232,   628,   628,   232,   628,   628,
+     344,   628,   231,   115,   115,   231,   115,   115,   115,    87,
+     103,    60,    60,    33,   232,   115,   115,   232,   232,    61,
+      65,    65,   233,   189,    75,    75,   114,   235,   232,   195,
+     196,   232,   235,   235,   233,   231,   231,   231,   115,   205,
+     115,   233,   115,   209,   210,   211,   212,   213,   214,   215,
+     233,   233,    90,    19,   231,   231,    22,    23,    24,   225,
+     226,   231,   236,    29,    30,    31,    32,   231,   127,   231,
+     127,    37,    38,   231,    40,   235,   231,    43,    44,    45,
+     231,   231,   231,   231,   231,    39,    52,    53,    54,    55,
+      56,    57,    58,    59,   115,   128,    62,    63,   231,   231,
+     231,   231,    15,   231,   231,   231,   231,   231,   231,   115,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,   231,    88,   138,   137,   231,   231,   650,   231,   231,
+     231,   109,   128,    99,   231,   782,   643,   644,   104,   105,
+     106,   231,   231,   115,   110,   231,   231,   231,   231,   231,
+     767,   768,   231,   115,   115,   231,   115,   231,   193,   231,
+     231,   231,   231,    22,    23,   231,   509,   231,   231,   231,
+     231,   231,   208,   231,   115,   231,   231,   231,    37,    38,
+     232,   128,   115,   115,   231,   231,   103,    47,   231,    48,
+      49,   231,   231,   119,   231,    54,    55,    56,    57,    58,
+      59,   232,   231,    62,    63,   231,   729,   729,   222,   231,
+     186,   186,   186,   186,   150,   150,   150,   187,   115,   188,
+     115,   115,   162,   168,   190,   191,   192,   185,   185,   185,
+     185,   168,   175,   172,   184,   115,   231,   168,   232,   231,
+     231,    49,   235,   115,    13,   235,   234,   234,   115,   234,
+     236,   234,   234,   232,   115,   232,   114,   116,   224,   118,
+     115,   120,   115,   231,   235,   194,   115,   115,   107,   107,
+     129,   115,   115,    65,   148,   624,   135,   136,   673,   676,
+      19,   624,   170,   204,   628,   522,   145,   146,   147,   148,
+     149,   177,   151,   152,   153,   154,   155,   156,   157,   158,
+     159,   660,   161,   605,   163,   164,   165,   166,   167,   595,
+     169,   170,   171,   618,   539,   174,   611,   176,   177,   178,
+     416,   669,   555,   185,   183,   349,   769,    -1,   185,    -1,
+     189,   283,    -1,    -1,    -1,    -1,   195,   196,    -1,   371,
+      -1,   200,    -1,    -1,    -1,    -1,   205,    -1,    -1,    -1,
+      -1,   210,   211,   212,   213,   214,   215,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   223,    -1,   225,   226
+};
 
-      parsingconfig = 0;
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,    91,    92,   238,   239,    22,    23,    29,    30,    31,
+      32,    56,    57,    58,    59,    88,   110,   260,   261,   289,
+     290,   291,   292,   294,   306,   307,   308,   309,   310,   319,
+       0,    19,    24,    37,    38,    40,    43,    44,    45,    52,
+      53,    54,    55,    62,    63,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,    85,    86,    99,   104,   105,   106,
+     190,   191,   192,   224,   242,   243,   247,   249,   260,   261,
+     275,   280,   282,   284,   286,   288,   291,   292,   294,   298,
+     299,   300,   301,   302,   303,   304,   310,   311,   312,   313,
+     314,   315,   316,   319,   321,   322,   323,   324,   328,   329,
+     332,   333,   335,   231,   231,   231,   231,   231,   231,   231,
+     231,   231,   231,   111,   112,   290,   265,   231,   232,   248,
+     250,   231,   231,   231,   231,   281,   285,   231,   231,   231,
+     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
+     231,   231,   231,   231,   231,   231,   231,   231,   240,   242,
+      97,   115,   115,   115,   293,   295,   115,   115,   115,   115,
+     197,   198,   199,   320,   231,   231,   108,   262,    20,    21,
+     317,   318,    25,    26,   232,   232,    41,   276,   277,   287,
+     283,    46,    66,   108,   231,   231,   336,   334,   115,   115,
+     115,   115,   229,   230,   229,   230,   115,   115,   115,   115,
+      87,   100,   101,   102,   330,   331,   103,   305,   305,   305,
+      60,    60,   229,   230,   229,   230,    16,    17,    18,    74,
+     241,   262,   343,   346,   360,   367,   232,    33,   296,   297,
+     297,   115,   115,   263,   318,   232,   232,    61,   255,   255,
+     277,   139,   140,   278,   279,   278,   139,   140,   141,   142,
+     143,   456,   457,   458,   461,   463,   465,   467,   468,   455,
+     461,   463,   467,   468,    65,   338,   339,    65,   341,   342,
+     331,   347,   361,   368,   344,   325,   297,   233,    75,    75,
+     232,   232,   278,   114,   470,   235,   235,   235,   338,   341,
+     227,   228,   404,   404,   404,   233,    98,   115,   326,   264,
+     231,   231,    34,    35,    36,   244,   244,   115,   194,   231,
+     473,   474,   477,   115,   139,   462,   115,   464,   115,   466,
+     233,   233,   233,   345,   231,    14,    64,   113,   120,   129,
+     135,   136,   196,   200,   205,   266,   275,   324,   401,   405,
+     408,   432,   433,   434,   445,   446,   447,   448,   115,   481,
+     482,    90,   231,   231,   231,   208,   472,   474,   476,   236,
+     472,    37,    38,    48,    49,    62,    63,   116,   117,   189,
+     195,   205,   209,   210,   211,   212,   213,   214,   215,   225,
+     226,   251,   253,   260,   269,   272,   324,   337,   340,   359,
+     362,   363,   364,   366,   371,   401,   408,   413,   414,   416,
+     417,   418,   419,   420,   421,   422,   424,   425,   426,   427,
+     430,   432,   433,   434,   437,   438,   362,   118,   145,   146,
+     147,   148,   149,   151,   152,   153,   154,   155,   156,   157,
+     158,   159,   161,   163,   164,   165,   166,   167,   169,   170,
+     171,   174,   176,   177,   178,   183,   223,   266,   369,   370,
+     371,   372,   373,   374,   375,   376,   377,   378,   379,   380,
+     381,   382,   383,   384,   385,   386,   387,   388,   389,   390,
+     391,   392,   393,   394,   395,   396,   397,   398,   399,   400,
+     405,   408,   414,   415,   431,   478,     6,     7,   348,   349,
+     351,   353,   355,   357,   358,   363,   405,   408,    51,   115,
+     327,   231,   231,   231,   231,   231,   231,   231,   231,   231,
+     127,   442,   451,   446,   127,   411,   439,   449,   482,   235,
+      39,   258,   259,   245,   246,   115,   475,   252,   254,   231,
+     231,   231,   231,   231,   128,   453,   231,   231,   128,   442,
+     443,   452,   231,   231,   231,   231,   232,   231,   231,   231,
+     231,   231,   362,   411,   412,   440,   449,   231,   231,   231,
+     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
+     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
+     231,   231,   231,   231,   231,   231,   231,   411,   369,     3,
+       4,     5,   358,   411,    15,   402,   403,   338,   115,   121,
+     122,   123,   124,   125,   406,   407,   130,   131,   132,   133,
+     134,   435,   436,   138,   137,   197,   198,   409,   410,   201,
+     202,   203,   204,   261,   267,   268,   231,   109,   444,   454,
+     128,   441,   450,   231,   115,   258,     9,    10,    11,    12,
+     256,   257,   256,   232,   232,   365,   115,   338,   341,   115,
+     231,   193,   208,   443,   231,   229,   230,   115,   115,   222,
+     423,   115,   115,   216,   217,   218,   219,   220,   221,   428,
+     429,   103,   270,   271,    47,   273,   274,   362,   362,   441,
+     231,   119,   186,   186,   186,   186,   150,   150,   150,   187,
+     188,   115,   115,   115,   236,   115,   229,   230,   162,   185,
+     185,   185,   185,   168,   168,   168,   172,   175,   229,   230,
+     229,   230,   229,   230,   184,   115,   479,   369,   232,   352,
+     231,   358,   403,   406,   436,   409,   268,   457,   446,   231,
+     231,   457,   256,   255,   255,   456,   458,   460,   467,   457,
+     235,   366,   235,   429,   270,   273,   234,   234,   456,   115,
+     236,   234,    13,   354,   206,   207,   350,   115,   234,   234,
+     144,   458,   459,   467,   468,   469,   457,   232,   232,   114,
+     471,   471,   115,   115,   115,   480,   231,   235,   471,   471,
+     244,   244,   477,   115,   115,   472,   107,   107,   356,   115,
+     115
+};
 
-#if !SOCKS_CLIENT
-      CMDLINE_OVERRIDE(&sockscf.initial.cmdline, &sockscf.option);
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   237,   239,   238,   238,   240,   240,   241,   241,   241,
+     241,   241,   242,   242,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   244,   245,   244,   246,   244,   248,   247,
+     250,   249,   252,   251,   254,   253,   255,   256,   256,   257,
+     257,   257,   257,   258,   258,   259,   260,   260,   260,   260,
+     261,   263,   264,   262,   265,   265,   266,   267,   267,   267,
+     267,   267,   268,   268,   269,   270,   271,   271,   272,   273,
+     274,   274,   275,   276,   277,   277,   278,   278,   279,   279,
+     280,   281,   283,   282,   284,   285,   287,   286,   288,   288,
+     288,   289,   289,   289,   289,   289,   289,   289,   290,   290,
+     291,   291,   293,   292,   295,   294,   296,   297,   297,   298,
+     298,   298,   298,   298,   298,   298,   298,   299,   299,   299,
+     300,   301,   301,   301,   302,   303,   304,   305,   306,   306,
+     306,   307,   308,   309,   310,   311,   311,   312,   313,   314,
+     314,   315,   315,   316,   317,   317,   318,   318,   319,   320,
+     320,   320,   321,   321,   322,   323,   325,   324,   326,   326,
+     327,   327,   328,   328,   329,   330,   330,   330,   331,   331,
+     332,   334,   333,   336,   335,   337,   338,   338,   339,   340,
+     341,   341,   342,   344,   345,   343,   347,   346,   348,   348,
+     348,   349,   349,   349,   350,   350,   350,   352,   351,   353,
+     354,   355,   356,   356,   357,   357,   357,   357,   358,   358,
+     359,   359,   359,   359,   359,   361,   360,   362,   362,   363,
+     363,   365,   364,   366,   368,   367,   369,   369,   370,   370,
+     370,   370,   370,   370,   370,   370,   371,   371,   371,   371,
+     371,   371,   371,   371,   371,   371,   371,   371,   371,   371,
+     371,   371,   371,   372,   372,   372,   372,   372,   372,   372,
+     372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+     372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+     372,   373,   373,   374,   375,   376,   377,   378,   379,   380,
+     381,   382,   383,   384,   384,   385,   385,   386,   386,   387,
+     387,   388,   389,   390,   391,   392,   393,   394,   395,   396,
+     397,   398,   399,   400,   401,   402,   403,   403,   404,   404,
+     405,   406,   406,   407,   407,   407,   407,   407,   408,   409,
+     409,   410,   410,   411,   412,   413,   413,   413,   414,   414,
+     414,   415,   416,   416,   417,   417,   418,   419,   420,   420,
+     420,   420,   421,   423,   422,   424,   425,   426,   427,   428,
+     428,   428,   428,   428,   428,   429,   429,   430,   431,   432,
+     433,   434,   435,   435,   435,   435,   435,   436,   436,   437,
+     438,   439,   440,   441,   442,   443,   444,   445,   445,   445,
+     445,   445,   445,   445,   445,   445,   445,   445,   445,   446,
+     446,   447,   448,   449,   450,   451,   452,   453,   454,   455,
+     455,   455,   455,   456,   456,   456,   457,   458,   458,   458,
+     458,   458,   458,   459,   459,   459,   459,   460,   460,   461,
+     462,   462,   463,   464,   465,   466,   467,   468,   469,   470,
+     470,   470,   470,   471,   471,   472,   472,   473,   474,   475,
+     476,   477,   478,   479,   480,   481,   482,   482
+};
 
-#if !HAVE_PRIVILEGES
-      if (!sockscf.state.inited) {
-         /*
-          * first time.
-          */
-         if (sockscf.uid.privileged_isset && !sockscf.option.verifyonly) {
-            /*
-             * If we created any logfiles (rather than just opened already
-             * existing ones), they will have been created with the euid/egid
-             * we are started with.  If logfiles created by that euid/egid are
-             * not writable by our configured privileged userid (if any), it
-             * means that upon SIGHUP we will be unable to re-open our own
-             * logfiles.  We therefor check whether the logfile(s) were created
-             * by ourselves, and if so, make sure they have the right owner.
-             */
-            logtype_t *logv[] = { &sockscf.log, &sockscf.errlog };
-            size_t i;
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     0,     4,     3,     0,     2,     1,     1,     1,
+       1,     1,     0,     2,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     3,     0,     4,     0,     4,     0,     6,
+       0,     6,     0,     6,     0,     6,     1,     1,     2,     1,
+       1,     1,     1,     1,     2,     1,     1,     1,     1,     1,
+       1,     0,     0,     9,     0,     2,     3,     1,     1,     1,
+       1,     1,     1,     2,     3,     1,     1,     2,     3,     1,
+       1,     2,     3,     1,     1,     2,     1,     2,     1,     1,
+       4,     0,     0,     4,     4,     0,     0,     4,     3,     3,
+       3,     1,     1,     1,     1,     1,     1,     1,     0,     2,
+       4,     4,     0,     4,     0,     4,     1,     1,     2,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     1,     1,     1,     3,     3,     3,     1,     3,     3,
+       3,     3,     3,     3,     3,     1,     1,     3,     3,     3,
+       3,     3,     3,     3,     1,     1,     1,     2,     3,     1,
+       1,     1,     1,     1,     9,     7,     0,     7,     1,     1,
+       1,     1,     1,     1,     3,     1,     1,     1,     1,     2,
+       3,     0,     4,     0,     4,     3,     1,     2,     1,     3,
+       1,     2,     1,     0,     0,     8,     0,     8,     1,     1,
+       1,     0,     1,     1,     0,     1,     1,     0,     8,     4,
+       1,     7,     0,     2,     1,     1,     1,     1,     0,     2,
+       1,     1,     1,     1,     1,     0,     8,     0,     2,     1,
+       1,     0,     4,     3,     0,     8,     0,     2,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     3,     4,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     1,     1,     2,     1,     1,
+       3,     1,     2,     1,     1,     1,     1,     1,     3,     1,
+       2,     1,     1,     2,     2,     3,     2,     2,     1,     1,
+       1,     1,     1,     1,     3,     3,     3,     5,     1,     1,
+       1,     1,     3,     0,     4,     3,     5,     3,     3,     1,
+       1,     1,     1,     1,     1,     1,     2,     3,     3,     3,
+       3,     3,     1,     1,     1,     1,     1,     1,     2,     4,
+       3,     3,     3,     3,     3,     3,     3,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     2,     1,     1,     0,
+       2,     3,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     2,     3,     1,     3,
+       1,     3,     1,     2,     2,     1,     1,     2,     2,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
+       3,     3,     2,     0,     3,     1,     1,     3,     1,     1,
+       1,     1,     5,     1,     1,     1,     1,     2
+};
 
-            for (i = 0; i < ELEMENTS(logv); ++i) {
-               size_t fi;
 
-               for (fi = 0; fi < logv[i]->filenoc; ++fi) {
-                  if (logv[i]->createdv[fi]) {
-                     slog(LOG_DEBUG,
-                          "%s: chown(2)-ing created logfile %s to %lu/%lu",
-                          function,
-                          logv[i]->fnamev[fi],
-                          (unsigned long)sockscf.uid.privileged_uid,
-                          (unsigned long)sockscf.uid.privileged_gid);
+enum { YYENOMEM = -2 };
 
-                     if (fchown(logv[i]->filenov[fi],
-                                (unsigned long)sockscf.uid.privileged_uid,
-                                (unsigned long)sockscf.uid.privileged_gid) != 0)
-                        serr("%s: could not fchown(2) created logfile %s to "
-                             "privileged uid/gid %lu/%lu.  This means that "
-                             "upon SIGHUP, we would not be unable to re-open "
-                             "our own logfiles.  This should not happen",
-                             function,
-                             logv[i]->fnamev[fi],
-                             (unsigned long)sockscf.uid.privileged_uid,
-                             (unsigned long)sockscf.uid.privileged_gid);
-                  }
-               }
-            }
-         }
-      }
-#endif /* !HAVE_PRIVILEGES */
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
 
-      if (configure_privileges() != 0) {
-         if (sockscf.state.inited) {
-            swarn("%s: could not reinitialize privileges after SIGHUP.  "
-                  "Will continue without privileges",
-                  function);
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
-            sockscf.state.haveprivs = 0;
-         }
-         else
-            serr("%s: could not configure privileges", function);
-      }
-#endif /* !SOCKS_CLIENT */
-   }
 
-   if (yyin != NULL)
-      fclose(yyin);
+#define YYRECOVERING()  (!!yyerrstatus)
 
-   errno = 0;
-   return haveconfig ? 0 : -1;
-}
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
 
-static int
-ipaddr_requires_netmask(context, objecttype)
-   const addresscontext_t context;
-   const objecttype_t objecttype;
-{
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
-   switch (objecttype) {
-      case object_crule:
-#if HAVE_SOCKS_RULES
 
-         return 1;
+/* Enable debugging if requested.  */
+#if YYDEBUG
 
-#else /* !HAVE_SOCKS_RULES */
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
 
-         switch (context) {
-            case from:
-               return 1;
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
 
-            case to:
-               return 0; /* address we accept clients on. */
 
-            case bounce:
-               return 0; /* address we connect to.        */
 
-            default:
-               SERRX(context);
-         }
-#endif /* !HAVE_SOCKS_RULES */
 
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
 
-#if HAVE_SOCKS_HOSTID
-      case object_hrule:
-         return 1;
-#endif /* HAVE_SOCKS_HOSTID */
 
-#if HAVE_SOCKS_RULES
-      case object_srule:
-         return 1;
-#endif /* HAVE_SOCKS_RULES */
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
 
-      case object_route:
-      case object_monitor:
-         return 1;
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
 
-      default:
-         SERRX(objecttype);
-   }
 
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-   /* NOTREACHED */
-   return 0;
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
 
 static void
-addnumber(numberc, numberv, number)
-   size_t *numberc;
-   long long *numberv[];
-   const long long number;
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
-   const char *function = "addnumber()";
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
 
-   if ((*numberv = realloc(*numberv, sizeof(**numberv) * ((*numberc) + 1)))
-   == NULL)
-      yyerror("%s: could not allocate %lu bytes of memory for adding "
-              "number %lld",
-              function, (unsigned long)(sizeof(**numberv) * ((*numberc) + 1)),
-              number);
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
-   (*numberv)[(*numberc)++] = number;
-}
 
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
 
 static void
-addrinit(addr, _netmask_required)
-   ruleaddr_t *addr;
-   const int _netmask_required;
-{
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
 
-   atype            = &addr->atype;
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
 
-   ipv4             = &addr->addr.ipv4.ip;
-   netmask_v4       = &addr->addr.ipv4.mask;
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
 
-   ipv6             = &addr->addr.ipv6.ip;
-   netmask_v6       = &addr->addr.ipv6.maskbits;
-   scopeid_v6       = &addr->addr.ipv6.scopeid;
 
-   ipvany           = &addr->addr.ipvany.ip;
-   netmask_vany     = &addr->addr.ipvany.mask;
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
 
-   if (!_netmask_required) {
-      netmask_v4->s_addr   = htonl(IPV4_FULLNETMASK);
-      *netmask_v6          = IPV6_NETMASKBITS;
-      netmask_vany->s_addr = htonl(IPV4_FULLNETMASK);
-   }
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
 
-   domain           = addr->addr.domain;
-   ifname           = addr->addr.ifname;
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
 
-   port_tcp         = &addr->port.tcp;
-   port_udp         = &addr->port.udp;
-   operator         = &addr->operator;
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
 
-   netmask_required = _netmask_required;
-   ruleaddr         = addr;
-}
 
-static void
-gwaddrinit(addr)
-   sockshost_t *addr;
-{
-   static enum operator_t operatormem;
 
-   netmask_required = 0;
 
-   atype            = &addr->atype;
 
-   ipv4             = &addr->addr.ipv4;
-   ipv6             = &addr->addr.ipv6.ip;
-   domain           = addr->addr.domain;
-   ifname           = addr->addr.ifname;
-   url              = addr->addr.urlname;
 
-   port_tcp         = &addr->port;
-   port_udp         = &addr->port;
-   operator         = &operatormem; /* no operator in gwaddr and not used. */
-}
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
 
 static void
-routeinit(route)
-   route_t *route;
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-   bzero(route, sizeof(*route));
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-   state               = &route->gw.state;
-   extension           = &state->extension;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
 
-   cmethodv            = state->cmethodv;
-   cmethodc            = &state->cmethodc;
-   smethodv            = state->smethodv;
-   smethodc            = &state->smethodc;
 
-#if HAVE_GSSAPI
-   gssapiservicename = state->gssapiservicename;
-   gssapikeytab      = state->gssapikeytab;
-   gssapiencryption  = &state->gssapiencryption;
-#endif /* HAVE_GSSAPI */
+/* Lookahead token kind.  */
+int yychar;
 
-#if !SOCKS_CLIENT && HAVE_LDAP
-   ldap              = &state->ldap;
-#endif /* !SOCKS_CLIENT && HAVE_LDAP*/
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
 
-   bzero(&src, sizeof(src));
-   bzero(&dst, sizeof(dst));
-   src.atype = SOCKS_ADDR_IPV4;
-   dst.atype = SOCKS_ADDR_IPV4;
 
-   bzero(&gw, sizeof(gw));
-   bzero(&rdr_from, sizeof(rdr_from));
-   bzero(&hostid, sizeof(hostid));
-}
 
 
-#if SOCKS_CLIENT
-static void
-parseclientenv(haveproxyserver)
-   int *haveproxyserver;
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
 {
-   const char *function = "parseclientenv()";
-   const char *fprintf_error = "could not write to tmpfile used to hold "
-                               "settings set in environment for parsing";
-   size_t i;
-   FILE *fp;
-   char *p, rdr_from[512], extrarouteinfo[sizeof(rdr_from) + sizeof("\n")],
-        gw[MAXSOCKSHOSTLEN + sizeof(" port = 65535")];
-   int fd;
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
 
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
 
-#if 1
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-#if SOCKS_CLIENT
-   p = "yaccenv-client-XXXXXX";
-#else /* !SOCKS_CLIENT */
-   p = "yaccenv-server-XXXXXX";
-#endif /* !SOCKS_CLIENT */
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-   if ((fd = socks_mklock(p, NULL, 0)) == -1)
-      yyerror("socks_mklock() failed to create tmpfile using base %s", p);
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
-#else /* for debugging file-generation problems. */
-   if ((fd = open("/tmp/dante-envfile",
-                  O_CREAT | O_TRUNC | O_RDWR,
-                  S_IRUSR | S_IWUSR)) == -1)
-      serr("%s: could not open file", function);
-#endif
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
 
-   if ((fp = fdopen(fd, "r+")) == NULL)
-      serr("%s: fdopen(fd %d) failed", function, fd);
 
-   if ((p = socks_getenv(ENV_SOCKS_LOGOUTPUT, dontcare)) != NULL && *p != NUL)
-      if (fprintf(fp, "logoutput: %s\n", p) == -1)
-         serr("%s: %s", function, fprintf_error);
 
-   if ((p = socks_getenv(ENV_SOCKS_ERRLOGOUTPUT, dontcare)) != NULL
-   && *p != NUL)
-      if (fprintf(fp, "errorlog: %s\n", p) == -1)
-         serr("%s: %s", function, fprintf_error);
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
-   if ((p = socks_getenv(ENV_SOCKS_DEBUG, dontcare)) != NULL && *p != NUL)
-      if (fprintf(fp, "debug: %s\n", p) == -1)
-         serr("%s: %s", function, fprintf_error);
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
 
-   *rdr_from = NUL;
-   if ((p = socks_getenv(ENV_SOCKS_REDIRECT_FROM, dontcare)) != NULL
-   && *p != NUL) {
-      const char *prefix = "redirect from";
+  YYDPRINTF ((stderr, "Starting parse\n"));
 
-      if (strlen(prefix) + strlen(p) + 1 > sizeof(rdr_from))
-         serr("%s: %s value is too long.  Max length is %lu",
-              function,
-              ENV_SOCKS_REDIRECT_FROM,
-              (unsigned long)sizeof(rdr_from) - (strlen(prefix) + 1));
+  yychar = YYEMPTY; /* Cause a token to be read.  */
 
-      snprintf(rdr_from, sizeof(rdr_from), "%s: %s\n", prefix, p);
-   }
+  goto yysetstate;
 
-   snprintf(extrarouteinfo, sizeof(extrarouteinfo),
-            "%s", rdr_from);
 
-   /*
-    * Check if there is a proxy server configured in the environment.
-    * Initially assume there is none.
-    */
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
 
-   *haveproxyserver = 0;
 
-   i = 1;
-   while (1) {
-      /* 640 routes should be enough for anyone. */
-      char name[sizeof(ENV_SOCKS_ROUTE_) + sizeof("640")];
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
-      snprintf(name, sizeof(name), "%s%lu", ENV_SOCKS_ROUTE_, (unsigned long)i);
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
 
-      if ((p = socks_getenv(name, dontcare)) == NULL)
-         break;
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
 
-      if (*p != NUL) {
-         if (fprintf(fp, "route { %s }\n", p) == -1)
-            serr("%s: %s", function, fprintf_error);
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
-         *haveproxyserver = 1;
-      }
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-      ++i;
-   }
 
-   if ((p = socks_getenv(ENV_SOCKS4_SERVER, dontcare)) != NULL && *p != NUL) {
-      if (fprintf(fp,
-"route {\n"
-"         from: 0.0.0.0/0 to: 0.0.0.0/0 via: %s\n"
-"         proxyprotocol: socks_v4\n"
-"         %s"
-"}\n",            serverstring2gwstring(p, PROXY_SOCKS_V4, gw, sizeof(gw)),
-                  extrarouteinfo) == -1)
-         serr("%s: %s", function, fprintf_error);
+  if (yystate == YYFINAL)
+    YYACCEPT;
 
-      *haveproxyserver = 1;
-   }
+  goto yybackup;
 
-   if ((p = socks_getenv(ENV_SOCKS5_SERVER, dontcare)) != NULL && *p != NUL) {
-      if (fprintf(fp,
-"route {\n"
-"         from: 0.0.0.0/0 to: 0.0.0.0/0 via: %s\n"
-"         proxyprotocol: socks_v5\n"
-"         %s"
-"}\n",            serverstring2gwstring(p, PROXY_SOCKS_V5, gw, sizeof(gw)),
-                  extrarouteinfo) == -1)
-         serr("%s: %s", function, fprintf_error);
 
-      *haveproxyserver = 1;
-   }
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
 
-   if ((p = socks_getenv(ENV_SOCKS_SERVER, dontcare)) != NULL && *p != NUL) {
-      if (fprintf(fp,
-"route {\n"
-"         from: 0.0.0.0/0 to: 0.0.0.0/0 via: %s\n"
-"         %s"
-"}\n",            serverstring2gwstring(p, PROXY_SOCKS_V5, gw, sizeof(gw)),
-                  extrarouteinfo) == -1)
-         serr("%s: %s", function, fprintf_error);
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
 
-      *haveproxyserver = 1;
-   }
+  /* Not known => get a lookahead token if don't already have one.  */
 
-   if ((p = socks_getenv(ENV_HTTP_PROXY, dontcare)) != NULL && *p != NUL) {
-      struct sockaddr_storage sa;
-      int gaierr;
-      char emsg[512];
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
 
-      if (urlstring2sockaddr(p, &sa, &gaierr, emsg, sizeof(emsg)) == NULL)
-         serr("%s: could not convert to %s to an Internet address",
-              function, p);
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
 
-      if (fprintf(fp,
-"route {\n"
-"         from: 0.0.0.0/0 to: 0.0.0.0/0 via: %s port = %d\n"
-"         proxyprotocol: http_v1.0\n"
-"         %s"
-"}\n",
-                  sockaddr2string2(&sa, 0, NULL, 0),
-                  ntohs(GET_SOCKADDRPORT(&sa)),
-                  extrarouteinfo)
-      == -1)
-         serr("%s: %s", function, fprintf_error);
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
 
-      *haveproxyserver = 1;
-   }
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
 
-   if ((p = socks_getenv(ENV_UPNP_IGD, dontcare)) != NULL && *p != NUL) {
-      if (fprintf(fp,
-"route {\n"
-"         from: 0.0.0.0/0 to: 0.0.0.0/0 via: %s\n"
-"         proxyprotocol: upnp\n"
-"         %s"
-"}\n",            p, extrarouteinfo) == -1)
-         serr("%s: %s", function, fprintf_error);
 
-      *haveproxyserver = 1;
-   }
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
 
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
 
-   /*
-    * End of possible settings we want to parse with yacc/lex.
-    */
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
 
-   if (fseek(fp, 0, SEEK_SET) != 0)
-      yyerror("fseek(3) on tmpfile used to hold environment-settings failed");
 
-   yyin = fp;
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* $@1: %empty  */
+#line 627 "config_parse.y"
+                           {
+#if !SOCKS_CLIENT
+      extension = &sockscf.extension;
+#endif /* !SOCKS_CLIENT*/
+   }
+#line 3110 "config_parse.c"
+    break;
 
-   lex_dorestart             = 1;
-   parsingconfig             = 1;
-   p                         = sockscf.option.configfile;
-   sockscf.option.configfile = "<generated socks.conf>";
+  case 5: /* serverobjects: %empty  */
+#line 635 "config_parse.y"
+               { (yyval.string) = NULL; }
+#line 3116 "config_parse.c"
+    break;
 
-#if SOCKSLIBRARY_DYNAMIC
-   socks_markasnative("*");
-#endif /* SOCKSLIBRARY_DYNAMIC */
+  case 12: /* serveroptions: %empty  */
+#line 646 "config_parse.y"
+                { (yyval.string) = NULL; }
+#line 3122 "config_parse.c"
+    break;
 
-   yyparse();
+  case 42: /* serveroption: socketoption  */
+#line 677 "config_parse.y"
+                            {
+      if (!addedsocketoption(&sockscf.socketoptionc,
+                             &sockscf.socketoptionv,
+                             &socketopt))
+         yywarn("could not add socket option");
+   }
+#line 3133 "config_parse.c"
+    break;
 
-#if SOCKSLIBRARY_DYNAMIC
-   socks_markasnormal("*");
-#endif /* SOCKSLIBRARY_DYNAMIC */
+  case 44: /* $@2: %empty  */
+#line 686 "config_parse.y"
+                                     {
+#if !SOCKS_CLIENT
+                                tcpoptions = &logspecial->protocol.tcp.disabled;
+#endif /* !SOCKS_CLIENT */
+          }
+#line 3143 "config_parse.c"
+    break;
 
-   sockscf.option.configfile = p;
-   parsingconfig             = 0;
+  case 46: /* $@3: %empty  */
+#line 691 "config_parse.y"
+                                    {
+#if !SOCKS_CLIENT
+                                tcpoptions = &logspecial->protocol.tcp.enabled;
+#endif /* !SOCKS_CLIENT */
+          }
+#line 3153 "config_parse.c"
+    break;
 
-   fclose(fp);
+  case 48: /* $@4: %empty  */
+#line 699 "config_parse.y"
+                                      {
+#if !SOCKS_CLIENT
 
-   if (socks_getenv(ENV_SOCKS_AUTOADD_LANROUTES, isfalse) == NULL) {
-      /*
-       * assume it's good to add direct routes for the lan also.
-       */
-      struct ifaddrs *ifap;
+      logspecial = &sockscf.internal.log;
 
-      slog(LOG_DEBUG, "%s: auto-adding direct routes for lan ...", function);
+#endif /* !SOCKS_CLIENT */
 
-      if (getifaddrs(&ifap) == 0) {
-         command_t commands;
-         protocol_t protocols;
-         struct ifaddrs *iface;
+   }
+#line 3166 "config_parse.c"
+    break;
 
-         bzero(&commands, sizeof(commands));
-         bzero(&protocols, sizeof(protocols));
+  case 50: /* $@5: %empty  */
+#line 709 "config_parse.y"
+                                      {
+#if !SOCKS_CLIENT
 
-         protocols.tcp = 1;
-         protocols.udp = 1;
+      logspecial = &sockscf.external.log;
 
-         commands.connect      = 1;
-         commands.udpassociate = 1;
+#endif /* !SOCKS_CLIENT */
 
-         for (iface = ifap; iface != NULL; iface = iface->ifa_next)
-            if (iface->ifa_addr            != NULL
-            &&  iface->ifa_addr->sa_family == AF_INET) {
-               if (iface->ifa_netmask == NULL) {
-                  swarn("interface %s missing netmask, skipping",
-                        iface->ifa_name);
-                  continue;
-               }
+   }
+#line 3179 "config_parse.c"
+    break;
 
-               socks_autoadd_directroute(&commands,
-                                         &protocols,
-                                         TOCSS(iface->ifa_addr),
-                                         TOCSS(iface->ifa_netmask));
-            }
+  case 52: /* $@6: %empty  */
+#line 719 "config_parse.y"
+                                        {
+#if !SOCKS_CLIENT
+
+      logspecial = &rule.internal.log;
+
+#endif /* !SOCKS_CLIENT */
 
-         freeifaddrs(ifap);
-      }
    }
-   else
-      slog(LOG_DEBUG, "%s: not auto-adding direct routes for lan", function);
-}
+#line 3192 "config_parse.c"
+    break;
 
-static char *
-serverstring2gwstring(serverstring, version, gw, gwsize)
-   const char *serverstring;
-   const int version;
-   char *gw;
-   const size_t gwsize;
-{
-   const char *function = "serverstring2gwstring()";
-   char *sep, emsg[256];
+  case 54: /* $@7: %empty  */
+#line 729 "config_parse.y"
+                                        {
+#if !SOCKS_CLIENT
 
-   if (version != PROXY_SOCKS_V4 && version != PROXY_SOCKS_V5)
-      return gw; /* should be in desired format already. */
+      logspecial = &rule.external.log;
 
-   if (strlen(serverstring) >= gwsize)
-      serrx("%s: value of proxyserver (%s) set in environment is too long.  "
-            "Max length is %lu",
-            function, serverstring, (unsigned long)(gwsize - 1));
+#endif /* !SOCKS_CLIENT */
 
-   if ((sep = strrchr(serverstring, ':')) != NULL && *(sep + 1) != NUL) {
-      long port;
+   }
+#line 3205 "config_parse.c"
+    break;
 
-      if ((port = string2portnumber(sep + 1, emsg, sizeof(emsg))) == -1)
-         yyerrorx("%s: %s", function, emsg);
+  case 56: /* loglevel: LOGLEVEL  */
+#line 740 "config_parse.y"
+                   {
+#if !SOCKS_CLIENT
+   SASSERTX((yyvsp[0].number) >= 0);
+   SASSERTX((yyvsp[0].number) < MAXLOGLEVELS);
 
-      memcpy(gw, serverstring, sep - serverstring);
-      snprintf(&gw[sep - serverstring],
-               gwsize - (sep - serverstring),
-               " port = %u",
-               (in_port_t)port);
+   cloglevel = (yyvsp[0].number);
+#endif /* !SOCKS_CLIENT */
    }
-   else {
-      char visbuf[256];
+#line 3218 "config_parse.c"
+    break;
 
-      yyerrorx("%s: could not find portnumber in %s serverstring \"%s\"",
-               function,
-               proxyprotocol2string(version),
-               str2vis(sep == NULL ? serverstring : sep,
-                       strlen(sep == NULL ? serverstring : sep),
-                       visbuf,
-                       sizeof(visbuf)));
+  case 59: /* tcpoption: ECN  */
+#line 754 "config_parse.y"
+               {
+#if !SOCKS_CLIENT
+   SET_TCPOPTION(tcpoptions, cloglevel, ecn);
+#endif /* !SOCKS_CLIENT */
    }
+#line 3228 "config_parse.c"
+    break;
 
-   return gw;
-}
+  case 60: /* tcpoption: SACK  */
+#line 761 "config_parse.y"
+                {
+#if !SOCKS_CLIENT
+   SET_TCPOPTION(tcpoptions, cloglevel, sack);
+#endif /* !SOCKS_CLIENT */
+   }
+#line 3238 "config_parse.c"
+    break;
 
-#else /* !SOCKS_CLIENT */
+  case 61: /* tcpoption: TIMESTAMPS  */
+#line 768 "config_parse.y"
+                      {
+#if !SOCKS_CLIENT
+   SET_TCPOPTION(tcpoptions, cloglevel, timestamps);
+#endif /* !SOCKS_CLIENT */
+   }
+#line 3248 "config_parse.c"
+    break;
 
-static void
-pre_addrule(rule)
-   rule_t *rule;
-{
+  case 62: /* tcpoption: WSCALE  */
+#line 775 "config_parse.y"
+                  {
+#if !SOCKS_CLIENT
+   SET_TCPOPTION(tcpoptions, cloglevel, wscale);
+#endif /* !SOCKS_CLIENT */
+   }
+#line 3258 "config_parse.c"
+    break;
 
-   rule->src   = src;
-   rule->dst   = dst;
+  case 65: /* errorobject: ERRORVALUE  */
+#line 788 "config_parse.y"
+                        {
+#if !SOCKS_CLIENT
 
-#if HAVE_SOCKS_HOSTID
-   rule->hostid      = hostid;
-#endif /* HAVE_SOCKS_HOSTID */
+   if ((yyvsp[0].error).valuev == NULL)
+      yywarnx("unknown error symbol specified");
+   else {
+      size_t *ec, ec_max, i;
+      int *ev;
 
-   rule->rdr_from    = rdr_from;
-   rule->rdr_to      = rdr_to;
+      switch ((yyvsp[0].error).valuetype) {
+         case VALUETYPE_ERRNO:
+            ev     = logspecial->errno_loglevelv[cloglevel];
+            ec     = &logspecial->errno_loglevelc[cloglevel];
+            ec_max = ELEMENTS(logspecial->errno_loglevelv[cloglevel]);
+            break;
 
-   if (session_isset) {
-      if ((rule->ss = malloc(sizeof(*rule->ss))) == NULL)
-         yyerror("failed to malloc(3) %lu bytes for session memory",
-                 (unsigned long)sizeof(*rule->ss));
+         case VALUETYPE_GAIERR:
+            ev     = logspecial->gaierr_loglevelv[cloglevel];
+            ec     = &logspecial->gaierr_loglevelc[cloglevel];
+            ec_max = ELEMENTS(logspecial->gaierr_loglevelv[cloglevel]);
+            break;
 
-      *rule->ss = ss;
-   }
+         default:
+            SERRX((yyvsp[0].error).valuetype);
+      }
 
-   if (bw_isset) {
-      if ((rule->bw = malloc(sizeof(*rule->bw))) == NULL)
-         yyerror("failed to malloc(3) %lu bytes for bw memory",
-                 (unsigned long)sizeof(*rule->bw));
+      for (i = 0; (yyvsp[0].error).valuev[i] != 0; ++i) {
+         /*
+          * If the value is already set in the array, e.g. because some
+          * errno-symbols have the same values, ignore this value.
+          */
+         size_t j;
 
-      *rule->bw = bw;
-   }
-}
+         for (j = 0; j < *ec; ++j) {
+            if (ev[j] == (yyvsp[0].error).valuev[i])
+               break;
+         }
 
+         if (j < *ec)
+            continue; /* error-value already set in array. */
 
-static void
-post_addrule(void)
-{
+         SASSERTX(*ec < ec_max);
 
-   timeout = &sockscf.timeout; /* default is global timeout, unless in a rule */
-}
+         ev[(*ec)] = (yyvsp[0].error).valuev[i];
+         ++(*ec);
+      }
+   }
+#endif /* !SOCKS_CLIENT */
+   }
+#line 3312 "config_parse.c"
+    break;
 
-static void
-ruleinit(rule)
-   rule_t *rule;
-{
-   bzero(rule, sizeof(*rule));
+  case 70: /* deprecated: DEPRECATED  */
+#line 846 "config_parse.y"
+                         {
+      yyerrorx("given keyword \"%s\" is deprecated.  New keyword is %s.  "
+               "Please see %s's manual for more information",
+               (yyvsp[0].deprecated).oldname, (yyvsp[0].deprecated).newname, PRODUCT);
+   }
+#line 3322 "config_parse.c"
+    break;
 
-   rule->linenumber  = yylineno;
+  case 71: /* $@8: %empty  */
+#line 853 "config_parse.y"
+               { objecttype = object_route; }
+#line 3328 "config_parse.c"
+    break;
+
+  case 72: /* $@9: %empty  */
+#line 854 "config_parse.y"
+         { routeinit(&route); }
+#line 3334 "config_parse.c"
+    break;
+
+  case 73: /* route: ROUTE $@8 '{' $@9 routeoptions fromto gateway routeoptions '}'  */
+#line 854 "config_parse.y"
+                                                                             {
+      route.src       = src;
+      route.dst       = dst;
+      route.gw.addr   = gw;
 
-#if HAVE_SOCKS_HOSTID
-   rule->hostindex          = DEFAULT_HOSTINDEX;
-   hostindex                = &rule->hostindex;
+      route.rdr_from  = rdr_from;
 
-   rule->hostidoption_isset = 0;
-   hostidoption_isset       = &rule->hostidoption_isset;
-#endif /* HAVE_SOCKS_HOSTID */
+      socks_addroute(&route, 1);
+   }
+#line 3348 "config_parse.c"
+    break;
 
-   state          = &rule->state;
+  case 74: /* routes: %empty  */
+#line 865 "config_parse.y"
+        { (yyval.string) = NULL; }
+#line 3354 "config_parse.c"
+    break;
 
-   cmethodv       = state->cmethodv;
-   cmethodc       = &state->cmethodc;
+  case 77: /* proxyprotocolname: PROXYPROTOCOL_SOCKS_V4  */
+#line 871 "config_parse.y"
+                                            {
+         state->proxyprotocol.socks_v4 = 1;
+   }
+#line 3362 "config_parse.c"
+    break;
 
-   smethodv       = state->smethodv;
-   smethodc       = &state->smethodc;
+  case 78: /* proxyprotocolname: PROXYPROTOCOL_SOCKS_V5  */
+#line 874 "config_parse.y"
+                              {
+         state->proxyprotocol.socks_v5 = 1;
+   }
+#line 3370 "config_parse.c"
+    break;
 
-   /*
-    * default values: same as global.
-    */
+  case 79: /* proxyprotocolname: PROXYPROTOCOL_HTTP  */
+#line 877 "config_parse.y"
+                         {
+         state->proxyprotocol.http     = 1;
+   }
+#line 3378 "config_parse.c"
+    break;
 
-   timeout       = &rule->timeout;
-   *timeout      = sockscf.timeout;
+  case 80: /* proxyprotocolname: PROXYPROTOCOL_UPNP  */
+#line 880 "config_parse.y"
+                         {
+         state->proxyprotocol.upnp     = 1;
+   }
+#line 3386 "config_parse.c"
+    break;
 
-#if HAVE_GSSAPI
-   gssapiservicename = state->gssapiservicename;
-   gssapikeytab      = state->gssapikeytab;
-   gssapiencryption  = &state->gssapiencryption;
-#endif /* HAVE_GSSAPI */
+  case 85: /* username: USERNAME  */
+#line 893 "config_parse.y"
+                     {
+#if !SOCKS_CLIENT
+      if (addlinkedname(&rule.user, (yyvsp[0].string)) == NULL)
+         yyerror(NOMEM);
+#endif /* !SOCKS_CLIENT */
+   }
+#line 3397 "config_parse.c"
+    break;
 
-#if HAVE_LDAP
-   ldap              = &state->ldap;
-#endif
+  case 89: /* groupname: GROUPNAME  */
+#line 908 "config_parse.y"
+                       {
+#if !SOCKS_CLIENT
+      if (addlinkedname(&rule.group, (yyvsp[0].string)) == NULL)
+         yyerror(NOMEM);
+#endif /* !SOCKS_CLIENT */
+   }
+#line 3408 "config_parse.c"
+    break;
 
-   bzero(&src, sizeof(src));
-   bzero(&dst, sizeof(dst));
-   bzero(&hostid, sizeof(hostid));
+  case 93: /* extensionname: BIND  */
+#line 923 "config_parse.y"
+                      {
+         yywarnx("we are currently considering deprecating the Dante-specific "
+                 "SOCKS bind extension.  If you are using it, please let us "
+                 "know on the public dante-misc@inet.no mailinglist");
 
-   bzero(&rdr_from, sizeof(rdr_from));
-   bzero(&rdr_to, sizeof(rdr_to));
+         extension->bind = 1;
+   }
+#line 3420 "config_parse.c"
+    break;
 
-#if BAREFOOTD
-   bzero(&bounceto, sizeof(bounceto));
-#endif /* BAREFOOTD */
+  case 98: /* ifprotocol: IPV4  */
+#line 941 "config_parse.y"
+                 {
+#if !SOCKS_CLIENT
+      ifproto->ipv4  = 1;
+   }
+#line 3429 "config_parse.c"
+    break;
 
-   rule->bw_isinheritable   = rule->ss_isinheritable = 1;
+  case 99: /* ifprotocol: IPV6  */
+#line 945 "config_parse.y"
+           {
+      ifproto->ipv6  = 1;
+#endif /* SOCKS_SERVER */
+   }
+#line 3438 "config_parse.c"
+    break;
 
-   bzero(&ss, sizeof(ss));
-   bzero(&bw, sizeof(bw));
+  case 100: /* internal: INTERNAL internalinit ':' address  */
+#line 951 "config_parse.y"
+                                              {
+#if !SOCKS_CLIENT
+#if BAREFOOTD
+      yyerrorx("\"internal:\" specification is not used in %s", PRODUCT);
+#endif /* BAREFOOTD */
 
-   bw_isset = session_isset = 0;
-   bw.type  = SHMEM_BW;
-   ss.type  = SHMEM_SS;
-}
+      interfaceprotocol_t ifprotozero;
 
-void
-alarminit(void)
-{
-    static int alarmside_mem;
+      bzero(&ifprotozero, sizeof(ifprotozero));
+      if (memcmp(&ifprotozero,
+                 &sockscf.internal.protocol,
+                 sizeof(sockscf.internal.protocol)) == 0) {
+         slog(LOG_DEBUG, "%s: no address families explicitly enabled on "
+                         "internal interface.  Enabling default address "
+                         "families",
+                         function);
 
-   alarmside  = &alarmside_mem;
-   *alarmside = 0;
-}
+         sockscf.internal.protocol.ipv4 = sockscf.internal.protocol.ipv6 = 1;
+      }
 
-static void
-monitorinit(monitor)
-   monitor_t *monitor;
-{
-   static int alarmside_mem;
+      addinternal(ruleaddr, SOCKS_TCP);
+#endif /* !SOCKS_CLIENT */
+   }
+#line 3466 "config_parse.c"
+    break;
 
-   alarmside = &alarmside_mem;
+  case 101: /* internalinit: %empty  */
+#line 976 "config_parse.y"
+              {
+#if !SOCKS_CLIENT
+   static ruleaddr_t mem;
+   struct servent    *service;
+   serverstate_t     statemem;
 
-   bzero(monitor, sizeof(*monitor));
+   bzero(&statemem, sizeof(statemem));
+   state               = &statemem;
+   state->protocol.tcp = 1;
 
-   monitor->linenumber = yylineno;
+   bzero(&logspecial, sizeof(logspecial));
 
-   state                       = &monitor->state;
+   bzero(&mem, sizeof(mem));
+   addrinit(&mem, 0);
 
-#if HAVE_SOCKS_HOSTID
-   monitor->hostindex          = DEFAULT_HOSTINDEX;
-   hostindex                   = &monitor->hostindex;
+   /* set default port. */
+   if ((service = getservbyname("socks", "tcp")) == NULL)
+      *port_tcp = htons(SOCKD_PORT);
+   else
+      *port_tcp = (in_port_t)service->s_port;
+#endif /* !SOCKS_CLIENT */
+   }
+#line 3493 "config_parse.c"
+    break;
 
-   monitor->hostidoption_isset = 0;
-   hostidoption_isset          = &monitor->hostidoption_isset;
-#endif /* HAVE_SOCKS_HOSTID */
+  case 102: /* $@10: %empty  */
+#line 1000 "config_parse.y"
+                                         {
+#if !SOCKS_CLIENT
+      if (sockscf.internal.addrc > 0) {
+         if (sockscf.state.inited) {
+            /*
+             * Must be running due to SIGHUP.  The internal interface requires
+             * special considerations, so let the SIGHUP code deal with this
+             * later when we know if the change in protocol also results in.
+             * adding a new interface.
+             */
+            ;
+         }
+         else {
+            log_interfaceprotocol_set_too_late(INTERNALIF);
+            exit(1);
+         }
+      }
 
-   bzero(&src, sizeof(src));
-   bzero(&dst, sizeof(dst));
-   bzero(&hostid, sizeof(hostid));
+      ifproto = &sockscf.internal.protocol;
+#endif /* !SOCKS_CLIENT */
+   }
+#line 3519 "config_parse.c"
+    break;
 
-   if ((monitor->mstats = malloc(sizeof(*monitor->mstats))) == NULL)
-      yyerror("failed to malloc(3) %lu bytes for monitor stats memory",
-              (unsigned long)sizeof(*monitor->mstats));
-   else
-      bzero(monitor->mstats, sizeof(*monitor->mstats));
+  case 104: /* external: EXTERNAL externalinit ':' externaladdress  */
+#line 1025 "config_parse.y"
+                                                      {
+#if !SOCKS_CLIENT
+      addexternal(ruleaddr);
+#endif /* !SOCKS_CLIENT */
+   }
+#line 3529 "config_parse.c"
+    break;
 
-   monitor->mstats->type = SHMEM_MONITOR;
-}
+  case 105: /* externalinit: %empty  */
+#line 1032 "config_parse.y"
+              {
+#if !SOCKS_CLIENT
+      static ruleaddr_t mem;
+      interfaceprotocol_t ifprotozero = { 0 };
 
-static void
-pre_addmonitor(monitor)
-   monitor_t *monitor;
-{
-   monitor->src    = src;
-   monitor->dst    = dst;
+      bzero(&mem, sizeof(mem));
+      addrinit(&mem, 0);
 
-#if HAVE_SOCKS_HOSTID
-   monitor->hostid = hostid;
-#endif /* HAVE_SOCKS_HOSTID */
-}
+      if (memcmp(&ifprotozero,
+                 &sockscf.external.protocol,
+                 sizeof(sockscf.external.protocol)) == 0) {
+         slog(LOG_DEBUG, "%s: no address families explicitly enabled on "
+                         "external interface.  Enabling default address "
+                         "families",
+                         function);
 
-static int
-configure_privileges(void)
-{
-   const char *function = "configure_privileges()";
-   static int isfirsttime = 1;
+         sockscf.external.protocol.ipv4 = sockscf.external.protocol.ipv6 = 1;
+      }
+#endif /* !SOCKS_CLIENT */
+   }
+#line 3554 "config_parse.c"
+    break;
 
-   if (sockscf.option.verifyonly)
-      return 0;
+  case 106: /* $@11: %empty  */
+#line 1054 "config_parse.y"
+                                         {
+#if !SOCKS_CLIENT
+      if (sockscf.external.addrc > 0) {
+         log_interfaceprotocol_set_too_late(EXTERNALIF);
+         sockdexit(EXIT_FAILURE);
+      }
 
-#if !HAVE_PRIVILEGES
-   uid_t uid; /* for debugging. */
-   gid_t gid; /* for debugging. */
+      ifproto = &sockscf.external.protocol;
+#endif /* !SOCKS_CLIENT */
+   }
+#line 3569 "config_parse.c"
+    break;
 
-   SASSERTX(sockscf.state.euid == (uid = geteuid()));
-   SASSERTX(sockscf.state.egid == (gid = getegid()));
+  case 108: /* external_rotation: EXTERNAL_ROTATION ':' NONE  */
+#line 1067 "config_parse.y"
+                                                {
+#if !SOCKS_CLIENT
+      sockscf.external.rotation = ROTATION_NONE;
+   }
+#line 3578 "config_parse.c"
+    break;
 
-   /*
-    * Check all configured uids/gids work.
-    */
+  case 109: /* external_rotation: EXTERNAL_ROTATION ':' SAMESAME  */
+#line 1071 "config_parse.y"
+                                      {
+      sockscf.external.rotation = ROTATION_SAMESAME;
+   }
+#line 3586 "config_parse.c"
+    break;
 
-   checkugid(&sockscf.uid.privileged_uid,
-             &sockscf.uid.privileged_gid,
-             &sockscf.uid.privileged_isset,
-             "privileged");
+  case 110: /* external_rotation: EXTERNAL_ROTATION ':' ROUTE  */
+#line 1074 "config_parse.y"
+                                   {
+      sockscf.external.rotation = ROTATION_ROUTE;
+#endif /* SOCKS_SERVER */
+   }
+#line 3595 "config_parse.c"
+    break;
 
-   checkugid(&sockscf.uid.unprivileged_uid,
-             &sockscf.uid.unprivileged_gid,
-             &sockscf.uid.unprivileged_isset,
-             "unprivileged");
+  case 118: /* clientoptions: %empty  */
+#line 1089 "config_parse.y"
+               { (yyval.string) = NULL; }
+#line 3601 "config_parse.c"
+    break;
+
+  case 120: /* global_routeoption: GLOBALROUTEOPTION MAXFAIL ':' NUMBER  */
+#line 1093 "config_parse.y"
+                                                         {
+      if ((yyvsp[0].number) < 0)
+         yyerrorx("max route fails can not be negative (%ld)  Use \"0\" to "
+                  "indicate routes should never be marked as bad",
+                  (long)(yyvsp[0].number));
 
-#if HAVE_LIBWRAP
-   if (!sockscf.uid.libwrap_isset
-   &&  sockscf.uid.unprivileged_isset) {
-      sockscf.uid.libwrap_uid   = sockscf.uid.unprivileged_uid;
-      sockscf.uid.libwrap_gid   = sockscf.uid.unprivileged_gid;
-      sockscf.uid.libwrap_isset = sockscf.uid.unprivileged_isset;
+      sockscf.routeoptions.maxfail = (yyvsp[0].number);
    }
-   else
-      checkugid(&sockscf.uid.libwrap_uid,
-                &sockscf.uid.libwrap_gid,
-                &sockscf.uid.libwrap_isset,
-                "libwrap");
-#endif /* HAVE_LIBWRAP */
+#line 3614 "config_parse.c"
+    break;
 
-   SASSERTX(sockscf.state.euid == (uid = geteuid()));
-   SASSERTX(sockscf.state.egid == (gid = getegid()));
+  case 121: /* global_routeoption: GLOBALROUTEOPTION BADROUTE_EXPIRE ':' NUMBER  */
+#line 1101 "config_parse.y"
+                                                   {
+      if ((yyvsp[0].number) < 0)
+         yyerrorx("route failure expiry time can not be negative (%ld).  "
+                  "Use \"0\" to indicate bad route marking should never expire",
+                  (long)(yyvsp[0].number));
 
-#endif /* !HAVE_PRIVILEGES */
+      sockscf.routeoptions.badexpire = (yyvsp[0].number);
+   }
+#line 3627 "config_parse.c"
+    break;
 
-   if (isfirsttime) {
-      if (sockd_initprivs() != 0) {
-         slog(HAVE_PRIVILEGES ? LOG_INFO : LOG_WARNING,
-              "%s: could not initialize privileges (%s)%s",
-              function,
-              strerror(errno),
-              geteuid() == 0 ?
-                   "" : ".  Usually we need to be started by root if "
-                        "special privileges are to be available");
+  case 122: /* $@12: %empty  */
+#line 1111 "config_parse.y"
+                         { add_to_errlog = 1; }
+#line 3633 "config_parse.c"
+    break;
 
-#if HAVE_PRIVILEGES
-         /*
-          * assume failure in this case is not fatal; some privileges will
-          * not be available to us, and perhaps that is the intention too.
-          */
-         return 0;
+  case 124: /* $@13: %empty  */
+#line 1114 "config_parse.y"
+                         { add_to_errlog = 0; }
+#line 3639 "config_parse.c"
+    break;
 
-#else
-         return -1;
-#endif /* !HAVE_PRIVILEGES */
-      }
+  case 126: /* logoutputdevice: LOGFILE  */
+#line 1117 "config_parse.y"
+                         {
+   int p;
 
-      isfirsttime = 0;
-   }
+   if ((add_to_errlog && failed_to_add_errlog)
+   ||      (!add_to_errlog && failed_to_add_log)) {
+      yywarnx("not adding logfile \"%s\"", (yyvsp[0].string));
 
-   return 0;
-}
-
-static int
-checkugid(uid, gid, isset, type)
-   uid_t *uid;
-   gid_t *gid;
-   unsigned char *isset;
-   const char *type;
-{
-   const char *function = "checkugid()";
-
-   SASSERTX(sockscf.state.euid == geteuid());
-   SASSERTX(sockscf.state.egid == getegid());
-
-   if (sockscf.option.verifyonly)
-      return 0;
-
-   if (!(*isset)) {
-      *uid   = sockscf.state.euid;
-      *gid   = sockscf.state.egid;
-      *isset = 1;
-
-      return 0;
-   }
-
-   if (*uid != sockscf.state.euid) {
-      if (seteuid(*uid) != 0) {
-         swarn("%s: could not seteuid(2) to %s uid %lu",
-               function, type, (unsigned long)*uid);
-
-         return -1;
-      }
-
-      (void)seteuid(0);
-
-      if (seteuid(sockscf.state.euid) != 0) {
-         swarn("%s: could not revert to euid %lu from euid %lu",
-               function,
-               (unsigned long)sockscf.state.euid,
-               (unsigned long)geteuid());
-         SWARN(0);
-
-         sockscf.state.euid = geteuid();
-         return -1;
-      }
+      slog(LOG_ALERT,
+           "%s: not trying to add logfile \"%s\" due to having already failed "
+           "adding logfiles during this SIGHUP.  Only if all logfiles "
+           "specified in the config can be added will we switch to using "
+           "the new logfiles.  Until then, we will continue using only the "
+           "old logfiles",
+           function, (yyvsp[0].string));
    }
+   else {
+      p = socks_addlogfile(add_to_errlog ? &sockscf.errlog : &sockscf.log, (yyvsp[0].string));
 
-   if (*gid != sockscf.state.egid) {
-      (void)seteuid(0);
-
-      if (setegid(*gid) != 0) {
-         swarn("%s: could not setegid(2) to %s gid %lu",
-               function, type, (unsigned long)*gid);
-
-         return -1;
-      }
-
-      (void)seteuid(0);
-
-      if (setegid(sockscf.state.egid) != 0) {
-         swarn("%s: could not revert to egid %lu from euid %lu",
-               function,
-               (unsigned long)sockscf.state.egid,
-               (unsigned long)geteuid());
-         SWARN(0);
-
-         sockscf.state.egid = getegid();
-         return -1;
+#if !SOCKS_CLIENT
+      if (sockscf.state.inited) {
+         if (p == -1) {
+            if (add_to_errlog) {
+               sockscf.errlog       = old_errlog;
+               failed_to_add_errlog = 1;
+            }
+            else {
+               sockscf.log          = old_log;
+               failed_to_add_log    = 1;
+            }
+         }
+         else {
+            sockd_freelogobject(add_to_errlog ?  &old_errlog : &old_log, 1);
+            slog(LOG_DEBUG, "%s: added logfile \"%s\" to %s",
+                 function, (yyvsp[0].string), add_to_errlog ? "errlog" : "logoutput");
+         }
       }
 
-      if (seteuid(sockscf.state.euid) != 0) {
-         swarn("%s: could not revert to euid %lu from euid %lu",
-               function,
-               (unsigned long)sockscf.state.euid,
-               (unsigned long)geteuid());
-         SWARN(0);
+      if (p == -1)
+         slog(LOG_ALERT, "%s: could not (re)open logfile \"%s\": %s%s  %s",
+              function,
+              (yyvsp[0].string),
+              strerror(errno),
+              sockscf.state.inited ?
+                  "." : "",
+              sockscf.state.inited ?
+                  "Will continue using old logfiles" : "");
 
-         sockscf.state.euid = geteuid();
-         return -1;
-      }
+#else /* SOCKS_CLIENT  */
+      if (p == -1)
+         /*
+          * bad, but don't consider it fatal in the client.
+          */
+         yywarn("failed to add logfile %s", (yyvsp[0].string));
+#endif /* SOCKS_CLIENT */
    }
-
-   SASSERTX(sockscf.state.euid == geteuid());
-   SASSERTX(sockscf.state.egid == getegid());
-
-   return 0;
 }
+#line 3700 "config_parse.c"
+    break;
 
+  case 129: /* childstate: PROC_MAXREQUESTS ':' NUMBER  */
+#line 1178 "config_parse.y"
+                                        {
+#if !SOCKS_CLIENT
+      ASSIGN_NUMBER((yyvsp[0].number), >=, 0, sockscf.child.maxrequests, 0);
 #endif /* !SOCKS_CLIENT */
-#line 3427 "config_parse.c"
-/* allocate initial stack or double stack size, up to YYMAXDEPTH */
-static int yygrowstack(void)
-{
-    unsigned int newsize;
-    long sslen;
-    short *newss;
-    YYSTYPE *newvs;
-
-    if ((newsize = yystacksize) == 0)
-        newsize = YYINITSTACKSIZE;
-    else if (newsize >= YYMAXDEPTH)
-        return -1;
-    else if ((newsize *= 2) > YYMAXDEPTH)
-        newsize = YYMAXDEPTH;
-    sslen = yyssp - yyss;
-#ifdef SIZE_MAX
-#define YY_SIZE_MAX SIZE_MAX
-#else
-#define YY_SIZE_MAX 0xffffffffU
-#endif
-    if (newsize && YY_SIZE_MAX / newsize < sizeof *newss)
-        goto bail;
-    newss = yyss ? (short *)realloc(yyss, newsize * sizeof *newss) :
-      (short *)malloc(newsize * sizeof *newss); /* overflow check above */
-    if (newss == NULL)
-        goto bail;
-    yyss = newss;
-    yyssp = newss + sslen;
-    if (newsize && YY_SIZE_MAX / newsize < sizeof *newvs)
-        goto bail;
-    newvs = yyvs ? (YYSTYPE *)realloc(yyvs, newsize * sizeof *newvs) :
-      (YYSTYPE *)malloc(newsize * sizeof *newvs); /* overflow check above */
-    if (newvs == NULL)
-        goto bail;
-    yyvs = newvs;
-    yyvsp = newvs + sslen;
-    yystacksize = newsize;
-    yysslim = yyss + newsize - 1;
-    return 0;
-bail:
-    if (yyss)
-            free(yyss);
-    if (yyvs)
-            free(yyvs);
-    yyss = yyssp = NULL;
-    yyvs = yyvsp = NULL;
-    yystacksize = 0;
-    return -1;
-}
-
-#define YYABORT goto yyabort
-#define YYREJECT goto yyabort
-#define YYACCEPT goto yyaccept
-#define YYERROR goto yyerrlab
-int
-yyparse(void)
-{
-    int yym, yyn, yystate;
-#if YYDEBUG
-    const char *yys;
-
-    if ((yys = getenv("YYDEBUG")))
-    {
-        yyn = *yys;
-        if (yyn >= '0' && yyn <= '9')
-            yydebug = yyn - '0';
-    }
-#endif /* YYDEBUG */
-
-    yynerrs = 0;
-    yyerrflag = 0;
-    yychar = (-1);
-
-    if (yyss == NULL && yygrowstack()) goto yyoverflow;
-    yyssp = yyss;
-    yyvsp = yyvs;
-    *yyssp = yystate = 0;
+   }
+#line 3710 "config_parse.c"
+    break;
 
-yyloop:
-    if ((yyn = yydefred[yystate]) != 0) goto yyreduce;
-    if (yychar < 0)
-    {
-        if ((yychar = yylex()) < 0) yychar = 0;
-#if YYDEBUG
-        if (yydebug)
-        {
-            yys = 0;
-            if (yychar <= YYMAXTOKEN) yys = yyname[yychar];
-            if (!yys) yys = "illegal-symbol";
-            printf("%sdebug: state %d, reading %d (%s)\n",
-                    YYPREFIX, yystate, yychar, yys);
-        }
-#endif
-    }
-    if ((yyn = yysindex[yystate]) && (yyn += yychar) >= 0 &&
-            yyn <= YYTABLESIZE && yycheck[yyn] == yychar)
-    {
-#if YYDEBUG
-        if (yydebug)
-            printf("%sdebug: state %d, shifting to state %d\n",
-                    YYPREFIX, yystate, yytable[yyn]);
-#endif
-        if (yyssp >= yysslim && yygrowstack())
-        {
-            goto yyoverflow;
-        }
-        *++yyssp = yystate = yytable[yyn];
-        *++yyvsp = yylval;
-        yychar = (-1);
-        if (yyerrflag > 0)  --yyerrflag;
-        goto yyloop;
-    }
-    if ((yyn = yyrindex[yystate]) && (yyn += yychar) >= 0 &&
-            yyn <= YYTABLESIZE && yycheck[yyn] == yychar)
-    {
-        yyn = yytable[yyn];
-        goto yyreduce;
-    }
-    if (yyerrflag) goto yyinrecovery;
-#if defined(__GNUC__)
-    goto yynewerror;
-#endif
-yynewerror:
-    yyerror("syntax error");
-#if defined(__GNUC__)
-    goto yyerrlab;
-#endif
-yyerrlab:
-    ++yynerrs;
-yyinrecovery:
-    if (yyerrflag < 3)
-    {
-        yyerrflag = 3;
-        for (;;)
-        {
-            if ((yyn = yysindex[*yyssp]) && (yyn += YYERRCODE) >= 0 &&
-                    yyn <= YYTABLESIZE && yycheck[yyn] == YYERRCODE)
-            {
-#if YYDEBUG
-                if (yydebug)
-                    printf("%sdebug: state %d, error recovery shifting\
- to state %d\n", YYPREFIX, *yyssp, yytable[yyn]);
-#endif
-                if (yyssp >= yysslim && yygrowstack())
-                {
-                    goto yyoverflow;
-                }
-                *++yyssp = yystate = yytable[yyn];
-                *++yyvsp = yylval;
-                goto yyloop;
-            }
-            else
-            {
-#if YYDEBUG
-                if (yydebug)
-                    printf("%sdebug: error recovery discarding state %d\n",
-                            YYPREFIX, *yyssp);
-#endif
-                if (yyssp <= yyss) goto yyabort;
-                --yyssp;
-                --yyvsp;
-            }
-        }
-    }
-    else
-    {
-        if (yychar == 0) goto yyabort;
-#if YYDEBUG
-        if (yydebug)
-        {
-            yys = 0;
-            if (yychar <= YYMAXTOKEN) yys = yyname[yychar];
-            if (!yys) yys = "illegal-symbol";
-            printf("%sdebug: state %d, error recovery discards token %d (%s)\n",
-                    YYPREFIX, yystate, yychar, yys);
-        }
-#endif
-        yychar = (-1);
-        goto yyloop;
-    }
-yyreduce:
-#if YYDEBUG
-    if (yydebug)
-        printf("%sdebug: state %d, reducing by rule %d (%s)\n",
-                YYPREFIX, yystate, yyn, yyrule[yyn]);
-#endif
-    yym = yylen[yyn];
-    if (yym)
-        yyval = yyvsp[1-yym];
-    else
-        memset(&yyval, 0, sizeof yyval);
-    switch (yyn)
-    {
-case 1:
-#line 617 "config_parse.y"
-{
+  case 130: /* childstate: PROC_MAXCLIENTS_NEGOTIATE ':' NUMBER  */
+#line 1183 "config_parse.y"
+                                          {
 #if !SOCKS_CLIENT
-      extension = &sockscf.extension;
-#endif /* !SOCKS_CLIENT*/
-   }
-break;
-case 4:
-#line 625 "config_parse.y"
-{ yyval.string = NULL; }
-break;
-case 11:
-#line 636 "config_parse.y"
-{ yyval.string = NULL; }
-break;
-case 39:
-#line 665 "config_parse.y"
-{
-      if (!addedsocketoption(&sockscf.socketoptionc,
-                             &sockscf.socketoptionv,
-                             &socketopt))
-         yywarn("could not add socket option");
+      ASSIGN_NUMBER((yyvsp[0].number), >=, 1, sockscf.child.maxclients.negotiate, 0);
+#endif /* !SOCKS_CLIENT */
    }
-break;
-case 41:
-#line 674 "config_parse.y"
-{
+#line 3720 "config_parse.c"
+    break;
+
+  case 131: /* childstate: PROC_MAXCLIENTS_IO ':' NUMBER  */
+#line 1188 "config_parse.y"
+                                   {
 #if !SOCKS_CLIENT
-                                tcpoptions = &logspecial->protocol.tcp.disabled;
+      ASSIGN_NUMBER((yyvsp[0].number), >=, 1, sockscf.child.maxclients.io, 0);
 #endif /* !SOCKS_CLIENT */
-          }
-break;
-case 43:
-#line 679 "config_parse.y"
-{
+   }
+#line 3730 "config_parse.c"
+    break;
+
+  case 132: /* childstate: PROC_MAXCLIENTS_REQUEST ':' NUMBER  */
+#line 1193 "config_parse.y"
+                                        {
 #if !SOCKS_CLIENT
-                                tcpoptions = &logspecial->protocol.tcp.enabled;
+      ASSIGN_NUMBER((yyvsp[0].number), >=, 1, sockscf.child.maxclients.request, 0);
 #endif /* !SOCKS_CLIENT */
-          }
-break;
-case 45:
-#line 687 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-
-      logspecial = &sockscf.internal.log;
+   }
+#line 3740 "config_parse.c"
+    break;
 
+  case 133: /* childstate: PROC_REUSEPORT ':' YES  */
+#line 1198 "config_parse.y"
+                            {
+#if !SOCKS_CLIENT
+#ifdef SO_REUSEPORT
+      sockscf.child.reuseport = 1;
+#else /* !SO_REUSEPORT */
+      yyerrorx("SO_REUSEPORT is not supported on this system");
+#endif /* !SO_REUSEPORT */
 #endif /* !SOCKS_CLIENT */
-
    }
-break;
-case 47:
-#line 697 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-
-      logspecial = &sockscf.external.log;
+#line 3754 "config_parse.c"
+    break;
 
+  case 134: /* childstate: PROC_REUSEPORT ':' NO  */
+#line 1207 "config_parse.y"
+                           {
+#if !SOCKS_CLIENT
+      sockscf.child.reuseport = 0;
 #endif /* !SOCKS_CLIENT */
-
    }
-break;
-case 49:
-#line 707 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-
-      logspecial = &rule.internal.log;
+#line 3764 "config_parse.c"
+    break;
 
+  case 135: /* childstate: PROC_ALLINONE ':' YES  */
+#line 1212 "config_parse.y"
+                           {
+#if !SOCKS_CLIENT
+#if SOCKD_ALLINONE && defined(SO_REUSEPORT)
+      sockscf.child.allinone = 1;
+#else /* !SOCKD_ALLINONE || !SO_REUSEPORT */
+      yyerrorx("child.allinone is not supported by this server");
+#endif /* !SOCKD_ALLINONE || !SO_REUSEPORT */
 #endif /* !SOCKS_CLIENT */
-
    }
-break;
-case 51:
-#line 717 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-
-      logspecial = &rule.external.log;
+#line 3778 "config_parse.c"
+    break;
 
+  case 136: /* childstate: PROC_ALLINONE ':' NO  */
+#line 1221 "config_parse.y"
+                          {
+#if !SOCKS_CLIENT
+      sockscf.child.allinone = 0;
 #endif /* !SOCKS_CLIENT */
-
    }
-break;
-case 53:
-#line 728 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-   SASSERTX(yyvsp[0].number >= 0);
-   SASSERTX(yyvsp[0].number < MAXLOGLEVELS);
+#line 3788 "config_parse.c"
+    break;
 
-   cloglevel = yyvsp[0].number;
+  case 137: /* hostcache: HOSTCACHE_ENTRIES ':' NUMBER  */
+#line 1228 "config_parse.y"
+                                        {
+#if !SOCKS_CLIENT
+      ASSIGN_NUMBER((yyvsp[0].number), >=, 0, sockscf.hostcache.entries, 0);
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 56:
-#line 742 "config_parse.y"
-{
+#line 3798 "config_parse.c"
+    break;
+
+  case 138: /* hostcache: HOSTCACHE_TTL_MIN ':' NUMBER  */
+#line 1233 "config_parse.y"
+                                  {
 #if !SOCKS_CLIENT
-   SET_TCPOPTION(tcpoptions, cloglevel, ecn);
+      ASSIGN_NUMBER((yyvsp[0].number), >=, 1, sockscf.hostcache.ttl.min, 1);
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 57:
-#line 749 "config_parse.y"
-{
+#line 3808 "config_parse.c"
+    break;
+
+  case 139: /* hostcache: HOSTCACHE_TTL_MAX ':' NUMBER  */
+#line 1238 "config_parse.y"
+                                  {
 #if !SOCKS_CLIENT
-   SET_TCPOPTION(tcpoptions, cloglevel, sack);
+      ASSIGN_NUMBER((yyvsp[0].number), >=, 1, sockscf.hostcache.ttl.max, 1);
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 58:
-#line 756 "config_parse.y"
-{
+#line 3818 "config_parse.c"
+    break;
+
+  case 140: /* happyeyeballs: HAPPYEYEBALLS_DELAY ':' NUMBER  */
+#line 1245 "config_parse.y"
+                                              {
 #if !SOCKS_CLIENT
-   SET_TCPOPTION(tcpoptions, cloglevel, timestamps);
+      ASSIGN_NUMBER((yyvsp[0].number), >=, 0, sockscf.happyeyeballs.delay, 1);
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 59:
-#line 763 "config_parse.y"
-{
+#line 3828 "config_parse.c"
+    break;
+
+  case 144: /* user_privileged: USER_PRIVILEGED ':' userid  */
+#line 1257 "config_parse.y"
+                                              {
 #if !SOCKS_CLIENT
-   SET_TCPOPTION(tcpoptions, cloglevel, wscale);
+#if HAVE_PRIVILEGES
+      yyerrorx("userid-settings not used on platforms with privileges");
+#else
+      sockscf.uid.privileged_uid   = (yyvsp[0].uid).uid;
+      sockscf.uid.privileged_gid   = (yyvsp[0].uid).gid;
+      sockscf.uid.privileged_isset = 1;
+#endif /* !HAVE_PRIVILEGES */
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 62:
-#line 776 "config_parse.y"
-{
+#line 3844 "config_parse.c"
+    break;
+
+  case 145: /* user_unprivileged: USER_UNPRIVILEGED ':' userid  */
+#line 1270 "config_parse.y"
+                                                  {
 #if !SOCKS_CLIENT
+#if HAVE_PRIVILEGES
+      yyerrorx("userid-settings not used on platforms with privileges");
+#else
+      sockscf.uid.unprivileged_uid   = (yyvsp[0].uid).uid;
+      sockscf.uid.unprivileged_gid   = (yyvsp[0].uid).gid;
+      sockscf.uid.unprivileged_isset = 1;
+#endif /* !HAVE_PRIVILEGES */
+#endif /* !SOCKS_CLIENT */
+   }
+#line 3860 "config_parse.c"
+    break;
 
-   if (yyvsp[0].error.valuev == NULL)
-      yywarnx("unknown error symbol specified");
-   else {
-      size_t *ec, ec_max, i;
-      int *ev;
+  case 146: /* user_libwrap: USER_LIBWRAP ':' userid  */
+#line 1283 "config_parse.y"
+                                        {
+#if HAVE_LIBWRAP && (!SOCKS_CLIENT)
 
-      switch (yyvsp[0].error.valuetype) {
-         case VALUETYPE_ERRNO:
-            ev     = logspecial->errno_loglevelv[cloglevel];
-            ec     = &logspecial->errno_loglevelc[cloglevel];
-            ec_max = ELEMENTS(logspecial->errno_loglevelv[cloglevel]);
-            break;
+#if HAVE_PRIVILEGES
+      yyerrorx("userid-settings not used on platforms with privileges");
 
-         case VALUETYPE_GAIERR:
-            ev     = logspecial->gaierr_loglevelv[cloglevel];
-            ec     = &logspecial->gaierr_loglevelc[cloglevel];
-            ec_max = ELEMENTS(logspecial->gaierr_loglevelv[cloglevel]);
-            break;
+#else
+      sockscf.uid.libwrap_uid   = (yyvsp[0].uid).uid;
+      sockscf.uid.libwrap_gid   = (yyvsp[0].uid).gid;
+      sockscf.uid.libwrap_isset = 1;
+#endif /* !HAVE_PRIVILEGES */
 
-         default:
-            SERRX(yyvsp[0].error.valuetype);
-      }
+#else  /* !HAVE_LIBWRAP && (!SOCKS_CLIENT) */
+      yyerrorx_nolib("libwrap");
+#endif /* !HAVE_LIBWRAP (!SOCKS_CLIENT)*/
+   }
+#line 3881 "config_parse.c"
+    break;
 
-      for (i = 0; yyvsp[0].error.valuev[i] != 0; ++i) {
-         /*
-          * If the value is already set in the array, e.g. because some
-          * errno-symbols have the same values, ignore this value.
-          */
-         size_t j;
+  case 147: /* userid: USERNAME  */
+#line 1302 "config_parse.y"
+                   {
+      struct passwd *pw;
 
-         for (j = 0; j < *ec; ++j) {
-            if (ev[j] == yyvsp[0].error.valuev[i])
-               break;
-         }
+      if ((pw = getpwnam((yyvsp[0].string))) == NULL)
+         yyerror("getpwnam(3) says no such user \"%s\"", (yyvsp[0].string));
 
-         if (j < *ec)
-            continue; /* error-value already set in array. */
+      (yyval.uid).uid = pw->pw_uid;
 
-         SASSERTX(*ec < ec_max);
+      if ((pw = getpwuid((yyval.uid).uid)) == NULL)
+         yyerror("getpwuid(3) says no such uid %lu (from user \"%s\")",
+                 (unsigned long)(yyval.uid).uid, (yyvsp[0].string));
 
-         ev[(*ec)] = yyvsp[0].error.valuev[i];
-         ++(*ec);
-      }
-   }
-#endif /* !SOCKS_CLIENT */
+      (yyval.uid).gid = pw->pw_gid;
    }
-break;
-case 67:
-#line 834 "config_parse.y"
-{
-      yyerrorx("given keyword \"%s\" is deprecated.  New keyword is %s.  "
-               "Please see %s's manual for more information",
-               yyvsp[0].deprecated.oldname, yyvsp[0].deprecated.newname, PRODUCT);
-   }
-break;
-case 68:
-#line 841 "config_parse.y"
-{ objecttype = object_route; }
-break;
-case 69:
-#line 842 "config_parse.y"
-{ routeinit(&route); }
-break;
-case 70:
-#line 842 "config_parse.y"
-{
-      route.src       = src;
-      route.dst       = dst;
-      route.gw.addr   = gw;
-
-      route.rdr_from  = rdr_from;
+#line 3900 "config_parse.c"
+    break;
 
-      socks_addroute(&route, 1);
-   }
-break;
-case 71:
-#line 853 "config_parse.y"
-{ yyval.string = NULL; }
-break;
-case 74:
-#line 859 "config_parse.y"
-{
-         state->proxyprotocol.socks_v4 = 1;
-   }
-break;
-case 75:
-#line 862 "config_parse.y"
-{
-         state->proxyprotocol.socks_v5 = 1;
-   }
-break;
-case 76:
-#line 865 "config_parse.y"
-{
-         state->proxyprotocol.http     = 1;
+  case 148: /* iotimeout: IOTIMEOUT ':' NUMBER  */
+#line 1318 "config_parse.y"
+                                  {
+#if !SOCKS_CLIENT
+      ASSIGN_NUMBER((yyvsp[0].number), >=, 0, timeout->tcpio, 1);
+      timeout->udpio = timeout->tcpio;
    }
-break;
-case 77:
-#line 868 "config_parse.y"
-{
-         state->proxyprotocol.upnp     = 1;
+#line 3910 "config_parse.c"
+    break;
+
+  case 149: /* iotimeout: IOTIMEOUT_TCP ':' NUMBER  */
+#line 1323 "config_parse.y"
+                               {
+      ASSIGN_NUMBER((yyvsp[0].number), >=, 0, timeout->tcpio, 1);
    }
-break;
-case 82:
-#line 881 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-      if (addlinkedname(&rule.user, yyvsp[0].string) == NULL)
-         yyerror(NOMEM);
+#line 3918 "config_parse.c"
+    break;
+
+  case 150: /* iotimeout: IOTIMEOUT_UDP ':' NUMBER  */
+#line 1326 "config_parse.y"
+                               {
+      ASSIGN_NUMBER((yyvsp[0].number), >=, 0, timeout->udpio, 1);
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 86:
-#line 896 "config_parse.y"
-{
+#line 3927 "config_parse.c"
+    break;
+
+  case 151: /* negotiatetimeout: NEGOTIATETIMEOUT ':' NUMBER  */
+#line 1332 "config_parse.y"
+                                                {
 #if !SOCKS_CLIENT
-      if (addlinkedname(&rule.group, yyvsp[0].string) == NULL)
-         yyerror(NOMEM);
+      ASSIGN_NUMBER((yyvsp[0].number), >=, 0, timeout->negotiate, 1);
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 90:
-#line 911 "config_parse.y"
-{
-         yywarnx("we are currently considering deprecating the Dante-specific "
-                 "SOCKS bind extension.  If you are using it, please let us "
-                 "know on the public dante-misc@inet.no mailinglist");
+#line 3937 "config_parse.c"
+    break;
 
-         extension->bind = 1;
+  case 152: /* connecttimeout: CONNECTTIMEOUT ':' NUMBER  */
+#line 1339 "config_parse.y"
+                                            {
+      ASSIGN_NUMBER((yyvsp[0].number), >=, 0, timeout->connect, 1);
    }
-break;
-case 95:
-#line 929 "config_parse.y"
-{
+#line 3945 "config_parse.c"
+    break;
+
+  case 153: /* tcp_fin_timeout: TCP_FIN_WAIT ':' NUMBER  */
+#line 1344 "config_parse.y"
+                                           {
 #if !SOCKS_CLIENT
-      ifproto->ipv4  = 1;
-   }
-break;
-case 96:
-#line 933 "config_parse.y"
-{
-      ifproto->ipv6  = 1;
-#endif /* SOCKS_SERVER */
+      ASSIGN_NUMBER((yyvsp[0].number), >=, 0, timeout->tcp_fin_wait, 1);
+#endif /* !SOCKS_CLIENT */
    }
-break;
-case 97:
-#line 939 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-#if BAREFOOTD
-      yyerrorx("\"internal:\" specification is not used in %s", PRODUCT);
-#endif /* BAREFOOTD */
+#line 3955 "config_parse.c"
+    break;
 
-      interfaceprotocol_t ifprotozero;
+  case 154: /* debugging: DEBUGGING ':' NUMBER  */
+#line 1352 "config_parse.y"
+                                {
+#if SOCKS_CLIENT
 
-      bzero(&ifprotozero, sizeof(ifprotozero));
-      if (memcmp(&ifprotozero,
-                 &sockscf.internal.protocol,
-                 sizeof(sockscf.internal.protocol)) == 0) {
-         slog(LOG_DEBUG, "%s: no address families explicitly enabled on "
-                         "internal interface.  Enabling default address "
-                         "families",
-                         function);
+       sockscf.option.debug = (int)(yyvsp[0].number);
 
-         sockscf.internal.protocol.ipv4 = sockscf.internal.protocol.ipv6 = 1;
-      }
+#else /* !SOCKS_CLIENT */
+
+      if (sockscf.initial.cmdline.debug_isset
+      &&  sockscf.initial.cmdline.debug != (yyvsp[0].number))
+         LOG_CMDLINE_OVERRIDE("debug",
+                              sockscf.initial.cmdline.debug,
+                              (int)(yyvsp[0].number),
+                              "%d");
+      else
+         sockscf.option.debug = (int)(yyvsp[0].number);
 
-      addinternal(ruleaddr, SOCKS_TCP);
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 98:
-#line 964 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-   static ruleaddr_t mem;
-   struct servent    *service;
-   serverstate_t     statemem;
-
-   bzero(&statemem, sizeof(statemem));
-   state               = &statemem;
-   state->protocol.tcp = 1;
-
-   bzero(&logspecial, sizeof(logspecial));
+#line 3978 "config_parse.c"
+    break;
 
-   bzero(&mem, sizeof(mem));
-   addrinit(&mem, 0);
+  case 157: /* libwrap_allowfile: LIBWRAP_ALLOW ':' LIBWRAP_FILE  */
+#line 1376 "config_parse.y"
+                                                  {
+#if !SOCKS_CLIENT
+#if HAVE_LIBWRAP
+      if ((hosts_allow_table  = strdup((yyvsp[0].string))) == NULL)
+         yyerror(NOMEM);
 
-   /* set default port. */
-   if ((service = getservbyname("socks", "tcp")) == NULL)
-      *port_tcp = htons(SOCKD_PORT);
-   else
-      *port_tcp = (in_port_t)service->s_port;
+      slog(LOG_DEBUG, "%s: libwrap.allow: %s", function, hosts_allow_table);
+#else
+      yyerrorx_nolib("libwrap");
+#endif /* HAVE_LIBWRAP */
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 99:
-#line 988 "config_parse.y"
-{
+#line 3995 "config_parse.c"
+    break;
+
+  case 158: /* libwrap_denyfile: LIBWRAP_DENY ':' LIBWRAP_FILE  */
+#line 1390 "config_parse.y"
+                                                {
 #if !SOCKS_CLIENT
-      if (sockscf.internal.addrc > 0) {
-         if (sockscf.state.inited) {
-            /*
-             * Must be running due to SIGHUP.  The internal interface requires
-             * special considerations, so let the SIGHUP code deal with this
-             * later when we know if the change in protocol also results in.
-             * adding a new interface.
-             */
-            ;
-         }
-         else {
-            log_interfaceprotocol_set_too_late(INTERNALIF);
-            exit(1);
-         }
-      }
+#if HAVE_LIBWRAP
+      if ((hosts_deny_table  = strdup((yyvsp[0].string))) == NULL)
+         yyerror(NOMEM);
 
-      ifproto = &sockscf.internal.protocol;
+      slog(LOG_DEBUG, "%s: libwrap.deny: %s", function, hosts_deny_table);
+#else
+      yyerrorx_nolib("libwrap");
+#endif /* HAVE_LIBWRAP */
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 101:
-#line 1013 "config_parse.y"
-{
+#line 4012 "config_parse.c"
+    break;
+
+  case 159: /* libwrap_hosts_access: LIBWRAP_HOSTS_ACCESS ':' YES  */
+#line 1404 "config_parse.y"
+                                                   {
 #if !SOCKS_CLIENT
-      addexternal(ruleaddr);
-#endif /* !SOCKS_CLIENT */
+#if HAVE_LIBWRAP
+      sockscf.option.hosts_access = 1;
+#else
+      yyerrorx("libwrap.hosts_access requires libwrap library");
+#endif /* HAVE_LIBWRAP */
    }
-break;
-case 102:
-#line 1020 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-      static ruleaddr_t mem;
-      interfaceprotocol_t ifprotozero = { 0 };
-
-      bzero(&mem, sizeof(mem));
-      addrinit(&mem, 0);
-
-      if (memcmp(&ifprotozero,
-                 &sockscf.external.protocol,
-                 sizeof(sockscf.external.protocol)) == 0) {
-         slog(LOG_DEBUG, "%s: no address families explicitly enabled on "
-                         "external interface.  Enabling default address "
-                         "families",
-                         function);
+#line 4025 "config_parse.c"
+    break;
 
-         sockscf.external.protocol.ipv4 = sockscf.external.protocol.ipv6 = 1;
-      }
+  case 160: /* libwrap_hosts_access: LIBWRAP_HOSTS_ACCESS ':' NO  */
+#line 1412 "config_parse.y"
+                                 {
+#if HAVE_LIBWRAP
+      sockscf.option.hosts_access = 0;
+#else
+      yyerrorx_nolib("libwrap");
+#endif /* HAVE_LIBWRAP */
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 103:
-#line 1042 "config_parse.y"
-{
+#line 4038 "config_parse.c"
+    break;
+
+  case 161: /* udpconnectdst: UDPCONNECTDST ':' YES  */
+#line 1422 "config_parse.y"
+                                     {
 #if !SOCKS_CLIENT
-      if (sockscf.external.addrc > 0) {
-         log_interfaceprotocol_set_too_late(EXTERNALIF);
-         sockdexit(EXIT_FAILURE);
-      }
+      sockscf.udpconnectdst = 1;
+   }
+#line 4047 "config_parse.c"
+    break;
 
-      ifproto = &sockscf.external.protocol;
+  case 162: /* udpconnectdst: UDPCONNECTDST ':' NO  */
+#line 1426 "config_parse.y"
+                          {
+      sockscf.udpconnectdst = 0;
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 105:
-#line 1055 "config_parse.y"
-{
+#line 4056 "config_parse.c"
+    break;
+
+  case 164: /* compatibilityname: SAMEPORT  */
+#line 1436 "config_parse.y"
+                            {
 #if !SOCKS_CLIENT
-      sockscf.external.rotation = ROTATION_NONE;
-   }
-break;
-case 106:
-#line 1059 "config_parse.y"
-{
-      sockscf.external.rotation = ROTATION_SAMESAME;
+      sockscf.compat.sameport = 1;
    }
-break;
-case 107:
-#line 1062 "config_parse.y"
-{
-      sockscf.external.rotation = ROTATION_ROUTE;
-#endif /* SOCKS_SERVER */
+#line 4065 "config_parse.c"
+    break;
+
+  case 165: /* compatibilityname: DRAFT_5_05  */
+#line 1440 "config_parse.y"
+                 {
+      sockscf.compat.draft_5_05 = 1;
+#endif /* !SOCKS_CLIENT */
    }
-break;
-case 115:
-#line 1077 "config_parse.y"
-{ yyval.string = NULL; }
-break;
-case 117:
-#line 1081 "config_parse.y"
-{
-      if (yyvsp[0].number < 0)
-         yyerrorx("max route fails can not be negative (%ld)  Use \"0\" to "
-                  "indicate routes should never be marked as bad",
-                  (long)yyvsp[0].number);
+#line 4074 "config_parse.c"
+    break;
 
-      sockscf.routeoptions.maxfail = yyvsp[0].number;
+  case 169: /* resolveprotocolname: PROTOCOL_FAKE  */
+#line 1453 "config_parse.y"
+                                     {
+         sockscf.resolveprotocol = RESOLVEPROTOCOL_FAKE;
    }
-break;
-case 118:
-#line 1089 "config_parse.y"
-{
-      if (yyvsp[0].number < 0)
-         yyerrorx("route failure expiry time can not be negative (%ld).  "
-                  "Use \"0\" to indicate bad route marking should never expire",
-                  (long)yyvsp[0].number);
-
-      sockscf.routeoptions.badexpire = yyvsp[0].number;
-   }
-break;
-case 119:
-#line 1099 "config_parse.y"
-{ add_to_errlog = 1; }
-break;
-case 121:
-#line 1102 "config_parse.y"
-{ add_to_errlog = 0; }
-break;
-case 123:
-#line 1105 "config_parse.y"
-{
-   int p;
+#line 4082 "config_parse.c"
+    break;
 
-   if ((add_to_errlog && failed_to_add_errlog)
-   ||      (!add_to_errlog && failed_to_add_log)) {
-      yywarnx("not adding logfile \"%s\"", yyvsp[0].string);
+  case 170: /* resolveprotocolname: PROTOCOL_TCP  */
+#line 1456 "config_parse.y"
+                   {
+#if HAVE_NO_RESOLVESTUFF
+         yyerrorx("resolveprotocol keyword not supported on this system");
+#else
+         sockscf.resolveprotocol = RESOLVEPROTOCOL_TCP;
+#endif /* !HAVE_NO_RESOLVESTUFF */
+   }
+#line 4094 "config_parse.c"
+    break;
 
-      slog(LOG_ALERT,
-           "%s: not trying to add logfile \"%s\" due to having already failed "
-           "adding logfiles during this SIGHUP.  Only if all logfiles "
-           "specified in the config can be added will we switch to using "
-           "the new logfiles.  Until then, we will continue using only the "
-           "old logfiles",
-           function, yyvsp[0].string);
+  case 171: /* resolveprotocolname: PROTOCOL_UDP  */
+#line 1463 "config_parse.y"
+                    {
+         sockscf.resolveprotocol = RESOLVEPROTOCOL_UDP;
    }
-   else {
-      p = socks_addlogfile(add_to_errlog ? &sockscf.errlog : &sockscf.log, yyvsp[0].string);
+#line 4102 "config_parse.c"
+    break;
 
+  case 174: /* cpuschedule: CPU '.' SCHEDULE '.' PROCESSTYPE ':' SCHEDULEPOLICY '/' NUMBER  */
+#line 1472 "config_parse.y"
+                                                                            {
 #if !SOCKS_CLIENT
-      if (sockscf.state.inited) {
-         if (p == -1) {
-            if (add_to_errlog) {
-               sockscf.errlog       = old_errlog;
-               failed_to_add_errlog = 1;
-            }
-            else {
-               sockscf.log          = old_log;
-               failed_to_add_log    = 1;
-            }
-         }
-         else {
-            sockd_freelogobject(add_to_errlog ?  &old_errlog : &old_log, 1);
-            slog(LOG_DEBUG, "%s: added logfile \"%s\" to %s",
-                 function, yyvsp[0].string, add_to_errlog ? "errlog" : "logoutput");
-         }
-      }
+#if !HAVE_SCHED_SETSCHEDULER
+      yyerrorx("cpu scheduling policy is not supported on this system");
+#else /* HAVE_SCHED_SETSCHEDULER */
+      cpusetting_t *cpusetting;
 
-      if (p == -1)
-         slog(LOG_ALERT, "%s: could not (re)open logfile \"%s\": %s%s  %s",
-              function,
-              yyvsp[0].string,
-              strerror(errno),
-              sockscf.state.inited ?
-                  "." : "",
-              sockscf.state.inited ?
-                  "Will continue using old logfiles" : "");
-
-#else /* SOCKS_CLIENT  */
-      if (p == -1)
-         /*
-          * bad, but don't consider it fatal in the client.
-          */
-         yywarn("failed to add logfile %s", yyvsp[0].string);
-#endif /* SOCKS_CLIENT */
-   }
-}
-break;
-case 126:
-#line 1166 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-      ASSIGN_NUMBER(yyvsp[0].number, >=, 0, sockscf.child.maxrequests, 0);
-#endif /* !SOCKS_CLIENT */
-   }
-break;
-case 130:
-#line 1178 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-#if HAVE_PRIVILEGES
-      yyerrorx("userid-settings not used on platforms with privileges");
-#else
-      sockscf.uid.privileged_uid   = yyvsp[0].uid.uid;
-      sockscf.uid.privileged_gid   = yyvsp[0].uid.gid;
-      sockscf.uid.privileged_isset = 1;
-#endif /* !HAVE_PRIVILEGES */
-#endif /* !SOCKS_CLIENT */
-   }
-break;
-case 131:
-#line 1191 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-#if HAVE_PRIVILEGES
-      yyerrorx("userid-settings not used on platforms with privileges");
-#else
-      sockscf.uid.unprivileged_uid   = yyvsp[0].uid.uid;
-      sockscf.uid.unprivileged_gid   = yyvsp[0].uid.gid;
-      sockscf.uid.unprivileged_isset = 1;
-#endif /* !HAVE_PRIVILEGES */
-#endif /* !SOCKS_CLIENT */
-   }
-break;
-case 132:
-#line 1204 "config_parse.y"
-{
-#if HAVE_LIBWRAP && (!SOCKS_CLIENT)
-
-#if HAVE_PRIVILEGES
-      yyerrorx("userid-settings not used on platforms with privileges");
-
-#else
-      sockscf.uid.libwrap_uid   = yyvsp[0].uid.uid;
-      sockscf.uid.libwrap_gid   = yyvsp[0].uid.gid;
-      sockscf.uid.libwrap_isset = 1;
-#endif /* !HAVE_PRIVILEGES */
-
-#else  /* !HAVE_LIBWRAP && (!SOCKS_CLIENT) */
-      yyerrorx_nolib("libwrap");
-#endif /* !HAVE_LIBWRAP (!SOCKS_CLIENT)*/
-   }
-break;
-case 133:
-#line 1223 "config_parse.y"
-{
-      struct passwd *pw;
-
-      if ((pw = getpwnam(yyvsp[0].string)) == NULL)
-         yyerror("getpwnam(3) says no such user \"%s\"", yyvsp[0].string);
-
-      yyval.uid.uid = pw->pw_uid;
-
-      if ((pw = getpwuid(yyval.uid.uid)) == NULL)
-         yyerror("getpwuid(3) says no such uid %lu (from user \"%s\")",
-                 (unsigned long)yyval.uid.uid, yyvsp[0].string);
-
-      yyval.uid.gid = pw->pw_gid;
-   }
-break;
-case 134:
-#line 1239 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-      ASSIGN_NUMBER(yyvsp[0].number, >=, 0, timeout->tcpio, 1);
-      timeout->udpio = timeout->tcpio;
-   }
-break;
-case 135:
-#line 1244 "config_parse.y"
-{
-      ASSIGN_NUMBER(yyvsp[0].number, >=, 0, timeout->tcpio, 1);
-   }
-break;
-case 136:
-#line 1247 "config_parse.y"
-{
-      ASSIGN_NUMBER(yyvsp[0].number, >=, 0, timeout->udpio, 1);
-#endif /* !SOCKS_CLIENT */
-   }
-break;
-case 137:
-#line 1253 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-      ASSIGN_NUMBER(yyvsp[0].number, >=, 0, timeout->negotiate, 1);
-#endif /* !SOCKS_CLIENT */
-   }
-break;
-case 138:
-#line 1260 "config_parse.y"
-{
-      ASSIGN_NUMBER(yyvsp[0].number, >=, 0, timeout->connect, 1);
-   }
-break;
-case 139:
-#line 1265 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-      ASSIGN_NUMBER(yyvsp[0].number, >=, 0, timeout->tcp_fin_wait, 1);
-#endif /* !SOCKS_CLIENT */
-   }
-break;
-case 140:
-#line 1273 "config_parse.y"
-{
-#if SOCKS_CLIENT
-
-       sockscf.option.debug = (int)yyvsp[0].number;
-
-#else /* !SOCKS_CLIENT */
-
-      if (sockscf.initial.cmdline.debug_isset
-      &&  sockscf.initial.cmdline.debug != yyvsp[0].number)
-         LOG_CMDLINE_OVERRIDE("debug",
-                              sockscf.initial.cmdline.debug,
-                              (int)yyvsp[0].number,
-                              "%d");
-      else
-         sockscf.option.debug = (int)yyvsp[0].number;
-
-#endif /* !SOCKS_CLIENT */
-   }
-break;
-case 143:
-#line 1297 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-#if HAVE_LIBWRAP
-      if ((hosts_allow_table  = strdup(yyvsp[0].string)) == NULL)
-         yyerror(NOMEM);
-
-      slog(LOG_DEBUG, "%s: libwrap.allow: %s", function, hosts_allow_table);
-#else
-      yyerrorx_nolib("libwrap");
-#endif /* HAVE_LIBWRAP */
-#endif /* !SOCKS_CLIENT */
-   }
-break;
-case 144:
-#line 1311 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-#if HAVE_LIBWRAP
-      if ((hosts_deny_table  = strdup(yyvsp[0].string)) == NULL)
-         yyerror(NOMEM);
-
-      slog(LOG_DEBUG, "%s: libwrap.deny: %s", function, hosts_deny_table);
-#else
-      yyerrorx_nolib("libwrap");
-#endif /* HAVE_LIBWRAP */
-#endif /* !SOCKS_CLIENT */
-   }
-break;
-case 145:
-#line 1325 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-#if HAVE_LIBWRAP
-      sockscf.option.hosts_access = 1;
-#else
-      yyerrorx("libwrap.hosts_access requires libwrap library");
-#endif /* HAVE_LIBWRAP */
-   }
-break;
-case 146:
-#line 1333 "config_parse.y"
-{
-#if HAVE_LIBWRAP
-      sockscf.option.hosts_access = 0;
-#else
-      yyerrorx_nolib("libwrap");
-#endif /* HAVE_LIBWRAP */
-#endif /* !SOCKS_CLIENT */
-   }
-break;
-case 147:
-#line 1343 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-      sockscf.udpconnectdst = 1;
-   }
-break;
-case 148:
-#line 1347 "config_parse.y"
-{
-      sockscf.udpconnectdst = 0;
-#endif /* !SOCKS_CLIENT */
-   }
-break;
-case 150:
-#line 1357 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-      sockscf.compat.sameport = 1;
-   }
-break;
-case 151:
-#line 1361 "config_parse.y"
-{
-      sockscf.compat.draft_5_05 = 1;
-#endif /* !SOCKS_CLIENT */
-   }
-break;
-case 155:
-#line 1374 "config_parse.y"
-{
-         sockscf.resolveprotocol = RESOLVEPROTOCOL_FAKE;
-   }
-break;
-case 156:
-#line 1377 "config_parse.y"
-{
-#if HAVE_NO_RESOLVESTUFF
-         yyerrorx("resolveprotocol keyword not supported on this system");
-#else
-         sockscf.resolveprotocol = RESOLVEPROTOCOL_TCP;
-#endif /* !HAVE_NO_RESOLVESTUFF */
-   }
-break;
-case 157:
-#line 1384 "config_parse.y"
-{
-         sockscf.resolveprotocol = RESOLVEPROTOCOL_UDP;
-   }
-break;
-case 160:
-#line 1393 "config_parse.y"
-{
-#if !SOCKS_CLIENT
-#if !HAVE_SCHED_SETSCHEDULER
-      yyerrorx("cpu scheduling policy is not supported on this system");
-#else /* HAVE_SCHED_SETSCHEDULER */
-      cpusetting_t *cpusetting;
-
-      switch (yyvsp[-4].number) {
+      switch ((yyvsp[-4].number)) {
          case PROC_MOTHER:
             cpusetting = &sockscf.cpu.mother;
             break;
@@ -4405,28 +4133,31 @@ case 160:
             break;
 
          default:
-            SERRX(yyvsp[-4].number);
+            SERRX((yyvsp[-4].number));
       }
 
       bzero(&cpusetting->param, sizeof(cpusetting->param));
 
       cpusetting->scheduling_isset     = 1;
-      cpusetting->policy               = yyvsp[-2].number;
-      cpusetting->param.sched_priority = (int)yyvsp[0].number;
+      cpusetting->policy               = (yyvsp[-2].number);
+      cpusetting->param.sched_priority = (int)(yyvsp[0].number);
 #endif /* HAVE_SCHED_SETSCHEDULER */
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 161:
-#line 1435 "config_parse.y"
-{
+#line 4147 "config_parse.c"
+    break;
+
+  case 175: /* cpuaffinity: CPU '.' MASK '.' PROCESSTYPE ':' numbers  */
+#line 1514 "config_parse.y"
+                                                      {
 #if !SOCKS_CLIENT
 #if !HAVE_SCHED_SETAFFINITY
       yyerrorx("cpu scheduling affinity is not supported on this system");
 #else /* HAVE_SCHED_SETAFFINITY */
       cpusetting_t *cpusetting;
+      int havecpu = 0;
 
-      switch (yyvsp[-2].number) {
+      switch ((yyvsp[-2].number)) {
          case PROC_MOTHER:
             cpusetting = &sockscf.cpu.mother;
             break;
@@ -4448,12 +4179,21 @@ case 161:
             break;
 
          default:
-            SERRX(yyvsp[-2].number);
+            SERRX((yyvsp[-2].number));
       }
 
       cpu_zero(&cpusetting->mask);
+      cpusetting->percpu = 0;
+
       while (numberc-- > 0)
-         if (numberv[numberc] == CPUMASK_ANYCPU) {
+         if (numberv[numberc] == CPUMASK_PERCPU) {
+            if ((yyvsp[-2].number) != PROC_IO)
+               yyerrorx("\"percpu\" can only be set for the %s processes",
+                        childtype2string(PROC_IO));
+
+            cpusetting->percpu = 1;
+         }
+         else if (numberv[numberc] == CPUMASK_ANYCPU) {
             const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
             long i;
 
@@ -4462,36 +4202,56 @@ case 161:
 
             for (i = 0; i < cpus; ++i)
                cpu_set((int)i, &cpusetting->mask);
+
+            havecpu = 1;
          }
          else if (numberv[numberc] < 0)
             yyerrorx("invalid CPU number: %ld.  The CPU number can not be "
                      "negative", (long)numberv[numberc]);
-         else
+         else {
             cpu_set(numberv[numberc], &cpusetting->mask);
+            havecpu = 1;
+         }
 
       free(numberv);
       numberv = NULL;
       numberc = 0;
 
+      if (cpusetting->percpu && !havecpu) {
+         /* no cpus given besides "percpu"; spread over all cpus. */
+         const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+         long i;
+
+         if (cpus == -1)
+            yyerror("sysconf(_SC_NPROCESSORS_ONLN) failed");
+
+         for (i = 0; i < cpus; ++i)
+            cpu_set((int)i, &cpusetting->mask);
+      }
+
       cpusetting->affinity_isset = 1;
 
 #endif /* HAVE_SCHED_SETAFFINITY */
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 162:
-#line 1496 "config_parse.y"
-{
+#line 4237 "config_parse.c"
+    break;
+
+  case 176: /* $@14: %empty  */
+#line 1601 "config_parse.y"
+                                            {
 #if !SOCKS_CLIENT
-      socketopt.level = yyvsp[-1].number;
+      socketopt.level = (yyvsp[-1].number);
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 164:
-#line 1503 "config_parse.y"
-{
+#line 4247 "config_parse.c"
+    break;
+
+  case 178: /* socketoptionname: NUMBER  */
+#line 1608 "config_parse.y"
+                         {
 #if !SOCKS_CLIENT
-   socketopt.optname = yyvsp[0].number;
+   socketopt.optname = (yyvsp[0].number);
    socketopt.info    = optval2sockopt(socketopt.level, socketopt.optname);
 
    if (socketopt.info == NULL)
@@ -4501,11 +4261,13 @@ case 164:
    else
       socketoptioncheck(&socketopt);
    }
-break;
-case 165:
-#line 1515 "config_parse.y"
-{
-      socketopt.info           = optid2sockopt((size_t)yyvsp[0].number);
+#line 4264 "config_parse.c"
+    break;
+
+  case 179: /* socketoptionname: SOCKETOPTION_OPTID  */
+#line 1620 "config_parse.y"
+                        {
+      socketopt.info           = optid2sockopt((size_t)(yyvsp[0].number));
       SASSERTX(socketopt.info != NULL);
 
       socketopt.optname        = socketopt.info->value;
@@ -4513,79 +4275,97 @@ case 165:
       socketoptioncheck(&socketopt);
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 166:
-#line 1526 "config_parse.y"
-{
-      socketopt.optval.int_val = (int)yyvsp[0].number;
+#line 4278 "config_parse.c"
+    break;
+
+  case 180: /* socketoptionvalue: NUMBER  */
+#line 1631 "config_parse.y"
+                          {
+      socketopt.optval.int_val = (int)(yyvsp[0].number);
       socketopt.opttype        = int_val;
    }
-break;
-case 167:
-#line 1530 "config_parse.y"
-{
+#line 4287 "config_parse.c"
+    break;
+
+  case 181: /* socketoptionvalue: SOCKETOPTION_SYMBOLICVALUE  */
+#line 1635 "config_parse.y"
+                                {
       const sockoptvalsym_t *p;
 
       if (socketopt.info == NULL)
          yyerrorx("the given socket option is unknown, so can not lookup "
                   "symbolic option value");
 
-      if ((p = optval2valsym(socketopt.info->optid, yyvsp[0].string)) == NULL)
+      if ((p = optval2valsym(socketopt.info->optid, (yyvsp[0].string))) == NULL)
          yyerrorx("symbolic value \"%s\" is unknown for socket option %s",
-                  yyvsp[0].string, sockopt2string(&socketopt, NULL, 0));
+                  (yyvsp[0].string), sockopt2string(&socketopt, NULL, 0));
 
       socketopt.optval  = p->symval;
       socketopt.opttype = socketopt.info->opttype;
    }
-break;
-case 168:
-#line 1547 "config_parse.y"
-{ bzero(&socketopt, sizeof(socketopt));
+#line 4306 "config_parse.c"
+    break;
+
+  case 182: /* socketside: INTERNALSOCKET  */
+#line 1652 "config_parse.y"
+                           { bzero(&socketopt, sizeof(socketopt));
                              socketopt.isinternalside = 1;
    }
-break;
-case 169:
-#line 1550 "config_parse.y"
-{ bzero(&socketopt, sizeof(socketopt));
+#line 4314 "config_parse.c"
+    break;
+
+  case 183: /* socketside: EXTERNALSOCKET  */
+#line 1655 "config_parse.y"
+                           { bzero(&socketopt, sizeof(socketopt));
                              socketopt.isinternalside = 0;
    }
-break;
-case 171:
-#line 1559 "config_parse.y"
-{
+#line 4322 "config_parse.c"
+    break;
+
+  case 185: /* srchostoption: NODNSMISMATCH  */
+#line 1664 "config_parse.y"
+                               {
 #if !SOCKS_CLIENT
          sockscf.srchost.nodnsmismatch = 1;
    }
-break;
-case 172:
-#line 1563 "config_parse.y"
-{
+#line 4331 "config_parse.c"
+    break;
+
+  case 186: /* srchostoption: NODNSUNKNOWN  */
+#line 1668 "config_parse.y"
+                   {
          sockscf.srchost.nodnsunknown = 1;
    }
-break;
-case 173:
-#line 1566 "config_parse.y"
-{
+#line 4339 "config_parse.c"
+    break;
+
+  case 187: /* srchostoption: CHECKREPLYAUTH  */
+#line 1671 "config_parse.y"
+                     {
          sockscf.srchost.checkreplyauth = 1;
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 176:
-#line 1576 "config_parse.y"
-{
+#line 4348 "config_parse.c"
+    break;
+
+  case 190: /* realm: REALM ':' REALNAME  */
+#line 1681 "config_parse.y"
+                          {
 #if COVENANT
    STRCPY_CHECKLEN(sockscf.realmname,
-                   yyvsp[0].string,
+                   (yyvsp[0].string),
                    sizeof(sockscf.realmname) - 1,
                    yyerrorx);
 #else /* !COVENANT */
-   yyerrorx("unknown keyword \"%s\"", yyvsp[-2].string);
+   yyerrorx("unknown keyword \"%s\"", (yyvsp[-2].string));
 #endif /* !COVENANT */
 }
-break;
-case 177:
-#line 1588 "config_parse.y"
-{
+#line 4363 "config_parse.c"
+    break;
+
+  case 191: /* $@15: %empty  */
+#line 1693 "config_parse.y"
+                                        {
 #if !SOCKS_CLIENT
 
    cmethodv  = sockscf.cmethodv;
@@ -4594,10 +4374,12 @@ case 177:
 
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 179:
-#line 1599 "config_parse.y"
-{
+#line 4377 "config_parse.c"
+    break;
+
+  case 193: /* $@16: %empty  */
+#line 1704 "config_parse.y"
+                                      {
 #if HAVE_SOCKS_RULES
 
       smethodv  = sockscf.smethodv;
@@ -4610,41 +4392,51 @@ case 179:
                PRODUCT);
 #endif /* !HAVE_SOCKS_RULES */
    }
-break;
-case 184:
-#line 1621 "config_parse.y"
-{
-      if (methodisvalid(yyvsp[0].method, object_srule))
-         ADDMETHOD(yyvsp[0].method, *smethodc, smethodv);
+#line 4395 "config_parse.c"
+    break;
+
+  case 198: /* socksmethodname: METHODNAME  */
+#line 1726 "config_parse.y"
+                            {
+      if (methodisvalid((yyvsp[0].method), object_srule))
+         ADDMETHOD((yyvsp[0].method), *smethodc, smethodv);
       else
          yyerrorx("method %s (%d) is not a valid method for socksmethods",
-                  method2string(yyvsp[0].method), yyvsp[0].method);
+                  method2string((yyvsp[0].method)), (yyvsp[0].method));
    }
-break;
-case 188:
-#line 1638 "config_parse.y"
-{
-      if (methodisvalid(yyvsp[0].method, object_crule))
-         ADDMETHOD(yyvsp[0].method, *cmethodc, cmethodv);
+#line 4407 "config_parse.c"
+    break;
+
+  case 202: /* clientmethodname: METHODNAME  */
+#line 1743 "config_parse.y"
+                               {
+      if (methodisvalid((yyvsp[0].method), object_crule))
+         ADDMETHOD((yyvsp[0].method), *cmethodc, cmethodv);
       else
          yyerrorx("method %s (%d) is not a valid method for clientmethods",
-                  method2string(yyvsp[0].method), yyvsp[0].method);
-   }
-break;
-case 189:
-#line 1646 "config_parse.y"
-{ objecttype = object_monitor; }
-break;
-case 190:
-#line 1646 "config_parse.y"
-{
+                  method2string((yyvsp[0].method)), (yyvsp[0].method));
+   }
+#line 4419 "config_parse.c"
+    break;
+
+  case 203: /* $@17: %empty  */
+#line 1751 "config_parse.y"
+                 { objecttype = object_monitor; }
+#line 4425 "config_parse.c"
+    break;
+
+  case 204: /* $@18: %empty  */
+#line 1751 "config_parse.y"
+                                                      {
 #if !SOCKS_CLIENT
                         monitorinit(&monitor);
 #endif /* !SOCKS_CLIENT */
 }
-break;
-case 191:
-#line 1651 "config_parse.y"
+#line 4435 "config_parse.c"
+    break;
+
+  case 205: /* monitor: MONITOR $@17 '{' $@18 monitoroptions fromto monitoroptions '}'  */
+#line 1756 "config_parse.y"
 {
 #if !SOCKS_CLIENT
    pre_addmonitor(&monitor);
@@ -4652,14 +4444,18 @@ case 191:
    addmonitor(&monitor);
 #endif /* !SOCKS_CLIENT */
 }
-break;
-case 192:
-#line 1663 "config_parse.y"
-{ objecttype = object_crule; }
-break;
-case 193:
-#line 1664 "config_parse.y"
-{
+#line 4447 "config_parse.c"
+    break;
+
+  case 206: /* $@19: %empty  */
+#line 1768 "config_parse.y"
+                  { objecttype = object_crule; }
+#line 4453 "config_parse.c"
+    break;
+
+  case 207: /* crule: CLIENTRULE $@19 verdict '{' cruleoptions fromto cruleoptions '}'  */
+#line 1769 "config_parse.y"
+                                                       {
 #if !SOCKS_CLIENT
 #if BAREFOOTD
       if (bounceto.atype == SOCKS_ADDR_NOTSET) {
@@ -4685,59 +4481,75 @@ case 193:
       post_addrule();
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 197:
-#line 1697 "config_parse.y"
-{
+#line 4484 "config_parse.c"
+    break;
+
+  case 211: /* monitorside: %empty  */
+#line 1802 "config_parse.y"
+             {
 #if !SOCKS_CLIENT
          monitorif = NULL;
    }
-break;
-case 198:
-#line 1701 "config_parse.y"
-{
+#line 4493 "config_parse.c"
+    break;
+
+  case 212: /* monitorside: ALARMIF_INTERNAL  */
+#line 1806 "config_parse.y"
+                       {
          monitorif = &monitor.mstats->object.monitor.internal;
    }
-break;
-case 199:
-#line 1704 "config_parse.y"
-{
+#line 4501 "config_parse.c"
+    break;
+
+  case 213: /* monitorside: ALARMIF_EXTERNAL  */
+#line 1809 "config_parse.y"
+                      {
          monitorif = &monitor.mstats->object.monitor.external;
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 200:
-#line 1710 "config_parse.y"
-{
+#line 4510 "config_parse.c"
+    break;
+
+  case 214: /* alarmside: %empty  */
+#line 1815 "config_parse.y"
+           {
 #if !SOCKS_CLIENT
       alarmside = NULL;
    }
-break;
-case 201:
-#line 1714 "config_parse.y"
-{
+#line 4519 "config_parse.c"
+    break;
+
+  case 215: /* alarmside: RECVSIDE  */
+#line 1819 "config_parse.y"
+              {
       *alarmside = RECVSIDE;
    }
-break;
-case 202:
-#line 1717 "config_parse.y"
-{
+#line 4527 "config_parse.c"
+    break;
+
+  case 216: /* alarmside: SENDSIDE  */
+#line 1822 "config_parse.y"
+              {
       *alarmside = SENDSIDE;
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 203:
-#line 1723 "config_parse.y"
-{ alarminit(); }
-break;
-case 204:
-#line 1724 "config_parse.y"
-{
+#line 4536 "config_parse.c"
+    break;
+
+  case 217: /* $@20: %empty  */
+#line 1828 "config_parse.y"
+                                       { alarminit(); }
+#line 4542 "config_parse.c"
+    break;
+
+  case 218: /* alarm_data: monitorside ALARMTYPE_DATA $@20 alarmside ':' NUMBER WORD__IN NUMBER  */
+#line 1829 "config_parse.y"
+                                    {
 #if !SOCKS_CLIENT
    alarm_data_limit_t limit;
 
-   ASSIGN_NUMBER(yyvsp[-2].number, >=, 0, limit.bytes, 0);
-   ASSIGN_NUMBER(yyvsp[0].number, >, 0, limit.seconds, 1);
+   ASSIGN_NUMBER((yyvsp[-2].number), >=, 0, limit.bytes, 0);
+   ASSIGN_NUMBER((yyvsp[0].number), >, 0, limit.seconds, 1);
 
    monitor.alarmsconfigured |= ALARM_DATA;
 
@@ -4791,10 +4603,12 @@ case 204:
    }
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 206:
-#line 1788 "config_parse.y"
-{
+#line 4606 "config_parse.c"
+    break;
+
+  case 220: /* networkproblem: MTU_ERROR  */
+#line 1893 "config_parse.y"
+                          {
 #if !SOCKS_CLIENT
    monitor.alarmsconfigured |= ALARM_TEST;
 
@@ -4808,16 +4622,18 @@ case 206:
    }
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 207:
-#line 1806 "config_parse.y"
-{
+#line 4625 "config_parse.c"
+    break;
+
+  case 221: /* alarm_disconnect: monitorside ALARMTYPE_DISCONNECT ':' NUMBER '/' NUMBER alarmperiod  */
+#line 1911 "config_parse.y"
+                                                                      {
 #if !SOCKS_CLIENT
    alarm_disconnect_limit_t limit;
 
-   ASSIGN_NUMBER(yyvsp[-1].number, >, 0, limit.sessionc, 0);
-   ASSIGN_NUMBER(yyvsp[-3].number, >, 0, limit.disconnectc, 0);
-   ASSIGN_NUMBER(yyvsp[0].number, >, 0, limit.seconds, 1);
+   ASSIGN_NUMBER((yyvsp[-1].number), >, 0, limit.sessionc, 0);
+   ASSIGN_NUMBER((yyvsp[-3].number), >, 0, limit.disconnectc, 0);
+   ASSIGN_NUMBER((yyvsp[0].number), >, 0, limit.seconds, 1);
 
    if (monitor.alarm_disconnect_aggregate != 0)
       yyerrorx("one aggregated disconnect alarm has already been specified.  "
@@ -4840,54 +4656,70 @@ case 207:
    }
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 208:
-#line 1837 "config_parse.y"
-{
+#line 4659 "config_parse.c"
+    break;
+
+  case 222: /* alarmperiod: %empty  */
+#line 1942 "config_parse.y"
+             {
 #if !SOCKS_CLIENT
-               yyval.number = DEFAULT_ALARM_PERIOD;
+               (yyval.number) = DEFAULT_ALARM_PERIOD;
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 209:
-#line 1842 "config_parse.y"
-{ yyval.number = yyvsp[0].number; }
-break;
-case 212:
-#line 1847 "config_parse.y"
-{ *hostidoption_isset = 1; }
-break;
-case 214:
-#line 1851 "config_parse.y"
-{ yyval.string = NULL; }
-break;
-case 216:
-#line 1855 "config_parse.y"
-{
+#line 4669 "config_parse.c"
+    break;
+
+  case 223: /* alarmperiod: WORD__IN NUMBER  */
+#line 1947 "config_parse.y"
+                     { (yyval.number) = (yyvsp[0].number); }
+#line 4675 "config_parse.c"
+    break;
+
+  case 226: /* monitoroption: hostidoption  */
+#line 1952 "config_parse.y"
+                            { *hostidoption_isset = 1; }
+#line 4681 "config_parse.c"
+    break;
+
+  case 228: /* monitoroptions: %empty  */
+#line 1956 "config_parse.y"
+                  { (yyval.string) = NULL; }
+#line 4687 "config_parse.c"
+    break;
+
+  case 230: /* cruleoption: bounce  */
+#line 1960 "config_parse.y"
+                     {
 #if !BAREFOOTD
                   yyerrorx("unsupported option");
 #endif /* !BAREFOOTD */
    }
-break;
-case 217:
-#line 1860 "config_parse.y"
-{
+#line 4697 "config_parse.c"
+    break;
+
+  case 231: /* cruleoption: protocol  */
+#line 1965 "config_parse.y"
+                      {
 #if !BAREFOOTD
                   yyerrorx("unsupported option");
 #endif /* !BAREFOOTD */
    }
-break;
-case 219:
-#line 1866 "config_parse.y"
-{
+#line 4707 "config_parse.c"
+    break;
+
+  case 233: /* cruleoption: crulesessionoption  */
+#line 1971 "config_parse.y"
+                                {
 #if !SOCKS_CLIENT
                   session_isset = 1;
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 221:
-#line 1874 "config_parse.y"
-{
+#line 4717 "config_parse.c"
+    break;
+
+  case 235: /* $@21: %empty  */
+#line 1979 "config_parse.y"
+                  {
 
 #if SOCKS_CLIENT || !HAVE_SOCKS_HOSTID
       yyerrorx("hostid is not supported on this system");
@@ -4895,10 +4727,12 @@ case 221:
 
       objecttype = object_hrule;
 }
-break;
-case 222:
-#line 1881 "config_parse.y"
-{
+#line 4730 "config_parse.c"
+    break;
+
+  case 236: /* hrule: HOSTIDRULE $@21 verdict '{' cruleoptions hostid_fromto cruleoptions '}'  */
+#line 1986 "config_parse.y"
+                                                          {
 #if !SOCKS_CLIENT && HAVE_SOCKS_HOSTID
       if (hostid.atype != SOCKS_ADDR_NOTSET)
          yyerrorx("it does not make sense to set the hostid address in a "
@@ -4912,14 +4746,18 @@ case 222:
       post_addrule();
 #endif /* !SOCKS_CLIENT && HAVE_SOCKS_HOSTID */
    }
-break;
-case 223:
-#line 1899 "config_parse.y"
-{ yyval.string = NULL; }
-break;
-case 227:
-#line 1907 "config_parse.y"
-{
+#line 4749 "config_parse.c"
+    break;
+
+  case 237: /* cruleoptions: %empty  */
+#line 2004 "config_parse.y"
+                { (yyval.string) = NULL; }
+#line 4755 "config_parse.c"
+    break;
+
+  case 241: /* $@22: %empty  */
+#line 2012 "config_parse.y"
+                   {
 #if !SOCKS_CLIENT && HAVE_SOCKS_HOSTID
       addrinit(&hostid, 1);
 
@@ -4928,26 +4766,32 @@ case 227:
 #endif /* HAVE_SOCKS_HOSTID */
 
    }
-break;
-case 229:
-#line 1918 "config_parse.y"
-{
+#line 4769 "config_parse.c"
+    break;
+
+  case 243: /* hostindex: HOSTINDEX ':' NUMBER  */
+#line 2023 "config_parse.y"
+                                {
 #if !SOCKS_CLIENT && HAVE_SOCKS_HOSTID
-   ASSIGN_NUMBER(yyvsp[0].number, >=, 0, *hostindex, 0);
-   ASSIGN_NUMBER(yyvsp[0].number, <=, HAVE_MAX_HOSTIDS, *hostindex, 0);
+   ASSIGN_NUMBER((yyvsp[0].number), >=, 0, *hostindex, 0);
+   ASSIGN_NUMBER((yyvsp[0].number), <=, HAVE_MAX_HOSTIDS, *hostindex, 0);
 
 #else
    yyerrorx("hostid is not supported on this system");
 #endif /* !SOCKS_CLIENT && HAVE_SOCKS_HOSTID */
 }
-break;
-case 230:
-#line 1930 "config_parse.y"
-{ objecttype = object_srule; }
-break;
-case 231:
-#line 1931 "config_parse.y"
-{
+#line 4783 "config_parse.c"
+    break;
+
+  case 244: /* $@23: %empty  */
+#line 2035 "config_parse.y"
+                 { objecttype = object_srule; }
+#line 4789 "config_parse.c"
+    break;
+
+  case 245: /* srule: SOCKSRULE $@23 verdict '{' sruleoptions fromto sruleoptions '}'  */
+#line 2036 "config_parse.y"
+                                                      {
 #if !SOCKS_CLIENT
 #if !HAVE_SOCKS_RULES
    yyerrorx("socks-rules are not used in %s", PRODUCT);
@@ -4958,43 +4802,54 @@ case 231:
       post_addrule();
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 232:
-#line 1945 "config_parse.y"
-{ yyval.string = NULL; }
-break;
-case 240:
-#line 1956 "config_parse.y"
-{
+#line 4805 "config_parse.c"
+    break;
+
+  case 246: /* sruleoptions: %empty  */
+#line 2050 "config_parse.y"
+                { (yyval.string) = NULL; }
+#line 4811 "config_parse.c"
+    break;
+
+  case 254: /* sruleoption: sockssessionoption  */
+#line 2061 "config_parse.y"
+                                {
 #if !SOCKS_CLIENT
                   session_isset = 1;
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 242:
-#line 1965 "config_parse.y"
-{
+#line 4821 "config_parse.c"
+    break;
+
+  case 256: /* genericruleoption: bandwidth  */
+#line 2070 "config_parse.y"
+                              {
 #if !SOCKS_CLIENT
-                        checkmodule("bandwidth");
                         bw_isset = 1;
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 250:
-#line 1978 "config_parse.y"
-{ *hostidoption_isset = 1; }
-break;
-case 255:
-#line 1983 "config_parse.y"
-{
+#line 4831 "config_parse.c"
+    break;
+
+  case 264: /* genericruleoption: hostidoption  */
+#line 2082 "config_parse.y"
+                         { *hostidoption_isset = 1; }
+#line 4837 "config_parse.c"
+    break;
+
+  case 269: /* genericruleoption: redirect  */
+#line 2087 "config_parse.y"
+                       {
 #if !SOCKS_CLIENT
                      checkmodule("redirect");
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 256:
-#line 1988 "config_parse.y"
-{
+#line 4847 "config_parse.c"
+    break;
+
+  case 270: /* genericruleoption: socketoption  */
+#line 2092 "config_parse.y"
+                         {
 #if !SOCKS_CLIENT
          if (rule.verdict == VERDICT_BLOCK && !socketopt.isinternalside)
             yyerrorx("it does not make sense to set a socket option for the "
@@ -5017,32 +4872,38 @@ case 256:
             yywarn("could not add socketoption");
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 287:
-#line 2048 "config_parse.y"
-{
+#line 4875 "config_parse.c"
+    break;
+
+  case 301: /* ldapdebug: LDAPDEBUG ':' NUMBER  */
+#line 2152 "config_parse.y"
+                                {
 #if SOCKS_SERVER
 #if HAVE_LDAP && HAVE_OPENLDAP
-      ldap->debug = (int)yyvsp[0].number;
+      ldap->debug = (int)(yyvsp[0].number);
    }
-break;
-case 288:
-#line 2053 "config_parse.y"
-{
-      ldap->debug = (int)-yyvsp[0].number;
+#line 4885 "config_parse.c"
+    break;
+
+  case 302: /* ldapdebug: LDAPDEBUG ':' '-' NUMBER  */
+#line 2157 "config_parse.y"
+                             {
+      ldap->debug = (int)-(yyvsp[0].number);
  #else /* !HAVE_LDAP */
       yyerrorx_nolib("openldap");
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 289:
-#line 2062 "config_parse.y"
-{
+#line 4897 "config_parse.c"
+    break;
+
+  case 303: /* ldapdomain: LDAPDOMAIN ':' LDAP_DOMAIN  */
+#line 2166 "config_parse.y"
+                                       {
 #if SOCKS_SERVER
 #if HAVE_LDAP
       STRCPY_CHECKLEN(state->ldap.domain,
-                      yyvsp[0].string,
+                      (yyvsp[0].string),
                       sizeof(state->ldap.domain) - 1,
                       yyerrorx);
 #else /* !HAVE_LDAP */
@@ -5050,26 +4911,30 @@ case 289:
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 290:
-#line 2076 "config_parse.y"
-{
+#line 4914 "config_parse.c"
+    break;
+
+  case 304: /* ldapdepth: LDAPDEPTH ':' NUMBER  */
+#line 2180 "config_parse.y"
+                                {
 #if SOCKS_SERVER
 #if HAVE_LDAP && HAVE_OPENLDAP
-      ldap->mdepth = (int)yyvsp[0].number;
+      ldap->mdepth = (int)(yyvsp[0].number);
 #else /* !HAVE_LDAP */
       yyerrorx_nolib("openldap");
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 291:
-#line 2087 "config_parse.y"
-{
+#line 4928 "config_parse.c"
+    break;
+
+  case 305: /* ldapcertfile: LDAPCERTFILE ':' LDAP_CERTFILE  */
+#line 2191 "config_parse.y"
+                                             {
 #if SOCKS_SERVER
 #if HAVE_LDAP
       STRCPY_CHECKLEN(state->ldap.certfile,
-                      yyvsp[0].string,
+                      (yyvsp[0].string),
                       sizeof(state->ldap.certfile) - 1,
                       yyerrorx);
 #else /* !HAVE_LDAP */
@@ -5077,14 +4942,16 @@ case 291:
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 292:
-#line 2101 "config_parse.y"
-{
+#line 4945 "config_parse.c"
+    break;
+
+  case 306: /* ldapcertpath: LDAPCERTPATH ':' LDAP_CERTPATH  */
+#line 2205 "config_parse.y"
+                                             {
 #if SOCKS_SERVER
 #if HAVE_LDAP
       STRCPY_CHECKLEN(state->ldap.certpath,
-                      yyvsp[0].string,
+                      (yyvsp[0].string),
                       sizeof(state->ldap.certpath) - 1,
                       yyerrorx);
 #else /* !HAVE_LDAP */
@@ -5092,174 +4959,206 @@ case 292:
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 293:
-#line 2115 "config_parse.y"
-{
+#line 4962 "config_parse.c"
+    break;
+
+  case 307: /* lurl: LDAPURL ':' LDAP_URL  */
+#line 2219 "config_parse.y"
+                           {
 #if SOCKS_SERVER
 #if HAVE_LDAP
-      if (addlinkedname(&state->ldap.ldapurl, yyvsp[0].string) == NULL)
+      if (addlinkedname(&state->ldap.ldapurl, (yyvsp[0].string)) == NULL)
          yyerror(NOMEM);
 #else /* !HAVE_LDAP */
       yyerrorx_nolib("LDAP");
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 294:
-#line 2127 "config_parse.y"
-{
+#line 4977 "config_parse.c"
+    break;
+
+  case 308: /* lbasedn: LDAPBASEDN ':' LDAP_BASEDN  */
+#line 2231 "config_parse.y"
+                                    {
 #if SOCKS_SERVER
 #if HAVE_LDAP
-      if (addlinkedname(&state->ldap.ldapbasedn, yyvsp[0].string) == NULL)
+      if (addlinkedname(&state->ldap.ldapbasedn, (yyvsp[0].string)) == NULL)
          yyerror(NOMEM);
 #else /* !HAVE_LDAP */
       yyerrorx_nolib("LDAP");
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 295:
-#line 2139 "config_parse.y"
-{
+#line 4992 "config_parse.c"
+    break;
+
+  case 309: /* lbasedn_hex: LDAPBASEDN_HEX ':' LDAP_BASEDN  */
+#line 2243 "config_parse.y"
+                                            {
 #if SOCKS_SERVER
 #if HAVE_LDAP
-      if (addlinkedname(&state->ldap.ldapbasedn, hextoutf8(yyvsp[0].string, 0)) == NULL)
+      if (addlinkedname(&state->ldap.ldapbasedn, hextoutf8((yyvsp[0].string), 0)) == NULL)
          yyerror(NOMEM);
 #else /* !HAVE_LDAP */
       yyerrorx_nolib("LDAP");
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 296:
-#line 2151 "config_parse.y"
-{
+#line 5007 "config_parse.c"
+    break;
+
+  case 310: /* lbasedn_hex_all: LDAPBASEDN_HEX_ALL ':' LDAP_BASEDN  */
+#line 2255 "config_parse.y"
+                                                    {
 #if SOCKS_SERVER
 #if HAVE_LDAP
-      if (addlinkedname(&state->ldap.ldapbasedn, hextoutf8(yyvsp[0].string, 1)) == NULL)
+      if (addlinkedname(&state->ldap.ldapbasedn, hextoutf8((yyvsp[0].string), 1)) == NULL)
          yyerror(NOMEM);
 #else /* !HAVE_LDAP */
       yyerrorx_nolib("LDAP");
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 297:
-#line 2163 "config_parse.y"
-{
+#line 5022 "config_parse.c"
+    break;
+
+  case 311: /* ldapport: LDAPPORT ':' NUMBER  */
+#line 2267 "config_parse.y"
+                              {
 #if SOCKS_SERVER
 #if HAVE_LDAP
-   ldap->port = (int)yyvsp[0].number;
+   ldap->port = (int)(yyvsp[0].number);
 #else /* !HAVE_LDAP */
       yyerrorx_nolib("LDAP");
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 298:
-#line 2174 "config_parse.y"
-{
+#line 5036 "config_parse.c"
+    break;
+
+  case 312: /* ldapportssl: LDAPPORTSSL ':' NUMBER  */
+#line 2278 "config_parse.y"
+                                    {
 #if SOCKS_SERVER
 #if HAVE_LDAP
-   ldap->portssl = (int)yyvsp[0].number;
+   ldap->portssl = (int)(yyvsp[0].number);
 #else /* !HAVE_LDAP */
    yyerrorx_nolib("LDAP");
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 299:
-#line 2185 "config_parse.y"
-{
+#line 5050 "config_parse.c"
+    break;
+
+  case 313: /* ldapssl: LDAPSSL ':' YES  */
+#line 2289 "config_parse.y"
+                         {
 #if SOCKS_SERVER
 #if HAVE_LDAP
       ldap->ssl = 1;
    }
-break;
-case 300:
-#line 2190 "config_parse.y"
-{
+#line 5060 "config_parse.c"
+    break;
+
+  case 314: /* ldapssl: LDAPSSL ':' NO  */
+#line 2294 "config_parse.y"
+                    {
       ldap->ssl = 0;
 #else /* !HAVE_LDAP */
       yyerrorx_nolib("LDAP");
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 301:
-#line 2199 "config_parse.y"
-{
+#line 5072 "config_parse.c"
+    break;
+
+  case 315: /* ldapauto: LDAPAUTO ':' YES  */
+#line 2303 "config_parse.y"
+                           {
 #if SOCKS_SERVER
 #if HAVE_LDAP
       ldap->auto_off = 1;
    }
-break;
-case 302:
-#line 2204 "config_parse.y"
-{
+#line 5082 "config_parse.c"
+    break;
+
+  case 316: /* ldapauto: LDAPAUTO ':' NO  */
+#line 2308 "config_parse.y"
+                     {
       ldap->auto_off = 0;
 #else /* !HAVE_LDAP */
       yyerrorx_nolib("LDAP");
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 303:
-#line 2213 "config_parse.y"
-{
+#line 5094 "config_parse.c"
+    break;
+
+  case 317: /* ldapcertcheck: LDAPCERTCHECK ':' YES  */
+#line 2317 "config_parse.y"
+                                      {
 #if SOCKS_SERVER
 #if HAVE_LDAP
       ldap->certcheck = 1;
    }
-break;
-case 304:
-#line 2218 "config_parse.y"
-{
+#line 5104 "config_parse.c"
+    break;
+
+  case 318: /* ldapcertcheck: LDAPCERTCHECK ':' NO  */
+#line 2322 "config_parse.y"
+                          {
       ldap->certcheck = 0;
 #else /* !HAVE_LDAP */
       yyerrorx_nolib("LDAP");
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 305:
-#line 2227 "config_parse.y"
-{
+#line 5116 "config_parse.c"
+    break;
+
+  case 319: /* ldapkeeprealm: LDAPKEEPREALM ':' YES  */
+#line 2331 "config_parse.y"
+                                      {
 #if SOCKS_SERVER
 #if HAVE_LDAP
       ldap->keeprealm = 1;
    }
-break;
-case 306:
-#line 2232 "config_parse.y"
-{
+#line 5126 "config_parse.c"
+    break;
+
+  case 320: /* ldapkeeprealm: LDAPKEEPREALM ':' NO  */
+#line 2336 "config_parse.y"
+                          {
       ldap->keeprealm = 0;
 #else /* !HAVE_LDAP */
       yyerrorx_nolib("LDAP");
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 307:
-#line 2241 "config_parse.y"
-{
+#line 5138 "config_parse.c"
+    break;
+
+  case 321: /* ldapfilter: LDAPFILTER ':' LDAP_FILTER  */
+#line 2345 "config_parse.y"
+                                       {
 #if SOCKS_SERVER
 #if HAVE_LDAP
-   STRCPY_CHECKLEN(ldap->filter, yyvsp[0].string, sizeof(state->ldap.filter) - 1, yyerrorx);
+   STRCPY_CHECKLEN(ldap->filter, (yyvsp[0].string), sizeof(state->ldap.filter) - 1, yyerrorx);
 #else /* !HAVE_LDAP */
    yyerrorx_nolib("LDAP");
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 308:
-#line 2252 "config_parse.y"
-{
+#line 5152 "config_parse.c"
+    break;
+
+  case 322: /* ldapfilter_ad: LDAPFILTER_AD ':' LDAP_FILTER  */
+#line 2356 "config_parse.y"
+                                             {
 #if SOCKS_SERVER
 #if HAVE_LDAP
       STRCPY_CHECKLEN(ldap->filter_AD,
-                      yyvsp[0].string,
+                      (yyvsp[0].string),
                       sizeof(state->ldap.filter_AD) - 1,
                       yyerrorx);
 
@@ -5268,14 +5167,16 @@ case 308:
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 309:
-#line 2267 "config_parse.y"
-{
+#line 5170 "config_parse.c"
+    break;
+
+  case 323: /* ldapfilter_hex: LDAPFILTER_HEX ':' LDAP_FILTER  */
+#line 2371 "config_parse.y"
+                                               {
 #if SOCKS_SERVER
 #if HAVE_LDAP
       STRCPY_CHECKUTFLEN(ldap->filter,
-                          yyvsp[0].string,
+                          (yyvsp[0].string),
                           sizeof(state->ldap.filter) - 1,
                           yyerrorx);
 #else /* !HAVE_LDAP */
@@ -5283,14 +5184,16 @@ case 309:
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 310:
-#line 2281 "config_parse.y"
-{
+#line 5187 "config_parse.c"
+    break;
+
+  case 324: /* ldapfilter_ad_hex: LDAPFILTER_AD_HEX ':' LDAP_FILTER  */
+#line 2385 "config_parse.y"
+                                                     {
 #if SOCKS_SERVER
 #if HAVE_LDAP
       STRCPY_CHECKUTFLEN(ldap->filter_AD,
-                        yyvsp[0].string,
+                        (yyvsp[0].string),
                         sizeof(state->ldap.filter_AD) - 1,
                         yyerrorx);
 #else /* !HAVE_LDAP */
@@ -5298,14 +5201,16 @@ case 310:
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 311:
-#line 2295 "config_parse.y"
-{
+#line 5204 "config_parse.c"
+    break;
+
+  case 325: /* ldapattribute: LDAPATTRIBUTE ':' LDAP_ATTRIBUTE  */
+#line 2399 "config_parse.y"
+                                                {
 #if SOCKS_SERVER
 #if HAVE_LDAP
       STRCPY_CHECKLEN(ldap->attribute,
-                      yyvsp[0].string,
+                      (yyvsp[0].string),
                       sizeof(state->ldap.attribute) - 1,
                       yyerrorx);
 
@@ -5314,14 +5219,16 @@ case 311:
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 312:
-#line 2310 "config_parse.y"
-{
+#line 5222 "config_parse.c"
+    break;
+
+  case 326: /* ldapattribute_ad: LDAPATTRIBUTE_AD ':' LDAP_ATTRIBUTE  */
+#line 2414 "config_parse.y"
+                                                      {
 #if SOCKS_SERVER
 #if HAVE_LDAP
       STRCPY_CHECKLEN(ldap->attribute_AD,
-                      yyvsp[0].string,
+                      (yyvsp[0].string),
                       sizeof(state->ldap.attribute_AD) - 1,
                       yyerrorx);
 #else /* !HAVE_LDAP */
@@ -5329,14 +5236,16 @@ case 312:
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 313:
-#line 2324 "config_parse.y"
-{
+#line 5239 "config_parse.c"
+    break;
+
+  case 327: /* ldapattribute_hex: LDAPATTRIBUTE_HEX ':' LDAP_ATTRIBUTE  */
+#line 2428 "config_parse.y"
+                                                        {
 #if SOCKS_SERVER
 #if HAVE_LDAP
    STRCPY_CHECKUTFLEN(ldap->attribute,
-                      yyvsp[0].string,
+                      (yyvsp[0].string),
                       sizeof(state->ldap.attribute) -1,
                       yyerrorx);
 #else /* !HAVE_LDAP */
@@ -5344,14 +5253,16 @@ case 313:
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 314:
-#line 2338 "config_parse.y"
-{
+#line 5256 "config_parse.c"
+    break;
+
+  case 328: /* ldapattribute_ad_hex: LDAPATTRIBUTE_AD_HEX ':' LDAP_ATTRIBUTE  */
+#line 2442 "config_parse.y"
+                                                              {
 #if SOCKS_SERVER
 #if HAVE_LDAP
    STRCPY_CHECKUTFLEN(ldap->attribute_AD,
-                      yyvsp[0].string,
+                      (yyvsp[0].string),
                       sizeof(state->ldap.attribute_AD) - 1,
                       yyerrorx);
 #else /* !HAVE_LDAP */
@@ -5359,70 +5270,80 @@ case 314:
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 315:
-#line 2352 "config_parse.y"
-{
+#line 5273 "config_parse.c"
+    break;
+
+  case 329: /* lgroup_hex: LDAPGROUP_HEX ':' LDAPGROUP_NAME  */
+#line 2456 "config_parse.y"
+                                             {
 #if SOCKS_SERVER
 #if HAVE_LDAP
-      if (addlinkedname(&rule.ldapgroup, hextoutf8(yyvsp[0].string, 0)) == NULL)
+      if (addlinkedname(&rule.ldapgroup, hextoutf8((yyvsp[0].string), 0)) == NULL)
          yyerror(NOMEM);
 #else /* !HAVE_LDAP */
       yyerrorx_nolib("LDAP");
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 316:
-#line 2364 "config_parse.y"
-{
+#line 5288 "config_parse.c"
+    break;
+
+  case 330: /* lgroup_hex_all: LDAPGROUP_HEX_ALL ':' LDAPGROUP_NAME  */
+#line 2468 "config_parse.y"
+                                                     {
 #if SOCKS_SERVER
 #if HAVE_LDAP
       checkmodule("ldap");
 
-      if (addlinkedname(&rule.ldapgroup, hextoutf8(yyvsp[0].string, 1)) == NULL)
+      if (addlinkedname(&rule.ldapgroup, hextoutf8((yyvsp[0].string), 1)) == NULL)
          yyerror(NOMEM);
 #else /* !HAVE_LDAP */
       yyerrorx_nolib("LDAP");
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 317:
-#line 2378 "config_parse.y"
-{
+#line 5305 "config_parse.c"
+    break;
+
+  case 331: /* lgroup: LDAPGROUP ':' LDAPGROUP_NAME  */
+#line 2482 "config_parse.y"
+                                     {
 #if SOCKS_SERVER
 #if HAVE_LDAP
       checkmodule("ldap");
 
-      if (addlinkedname(&rule.ldapgroup, asciitoutf8(yyvsp[0].string)) == NULL)
+      if (addlinkedname(&rule.ldapgroup, asciitoutf8((yyvsp[0].string))) == NULL)
          yyerror(NOMEM);
 #else /* !HAVE_LDAP */
       yyerrorx_nolib("LDAP");
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 318:
-#line 2392 "config_parse.y"
-{
+#line 5322 "config_parse.c"
+    break;
+
+  case 332: /* lserver: LDAPSERVER ':' LDAPSERVER_NAME  */
+#line 2496 "config_parse.y"
+                                        {
 #if SOCKS_SERVER
 #if HAVE_LDAP
-      if (addlinkedname(&rule.ldapserver, yyvsp[0].string) == NULL)
+      if (addlinkedname(&rule.ldapserver, (yyvsp[0].string)) == NULL)
          yyerror(NOMEM);
 #else /* !HAVE_LDAP */
       yyerrorx_nolib("LDAP");
 #endif /* !HAVE_LDAP */
 #endif /* SOCKS_SERVER */
    }
-break;
-case 319:
-#line 2404 "config_parse.y"
-{
+#line 5337 "config_parse.c"
+    break;
+
+  case 333: /* ldapkeytab: LDAPKEYTAB ':' LDAPKEYTABNAME  */
+#line 2508 "config_parse.y"
+                                          {
 #if HAVE_LDAP
 #if SOCKS_SERVER
    STRCPY_CHECKLEN(state->ldap.keytab,
-                   yyvsp[0].string,
+                   (yyvsp[0].string),
                    sizeof(state->ldap.keytab) - 1, yyerrorx);
 #else
    yyerrorx("ldap keytab only applicable to Dante server");
@@ -5431,115 +5352,145 @@ case 319:
       yyerrorx_nolib("LDAP");
 #endif /* HAVE_LDAP */
    }
-break;
-case 321:
-#line 2422 "config_parse.y"
-{
+#line 5355 "config_parse.c"
+    break;
+
+  case 335: /* clientcompatibilityname: NECGSSAPI  */
+#line 2526 "config_parse.y"
+                                   {
 #if HAVE_GSSAPI
       gssapiencryption->nec = 1;
 #else
       yyerrorx_nolib("GSSAPI");
 #endif /* HAVE_GSSAPI */
    }
-break;
-case 324:
-#line 2436 "config_parse.y"
-{
+#line 5367 "config_parse.c"
+    break;
+
+  case 338: /* verdict: VERDICT_BLOCK  */
+#line 2540 "config_parse.y"
+                         {
 #if !SOCKS_CLIENT
       ruleinit(&rule);
       rule.verdict   = VERDICT_BLOCK;
    }
-break;
-case 325:
-#line 2441 "config_parse.y"
-{
+#line 5377 "config_parse.c"
+    break;
+
+  case 339: /* verdict: VERDICT_PASS  */
+#line 2545 "config_parse.y"
+                    {
       ruleinit(&rule);
       rule.verdict   = VERDICT_PASS;
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 329:
-#line 2455 "config_parse.y"
-{
+#line 5387 "config_parse.c"
+    break;
+
+  case 343: /* commandname: COMMAND_BIND  */
+#line 2559 "config_parse.y"
+                            {
          state->command.bind = 1;
    }
-break;
-case 330:
-#line 2458 "config_parse.y"
-{
+#line 5395 "config_parse.c"
+    break;
+
+  case 344: /* commandname: COMMAND_CONNECT  */
+#line 2562 "config_parse.y"
+                       {
          state->command.connect = 1;
    }
-break;
-case 331:
-#line 2461 "config_parse.y"
-{
+#line 5403 "config_parse.c"
+    break;
+
+  case 345: /* commandname: COMMAND_UDPASSOCIATE  */
+#line 2565 "config_parse.y"
+                            {
          state->command.udpassociate = 1;
    }
-break;
-case 332:
-#line 2467 "config_parse.y"
-{
+#line 5411 "config_parse.c"
+    break;
+
+  case 346: /* commandname: COMMAND_BINDREPLY  */
+#line 2571 "config_parse.y"
+                           {
          state->command.bindreply = 1;
    }
-break;
-case 333:
-#line 2471 "config_parse.y"
-{
+#line 5419 "config_parse.c"
+    break;
+
+  case 347: /* commandname: COMMAND_UDPREPLY  */
+#line 2575 "config_parse.y"
+                        {
          state->command.udpreply = 1;
    }
-break;
-case 337:
-#line 2484 "config_parse.y"
-{
+#line 5427 "config_parse.c"
+    break;
+
+  case 351: /* protocolname: PROTOCOL_TCP  */
+#line 2588 "config_parse.y"
+                           {
       state->protocol.tcp = 1;
    }
-break;
-case 338:
-#line 2487 "config_parse.y"
-{
+#line 5435 "config_parse.c"
+    break;
+
+  case 352: /* protocolname: PROTOCOL_UDP  */
+#line 2591 "config_parse.y"
+                           {
       state->protocol.udp = 1;
    }
-break;
-case 350:
-#line 2516 "config_parse.y"
-{
+#line 5443 "config_parse.c"
+    break;
+
+  case 364: /* sessioninheritable: SESSION_INHERITABLE ':' YES  */
+#line 2620 "config_parse.y"
+                                                {
 #if !SOCKS_CLIENT
                         rule.ss_isinheritable = 1;
    }
-break;
-case 351:
-#line 2520 "config_parse.y"
-{
+#line 5452 "config_parse.c"
+    break;
+
+  case 365: /* sessioninheritable: SESSION_INHERITABLE ':' NO  */
+#line 2624 "config_parse.y"
+                                {
                         rule.ss_isinheritable = 0;
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 352:
-#line 2526 "config_parse.y"
-{
+#line 5461 "config_parse.c"
+    break;
+
+  case 366: /* sessionmax: SESSIONMAX ':' NUMBER  */
+#line 2630 "config_parse.y"
+                                  {
 #if !SOCKS_CLIENT
-      ASSIGN_MAXSESSIONS(yyvsp[0].number, ss.object.ss.max, 0);
-      ss.object.ss.max       = yyvsp[0].number;
+      ASSIGN_MAXSESSIONS((yyvsp[0].number), ss.object.ss.max, 0);
+      ss.object.ss.max       = (yyvsp[0].number);
       ss.object.ss.max_isset = 1;
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 353:
-#line 2535 "config_parse.y"
-{
+#line 5473 "config_parse.c"
+    break;
+
+  case 367: /* sessionthrottle: SESSIONTHROTTLE ':' NUMBER '/' NUMBER  */
+#line 2639 "config_parse.y"
+                                                       {
 #if !SOCKS_CLIENT
-      ASSIGN_THROTTLE_SECONDS(yyvsp[-2].number, ss.object.ss.throttle.limit.clients, 0);
-      ASSIGN_THROTTLE_CLIENTS(yyvsp[0].number, ss.object.ss.throttle.limit.seconds, 0);
+      ASSIGN_THROTTLE_SECONDS((yyvsp[-2].number), ss.object.ss.throttle.limit.clients, 0);
+      ASSIGN_THROTTLE_CLIENTS((yyvsp[0].number), ss.object.ss.throttle.limit.seconds, 0);
       ss.object.ss.throttle_isset = 1;
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 358:
-#line 2550 "config_parse.y"
-{
+#line 5485 "config_parse.c"
+    break;
+
+  case 372: /* sessionstate_key: SESSIONSTATE_KEY ':' STATEKEY  */
+#line 2654 "config_parse.y"
+                                                {
 #if !SOCKS_CLIENT
-      if ((ss.keystate.key = string2statekey(yyvsp[0].string)) == key_unset)
-         yyerrorx("%s is not a valid state key", yyvsp[0].string);
+      if ((ss.keystate.key = string2statekey((yyvsp[0].string))) == key_unset)
+         yyerrorx("%s is not a valid state key", (yyvsp[0].string));
 
       if (ss.keystate.key == key_hostid) {
 #if HAVE_SOCKS_HOSTID
@@ -5562,133 +5513,163 @@ case 358:
    SERRX(0);
 #endif /* SOCKS_CLIENT */
    }
-break;
-case 359:
-#line 2578 "config_parse.y"
-{
+#line 5516 "config_parse.c"
+    break;
+
+  case 373: /* $@24: %empty  */
+#line 2682 "config_parse.y"
+                                           {
 #if !SOCKS_CLIENT && HAVE_SOCKS_HOSTID
       hostindex = &ss.keystate.keyinfo.hostindex;
    }
-break;
-case 360:
-#line 2582 "config_parse.y"
-{
+#line 5525 "config_parse.c"
+    break;
+
+  case 374: /* sessionstate_keyinfo: SESSIONSTATE_KEY '.' $@24 hostindex  */
+#line 2686 "config_parse.y"
+             {
       hostindex = &rule.hostindex; /* reset */
 #endif /* !SOCKS_CLIENT && HAVE_SOCKS_HOSTID */
    }
-break;
-case 361:
-#line 2589 "config_parse.y"
-{
+#line 5534 "config_parse.c"
+    break;
+
+  case 375: /* sessionstate_max: SESSIONSTATE_MAX ':' NUMBER  */
+#line 2693 "config_parse.y"
+                                              {
 #if !SOCKS_CLIENT
-      ASSIGN_MAXSESSIONS(yyvsp[0].number, ss.object.ss.max_perstate, 0);
+      ASSIGN_MAXSESSIONS((yyvsp[0].number), ss.object.ss.max_perstate, 0);
       ss.object.ss.max_perstate_isset = 1;
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 362:
-#line 2597 "config_parse.y"
-{
+#line 5545 "config_parse.c"
+    break;
+
+  case 376: /* sessionstate_throttle: SESSIONSTATE_THROTTLE ':' NUMBER '/' NUMBER  */
+#line 2701 "config_parse.y"
+                                                                   {
 #if !SOCKS_CLIENT
-   ASSIGN_THROTTLE_SECONDS(yyvsp[-2].number, ss.object.ss.throttle_perstate.limit.clients, 0);
-   ASSIGN_THROTTLE_CLIENTS(yyvsp[0].number, ss.object.ss.throttle_perstate.limit.seconds, 0);
+   ASSIGN_THROTTLE_SECONDS((yyvsp[-2].number), ss.object.ss.throttle_perstate.limit.clients, 0);
+   ASSIGN_THROTTLE_CLIENTS((yyvsp[0].number), ss.object.ss.throttle_perstate.limit.seconds, 0);
    ss.object.ss.throttle_perstate_isset = 1;
 #endif /* !SOCKS_CLIENT */
 }
-break;
-case 363:
-#line 2606 "config_parse.y"
-{
+#line 5557 "config_parse.c"
+    break;
+
+  case 377: /* bandwidth: BANDWIDTH ':' NUMBER  */
+#line 2710 "config_parse.y"
+                                  {
 #if !SOCKS_CLIENT
-      ASSIGN_NUMBER(yyvsp[0].number, >=, 0, bw.object.bw.maxbps, 0);
+      ASSIGN_NUMBER((yyvsp[0].number), >=, 0, bw.object.bw.maxbps, 0);
       bw.object.bw.maxbps_isset = 1;
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 365:
-#line 2618 "config_parse.y"
-{
+#line 5568 "config_parse.c"
+    break;
+
+  case 379: /* logname: RULE_LOG_CONNECT  */
+#line 2722 "config_parse.y"
+                           {
 #if !SOCKS_CLIENT
          rule.log.connect = 1;
    }
-break;
-case 366:
-#line 2622 "config_parse.y"
-{
+#line 5577 "config_parse.c"
+    break;
+
+  case 380: /* logname: RULE_LOG_DATA  */
+#line 2726 "config_parse.y"
+                     {
          rule.log.data = 1;
    }
-break;
-case 367:
-#line 2625 "config_parse.y"
-{
+#line 5585 "config_parse.c"
+    break;
+
+  case 381: /* logname: RULE_LOG_DISCONNECT  */
+#line 2729 "config_parse.y"
+                           {
          rule.log.disconnect = 1;
    }
-break;
-case 368:
-#line 2628 "config_parse.y"
-{
+#line 5593 "config_parse.c"
+    break;
+
+  case 382: /* logname: RULE_LOG_ERROR  */
+#line 2732 "config_parse.y"
+                      {
          rule.log.error = 1;
    }
-break;
-case 369:
-#line 2631 "config_parse.y"
-{
+#line 5601 "config_parse.c"
+    break;
+
+  case 383: /* logname: RULE_LOG_IOOPERATION  */
+#line 2735 "config_parse.y"
+                            {
          rule.log.iooperation = 1;
    }
-break;
-case 370:
-#line 2634 "config_parse.y"
-{
+#line 5609 "config_parse.c"
+    break;
+
+  case 384: /* logname: RULE_LOG_TCPINFO  */
+#line 2738 "config_parse.y"
+                        {
          rule.log.tcpinfo = 1;
 #endif /* !SOCKS_CLIENT */
    }
-break;
-case 373:
-#line 2645 "config_parse.y"
-{
+#line 5618 "config_parse.c"
+    break;
+
+  case 387: /* pamservicename: PAMSERVICENAME ':' SERVICENAME  */
+#line 2749 "config_parse.y"
+                                               {
 #if HAVE_PAM && (!SOCKS_CLIENT)
       STRCPY_CHECKLEN(state->pamservicename,
-                      yyvsp[0].string,
+                      (yyvsp[0].string),
                       sizeof(state->pamservicename) -1,
                       yyerrorx);
 #else
       yyerrorx_nolib("PAM");
 #endif /* HAVE_PAM && (!SOCKS_CLIENT) */
    }
-break;
-case 374:
-#line 2657 "config_parse.y"
-{
+#line 5633 "config_parse.c"
+    break;
+
+  case 388: /* bsdauthstylename: BSDAUTHSTYLE ':' BSDAUTHSTYLENAME  */
+#line 2761 "config_parse.y"
+                                                    {
 #if HAVE_BSDAUTH && SOCKS_SERVER
       STRCPY_CHECKLEN(state->bsdauthstylename,
-                      yyvsp[0].string,
+                      (yyvsp[0].string),
                       sizeof(state->bsdauthstylename) - 1,
                       yyerrorx);
 #else
       yyerrorx_nolib("bsdauth");
 #endif /* HAVE_BSDAUTH && SOCKS_SERVER */
    }
-break;
-case 375:
-#line 2670 "config_parse.y"
-{
+#line 5648 "config_parse.c"
+    break;
+
+  case 389: /* gssapiservicename: GSSAPISERVICE ':' GSSAPISERVICENAME  */
+#line 2774 "config_parse.y"
+                                                       {
 #if HAVE_GSSAPI
       STRCPY_CHECKLEN(gssapiservicename,
-                      yyvsp[0].string,
+                      (yyvsp[0].string),
                       sizeof(state->gssapiservicename) - 1,
                       yyerrorx);
 #else
       yyerrorx_nolib("GSSAPI");
 #endif /* HAVE_GSSAPI */
    }
-break;
-case 376:
-#line 2682 "config_parse.y"
-{
+#line 5663 "config_parse.c"
+    break;
+
+  case 390: /* gssapikeytab: GSSAPIKEYTAB ':' GSSAPIKEYTABNAME  */
+#line 2786 "config_parse.y"
+                                                {
 #if HAVE_GSSAPI
 #if SOCKS_SERVER
       STRCPY_CHECKLEN(gssapikeytab,
-                       yyvsp[0].string,
+                       (yyvsp[0].string),
                        sizeof(state->gssapikeytab) - 1,
                        yyerrorx);
 #else
@@ -5698,53 +5679,65 @@ case 376:
       yyerrorx_nolib("GSSAPI");
 #endif /* HAVE_GSSAPI */
    }
-break;
-case 378:
-#line 2701 "config_parse.y"
-{
+#line 5682 "config_parse.c"
+    break;
+
+  case 392: /* gssapienctypename: GSSAPIENC_ANY  */
+#line 2805 "config_parse.y"
+                                 {
 #if HAVE_GSSAPI
       gssapiencryption->clear           = 1;
       gssapiencryption->integrity       = 1;
       gssapiencryption->confidentiality = 1;
    }
-break;
-case 379:
-#line 2707 "config_parse.y"
-{
+#line 5693 "config_parse.c"
+    break;
+
+  case 393: /* gssapienctypename: GSSAPIENC_CLEAR  */
+#line 2811 "config_parse.y"
+                      {
       gssapiencryption->clear = 1;
    }
-break;
-case 380:
-#line 2710 "config_parse.y"
-{
+#line 5701 "config_parse.c"
+    break;
+
+  case 394: /* gssapienctypename: GSSAPIENC_INTEGRITY  */
+#line 2814 "config_parse.y"
+                          {
       gssapiencryption->integrity = 1;
    }
-break;
-case 381:
-#line 2713 "config_parse.y"
-{
+#line 5709 "config_parse.c"
+    break;
+
+  case 395: /* gssapienctypename: GSSAPIENC_CONFIDENTIALITY  */
+#line 2817 "config_parse.y"
+                                {
       gssapiencryption->confidentiality = 1;
    }
-break;
-case 382:
-#line 2716 "config_parse.y"
-{
+#line 5717 "config_parse.c"
+    break;
+
+  case 396: /* gssapienctypename: GSSAPIENC_PERMESSAGE  */
+#line 2820 "config_parse.y"
+                           {
       yyerrorx("gssapi per-message encryption not supported");
 #else
       yyerrorx_nolib("GSSAPI");
 #endif /* HAVE_GSSAPI */
    }
-break;
-case 386:
-#line 2731 "config_parse.y"
-{
+#line 5728 "config_parse.c"
+    break;
+
+  case 400: /* libwrap: LIBWRAPSTART ':' LINE  */
+#line 2835 "config_parse.y"
+                                 {
 #if HAVE_LIBWRAP && (!SOCKS_CLIENT)
       struct request_info request;
       char tmp[LIBWRAPBUF];
       int errno_s, devnull;
 
       STRCPY_CHECKLEN(rule.libwrap,
-                      yyvsp[0].string,
+                      (yyvsp[0].string),
                       sizeof(rule.libwrap) - 1,
                       yyerrorx);
 
@@ -5774,10 +5767,12 @@ case 386:
 #endif /* HAVE_LIBWRAP && (!SOCKS_CLIENT) */
 
    }
-break;
-case 391:
-#line 2783 "config_parse.y"
-{
+#line 5770 "config_parse.c"
+    break;
+
+  case 405: /* rdr_toaddress: rdr_to ':' address  */
+#line 2887 "config_parse.y"
+                                  {
 #if BAREFOOTD
       yyerrorx("redirecting \"to\" an address does not make any sense in %s.  "
                "Instead specify the address you wanted to \"redirect\" "
@@ -5785,219 +5780,293 @@ case 391:
                PRODUCT);
 #endif /* BAREFOOT */
    }
-break;
-case 403:
-#line 2806 "config_parse.y"
-{
+#line 5783 "config_parse.c"
+    break;
+
+  case 418: /* routeoption: socketoption  */
+#line 2911 "config_parse.y"
+                          {
                if (!addedsocketoption(&route.socketoptionc,
                                       &route.socketoptionv,
                                       &socketopt))
                   yywarn("could not add socketoption");
    }
-break;
-case 404:
-#line 2814 "config_parse.y"
-{ yyval.string = NULL; }
-break;
-case 407:
-#line 2821 "config_parse.y"
-{
+#line 5794 "config_parse.c"
+    break;
+
+  case 419: /* routeoptions: %empty  */
+#line 2919 "config_parse.y"
+               { (yyval.string) = NULL; }
+#line 5800 "config_parse.c"
+    break;
+
+  case 422: /* routeweight: ROUTE_WEIGHT ':' NUMBER  */
+#line 2926 "config_parse.y"
+                                     {
+      if ((yyvsp[0].number) < 1)
+         yyerrorx("route weight must be a positive number (%ld)", (long)(yyvsp[0].number));
+
+      route.weight       = (yyvsp[0].number);
+      route.weight_isset = 1;
+   }
+#line 5812 "config_parse.c"
+    break;
+
+  case 423: /* from: FROM  */
+#line 2935 "config_parse.y"
+             {
       addrinit(&src, 1);
    }
-break;
-case 408:
-#line 2826 "config_parse.y"
-{
+#line 5820 "config_parse.c"
+    break;
+
+  case 424: /* to: TO  */
+#line 2940 "config_parse.y"
+         {
       addrinit(&dst, ipaddr_requires_netmask(to, objecttype));
    }
-break;
-case 409:
-#line 2831 "config_parse.y"
-{
+#line 5828 "config_parse.c"
+    break;
+
+  case 425: /* rdr_from: FROM  */
+#line 2945 "config_parse.y"
+                 {
       addrinit(&rdr_from, 1);
    }
-break;
-case 410:
-#line 2836 "config_parse.y"
-{
+#line 5836 "config_parse.c"
+    break;
+
+  case 426: /* rdr_to: TO  */
+#line 2950 "config_parse.y"
+             {
       addrinit(&rdr_to, 0);
    }
-break;
-case 411:
-#line 2841 "config_parse.y"
-{
+#line 5844 "config_parse.c"
+    break;
+
+  case 427: /* bounceto: TO  */
+#line 2955 "config_parse.y"
+               {
 #if BAREFOOTD
       addrinit(&bounceto, 0);
 #endif /* BAREFOOTD */
    }
-break;
-case 412:
-#line 2849 "config_parse.y"
-{
+#line 5854 "config_parse.c"
+    break;
+
+  case 428: /* via: VIA  */
+#line 2963 "config_parse.y"
+           {
       gwaddrinit(&gw);
    }
-break;
-case 421:
-#line 2869 "config_parse.y"
-{ if (!netmask_required) yyerrorx_hasnetmask(); }
-break;
-case 422:
-#line 2870 "config_parse.y"
-{ if (netmask_required)  yyerrorx_nonetmask();  }
-break;
-case 423:
-#line 2871 "config_parse.y"
-{ if (!netmask_required) yyerrorx_hasnetmask(); }
-break;
-case 424:
-#line 2872 "config_parse.y"
-{ if (netmask_required)  yyerrorx_nonetmask();  }
-break;
-case 425:
-#line 2873 "config_parse.y"
-{ if (!netmask_required)
+#line 5862 "config_parse.c"
+    break;
+
+  case 437: /* ipaddress: ipv4 '/' netmask_v4  */
+#line 2983 "config_parse.y"
+                               { if (!netmask_required) yyerrorx_hasnetmask(); }
+#line 5868 "config_parse.c"
+    break;
+
+  case 438: /* ipaddress: ipv4  */
+#line 2984 "config_parse.y"
+                               { if (netmask_required)  yyerrorx_nonetmask();  }
+#line 5874 "config_parse.c"
+    break;
+
+  case 439: /* ipaddress: ipv6 '/' netmask_v6  */
+#line 2985 "config_parse.y"
+                               { if (!netmask_required) yyerrorx_hasnetmask(); }
+#line 5880 "config_parse.c"
+    break;
+
+  case 440: /* ipaddress: ipv6  */
+#line 2986 "config_parse.y"
+                               { if (netmask_required)  yyerrorx_nonetmask();  }
+#line 5886 "config_parse.c"
+    break;
+
+  case 441: /* ipaddress: ipvany '/' netmask_vany  */
+#line 2987 "config_parse.y"
+                                   { if (!netmask_required)
                                        yyerrorx_hasnetmask(); }
-break;
-case 426:
-#line 2875 "config_parse.y"
-{ if (netmask_required)  yyerrorx_nonetmask();  }
-break;
-case 429:
-#line 2879 "config_parse.y"
-{ /* for upnp; broadcasts on interface. */ }
-break;
-case 433:
-#line 2888 "config_parse.y"
-{
+#line 5893 "config_parse.c"
+    break;
+
+  case 442: /* ipaddress: ipvany  */
+#line 2989 "config_parse.y"
+                               { if (netmask_required)  yyerrorx_nonetmask();  }
+#line 5899 "config_parse.c"
+    break;
+
+  case 445: /* gwaddress: ifname  */
+#line 2993 "config_parse.y"
+                    { /* for upnp; broadcasts on interface. */ }
+#line 5905 "config_parse.c"
+    break;
+
+  case 449: /* ipv4: IPV4  */
+#line 3002 "config_parse.y"
+             {
       *atype = SOCKS_ADDR_IPV4;
 
-      if (socks_inet_pton(AF_INET, yyvsp[0].string, ipv4, NULL) != 1)
-         yyerror("bad %s: %s", atype2string(*atype), yyvsp[0].string);
+      if (socks_inet_pton(AF_INET, (yyvsp[0].string), ipv4, NULL) != 1)
+         yyerror("bad %s: %s", atype2string(*atype), (yyvsp[0].string));
    }
-break;
-case 434:
-#line 2896 "config_parse.y"
-{
-      if (yyvsp[0].number < 0 || yyvsp[0].number > 32)
+#line 5916 "config_parse.c"
+    break;
+
+  case 450: /* netmask_v4: NUMBER  */
+#line 3010 "config_parse.y"
+                     {
+      if ((yyvsp[0].number) < 0 || (yyvsp[0].number) > 32)
          yyerrorx("bad %s netmask: %ld.  Legal range is 0 - 32",
-                  atype2string(*atype), (long)yyvsp[0].number);
+                  atype2string(*atype), (long)(yyvsp[0].number));
 
-      netmask_v4->s_addr = yyvsp[0].number == 0 ? 0 : htonl(IPV4_FULLNETMASK << (32 - yyvsp[0].number));
+      netmask_v4->s_addr = (yyvsp[0].number) == 0 ? 0 : htonl(IPV4_FULLNETMASK << (32 - (yyvsp[0].number)));
    }
-break;
-case 435:
-#line 2903 "config_parse.y"
-{
-      if (socks_inet_pton(AF_INET, yyvsp[0].string, netmask_v4, NULL) != 1)
-         yyerror("bad %s netmask: %s", atype2string(*atype), yyvsp[0].string);
+#line 5928 "config_parse.c"
+    break;
+
+  case 451: /* netmask_v4: IPV4  */
+#line 3017 "config_parse.y"
+                   {
+      if (socks_inet_pton(AF_INET, (yyvsp[0].string), netmask_v4, NULL) != 1)
+         yyerror("bad %s netmask: %s", atype2string(*atype), (yyvsp[0].string));
    }
-break;
-case 436:
-#line 2909 "config_parse.y"
-{
+#line 5937 "config_parse.c"
+    break;
+
+  case 452: /* ipv6: IPV6  */
+#line 3023 "config_parse.y"
+             {
       *atype = SOCKS_ADDR_IPV6;
 
-      if (socks_inet_pton(AF_INET6, yyvsp[0].string, ipv6, scopeid_v6) != 1)
-         yyerror("bad %s: %s", atype2string(*atype), yyvsp[0].string);
+      if (socks_inet_pton(AF_INET6, (yyvsp[0].string), ipv6, scopeid_v6) != 1)
+         yyerror("bad %s: %s", atype2string(*atype), (yyvsp[0].string));
    }
-break;
-case 437:
-#line 2917 "config_parse.y"
-{
-      if (yyvsp[0].number < 0 || yyvsp[0].number > IPV6_NETMASKBITS)
+#line 5948 "config_parse.c"
+    break;
+
+  case 453: /* netmask_v6: NUMBER  */
+#line 3031 "config_parse.y"
+                     {
+      if ((yyvsp[0].number) < 0 || (yyvsp[0].number) > IPV6_NETMASKBITS)
          yyerrorx("bad %s netmask: %d.  Legal range is 0 - %d",
-                  atype2string(*atype), (int)yyvsp[0].number, IPV6_NETMASKBITS);
+                  atype2string(*atype), (int)(yyvsp[0].number), IPV6_NETMASKBITS);
 
-      *netmask_v6 = yyvsp[0].number;
+      *netmask_v6 = (yyvsp[0].number);
    }
-break;
-case 438:
-#line 2926 "config_parse.y"
-{
-      SASSERTX(strcmp(yyvsp[0].string, "0") == 0);
+#line 5960 "config_parse.c"
+    break;
+
+  case 454: /* ipvany: IPVANY  */
+#line 3040 "config_parse.y"
+                 {
+      SASSERTX(strcmp((yyvsp[0].string), "0") == 0);
 
       *atype = SOCKS_ADDR_IPVANY;
       ipvany->s_addr = htonl(0);
    }
-break;
-case 439:
-#line 2934 "config_parse.y"
-{
-      if (yyvsp[0].number != 0)
+#line 5971 "config_parse.c"
+    break;
+
+  case 455: /* netmask_vany: NUMBER  */
+#line 3048 "config_parse.y"
+                       {
+      if ((yyvsp[0].number) != 0)
          yyerrorx("bad %s netmask: %d.  Only legal value is 0",
-                  atype2string(*atype), (int)yyvsp[0].number);
+                  atype2string(*atype), (int)(yyvsp[0].number));
 
-      netmask_vany->s_addr = htonl(yyvsp[0].number);
+      netmask_vany->s_addr = htonl((yyvsp[0].number));
    }
-break;
-case 440:
-#line 2944 "config_parse.y"
-{
+#line 5983 "config_parse.c"
+    break;
+
+  case 456: /* domain: DOMAINNAME  */
+#line 3058 "config_parse.y"
+                     {
       *atype = SOCKS_ADDR_DOMAIN;
-      STRCPY_CHECKLEN(domain, yyvsp[0].string, MAXHOSTNAMELEN - 1, yyerrorx);
+      STRCPY_CHECKLEN(domain, (yyvsp[0].string), MAXHOSTNAMELEN - 1, yyerrorx);
    }
-break;
-case 441:
-#line 2950 "config_parse.y"
-{
+#line 5992 "config_parse.c"
+    break;
+
+  case 457: /* ifname: IFNAME  */
+#line 3064 "config_parse.y"
+                 {
       *atype = SOCKS_ADDR_IFNAME;
-      STRCPY_CHECKLEN(ifname, yyvsp[0].string, MAXIFNAMELEN - 1, yyerrorx);
+      STRCPY_CHECKLEN(ifname, (yyvsp[0].string), MAXIFNAMELEN - 1, yyerrorx);
    }
-break;
-case 442:
-#line 2957 "config_parse.y"
-{
+#line 6001 "config_parse.c"
+    break;
+
+  case 458: /* url: URL  */
+#line 3071 "config_parse.y"
+           {
       *atype = SOCKS_ADDR_URL;
-      STRCPY_CHECKLEN(url, yyvsp[0].string, MAXURLLEN - 1, yyerrorx);
-   }
-break;
-case 443:
-#line 2964 "config_parse.y"
-{ yyval.number = 0; }
-break;
-case 447:
-#line 2970 "config_parse.y"
-{ yyval.number = 0; }
-break;
-case 451:
-#line 2978 "config_parse.y"
-{
+      STRCPY_CHECKLEN(url, (yyvsp[0].string), MAXURLLEN - 1, yyerrorx);
+   }
+#line 6010 "config_parse.c"
+    break;
+
+  case 459: /* port: %empty  */
+#line 3078 "config_parse.y"
+      { (yyval.number) = 0; }
+#line 6016 "config_parse.c"
+    break;
+
+  case 463: /* gwport: %empty  */
+#line 3084 "config_parse.y"
+        { (yyval.number) = 0; }
+#line 6022 "config_parse.c"
+    break;
+
+  case 467: /* portrange: portstart '-' portend  */
+#line 3092 "config_parse.y"
+                                   {
    if (ntohs(*port_tcp) > ntohs(ruleaddr->portend))
       yyerrorx("end port (%u) can not be less than start port (%u)",
       ntohs(*port_tcp), ntohs(ruleaddr->portend));
    }
-break;
-case 452:
-#line 2986 "config_parse.y"
-{
-      ASSIGN_PORTNUMBER(yyvsp[0].number, *port_tcp);
-      ASSIGN_PORTNUMBER(yyvsp[0].number, *port_udp);
+#line 6032 "config_parse.c"
+    break;
+
+  case 468: /* portstart: NUMBER  */
+#line 3100 "config_parse.y"
+                    {
+      ASSIGN_PORTNUMBER((yyvsp[0].number), *port_tcp);
+      ASSIGN_PORTNUMBER((yyvsp[0].number), *port_udp);
    }
-break;
-case 453:
-#line 2992 "config_parse.y"
-{
-      ASSIGN_PORTNUMBER(yyvsp[0].number, ruleaddr->portend);
+#line 6041 "config_parse.c"
+    break;
+
+  case 469: /* portend: NUMBER  */
+#line 3106 "config_parse.y"
+                  {
+      ASSIGN_PORTNUMBER((yyvsp[0].number), ruleaddr->portend);
       ruleaddr->operator   = range;
    }
-break;
-case 454:
-#line 2998 "config_parse.y"
-{
+#line 6050 "config_parse.c"
+    break;
+
+  case 470: /* portservice: SERVICENAME  */
+#line 3112 "config_parse.y"
+                           {
       struct servent   *service;
 
-      if ((service = getservbyname(yyvsp[0].string, "tcp")) == NULL) {
+      if ((service = getservbyname((yyvsp[0].string), "tcp")) == NULL) {
          if (state->protocol.tcp)
-            yyerrorx("unknown tcp protocol: %s", yyvsp[0].string);
+            yyerrorx("unknown tcp protocol: %s", (yyvsp[0].string));
 
          *port_tcp = htons(0);
       }
       else
          *port_tcp = (in_port_t)service->s_port;
 
-      if ((service = getservbyname(yyvsp[0].string, "udp")) == NULL) {
+      if ((service = getservbyname((yyvsp[0].string), "udp")) == NULL) {
          if (state->protocol.udp)
-               yyerrorx("unknown udp protocol: %s", yyvsp[0].string);
+               yyerrorx("unknown udp protocol: %s", (yyvsp[0].string));
 
             *port_udp = htons(0);
       }
@@ -6013,110 +6082,1211 @@ case 454:
       else if (*port_udp == htons(0))
          *port_udp = *port_tcp;
 
-      yyval.number = (size_t)*port_udp;
+      (yyval.number) = (size_t)*port_udp;
    }
-break;
-case 455:
-#line 3033 "config_parse.y"
-{
-      *operator = string2operator(yyvsp[0].string);
+#line 6087 "config_parse.c"
+    break;
+
+  case 471: /* portoperator: OPERATOR  */
+#line 3147 "config_parse.y"
+                         {
+      *operator = string2operator((yyvsp[0].string));
    }
-break;
-case 457:
-#line 3042 "config_parse.y"
-{
+#line 6095 "config_parse.c"
+    break;
+
+  case 473: /* udpportrange_start: NUMBER  */
+#line 3156 "config_parse.y"
+                           {
 #if SOCKS_SERVER
-   ASSIGN_PORTNUMBER(yyvsp[0].number, rule.udprange.start);
+   ASSIGN_PORTNUMBER((yyvsp[0].number), rule.udprange.start);
 #endif /* SOCKS_SERVER */
    }
-break;
-case 458:
-#line 3049 "config_parse.y"
-{
+#line 6105 "config_parse.c"
+    break;
+
+  case 474: /* udpportrange_end: NUMBER  */
+#line 3163 "config_parse.y"
+                         {
 #if SOCKS_SERVER
-   ASSIGN_PORTNUMBER(yyvsp[0].number, rule.udprange.end);
+   ASSIGN_PORTNUMBER((yyvsp[0].number), rule.udprange.end);
    rule.udprange.op  = range;
 
    if (ntohs(rule.udprange.start) > ntohs(rule.udprange.end))
       yyerrorx("end port (%d) can not be less than start port (%u)",
-               (int)yyvsp[0].number, ntohs(rule.udprange.start));
+               (int)(yyvsp[0].number), ntohs(rule.udprange.start));
 #endif /* SOCKS_SERVER */
    }
-break;
-case 459:
-#line 3061 "config_parse.y"
-{
-      addnumber(&numberc, &numberv, yyvsp[0].number);
+#line 6120 "config_parse.c"
+    break;
+
+  case 475: /* number: NUMBER  */
+#line 3175 "config_parse.y"
+               {
+      addnumber(&numberc, &numberv, (yyvsp[0].number));
    }
-break;
-#line 6044 "config_parse.c"
+#line 6128 "config_parse.c"
+    break;
+
+
+#line 6132 "config_parse.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
     }
-    yyssp -= yym;
-    yystate = *yyssp;
-    yyvsp -= yym;
-    yym = yylhs[yyn];
-    if (yystate == 0 && yym == 0)
+
+  if (yyerrstatus == 3)
     {
-#if YYDEBUG
-        if (yydebug)
-            printf("%sdebug: after reduction, shifting from state 0 to\
- state %d\n", YYPREFIX, YYFINAL);
-#endif
-        yystate = YYFINAL;
-        *++yyssp = YYFINAL;
-        *++yyvsp = yyval;
-        if (yychar < 0)
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
         {
-            if ((yychar = yylex()) < 0) yychar = 0;
-#if YYDEBUG
-            if (yydebug)
-            {
-                yys = 0;
-                if (yychar <= YYMAXTOKEN) yys = yyname[yychar];
-                if (!yys) yys = "illegal-symbol";
-                printf("%sdebug: state %d, reading %d (%s)\n",
-                        YYPREFIX, YYFINAL, yychar, yys);
-            }
-#endif
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
         }
-        if (yychar == 0) goto yyaccept;
-        goto yyloop;
     }
-    if ((yyn = yygindex[yym]) && (yyn += yystate) >= 0 &&
-            yyn <= YYTABLESIZE && yycheck[yyn] == yystate)
-        yystate = yytable[yyn];
-    else
-        yystate = yydgoto[yym];
-#if YYDEBUG
-    if (yydebug)
-        printf("%sdebug: after reduction, shifting from state %d \
-to state %d\n", YYPREFIX, *yyssp, yystate);
-#endif
-    if (yyssp >= yysslim && yygrowstack())
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
     {
-        goto yyoverflow;
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
     }
-    *++yyssp = yystate;
-    *++yyvsp = yyval;
-    goto yyloop;
-yyoverflow:
-    yyerror("yacc stack overflow");
-yyabort:
-    if (yyss)
-            free(yyss);
-    if (yyvs)
-            free(yyvs);
-    yyss = yyssp = NULL;
-    yyvs = yyvsp = NULL;
-    yystacksize = 0;
-    return (1);
-yyaccept:
-    if (yyss)
-            free(yyss);
-    if (yyvs)
-            free(yyvs);
-    yyss = yyssp = NULL;
-    yyvs = yyvsp = NULL;
-    yystacksize = 0;
-    return (0);
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 3185 "config_parse.y"
+
+
+#define INTERACTIVE      0
+
+extern FILE *yyin;
+
+int lex_dorestart; /* global for Lex. */
+
+int
+parseconfig(filename)
+   const char *filename;
+{
+   const char *function = "parseconfig()";
+   struct stat statbuf;
+   int haveconfig;
+
+#if SOCKS_CLIENT /* assume server admin can set things up correctly himself. */
+   parseclientenv(&haveconfig);
+
+   if (haveconfig)
+      return 0;
+
+#else /* !SOCKS_CLIENT */
+   SASSERTX(pidismainmother(sockscf.state.pid));
+
+   if (sockscf.state.inited)
+      /* in case we need something special to (re)open config-file. */
+      sockd_priv(SOCKD_PRIV_PRIVILEGED, PRIV_ON);
+#endif /* !SOCKS_CLIENT */
+
+   yyin = fopen(filename, "r");
+
+#if !SOCKS_CLIENT
+   if (sockscf.state.inited)
+      sockd_priv(SOCKD_PRIV_PRIVILEGED, PRIV_OFF);
+#endif /* SERVER */
+
+   if (yyin == NULL
+   ||  (stat(filename, &statbuf) == 0 && statbuf.st_size == 0)) {
+      if (yyin == NULL)
+         slog(sockscf.state.inited ? LOG_WARNING : LOG_ERR,
+              "%s: could not open config file %s", function, filename);
+      else
+         slog((sockscf.state.inited || SOCKS_CLIENT) ? LOG_WARNING : LOG_ERR,
+              "%s: config file %s is empty.  Not parsing", function, filename);
+
+#if SOCKS_CLIENT
+
+      if (yyin == NULL) {
+         if (sockscf.option.directfallback)
+            slog(LOG_DEBUG,
+                 "%s: no %s, but direct fallback enabled, continuing",
+                 function, filename);
+         else
+            exit(0);
+      }
+      else {
+         slog(LOG_DEBUG, "%s: empty %s, assuming direct fallback wanted",
+              function, filename);
+
+         sockscf.option.directfallback = 1;
+      }
+
+      SASSERTX(sockscf.option.directfallback == 1);
+#else /* !SOCKS_CLIENT */
+
+      if (!sockscf.state.inited)
+         sockdexit(EXIT_FAILURE);
+
+      /*
+       * Might possibly continue with old config.
+       */
+
+#endif /* !SOCKS_CLIENT */
+
+      haveconfig = 0;
+   }
+   else {
+#if YYDEBUG
+      yydebug       = 0;
+#endif /* YYDEBUG */
+
+      yylineno      = 1;
+      errno         = 0;   /* don't report old errors in yyparse(). */
+      haveconfig    = 1;
+
+      /*
+       * Special and delayed as long as we can, till immediately before
+       * parsing new config.
+       * Want to keep a backup of old ones until we know there were no
+       * errors adding new logfiles.
+       */
+
+#if !SOCKS_CLIENT
+      old_log              = sockscf.log;
+      old_errlog           = sockscf.errlog;
+#endif /* !SOCKS_CLIENT */
+
+      failed_to_add_errlog = failed_to_add_log = 0;
+
+      slog(LOG_DEBUG, "%s: parsing config in file %s", function, filename);
+
+      bzero(&sockscf.log,    sizeof(sockscf.log));
+      bzero(&sockscf.errlog, sizeof(sockscf.errlog));
+
+      lex_dorestart = 1;
+
+      parsingconfig = 1;
+
+#if SOCKSLIBRARY_DYNAMIC
+      socks_markasnative("*");
+#endif /* SOCKSLIBRARY_DYNAMIC */
+
+      yyparse();
+
+#if SOCKSLIBRARY_DYNAMIC
+      socks_markasnormal("*");
+#endif /* SOCKSLIBRARY_DYNAMIC */
+
+      parsingconfig = 0;
+
+#if !SOCKS_CLIENT
+      CMDLINE_OVERRIDE(&sockscf.initial.cmdline, &sockscf.option);
+
+#if !HAVE_PRIVILEGES
+      if (!sockscf.state.inited) {
+         /*
+          * first time.
+          */
+         if (sockscf.uid.privileged_isset && !sockscf.option.verifyonly) {
+            /*
+             * If we created any logfiles (rather than just opened already
+             * existing ones), they will have been created with the euid/egid
+             * we are started with.  If logfiles created by that euid/egid are
+             * not writable by our configured privileged userid (if any), it
+             * means that upon SIGHUP we will be unable to re-open our own
+             * logfiles.  We therefor check whether the logfile(s) were created
+             * by ourselves, and if so, make sure they have the right owner.
+             */
+            logtype_t *logv[] = { &sockscf.log, &sockscf.errlog };
+            size_t i;
+
+            for (i = 0; i < ELEMENTS(logv); ++i) {
+               size_t fi;
+
+               for (fi = 0; fi < logv[i]->filenoc; ++fi) {
+                  if (logv[i]->createdv[fi]) {
+                     slog(LOG_DEBUG,
+                          "%s: chown(2)-ing created logfile %s to %lu/%lu",
+                          function,
+                          logv[i]->fnamev[fi],
+                          (unsigned long)sockscf.uid.privileged_uid,
+                          (unsigned long)sockscf.uid.privileged_gid);
+
+                     if (fchown(logv[i]->filenov[fi],
+                                (unsigned long)sockscf.uid.privileged_uid,
+                                (unsigned long)sockscf.uid.privileged_gid) != 0)
+                        serr("%s: could not fchown(2) created logfile %s to "
+                             "privileged uid/gid %lu/%lu.  This means that "
+                             "upon SIGHUP, we would not be unable to re-open "
+                             "our own logfiles.  This should not happen",
+                             function,
+                             logv[i]->fnamev[fi],
+                             (unsigned long)sockscf.uid.privileged_uid,
+                             (unsigned long)sockscf.uid.privileged_gid);
+                  }
+               }
+            }
+         }
+      }
+#endif /* !HAVE_PRIVILEGES */
+
+      if (configure_privileges() != 0) {
+         if (sockscf.state.inited) {
+            swarn("%s: could not reinitialize privileges after SIGHUP.  "
+                  "Will continue without privileges",
+                  function);
+
+            sockscf.state.haveprivs = 0;
+         }
+         else
+            serr("%s: could not configure privileges", function);
+      }
+#endif /* !SOCKS_CLIENT */
+   }
+
+   if (yyin != NULL)
+      fclose(yyin);
+
+   errno = 0;
+   return haveconfig ? 0 : -1;
 }
+
+static int
+ipaddr_requires_netmask(context, objecttype)
+   const addresscontext_t context;
+   const objecttype_t objecttype;
+{
+
+   switch (objecttype) {
+      case object_crule:
+#if HAVE_SOCKS_RULES
+
+         return 1;
+
+#else /* !HAVE_SOCKS_RULES */
+
+         switch (context) {
+            case from:
+               return 1;
+
+            case to:
+               return 0; /* address we accept clients on. */
+
+            case bounce:
+               return 0; /* address we connect to.        */
+
+            default:
+               SERRX(context);
+         }
+#endif /* !HAVE_SOCKS_RULES */
+
+
+#if HAVE_SOCKS_HOSTID
+      case object_hrule:
+         return 1;
+#endif /* HAVE_SOCKS_HOSTID */
+
+#if HAVE_SOCKS_RULES
+      case object_srule:
+         return 1;
+#endif /* HAVE_SOCKS_RULES */
+
+      case object_route:
+      case object_monitor:
+         return 1;
+
+      default:
+         SERRX(objecttype);
+   }
+
+
+   /* NOTREACHED */
+   return 0;
+}
+
+
+static void
+addnumber(numberc, numberv, number)
+   size_t *numberc;
+   long long *numberv[];
+   const long long number;
+{
+   const char *function = "addnumber()";
+
+   if ((*numberv = realloc(*numberv, sizeof(**numberv) * ((*numberc) + 1)))
+   == NULL)
+      yyerror("%s: could not allocate %lu bytes of memory for adding "
+              "number %lld",
+              function, (unsigned long)(sizeof(**numberv) * ((*numberc) + 1)),
+              number);
+
+   (*numberv)[(*numberc)++] = number;
+}
+
+
+static void
+addrinit(addr, _netmask_required)
+   ruleaddr_t *addr;
+   const int _netmask_required;
+{
+
+   atype            = &addr->atype;
+
+   ipv4             = &addr->addr.ipv4.ip;
+   netmask_v4       = &addr->addr.ipv4.mask;
+
+   ipv6             = &addr->addr.ipv6.ip;
+   netmask_v6       = &addr->addr.ipv6.maskbits;
+   scopeid_v6       = &addr->addr.ipv6.scopeid;
+
+   ipvany           = &addr->addr.ipvany.ip;
+   netmask_vany     = &addr->addr.ipvany.mask;
+
+   if (!_netmask_required) {
+      netmask_v4->s_addr   = htonl(IPV4_FULLNETMASK);
+      *netmask_v6          = IPV6_NETMASKBITS;
+      netmask_vany->s_addr = htonl(IPV4_FULLNETMASK);
+   }
+
+   domain           = addr->addr.domain;
+   ifname           = addr->addr.ifname;
+
+   port_tcp         = &addr->port.tcp;
+   port_udp         = &addr->port.udp;
+   operator         = &addr->operator;
+
+   netmask_required = _netmask_required;
+   ruleaddr         = addr;
+}
+
+static void
+gwaddrinit(addr)
+   sockshost_t *addr;
+{
+   static enum operator_t operatormem;
+
+   netmask_required = 0;
+
+   atype            = &addr->atype;
+
+   ipv4             = &addr->addr.ipv4;
+   ipv6             = &addr->addr.ipv6.ip;
+   domain           = addr->addr.domain;
+   ifname           = addr->addr.ifname;
+   url              = addr->addr.urlname;
+
+   port_tcp         = &addr->port;
+   port_udp         = &addr->port;
+   operator         = &operatormem; /* no operator in gwaddr and not used. */
+}
+
+static void
+routeinit(route)
+   route_t *route;
+{
+   bzero(route, sizeof(*route));
+
+   state               = &route->gw.state;
+   extension           = &state->extension;
+
+   cmethodv            = state->cmethodv;
+   cmethodc            = &state->cmethodc;
+   smethodv            = state->smethodv;
+   smethodc            = &state->smethodc;
+
+#if HAVE_GSSAPI
+   gssapiservicename = state->gssapiservicename;
+   gssapikeytab      = state->gssapikeytab;
+   gssapiencryption  = &state->gssapiencryption;
+#endif /* HAVE_GSSAPI */
+
+#if !SOCKS_CLIENT && HAVE_LDAP
+   ldap              = &state->ldap;
+#endif /* !SOCKS_CLIENT && HAVE_LDAP*/
+
+   bzero(&src, sizeof(src));
+   bzero(&dst, sizeof(dst));
+   src.atype = SOCKS_ADDR_IPV4;
+   dst.atype = SOCKS_ADDR_IPV4;
+
+   bzero(&gw, sizeof(gw));
+   bzero(&rdr_from, sizeof(rdr_from));
+   bzero(&hostid, sizeof(hostid));
+}
+
+
+#if SOCKS_CLIENT
+static void
+parseclientenv(haveproxyserver)
+   int *haveproxyserver;
+{
+   const char *function = "parseclientenv()";
+   const char *fprintf_error = "could not write to tmpfile used to hold "
+                               "settings set in environment for parsing";
+   size_t i;
+   FILE *fp;
+   char *p, rdr_from[512], extrarouteinfo[sizeof(rdr_from) + sizeof("\n")],
+        gw[MAXSOCKSHOSTLEN + sizeof(" port = 65535")];
+   int fd;
+
+
+#if 1
+
+#if SOCKS_CLIENT
+   p = "yaccenv-client-XXXXXX";
+#else /* !SOCKS_CLIENT */
+   p = "yaccenv-server-XXXXXX";
+#endif /* !SOCKS_CLIENT */
+
+   if ((fd = socks_mklock(p, NULL, 0)) == -1)
+      yyerror("socks_mklock() failed to create tmpfile using base %s", p);
+
+#else /* for debugging file-generation problems. */
+   if ((fd = open("/tmp/dante-envfile",
+                  O_CREAT | O_TRUNC | O_RDWR,
+                  S_IRUSR | S_IWUSR)) == -1)
+      serr("%s: could not open file", function);
+#endif
+
+   if ((fp = fdopen(fd, "r+")) == NULL)
+      serr("%s: fdopen(fd %d) failed", function, fd);
+
+   if ((p = socks_getenv(ENV_SOCKS_LOGOUTPUT, dontcare)) != NULL && *p != NUL)
+      if (fprintf(fp, "logoutput: %s\n", p) == -1)
+         serr("%s: %s", function, fprintf_error);
+
+   if ((p = socks_getenv(ENV_SOCKS_ERRLOGOUTPUT, dontcare)) != NULL
+   && *p != NUL)
+      if (fprintf(fp, "errorlog: %s\n", p) == -1)
+         serr("%s: %s", function, fprintf_error);
+
+   if ((p = socks_getenv(ENV_SOCKS_DEBUG, dontcare)) != NULL && *p != NUL)
+      if (fprintf(fp, "debug: %s\n", p) == -1)
+         serr("%s: %s", function, fprintf_error);
+
+   *rdr_from = NUL;
+   if ((p = socks_getenv(ENV_SOCKS_REDIRECT_FROM, dontcare)) != NULL
+   && *p != NUL) {
+      const char *prefix = "redirect from";
+
+      if (strlen(prefix) + strlen(p) + 1 > sizeof(rdr_from))
+         serr("%s: %s value is too long.  Max length is %lu",
+              function,
+              ENV_SOCKS_REDIRECT_FROM,
+              (unsigned long)sizeof(rdr_from) - (strlen(prefix) + 1));
+
+      snprintf(rdr_from, sizeof(rdr_from), "%s: %s\n", prefix, p);
+   }
+
+   snprintf(extrarouteinfo, sizeof(extrarouteinfo),
+            "%s", rdr_from);
+
+   /*
+    * Check if there is a proxy server configured in the environment.
+    * Initially assume there is none.
+    */
+
+   *haveproxyserver = 0;
+
+   i = 1;
+   while (1) {
+      /* 640 routes should be enough for anyone. */
+      char name[sizeof(ENV_SOCKS_ROUTE_) + sizeof("640")];
+
+      snprintf(name, sizeof(name), "%s%lu", ENV_SOCKS_ROUTE_, (unsigned long)i);
+
+      if ((p = socks_getenv(name, dontcare)) == NULL)
+         break;
+
+      if (*p != NUL) {
+         if (fprintf(fp, "route { %s }\n", p) == -1)
+            serr("%s: %s", function, fprintf_error);
+
+         *haveproxyserver = 1;
+      }
+
+      ++i;
+   }
+
+   if ((p = socks_getenv(ENV_SOCKS4_SERVER, dontcare)) != NULL && *p != NUL) {
+      if (fprintf(fp,
+"route {\n"
+"         from: 0.0.0.0/0 to: 0.0.0.0/0 via: %s\n"
+"         proxyprotocol: socks_v4\n"
+"         %s"
+"}\n",            serverstring2gwstring(p, PROXY_SOCKS_V4, gw, sizeof(gw)),
+                  extrarouteinfo) == -1)
+         serr("%s: %s", function, fprintf_error);
+
+      *haveproxyserver = 1;
+   }
+
+   if ((p = socks_getenv(ENV_SOCKS5_SERVER, dontcare)) != NULL && *p != NUL) {
+      if (fprintf(fp,
+"route {\n"
+"         from: 0.0.0.0/0 to: 0.0.0.0/0 via: %s\n"
+"         proxyprotocol: socks_v5\n"
+"         %s"
+"}\n",            serverstring2gwstring(p, PROXY_SOCKS_V5, gw, sizeof(gw)),
+                  extrarouteinfo) == -1)
+         serr("%s: %s", function, fprintf_error);
+
+      *haveproxyserver = 1;
+   }
+
+   if ((p = socks_getenv(ENV_SOCKS_SERVER, dontcare)) != NULL && *p != NUL) {
+      if (fprintf(fp,
+"route {\n"
+"         from: 0.0.0.0/0 to: 0.0.0.0/0 via: %s\n"
+"         %s"
+"}\n",            serverstring2gwstring(p, PROXY_SOCKS_V5, gw, sizeof(gw)),
+                  extrarouteinfo) == -1)
+         serr("%s: %s", function, fprintf_error);
+
+      *haveproxyserver = 1;
+   }
+
+   if ((p = socks_getenv(ENV_HTTP_PROXY, dontcare)) != NULL && *p != NUL) {
+      struct sockaddr_storage sa;
+      int gaierr;
+      char emsg[512];
+
+      if (urlstring2sockaddr(p, &sa, &gaierr, emsg, sizeof(emsg)) == NULL)
+         serr("%s: could not convert to %s to an Internet address",
+              function, p);
+
+      if (fprintf(fp,
+"route {\n"
+"         from: 0.0.0.0/0 to: 0.0.0.0/0 via: %s port = %d\n"
+"         proxyprotocol: http_v1.0\n"
+"         %s"
+"}\n",
+                  sockaddr2string2(&sa, 0, NULL, 0),
+                  ntohs(GET_SOCKADDRPORT(&sa)),
+                  extrarouteinfo)
+      == -1)
+         serr("%s: %s", function, fprintf_error);
+
+      *haveproxyserver = 1;
+   }
+
+   if ((p = socks_getenv(ENV_UPNP_IGD, dontcare)) != NULL && *p != NUL) {
+      if (fprintf(fp,
+"route {\n"
+"         from: 0.0.0.0/0 to: 0.0.0.0/0 via: %s\n"
+"         proxyprotocol: upnp\n"
+"         %s"
+"}\n",            p, extrarouteinfo) == -1)
+         serr("%s: %s", function, fprintf_error);
+
+      *haveproxyserver = 1;
+   }
+
+
+   /*
+    * End of possible settings we want to parse with yacc/lex.
+    */
+
+   if (fseek(fp, 0, SEEK_SET) != 0)
+      yyerror("fseek(3) on tmpfile used to hold environment-settings failed");
+
+   yyin = fp;
+
+   lex_dorestart             = 1;
+   parsingconfig             = 1;
+   p                         = sockscf.option.configfile;
+   sockscf.option.configfile = "<generated socks.conf>";
+
+#if SOCKSLIBRARY_DYNAMIC
+   socks_markasnative("*");
+#endif /* SOCKSLIBRARY_DYNAMIC */
+
+   yyparse();
+
+#if SOCKSLIBRARY_DYNAMIC
+   socks_markasnormal("*");
+#endif /* SOCKSLIBRARY_DYNAMIC */
+
+   sockscf.option.configfile = p;
+   parsingconfig             = 0;
+
+   fclose(fp);
+
+   if (socks_getenv(ENV_SOCKS_AUTOADD_LANROUTES, isfalse) == NULL) {
+      /*
+       * assume it's good to add direct routes for the lan also.
+       */
+      struct ifaddrs *ifap;
+
+      slog(LOG_DEBUG, "%s: auto-adding direct routes for lan ...", function);
+
+      if (getifaddrs(&ifap) == 0) {
+         command_t commands;
+         protocol_t protocols;
+         struct ifaddrs *iface;
+
+         bzero(&commands, sizeof(commands));
+         bzero(&protocols, sizeof(protocols));
+
+         protocols.tcp = 1;
+         protocols.udp = 1;
+
+         commands.connect      = 1;
+         commands.udpassociate = 1;
+
+         for (iface = ifap; iface != NULL; iface = iface->ifa_next)
+            if (iface->ifa_addr            != NULL
+            &&  iface->ifa_addr->sa_family == AF_INET) {
+               if (iface->ifa_netmask == NULL) {
+                  swarn("interface %s missing netmask, skipping",
+                        iface->ifa_name);
+                  continue;
+               }
+
+               socks_autoadd_directroute(&commands,
+                                         &protocols,
+                                         TOCSS(iface->ifa_addr),
+                                         TOCSS(iface->ifa_netmask));
+            }
+
+         freeifaddrs(ifap);
+      }
+   }
+   else
+      slog(LOG_DEBUG, "%s: not auto-adding direct routes for lan", function);
+}
+
+static char *
+serverstring2gwstring(serverstring, version, gw, gwsize)
+   const char *serverstring;
+   const int version;
+   char *gw;
+   const size_t gwsize;
+{
+   const char *function = "serverstring2gwstring()";
+   char *sep, emsg[256];
+
+   if (version != PROXY_SOCKS_V4 && version != PROXY_SOCKS_V5)
+      return gw; /* should be in desired format already. */
+
+   if (strlen(serverstring) >= gwsize)
+      serrx("%s: value of proxyserver (%s) set in environment is too long.  "
+            "Max length is %lu",
+            function, serverstring, (unsigned long)(gwsize - 1));
+
+   if ((sep = strrchr(serverstring, ':')) != NULL && *(sep + 1) != NUL) {
+      long port;
+
+      if ((port = string2portnumber(sep + 1, emsg, sizeof(emsg))) == -1)
+         yyerrorx("%s: %s", function, emsg);
+
+      memcpy(gw, serverstring, sep - serverstring);
+      snprintf(&gw[sep - serverstring],
+               gwsize - (sep - serverstring),
+               " port = %u",
+               (in_port_t)port);
+   }
+   else {
+      char visbuf[256];
+
+      yyerrorx("%s: could not find portnumber in %s serverstring \"%s\"",
+               function,
+               proxyprotocol2string(version),
+               str2vis(sep == NULL ? serverstring : sep,
+                       strlen(sep == NULL ? serverstring : sep),
+                       visbuf,
+                       sizeof(visbuf)));
+   }
+
+   return gw;
+}
+
+#else /* !SOCKS_CLIENT */
+
+static void
+pre_addrule(rule)
+   rule_t *rule;
+{
+
+   rule->src   = src;
+   rule->dst   = dst;
+
+#if HAVE_SOCKS_HOSTID
+   rule->hostid      = hostid;
+#endif /* HAVE_SOCKS_HOSTID */
+
+   rule->rdr_from    = rdr_from;
+   rule->rdr_to      = rdr_to;
+
+   if (session_isset) {
+      if ((rule->ss = malloc(sizeof(*rule->ss))) == NULL)
+         yyerror("failed to malloc(3) %lu bytes for session memory",
+                 (unsigned long)sizeof(*rule->ss));
+
+      *rule->ss = ss;
+   }
+
+   if (bw_isset) {
+      if ((rule->bw = malloc(sizeof(*rule->bw))) == NULL)
+         yyerror("failed to malloc(3) %lu bytes for bw memory",
+                 (unsigned long)sizeof(*rule->bw));
+
+      *rule->bw = bw;
+   }
+}
+
+
+static void
+post_addrule(void)
+{
+
+   timeout = &sockscf.timeout; /* default is global timeout, unless in a rule */
+}
+
+static void
+ruleinit(rule)
+   rule_t *rule;
+{
+   bzero(rule, sizeof(*rule));
+
+   rule->linenumber  = yylineno;
+
+#if HAVE_SOCKS_HOSTID
+   rule->hostindex          = DEFAULT_HOSTINDEX;
+   hostindex                = &rule->hostindex;
+
+   rule->hostidoption_isset = 0;
+   hostidoption_isset       = &rule->hostidoption_isset;
+#endif /* HAVE_SOCKS_HOSTID */
+
+   state          = &rule->state;
+
+   cmethodv       = state->cmethodv;
+   cmethodc       = &state->cmethodc;
+
+   smethodv       = state->smethodv;
+   smethodc       = &state->smethodc;
+
+   /*
+    * default values: same as global.
+    */
+
+   timeout       = &rule->timeout;
+   *timeout      = sockscf.timeout;
+
+#if HAVE_GSSAPI
+   gssapiservicename = state->gssapiservicename;
+   gssapikeytab      = state->gssapikeytab;
+   gssapiencryption  = &state->gssapiencryption;
+#endif /* HAVE_GSSAPI */
+
+#if HAVE_LDAP
+   ldap              = &state->ldap;
+#endif
+
+   bzero(&src, sizeof(src));
+   bzero(&dst, sizeof(dst));
+   bzero(&hostid, sizeof(hostid));
+
+   bzero(&rdr_from, sizeof(rdr_from));
+   bzero(&rdr_to, sizeof(rdr_to));
+
+#if BAREFOOTD
+   bzero(&bounceto, sizeof(bounceto));
+#endif /* BAREFOOTD */
+
+   rule->bw_isinheritable   = rule->ss_isinheritable = 1;
+
+   bzero(&ss, sizeof(ss));
+   bzero(&bw, sizeof(bw));
+
+   bw_isset = session_isset = 0;
+   bw.type  = SHMEM_BW;
+   ss.type  = SHMEM_SS;
+}
+
+void
+alarminit(void)
+{
+    static int alarmside_mem;
+
+   alarmside  = &alarmside_mem;
+   *alarmside = 0;
+}
+
+static void
+monitorinit(monitor)
+   monitor_t *monitor;
+{
+   static int alarmside_mem;
+
+   alarmside = &alarmside_mem;
+
+   bzero(monitor, sizeof(*monitor));
+
+   monitor->linenumber = yylineno;
+
+   state                       = &monitor->state;
+
+#if HAVE_SOCKS_HOSTID
+   monitor->hostindex          = DEFAULT_HOSTINDEX;
+   hostindex                   = &monitor->hostindex;
+
+   monitor->hostidoption_isset = 0;
+   hostidoption_isset          = &monitor->hostidoption_isset;
+#endif /* HAVE_SOCKS_HOSTID */
+
+   bzero(&src, sizeof(src));
+   bzero(&dst, sizeof(dst));
+   bzero(&hostid, sizeof(hostid));
+
+   if ((monitor->mstats = malloc(sizeof(*monitor->mstats))) == NULL)
+      yyerror("failed to malloc(3) %lu bytes for monitor stats memory",
+              (unsigned long)sizeof(*monitor->mstats));
+   else
+      bzero(monitor->mstats, sizeof(*monitor->mstats));
+
+   monitor->mstats->type = SHMEM_MONITOR;
+}
+
+static void
+pre_addmonitor(monitor)
+   monitor_t *monitor;
+{
+   monitor->src    = src;
+   monitor->dst    = dst;
+
+#if HAVE_SOCKS_HOSTID
+   monitor->hostid = hostid;
+#endif /* HAVE_SOCKS_HOSTID */
+}
+
+static int
+configure_privileges(void)
+{
+   const char *function = "configure_privileges()";
+   static int isfirsttime = 1;
+
+   if (sockscf.option.verifyonly)
+      return 0;
+
+#if !HAVE_PRIVILEGES
+   uid_t uid; /* for debugging. */
+   gid_t gid; /* for debugging. */
+
+   SASSERTX(sockscf.state.euid == (uid = geteuid()));
+   SASSERTX(sockscf.state.egid == (gid = getegid()));
+
+   /*
+    * Check all configured uids/gids work.
+    */
+
+   checkugid(&sockscf.uid.privileged_uid,
+             &sockscf.uid.privileged_gid,
+             &sockscf.uid.privileged_isset,
+             "privileged");
+
+   checkugid(&sockscf.uid.unprivileged_uid,
+             &sockscf.uid.unprivileged_gid,
+             &sockscf.uid.unprivileged_isset,
+             "unprivileged");
+
+#if HAVE_LIBWRAP
+   if (!sockscf.uid.libwrap_isset
+   &&  sockscf.uid.unprivileged_isset) {
+      sockscf.uid.libwrap_uid   = sockscf.uid.unprivileged_uid;
+      sockscf.uid.libwrap_gid   = sockscf.uid.unprivileged_gid;
+      sockscf.uid.libwrap_isset = sockscf.uid.unprivileged_isset;
+   }
+   else
+      checkugid(&sockscf.uid.libwrap_uid,
+                &sockscf.uid.libwrap_gid,
+                &sockscf.uid.libwrap_isset,
+                "libwrap");
+#endif /* HAVE_LIBWRAP */
+
+   SASSERTX(sockscf.state.euid == (uid = geteuid()));
+   SASSERTX(sockscf.state.egid == (gid = getegid()));
+
+#endif /* !HAVE_PRIVILEGES */
+
+   if (isfirsttime) {
+      if (sockd_initprivs() != 0) {
+         slog(HAVE_PRIVILEGES ? LOG_INFO : LOG_WARNING,
+              "%s: could not initialize privileges (%s)%s",
+              function,
+              strerror(errno),
+              geteuid() == 0 ?
+                   "" : ".  Usually we need to be started by root if "
+                        "special privileges are to be available");
+
+#if HAVE_PRIVILEGES
+         /*
+          * assume failure in this case is not fatal; some privileges will
+          * not be available to us, and perhaps that is the intention too.
+          */
+         return 0;
+
+#else
+         return -1;
+#endif /* !HAVE_PRIVILEGES */
+      }
+
+      isfirsttime = 0;
+   }
+
+   return 0;
+}
+
+static int
+checkugid(uid, gid, isset, type)
+   uid_t *uid;
+   gid_t *gid;
+   unsigned char *isset;
+   const char *type;
+{
+   const char *function = "checkugid()";
+
+   SASSERTX(sockscf.state.euid == geteuid());
+   SASSERTX(sockscf.state.egid == getegid());
+
+   if (sockscf.option.verifyonly)
+      return 0;
+
+   if (!(*isset)) {
+      *uid   = sockscf.state.euid;
+      *gid   = sockscf.state.egid;
+      *isset = 1;
+
+      return 0;
+   }
+
+   if (*uid != sockscf.state.euid) {
+      if (seteuid(*uid) != 0) {
+         swarn("%s: could not seteuid(2) to %s uid %lu",
+               function, type, (unsigned long)*uid);
+
+         return -1;
+      }
+
+      (void)seteuid(0);
+
+      if (seteuid(sockscf.state.euid) != 0) {
+         swarn("%s: could not revert to euid %lu from euid %lu",
+               function,
+               (unsigned long)sockscf.state.euid,
+               (unsigned long)geteuid());
+         SWARN(0);
+
+         sockscf.state.euid = geteuid();
+         return -1;
+      }
+   }
+
+   if (*gid != sockscf.state.egid) {
+      (void)seteuid(0);
+
+      if (setegid(*gid) != 0) {
+         swarn("%s: could not setegid(2) to %s gid %lu",
+               function, type, (unsigned long)*gid);
+
+         return -1;
+      }
+
+      (void)seteuid(0);
+
+      if (setegid(sockscf.state.egid) != 0) {
+         swarn("%s: could not revert to egid %lu from euid %lu",
+               function,
+               (unsigned long)sockscf.state.egid,
+               (unsigned long)geteuid());
+         SWARN(0);
+
+         sockscf.state.egid = getegid();
+         return -1;
+      }
+
+      if (seteuid(sockscf.state.euid) != 0) {
+         swarn("%s: could not revert to euid %lu from euid %lu",
+               function,
+               (unsigned long)sockscf.state.euid,
+               (unsigned long)geteuid());
+         SWARN(0);
+
+         sockscf.state.euid = geteuid();
+         return -1;
+      }
+   }
+
+   SASSERTX(sockscf.state.euid == geteuid());
+   SASSERTX(sockscf.state.egid == getegid());
+
+   return 0;
+}
+
+#endif /* !SOCKS_CLIENT */
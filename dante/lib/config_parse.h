@@ -1,223 +1,530 @@
-#define ALARM 257
-#define ALARMTYPE_DATA 258
-#define ALARMTYPE_DISCONNECT 259
-#define ALARMIF_INTERNAL 260
-#define ALARMIF_EXTERNAL 261
-#define TCPOPTION_DISABLED 262
-#define ECN 263
-#define SACK 264
-#define TIMESTAMPS 265
-#define WSCALE 266
-#define MTU_ERROR 267
-#define CLIENTCOMPATIBILITY 268
-#define NECGSSAPI 269
-#define CLIENTRULE 270
-#define HOSTIDRULE 271
-#define SOCKSRULE 272
-#define COMPATIBILITY 273
-#define SAMEPORT 274
-#define DRAFT_5_05 275
-#define CONNECTTIMEOUT 276
-#define TCP_FIN_WAIT 277
-#define CPU 278
-#define MASK 279
-#define SCHEDULE 280
-#define CPUMASK_ANYCPU 281
-#define DEBUGGING 282
-#define DEPRECATED 283
-#define ERRORLOG 284
-#define LOGOUTPUT 285
-#define LOGFILE 286
-#define LOGTYPE_ERROR 287
-#define LOGTYPE_TCP_DISABLED 288
-#define LOGTYPE_TCP_ENABLED 289
-#define LOGIF_INTERNAL 290
-#define LOGIF_EXTERNAL 291
-#define ERRORVALUE 292
-#define EXTENSION 293
-#define BIND 294
-#define PRIVILEGED 295
-#define EXTERNAL_PROTOCOL 296
-#define INTERNAL_PROTOCOL 297
-#define EXTERNAL_ROTATION 298
-#define SAMESAME 299
-#define GROUPNAME 300
-#define HOSTID 301
-#define HOSTINDEX 302
-#define INTERFACE 303
-#define SOCKETOPTION_SYMBOLICVALUE 304
-#define INTERNAL 305
-#define EXTERNAL 306
-#define INTERNALSOCKET 307
-#define EXTERNALSOCKET 308
-#define IOTIMEOUT 309
-#define IOTIMEOUT_TCP 310
-#define IOTIMEOUT_UDP 311
-#define NEGOTIATETIMEOUT 312
-#define LIBWRAP_FILE 313
-#define LOGLEVEL 314
-#define SOCKSMETHOD 315
-#define CLIENTMETHOD 316
-#define METHOD 317
-#define METHODNAME 318
-#define NONE 319
-#define BSDAUTH 320
-#define GSSAPI 321
-#define PAM_ADDRESS 322
-#define PAM_ANY 323
-#define PAM_USERNAME 324
-#define RFC931 325
-#define UNAME 326
-#define MONITOR 327
-#define PROCESSTYPE 328
-#define PROC_MAXREQUESTS 329
-#define REALM 330
-#define REALNAME 331
-#define RESOLVEPROTOCOL 332
-#define REQUIRED 333
-#define SCHEDULEPOLICY 334
-#define SERVERCONFIG 335
-#define CLIENTCONFIG 336
-#define SOCKET 337
-#define CLIENTSIDE_SOCKET 338
-#define SNDBUF 339
-#define RCVBUF 340
-#define SOCKETPROTOCOL 341
-#define SOCKETOPTION_OPTID 342
-#define SRCHOST 343
-#define NODNSMISMATCH 344
-#define NODNSUNKNOWN 345
-#define CHECKREPLYAUTH 346
-#define USERNAME 347
-#define USER_PRIVILEGED 348
-#define USER_UNPRIVILEGED 349
-#define USER_LIBWRAP 350
-#define WORD__IN 351
-#define ROUTE 352
-#define VIA 353
-#define GLOBALROUTEOPTION 354
-#define BADROUTE_EXPIRE 355
-#define MAXFAIL 356
-#define PORT 357
-#define NUMBER 358
-#define BANDWIDTH 359
-#define BOUNCE 360
-#define BSDAUTHSTYLE 361
-#define BSDAUTHSTYLENAME 362
-#define COMMAND 363
-#define COMMAND_BIND 364
-#define COMMAND_CONNECT 365
-#define COMMAND_UDPASSOCIATE 366
-#define COMMAND_BINDREPLY 367
-#define COMMAND_UDPREPLY 368
-#define ACTION 369
-#define FROM 370
-#define TO 371
-#define GSSAPIENCTYPE 372
-#define GSSAPIENC_ANY 373
-#define GSSAPIENC_CLEAR 374
-#define GSSAPIENC_INTEGRITY 375
-#define GSSAPIENC_CONFIDENTIALITY 376
-#define GSSAPIENC_PERMESSAGE 377
-#define GSSAPIKEYTAB 378
-#define GSSAPISERVICE 379
-#define GSSAPISERVICENAME 380
-#define GSSAPIKEYTABNAME 381
-#define IPV4 382
-#define IPV6 383
-#define IPVANY 384
-#define DOMAINNAME 385
-#define IFNAME 386
-#define URL 387
-#define LDAPATTRIBUTE 388
-#define LDAPATTRIBUTE_AD 389
-#define LDAPATTRIBUTE_HEX 390
-#define LDAPATTRIBUTE_AD_HEX 391
-#define LDAPBASEDN 392
-#define LDAP_BASEDN 393
-#define LDAPBASEDN_HEX 394
-#define LDAPBASEDN_HEX_ALL 395
-#define LDAPCERTFILE 396
-#define LDAPCERTPATH 397
-#define LDAPPORT 398
-#define LDAPPORTSSL 399
-#define LDAPDEBUG 400
-#define LDAPDEPTH 401
-#define LDAPAUTO 402
-#define LDAPSEARCHTIME 403
-#define LDAPDOMAIN 404
-#define LDAP_DOMAIN 405
-#define LDAPFILTER 406
-#define LDAPFILTER_AD 407
-#define LDAPFILTER_HEX 408
-#define LDAPFILTER_AD_HEX 409
-#define LDAPGROUP 410
-#define LDAPGROUP_NAME 411
-#define LDAPGROUP_HEX 412
-#define LDAPGROUP_HEX_ALL 413
-#define LDAPKEYTAB 414
-#define LDAPKEYTABNAME 415
-#define LDAPDEADTIME 416
-#define LDAPSERVER 417
-#define LDAPSERVER_NAME 418
-#define LDAPSSL 419
-#define LDAPCERTCHECK 420
-#define LDAPKEEPREALM 421
-#define LDAPTIMEOUT 422
-#define LDAPCACHE 423
-#define LDAPCACHEPOS 424
-#define LDAPCACHENEG 425
-#define LDAPURL 426
-#define LDAP_URL 427
-#define LDAP_FILTER 428
-#define LDAP_ATTRIBUTE 429
-#define LDAP_CERTFILE 430
-#define LDAP_CERTPATH 431
-#define LIBWRAPSTART 432
-#define LIBWRAP_ALLOW 433
-#define LIBWRAP_DENY 434
-#define LIBWRAP_HOSTS_ACCESS 435
-#define LINE 436
-#define OPERATOR 437
-#define PAMSERVICENAME 438
-#define PROTOCOL 439
-#define PROTOCOL_TCP 440
-#define PROTOCOL_UDP 441
-#define PROTOCOL_FAKE 442
-#define PROXYPROTOCOL 443
-#define PROXYPROTOCOL_SOCKS_V4 444
-#define PROXYPROTOCOL_SOCKS_V5 445
-#define PROXYPROTOCOL_HTTP 446
-#define PROXYPROTOCOL_UPNP 447
-#define REDIRECT 448
-#define SENDSIDE 449
-#define RECVSIDE 450
-#define SERVICENAME 451
-#define SESSION_INHERITABLE 452
-#define SESSIONMAX 453
-#define SESSIONTHROTTLE 454
-#define SESSIONSTATE_KEY 455
-#define SESSIONSTATE_MAX 456
-#define SESSIONSTATE_THROTTLE 457
-#define RULE_LOG 458
-#define RULE_LOG_CONNECT 459
-#define RULE_LOG_DATA 460
-#define RULE_LOG_DISCONNECT 461
-#define RULE_LOG_ERROR 462
-#define RULE_LOG_IOOPERATION 463
-#define RULE_LOG_TCPINFO 464
-#define STATEKEY 465
-#define UDPPORTRANGE 466
-#define UDPCONNECTDST 467
-#define USER 468
-#define GROUP 469
-#define VERDICT_BLOCK 470
-#define VERDICT_PASS 471
-#define YES 472
-#define NO 473
-#ifndef YYSTYPE_DEFINED
-#define YYSTYPE_DEFINED
-typedef union {
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_SOCKS_YY_CONFIG_PARSE_H_INCLUDED
+# define YY_SOCKS_YY_CONFIG_PARSE_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int socks_yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    ALARM = 258,                   /* ALARM  */
+    ALARMTYPE_DATA = 259,          /* ALARMTYPE_DATA  */
+    ALARMTYPE_DISCONNECT = 260,    /* ALARMTYPE_DISCONNECT  */
+    ALARMIF_INTERNAL = 261,        /* ALARMIF_INTERNAL  */
+    ALARMIF_EXTERNAL = 262,        /* ALARMIF_EXTERNAL  */
+    TCPOPTION_DISABLED = 263,      /* TCPOPTION_DISABLED  */
+    ECN = 264,                     /* ECN  */
+    SACK = 265,                    /* SACK  */
+    TIMESTAMPS = 266,              /* TIMESTAMPS  */
+    WSCALE = 267,                  /* WSCALE  */
+    MTU_ERROR = 268,               /* MTU_ERROR  */
+    CLIENTCOMPATIBILITY = 269,     /* CLIENTCOMPATIBILITY  */
+    NECGSSAPI = 270,               /* NECGSSAPI  */
+    CLIENTRULE = 271,              /* CLIENTRULE  */
+    HOSTIDRULE = 272,              /* HOSTIDRULE  */
+    SOCKSRULE = 273,               /* SOCKSRULE  */
+    COMPATIBILITY = 274,           /* COMPATIBILITY  */
+    SAMEPORT = 275,                /* SAMEPORT  */
+    DRAFT_5_05 = 276,              /* DRAFT_5_05  */
+    CONNECTTIMEOUT = 277,          /* CONNECTTIMEOUT  */
+    TCP_FIN_WAIT = 278,            /* TCP_FIN_WAIT  */
+    CPU = 279,                     /* CPU  */
+    MASK = 280,                    /* MASK  */
+    SCHEDULE = 281,                /* SCHEDULE  */
+    CPUMASK_ANYCPU = 282,          /* CPUMASK_ANYCPU  */
+    CPUMASK_PERCPU = 283,          /* CPUMASK_PERCPU  */
+    DEBUGGING = 284,               /* DEBUGGING  */
+    DEPRECATED = 285,              /* DEPRECATED  */
+    ERRORLOG = 286,                /* ERRORLOG  */
+    LOGOUTPUT = 287,               /* LOGOUTPUT  */
+    LOGFILE = 288,                 /* LOGFILE  */
+    LOGTYPE_ERROR = 289,           /* LOGTYPE_ERROR  */
+    LOGTYPE_TCP_DISABLED = 290,    /* LOGTYPE_TCP_DISABLED  */
+    LOGTYPE_TCP_ENABLED = 291,     /* LOGTYPE_TCP_ENABLED  */
+    LOGIF_INTERNAL = 292,          /* LOGIF_INTERNAL  */
+    LOGIF_EXTERNAL = 293,          /* LOGIF_EXTERNAL  */
+    ERRORVALUE = 294,              /* ERRORVALUE  */
+    EXTENSION = 295,               /* EXTENSION  */
+    BIND = 296,                    /* BIND  */
+    PRIVILEGED = 297,              /* PRIVILEGED  */
+    EXTERNAL_PROTOCOL = 298,       /* EXTERNAL_PROTOCOL  */
+    INTERNAL_PROTOCOL = 299,       /* INTERNAL_PROTOCOL  */
+    EXTERNAL_ROTATION = 300,       /* EXTERNAL_ROTATION  */
+    SAMESAME = 301,                /* SAMESAME  */
+    GROUPNAME = 302,               /* GROUPNAME  */
+    HOSTID = 303,                  /* HOSTID  */
+    HOSTINDEX = 304,               /* HOSTINDEX  */
+    INTERFACE = 305,               /* INTERFACE  */
+    SOCKETOPTION_SYMBOLICVALUE = 306, /* SOCKETOPTION_SYMBOLICVALUE  */
+    INTERNAL = 307,                /* INTERNAL  */
+    EXTERNAL = 308,                /* EXTERNAL  */
+    INTERNALSOCKET = 309,          /* INTERNALSOCKET  */
+    EXTERNALSOCKET = 310,          /* EXTERNALSOCKET  */
+    IOTIMEOUT = 311,               /* IOTIMEOUT  */
+    IOTIMEOUT_TCP = 312,           /* IOTIMEOUT_TCP  */
+    IOTIMEOUT_UDP = 313,           /* IOTIMEOUT_UDP  */
+    NEGOTIATETIMEOUT = 314,        /* NEGOTIATETIMEOUT  */
+    LIBWRAP_FILE = 315,            /* LIBWRAP_FILE  */
+    LOGLEVEL = 316,                /* LOGLEVEL  */
+    SOCKSMETHOD = 317,             /* SOCKSMETHOD  */
+    CLIENTMETHOD = 318,            /* CLIENTMETHOD  */
+    METHOD = 319,                  /* METHOD  */
+    METHODNAME = 320,              /* METHODNAME  */
+    NONE = 321,                    /* NONE  */
+    BSDAUTH = 322,                 /* BSDAUTH  */
+    GSSAPI = 323,                  /* GSSAPI  */
+    PAM_ADDRESS = 324,             /* PAM_ADDRESS  */
+    PAM_ANY = 325,                 /* PAM_ANY  */
+    PAM_USERNAME = 326,            /* PAM_USERNAME  */
+    RFC931 = 327,                  /* RFC931  */
+    UNAME = 328,                   /* UNAME  */
+    MONITOR = 329,                 /* MONITOR  */
+    PROCESSTYPE = 330,             /* PROCESSTYPE  */
+    PROC_MAXREQUESTS = 331,        /* PROC_MAXREQUESTS  */
+    PROC_MAXCLIENTS_NEGOTIATE = 332, /* PROC_MAXCLIENTS_NEGOTIATE  */
+    PROC_MAXCLIENTS_IO = 333,      /* PROC_MAXCLIENTS_IO  */
+    PROC_MAXCLIENTS_REQUEST = 334, /* PROC_MAXCLIENTS_REQUEST  */
+    PROC_REUSEPORT = 335,          /* PROC_REUSEPORT  */
+    PROC_ALLINONE = 336,           /* PROC_ALLINONE  */
+    HOSTCACHE_ENTRIES = 337,       /* HOSTCACHE_ENTRIES  */
+    HOSTCACHE_TTL_MIN = 338,       /* HOSTCACHE_TTL_MIN  */
+    HOSTCACHE_TTL_MAX = 339,       /* HOSTCACHE_TTL_MAX  */
+    HAPPYEYEBALLS_DELAY = 340,     /* HAPPYEYEBALLS_DELAY  */
+    REALM = 341,                   /* REALM  */
+    REALNAME = 342,                /* REALNAME  */
+    RESOLVEPROTOCOL = 343,         /* RESOLVEPROTOCOL  */
+    REQUIRED = 344,                /* REQUIRED  */
+    SCHEDULEPOLICY = 345,          /* SCHEDULEPOLICY  */
+    SERVERCONFIG = 346,            /* SERVERCONFIG  */
+    CLIENTCONFIG = 347,            /* CLIENTCONFIG  */
+    SOCKET = 348,                  /* SOCKET  */
+    CLIENTSIDE_SOCKET = 349,       /* CLIENTSIDE_SOCKET  */
+    SNDBUF = 350,                  /* SNDBUF  */
+    RCVBUF = 351,                  /* RCVBUF  */
+    SOCKETPROTOCOL = 352,          /* SOCKETPROTOCOL  */
+    SOCKETOPTION_OPTID = 353,      /* SOCKETOPTION_OPTID  */
+    SRCHOST = 354,                 /* SRCHOST  */
+    NODNSMISMATCH = 355,           /* NODNSMISMATCH  */
+    NODNSUNKNOWN = 356,            /* NODNSUNKNOWN  */
+    CHECKREPLYAUTH = 357,          /* CHECKREPLYAUTH  */
+    USERNAME = 358,                /* USERNAME  */
+    USER_PRIVILEGED = 359,         /* USER_PRIVILEGED  */
+    USER_UNPRIVILEGED = 360,       /* USER_UNPRIVILEGED  */
+    USER_LIBWRAP = 361,            /* USER_LIBWRAP  */
+    WORD__IN = 362,                /* WORD__IN  */
+    ROUTE = 363,                   /* ROUTE  */
+    VIA = 364,                     /* VIA  */
+    GLOBALROUTEOPTION = 365,       /* GLOBALROUTEOPTION  */
+    BADROUTE_EXPIRE = 366,         /* BADROUTE_EXPIRE  */
+    MAXFAIL = 367,                 /* MAXFAIL  */
+    ROUTE_WEIGHT = 368,            /* ROUTE_WEIGHT  */
+    PORT = 369,                    /* PORT  */
+    NUMBER = 370,                  /* NUMBER  */
+    BANDWIDTH = 371,               /* BANDWIDTH  */
+    BOUNCE = 372,                  /* BOUNCE  */
+    BSDAUTHSTYLE = 373,            /* BSDAUTHSTYLE  */
+    BSDAUTHSTYLENAME = 374,        /* BSDAUTHSTYLENAME  */
+    COMMAND = 375,                 /* COMMAND  */
+    COMMAND_BIND = 376,            /* COMMAND_BIND  */
+    COMMAND_CONNECT = 377,         /* COMMAND_CONNECT  */
+    COMMAND_UDPASSOCIATE = 378,    /* COMMAND_UDPASSOCIATE  */
+    COMMAND_BINDREPLY = 379,       /* COMMAND_BINDREPLY  */
+    COMMAND_UDPREPLY = 380,        /* COMMAND_UDPREPLY  */
+    ACTION = 381,                  /* ACTION  */
+    FROM = 382,                    /* FROM  */
+    TO = 383,                      /* TO  */
+    GSSAPIENCTYPE = 384,           /* GSSAPIENCTYPE  */
+    GSSAPIENC_ANY = 385,           /* GSSAPIENC_ANY  */
+    GSSAPIENC_CLEAR = 386,         /* GSSAPIENC_CLEAR  */
+    GSSAPIENC_INTEGRITY = 387,     /* GSSAPIENC_INTEGRITY  */
+    GSSAPIENC_CONFIDENTIALITY = 388, /* GSSAPIENC_CONFIDENTIALITY  */
+    GSSAPIENC_PERMESSAGE = 389,    /* GSSAPIENC_PERMESSAGE  */
+    GSSAPIKEYTAB = 390,            /* GSSAPIKEYTAB  */
+    GSSAPISERVICE = 391,           /* GSSAPISERVICE  */
+    GSSAPISERVICENAME = 392,       /* GSSAPISERVICENAME  */
+    GSSAPIKEYTABNAME = 393,        /* GSSAPIKEYTABNAME  */
+    IPV4 = 394,                    /* IPV4  */
+    IPV6 = 395,                    /* IPV6  */
+    IPVANY = 396,                  /* IPVANY  */
+    DOMAINNAME = 397,              /* DOMAINNAME  */
+    IFNAME = 398,                  /* IFNAME  */
+    URL = 399,                     /* URL  */
+    LDAPATTRIBUTE = 400,           /* LDAPATTRIBUTE  */
+    LDAPATTRIBUTE_AD = 401,        /* LDAPATTRIBUTE_AD  */
+    LDAPATTRIBUTE_HEX = 402,       /* LDAPATTRIBUTE_HEX  */
+    LDAPATTRIBUTE_AD_HEX = 403,    /* LDAPATTRIBUTE_AD_HEX  */
+    LDAPBASEDN = 404,              /* LDAPBASEDN  */
+    LDAP_BASEDN = 405,             /* LDAP_BASEDN  */
+    LDAPBASEDN_HEX = 406,          /* LDAPBASEDN_HEX  */
+    LDAPBASEDN_HEX_ALL = 407,      /* LDAPBASEDN_HEX_ALL  */
+    LDAPCERTFILE = 408,            /* LDAPCERTFILE  */
+    LDAPCERTPATH = 409,            /* LDAPCERTPATH  */
+    LDAPPORT = 410,                /* LDAPPORT  */
+    LDAPPORTSSL = 411,             /* LDAPPORTSSL  */
+    LDAPDEBUG = 412,               /* LDAPDEBUG  */
+    LDAPDEPTH = 413,               /* LDAPDEPTH  */
+    LDAPAUTO = 414,                /* LDAPAUTO  */
+    LDAPSEARCHTIME = 415,          /* LDAPSEARCHTIME  */
+    LDAPDOMAIN = 416,              /* LDAPDOMAIN  */
+    LDAP_DOMAIN = 417,             /* LDAP_DOMAIN  */
+    LDAPFILTER = 418,              /* LDAPFILTER  */
+    LDAPFILTER_AD = 419,           /* LDAPFILTER_AD  */
+    LDAPFILTER_HEX = 420,          /* LDAPFILTER_HEX  */
+    LDAPFILTER_AD_HEX = 421,       /* LDAPFILTER_AD_HEX  */
+    LDAPGROUP = 422,               /* LDAPGROUP  */
+    LDAPGROUP_NAME = 423,          /* LDAPGROUP_NAME  */
+    LDAPGROUP_HEX = 424,           /* LDAPGROUP_HEX  */
+    LDAPGROUP_HEX_ALL = 425,       /* LDAPGROUP_HEX_ALL  */
+    LDAPKEYTAB = 426,              /* LDAPKEYTAB  */
+    LDAPKEYTABNAME = 427,          /* LDAPKEYTABNAME  */
+    LDAPDEADTIME = 428,            /* LDAPDEADTIME  */
+    LDAPSERVER = 429,              /* LDAPSERVER  */
+    LDAPSERVER_NAME = 430,         /* LDAPSERVER_NAME  */
+    LDAPSSL = 431,                 /* LDAPSSL  */
+    LDAPCERTCHECK = 432,           /* LDAPCERTCHECK  */
+    LDAPKEEPREALM = 433,           /* LDAPKEEPREALM  */
+    LDAPTIMEOUT = 434,             /* LDAPTIMEOUT  */
+    LDAPCACHE = 435,               /* LDAPCACHE  */
+    LDAPCACHEPOS = 436,            /* LDAPCACHEPOS  */
+    LDAPCACHENEG = 437,            /* LDAPCACHENEG  */
+    LDAPURL = 438,                 /* LDAPURL  */
+    LDAP_URL = 439,                /* LDAP_URL  */
+    LDAP_FILTER = 440,             /* LDAP_FILTER  */
+    LDAP_ATTRIBUTE = 441,          /* LDAP_ATTRIBUTE  */
+    LDAP_CERTFILE = 442,           /* LDAP_CERTFILE  */
+    LDAP_CERTPATH = 443,           /* LDAP_CERTPATH  */
+    LIBWRAPSTART = 444,            /* LIBWRAPSTART  */
+    LIBWRAP_ALLOW = 445,           /* LIBWRAP_ALLOW  */
+    LIBWRAP_DENY = 446,            /* LIBWRAP_DENY  */
+    LIBWRAP_HOSTS_ACCESS = 447,    /* LIBWRAP_HOSTS_ACCESS  */
+    LINE = 448,                    /* LINE  */
+    OPERATOR = 449,                /* OPERATOR  */
+    PAMSERVICENAME = 450,          /* PAMSERVICENAME  */
+    PROTOCOL = 451,                /* PROTOCOL  */
+    PROTOCOL_TCP = 452,            /* PROTOCOL_TCP  */
+    PROTOCOL_UDP = 453,            /* PROTOCOL_UDP  */
+    PROTOCOL_FAKE = 454,           /* PROTOCOL_FAKE  */
+    PROXYPROTOCOL = 455,           /* PROXYPROTOCOL  */
+    PROXYPROTOCOL_SOCKS_V4 = 456,  /* PROXYPROTOCOL_SOCKS_V4  */
+    PROXYPROTOCOL_SOCKS_V5 = 457,  /* PROXYPROTOCOL_SOCKS_V5  */
+    PROXYPROTOCOL_HTTP = 458,      /* PROXYPROTOCOL_HTTP  */
+    PROXYPROTOCOL_UPNP = 459,      /* PROXYPROTOCOL_UPNP  */
+    REDIRECT = 460,                /* REDIRECT  */
+    SENDSIDE = 461,                /* SENDSIDE  */
+    RECVSIDE = 462,                /* RECVSIDE  */
+    SERVICENAME = 463,             /* SERVICENAME  */
+    SESSION_INHERITABLE = 464,     /* SESSION_INHERITABLE  */
+    SESSIONMAX = 465,              /* SESSIONMAX  */
+    SESSIONTHROTTLE = 466,         /* SESSIONTHROTTLE  */
+    SESSIONSTATE_KEY = 467,        /* SESSIONSTATE_KEY  */
+    SESSIONSTATE_MAX = 468,        /* SESSIONSTATE_MAX  */
+    SESSIONSTATE_THROTTLE = 469,   /* SESSIONSTATE_THROTTLE  */
+    RULE_LOG = 470,                /* RULE_LOG  */
+    RULE_LOG_CONNECT = 471,        /* RULE_LOG_CONNECT  */
+    RULE_LOG_DATA = 472,           /* RULE_LOG_DATA  */
+    RULE_LOG_DISCONNECT = 473,     /* RULE_LOG_DISCONNECT  */
+    RULE_LOG_ERROR = 474,          /* RULE_LOG_ERROR  */
+    RULE_LOG_IOOPERATION = 475,    /* RULE_LOG_IOOPERATION  */
+    RULE_LOG_TCPINFO = 476,        /* RULE_LOG_TCPINFO  */
+    STATEKEY = 477,                /* STATEKEY  */
+    UDPPORTRANGE = 478,            /* UDPPORTRANGE  */
+    UDPCONNECTDST = 479,           /* UDPCONNECTDST  */
+    USER = 480,                    /* USER  */
+    GROUP = 481,                   /* GROUP  */
+    VERDICT_BLOCK = 482,           /* VERDICT_BLOCK  */
+    VERDICT_PASS = 483,            /* VERDICT_PASS  */
+    YES = 484,                     /* YES  */
+    NO = 485                       /* NO  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
+#define ALARM 258
+#define ALARMTYPE_DATA 259
+#define ALARMTYPE_DISCONNECT 260
+#define ALARMIF_INTERNAL 261
+#define ALARMIF_EXTERNAL 262
+#define TCPOPTION_DISABLED 263
+#define ECN 264
+#define SACK 265
+#define TIMESTAMPS 266
+#define WSCALE 267
+#define MTU_ERROR 268
+#define CLIENTCOMPATIBILITY 269
+#define NECGSSAPI 270
+#define CLIENTRULE 271
+#define HOSTIDRULE 272
+#define SOCKSRULE 273
+#define COMPATIBILITY 274
+#define SAMEPORT 275
+#define DRAFT_5_05 276
+#define CONNECTTIMEOUT 277
+#define TCP_FIN_WAIT 278
+#define CPU 279
+#define MASK 280
+#define SCHEDULE 281
+#define CPUMASK_ANYCPU 282
+#define CPUMASK_PERCPU 283
+#define DEBUGGING 284
+#define DEPRECATED 285
+#define ERRORLOG 286
+#define LOGOUTPUT 287
+#define LOGFILE 288
+#define LOGTYPE_ERROR 289
+#define LOGTYPE_TCP_DISABLED 290
+#define LOGTYPE_TCP_ENABLED 291
+#define LOGIF_INTERNAL 292
+#define LOGIF_EXTERNAL 293
+#define ERRORVALUE 294
+#define EXTENSION 295
+#define BIND 296
+#define PRIVILEGED 297
+#define EXTERNAL_PROTOCOL 298
+#define INTERNAL_PROTOCOL 299
+#define EXTERNAL_ROTATION 300
+#define SAMESAME 301
+#define GROUPNAME 302
+#define HOSTID 303
+#define HOSTINDEX 304
+#define INTERFACE 305
+#define SOCKETOPTION_SYMBOLICVALUE 306
+#define INTERNAL 307
+#define EXTERNAL 308
+#define INTERNALSOCKET 309
+#define EXTERNALSOCKET 310
+#define IOTIMEOUT 311
+#define IOTIMEOUT_TCP 312
+#define IOTIMEOUT_UDP 313
+#define NEGOTIATETIMEOUT 314
+#define LIBWRAP_FILE 315
+#define LOGLEVEL 316
+#define SOCKSMETHOD 317
+#define CLIENTMETHOD 318
+#define METHOD 319
+#define METHODNAME 320
+#define NONE 321
+#define BSDAUTH 322
+#define GSSAPI 323
+#define PAM_ADDRESS 324
+#define PAM_ANY 325
+#define PAM_USERNAME 326
+#define RFC931 327
+#define UNAME 328
+#define MONITOR 329
+#define PROCESSTYPE 330
+#define PROC_MAXREQUESTS 331
+#define PROC_MAXCLIENTS_NEGOTIATE 332
+#define PROC_MAXCLIENTS_IO 333
+#define PROC_MAXCLIENTS_REQUEST 334
+#define PROC_REUSEPORT 335
+#define PROC_ALLINONE 336
+#define HOSTCACHE_ENTRIES 337
+#define HOSTCACHE_TTL_MIN 338
+#define HOSTCACHE_TTL_MAX 339
+#define HAPPYEYEBALLS_DELAY 340
+#define REALM 341
+#define REALNAME 342
+#define RESOLVEPROTOCOL 343
+#define REQUIRED 344
+#define SCHEDULEPOLICY 345
+#define SERVERCONFIG 346
+#define CLIENTCONFIG 347
+#define SOCKET 348
+#define CLIENTSIDE_SOCKET 349
+#define SNDBUF 350
+#define RCVBUF 351
+#define SOCKETPROTOCOL 352
+#define SOCKETOPTION_OPTID 353
+#define SRCHOST 354
+#define NODNSMISMATCH 355
+#define NODNSUNKNOWN 356
+#define CHECKREPLYAUTH 357
+#define USERNAME 358
+#define USER_PRIVILEGED 359
+#define USER_UNPRIVILEGED 360
+#define USER_LIBWRAP 361
+#define WORD__IN 362
+#define ROUTE 363
+#define VIA 364
+#define GLOBALROUTEOPTION 365
+#define BADROUTE_EXPIRE 366
+#define MAXFAIL 367
+#define ROUTE_WEIGHT 368
+#define PORT 369
+#define NUMBER 370
+#define BANDWIDTH 371
+#define BOUNCE 372
+#define BSDAUTHSTYLE 373
+#define BSDAUTHSTYLENAME 374
+#define COMMAND 375
+#define COMMAND_BIND 376
+#define COMMAND_CONNECT 377
+#define COMMAND_UDPASSOCIATE 378
+#define COMMAND_BINDREPLY 379
+#define COMMAND_UDPREPLY 380
+#define ACTION 381
+#define FROM 382
+#define TO 383
+#define GSSAPIENCTYPE 384
+#define GSSAPIENC_ANY 385
+#define GSSAPIENC_CLEAR 386
+#define GSSAPIENC_INTEGRITY 387
+#define GSSAPIENC_CONFIDENTIALITY 388
+#define GSSAPIENC_PERMESSAGE 389
+#define GSSAPIKEYTAB 390
+#define GSSAPISERVICE 391
+#define GSSAPISERVICENAME 392
+#define GSSAPIKEYTABNAME 393
+#define IPV4 394
+#define IPV6 395
+#define IPVANY 396
+#define DOMAINNAME 397
+#define IFNAME 398
+#define URL 399
+#define LDAPATTRIBUTE 400
+#define LDAPATTRIBUTE_AD 401
+#define LDAPATTRIBUTE_HEX 402
+#define LDAPATTRIBUTE_AD_HEX 403
+#define LDAPBASEDN 404
+#define LDAP_BASEDN 405
+#define LDAPBASEDN_HEX 406
+#define LDAPBASEDN_HEX_ALL 407
+#define LDAPCERTFILE 408
+#define LDAPCERTPATH 409
+#define LDAPPORT 410
+#define LDAPPORTSSL 411
+#define LDAPDEBUG 412
+#define LDAPDEPTH 413
+#define LDAPAUTO 414
+#define LDAPSEARCHTIME 415
+#define LDAPDOMAIN 416
+#define LDAP_DOMAIN 417
+#define LDAPFILTER 418
+#define LDAPFILTER_AD 419
+#define LDAPFILTER_HEX 420
+#define LDAPFILTER_AD_HEX 421
+#define LDAPGROUP 422
+#define LDAPGROUP_NAME 423
+#define LDAPGROUP_HEX 424
+#define LDAPGROUP_HEX_ALL 425
+#define LDAPKEYTAB 426
+#define LDAPKEYTABNAME 427
+#define LDAPDEADTIME 428
+#define LDAPSERVER 429
+#define LDAPSERVER_NAME 430
+#define LDAPSSL 431
+#define LDAPCERTCHECK 432
+#define LDAPKEEPREALM 433
+#define LDAPTIMEOUT 434
+#define LDAPCACHE 435
+#define LDAPCACHEPOS 436
+#define LDAPCACHENEG 437
+#define LDAPURL 438
+#define LDAP_URL 439
+#define LDAP_FILTER 440
+#define LDAP_ATTRIBUTE 441
+#define LDAP_CERTFILE 442
+#define LDAP_CERTPATH 443
+#define LIBWRAPSTART 444
+#define LIBWRAP_ALLOW 445
+#define LIBWRAP_DENY 446
+#define LIBWRAP_HOSTS_ACCESS 447
+#define LINE 448
+#define OPERATOR 449
+#define PAMSERVICENAME 450
+#define PROTOCOL 451
+#define PROTOCOL_TCP 452
+#define PROTOCOL_UDP 453
+#define PROTOCOL_FAKE 454
+#define PROXYPROTOCOL 455
+#define PROXYPROTOCOL_SOCKS_V4 456
+#define PROXYPROTOCOL_SOCKS_V5 457
+#define PROXYPROTOCOL_HTTP 458
+#define PROXYPROTOCOL_UPNP 459
+#define REDIRECT 460
+#define SENDSIDE 461
+#define RECVSIDE 462
+#define SERVICENAME 463
+#define SESSION_INHERITABLE 464
+#define SESSIONMAX 465
+#define SESSIONTHROTTLE 466
+#define SESSIONSTATE_KEY 467
+#define SESSIONSTATE_MAX 468
+#define SESSIONSTATE_THROTTLE 469
+#define RULE_LOG 470
+#define RULE_LOG_CONNECT 471
+#define RULE_LOG_DATA 472
+#define RULE_LOG_DISCONNECT 473
+#define RULE_LOG_ERROR 474
+#define RULE_LOG_IOOPERATION 475
+#define RULE_LOG_TCPINFO 476
+#define STATEKEY 477
+#define UDPPORTRANGE 478
+#define UDPCONNECTDST 479
+#define USER 480
+#define GROUP 481
+#define VERDICT_BLOCK 482
+#define VERDICT_PASS 483
+#define YES 484
+#define NO 485
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 396 "config_parse.y"
+
    struct {
       uid_t   uid;
       gid_t   gid;
@@ -236,6 +543,20 @@ typedef union {
    char       *string;
    int        method;
    long long  number;
-} YYSTYPE;
-#endif /* YYSTYPE_DEFINED */
+
+#line 548 "config_parse.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
 extern YYSTYPE socks_yylval;
+
+
+int socks_yyparse (void);
+
+
+#endif /* !YY_SOCKS_YY_CONFIG_PARSE_H_INCLUDED  */
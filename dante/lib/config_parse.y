@@ -448,6 +448,8 @@ do {                                                                           \
 %type   <string> socksmethod socksmethods socksmethodname
 %type   <string> bandwidth
 %type   <string> childstate
+%type   <string> hostcache
+%type   <string> happyeyeballs
 %type   <string> clientcompatibility clientcompatibilityname
                  clientcompatibilitynames
 %type   <string> compatibility compatibilityname compatibilitynames
@@ -491,7 +493,7 @@ do {                                                                           \
 %token   <string> CLIENTRULE HOSTIDRULE SOCKSRULE
 %token   <string> COMPATIBILITY SAMEPORT DRAFT_5_05
 %token   <string> CONNECTTIMEOUT TCP_FIN_WAIT
-%token   <string> CPU MASK SCHEDULE CPUMASK_ANYCPU
+%token   <string> CPU MASK SCHEDULE CPUMASK_ANYCPU CPUMASK_PERCPU
 %token   <string> DEBUGGING
 %token   <deprecated> DEPRECATED
 %token   <string> ERRORLOG LOGOUTPUT LOGFILE LOGTYPE_ERROR
@@ -516,6 +518,12 @@ do {                                                                           \
 %token   <string> MONITOR
 %token   <number> PROCESSTYPE
 %token   <string> PROC_MAXREQUESTS
+%token   <string> PROC_MAXCLIENTS_NEGOTIATE PROC_MAXCLIENTS_IO
+%token   <string> PROC_MAXCLIENTS_REQUEST
+%token   <string> PROC_REUSEPORT
+%token   <string> PROC_ALLINONE
+%token   <string> HOSTCACHE_ENTRIES HOSTCACHE_TTL_MIN HOSTCACHE_TTL_MAX
+%token   <string> HAPPYEYEBALLS_DELAY
 %token   <string> REALM REALNAME RESOLVEPROTOCOL
 %token   <string> REQUIRED
 %token   <number> SCHEDULEPOLICY
@@ -530,9 +538,11 @@ do {                                                                           \
    /* route */
 %type   <string> global_routeoption
 %type   <string> via gateway route routes routeoption routeoptions routemethod
+%type   <string> routeweight
 
 %token   <string> ROUTE VIA
 %token   <string> GLOBALROUTEOPTION BADROUTE_EXPIRE MAXFAIL
+%token   <string> ROUTE_WEIGHT
 
    /* rulelines */
 %type   <number> port gwport portrange portstart portnumber portservice
@@ -650,6 +660,8 @@ serveroption:  childstate
    |           global_clientmethod
    |           global_socksmethod
    |           global_routeoption
+   |           happyeyeballs
+   |           hostcache
    |           internal
    |           internal_protocol
    |           internal_if_logoption
@@ -1166,6 +1178,73 @@ logoutputdevices:   logoutputdevice
 childstate: PROC_MAXREQUESTS ':' NUMBER {
 #if !SOCKS_CLIENT
       ASSIGN_NUMBER($3, >=, 0, sockscf.child.maxrequests, 0);
+#endif /* !SOCKS_CLIENT */
+   }
+   | PROC_MAXCLIENTS_NEGOTIATE ':' NUMBER {
+#if !SOCKS_CLIENT
+      ASSIGN_NUMBER($3, >=, 1, sockscf.child.maxclients.negotiate, 0);
+#endif /* !SOCKS_CLIENT */
+   }
+   | PROC_MAXCLIENTS_IO ':' NUMBER {
+#if !SOCKS_CLIENT
+      ASSIGN_NUMBER($3, >=, 1, sockscf.child.maxclients.io, 0);
+#endif /* !SOCKS_CLIENT */
+   }
+   | PROC_MAXCLIENTS_REQUEST ':' NUMBER {
+#if !SOCKS_CLIENT
+      ASSIGN_NUMBER($3, >=, 1, sockscf.child.maxclients.request, 0);
+#endif /* !SOCKS_CLIENT */
+   }
+   | PROC_REUSEPORT ':' YES {
+#if !SOCKS_CLIENT
+#ifdef SO_REUSEPORT
+      sockscf.child.reuseport = 1;
+#else /* !SO_REUSEPORT */
+      yyerrorx("SO_REUSEPORT is not supported on this system");
+#endif /* !SO_REUSEPORT */
+#endif /* !SOCKS_CLIENT */
+   }
+   | PROC_REUSEPORT ':' NO {
+#if !SOCKS_CLIENT
+      sockscf.child.reuseport = 0;
+#endif /* !SOCKS_CLIENT */
+   }
+   | PROC_ALLINONE ':' YES {
+#if !SOCKS_CLIENT
+#if SOCKD_ALLINONE && defined(SO_REUSEPORT)
+      sockscf.child.allinone = 1;
+#else /* !SOCKD_ALLINONE || !SO_REUSEPORT */
+      yyerrorx("child.allinone is not supported by this server");
+#endif /* !SOCKD_ALLINONE || !SO_REUSEPORT */
+#endif /* !SOCKS_CLIENT */
+   }
+   | PROC_ALLINONE ':' NO {
+#if !SOCKS_CLIENT
+      sockscf.child.allinone = 0;
+#endif /* !SOCKS_CLIENT */
+   }
+   ;
+
+hostcache: HOSTCACHE_ENTRIES ':' NUMBER {
+#if !SOCKS_CLIENT
+      ASSIGN_NUMBER($3, >=, 0, sockscf.hostcache.entries, 0);
+#endif /* !SOCKS_CLIENT */
+   }
+   | HOSTCACHE_TTL_MIN ':' NUMBER {
+#if !SOCKS_CLIENT
+      ASSIGN_NUMBER($3, >=, 1, sockscf.hostcache.ttl.min, 1);
+#endif /* !SOCKS_CLIENT */
+   }
+   | HOSTCACHE_TTL_MAX ':' NUMBER {
+#if !SOCKS_CLIENT
+      ASSIGN_NUMBER($3, >=, 1, sockscf.hostcache.ttl.max, 1);
+#endif /* !SOCKS_CLIENT */
+   }
+   ;
+
+happyeyeballs: HAPPYEYEBALLS_DELAY ':' NUMBER {
+#if !SOCKS_CLIENT
+      ASSIGN_NUMBER($3, >=, 0, sockscf.happyeyeballs.delay, 1);
 #endif /* !SOCKS_CLIENT */
    }
    ;
@@ -1438,6 +1517,7 @@ cpuaffinity: CPU '.' MASK '.' PROCESSTYPE ':' numbers {
       yyerrorx("cpu scheduling affinity is not supported on this system");
 #else /* HAVE_SCHED_SETAFFINITY */
       cpusetting_t *cpusetting;
+      int havecpu = 0;
 
       switch ($5) {
          case PROC_MOTHER:
@@ -1465,8 +1545,17 @@ cpuaffinity: CPU '.' MASK '.' PROCESSTYPE ':' numbers {
       }
 
       cpu_zero(&cpusetting->mask);
+      cpusetting->percpu = 0;
+
       while (numberc-- > 0)
-         if (numberv[numberc] == CPUMASK_ANYCPU) {
+         if (numberv[numberc] == CPUMASK_PERCPU) {
+            if ($5 != PROC_IO)
+               yyerrorx("\"percpu\" can only be set for the %s processes",
+                        childtype2string(PROC_IO));
+
+            cpusetting->percpu = 1;
+         }
+         else if (numberv[numberc] == CPUMASK_ANYCPU) {
             const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
             long i;
 
@@ -1475,17 +1564,33 @@ cpuaffinity: CPU '.' MASK '.' PROCESSTYPE ':' numbers {
 
             for (i = 0; i < cpus; ++i)
                cpu_set((int)i, &cpusetting->mask);
+
+            havecpu = 1;
          }
          else if (numberv[numberc] < 0)
             yyerrorx("invalid CPU number: %ld.  The CPU number can not be "
                      "negative", (long)numberv[numberc]);
-         else
+         else {
             cpu_set(numberv[numberc], &cpusetting->mask);
+            havecpu = 1;
+         }
 
       free(numberv);
       numberv = NULL;
       numberc = 0;
 
+      if (cpusetting->percpu && !havecpu) {
+         /* no cpus given besides "percpu"; spread over all cpus. */
+         const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+         long i;
+
+         if (cpus == -1)
+            yyerror("sysconf(_SC_NPROCESSORS_ONLN) failed");
+
+         for (i = 0; i < cpus; ++i)
+            cpu_set((int)i, &cpusetting->mask);
+      }
+
       cpusetting->affinity_isset = 1;
 
 #endif /* HAVE_SCHED_SETAFFINITY */
@@ -1964,7 +2069,6 @@ sruleoption: bsdauthstylename
 
 genericruleoption:  bandwidth {
 #if !SOCKS_CLIENT
-                        checkmodule("bandwidth");
                         bw_isset = 1;
 #endif /* !SOCKS_CLIENT */
    }
@@ -2803,6 +2907,7 @@ routeoption: routemethod
    |         gssapienctype
    |         proxyprotocol
    |         REDIRECT rdr_fromaddress
+   |         routeweight
    |         socketoption {
                if (!addedsocketoption(&route.socketoptionc,
                                       &route.socketoptionv,
@@ -2818,6 +2923,15 @@ routeoptions:  { $$ = NULL; }
 routemethod: METHOD ':' socksmethods
    ;
 
+routeweight: ROUTE_WEIGHT ':' NUMBER {
+      if ($3 < 1)
+         yyerrorx("route weight must be a positive number (%ld)", (long)$3);
+
+      route.weight       = $3;
+      route.weight_isset = 1;
+   }
+   ;
+
 from:   FROM {
       addrinit(&src, 1);
    }
@@ -408,8 +408,8 @@ static void yy_fatal_error (yyconst char msg[]  );
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 225
-#define YY_END_OF_BUFFER 226
+#define YY_NUM_RULES 236
+#define YY_END_OF_BUFFER 237
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -417,237 +417,249 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_acclist[2056] =
+static yyconst flex_int16_t yy_acclist[2171] =
     {   0,
-       71,   71,  226,  224,  225,  219,  224,  225,  221,  225,
-      224,  225,  220,  224,  225,  224,  225,  218,  224,  225,
-      218,  224,  225,   93,  224,  225,   93,  224,  225,   93,
-      224,  225,  224,  225,  224,  225,  224,  225,  224,  225,
-      224,  225,  224,  225,  224,  225,  224,  225,  224,  225,
-      224,  225,  224,  225,  224,  225,  224,  225,  224,  225,
-      224,  225,  224,  225,  224,  225,  224,  225,  224,  225,
-      224,  225,  223,  224,  225,  219,  224,  225,  224,  225,
-      224,  225,  224,  225,  224,  225,  224,  225,  224,  225,
-      224,  225,  224,  225,  220,  224,  225,   20,  224,  225,
-
-      218,  224,  225,  218,  224,  225,  224,  225,   93,  224,
-      225,   93,  224,  225,   93,  224,  225,  224,  225,  224,
-      225,  224,  225,  224,  225,  224,  225,  224,  225,  224,
-      225,  224,  225,  224,  225,  224,  225,  224,  225,  224,
-      225,  224,  225,  224,  225,  224,  225,  224,  225,  224,
-      225,  224,  225,  224,  225,  224,  225,  223,  224,  225,
-      224,  225,  224,  225,  224,  225,  224,  225,  224,  225,
-      224,  225,  224,  225,  224,  225,  224,  225,  224,  225,
-       70,  224,  225,  224,  225,  224,  225,  224,  225,   71,
-      224,  225,   71,  219,  224,  225,   71,  220,  224,  225,
-
-       71,  218,  224,  225,   71,  218,  224,  225,   71,  224,
-      225,   71,  223,  224,  225,  224,  225,  224,  225,  224,
-      225,  224,  225,  224,  225,  224,  225,   52,  224,  225,
-       52,  220,  224,  225,   52,  218,  224,  225,   52,  218,
-      224,  225,   52,  224,  225,   52,  223,  224,  225,  224,
-      225,  224,  225,  224,  225,  224,  225,  224,  225,  224,
-      225,  224,  225,  224,  225,  224,  225,  224,  225,  224,
-      225,  224,  225,   53,  224,  225,   53,  220,  224,  225,
-       53,  218,  224,  225,   53,  218,  224,  225,   53,  224,
-      225,   53,  223,  224,  225,   54,  224,  225,   54,  220,
-
-      224,  225,   54,  218,  224,  225,   54,  218,  224,  225,
-       54,  224,  225,   54,  223,  224,  225,   55,  224,  225,
-       55,  220,  224,  225,   55,  218,  224,  225,   55,  218,
-      224,  225,   55,  224,  225,   55,  223,  224,  225,  224,
-      225,  224,  225,  224,  225,  224,  225,  224,  225,  224,
-      225,  224,  225,  224,  225,  224,  225,  224,  225,  220,
-      224,  225,  218,  224,  225,  218,  224,  225,  224,  225,
-      223,  224,  225,  224,  225,  220,  224,  225,  218,  224,
-      225,  218,  224,  225,  224,  225,  223,  224,  225,  224,
-      225,  224,  225,  220,  224,  225,  218,  224,  225,  218,
-
-      224,  225,  224,  225,  223,  224,  225,  224,  225,  220,
-      224,  225,  218,  224,  225,  218,  224,  225,  224,  225,
-      223,  224,  225,  224,  225,  220,  224,  225,  218,  224,
-      225,  218,  224,  225,  224,  225,  223,  224,  225,  224,
-      225,  220,  224,  225,  218,  224,  225,  218,  224,  225,
-      224,  225,  223,  224,  225,   65,  224,  225,   65,  220,
-      224,  225,   65,  218,  224,  225,   65,  218,  224,  225,
-       65,  224,  225,   65,  224,  225,   65,  223,  224,  225,
-       63,  224,  225,   63,  220,  224,  225,   63,  218,  224,
-      225,   63,  218,  224,  225,   63,  224,  225,   63,  223,
-
-      224,  225,   64,  224,  225,   64,  220,  224,  225,   64,
-      218,  224,  225,   64,  218,  224,  225,   64,  224,  225,
-       64,  223,  224,  225,  224,  225,  224,  225,  224,  225,
-      224,  225,  224,  225,  224,  225,  224,  225,    9,  224,
-      225,   51,  224,  225,   69,  224,  225,   69,  220,  224,
-      225,   69,  218,  224,  225,   69,  218,  224,  225,   69,
-      224,  225,   69,  223,  224,  225,   67,  224,  225,   67,
-      220,  224,  225,   67,  218,  224,  225,   67,  218,  224,
-      225,   67,  224,  225,   67,  224,  225,   67,  223,  224,
-      225,  224,  225,  224,  225,  224,  225,  224,  225,   83,
-
-      224,  225,   83,  220,  224,  225,   83,  218,  224,  225,
-       83,  218,  224,  225,   83,  224,  225,   83,  223,  224,
-      225,  224,  225,  224,  225,  224,  225,  224,  225,  224,
-      225,  224,  225,  220,  224,  225,  224,  225,  223,  224,
-      225,  224,  225,  224,  225,  224,  225,  224,  225,   33,
-      224,  225,   33,  221,  225,   33,  220,  224,  225,   33,
-      224,  225,   33,  223,  224,  225,  224,  225,  219,   93,
-      220,  218,  218,  222,  126,   93,  131,  128,  219,   22,
-       22,   93,   22,  220,   22,   22,   21,   22,  218,   22,
-      218,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       72,   72,  237,  235,  236,  230,  235,  236,  232,  236,
+      235,  236,  231,  235,  236,  235,  236,  229,  235,  236,
+      229,  235,  236,   94,  235,  236,   94,  235,  236,   94,
+      235,  236,  235,  236,  235,  236,  235,  236,  235,  236,
+      235,  236,  235,  236,  235,  236,  235,  236,  235,  236,
+      235,  236,  235,  236,  235,  236,  235,  236,  235,  236,
+      235,  236,  235,  236,  235,  236,  235,  236,  235,  236,
+      235,  236,  235,  236,  234,  235,  236,  230,  235,  236,
+      235,  236,  235,  236,  235,  236,  235,  236,  235,  236,
+      235,  236,  235,  236,  235,  236,  231,  235,  236,   20,
+
+      235,  236,  229,  235,  236,  229,  235,  236,  235,  236,
+       94,  235,  236,   94,  235,  236,   94,  235,  236,  235,
+      236,  235,  236,  235,  236,  235,  236,  235,  236,  235,
+      236,  235,  236,  235,  236,  235,  236,  235,  236,  235,
+      236,  235,  236,  235,  236,  235,  236,  235,  236,  235,
+      236,  235,  236,  235,  236,  235,  236,  235,  236,  235,
+      236,  234,  235,  236,  235,  236,  235,  236,  235,  236,
+      235,  236,  235,  236,  235,  236,  235,  236,  235,  236,
+      235,  236,  235,  236,   71,  235,  236,  235,  236,  235,
+      236,  235,  236,   72,  235,  236,   72,  230,  235,  236,
+
+       72,  231,  235,  236,   72,  229,  235,  236,   72,  229,
+      235,  236,   72,  235,  236,   72,  234,  235,  236,  235,
+      236,  235,  236,  235,  236,  235,  236,  235,  236,  235,
+      236,   53,  235,  236,   53,  231,  235,  236,   53,  229,
+      235,  236,   53,  229,  235,  236,   53,  235,  236,   53,
+      234,  235,  236,  235,  236,  235,  236,  235,  236,  235,
+      236,  235,  236,  235,  236,  235,  236,  235,  236,  235,
+      236,  235,  236,  235,  236,  235,  236,   54,  235,  236,
+       54,  231,  235,  236,   54,  229,  235,  236,   54,  229,
+      235,  236,   54,  235,  236,   54,  234,  235,  236,   55,
+
+      235,  236,   55,  231,  235,  236,   55,  229,  235,  236,
+       55,  229,  235,  236,   55,  235,  236,   55,  234,  235,
+      236,   56,  235,  236,   56,  231,  235,  236,   56,  229,
+      235,  236,   56,  229,  235,  236,   56,  235,  236,   56,
+      234,  235,  236,  235,  236,  235,  236,  235,  236,  235,
+      236,  235,  236,  235,  236,  235,  236,  235,  236,  235,
+      236,  235,  236,  231,  235,  236,  229,  235,  236,  229,
+      235,  236,  235,  236,  234,  235,  236,  235,  236,  231,
+      235,  236,  229,  235,  236,  229,  235,  236,  235,  236,
+      234,  235,  236,  235,  236,  235,  236,  231,  235,  236,
+
+      229,  235,  236,  229,  235,  236,  235,  236,  234,  235,
+      236,  235,  236,  231,  235,  236,  229,  235,  236,  229,
+      235,  236,  235,  236,  234,  235,  236,  235,  236,  231,
+      235,  236,  229,  235,  236,  229,  235,  236,  235,  236,
+      234,  235,  236,  235,  236,  231,  235,  236,  229,  235,
+      236,  229,  235,  236,  235,  236,  234,  235,  236,   66,
+      235,  236,   66,  231,  235,  236,   66,  229,  235,  236,
+       66,  229,  235,  236,   66,  235,  236,   66,  235,  236,
+       66,  234,  235,  236,   64,  235,  236,   64,  231,  235,
+      236,   64,  229,  235,  236,   64,  229,  235,  236,   64,
+
+      235,  236,   64,  234,  235,  236,   65,  235,  236,   65,
+      231,  235,  236,   65,  229,  235,  236,   65,  229,  235,
+      236,   65,  235,  236,   65,  234,  235,  236,  235,  236,
+      235,  236,  235,  236,  235,  236,  235,  236,  235,  236,
+      235,  236,    9,  235,  236,   52,  235,  236,   70,  235,
+      236,   70,  231,  235,  236,   70,  229,  235,  236,   70,
+      229,  235,  236,   70,  235,  236,   70,  234,  235,  236,
+       68,  235,  236,   68,  231,  235,  236,   68,  229,  235,
+      236,   68,  229,  235,  236,   68,  235,  236,   68,  235,
+      236,   68,  234,  235,  236,  235,  236,  235,  236,  235,
+
+      236,  235,  236,   84,  235,  236,   84,  231,  235,  236,
+       84,  229,  235,  236,   84,  229,  235,  236,   84,  235,
+      236,   84,  234,  235,  236,  235,  236,  235,  236,  235,
+      236,  235,  236,  235,  236,  235,  236,  231,  235,  236,
+      235,  236,  234,  235,  236,  235,  236,  235,  236,  235,
+      236,  235,  236,   34,  235,  236,   34,  232,  236,   34,
+      231,  235,  236,   34,  235,  236,   34,  234,  235,  236,
+      235,  236,  235,  236,  230,   94,  231,  229,  229,  233,
+      128,   94,  133,  130,  230,   22,   22,   94,   22,  231,
+       22,   22,   21,   22,  229,   22,  229,   22,   22,   22,
 
        22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
-       22,   22,   22,  126,   22,   22,   22,   22,   22,   22,
-       22,   22,   93,   22,  131,   22,   22,   22,   22,   22,
-       22,   22,   22,   22,   22,  128,   22,   22,   22,   22,
-       22,   22,   22,   22,   22,   22,   71,   71,  219,   71,
-      220,   71,  218,   71,  218,   71,   46,   52,   52,  220,
-       52,  218,   52,  218,   52,   50,   53,   53,  220,   53,
-      218,   53,  218,   53,   54,   54,  220,   54,  218,   54,
-      218,   54,   55,   55,  220,   55,  218,   55,  218,   55,
-       56,   56,   56,  220,   56,  220,   56,  218,   56,  218,
-
-       56,   57,   57,   57,  220,   57,  220,   57,  218,   57,
-      218,   57,   58,   58,   58,  220,   58,  220,   58,  218,
-       58,  218,   58,   60,   60,   60,  220,   60,  220,   60,
-      218,   60,  218,   60,   62,   62,   62,  220,   62,  220,
-       62,  218,   62,  218,   62,   61,   61,   61,  220,   61,
-      220,   61,  218,   61,  218,   61,   65,   65,  220,   65,
-      218,   65,  218,   65,   65,   63,   63,  220,   63,  218,
-       63,  218,   63,   64,   64,  220,   64,  218,   64,  218,
-       64,    9,    9,   51,   51,   69,   69,  220,   69,  218,
-       69,  218,   69,   67,   67,  220,   67,  218,   67,  218,
-
-       67,   67,   83,   83,  220,   83,  218,   83,  218,   83,
-       34,   38,   39,   39,  220,   31,   33,   33,  220,   33,
-      222,   24,  129,  130,   22,   22,   22,   22,   22,   22,
-       22,   22,   22,   22,   22,   22,   22,   22,   24,   22,
        22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+      128,   22,   22,   22,   22,   22,   22,   22,   22,   94,
+       22,  133,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,  130,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   72,   72,  230,   72,  231,   72,
+      229,   72,  229,   72,   47,   53,   53,  231,   53,  229,
+       53,  229,   53,   51,   54,   54,  231,   54,  229,   54,
+      229,   54,   55,   55,  231,   55,  229,   55,  229,   55,
+       56,   56,  231,   56,  229,   56,  229,   56,   57,   57,
+
+       57,  231,   57,  231,   57,  229,   57,  229,   57,   58,
+       58,   58,  231,   58,  231,   58,  229,   58,  229,   58,
+       59,   59,   59,  231,   59,  231,   59,  229,   59,  229,
+       59,   61,   61,   61,  231,   61,  231,   61,  229,   61,
+      229,   61,   63,   63,   63,  231,   63,  231,   63,  229,
+       63,  229,   63,   62,   62,   62,  231,   62,  231,   62,
+      229,   62,  229,   62,   66,   66,  231,   66,  229,   66,
+      229,   66,   66,   64,   64,  231,   64,  229,   64,  229,
+       64,   65,   65,  231,   65,  229,   65,  229,   65,    9,
+        9,   52,   52,   70,   70,  231,   70,  229,   70,  229,
+
+       70,   68,   68,  231,   68,  229,   68,  229,   68,   68,
+       84,   84,  231,   84,  229,   84,  229,   84,   35,   39,
+       40,   40,  231,   31,   34,   34,  231,   34,  233,   24,
+      131,  132,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   24,   22,   22,   22,
        22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
        22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
-       22,   22,   22,   22,   22,  129,   22,  130,   22,   22,
-       22,   22,   22,   22,   91,  168,    3,   65,   75,   76,
-       67,   78,   36,   37,   32,  164,  127,  174,  143,  173,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,  131,   22,   22,  132,   22,   22,
+       22,   22,   22,   22,   92,  179,    3,   66,   76,   77,
 
-      147,   97,  173,   22,   22,   22,   22,   22,   22,  164,
+       68,   79,   37,   38,   32,  175,  129,  185,  145,  184,
+      158,   98,  184,   22,   22,   22,   22,   22,   22,  175,
        22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
-       22,   22,   22,  127,   22,   22,   22,   22,   22,   22,
-       22,   22,   22,   22,  174,   22,   22,   22,   22,   22,
-       22,  143,   22,   22,   22,  173,   22,   22,   22,   22,
-       22,   22,   22,   22,   22,   22,   22,   22,   22,  147,
-       22,   22,   22,   22,   97,  173,   22,   22,   23,   14,
-       41,   44,   84,   12,   13,   26,    8,    4,   65,   77,
-        1,    2,   67,  172,  103,  148,  213,  105,   97,   97,
-      172,  104,  105,16480,   22,   22,   22,   22,   22,   22,
-
-      172,   22,   22,   22,   22,   22,   22,   22,   22,  103,
-       22,   22,   22,   22,   22,  148,   22,   22,   22,   22,
+       22,   22,   22,  129,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,  185,   22,   22,   22,   22,
+       22,   22,  145,   22,   22,   22,  184,   22,   22,   22,
        22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
-       22,   22,   22,  213,   22,   22,   22,  105,   22,   22,
-       22,   22,   22,   22,   22,   22,   22,   22,   22,   97,
-      172,   22,   22,   22,  104,  105,   22,16480,   43,   47,
-       79,  101,  102,  100,  212,  165,  171,  106,  104,16480,
-    16478,  165,16479,   22,   22,  101,   22,   22,  102,   22,
-       22,  100,   22,   22,   22,  212,   22,   22,   22,   22,
-       22,   22,   22,   22,   22,   22,   19,   22,   22,  165,
+      158,   22,   22,   22,   22,   22,   98,  184,   22,   22,
+       23,   14,   42,   45,   85,   12,   13,   26,    8,    4,
+       66,   78,    1,    2,   68,  183,  104,  159,  224,  106,
 
+       98,   98,  183,  105,  106,16481,   22,   22,   22,   22,
+       22,   22,  183,   22,   22,   22,   22,   22,   22,   22,
+       22,  104,   22,   22,   22,   22,   22,  159,   22,   22,
        22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
-       22,   22,   22,   22,   22,   22,   22,   22,  171,   22,
-       22,   22,   22,   22,   22,   22,   22,   22,  106,   22,
+       22,   22,   22,   22,   22,   22,   22,  224,   22,   22,
+       22,  106,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   98,  183,   22,   22,   22,  105,
+      106,   22,16481,   44,   48,   80,  102,  103,  101,  223,
+      176,  182,  107,  110,  105,16481,16479,  176,16480,   22,
+       22,  102,   22,   22,  103,   22,   22,  101,   22,   22,
+
+       22,  223,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   19,   22,   22,   22,   22,  176,   22,   22,
        22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
-       22,   22,   22,16478,   22,  165,16479,   85,   87,    8,
-        6,   66,   68,   35,   27,  115,  175,  107,  166,  110,
-    16478,16479,   22,   22,   22,   22,   22,   22,   22,   22,
-      115,   22,   22,   22,   22,   22,   22,   19,   22,   22,
+       22,   22,   22,   22,   22,   22,  182,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,  107,   22,   22,   22,
        22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
-       22,   22,   22,   22,   22,   22,  175,   22,   22,   22,
+       22,  110,   22,16479,   22,  176,16480,   86,   88,    8,
+        6,   67,   69,   36,   27,   33,  117,  186,  108,  177,
+      112,16479,16480,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,  117,   22,   22,   22,   22,   22,   22,
 
-      107,   22,  166,   22,   22,   22,   22,   22,   22,   22,
-       22,   22,   22,   22,   22,   22,  110,   22,   22,   22,
-       22,   22,   22,   22,   15,   40,   45,   92,   88,    8,
-       59,   28,   30,  112,  195,  189,  114,  118,  159,   22,
+       19,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,  186,   22,   22,   22,  108,   22,  177,   22,   22,
        22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
-       22,  112,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,  112,   22,   22,   22,   22,   22,   22,   22,   15,
+       41,   46,   93,   89,    8,   60,   28,   30,  114,  206,
+      200,  116,  120,  170,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,  114,   22,
        22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
-       22,   22,   22,  195,   22,  189,   22,   22,   22,   22,
-       22,   22,   22,  114,   22,   22,  118,   22,   22,   22,
-      159,   22,   22,   22,   22,   22,   22,   22,   22,   22,
-
-       22,   22,   18,   86,   10,   11,   25,   59,  108,  119,
-      163,  142,  167,  136,  216,  187,  113,  162,  144,   22,
-       22,   22,  108,   22,  119,   22,   22,   22,   22,   22,
-       22,   22,   22,  163,   22,   22,   22,  142,   22,   22,
-       22,   22,   22,   22,  136,   22,  216,   22,   22,   22,
-       22,   22,   22,   22,   22,   22,   22,   22,   22,  187,
-       22,   22,   22,   22,   22,   22,  113,   22,  162,   22,
-       22,   22,   22,   22,  144,   22,   22,   22,   22,   22,
        22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
-       22,   22,   17,   12,    7,   80,   29,   98,  160,  193,
 
-      208,  154, 8288,   22,   98,   22,   22,   22,   22,   22,
-       22,   22,   22,   22,  160,   22,   22,   22,   22,   22,
+       22,   22,  206,   22,  200,   22,   22,   22,   22,   22,
+       22,   22,  116,   22,   22,  120,   22,   22,   22,  170,
        22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   18,   87,   10,   11,   25,   60,  109,  121,  174,
+      144,  178,  138,  227,  198,  115,  173,  146,   22,   22,
+       22,  109,   22,  121,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,  174,   22,   22,   22,  144,   22,
+       22,   22,   22,   22,   22,   22,   22,  138,   22,  227,
        22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
-      193,   22,   22,   22,  208,   22,   22,   22,   22,   22,
+       22,   22,  198,   22,   22,   22,   22,   22,   22,  115,
+
+       22,  173,   22,   22,   22,   22,   22,  146,   22,   22,
        22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
-       22,   22,   22,   22,   22,   22,   22,  154,   22,   22,
-       22,   22,   22,   22,   22,   22,   42,    5,   82,  184,
-      192,  199,  211,  194,  207,  120,  169, 8286, 8287,   22,
+       22,   22,   22,   22,   22,   17,   12,    7,   81,   29,
+       99,  171,  204,  219,  165, 8289,   22,   99,   22,   22,
        22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
-
+      171,   22,   22,   22,   22,   22,   22,   22,   22,   22,
        22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
-       22,   22,   22,   22,   22,   22,   22,   22,  184,   22,
-       22,   22,   22,  192,   22,  199,   22,   22,   22,  211,
-       22,  194,   22,   22,  207,   22,   22,   22,   22,   22,
-       22,   22,   22,   22,   22,  120,   22,   22,   22,   22,
-       22,  169,   22,   22,   22,   22,   22,   22,   22,   22,
-       22,   22,   44,   49,   89,  170,  137,  132,  177,  214,
-      151,   22,   22,   22,   22,   22,   22,  170,   22,   22,
-       22,   22,  137,   22,   22,   22,   22,   22,   22,   22,
-       22,   22,  132,   22,   22,   22,   22,   22,   22,   22,
-
-       22,   22,   22,   22,   22,   22,   22,   22,  177,   22,
-       22,   22,  214,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,  204,   22,
+       22,   22,  219,   22,   22,   22,   22,   22,   22,   22,
        22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
-      151,   22,   22,   22,   16,   48,   90,   73,  158,  141,
-      182,  134,  196,  190,  191,  188,  176,  214,  214,  111,
-      116,   22,   22,   22,   22,   22,   22,  158,   22,   22,
-       22,  141,   22,   22,   22,   22,   22,  182,   22,   22,
-       22,  134,   22,   22,   22,   22,  196,   22,   22,   22,
-      190,   22,  191,   22,   22,   22,   22,   22,  188,   22,
-      176,   22,   22,  214,   22,  214,   22,   22,   22,  111,
 
+       22,   22,   22,   22,   22,  165,   22,   22,   22,   22,
+       22,   22,   22,   22,   43,    5,   83,  195,  203,  210,
+      222,  205,  218,  122,  180, 8287, 8288,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,  195,   22,   22,   22,   22,  203,   22,  210,
+       22,   22,   22,  222,   22,  205,   22,   22,  218,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,  122,
+       22,   22,   22,   22,   22,  180,   22,   22,   22,   22,
+
+       22,   22,   22,   22,   22,   22,   45,   50,   90,  181,
+      139,  134,  188,  225,  162,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,  181,   22,   22,   22,   22,  139,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,  134,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,  188,   22,
+       22,   22,  225,   22,   22,   22,   22,   22,   22,   22,
        22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
-       22,   22,   22,  116,   22,   22,   22,   72,  145,  215,
-      183,  203,  197,  200,  209,  198,  179,  155,  156,  117,
-       22,   22,   22,   22,  145,   22,   22,   22,  215,   22,
-       22,   22,   22,   22,  183,   22,   22,   22,   22,   22,
-      203,   22,   22,  197,   22,  200,   22,   22,  209,   22,
-      198,   22,   22,   22,  179,   22,   22,   22,   22,   22,
-       22,   22,  155,   22,  156,   22,   22,   22,  117,   22,
-       22,   22,   74,  145,  145,  138,  133,  185,  201,  109,
-      152,  149,   22,   22,   22,  145,   22,  145,   22,   22,
-
-       22,  138,   22,   22,   22,   22,  133,   22,   22,   22,
-      185,   22,   22,  201,   22,   22,   22,  109,   22,   22,
-       22,   22,   22,   22,   22,  152,   22,   22,   22,   22,
-      149,   22,   81,   99,  122,   22,   99,   22,   22,   22,
+      162,   22,   22,   22,   16,   49,   91,   74,  169,  143,
+      193,  136,  207,  201,  202,  199,  187,  225,  225,  113,
+
+      118,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+      169,   22,   22,   22,  143,   22,   22,   22,   22,   22,
+      193,   22,   22,   22,   22,   22,   22,  136,   22,   22,
+       22,   22,  207,   22,   22,   22,  201,   22,  202,   22,
+       22,   22,   22,   22,  199,   22,  187,   22,   22,  225,
+       22,  225,   22,   22,   22,  113,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,  118,
+       22,   22,   22,   73,  153,  147,  226,  194,  214,  208,
+      211,  220,  209,  190,  166,  167,  119,   22,   22,   22,
+      153,   22,   22,   22,  147,   22,   22,   22,   22,  226,
+
+       22,   22,   22,   22,   22,  194,   22,   22,   22,   22,
+       22,   22,   22,   22,  214,   22,   22,  208,   22,  211,
+       22,   22,  220,   22,  209,   22,   22,   22,  190,   22,
+       22,   22,   22,   22,   22,   22,  166,   22,  167,   22,
+       22,   22,  119,   22,   22,   22,   75,  147,  147,  152,
+      140,  135,  196,  212,  111,  163,  160,   22,   22,   22,
+       22,  147,   22,  147,   22,   22,  152,   22,   22,  140,
+       22,   22,   22,   22,   22,   22,   22,  135,   22,   22,
+       22,  196,   22,   22,  212,   22,   22,   22,  111,   22,
+       22,   22,   22,   22,   22,   22,  163,   22,   22,   22,
+
+       22,  160,   22,   82,  100,  124,   22,  100,   22,   22,
        22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
-       22,   22,   22,   22,   22,  122,   22,   22,   22,   22,
-       22,   22,  180,  146,  139,  140,  135,  204,  123,  125,
-      157,  150,   22,  180,   22,  146,   22,   22,  139,   22,
-      140,   22,   22,  135,   22,  204,   22,   22,   22,   22,
-       22,   22,   22,  123,   22,  125,   22,   22,   22,   22,
-
-      157,   22,   22,   22,  150,  181,  205,  202,  210,  217,
-       22,   22,  181,   22,   22,  205,   22,   22,  202,   22,
-      210,   22,   22,   22,   22,  217,   22,  161,  186,  121,
-       22,  161,   22,   22,  186,   22,   22,  121,   22,   22,
-      178,  153,   22,   22,  178,   22,   22,  153,  206,   22,
-      206,   22,  124,   22,  124
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,  124,   22,   22,   22,   22,   22,   22,  191,  148,
+      141,  142,  154,  156,  155,  137,  215,  125,  127,  168,
+      161,   22,  191,   22,   22,  148,   22,   22,  141,   22,
+      142,   22,   22,   22,  154,   22,  156,   22,  155,   22,
+      137,   22,  215,   22,   22,   22,   22,   22,   22,   22,
+      125,   22,  127,   22,   22,   22,   22,  168,   22,   22,
+       22,  161,  192,  216,  213,  221,  228,   22,   22,   22,
+
+       22,   22,  192,   22,   22,   22,  216,   22,   22,  213,
+       22,  221,   22,   22,   22,   22,  228,   22,  150,  172,
+      157,  197,  123,   22,  150,   22,   22,   22,  172,   22,
+      157,   22,   22,  197,   22,   22,  123,   22,   22,  189,
+      164,   22,   22,   22,   22,  189,   22,   22,  164,  217,
+       22,   22,   22,  217,   22,  126,   22,   22,   22,  126,
+       22,   22,  151,   22,   22,  151,   22,  149,   22,  149
     } ;
 
-static yyconst flex_int16_t yy_accept[2577] =
+static yyconst flex_int16_t yy_accept[2761] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    2,    3,    3,    3,    3,    3,    3,
@@ -662,276 +674,296 @@ static yyconst flex_int16_t yy_accept[2577] =
 
        11,   13,   16,   18,   21,   24,   27,   30,   33,   35,
        37,   39,   41,   43,   45,   47,   49,   51,   53,   55,
-       57,   59,   61,   63,   65,   67,   69,   71,   73,   76,
-       79,   81,   83,   85,   87,   89,   91,   93,   95,   98,
-      101,  104,  107,  109,  112,  115,  118,  120,  122,  124,
+       57,   59,   61,   63,   65,   67,   69,   71,   73,   75,
+       78,   81,   83,   85,   87,   89,   91,   93,   95,   97,
+      100,  103,  106,  109,  111,  114,  117,  120,  122,  124,
       126,  128,  130,  132,  134,  136,  138,  140,  142,  144,
-      146,  148,  150,  152,  154,  156,  158,  161,  163,  165,
-      167,  169,  171,  173,  175,  177,  179,  181,  184,  186,
-      188,  190,  193,  197,  201,  205,  209,  212,  216,  218,
-      220,  222,  224,  226,  228,  231,  235,  239,  243,  246,
-
-      250,  252,  254,  256,  258,  260,  262,  264,  266,  268,
-      270,  272,  274,  277,  281,  285,  289,  292,  296,  299,
-      303,  307,  311,  314,  318,  321,  325,  329,  333,  336,
-      340,  342,  344,  346,  348,  350,  352,  354,  356,  358,
-      360,  363,  366,  369,  371,  374,  376,  379,  382,  385,
-      387,  390,  392,  394,  397,  400,  403,  405,  408,  410,
-      413,  416,  419,  421,  424,  426,  429,  432,  435,  437,
-      440,  442,  445,  448,  451,  453,  456,  459,  463,  467,
-      471,  474,  477,  481,  484,  488,  492,  496,  499,  503,
-      506,  510,  514,  518,  521,  525,  527,  529,  531,  533,
-
-      535,  537,  539,  542,  545,  548,  552,  556,  560,  563,
-      567,  570,  574,  578,  582,  585,  588,  592,  594,  596,
-      598,  600,  603,  607,  611,  615,  618,  622,  624,  626,
-      628,  630,  632,  634,  637,  639,  642,  644,  646,  648,
-      650,  653,  656,  660,  663,  667,  669,  670,  671,  672,
-      672,  672,  673,  674,  674,  675,  675,  675,  675,  675,
-      675,  675,  675,  675,  675,  675,  675,  675,  675,  675,
-      675,  675,  675,  675,  676,  676,  676,  676,  676,  676,
-      676,  676,  677,  678,  678,  678,  678,  678,  678,  678,
-      678,  678,  678,  679,  679,  679,  679,  679,  680,  680,
-
-      680,  680,  680,  680,  680,  680,  680,  680,  680,  680,
-      680,  681,  683,  685,  686,  687,  688,  690,  692,  693,
-      694,  695,  696,  697,  698,  699,  700,  701,  702,  703,
-      704,  705,  706,  707,  708,  709,  710,  711,  712,  713,
-      715,  716,  717,  718,  719,  720,  721,  722,  724,  726,
-      727,  728,  729,  730,  731,  732,  733,  734,  735,  737,
-      738,  739,  740,  741,  742,  743,  744,  745,  746,  747,
-      747,  747,  747,  747,  747,  747,  748,  750,  752,  754,
-      756,  757,  757,  757,  757,  757,  757,  757,  758,  758,
-      759,  761,  763,  765,  766,  766,  766,  767,  767,  767,
-
-      767,  767,  767,  767,  767,  767,  767,  768,  770,  772,
-      774,  775,  776,  778,  780,  782,  783,  784,  786,  788,
-      790,  791,  791,  791,  791,  791,  791,  791,  791,  791,
-      791,  792,  793,  795,  797,  799,  801,  802,  803,  804,
-      806,  808,  810,  812,  813,  813,  814,  815,  817,  819,
-      821,  823,  824,  825,  826,  828,  830,  832,  834,  835,
-      836,  837,  839,  841,  843,  845,  846,  847,  848,  850,
-      852,  854,  856,  857,  858,  860,  862,  864,  865,  866,
-      867,  869,  871,  873,  874,  875,  877,  879,  881,  882,
-      882,  882,  882,  882,  882,  882,  882,  883,  884,  885,
-
-      886,  887,  889,  891,  893,  894,  895,  897,  899,  901,
-      902,  903,  903,  903,  903,  903,  903,  904,  906,  908,
-      910,  911,  912,  912,  912,  912,  913,  914,  916,  917,
-      917,  917,  917,  918,  920,  922,  922,  922,  922,  922,
-      922,  922,  922,  922,  922,  922,  922,  922,  922,  922,
-      923,  923,  923,  923,  923,  923,  923,  923,  923,  923,
-      923,  923,  923,  923,  923,  923,  923,  923,  923,  923,
-      923,  923,  923,  923,  923,  923,  923,  923,  923,  923,
-      923,  923,  923,  923,  924,  925,  925,  925,  925,  925,
-      925,  925,  925,  925,  925,  925,  925,  925,  926,  927,
-
-      928,  929,  930,  931,  932,  933,  934,  935,  936,  937,
-      938,  940,  941,  942,  943,  944,  945,  946,  947,  948,
-      949,  950,  951,  952,  953,  954,  955,  956,  957,  958,
-      959,  960,  961,  962,  963,  964,  965,  966,  967,  968,
-      969,  970,  971,  972,  973,  974,  975,  977,  979,  980,
-      981,  982,  983,  984,  985,  985,  985,  985,  985,  985,
-      985,  985,  985,  985,  985,  985,  985,  985,  985,  985,
-      985,  985,  986,  986,  986,  986,  986,  986,  986,  986,
-      987,  987,  987,  988,  988,  988,  988,  988,  989,  989,
-      989,  989,  989,  989,  990,  991,  992,  993,  993,  993,
-
-      993,  993,  993,  994,  995,  995,  995,  995,  995,  996,
-      996,  996,  996,  996,  996,  997,  997,  997,  997,  997,
-      997,  997,  997,  997,  997,  997,  997,  997,  998,  998,
-      998,  998,  998,  998,  998,  998,  998,  999,  999,  999,
-      999,  999,  999, 1000, 1000, 1000, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1002,
-     1002, 1002, 1002, 1002, 1002, 1002, 1002, 1002, 1002, 1004,
-     1004, 1004, 1005, 1006, 1007, 1008, 1009, 1011, 1012, 1013,
-     1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023,
-     1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034,
-
-     1036, 1037, 1038, 1039, 1040, 1041, 1043, 1044, 1045, 1047,
-     1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057,
-     1058, 1059, 1061, 1062, 1063, 1064, 1067, 1068, 1069, 1069,
-     1070, 1070, 1071, 1071, 1071, 1071, 1071, 1072, 1072, 1072,
-     1073, 1073, 1073, 1073, 1073, 1073, 1074, 1074, 1074, 1074,
-     1075, 1075, 1076, 1077, 1077, 1078, 1078, 1079, 1079, 1079,
-     1079, 1080, 1080, 1080, 1080, 1081, 1082, 1083, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-     1085, 1086, 1086, 1086, 1086, 1086, 1087, 1087, 1087, 1087,
-
-     1087, 1087, 1087, 1087, 1087, 1087, 1087, 1087, 1087, 1087,
-     1087, 1087, 1087, 1088, 1088, 1088, 1089, 1089, 1089, 1089,
-     1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089,
-     1090, 1090, 1090, 1092, 1092, 1092, 1094, 1095, 1096, 1097,
-     1098, 1099, 1100, 1102, 1103, 1104, 1105, 1106, 1107, 1108,
-     1109, 1111, 1112, 1113, 1114, 1115, 1115, 1117, 1118, 1119,
-     1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129,
-     1130, 1131, 1132, 1133, 1135, 1136, 1137, 1139, 1140, 1141,
-     1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1152, 1153,
-     1154, 1157, 1159, 1159, 1159, 1159, 1159, 1159, 1159, 1159,
-
-     1159, 1160, 1160, 1160, 1161, 1161, 1161, 1161, 1161, 1161,
-     1161, 1161, 1161, 1161, 1161, 1161, 1161, 1161, 1161, 1161,
-     1161, 1161, 1161, 1161, 1161, 1161, 1162, 1162, 1162, 1162,
-     1162, 1162, 1162, 1162, 1162, 1162, 1163, 1163, 1164, 1164,
-     1165, 1165, 1165, 1166, 1166, 1166, 1166, 1166, 1166, 1166,
-     1166, 1166, 1166, 1166, 1166, 1167, 1167, 1167, 1167, 1167,
-     1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167,
-     1167, 1167, 1167, 1167, 1168, 1168, 1168, 1168, 1168, 1168,
-     1168, 1168, 1168, 1169, 1169, 1169, 1169, 1169, 1169, 1169,
-     1169, 1169, 1169, 1169, 1169, 1169, 1169, 1169, 1169, 1170,
-
-     1171, 1172, 1174, 1174, 1175, 1177, 1178, 1180, 1181, 1183,
-     1184, 1185, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194,
-     1195, 1196, 1197, 1198, 1199, 1201, 1202, 1203, 1204, 1205,
-     1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215,
-     1216, 1217, 1218, 1220, 1221, 1222, 1223, 1224, 1225, 1226,
-     1227, 1228, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237,
-     1238, 1239, 1240, 1241, 1242, 1243, 1245, 1248, 1248, 1248,
-     1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1249,
-     1249, 1249, 1249, 1250, 1250, 1250, 1250, 1250, 1251, 1251,
-     1252, 1252, 1253, 1253, 1253, 1253, 1253, 1254, 1254, 1254,
-
-     1254, 1255, 1255, 1256, 1256, 1256, 1256, 1256, 1256, 1256,
-     1256, 1256, 1256, 1257, 1257, 1257, 1257, 1257, 1257, 1257,
-     1257, 1257, 1257, 1257, 1257, 1257, 1257, 1257, 1257, 1257,
-     1257, 1257, 1257, 1257, 1257, 1257, 1257, 1257, 1258, 1258,
-     1258, 1259, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260,
-     1260, 1260, 1260, 1260, 1260, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1262, 1263, 1263, 1263, 1263, 1263, 1264,
-     1265, 1266, 1267, 1268, 1269, 1270, 1272, 1273, 1274, 1275,
-     1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285,
-     1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295,
-
-     1296, 1298, 1299, 1300, 1302, 1304, 1305, 1306, 1307, 1308,
-     1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1318, 1319,
-     1320, 1321, 1322, 1323, 1324, 1325, 1325, 1326, 1326, 1326,
-     1327, 1327, 1327, 1328, 1328, 1328, 1329, 1329, 1330, 1330,
-     1330, 1330, 1330, 1330, 1331, 1331, 1332, 1332, 1332, 1332,
-     1332, 1332, 1332, 1332, 1333, 1333, 1334, 1334, 1334, 1334,
-     1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1335, 1335,
-     1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335,
-     1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335,
-     1336, 1337, 1337, 1337, 1337, 1337, 1337, 1337, 1338, 1338,
-
-     1339, 1339, 1339, 1340, 1340, 1340, 1340, 1340, 1340, 1340,
-     1340, 1340, 1340, 1340, 1340, 1340, 1340, 1340, 1340, 1340,
-     1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349,
-     1350, 1351, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360,
-     1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370,
-     1371, 1372, 1373, 1375, 1377, 1378, 1379, 1380, 1381, 1382,
-     1383, 1385, 1386, 1388, 1389, 1390, 1392, 1393, 1394, 1395,
-     1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1403, 1403,
-     1404, 1404, 1404, 1404, 1404, 1404, 1404, 1405, 1405, 1406,
-     1407, 1408, 1408, 1409, 1409, 1409, 1409, 1409, 1409, 1409,
-
-     1409, 1409, 1409, 1409, 1410, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1412, 1412, 1412, 1413, 1413, 1413, 1413,
-     1414, 1414, 1414, 1415, 1416, 1416, 1416, 1416, 1416, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1417, 1417, 1417, 1417,
-     1417, 1417, 1418, 1419, 1419, 1419, 1419, 1419, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1421, 1422, 1424, 1426, 1427, 1428, 1429, 1430,
-     1431, 1432, 1433, 1435, 1436, 1437, 1439, 1440, 1441, 1442,
-     1443, 1444, 1446, 1448, 1449, 1450, 1451, 1452, 1453, 1454,
-
-     1455, 1456, 1457, 1458, 1459, 1461, 1462, 1463, 1464, 1465,
-     1466, 1468, 1470, 1471, 1472, 1473, 1474, 1476, 1477, 1478,
-     1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488,
-     1489, 1490, 1491, 1492, 1493, 1494, 1494, 1494, 1494, 1494,
-     1494, 1494, 1494, 1495, 1495, 1496, 1496, 1496, 1496, 1496,
-     1497, 1497, 1498, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1501, 1501, 1501,
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-     1503, 1503, 1503, 1503, 1503, 1503, 1504, 1506, 1507, 1508,
-     1509, 1510, 1511, 1512, 1513, 1514, 1516, 1517, 1518, 1519,
-     1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529,
-     1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539,
-     1540, 1542, 1543, 1544, 1546, 1547, 1548, 1549, 1550, 1551,
+      146,  148,  150,  152,  154,  156,  158,  160,  162,  165,
+      167,  169,  171,  173,  175,  177,  179,  181,  183,  185,
+      188,  190,  192,  194,  197,  201,  205,  209,  213,  216,
+      220,  222,  224,  226,  228,  230,  232,  235,  239,  243,
+
+      247,  250,  254,  256,  258,  260,  262,  264,  266,  268,
+      270,  272,  274,  276,  278,  281,  285,  289,  293,  296,
+      300,  303,  307,  311,  315,  318,  322,  325,  329,  333,
+      337,  340,  344,  346,  348,  350,  352,  354,  356,  358,
+      360,  362,  364,  367,  370,  373,  375,  378,  380,  383,
+      386,  389,  391,  394,  396,  398,  401,  404,  407,  409,
+      412,  414,  417,  420,  423,  425,  428,  430,  433,  436,
+      439,  441,  444,  446,  449,  452,  455,  457,  460,  463,
+      467,  471,  475,  478,  481,  485,  488,  492,  496,  500,
+      503,  507,  510,  514,  518,  522,  525,  529,  531,  533,
+
+      535,  537,  539,  541,  543,  546,  549,  552,  556,  560,
+      564,  567,  571,  574,  578,  582,  586,  589,  592,  596,
+      598,  600,  602,  604,  607,  611,  615,  619,  622,  626,
+      628,  630,  632,  634,  636,  638,  641,  643,  646,  648,
+      650,  652,  654,  657,  660,  664,  667,  671,  673,  675,
+      676,  677,  678,  678,  678,  679,  680,  680,  681,  681,
+      681,  681,  681,  681,  681,  681,  681,  681,  681,  681,
+      681,  681,  681,  681,  681,  681,  681,  681,  682,  682,
+      682,  682,  682,  682,  682,  682,  683,  684,  684,  684,
+      684,  684,  684,  684,  684,  684,  684,  685,  685,  685,
+
+      685,  685,  685,  686,  686,  686,  686,  686,  686,  686,
+      686,  686,  686,  686,  686,  686,  687,  689,  691,  692,
+      693,  694,  696,  698,  699,  700,  701,  702,  703,  704,
+      705,  706,  707,  708,  709,  710,  711,  712,  713,  714,
+      715,  716,  717,  718,  719,  720,  722,  723,  724,  725,
+      726,  727,  728,  729,  731,  733,  734,  735,  736,  737,
+      738,  739,  740,  741,  742,  744,  745,  746,  747,  748,
+      749,  750,  751,  752,  753,  754,  755,  755,  755,  755,
+      755,  755,  755,  756,  758,  760,  762,  764,  765,  765,
+      765,  765,  765,  765,  765,  766,  766,  767,  769,  771,
+
+      773,  774,  774,  774,  775,  775,  775,  775,  775,  775,
+      775,  775,  775,  775,  776,  778,  780,  782,  783,  784,
+      786,  788,  790,  791,  792,  794,  796,  798,  799,  799,
+      799,  799,  799,  799,  799,  799,  799,  799,  800,  801,
+      803,  805,  807,  809,  810,  811,  812,  814,  816,  818,
+      820,  821,  821,  822,  823,  825,  827,  829,  831,  832,
+      833,  834,  836,  838,  840,  842,  843,  844,  845,  847,
+      849,  851,  853,  854,  855,  856,  858,  860,  862,  864,
+      865,  866,  868,  870,  872,  873,  874,  875,  877,  879,
+      881,  882,  883,  885,  887,  889,  890,  890,  890,  890,
+
+      890,  890,  890,  890,  891,  892,  893,  894,  895,  897,
+      899,  901,  902,  903,  905,  907,  909,  910,  911,  911,
+      911,  911,  911,  911,  912,  914,  916,  918,  919,  920,
+      920,  920,  920,  921,  922,  924,  925,  925,  925,  925,
+      926,  928,  930,  930,  930,  930,  930,  930,  930,  930,
+      930,  930,  930,  930,  930,  930,  930,  930,  931,  931,
+      931,  931,  931,  931,  931,  931,  931,  931,  931,  931,
+      931,  931,  931,  931,  931,  931,  931,  931,  931,  931,
+      931,  931,  931,  931,  931,  931,  931,  931,  931,  931,
+      931,  931,  931,  932,  932,  933,  933,  933,  933,  933,
+
+      933,  933,  933,  933,  933,  933,  933,  933,  934,  935,
+      936,  937,  938,  939,  940,  941,  942,  943,  944,  945,
+      946,  948,  949,  950,  951,  952,  953,  954,  955,  956,
+      957,  958,  959,  960,  961,  962,  963,  964,  965,  966,
+      967,  968,  969,  970,  971,  972,  973,  974,  975,  976,
+      977,  978,  979,  980,  981,  982,  983,  984,  986,  987,
+      989,  990,  991,  992,  993,  994,  995,  995,  995,  995,
+      995,  995,  995,  995,  995,  995,  995,  995,  995,  995,
+      995,  995,  995,  995,  996,  996,  996,  996,  996,  996,
+      996,  996,  997,  997,  997,  998,  998,  998,  998,  998,
+
+      999,  999,  999,  999,  999,  999, 1000, 1001, 1002, 1003,
+     1003, 1003, 1003, 1003, 1003, 1004, 1005, 1005, 1005, 1005,
+     1005, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1007, 1007,
+     1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007,
+     1007, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+     1008, 1009, 1009, 1009, 1009, 1009, 1009, 1010, 1010, 1010,
+     1011, 1011, 1011, 1011, 1011, 1011, 1011, 1011, 1011, 1011,
+     1011, 1011, 1011, 1012, 1012, 1012, 1012, 1012, 1012, 1012,
+     1012, 1012, 1012, 1012, 1014, 1014, 1014, 1015, 1016, 1017,
+     1018, 1019, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028,
+
+     1029, 1030, 1031, 1032, 1033, 1035, 1036, 1037, 1038, 1039,
+     1040, 1041, 1042, 1043, 1044, 1045, 1047, 1048, 1049, 1050,
+     1051, 1052, 1054, 1055, 1056, 1058, 1059, 1060, 1061, 1062,
+     1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1072, 1073,
+     1074, 1075, 1076, 1079, 1080, 1081, 1081, 1082, 1082, 1083,
+     1083, 1083, 1083, 1083, 1084, 1084, 1084, 1085, 1085, 1085,
+     1085, 1085, 1085, 1086, 1086, 1086, 1086, 1087, 1087, 1088,
+     1089, 1089, 1090, 1090, 1091, 1091, 1091, 1091, 1092, 1092,
+     1092, 1092, 1093, 1094, 1095, 1096, 1096, 1096, 1096, 1096,
+     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+
+     1096, 1097, 1097, 1097, 1097, 1097, 1097, 1097, 1097, 1098,
+     1098, 1098, 1098, 1098, 1099, 1099, 1099, 1099, 1099, 1099,
+     1099, 1099, 1099, 1099, 1099, 1099, 1099, 1099, 1099, 1099,
+     1099, 1099, 1099, 1100, 1100, 1100, 1101, 1101, 1101, 1101,
+     1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101,
+     1101, 1102, 1102, 1102, 1104, 1104, 1104, 1106, 1107, 1108,
+     1109, 1110, 1111, 1112, 1114, 1115, 1116, 1117, 1118, 1119,
+     1120, 1121, 1123, 1124, 1125, 1126, 1127, 1127, 1129, 1130,
+     1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140,
+     1141, 1142, 1143, 1144, 1145, 1146, 1147, 1149, 1150, 1151,
+
+     1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162,
+     1163, 1164, 1167, 1168, 1169, 1172, 1174, 1174, 1174, 1174,
+     1174, 1174, 1174, 1174, 1174, 1175, 1175, 1175, 1176, 1176,
+     1176, 1176, 1176, 1176, 1176, 1176, 1176, 1176, 1176, 1176,
+     1176, 1176, 1176, 1176, 1176, 1176, 1176, 1176, 1176, 1176,
+     1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177,
+     1177, 1178, 1178, 1179, 1179, 1180, 1180, 1180, 1181, 1181,
+     1181, 1181, 1181, 1181, 1181, 1181, 1181, 1181, 1181, 1181,
+     1181, 1181, 1182, 1182, 1182, 1182, 1182, 1182, 1182, 1182,
+     1182, 1182, 1182, 1182, 1182, 1182, 1182, 1182, 1182, 1182,
+
+     1182, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183,
+     1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184,
+     1184, 1184, 1184, 1184, 1185, 1185, 1185, 1186, 1187, 1188,
+     1190, 1190, 1191, 1193, 1194, 1196, 1197, 1199, 1200, 1201,
+     1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212,
+     1213, 1214, 1215, 1216, 1217, 1219, 1220, 1221, 1222, 1223,
+     1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233,
+     1234, 1235, 1236, 1238, 1239, 1240, 1241, 1242, 1243, 1244,
+     1245, 1246, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255,
+     1256, 1257, 1258, 1259, 1260, 1261, 1263, 1265, 1268, 1268,
+
+     1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268,
+     1269, 1269, 1269, 1269, 1270, 1270, 1270, 1270, 1270, 1271,
+     1271, 1272, 1272, 1273, 1273, 1273, 1273, 1273, 1274, 1274,
+     1274, 1274, 1275, 1275, 1276, 1276, 1276, 1277, 1277, 1277,
+     1277, 1277, 1277, 1277, 1277, 1277, 1277, 1278, 1278, 1278,
+     1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278,
+     1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278,
+     1278, 1278, 1278, 1278, 1279, 1279, 1279, 1280, 1281, 1281,
+     1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+     1281, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1283,
+
+     1284, 1284, 1284, 1284, 1284, 1285, 1286, 1287, 1288, 1289,
+     1290, 1291, 1292, 1293, 1295, 1296, 1297, 1298, 1299, 1300,
+     1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310,
+     1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320,
+     1321, 1323, 1324, 1325, 1327, 1329, 1330, 1331, 1332, 1333,
+     1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1343, 1344,
+     1345, 1346, 1347, 1348, 1349, 1350, 1350, 1351, 1351, 1351,
+     1352, 1352, 1352, 1353, 1353, 1353, 1354, 1354, 1355, 1355,
+     1355, 1355, 1355, 1355, 1356, 1356, 1357, 1357, 1357, 1357,
+     1357, 1357, 1357, 1357, 1358, 1358, 1359, 1359, 1359, 1359,
+
+     1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359,
+     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
+     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
+     1360, 1360, 1360, 1360, 1361, 1362, 1362, 1362, 1362, 1362,
+     1362, 1362, 1363, 1363, 1364, 1364, 1364, 1365, 1365, 1365,
+     1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365,
+     1365, 1365, 1365, 1365, 1365, 1366, 1367, 1368, 1369, 1370,
+     1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1380, 1381,
+     1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391,
+     1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401,
+
+     1402, 1404, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1414,
+     1415, 1417, 1418, 1419, 1421, 1422, 1423, 1424, 1425, 1426,
+     1427, 1428, 1429, 1430, 1431, 1432, 1432, 1432, 1433, 1433,
+     1433, 1433, 1433, 1433, 1433, 1434, 1434, 1435, 1436, 1437,
+     1437, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
+     1438, 1438, 1439, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
+     1440, 1440, 1440, 1441, 1441, 1441, 1442, 1442, 1442, 1442,
+     1442, 1442, 1443, 1443, 1443, 1444, 1445, 1445, 1445, 1445,
+     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1446, 1446,
+     1446, 1446, 1446, 1446, 1447, 1448, 1448, 1448, 1448, 1448,
+
+     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
+     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
+     1449, 1449, 1449, 1449, 1450, 1451, 1453, 1455, 1456, 1457,
+     1458, 1459, 1460, 1461, 1462, 1463, 1464, 1466, 1467, 1468,
+     1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1479, 1481,
+     1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491,
+     1492, 1494, 1495, 1496, 1497, 1498, 1499, 1501, 1503, 1504,
+     1505, 1506, 1507, 1509, 1510, 1511, 1512, 1513, 1514, 1515,
+     1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525,
+     1526, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1528,
+
+     1528, 1529, 1529, 1529, 1529, 1529, 1530, 1530, 1531, 1532,
+     1532, 1532, 1532, 1532, 1532, 1532, 1532, 1532, 1532, 1532,
+     1532, 1533, 1533, 1533, 1533, 1533, 1533, 1533, 1533, 1533,
+     1533, 1533, 1533, 1533, 1533, 1533, 1533, 1533, 1533, 1533,
+     1533, 1533, 1533, 1533, 1533, 1533, 1533, 1533, 1534, 1534,
+     1534, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535,
+     1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535,
+     1535, 1535, 1535, 1536, 1536, 1536, 1536, 1536, 1536, 1536,
+     1536, 1536, 1536, 1536, 1536, 1536, 1536, 1537, 1539, 1540,
+     1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550,
+
      1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561,
-     1562, 1563, 1564, 1565, 1566, 1567, 1569, 1570, 1571, 1572,
-     1573, 1574, 1575, 1576, 1577, 1577, 1578, 1578, 1578, 1578,
-
-     1578, 1578, 1579, 1579, 1579, 1579, 1579, 1580, 1580, 1580,
-     1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580,
-     1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580,
-     1580, 1580, 1580, 1580, 1580, 1580, 1581, 1581, 1581, 1581,
-     1582, 1583, 1583, 1583, 1584, 1585, 1585, 1586, 1586, 1586,
-     1586, 1586, 1586, 1586, 1586, 1586, 1586, 1587, 1587, 1587,
-     1587, 1587, 1588, 1588, 1588, 1588, 1588, 1588, 1588, 1588,
-     1588, 1588, 1588, 1588, 1589, 1589, 1590, 1591, 1592, 1593,
+     1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571,
+     1572, 1573, 1574, 1575, 1576, 1577, 1578, 1580, 1581, 1582,
+     1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593,
      1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603,
-     1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613,
-
-     1614, 1615, 1616, 1617, 1618, 1620, 1621, 1622, 1623, 1625,
-     1627, 1628, 1629, 1631, 1633, 1634, 1636, 1637, 1638, 1639,
-     1640, 1641, 1642, 1643, 1644, 1645, 1647, 1648, 1649, 1650,
-     1651, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661,
-     1662, 1663, 1663, 1664, 1664, 1665, 1666, 1666, 1666, 1666,
-     1666, 1666, 1666, 1666, 1666, 1666, 1666, 1667, 1667, 1667,
-     1667, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668,
-     1669, 1669, 1669, 1669, 1669, 1669, 1669, 1669, 1669, 1669,
-     1669, 1669, 1669, 1669, 1669, 1670, 1670, 1670, 1671, 1671,
-     1671, 1671, 1671, 1671, 1671, 1671, 1671, 1671, 1671, 1671,
-
-     1671, 1671, 1671, 1671, 1671, 1672, 1672, 1672, 1672, 1673,
-     1674, 1675, 1676, 1677, 1679, 1680, 1681, 1682, 1684, 1685,
-     1686, 1687, 1688, 1689, 1690, 1691, 1692, 1694, 1695, 1696,
-     1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706,
-     1707, 1708, 1710, 1711, 1712, 1714, 1715, 1716, 1717, 1718,
-     1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728,
-     1729, 1730, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1738,
-     1738, 1739, 1739, 1739, 1739, 1739, 1739, 1739, 1740, 1740,
-     1740, 1741, 1741, 1741, 1741, 1741, 1742, 1742, 1742, 1743,
-     1743, 1743, 1743, 1744, 1744, 1744, 1745, 1746, 1746, 1746,
-
-     1746, 1746, 1747, 1748, 1748, 1749, 1750, 1750, 1750, 1751,
-     1751, 1751, 1751, 1751, 1751, 1751, 1751, 1751, 1751, 1751,
-     1751, 1751, 1752, 1752, 1752, 1752, 1753, 1754, 1755, 1756,
-     1757, 1759, 1760, 1761, 1763, 1764, 1765, 1766, 1767, 1769,
-     1770, 1771, 1773, 1774, 1775, 1776, 1778, 1779, 1780, 1782,
-     1784, 1785, 1786, 1787, 1788, 1790, 1792, 1793, 1795, 1797,
-     1798, 1799, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808,
-     1809, 1810, 1811, 1812, 1813, 1815, 1816, 1817, 1818, 1818,
-     1819, 1819, 1819, 1819, 1819, 1820, 1820, 1820, 1821, 1821,
-     1821, 1821, 1821, 1822, 1822, 1822, 1822, 1822, 1823, 1823,
-
-     1824, 1825, 1825, 1826, 1827, 1827, 1827, 1828, 1828, 1828,
-     1828, 1828, 1828, 1828, 1829, 1830, 1830, 1830, 1831, 1831,
-     1831, 1831, 1832, 1833, 1834, 1836, 1837, 1838, 1840, 1841,
-     1842, 1843, 1844, 1846, 1847, 1848, 1849, 1850, 1852, 1853,
-     1855, 1857, 1858, 1860, 1862, 1863, 1864, 1866, 1867, 1868,
-     1869, 1870, 1871, 1872, 1874, 1876, 1877, 1878, 1880, 1881,
-     1882, 1883, 1884, 1884, 1884, 1884, 1885, 1886, 1886, 1886,
-     1887, 1887, 1887, 1887, 1888, 1888, 1888, 1889, 1889, 1890,
-     1890, 1890, 1891, 1891, 1891, 1891, 1891, 1891, 1891, 1892,
-     1892, 1892, 1892, 1893, 1893, 1894, 1895, 1897, 1899, 1900,
-
-     1901, 1903, 1904, 1905, 1906, 1908, 1909, 1910, 1912, 1913,
-     1915, 1916, 1917, 1919, 1920, 1921, 1922, 1923, 1924, 1925,
-     1927, 1928, 1929, 1930, 1932, 1933, 1934, 1935, 1935, 1935,
-     1935, 1935, 1935, 1935, 1935, 1935, 1935, 1935, 1935, 1935,
-     1935, 1935, 1935, 1935, 1935, 1936, 1936, 1936, 1936, 1936,
-     1936, 1936, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945,
-     1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955,
-     1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1965,
-     1966, 1967, 1967, 1968, 1969, 1969, 1969, 1969, 1969, 1969,
-     1969, 1970, 1971, 1971, 1971, 1971, 1972, 1972, 1972, 1973,
-
-     1975, 1977, 1978, 1980, 1982, 1983, 1985, 1987, 1988, 1989,
-     1990, 1991, 1992, 1993, 1995, 1997, 1998, 1999, 2000, 2002,
-     2003, 2004, 2006, 2006, 2007, 2007, 2008, 2008, 2009, 2010,
-     2010, 2010, 2010, 2011, 2011, 2012, 2014, 2015, 2017, 2018,
-     2020, 2022, 2023, 2024, 2025, 2027, 2028, 2029, 2029, 2030,
-     2030, 2031, 2031, 2031, 2033, 2034, 2036, 2037, 2039, 2040,
-     2041, 2041, 2042, 2042, 2043, 2044, 2046, 2047, 2049, 2050,
-     2050, 2052, 2053, 2054, 2056, 2056
+     1604, 1605, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614,
+     1615, 1615, 1616, 1616, 1616, 1616, 1616, 1616, 1617, 1617,
+     1617, 1617, 1617, 1618, 1618, 1618, 1618, 1618, 1618, 1618,
+     1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618,
+     1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618,
+
+     1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1619, 1619,
+     1619, 1619, 1620, 1621, 1621, 1621, 1622, 1623, 1623, 1624,
+     1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1625,
+     1625, 1625, 1625, 1625, 1626, 1626, 1626, 1626, 1626, 1626,
+     1626, 1626, 1626, 1626, 1626, 1626, 1627, 1627, 1628, 1629,
+     1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639,
+     1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649,
+     1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659,
+     1660, 1661, 1662, 1664, 1665, 1666, 1667, 1669, 1671, 1672,
+     1673, 1675, 1677, 1678, 1680, 1681, 1682, 1683, 1684, 1685,
+
+     1686, 1687, 1688, 1689, 1691, 1692, 1693, 1694, 1695, 1697,
+     1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707,
+     1707, 1708, 1708, 1709, 1710, 1710, 1710, 1710, 1710, 1710,
+     1710, 1710, 1710, 1710, 1710, 1710, 1710, 1710, 1711, 1711,
+     1711, 1711, 1712, 1712, 1712, 1712, 1712, 1712, 1712, 1712,
+     1712, 1712, 1712, 1712, 1713, 1713, 1713, 1713, 1713, 1713,
+     1713, 1713, 1713, 1713, 1713, 1713, 1713, 1713, 1713, 1714,
+     1714, 1714, 1715, 1715, 1715, 1715, 1715, 1715, 1715, 1715,
+     1715, 1715, 1715, 1715, 1715, 1715, 1715, 1715, 1715, 1716,
+     1716, 1716, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723,
+
+     1724, 1726, 1727, 1728, 1729, 1731, 1732, 1733, 1734, 1735,
+     1736, 1737, 1738, 1739, 1740, 1741, 1742, 1744, 1745, 1746,
+     1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756,
+     1757, 1758, 1760, 1761, 1762, 1764, 1765, 1766, 1767, 1768,
+     1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778,
+     1779, 1780, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1788,
+     1788, 1789, 1789, 1789, 1789, 1789, 1789, 1789, 1789, 1789,
+     1789, 1790, 1790, 1790, 1791, 1791, 1791, 1791, 1791, 1792,
+     1792, 1792, 1792, 1792, 1792, 1793, 1793, 1793, 1793, 1794,
+     1794, 1794, 1795, 1796, 1796, 1796, 1796, 1796, 1797, 1798,
+
+     1798, 1799, 1800, 1800, 1800, 1801, 1801, 1801, 1801, 1801,
+     1801, 1801, 1801, 1801, 1801, 1801, 1801, 1801, 1802, 1802,
+     1802, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810,
+     1812, 1813, 1814, 1816, 1817, 1818, 1819, 1820, 1822, 1823,
+     1824, 1825, 1826, 1827, 1829, 1830, 1831, 1832, 1834, 1835,
+     1836, 1838, 1840, 1841, 1842, 1843, 1844, 1846, 1848, 1849,
+     1851, 1853, 1854, 1855, 1857, 1858, 1859, 1860, 1861, 1862,
+     1863, 1864, 1865, 1866, 1867, 1868, 1869, 1871, 1872, 1873,
+     1874, 1874, 1875, 1875, 1875, 1875, 1876, 1876, 1876, 1877,
+     1877, 1877, 1877, 1878, 1878, 1878, 1878, 1878, 1879, 1879,
+
+     1879, 1879, 1879, 1879, 1879, 1879, 1880, 1880, 1881, 1882,
+     1882, 1883, 1884, 1884, 1884, 1885, 1885, 1885, 1885, 1885,
+     1885, 1885, 1886, 1887, 1887, 1887, 1888, 1888, 1888, 1888,
+     1889, 1890, 1892, 1893, 1894, 1896, 1897, 1898, 1899, 1901,
+     1902, 1903, 1904, 1905, 1907, 1908, 1909, 1910, 1911, 1912,
+     1913, 1914, 1916, 1917, 1919, 1921, 1922, 1924, 1926, 1927,
+     1928, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1938, 1940,
+     1941, 1942, 1944, 1945, 1946, 1947, 1948, 1948, 1948, 1948,
+     1948, 1949, 1950, 1950, 1951, 1951, 1952, 1952, 1952, 1952,
+     1952, 1952, 1952, 1953, 1953, 1953, 1954, 1954, 1955, 1955,
+
+     1955, 1956, 1956, 1956, 1956, 1956, 1956, 1956, 1957, 1957,
+     1957, 1957, 1958, 1958, 1959, 1960, 1961, 1963, 1965, 1966,
+     1968, 1969, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1979,
+     1980, 1981, 1983, 1984, 1986, 1987, 1988, 1990, 1991, 1992,
+     1993, 1994, 1995, 1996, 1998, 1999, 2000, 2001, 2003, 2004,
+     2005, 2006, 2006, 2006, 2006, 2006, 2006, 2006, 2006, 2006,
+     2006, 2006, 2006, 2006, 2006, 2006, 2006, 2006, 2006, 2006,
+     2006, 2006, 2006, 2006, 2007, 2007, 2007, 2007, 2007, 2007,
+     2007, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017,
+     2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027,
+
+     2028, 2029, 2030, 2031, 2033, 2034, 2035, 2036, 2037, 2038,
+     2039, 2040, 2040, 2041, 2041, 2042, 2043, 2043, 2043, 2044,
+     2045, 2046, 2047, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+     2049, 2050, 2050, 2050, 2050, 2051, 2051, 2051, 2052, 2054,
+     2055, 2057, 2058, 2060, 2062, 2063, 2064, 2066, 2068, 2070,
+     2072, 2074, 2075, 2076, 2077, 2078, 2079, 2080, 2082, 2084,
+     2085, 2086, 2087, 2089, 2090, 2091, 2093, 2093, 2093, 2093,
+     2093, 2094, 2094, 2094, 2095, 2095, 2096, 2097, 2097, 2097,
+     2097, 2098, 2098, 2099, 2100, 2101, 2102, 2104, 2105, 2106,
+     2108, 2109, 2111, 2113, 2114, 2115, 2116, 2118, 2119, 2120,
+
+     2120, 2120, 2121, 2122, 2122, 2123, 2123, 2124, 2124, 2124,
+     2126, 2127, 2128, 2130, 2132, 2133, 2135, 2136, 2138, 2139,
+     2140, 2140, 2140, 2140, 2141, 2141, 2142, 2143, 2144, 2145,
+     2147, 2148, 2150, 2150, 2150, 2151, 2151, 2152, 2153, 2155,
+     2156, 2156, 2156, 2157, 2158, 2159, 2161, 2161, 2161, 2162,
+     2163, 2163, 2164, 2165, 2167, 2167, 2168, 2169, 2171, 2171
     } ;
 
 static yyconst flex_int32_t yy_ec[256] =
@@ -976,612 +1008,654 @@ static yyconst flex_int32_t yy_meta[56] =
         7,    7,   12,    7,    1
     } ;
 
-static yyconst flex_int16_t yy_base[2730] =
+static yyconst flex_int16_t yy_base[2914] =
     {   0,
         0,   54,  102,  156,   19,  160,  203,    0,   39,   41,
-     4312, 4311,  256,  310,   44,  141,  365,    0,  419,  473,
-       46,   47,  528,    0,  183,  243, 4310, 4309,   50,  147,
+     4572, 4571,  256,  310,   44,  141,  365,    0,  419,  473,
+       46,   47,  528,    0,  183,  243, 4570, 4569,   50,  147,
       582,  636,  690,  744,  798,  852,   42,  158,   49,   66,
       145,  148,  230,  257,  906,  960, 1014, 1068,  150,  177,
      1122, 1176, 1230, 1284, 1338, 1392, 1446, 1500, 1554, 1608,
      1662, 1716, 1770, 1824,  140,  168,  258,  264,  245,  280,
-     1879,    0, 4308, 4307, 1934,    0, 1988, 2042, 2096, 2150,
+     1879,    0, 4568, 4567, 1934,    0, 1988, 2042, 2096, 2150,
       301,  312, 2204, 2258,  299,  314, 2313,    0, 2367, 2421,
-      404,  410, 2475, 2529,  180,  198, 4325, 6873,   65, 6873,
-
-     4303,    0,   28,  160,  447, 4302, 6873, 4301, 4318, 4270,
-      311,  428,  184,  126, 4263,  392, 4265,  212,  459,  465,
-      252,  185,  254,  466,  124,  266, 4269, 4272, 6873,  586,
-      473,  478, 4260,  196,  300,  480,    0, 4282,  440,  255,
-     2575,  591,    0, 4281,    0, 4280, 4297, 4258,  581,  572,
-      409,  424,  261,  579,  292,  317,  622,  601,  586,  436,
-      600,  628,  481,  420, 4259, 4262,    0,  629,  638,  618,
-      448,  634,  679, 4252,  643, 4251,  668, 6873, 4255, 4249,
-     4258,    0,  423,    0, 2618,  716, 4288,    0, 4246,  139,
-     4242, 4238, 4248, 4271,    0,  679, 2661,  724, 4276,    0,
-
-     4231, 4241,    0, 4225, 4224, 4227, 4239, 4233, 4220, 4218,
-     4222, 4220,    0,  748, 2704,  763, 4261,    0,    0,  763,
-     2747,  772, 4258,    0,    0,  789, 2790,  807, 4257,    0,
-     4228, 4225, 4214, 4209, 4211, 4221, 4222, 4213, 4203,  675,
-      824, 2839, 4197,  825,  681,  706,  829, 2888, 4196,  830,
-      747, 4214,  787,  837, 2937, 4194,  833,  788,  827,  856,
-     2986, 4193,  857,  832,  867,  872, 3035, 4192,  875,  868,
-      874,  880, 3084, 4191,  885,  878,    0,  887, 3127,  915,
-     4216, 4239,    0,    0,  893, 3170,  925, 4238,    0,    0,
-      945, 3213,  940, 4237,    0, 4190, 4200, 4193, 4205, 4190,
-
-     4201, 4199, 3266, 3321,    0,  964, 3366,  979, 4229,    0,
-        0,  979, 3409,  988, 4204, 4227,    0, 4186,  644, 4176,
-     4183,    0, 1005, 3452, 1023, 4214,    0, 4171, 4171, 4179,
-     4177,    0,    0,  711, 4207,    0, 4165, 4164, 4172, 4171,
-        0,    0, 3504, 4202,    0, 4161,  715, 6873,    0, 4168,
-     4167,  711, 1033,    0, 6873, 4170,  761, 4157, 4155, 4148,
-     4163, 4151, 4150,  439, 4138, 4155, 4155, 4135, 4132, 4136,
-     4135, 4130, 4129, 4127, 4126, 4143, 4141,  321, 4119, 4120,
-     4125, 4134, 4123,  218, 4121, 1024, 4114, 4121, 4114, 4128,
-     4127, 4117, 6873, 4113, 4122, 4125, 4107, 1057, 4113, 4112,
-
-     4108, 4120, 4106, 4105, 4104, 4108, 4098,  457, 4095, 4111,
-        0,    0,  900, 4108, 4107, 6873, 3513, 1095, 3556, 4110,
-      807, 4097, 4095, 4088, 4103, 4088, 4087,  464, 4075, 4092,
-     4092, 4073, 4070, 4074, 4072, 4072, 4067, 4066, 4064, 4063,
-     4062, 4079, 4077,  553, 4055, 4058, 4063, 4072, 4055,  598,
-     4053, 1026, 4046, 4053, 4046, 4057, 4056, 4046,    0, 4042,
-     4051, 4054, 4036, 4039, 4043, 4033,  616, 4030, 4044, 4028,
-     4028, 4026, 4030, 4029, 4026,    0,  716,    0, 3582, 1103,
-     3625, 4027, 4020, 4020, 4020, 4022, 4020, 6873, 4055,    0,
-     1059, 3651, 1131, 3694, 4016, 4017,    0, 4027, 4012, 4016,
-
-     4016, 4024, 4021, 4006, 4021, 4010,    0, 1148, 3720, 1143,
-     3763,    0, 1161, 3789, 1157, 3832,    0, 1180, 3858, 1195,
-     3901, 4004, 4013, 3996, 4005, 4000, 4004, 4013, 4003, 4002,
-      895,    0, 1195, 4032, 3933, 3980, 3976,  896,    0, 1196,
-     4030, 4025, 3978, 4068, 3997,  929,    0, 1215, 4025, 4117,
-     3973, 4160,  940,    0, 1217, 4023, 4209, 3971, 4252,  941,
-        0, 1219, 4021, 4301, 3969, 4344,  963,    0, 1221, 4019,
-     4393, 3967, 4436,    0, 1248, 4479, 1257, 4522, 3991,    0,
-     1258, 4548, 1293, 4591,    0, 1259, 4617, 1303, 4660, 3968,
-     3982, 3982, 3975, 3963, 3968, 3961,    0, 4696,    0, 4751,
-
-        0, 1260, 4796, 1311, 4839,    0, 1328, 4865, 1347, 4908,
-     3977, 3950, 3968, 3959, 3949, 3950,    0, 1329, 4934, 1357,
-     4977, 6873, 3963, 3950, 3949,    0,    0,  767, 6873,  705,
-     3956, 3946,    0, 5012,    0, 3937, 3957, 3946, 3941, 3950,
-     3950, 3949, 3949, 3938, 3949, 3938, 3943,  943, 3934, 6873,
-     3926, 3939, 3930, 3938, 3930, 3921, 3939, 3920, 3933, 3928,
-     3921, 3913, 3933,  752, 3927, 3924, 3922, 3923, 3924,  836,
-     3910,  749, 3916, 3917, 3911, 3905, 3918, 3895, 3902, 3903,
-     3905, 3930, 3884, 6873, 6873, 3886, 3890, 3880, 3879, 3873,
-     3889, 3888, 3885, 3861, 3861, 3859, 3867, 3873, 3862, 3857,
-
-     3868, 3868, 3867, 3867, 3856, 3867, 3856, 3861,  966, 3852,
-        0, 3844, 3857, 3848, 3856, 3848, 3870, 3838, 3856, 3837,
-     3840, 3849, 3844, 3837, 3829, 3849,  968, 3843, 3840, 3838,
-     3825, 3826,  961, 3812,  965, 3818, 3819, 3810, 3804, 3817,
-     3803, 3801, 3802, 3804, 3829, 3790,    0,    0, 3803, 3800,
-     3785, 3785, 3783, 3791, 3781, 3780, 3779, 3793, 3783, 1021,
-     3782, 3793, 3790, 3778, 3776, 3781, 3775, 3809, 3786, 3785,
-     3780,    0, 3796, 3766, 3767, 3771, 3765, 3769, 3773, 6873,
-     3751, 3743, 6873, 3751, 3755, 3758, 3740, 3760, 3775, 3749,
-     3729, 3736, 1005, 6873, 6873, 3746, 6873, 3738, 3732, 3732,
-
-     3724, 3725, 6873, 6873, 3725, 3725, 3718, 3711, 6873, 3709,
-     3725, 3716, 3704, 3704, 6873, 3715, 3721, 3703, 3718, 3708,
-     3719, 3718, 3713, 3710, 3697, 3698, 1020, 6873, 3699, 3698,
-     3703, 3694, 3698, 3730, 3677, 3682, 6873, 3672, 3690, 3676,
-     3667, 3667, 6873, 3666, 3678, 6873, 3659, 3648, 3659, 3653,
-     3658, 3663,  941, 3658,  868, 3652, 3651, 1009, 3685, 3660,
-     3657, 3642, 3642, 3640, 3648, 3647, 3643, 3646, 6873, 3649,
-     1018, 3632, 3648, 3639, 3627, 3627,    0, 3638, 3644, 3626,
-     3641, 3631, 3642, 3641, 3636, 3633, 3606, 3607, 1045,    0,
-     3643, 3607, 3606, 3608, 3599, 3603, 3635, 3587, 3592,    0,
-
-     3582, 3600, 3586, 3580, 3580,    0, 3579, 3591,    0, 3581,
-     3570, 3581, 3575, 3580, 3585, 1048, 3580, 1117, 3574, 3573,
-     1032, 3607, 3575, 3571, 3574,    0,   27, 1168,   55, 6873,
-      175,  174,  212,  256,  302,  321, 6873,  411,  471,  491,
-      549,  568,  709,  573,  597, 6873, 1072,  675,  653,  694,
-      722, 6873, 6873,  763, 6873,  801, 6873,  799,  855, 1080,
-      925,  945,  973,  975, 6873, 6873, 6873, 1057, 1044, 1055,
-     1059, 1063, 1065, 1052, 1091, 1081, 1096, 1377, 1381, 1123,
-     1117, 1125, 6873, 1141, 1135, 1177, 1147, 1159, 1155, 1185,
-     6873, 1217, 1186, 1180, 1186, 6873, 1191, 1223, 1196, 1216,
-
-     5001, 1221, 1220, 1206, 1217, 1224, 1232, 1232, 1246, 1235,
-     1250, 1239, 6873, 1253, 1239, 1283, 1245, 1250, 1268, 1283,
-     1293, 1288, 1287, 1294, 1298, 1372, 1304, 1303, 1327, 6873,
-     1341, 1329, 6873, 1329, 1355, 1378, 1383, 1424, 1431, 1414,
-     1345, 1352,    0, 1357, 1352, 1393, 1363, 1371, 1369, 1387,
-        0, 1422, 1390, 1384, 1394, 1428,    0, 1400, 1406, 1398,
-     1407, 5021, 1413, 1411, 1397, 1413, 1420, 1411, 1408, 1431,
-     1420, 1435, 1424,    0, 1435, 1420, 1463, 1425, 1430, 1432,
-     1428, 1436, 1431, 1430, 1437, 1438, 1442,    0, 1435, 1452,
-     1479, 1484, 1456, 1457, 1458, 1461, 1447, 1451, 1464, 1455,
-
-     6873, 1452, 1464, 6873, 1465, 1463, 1459, 1470, 1487, 1462,
-     1508, 1491, 1472, 1494, 1475, 1493, 1479, 1496, 1522, 1514,
-        0, 1487, 1488, 1495,    0, 6873, 1504, 1492, 1492, 1492,
-     1498, 1496, 1505, 1498, 1545, 6873, 1572, 6873, 1517, 1518,
-     1514, 1520, 6873, 1520, 1518, 1545, 1528, 1524, 1531, 1565,
-     1538, 1545, 1554, 1577, 6873, 1554, 1558, 1546, 1543, 1563,
-     1560, 1561, 1558, 1551, 1564, 1566, 1557, 1568, 1555, 1559,
-     1562, 1562, 1567, 6873, 1565, 1583, 1570, 1567, 1584, 1582,
-     1597, 1596, 6873, 1601, 1587, 1592,    0, 1601, 1589, 1590,
-     1597, 1594, 1603, 1599, 1597, 1602, 1597, 1613, 6873, 1643,
-
-     1650, 1644, 1652, 1649,    0, 1683,    0, 1616, 1622, 1619,
-     1625,    0, 1622, 1619, 1629, 1632, 1631, 1623, 1666, 1645,
-     1651, 1662,    0, 1685,    0, 1664, 1652, 1649, 1669, 1666,
-     1668, 1665, 1658, 1671, 1673, 1664, 1674, 1663, 1666, 1669,
-     1669, 1674,    0, 1669, 1689, 1677, 1674, 1682, 1689, 1704,
-     1703,    0, 1708, 1693, 1698, 1741, 1707, 1695, 1698, 1705,
-     1702, 1711, 1708, 1706, 1711, 1758, 1750, 1711, 1708, 1714,
-     1718, 1711, 1718, 1731, 1720, 1717, 1735, 1729, 6873, 1734,
-     1715, 1735, 6873, 1732, 1764, 1727, 1738,    0, 1749, 6873,
-     1780,    0, 1745, 1758, 1755, 1752,    0, 1761, 1758, 1750,
-
-     6873, 1754, 6873, 1771, 1754, 1773, 1758, 1757, 1798, 1777,
-     1765, 1775, 6873, 1779, 1764,    0, 1777, 1771, 1775, 1782,
-     1783, 1778, 1770, 1772, 1774, 1776, 1781, 1800, 1791, 1793,
-     1800, 1810, 1811, 1800, 1801, 1808, 1809, 1842, 1810, 1804,
-     6873, 6873, 1810, 1805, 1818, 1817, 1815, 1811, 1816, 1820,
-     1814, 1856, 1819, 1819, 6873, 1860, 1827, 1822, 1840, 1824,
-     1835, 1830, 1871, 1872, 1987, 1989, 1837, 1965, 1977, 1950,
-     1949, 2000, 1979, 1967, 1977,    0, 1981, 1965, 2013, 1983,
-     1978, 1983,    0, 1990, 1985, 1977, 1979, 1980, 1983, 1986,
-     2003, 1994, 1996, 1995, 2011, 2005, 1994, 1995, 2007, 2009,
-
-     2042, 2010, 2012,    0,    0, 2018, 2013, 2027, 2026, 2024,
-     2020, 2025, 2030, 2024, 2065, 2028, 2028,    0, 2069, 2036,
-     2031, 2049, 2033, 2044, 2039, 2044, 6873, 2053, 2033, 6873,
-     2053, 2040, 6873, 2059, 2059, 6873, 2045, 6873, 2046, 2059,
-        0, 2080, 2065,    0, 2060,    0, 2060, 2060, 2058, 2076,
-     2074, 2069, 2088, 6873, 2071, 6873, 2073, 2075, 2089, 2088,
-     2079, 2075, 2087, 2081, 2092, 2093, 2122, 6873, 2091, 2135,
-     2092, 2101, 2106, 2089, 2168, 2094, 2098, 2102, 2112, 2099,
-     2099, 2119, 2107, 2108, 2114, 2111, 2129, 2127, 2127, 6873,
-     6873, 2150, 2149, 2133, 2144, 2146, 2153, 6873, 2140, 6873,
-
-     2143, 2156, 6873, 2153, 2158, 2159, 2158, 2165, 2162, 2152,
-     2148, 2158, 2159, 2165, 2172, 2193, 2184, 2195, 2183, 2180,
-     2180, 2182, 2196, 2194, 2186, 2182, 2194, 2188, 2199, 2200,
-     2229,    0, 2198, 2243, 2199, 2208, 2209, 2276, 2200, 2203,
-     2207, 2218, 2205, 2205, 2225, 2208, 2208, 2219, 2217, 2222,
-     2219, 2231,    0,    0, 2252, 2253, 2239, 2250, 2252, 2259,
-        0, 2244,    0, 2247, 2261,    0, 2258, 2263, 2264, 2263,
-     2354, 2267, 2256, 2252, 2260, 2257, 2262, 2256, 2272, 6873,
-     2279, 2332, 2341, 2334, 2341, 2334, 6873, 2377, 6873, 6873,
-     6873, 2344,    0, 2343, 2350, 2350, 2351, 2346, 2344, 2362,
-
-     2365, 2370, 2369, 6873, 6873, 2355, 2366, 2361, 2369, 2367,
-     2367, 2394, 6873, 2412, 2410, 6873, 2378, 2358, 2371, 6873,
-     2442, 2423, 6873, 6873, 2380, 2411, 2387, 2420, 2388, 2388,
-     2394, 2385, 2395, 2412, 2399, 2443, 2428, 2425, 2432, 2425,
-     2431, 6873, 6873, 2441, 2440, 2435, 2437, 6873, 2440, 2453,
-     2446, 2458, 2464, 2455, 2455, 2456, 2457, 2467, 2470, 2472,
-     2475, 2460, 2461, 2470, 2471, 2467, 2464, 2469, 2466, 2482,
-     2468, 2486, 2485,    0,    0, 2470, 2481, 2476, 2484, 2482,
-     2482, 2509,    0, 2547, 2522,    0, 2493, 2473, 2482, 2575,
-     2564,    0,    0, 2494, 2526, 2503, 2523, 2501, 2515, 2520,
-
-     2512, 2513, 2531, 2515, 2556, 2538, 2533, 2540, 2532, 2542,
-        0,    0, 2549, 2548, 2552, 2553,    0, 2555, 2568, 2551,
-     2563, 2569, 2561, 2562, 2563, 2564, 2575, 2578, 2582, 2585,
-     2570, 2571, 2580, 2581, 6873, 2590, 2573, 2579, 2583, 2590,
-     2578, 2596, 6873, 2589, 6873, 2584, 2608, 2596, 2602, 6873,
-     2607, 6873, 6873, 2599, 2590, 2611, 2611, 2616, 2604, 2610,
-     2615, 6873, 2610, 2607, 2609, 2607, 2611, 2612, 2624, 2624,
-     2610, 2611, 2610, 2621, 2618, 2620, 2618, 2622, 2634, 2634,
-     2637, 2626, 2637, 2643, 2643, 2652, 6873, 2641, 2638, 2677,
-     2652, 2656, 2651, 2642, 2644, 2651, 2650, 2646, 2652, 2661,
-
-     2654, 2665, 2650, 2662, 2648, 2671, 2656, 2653, 2671, 2672,
-     2664, 2699, 2672, 2665, 2662, 2669, 2682, 2684, 2683, 2674,
-     2693, 2679, 2695, 2681, 2690, 6873,    0, 2687, 2678, 2699,
-     2699, 2704, 2692, 2698, 2703,    0, 2698, 2695, 2697, 2695,
-     2699, 2700, 2712, 2712, 2698, 2699, 2698, 2709, 2706, 2708,
-     2706, 2710, 2722, 2722, 2734, 2723, 2725, 2731, 2731, 2740,
-        0, 2729, 2726, 2765, 2740, 2744, 2739, 2730, 2732, 2739,
-     2738, 2734, 2740, 2749, 2742, 2753, 2738, 2750, 2736, 2759,
-     2744, 2741, 2759, 2760, 2752, 2787, 2760, 2753, 2750, 2766,
-     2779, 2772, 2771, 2762, 2765, 6873, 2772, 2781, 2783, 2770,
-
-     2777, 6873, 2789, 2772, 2770, 2792, 6873, 2781, 2784, 2785,
-     2781, 2779, 2795, 2781, 2787, 2801, 2824, 2797, 2791, 2787,
-     2804, 2793, 2794, 2786, 2810, 2803, 2814, 2837, 2810, 2804,
-     2816, 2814, 2815, 2811, 2826, 2854, 2829, 2824, 2817, 6873,
-     2858, 2830, 2838, 6873, 6873, 2822, 6873, 2827, 2818, 2824,
-     2855, 2832, 2845, 2833, 2834, 2844, 6873, 2831, 2837, 2850,
-     2851, 6873, 2841, 2836, 2843, 2858, 2855, 2853, 2846, 2843,
-     2860, 2857, 2857, 6873, 2858, 6873, 2865, 2868, 2869, 2865,
-     2863, 2879, 2865, 2871, 2885, 2908, 2881, 2875, 2871, 2888,
-     2877, 2878, 2870, 2894, 2887, 2896, 2919, 2892, 2886, 2898,
-
-     2887, 2888, 2884, 2899, 2927, 2902, 2897, 2890,    0, 2931,
-     2905, 2913,    0,    0, 2897,    0, 2902, 2893, 2908, 2956,
-     2916, 2929, 2918, 2919, 2929,    0, 2916, 2923, 2936, 2937,
-        0, 2927, 2922, 2929, 2944, 2942, 2940, 2933, 2928, 2945,
-     2942, 2947, 6873, 2949, 6873, 6873, 2949, 2935, 2953, 2944,
-     2947, 2946, 2957, 2958, 2944, 2956, 6873, 2942, 2956, 2960,
-     6873, 2999, 2960, 2979, 2971, 2967, 2981, 2981, 2968, 6873,
-     3007, 2968, 2978, 2970, 2984, 2983, 2989, 2988, 2986, 2994,
-     2991, 2986, 2987, 2977, 6873, 2982, 3012, 3014, 3003, 2993,
-     2995, 3004, 2991, 3006, 2993, 2993, 2994, 3010, 3022, 3022,
-
-     3008, 3022, 3011, 3025, 6873, 3022, 3025, 3022, 3021, 3030,
-     3031, 3017, 3029,    0, 3015, 3020, 3024,    0, 3063, 3024,
-     3043, 3035, 3031, 3045, 3045, 3032,    0, 3071, 3032, 3042,
-     3034, 3048, 3047, 3053, 3052, 3052, 3073, 3056, 3051, 3052,
-     3042,    0, 3057, 3104, 3105, 3077, 3070, 3072, 3083, 3070,
-     3083, 3070, 3070, 3071, 3087, 3092, 3092, 3078, 3092, 3081,
-     3095,    0, 3092, 3095, 3092, 6873, 6873, 6873, 3085, 3097,
-     6873, 3097, 3111, 3104, 3129, 3114, 3118, 6873, 3102, 3110,
-     6873, 3109, 3105, 3120, 3121, 6873, 3122, 3116, 6873, 3115,
-     3125, 3126, 6873, 3127, 3123, 6873, 6873, 3130, 3130, 3113,
-
-     3125, 6873, 6873, 3138, 3150, 3151, 3129, 3137, 6873, 3129,
-     3135,    0, 3126, 3140, 3141, 3145, 3134, 3144, 3151, 3152,
-     3143, 6873, 3152, 3159, 3160, 3161, 3154, 3196, 3164, 3168,
-        0, 3153, 3161,    0, 3160, 3156, 3172, 3173,    0, 3174,
-     3168,    0, 3167, 3177, 3178,    0, 3179, 3176,    0,    0,
-     3183, 3183, 3166, 3178,    0,    0, 3191, 3230, 3231, 3180,
-     3199,    0, 3193, 3199, 3237, 3194, 3208, 3209, 3213, 3203,
-     3206, 3213, 3214, 3205,    0, 3214, 3221, 3222, 3220, 6873,
-     3210, 3227, 3230, 3243, 3244, 3216, 3226, 6873, 3259, 3236,
-     3232, 3227, 6873, 3242, 3280, 3257, 3242, 3283, 3240, 6873,
-
-     3285, 3244, 3289, 6873, 3268, 3265, 6873, 3260, 3253, 3263,
-     3263,    0, 3257, 6873, 6873, 3276, 3265, 6873, 3274, 3276,
-     3274, 3280, 3283, 3321, 3342, 3267, 3277,    0, 3308, 3285,
-     3280, 3271,    0, 3281, 3336, 3313, 3299, 3340, 3300,    0,
-     3345, 3302, 3347,    0, 3326, 3323,    0, 3318, 3311, 3322,
-     3322, 3363, 3317,    0,    0, 3336, 3326,    0, 3335, 3338,
-     3337, 6873, 3321, 3336, 3344, 3368, 3369, 3340, 3349, 6873,
-     3347, 3348, 3362, 6873, 3350, 3364, 3387, 3359, 6873, 3367,
-     3366, 6873, 3369, 3366, 3372, 3366, 3370, 3357, 6873, 3359,
-     3379, 3373, 6873, 3376, 3363, 3371, 3426, 3427, 3365, 3374,
-
-        0, 3372, 3373, 3387,    0, 3386, 3402, 3425, 3397,    0,
-     3407, 3406,    0, 3410, 3407, 3412, 3406, 3412, 3399,    0,
-     3401, 3421, 3415,    0, 3418, 6873, 6873, 3419, 3407, 3417,
-     3416, 3415, 3417, 3419, 3427, 3436, 3441, 3438, 3433, 3442,
-     3444, 3423, 3425, 3432, 6873, 3447, 3447, 3447, 3431, 3449,
-     3451,    0, 3451, 3439, 3449, 3448, 3447, 3449, 3451, 3459,
-     3459, 3464, 3461, 3456, 3465, 3467, 3446, 3448, 3455,    0,
-     3470, 3470, 3473, 3458, 3476, 3478, 6873, 6873, 3464, 6873,
-     6873, 3497, 6873, 3524, 3481, 3494, 3483, 3496, 3503, 3498,
-     6873, 6873, 3496, 3496, 3497, 6873, 3512, 3510, 6873,    0,
-
-        0, 3496,    0,    0, 3511,    0, 3538, 3495, 3508, 3497,
-     3510, 3517, 3512,    0,    0, 3510, 3510, 3511,    0, 3526,
-     3524,    0, 3505, 6873, 3522, 6873, 3520, 6873, 6873, 3514,
-     3528, 3515, 6873, 3526, 3521,    0, 3538,    0, 3536,    0,
-        0, 3530, 3547, 3534,    0, 3545, 6873, 3550, 6873, 3538,
-     6873, 3552, 3553,    0, 3568,    0, 3556,    0, 3556, 3557,
-     3554, 6873, 3567, 6873, 3556,    0, 3569,    0, 6873, 3576,
-        0, 3577, 6873,    0, 6873, 5071, 5083, 5095, 5107, 5119,
-     5131, 5143, 5155, 5167, 5179, 5191, 5203, 5215, 5227, 5239,
-     5251, 5263, 5275, 5287, 5299, 5303, 5315, 5327, 5339, 5351,
-
-     5357, 5369, 5381, 5393, 5405, 5417, 5429, 5441, 5453, 5465,
-     5477, 5489, 5501, 5513, 5525, 5537, 5549, 5561, 5573, 5585,
-     5597, 5609, 5621, 5633, 5645, 5657, 5669, 5681, 5693, 5705,
-     5717, 5729, 5741, 5753, 5765, 5777, 5784, 5796, 5808, 5820,
-     5832, 5844, 5848, 5852, 5863, 5875, 5887, 5899, 5905, 5917,
-     5929, 5941, 5953, 5965, 5977, 5989, 6001, 6013, 6025, 6037,
-     6049, 6061, 6073, 6085, 6097, 6109, 6121, 6133, 6145, 6157,
-     6169, 6181, 6193, 6205, 6217, 6229, 6241, 6253, 6265, 6277,
-     6289, 6301, 6313, 6325, 6337, 6349, 6361, 6373, 6385, 6397,
-     6409, 6421, 6433, 6445, 6457, 6469, 6481, 6493, 6500, 6512,
-
-     6524, 6536, 6548, 6560, 6572, 6584, 6596, 6608, 6620, 6632,
-     6644, 6656, 6668, 6680, 6692, 6704, 6716, 6728, 6740, 6752,
-     6764, 6776, 6788, 6800, 6812, 6824, 6836, 6848, 6860
+      404,  410, 2475, 2529,  198,  409, 4585, 6873,   65, 6873,
+
+     4563,    0,   28,  160,  447, 4562, 6873, 4561, 4578, 4539,
+      311,  428,  164,  126, 4532,  446,  183,  188,  462,  468,
+      212,  256,  254,  469,  124,  262, 4539, 4542, 4541, 6873,
+      477,  571,  476,  310,  313,  406,  573,    0, 4554,  604,
+      288, 2575,  610,    0, 4553,    0, 4552, 4569, 4530,  625,
+      591,  267,  424,  172,  610,  474,  401,  628,  572,  463,
+      408,  596,  639,  317,  408, 4531, 4534, 4533,    0,  637,
+      672,  640,  436,  598,  680,  561,  681,  644,  687, 6873,
+     4528, 4508, 4517,    0,  586,    0, 2618,  724, 4547,    0,
+     4505,  139, 4501, 4500, 4510, 4533,    0,  677, 2661,  753,
+
+     4538,    0, 4484, 4497,    0, 4481, 4480, 4483, 4495, 4489,
+     4476, 4474, 4478, 4476,    0,  724, 2704,  763, 4517,    0,
+        0,  783, 2747,  778, 4516,    0,    0,  802, 2790,  817,
+     4515,    0, 4486, 4483, 4472, 4467, 4469, 4479, 4480, 4471,
+     4461,  625,  817, 2839, 4455,  695,  641,  675,  818, 2888,
+     4454,  779,  725, 4472,  767,  837, 2937, 4452,  821,  778,
+      833,  839, 2986, 4451,  842,  841,  843,  870, 3035, 4450,
+      871,  868,  872,  877, 3084, 4449,  875,  878,    0,  883,
+     3127,  915, 4474, 4497,    0,    0,  893, 3170,  925, 4496,
+        0,    0,  945, 3213,  940, 4495,    0, 4439, 4449, 4442,
+
+     4454, 4439, 4450, 4448, 3266, 3321,    0,  964, 3366,  979,
+     4478,    0,    0,  979, 3409,  988, 4453, 4476,    0, 4435,
+      646, 4434, 4441,    0, 1005, 3452, 1023, 4472,    0, 4429,
+     4429, 4433, 4431,    0,    0,  718, 4461,    0, 4419, 4418,
+     4423, 4422,    0,    0, 3504, 4453,    0, 4412, 4419,  748,
+     6873,    0, 4418, 4417,  255, 1033,    0, 6873, 4420,  850,
+     4407, 4405, 4398, 4411, 4405, 4404,  484, 4392, 4409, 4409,
+     4392, 4389, 4393, 4392, 4387, 4389, 4385, 4383, 4382, 4399,
+     4397,  267, 4375, 4378, 4383, 4392, 4381,  706, 4379, 1024,
+     4372, 4379, 4372, 4386, 4385, 4375, 6873, 4371, 4380, 4383,
+
+     4374, 4355, 1057, 4361, 4360, 4356, 4368, 4352, 4351, 4350,
+     4354, 4344,  801, 4341, 4357,    0,    0, 1051, 4354, 4353,
+     6873, 3513, 1095, 3556, 4356,  858, 4343, 4341, 4334, 4349,
+     4343, 4342,  679, 4324, 4341, 4341, 4324, 4321, 4322, 4320,
+     4320, 4315, 4317, 4313, 4311, 4310, 4309, 4326, 4324,  553,
+     4300, 4303, 4308, 4317, 4306,  857, 4304, 1026, 4297, 4304,
+     4297, 4311, 4310, 4300,    0, 4296, 4305, 4308, 4299, 4289,
+     4292, 4296, 4286,  858, 4283, 4299, 4283, 4283, 4281, 4285,
+     4284, 4281,    0,  943,    0, 3582, 1103, 3625, 4282, 4275,
+     4275, 4275, 4277, 4266, 6873, 4301,    0, 1126, 3651, 1141,
+
+     3694, 4262, 4263,    0, 4273, 4256, 4260, 4260, 4268, 4265,
+     4250, 4265, 4254,    0, 1141, 3720, 1150, 3763,    0, 1167,
+     3789, 1185, 3832,    0, 1202, 3858, 1197, 3901, 4248, 4257,
+     4240, 4249, 4244, 4248, 4257, 4247, 4249,  941,    0, 1215,
+     4279, 3933, 4227, 3976,  963,    0, 1217, 4277, 4025, 4225,
+     4068, 4243, 1003,    0, 1221, 4271, 4117, 4219, 4160, 1004,
+        0, 1248, 4269, 4209, 4217, 4252, 1047,    0, 1249, 4267,
+     4301, 4215, 4344, 1049,    0, 1250, 4265, 4393, 4213, 4436,
+        0, 1255, 4479, 1264, 4522, 4237,    0, 1288, 4548, 1303,
+     4591,    0, 1303, 4617, 1312, 4660, 4214, 4226, 4226, 4219,
+
+     4207, 4212, 4211,    0, 4696,    0, 4751,    0, 1329, 4796,
+     1347, 4839,    0, 1364, 4865, 1359, 4908, 4227, 4200, 4218,
+     4209, 4202, 4203,    0, 1377, 4934, 1373, 4977, 6873, 4216,
+     4203, 4202,    0,    0,  983, 6873,  861, 4209, 4199,    0,
+     5012,    0, 4190, 4196, 4209, 4198, 4193, 4204, 4204, 4203,
+     4203, 4192, 4203, 4192, 4197,  969, 4188, 6873, 4180, 4193,
+     4175, 4183, 4175, 4166, 4184, 4167, 4162, 4175, 4170, 4163,
+     4155, 4175,  806, 4169, 4166, 4164, 4165, 4166, 1055, 4152,
+     1014, 4158, 4159, 4153, 4141, 4154, 4140, 4147, 4148, 4147,
+     4172, 4133, 6873, 4142, 6873, 4134, 4138, 4128, 4127, 4124,
+
+     4140, 4139, 4134, 4119, 4119, 4117, 4125, 4131, 4120, 4115,
+     4126, 4126, 4125, 4125, 4114, 4125, 4114, 4119, 1046, 4110,
+        0, 4102, 4115, 4106, 4114, 4106, 4128, 4096, 4114, 4099,
+     4094, 4097, 4106, 4101, 4094, 4086, 4106,  915, 4091, 4088,
+     4086, 4087, 4088, 1084, 4072, 1043, 4078, 4079, 4073, 4067,
+     4080, 4066, 4073, 4074, 4076, 4101, 4062,    0, 4071,    0,
+     4074, 4071, 4056, 4050, 4048, 4056, 4046, 4045, 4041, 4055,
+     4045,  587, 4044, 4055, 4052, 4040, 4038, 4043, 4037, 4071,
+     4046, 4045, 4040,    0, 4056, 4026, 4027, 4031, 4025, 4029,
+     4033, 6873, 4025, 4017, 6873, 4025, 4029, 4032, 4017, 4037,
+
+     4052, 4026, 4015, 4022,  410, 6873, 6873, 4032, 6873, 4024,
+     4018, 4018, 4010, 4011, 6873, 6873, 4011, 4011, 4004, 3997,
+     6873, 4013, 3994, 4001, 3992, 3980, 3980, 6873, 3991, 3995,
+     3977, 3992, 3982, 3993, 3992, 3987, 3984, 3971, 3972, 1051,
+     6873, 3973, 3972, 3962,  947, 3968, 3972, 4004, 3959, 3964,
+     6873, 3954, 3972, 3958, 3949, 3949, 6873, 3948, 3960, 6873,
+     3950, 3939, 3950, 3944, 3949, 3954, 1139, 3949,  868, 3941,
+     3940,  773, 3974, 3944, 3948, 3945, 3930, 3930, 3928, 3936,
+     3935, 3931,  979, 6873, 3938, 1030, 3921, 3937, 3928, 3916,
+     3916,    0, 3927, 3933, 3915, 3930, 3920, 3931, 3930, 3925,
+
+     3922, 3909, 3910, 1079,    0, 3946, 3910, 3909, 3899, 1109,
+     3896, 3900, 3932, 3893, 3898,    0, 3881, 3899, 3885, 3879,
+     3879,    0, 3875, 3887,    0, 3877, 3866, 3868, 3862,   21,
+       59, 1216,  177, 1181,  216,  293, 1137,  349,  430,  468,
+      476, 1111,    0,  578, 1190, 1141, 6873, 1223,  614,  664,
+      684,  698,  717, 6873,  743,  761,  816,  843,  867, 1042,
+      865,  899, 6873, 1099,  935,  927,  957,  965, 6873, 6873,
+      986, 6873, 1003, 6873, 1051, 1059, 1244, 1082, 1136, 1133,
+     1127, 6873, 6873, 6873, 1157, 1138, 1167, 1181, 1192, 1193,
+     1181, 1204, 1209, 1229, 1220, 1410, 1414, 1257, 1225, 1232,
+
+     6873, 1237, 1224, 1274, 1235, 1245, 1245, 1271, 6873, 1298,
+     1268, 1262, 1268, 6873, 1273, 1297, 1302, 1301, 1293, 1302,
+     5001, 1307, 1308, 1297, 1308, 1334, 1334, 1332, 1346, 1345,
+     1365, 1355, 6873, 1366, 1351, 1411, 1374, 1379, 1380, 1376,
+     1384, 1379, 1378, 1386, 1387, 1391, 1386, 1397, 1395, 1400,
+     6873, 1405, 1394, 6873, 1394, 1411, 1435, 1441, 1465, 1469,
+     1476, 1405, 1413,    0, 1420, 1407, 1457, 1427, 1434, 1430,
+     1447,    0, 1474, 1446, 1441, 1447, 1481,    0, 1453, 1458,
+     1463, 1461, 1453, 1462, 5021, 1467, 1465, 1451, 1465, 1472,
+     1464, 1461, 1475, 1473, 1488, 1477,    0, 1488, 1473, 1516,
+
+     1478, 1483, 1484, 1481, 1489, 1484, 1483, 1490, 1491, 1495,
+     1488,    0, 1490, 1507, 1533, 1538, 1510, 1512, 1512, 1515,
+     1501, 1505, 1518, 1509, 6873, 1506, 1518, 6873, 1519, 1517,
+     1513, 1524, 1541, 1516, 1562, 1545, 1526, 1548, 1531, 1548,
+     1536, 1551, 1577, 1569,    0, 1542, 1543, 1550,    0, 6873,
+     1559, 1547, 1547, 1547, 1553, 1551, 1560, 1553, 1552, 1626,
+     6873, 1636, 6873, 1569, 1570, 1566, 1572, 6873, 1569, 1601,
+     1575, 1578, 1575, 1567, 1602, 1590, 1596, 1605, 1633, 1590,
+     1613, 6873, 1613, 1618, 1606, 1602, 1622, 1619, 1622, 1617,
+     1611, 1624, 1626, 1617, 1635, 1615, 1623, 1627, 1627, 1641,
+
+     6873, 1637, 1654, 1639, 1636, 1644, 1642, 1657, 1657, 6873,
+     1662, 1647, 1652,    0, 1661, 1648, 1649, 1656, 1653, 1662,
+     1658, 1656, 1661, 6873, 1656, 1672, 6873, 1702, 1704, 1703,
+     1706, 1737,    0, 1745,    0, 1676, 1678, 1674, 1680,    0,
+     1677, 1712, 1683, 1686, 1683, 1675, 1710, 1692, 1705, 1721,
+        0, 1744, 1701, 1724,    0, 1727, 1716, 1712, 1732, 1730,
+     1732, 1727, 1721, 1734, 1736, 1730, 1743, 1732, 1735, 1746,
+     1747, 1752,    0, 1747, 1764, 1749, 1746, 1754, 1753, 1768,
+     1767,    0, 1772, 1757, 1762, 1804, 1772, 1759, 1761, 1768,
+     1765, 1774, 1771, 1769, 1774,    0, 1813, 1814, 1775, 1772,
+
+     1778, 1782, 1775, 1785, 1799, 1788, 1785, 1803, 1806, 6873,
+     1811, 1793, 1813, 6873, 1807, 1838, 1800, 1811,    0, 1823,
+     6873, 1846,    0, 1810, 1823, 1820, 1817,    0, 1826, 1823,
+     1815, 6873, 1817, 6873, 1834, 1817, 6873, 1836, 1821, 1820,
+     1861, 1830, 1841, 1838, 1830, 1841, 6873, 1845, 1829,    0,
+     1955, 1950, 1955, 1973, 1962, 1960, 1974, 1969, 1961, 1963,
+     1965, 1967, 1969, 1986, 1977, 1979, 1978, 1988, 1989, 1978,
+     1979, 1986, 1987, 2020, 1988, 1981, 6873, 6873, 1987, 1982,
+     1995, 1994, 1992, 1988, 1993, 1997, 1991, 2032, 2003, 1997,
+     6873, 2039, 2009, 2013, 2031, 2015, 2026, 2021, 2062, 2063,
+
+     2072, 2073, 2028, 2039, 2041, 2026, 2025, 2066, 2035, 2048,
+     2046, 2038, 2048,    0, 2052, 2036, 2084, 2050, 2044, 2049,
+        0, 2084, 2056, 2054, 2052, 2045, 2047, 2051, 2054, 2059,
+     2084, 2078, 2081, 2079, 2091, 2092, 2081, 2082, 2089, 2090,
+     2124, 2092, 2085,    0,    0, 2091, 2086, 2099, 2098, 2096,
+     2092, 2097, 2101, 2095, 2137, 2100, 2100,    0, 2141, 2111,
+     2107, 2126, 2110, 2121, 2125, 2130, 6873, 2139, 2119, 6873,
+     2139, 2127, 6873, 2146, 2146, 6873, 2133, 6873, 2134, 2147,
+        0, 2168, 2150,    0, 2144,    0, 2143, 2143, 2141, 2150,
+     2148, 2143, 2162, 6873, 2145, 6873, 2146, 2148, 2162, 2160,
+
+     2151, 2159, 2148, 2152, 2161, 2155, 2169, 2171, 2201, 6873,
+     2170, 2222, 2171, 2193, 2194, 2198, 2197, 2181, 2233, 2190,
+     2193, 2199, 2209, 2196, 2196, 2216, 2199, 2199, 2205, 2202,
+     2208, 2205, 2204, 6873, 6873, 2247, 2225, 2208, 2219, 2223,
+     2231, 6873, 2217, 6873, 2220, 2233, 6873, 2240, 2245, 2248,
+     2246, 2253, 2255, 2244, 2241, 2249, 2244, 2250, 2257, 2268,
+     2259, 2270, 2259, 2256, 2256, 2258, 2272, 2270, 2261, 2269,
+     2258, 2262, 2329, 2324, 2336, 2337, 2366,    0, 2344, 2386,
+     2349, 2358, 2359, 2365, 2363, 2397, 2354, 2357, 2363, 2373,
+     2360, 2360, 2380, 2363, 2363, 2369, 2366, 2372, 2369, 2368,
+
+        0,    0, 2410, 2389, 2372, 2386, 2388, 2396,    0, 2381,
+        0, 2384, 2407,    0, 2404, 2410, 2412, 2411, 2418, 2419,
+     2408, 2404, 2413, 2408, 2413, 2408, 2424, 6873, 2431, 2426,
+     2434, 2427, 2434, 2427, 6873, 2460, 6873, 6873, 6873, 2427,
+        0, 2426, 2433, 2433, 2436, 2432, 2429, 2447, 2460, 2465,
+     2464, 6873, 6873, 2449, 2460, 2467, 2453, 2457, 2465, 2464,
+     2465, 2492, 6873, 2507, 2518, 6873, 2480, 2461, 2469, 2486,
+     2509, 6873, 2518, 2530, 6873, 6873, 2480, 2515, 2491, 2517,
+     2490, 2489, 2494, 2488, 2488, 2507, 2502, 2543, 2519, 2514,
+     2521, 2516, 2525, 6873, 6873, 2537, 2537, 2529, 2530, 6873,
+
+     2533, 2546, 2532, 2544, 2550, 2551, 2551, 2552, 2553, 2563,
+     2566, 2567, 2570, 2555, 2556, 2565, 2566, 2562, 2559, 2564,
+     2561, 2577, 2563, 2581, 2580,    0,    0, 2565, 2576, 2604,
+     2568, 2572, 2580, 2578, 2578, 2605,    0, 2620, 2607,    0,
+     2593, 2573, 2593, 2610, 2633, 2661, 2650,    0,    0, 2605,
+     2636, 2613, 2617, 2612, 2619, 2624, 2615, 2614, 2636, 2619,
+     2660, 2635, 2641, 2648, 2640, 2646,    0,    0, 2653, 2652,
+     2644, 2646,    0, 2649, 2662, 2645, 2658, 2664, 2658, 2658,
+     2659, 2660, 2670, 2673, 2674, 2677, 2662, 2663, 2672, 2673,
+     6873, 2682, 2674, 2680, 2684, 2691, 2679, 2697, 6873, 2681,
+
+     6873, 2676, 2700, 2688, 2694, 6873, 2699, 6873, 6873, 2691,
+     2682, 2694, 2697, 2705, 2705, 2706, 2711, 2699, 2705, 2710,
+     6873, 2705, 2702, 2704, 2702, 2706, 2707, 2719, 2719, 2705,
+     2706, 2705, 2725, 2732, 2727, 2724, 2726, 2724, 2728, 2740,
+     2740, 2743, 2732, 2734, 2740, 2740, 2749, 6873, 2739, 2736,
+     2775, 2750, 2754, 2749, 2740, 2742, 2749, 2748, 2744, 2750,
+     2759, 2752, 2763, 2748, 2760, 2746, 2778, 2763, 2760, 2778,
+     2779, 2771, 2806, 2779, 2772, 2769, 2776, 2789, 2782, 2781,
+     2772, 2791, 2777, 2793, 2779, 2788, 6873,    0, 2785, 2776,
+     2788, 2791, 2799, 2799, 2800, 2805, 2793, 2799, 2804,    0,
+
+     2799, 2796, 2798, 2798, 2802, 2803, 2815, 2815, 2810, 2811,
+     2810, 2821, 2828, 2823, 2820, 2822, 2820, 2824, 2836, 2836,
+     2839, 2828, 2830, 2836, 2836, 2845,    0, 2835, 2832, 2871,
+     2846, 2850, 2845, 2836, 2838, 2845, 2844, 2840, 2846, 2855,
+     2848, 2861, 2846, 2858, 2844, 2867, 2861, 2858, 2876, 2877,
+     2869, 2904, 2877, 2870, 2867, 2874, 2887, 2880, 2879, 2870,
+     2873, 6873, 2880, 2889, 2891, 2878, 2885, 6873, 2897, 2880,
+     2878, 2900, 6873, 2889, 2892, 2890, 2896, 2895, 2891, 2893,
+     2890, 2906, 2894, 2900, 2914, 2937, 2910, 2913, 2909, 2926,
+     2915, 2916, 2908, 2932, 2925, 2924, 2923, 2918, 2937, 2960,
+
+     2933, 2927, 2939, 2928, 2929, 2925, 2940, 2968, 2943, 2938,
+     2931, 6873, 2972, 2944, 2952, 6873, 6873, 2936, 6873, 2941,
+     2932, 2938, 2969, 2946, 2961, 2949, 2950, 2960, 6873, 2947,
+     2962, 2975, 2976, 6873, 2966, 2961, 2968, 2983, 2980, 2978,
+     2971, 2966, 2983, 2980, 2980, 6873, 2981, 6873, 2979, 2982,
+     2980, 2986, 2985, 2981, 2983, 2980, 2996, 2982, 2988, 3002,
+     3025, 2998, 2992, 2988, 3005, 2996, 2997, 2989, 3013, 3006,
+     3014, 3013, 3008, 3027, 3050, 3023, 3017, 3029, 3018, 3019,
+     3015, 3030, 3058, 3033, 3028, 3021,    0, 3062, 3034, 3042,
+        0,    0, 3026,    0, 3031, 3022, 3028, 3102, 3035, 3048,
+
+     3036, 3037, 3047,    0, 3034, 3040, 3053, 3054,    0, 3044,
+     3041, 3048, 3063, 3060, 3068, 3061, 3057, 3074, 3071, 3076,
+     6873, 3079, 6873, 6873, 3079, 3065, 3083, 3074, 3077, 3076,
+     3085, 3079, 3088, 3089, 3075, 3082, 3088, 6873, 3074, 3079,
+     3083, 6873, 3122, 3083, 3102, 3094, 3090, 3104, 3113, 3099,
+     3099, 3108, 3103, 6873, 3142, 3103, 3113, 3105, 3119, 3118,
+     3124, 3123, 3121, 3129, 3126, 3121, 3122, 3112, 6873, 3117,
+     3147, 3149, 3138, 3128, 3130, 3139, 3126, 3139, 3126, 3126,
+     3127, 3143, 3146, 3155, 3141, 3155, 3144, 3158, 6873, 3155,
+     3158, 3155, 3154, 3163, 3156, 3165, 3166, 3152, 3159, 3165,
+
+        0, 3151, 3156, 3160,    0, 3199, 3160, 3179, 3171, 3167,
+     3181, 3181, 3167, 3167, 3176, 3171,    0, 3210, 3171, 3181,
+     3173, 3196, 3195, 3201, 3200, 3198, 3206, 3203, 3198, 3199,
+     3189,    0, 3194, 3241, 3243, 3216, 3207, 3209, 3219, 3207,
+     3220, 3207, 3207, 3208, 3224, 3228, 3229, 3215, 3229, 3220,
+     3234,    0, 3232, 3239, 3244, 6873, 6873, 6873, 3240, 3252,
+     6873, 3252, 3257, 3250, 3259, 3254, 3279, 3264, 3253, 3269,
+     6873, 3253, 3261, 6873, 3260, 3256, 3271, 3272, 6873, 3273,
+     3300, 3263, 3302, 3270, 6873, 3269, 3279, 3280, 6873, 3281,
+     3277, 6873, 6873, 3284, 3284, 3267, 3281, 6873, 6873, 3294,
+
+     3307, 3312, 3298, 3309, 6873, 3301, 3307,    0, 3298, 3312,
+     3313, 3319, 3308, 3309, 3316, 3317, 3308, 6873, 3317, 3324,
+     3325, 3326, 3319, 3328, 3321, 3383, 3330, 3319, 3335,    0,
+     3319, 3327,    0, 3326, 3322, 3337, 3338,    0, 3339, 3366,
+     3339, 3378, 3347,    0, 3346, 3356, 3357,    0, 3359, 3355,
+        0,    0, 3362, 3362, 3345, 3357,    0,    0, 3370, 3399,
+     3426, 3361, 3370,    0, 3362, 3368, 3406, 3361, 3376, 3377,
+     3381, 3370, 3372, 3390, 3391, 3383,    0, 3392, 3399, 3400,
+     3399, 6873, 3389, 3406, 3409, 6873, 3392, 3423, 3424, 3396,
+     3397, 3408, 6873, 3439, 3416, 3411, 3402, 6873, 3409, 3419,
+
+     3415, 3413, 3447, 3424, 3409, 3450, 3407, 6873, 3452, 3418,
+     3463, 6873, 3442, 3439, 6873, 3434, 3427, 3437, 3437,    0,
+     3431, 6873, 6873, 3450, 3439, 6873, 3448, 3450, 3448, 3454,
+     3457,    0, 3440, 3489, 3491, 3442, 3443, 3456,    0, 3488,
+     3465, 3461, 3453,    0, 3460, 3470, 3472, 3470, 3504, 3499,
+     3484, 3525, 3482,    0, 3527, 3484, 3529,    0, 3508, 3505,
+        0, 3500, 3493, 3503, 3503, 3544, 3498,    0,    0, 3517,
+     3507,    0, 3516, 3519, 3518, 6873, 3502, 3508, 3516, 3511,
+     3541, 3542, 3513, 6873, 3522, 6873, 3520, 3521, 3544, 3541,
+     3542, 3547, 6873, 3538, 3570, 3574, 3546, 6873, 3554, 3569,
+
+     6873, 3572, 3569, 3574, 3568, 3572, 3560, 6873, 3562, 3582,
+     3576, 6873, 3579, 3566, 3574, 3569, 3668, 3669, 3569,    0,
+     3578,    0, 3576, 3577, 3591, 3588, 3589, 3594,    0, 3582,
+     3596, 3619, 3591,    0, 3599, 3598,    0, 3601, 3609, 3614,
+     3608, 3612, 3602,    0, 3604, 3624, 3618,    0, 3637, 6873,
+     6873, 3640, 3667, 3629, 3641, 3640, 3639, 3641, 3643, 3637,
+     3633, 3646, 3649, 3657, 3657, 3662, 3659, 3654, 3663, 3665,
+     3644, 3646, 3653, 6873, 3668, 3668, 3668, 3661, 3679, 3681,
+        0, 3681, 3711, 3673, 3683, 3682, 3681, 3697, 3699, 3693,
+     3689, 3700, 3703, 3711, 3711, 3716, 3713, 3708, 3717, 3719,
+
+     3698, 3700, 3707,    0, 3722, 3722, 3722, 3706, 3724, 3726,
+     6873, 3722, 6873, 3713, 6873, 6873, 3728, 3733, 6873, 6873,
+     6873, 6873, 3757, 3714, 3727, 3717, 3730, 3737, 3741, 6873,
+     6873, 3739, 3739, 3740, 6873, 3758, 3756, 6873,    0, 3769,
+        0, 3742,    0,    0, 3757, 3762,    0,    0,    0,    0,
+     3800, 3757, 3770, 3760, 3773, 3780, 3776,    0,    0, 3774,
+     3774, 3775,    0, 3790, 3788,    0, 3779, 3789, 3790, 3772,
+     6873, 3773, 3790, 6873, 3788, 6873, 6873, 3782, 3796, 3783,
+     6873, 3794, 3790, 3800, 3801, 3783,    0, 3784, 3801,    0,
+     3799,    0,    0, 3793, 3816, 3803,    0, 3814, 6873, 3817,
+
+     3812, 6873, 6873, 3824, 6873, 3812, 6873, 3812, 3813,    0,
+     3840, 3832,    0,    0, 3844,    0, 3832,    0, 3832, 3833,
+     3839, 3834, 3832, 6873, 3845, 6873, 3843, 3838, 3836,    0,
+     3849,    0, 3842, 3857, 6873, 3858, 3845, 3860,    0, 3861,
+     3858, 3850, 6873, 3860, 3852,    0, 3870, 3853, 3872, 3855,
+     3856, 6873, 3857,    0, 3872, 3873, 6873,    0, 6873, 5071,
+     5083, 5095, 5107, 5119, 5131, 5143, 5155, 5167, 5179, 5191,
+     5203, 5215, 5227, 5239, 5251, 5263, 5275, 5287, 5299, 5303,
+     5315, 5327, 5339, 5351, 5357, 5369, 5381, 5393, 5405, 5417,
+     5429, 5441, 5453, 5465, 5477, 5489, 5501, 5513, 5525, 5537,
+
+     5549, 5561, 5573, 5585, 5597, 5609, 5621, 5633, 5645, 5657,
+     5669, 5681, 5693, 5705, 5717, 5729, 5741, 5753, 5765, 5777,
+     5784, 5796, 5808, 5820, 5832, 5844, 5848, 5852, 5863, 5875,
+     5887, 5899, 5905, 5917, 5929, 5941, 5953, 5965, 5977, 5989,
+     6001, 6013, 6025, 6037, 6049, 6061, 6073, 6085, 6097, 6109,
+     6121, 6133, 6145, 6157, 6169, 6181, 6193, 6205, 6217, 6229,
+     6241, 6253, 6265, 6277, 6289, 6301, 6313, 6325, 6337, 6349,
+     6361, 6373, 6385, 6397, 6409, 6421, 6433, 6445, 6457, 6469,
+     6481, 6493, 6500, 6512, 6524, 6536, 6548, 6560, 6572, 6584,
+     6596, 6608, 6620, 6632, 6644, 6656, 6668, 6680, 6692, 6704,
+
+     6716, 6728, 6740, 6752, 6764, 6776, 6788, 6800, 6812, 6824,
+     6836, 6848, 6860
     } ;
 
-static yyconst flex_int16_t yy_def[2730] =
+static yyconst flex_int16_t yy_def[2914] =
     {   0,
-     2575,    1, 2575,    3,    1,    1,    1,    7,    7,    7,
-        7,    7, 2576, 2576,    7,    7, 2575,   17, 2577, 2577,
-        7,    7, 2575,   23,    7,    7,    7,    7,    7,    7,
-     2578, 2578, 2579, 2579, 2580, 2580,    7,    7,    7,    7,
-        7,    7,    7,    7, 2581, 2581, 2582, 2582,    7,    7,
-     2583, 2583, 2584, 2584, 2585, 2585, 2586, 2586, 2587, 2587,
-     2588, 2588, 2589, 2589,    7,    7,    7,    7,    7,    7,
-     2575,   71,    7,    7, 2575,   75, 2590, 2590, 2591, 2591,
-        7,    7, 2592, 2592,    7,    7, 2575,   87, 2593, 2593,
-        7,    7, 2594, 2594,    7,    7, 2575, 2575, 2575, 2575,
-
-     2575, 2595, 2575, 2596, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2597, 2597, 2598, 2597,
-     2597, 2597, 2597, 2597, 2597, 2597, 2597, 2597, 2597, 2597,
-     2597, 2597, 2597, 2597, 2597, 2597, 2597, 2597, 2597, 2597,
-     2597, 2597, 2597, 2597, 2597, 2597, 2597, 2597, 2597, 2597,
-     2597, 2597, 2597, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2599, 2599, 2600, 2599, 2599, 2599, 2599, 2575, 2575,
-     2575, 2575, 2575, 2601, 2602, 2603, 2602, 2602, 2602, 2602,
-
-     2575, 2575, 2604, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2605, 2606, 2605, 2605, 2605, 2605, 2607, 2608,
-     2607, 2607, 2607, 2607, 2609, 2610, 2609, 2609, 2609, 2609,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2611,
-     2612, 2611,  242, 2611, 2611, 2613, 2614, 2613,  248, 2613,
-     2613, 2575, 2615, 2616, 2615,  255, 2615, 2615, 2617, 2618,
-     2617,  261, 2617, 2617, 2619, 2620, 2619,  267, 2619, 2619,
-     2621, 2622, 2621,  273, 2621, 2621, 2623, 2624, 2623, 2623,
-     2623, 2623, 2623, 2625, 2626, 2625, 2625, 2625, 2625, 2627,
-     2628, 2627, 2627, 2627, 2627, 2575, 2575, 2575, 2575, 2575,
-
-     2575, 2575, 2629, 2630, 2631, 2632, 2631, 2631, 2631, 2631,
-     2633, 2634, 2633, 2633, 2633, 2633, 2633, 2575, 2575, 2575,
-     2575, 2635, 2636, 2635, 2635, 2635, 2635, 2575, 2575, 2575,
-     2575, 2637, 2638, 2639, 2638, 2638, 2575, 2575, 2575, 2575,
-     2640, 2640, 2641, 2640, 2640, 2575, 2575, 2575, 2642, 2575,
-     2575, 2643, 2575, 2644, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2645, 2645, 2646, 2645, 2645, 2575, 2645, 2645, 2645, 2645,
-     2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645,
-     2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645,
-     2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645,
-     2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645,
-     2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2575,
-     2575, 2575, 2575, 2575, 2575, 2647, 2647, 2648, 2647, 2647,
-     2647, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2649, 2650,
-     2651, 2650, 2650, 2650, 2575, 2575, 2652, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2575, 2575, 2575, 2653, 2654, 2653, 2653,
-     2653, 2655, 2656, 2655, 2655, 2655, 2657, 2658, 2657, 2657,
-     2657, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2659, 2660, 2661, 2662, 2659,  535,  535, 2663, 2664, 2665,
-     2666, 2663,  542,  542, 2575, 2667, 2668, 2669, 2670, 2667,
-      550,  550, 2671, 2672, 2673, 2674, 2671,  557,  557, 2675,
-     2676, 2677, 2678, 2675,  564,  564, 2679, 2680, 2681, 2682,
-     2679,  571,  571, 2683, 2684, 2683, 2683, 2683, 2683, 2685,
-     2686, 2685, 2685, 2685, 2687, 2688, 2687, 2687, 2687, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2689, 2690, 2691, 2692,
-
-     2693, 2694, 2693, 2693, 2693, 2695, 2696, 2695, 2695, 2695,
-     2695, 2575, 2575, 2575, 2575, 2575, 2697, 2698, 2697, 2697,
-     2697, 2575, 2575, 2575, 2575, 2699, 2700, 2701, 2575, 2575,
-     2575, 2575, 2702, 2703, 2702, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2704, 2704, 2704,
-
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2705, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2683, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2695, 2575, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2683, 2575, 2575, 2575, 2575, 2575, 2575, 2695, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2706,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2704, 2704, 2707,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2575, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2708, 2575, 2575, 2575, 2709, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2710, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2711, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2712, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2713, 2575, 2575,
-     2575, 2708, 2575, 2575, 2575, 2575, 2709, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2714, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2715, 2704,
-     2704, 2704, 2711, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2716, 2575, 2575, 2713, 2575, 2717, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2717, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2575, 2575, 2575, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2718, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2719,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2718, 2720, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2719, 2721, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2722, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2575, 2720, 2720, 2575, 2575, 2575, 2575,
-     2575, 2723, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2704, 2704, 2724, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2721, 2721, 2704,
-     2704, 2704, 2704, 2704, 2725, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2575, 2575,
-     2575, 2575, 2575, 2722, 2726, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2727, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2704, 2704, 2724, 2728, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2729, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2575, 2575, 2575, 2575, 2726, 2726, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2704, 2704, 2728, 2728, 2704, 2704,
-
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2704,
-
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2575, 2575, 2575, 2575, 2704, 2704, 2704, 2704, 2575, 2575,
-     2704, 2704, 2575, 2704,    0, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575
+     2759,    1, 2759,    3,    1,    1,    1,    7,    7,    7,
+        7,    7, 2760, 2760,    7,    7, 2759,   17, 2761, 2761,
+        7,    7, 2759,   23,    7,    7,    7,    7,    7,    7,
+     2762, 2762, 2763, 2763, 2764, 2764,    7,    7,    7,    7,
+        7,    7,    7,    7, 2765, 2765, 2766, 2766,    7,    7,
+     2767, 2767, 2768, 2768, 2769, 2769, 2770, 2770, 2771, 2771,
+     2772, 2772, 2773, 2773,    7,    7,    7,    7,    7,    7,
+     2759,   71,    7,    7, 2759,   75, 2774, 2774, 2775, 2775,
+        7,    7, 2776, 2776,    7,    7, 2759,   87, 2777, 2777,
+        7,    7, 2778, 2778,    7,    7, 2759, 2759, 2759, 2759,
+
+     2759, 2779, 2759, 2780, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2781, 2781, 2782,
+     2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781,
+     2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781,
+     2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781,
+     2781, 2781, 2781, 2781, 2781, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2783, 2783, 2784, 2783, 2783, 2783, 2783,
+     2759, 2759, 2759, 2759, 2759, 2785, 2786, 2787, 2786, 2786,
+
+     2786, 2786, 2759, 2759, 2788, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2789, 2790, 2789, 2789, 2789, 2789,
+     2791, 2792, 2791, 2791, 2791, 2791, 2793, 2794, 2793, 2793,
+     2793, 2793, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2795, 2796, 2795,  244, 2795, 2795, 2797, 2798, 2797,
+      250, 2797, 2797, 2759, 2799, 2800, 2799,  257, 2799, 2799,
+     2801, 2802, 2801,  263, 2801, 2801, 2803, 2804, 2803,  269,
+     2803, 2803, 2805, 2806, 2805,  275, 2805, 2805, 2807, 2808,
+     2807, 2807, 2807, 2807, 2807, 2809, 2810, 2809, 2809, 2809,
+     2809, 2811, 2812, 2811, 2811, 2811, 2811, 2759, 2759, 2759,
+
+     2759, 2759, 2759, 2759, 2813, 2814, 2815, 2816, 2815, 2815,
+     2815, 2815, 2817, 2818, 2817, 2817, 2817, 2817, 2817, 2759,
+     2759, 2759, 2759, 2819, 2820, 2819, 2819, 2819, 2819, 2759,
+     2759, 2759, 2759, 2821, 2822, 2823, 2822, 2822, 2759, 2759,
+     2759, 2759, 2824, 2824, 2825, 2824, 2824, 2759, 2759, 2759,
+     2759, 2826, 2759, 2759, 2827, 2759, 2828, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2829, 2829, 2830, 2829, 2829,
+     2759, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829,
+     2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829,
+     2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829,
+     2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829,
+     2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829,
+     2829, 2829, 2829, 2829, 2829, 2829, 2759, 2759, 2759, 2759,
+     2759, 2759, 2831, 2831, 2832, 2831, 2831, 2831, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2833, 2834, 2835, 2834, 2834,
+
+     2834, 2759, 2759, 2836, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2837, 2838, 2837, 2837, 2837, 2839, 2840,
+     2839, 2839, 2839, 2841, 2842, 2841, 2841, 2841, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2843, 2844, 2845,
+     2846, 2843,  542,  542, 2847, 2848, 2849, 2850, 2847,  549,
+      549, 2759, 2851, 2852, 2853, 2854, 2851,  557,  557, 2855,
+     2856, 2857, 2858, 2855,  564,  564, 2859, 2860, 2861, 2862,
+     2859,  571,  571, 2863, 2864, 2865, 2866, 2863,  578,  578,
+     2867, 2868, 2867, 2867, 2867, 2867, 2869, 2870, 2869, 2869,
+     2869, 2871, 2872, 2871, 2871, 2871, 2759, 2759, 2759, 2759,
+
+     2759, 2759, 2759, 2873, 2874, 2875, 2876, 2877, 2878, 2877,
+     2877, 2877, 2879, 2880, 2879, 2879, 2879, 2879, 2759, 2759,
+     2759, 2759, 2759, 2881, 2882, 2881, 2881, 2881, 2759, 2759,
+     2759, 2759, 2883, 2884, 2885, 2759, 2759, 2759, 2759, 2886,
+     2887, 2886, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2889, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2867,
+
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2879, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2867, 2759, 2759,
+     2759, 2759, 2759, 2759, 2879, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2890, 2759, 2759,
+
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2888, 2888,
+     2891, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2759, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2892, 2759, 2759, 2759, 2893, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2894, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2895, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2896, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2759, 2759,
+
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2897, 2759,
+     2759, 2759, 2892, 2759, 2759, 2759, 2759, 2893, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2898,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+
+     2759, 2759, 2759, 2759, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2899, 2888, 2888, 2888,
+     2895, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2900, 2759, 2759, 2897, 2759, 2901, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2901, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2902, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2903, 2888, 2888,
+
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2902, 2904, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2903, 2905, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2906, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+
+     2904, 2904, 2759, 2759, 2759, 2759, 2759, 2907, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2888, 2888, 2888, 2888, 2908, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2905,
+     2905, 2888, 2888, 2888, 2888, 2888, 2909, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2906, 2910, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2911,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2888,
+     2888, 2888, 2888, 2908, 2912, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2913, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2759, 2759, 2759, 2759, 2759,
+     2910, 2910, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2888, 2888, 2888, 2912, 2912, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2759, 2759,
+
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2888,
+     2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+     2759, 2759, 2759, 2759, 2759, 2759, 2888, 2888, 2888, 2888,
+     2888, 2888, 2759, 2759, 2759, 2759, 2888, 2888, 2888, 2888,
+     2759, 2759, 2759, 2888, 2888, 2888, 2759, 2759, 2888, 2888,
+     2759, 2759, 2888, 2888, 2759, 2888, 2759, 2888,    0, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759
     } ;
 
 static yyconst flex_int16_t yy_nxt[6929] =
@@ -1591,763 +1665,763 @@ static yyconst flex_int16_t yy_nxt[6929] =
       107,  108,   98,   98,   98,   98,   98,   98,  109,   98,
       110,  111,  112,  113,  114,  115,  116,  117,  118,   98,
       119,  120,  121,   98,  122,   98,  123,  124,  125,  126,
-      127,   98,   98,  128,  129,  130,  174,   98,  130,   98,
-       98, 1091,   98,  175,   98,   98,  347,   98,   98,  347,
-      179,  180,  179,  180,  350,  351,  189,  190,  191,  233,
-      201,  201,  192,  231,   98,  131,  132,  210,  181,  232,
-      181,  133,  193, 1093,  202,  202,  233,  211,  134,  212,
-
-      135,  136,  137,   99,  100,  137,   99,  138,  139,  137,
-      140,  137,  141,  142,  142,  142,  142,  142,  142,  142,
-      143,  144,  145,  146,  137,  137,  137,  137,  137,  137,
-      147,  137,  148,  149,  150,  151,  152,  153,  154,  155,
-      156,  137,  157,  158,  159,  137,  160,  137,  161,  162,
-      163,  164,  165,  137,  137,  166,  167,  130,   98,   98,
-      130,  130,  392,   98,  130,   98,   98,  393,   98,  483,
-      352,  348,  368,  189,  190,  191,   98,  484,  369,  192,
-      234,  296,  235,  234,  210,  235,   98,  168,  169,  193,
-      252,  131,  132,  170,  211,   98,  212,  176,   98,  231,
-
-      171,   98,  172,  173,  177,  232,  135,  136,   98,  296,
-      346,   98,  354, 1094,  204,  384,   98,  252,  366,  205,
-     1095,  178,   98,   98,   98,  206,  408,  207,  346,  208,
-      367,  385,  209,   98,   98,   98,   98,   98,   98,   98,
-       98,   98,  385,   98,   98,   98, 1096,   98,   98,   98,
-       98,   98,   98,   98,  374,  375,   98,  183,  100,  670,
-      183,   98,  184,   98,  236,  671,  185,  186,  186,  186,
-      186,  186,  186,  186,  204,   98,   98,  237,  238,  205,
-      299,  239,   98,  300,  187,  206,  382,  207,  386,  208,
-      297,  236,  209,  301,  302,  383,  297,  387,   98,  394,
-
-      298,  414,  415, 1097,  237,  238,  298,  434,  239,  435,
-      188,  183,  100,  395,  183,  299,  184,   98,  300,   98,
-      185,  186,  186,  186,  186,  186,  186,  186,  301,  302,
-       98,  318,   98,  319,  386,  438, 1098,  328,  187,  320,
-      439,  357,  318,  409,  319,  321,  329,  330,  331,  358,
-      320,  359,  328,  663,  360, 1099,  321,  664,  361,  440,
-      441,  329,  330,  331,  188,   98,   99,  100,   98,   99,
+      127,  128,   98,  129,  130,  131,  176,   98,  131,   98,
+       98, 1099,   98,  177,   98,   98,  350,   98,   98,  350,
+      181,  182,  181,  182,  353,  354,  191,  192,  193,  235,
+      203,  203,  194,  233,   98,  132,  133,  212,  183,  234,
+      183,  134,  195, 1100,  204,  204,  235,  213,  135,  214,
+
+      136,  137,  138,   99,  100,  138,   99,  139,  140,  138,
+      141,  138,  142,  143,  143,  143,  143,  143,  143,  143,
+      144,  145,  146,  147,  138,  138,  138,  138,  138,  138,
+      148,  138,  149,  150,  151,  152,  153,  154,  155,  156,
+      157,  138,  158,  159,  160,  138,  161,  138,  162,  163,
+      164,  165,  166,  167,  138,  168,  169,  131,   98,   98,
+      131,  131,  396,   98,  131,   98,   98,  397,   98,  490,
+      355,  351,  371,  191,  192,  193,   98,  491,  372,  194,
+      236,  298,  237,  236,  212,  237,   98,  170,  171,  195,
+      254,  132,  133,  172,  213,   98,  214,  178,  369,  233,
+
+      173,   98,  174,  175,  179,  234,  136,  137,   98,  298,
+      370,   98,  357,  376,  206, 1103,   98,  254,  439,  207,
+      440,  180,   98,   98,   98,  208,  377,  209,  348,  210,
+      378,  379,  211,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,  349,   98,   98,   98,  386,   98,   98,   98,
+       98,   98,   98,   98,   98,  387,   98,  185,  100, 1106,
+      185,   98,  186,   98,  238,  355,  187,  188,  188,  188,
+      188,  188,  188,  188,  206,   98,   98,  239,  240,  207,
+      301,  241,   98,  302,  189,  208,  388,  209,  390,  210,
+      299,  238,  211,  303,  304,  398,  299,  391,   98,  672,
+
+      300,  435,  389,  673,  239,  240,  300,  357,  241,  399,
+      190,  185,  100,  436,  185,  301,  186,   98,  302,   98,
+      187,  188,  188,  188,  188,  188,  188,  188,  303,  304,
+       98,  320,   98,  321,  419,  420, 1107,  330,  189,  322,
+      376,  360,  320,  413,  321,  323,  331,  332,  333,  361,
+      322,  362,  330,  412,  363,  464,  323, 1110,  364,  389,
+      465,  331,  332,  333,  190,   98,   99,  100,   98,   99,
        98,  102,   98,   98,   98,  104,  105,  105,  105,  105,
-      105,  105,  105,   98,   98,   98,   98,  194,  194,  194,
-      194,  194,  194,  109,   98,  194,  194,  194,  194,  194,
-
-      194,  194,  194,  194,  194,  194,  194,  194,  194,  194,
-      194,  194,  194,  194,  194,  194,  194,  194,  194,  129,
-       99,  100,   98,   99,  477,  196,  348,  477,   98,  197,
-      198,  198,  198,  198,  198,  198,  198,   98,  371,  372,
-      348,  349,  337,  430,  349,  338,  339,  199,  337,  349,
-      340,  338,  339,  460, 1100,  431,  340,  352,  353,  353,
-      353,  353,  353,  353,  353,  362,  450,  461,  363,  412,
-      432,  364,  365,  200,   99,  100,  433,   99,  467,  196,
-      648,  649,  451,  197,  198,  198,  198,  198,  198,  198,
-      198,   98,  376,  348,  451,  379,  388,  377,  670,  380,
-
-      389,  199,  378,  357,  695,  709,  710,  348,  381,  390,
-      388,  358,  391,  405,  389,  362,  360, 1101,  406,  458,
-      361,  364,  365,  410,  459, 1102,  391,  200,   98,   99,
+      105,  105,  105,   98,   98,   98,   98,  196,  196,  196,
+      196,  196,  196,  109,   98,  196,  196,  196,  196,  196,
+
+      196,  196,  196,  196,  196,  196,  196,  196,  196,  196,
+      196,  196,  196,  196,  196,  196,  196,  196,  196,  130,
+       99,  100,   98,   99,  983,  198,  984,   98,   98,  199,
+      200,  200,  200,  200,  200,  200,  200,   98,  456,  348,
+      390,  466,  339,  446,  447,  340,  341,  201,  339,  414,
+      342,  340,  341,  349,  457,  467,  342,  355,  356,  356,
+      356,  356,  356,  356,  356,  365,  474, 1111,  366,  417,
+      437,  367,  368,  202,   99,  100,  438,   99,  403,  198,
+      351,  403,  457,  199,  200,  200,  200,  200,  200,  200,
+      200,   98,  374,  375,  351,  380,  351,  454,  383,  392,
+
+      381,  201,  384,  393,  443,  382,  455, 1112,  404,  405,
+      351,  385,  394,  365,  406,  395,  411,  444, 1113,  367,
+      368,  407,  445,  408,  409,  656,  657,  202,   98,   99,
       100,   98,   99,   98,  102,   98,   98,   98,  104,  105,
       105,  105,  105,  105,  105,  105,   98,   98,   98,   98,
-      203,  203,  203,  203,  203,  203,  109,   98,  203,  203,
-      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
-      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
-      203,  203,  129,   99,  100,  726,   99,  398,  214,  727,
-      398, 1103,  215,  216,  216,  216,  216,  216,  216,  216,
-
-       98,  417,  418,  418,  418,  418,  418,  418,  418,  426,
-      217,  421,  427,  412, 1104,  428,  429,  399,  400,  422,
-      448,  423, 1107,  401,  424,  436,  437,  412,  425,  449,
-      402,  445,  403,  404,  452,  446,  218,   99,  100,  733,
-       99, 1108,  214,  453,  447,  734,  215,  216,  216,  216,
-      216,  216,  216,  216,   98,  442,  412,  733,  454,  421,
-      443,  466,  455,  752,  217,  444,  439,  422,  452,  464,
-      412,  456,  424,  384,  457,  426,  425,  468,  465,  532,
-      349,  428,  429,  349,  613,  532,  471,  614, 1111,  385,
-      218,   99,  100,  532,   99, 1112,  220,  349,  408,  532,
-
-      221,  222,  222,  222,  222,  222,  222,  222,   98,  454,
-      539,  471,  349,  455,  385,  349,  347,  477,  223,  347,
-      477,  352,  469, 1113,  539,  457,  479,  480,  480,  480,
-      480,  480,  480,  480,  492,  493,  493,  493,  493,  493,
-      493,  493, 1105, 1106,  224,   99,  100,  805,   99,  349,
-      220,  539,  349,  806,  221,  222,  222,  222,  222,  222,
-      222,  222,   98,  354,  349,  539,  349,  349,  349, 1114,
-      837,  349,  223,  509,  510,  510,  510,  510,  510,  510,
-      510,  349,  514,  515,  515,  515,  515,  515,  515,  515,
-      349,  547,  547,  349,  640,  838, 1115,  847,  224,   99,
-
-      100,  848,   99,  641,  226,  547,  547,  349,  227,  228,
-      228,  228,  228,  228,  228,  228,   98,  519,  520,  520,
-      520,  520,  520,  520,  520,  349,  229,  355,  534,  532,
-      349,  554,  355,  541,  539,  355,  554,  547,  349, 1116,
-      701,  549,  534,  532,  844,  554, 1117,  541,  539,  702,
-      554,  547,  230,   99,  100,  549,   99,  349,  226,  355,
-      556,  554,  227,  228,  228,  228,  228,  228,  228,  228,
-       98,  561,  561,  349,  556,  554,  563,  355,  568,  561,
-      229,  349,  568,  845,  570,  561,  561,  355,  349,  568,
-      563,  349,  568,  561,  349, 1118,  568,  349,  570,  532,
-
-      539,  349, 1020,  568,  349,  349,  230,   99,  100,  349,
-       99,  349,  241,  532,  539, 1021,  242,  243,  243,  243,
-      243,  243,  243,  243,   98,  576,  577,  577,  577,  577,
-      577,  577,  577,  547,  244,  582,  583,  583,  583,  583,
-      583,  583,  583, 1121,  554,  561,  349,  547, 1017,  349,
-      587,  588,  588,  588,  588,  588,  588,  588,  554,  561,
-      245,   99,  100,  349,   99,  349,  241,  568,  349,  907,
-      242,  243,  243,  243,  243,  243,  243,  243,   98, 1122,
-      349,  568,  349,  349,  821, 1018,  900,  822,  244,  603,
-      604,  604,  604,  604,  604,  604,  604,  349,  608,  609,
-
-      609,  609,  609,  609,  609,  609,  349,  883,  908,  349,
-      884,  901, 1123,  910,  245,   99,  100,  911,   99,  966,
-      247,  967, 1124,  349,  248,  249,  249,  249,  249,  249,
-      249,  249,   98,  619,  620,  620,  620,  620,  620,  620,
-      620, 1024,  250,  352,  353,  353,  353,  353,  353,  353,
-      353,  934, 1020, 1025,  673, 1078,  736,  674,  398,  737,
-      349,  398,  994,  349, 1085, 1037,  995,  935,  251,   99,
-      100,  675,   99,  738,  247, 1125, 1086,  349,  248,  249,
-      249,  249,  249,  249,  249,  249,   98, 1054,  399,  400,
-     1126, 1055, 1079, 1127,  401, 1128,  250, 1129, 1119, 1130,
-
-     1131,  402, 1109,  403,  404,  417,  418,  418,  418,  418,
-      418,  418,  418,  479,  480,  480,  480,  480,  480,  480,
-      480, 1110,  251,   99,  100, 1132,   99, 1120,  254, 1133,
-     1134, 1140,  255,  256,  256,  256,  256,  256,  256,  256,
-       98,  492,  493,  493,  493,  493,  493,  493,  493,  349,
-      257, 1081,  349,  509,  510,  510,  510,  510,  510,  510,
-      510, 1141,  349, 1142, 1082,  349,  349,  514,  515,  515,
-      515,  515,  515,  515,  515, 1143,  258,   99,  100,  349,
-       99,  349,  254, 1144,  349, 1145,  255,  256,  256,  256,
-      256,  256,  256,  256,   98, 1146,  349,  349,  349,  534,
-
-      541, 1147, 1081, 1148,  257,  519,  520,  520,  520,  520,
-      520,  520,  520,  534,  541, 1092,  349, 1149,  349,  549,
-      349,  556,  349,  563, 1150,  570, 1151, 1152, 1153, 1154,
-      258,   99,  100,  549,   99,  556,  260,  563, 1157,  570,
-      261,  262,  262,  262,  262,  262,  262,  262,   98,  349,
-     1158, 1170,  349, 1171, 1172, 1173, 1155, 1174,  263,  349,
-      349,  349,  349,  349,  349, 1156,  349,  576,  577,  577,
-      577,  577,  577,  577,  577, 1175,  349,  349,  349, 1176,
-     1177, 1178, 1179, 1180,  264,   99,  100, 1181,   99, 1182,
-      260, 1183, 1184, 1185,  261,  262,  262,  262,  262,  262,
-
-      262,  262,   98,  582,  583,  583,  583,  583,  583,  583,
-      583, 1186,  263,  587,  588,  588,  588,  588,  588,  588,
-      588,  603,  604,  604,  604,  604,  604,  604,  604,  349,
-      349, 1187,  349,  349, 1188, 1189, 1190, 1191,  264,   99,
-      100, 1192,   99, 1030,  266, 1197,  349,  349,  267,  268,
-      268,  268,  268,  268,  268,  268,   98,  608,  609,  609,
-      609,  609,  609,  609,  609, 1198,  269,  619,  620,  620,
-      620,  620,  620,  620,  620, 1199, 1200, 1201, 1135, 1135,
-     1135, 1135, 1137, 1137, 1137, 1137, 1183, 1203, 1202, 1210,
-     1211, 1212,  270,   99,  100, 1136,   99, 1156,  266, 1138,
-
-     1213, 1214,  267,  268,  268,  268,  268,  268,  268,  268,
-       98, 1215, 1193, 1216, 1194, 1139, 1195, 1217, 1139, 1218,
-      269, 1196, 1209, 1139, 1188, 1135, 1135, 1204, 1135, 1219,
-     1220, 1221, 1137, 1137, 1206, 1137, 1222, 1223, 1224, 1225,
-     1226, 1227, 1205, 1239, 1240, 1241,  270,   99,  100, 1207,
-       99, 1242,  272, 1243, 1244, 1245,  273,  274,  274,  274,
-      274,  274,  274,  274,   98, 1246, 1247, 1248, 1249, 1250,
-     1251, 1252, 1253, 1254,  275, 1255, 1256, 1257, 1258, 1259,
-     1260, 1261, 1262, 1266, 1263, 1267, 1264, 1252, 1203, 1155,
-     1202, 1265, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275,
-
-      276,   99,  100, 1276,   99, 1277,  272, 1278, 1279, 1282,
-      273,  274,  274,  274,  274,  274,  274,  274,   98, 1283,
-     1280, 1284, 1285, 1286, 1287, 1257, 1288, 1289,  275, 1281,
-     1290, 1291, 1119, 1293, 1294, 1156, 1295, 1298, 1299, 1300,
-     1301, 1302, 1303, 1304, 1296, 1305, 1135, 1135, 1135, 1135,
-     1306, 1306, 1307, 1308,  276,   99,  100, 1309,   99, 1310,
-      278, 1313, 1314, 1136,  279,  280,  280,  280,  280,  280,
-      280,  280,   98, 1137, 1137, 1137, 1137, 1311,  281, 1315,
-     1316, 1317,  282, 1318, 1319, 1320, 1312, 1321, 1322, 1323,
-     1138, 1324, 1325, 1326, 1327, 1328, 1330, 1331, 1332, 1333,
-
-     1334, 1337, 1335, 1338, 1329, 1339, 1340, 1341,  283,   99,
-      100, 1342,   99, 1343,  278, 1336, 1344, 1345,  279,  280,
-      280,  280,  280,  280,  280,  280,   98, 1346, 1347, 1348,
-     1349, 1350,  281, 1351, 1352, 1354,  282, 1355, 1356, 1357,
-     1358, 1359, 1360, 1361, 1362, 1363, 1364, 1203, 1366, 1369,
-     1135, 1135, 1204, 1135, 1365, 1369, 1203, 1370, 1371, 1372,
-     1373, 1374,  283,   99,  100, 1376,   99, 1205,  285, 1377,
-     1375, 1378,  286,  287,  287,  287,  287,  287,  287,  287,
-       98, 1379, 1311, 1367, 1137, 1137, 1206, 1137, 1380, 1381,
-      288, 1312, 1382, 1384, 1385, 1386, 1368, 1387, 1388, 1389,
-
-     1390, 1207, 1391, 1393, 1394, 1395, 1396, 1397, 1398, 1400,
-     1401, 1392, 1402, 1403, 1404, 1405,  289,   99,  100, 1406,
-       99, 1399,  285, 1407, 1408, 1409,  286,  287,  287,  287,
-      287,  287,  287,  287,   98, 1410, 1411, 1412, 1413, 1414,
-     1415, 1417, 1353, 1418,  288, 1353, 1419, 1420, 1421, 1422,
-     1353, 1423, 1424, 1425, 1366, 1426, 1427, 1428, 1429, 1430,
-     1431, 1432, 1365, 1433, 1434, 1435, 1436, 1437, 1438, 1439,
-      289,   99,  100, 1440,   99, 1441,  291, 1442, 1443, 1445,
-      292,  293,  293,  293,  293,  293,  293,  293,   98, 1446,
-     1374, 1447, 1448, 1449, 1450, 1451, 1452, 1453,  294, 1375,
-
-     1454, 1455, 1456, 1457, 1459, 1460, 1461, 1462, 1463, 1464,
-     1465, 1458, 1466, 1468, 1469, 1470, 1471, 1474, 1475, 1476,
-     1477, 1472, 1478, 1479,  295,   99,  100, 1480,   99, 1473,
-      291, 1481, 1482, 1483,  292,  293,  293,  293,  293,  293,
-      293,  293,   98, 1484, 1485, 1487, 1488, 1489, 1490, 1491,
-     1492, 1493,  294, 1494, 1495, 1496, 1497, 1498, 1499, 1500,
-     1501, 1502, 1503, 1486, 1504, 1505, 1506, 1507, 1508, 1509,
-     1510, 1511, 1512, 1513, 1514, 1365, 1366, 1519,  295,   98,
+      205,  205,  205,  205,  205,  205,  109,   98,  205,  205,
+      205,  205,  205,  205,  205,  205,  205,  205,  205,  205,
+      205,  205,  205,  205,  205,  205,  205,  205,  205,  205,
+      205,  205,  130,   99,  100,  737,   99,  484,  216,  738,
+      484,  376,  217,  218,  218,  218,  218,  218,  218,  218,
+
+       98,  360,  451,  392,  477,  352,  452,  393,  352,  361,
+      219,  410, 1115,  352,  363,  453,  415,  951,  364,  395,
+      422,  423,  423,  423,  423,  423,  423,  423,  431,  539,
+      458,  432,  458,  952,  433,  434,  220,   99,  100,  459,
+       99,  475,  216,  539,  417,  539,  217,  218,  218,  218,
+      218,  218,  218,  218,   98,  426,  441,  442,  417,  539,
+     1119,  448,  417,  427,  219,  428,  449,  426,  429,  460,
+      443,  450,  430,  461,  376,  427,  417,  471,  352,  546,
+      429,  352,  462,  473,  430,  463,  620,  479,  445,  621,
+      220,   99,  100,  546,   99,  352,  222,  358, 1120,  539,
+
+      223,  224,  224,  224,  224,  224,  224,  224,   98,  431,
+      460,  388,  472,  539,  461,  433,  434,  413,  225,  352,
+      719,  720,  352,  476,  478,  352,  463,  389,  352,  546,
+      478, 1121, 1122,  389,  486,  487,  487,  487,  487,  487,
+      487,  487,  352,  546,  226,   99,  100,  679,   99,  350,
+      222, 1123,  350,  680,  223,  224,  224,  224,  224,  224,
+      224,  224,   98,  499,  500,  500,  500,  500,  500,  500,
+      500,  554,  225,  516,  517,  517,  517,  517,  517,  517,
+      517,  358,  554,  546,  352,  554, 1124,  352,  521,  522,
+      522,  522,  522,  522,  522,  522,  554,  546,  226,   99,
+
+      100,  352,   99,  352,  228, 1044,  352, 1125,  229,  230,
+      230,  230,  230,  230,  230,  230,   98, 1045,  352,  352,
+      352,  541,  548,  358,  851,  554,  231,  526,  527,  527,
+      527,  527,  527,  527,  527,  541,  548,  561,  352,  554,
+      352,  556,  679,  563,  358,  561,  561,  568,  705,  852,
+     1126,  561,  232,   99,  100,  556,   99,  563,  228,  561,
+      561,  568,  229,  230,  230,  230,  230,  230,  230,  230,
+       98,  352,  568,  358,  570,  568,  575,  358,  352,  575,
+      231,  577,  575,  648,  352, 1127,  568,  352,  570,  568,
+      575,  711,  649,  575,  352,  577,  575,  352,  744,  744,
+
+      712,  352, 1040,  817,  745,  764,  232,   99,  100,  818,
+       99,  352,  243, 1128, 1131, 1041,  244,  245,  245,  245,
+      245,  245,  245,  245,   98,  583,  584,  584,  584,  584,
+      584,  584,  584,  916,  246,  589,  590,  590,  590,  590,
+      590,  590,  590, 1132,  484,  539,  352,  484, 1135,  352,
+      594,  595,  595,  595,  595,  595,  595,  595,  917,  539,
+      247,   99,  100,  352,   99,  352,  243,  546,  352, 1136,
+      244,  245,  245,  245,  245,  245,  245,  245,   98, 1017,
+      352,  546,  352,  352,  352, 1018, 1137,  352,  246,  610,
+      611,  611,  611,  611,  611,  611,  611,  352,  615,  616,
+
+      616,  616,  616,  616,  616,  616,  352,  554,  561,  352,
+      834, 1017, 1138,  835,  247,   99,  100, 1056,   99, 1139,
+      249,  554,  561,  352,  250,  251,  251,  251,  251,  251,
+      251,  251,   98,  626,  627,  627,  627,  627,  627,  627,
+      627, 1140,  252,  355,  356,  356,  356,  356,  356,  356,
+      356,  568,  352,  575,  682,  352,  747,  683,  403,  748,
+      352,  403,  861,  858, 1040,  568,  862,  575,  253,   99,
+      100,  684,   99,  749,  249, 1129, 1130, 1058,  250,  251,
+      251,  251,  251,  251,  251,  251,   98,  898,  404,  405,
+      899,  926,  923, 1012,  406,  927,  252, 1013, 1141, 1142,
+
+     1145,  407,  859,  408,  409,  422,  423,  423,  423,  423,
+      423,  423,  423,  486,  487,  487,  487,  487,  487,  487,
+      487, 1075,  253,   99,  100, 1076,   99,  352,  256, 1133,
+      352,  924,  257,  258,  258,  258,  258,  258,  258,  258,
+       98, 1081,  352, 1081,  352,  352, 1037, 1082, 1134, 1114,
+      259,  499,  500,  500,  500,  500,  500,  500,  500,  352,
+      516,  517,  517,  517,  517,  517,  517,  517,  352, 1108,
+     1146,  352, 1147, 1017, 1148, 1149,  260,   99,  100, 1117,
+       99, 1109,  256, 1038, 1150,  352,  257,  258,  258,  258,
+      258,  258,  258,  258,   98,  521,  522,  522,  522,  522,
+
+      522,  522,  522,  352,  259, 1151,  352,  526,  527,  527,
+      527,  527,  527,  527,  527, 1104,  352, 1152,  352,  541,
+      352,  548,  352, 1101, 1104,  556, 1153, 1154, 1105, 1155,
+      260,   99,  100,  541,   99,  548,  262, 1116, 1156,  556,
+      263,  264,  264,  264,  264,  264,  264,  264,   98,  352,
+      352,  352,  563,  570,  577, 1017,  352, 1157,  265,  352,
+     1102, 1118, 1143, 1158, 1159, 1165,  563,  570,  577, 1166,
+     1167, 1168, 1169,  352,  583,  584,  584,  584,  584,  584,
+      584,  584, 1170, 1171,  266,   99,  100, 1172,   99,  352,
+      262, 1144,  352, 1173,  263,  264,  264,  264,  264,  264,
+
+      264,  264,   98, 1174,  352, 1175,  352,  352, 1176, 1177,
+     1178, 1179,  265,  589,  590,  590,  590,  590,  590,  590,
+      590,  352,  594,  595,  595,  595,  595,  595,  595,  595,
+      352, 1180, 1181,  352, 1182, 1184, 1185, 1197,  266,   99,
+      100, 1198,   99, 1183,  268, 1199, 1200,  352,  269,  270,
+      270,  270,  270,  270,  270,  270,   98,  610,  611,  611,
+      611,  611,  611,  611,  611,  352,  271, 1201,  352,  615,
+      616,  616,  616,  616,  616,  616,  616, 1202,  352, 1203,
+     1204,  352,  352,  626,  627,  627,  627,  627,  627,  627,
+      627, 1205,  272,   99,  100,  352,   99, 1206,  268, 1207,
+
+     1208, 1209,  269,  270,  270,  270,  270,  270,  270,  270,
+       98, 1160, 1160, 1160, 1160, 1162, 1162, 1162, 1162, 1210,
+      271, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1161, 1218,
+     1219, 1220, 1163, 1221, 1224, 1222, 1051, 1225, 1226, 1227,
+     1223, 1228, 1229, 1210, 1230, 1231,  272,   99,  100, 1238,
+       99, 1239,  274, 1183, 1240, 1241,  275,  276,  276,  276,
+      276,  276,  276,  276,   98, 1242, 1160, 1160, 1232, 1160,
+     1162, 1162, 1234, 1162,  277, 1243, 1244, 1164, 1245, 1246,
+     1164, 1247, 1215, 1233, 1237, 1164, 1248, 1235, 1249, 1250,
+     1251, 1252, 1253, 1254, 1255, 1256, 1257, 1269, 1270, 1271,
+
+      278,   99,  100, 1272,   99, 1273,  274, 1274, 1275, 1276,
+      275,  276,  276,  276,  276,  276,  276,  276,   98, 1277,
+     1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285,  277, 1286,
+     1287, 1288, 1289, 1290, 1291, 1292, 1296, 1293, 1297, 1294,
+     1298, 1282, 1231, 1182, 1295, 1230, 1299, 1300, 1301, 1302,
+     1303, 1304, 1305, 1306,  278,   99,  100, 1307,   99, 1308,
+      280, 1309, 1310, 1313,  281,  282,  282,  282,  282,  282,
+      282,  282,   98, 1314, 1311, 1315, 1316, 1317,  283, 1287,
+     1318, 1319,  284, 1312, 1320, 1321, 1322, 1143, 1324, 1325,
+     1183, 1326, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1327,
+
+     1336, 1337, 1338, 1338, 1339, 1340, 1341, 1345,  285,   99,
+      100, 1347,   99, 1348,  280, 1349, 1346, 1350,  281,  282,
+      282,  282,  282,  282,  282,  282,   98, 1160, 1160, 1160,
+     1160, 1342,  283, 1351, 1352, 1353,  284, 1162, 1162, 1162,
+     1162, 1354, 1343, 1355, 1161, 1356, 1357, 1344, 1358, 1359,
+     1360, 1361, 1362, 1363, 1163, 1366, 1364, 1367, 1368, 1369,
+     1370, 1373,  285,   99,  100, 1365,   99, 1374,  287, 1371,
+     1375, 1376,  288,  289,  289,  289,  289,  289,  289,  289,
+       98, 1377, 1372, 1378, 1379, 1380, 1381, 1382, 1383, 1384,
+      290, 1385, 1386, 1387, 1388, 1390, 1391, 1392, 1393, 1394,
+
+     1395, 1396, 1397, 1398, 1399, 1400, 1231, 1402, 1401, 1405,
+     1231, 1405, 1406, 1407, 1408, 1412,  291,   99,  100, 1414,
+       99, 1415,  287, 1416, 1413, 1417,  288,  289,  289,  289,
+      289,  289,  289,  289,   98, 1418, 1345, 1403, 1160, 1160,
+     1232, 1160, 1409, 1419,  290, 1346, 1162, 1162, 1234, 1162,
+     1404, 1420, 1422, 1410, 1423, 1233, 1424, 1425, 1411, 1426,
+     1427, 1428, 1429, 1235, 1430, 1433, 1431, 1434, 1435, 1436,
+      291,   99,  100, 1437,   99, 1432,  293, 1438, 1440, 1441,
+      294,  295,  295,  295,  295,  295,  295,  295,   98, 1442,
+     1439, 1443, 1444, 1445, 1446, 1447, 1448, 1449,  296, 1450,
+
+     1451, 1452, 1453, 1454, 1455, 1389, 1457, 1458, 1389, 1459,
+     1460, 1461, 1462, 1389, 1463, 1464, 1465, 1401, 1402, 1466,
+     1467, 1468, 1469, 1470,  297,   99,  100, 1471,   99, 1472,
+      293, 1473, 1474, 1475,  294,  295,  295,  295,  295,  295,
+      295,  295,   98, 1476, 1477, 1412, 1478, 1479, 1480, 1481,
+     1482, 1483,  296, 1485, 1413, 1486, 1487, 1488, 1489, 1490,
+     1491, 1492, 1493, 1494, 1495, 1496, 1497, 1499, 1500, 1501,
+     1502, 1503, 1504, 1505, 1498, 1506, 1507, 1508,  297,   98,
        99,  100,   98,   99,   98,  102,   98,   98,   98,  104,
       105,  105,  105,  105,  105,  105,  105,   98,   98,   98,
 
-       98,  303,  303,  303,  303,  303,  303,  109,   98,  303,
-      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
-      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
-      303,  303,  303,  129,   98,   99,  100,   98,   99,   98,
-      102,   98,   98,   98,  104,  105,  105,  105,  105,  105,
-      105,  105,   98,   98,   98,   98,  304,  304,  304,  304,
-      304,  304,  109,   98,  304,  304,  304,  304,  304,  304,
-      304,  304,  304,  304,  304,  304,  304,  304,  304,  304,
-      304,  304,  304,  304,  304,  304,  304,  304,  129,   99,
-      100, 1365,   99, 1366,  306, 1520, 1523, 1524,  307,  308,
-
-      308,  308,  308,  308,  308,  308,   98, 1521, 1525, 1526,
-     1527, 1528, 1529, 1530, 1467, 1522,  309, 1467, 1515, 1532,
-     1517, 1533, 1467, 1534, 1535, 1538, 1539, 1540, 1541, 1536,
-     1542, 1516, 1543, 1518, 1544, 1545, 1546, 1537, 1547, 1550,
-     1551, 1552,  310,   99,  100, 1548,   99, 1553,  306, 1554,
-     1555, 1556,  307,  308,  308,  308,  308,  308,  308,  308,
-       98, 1557, 1558, 1559, 1549, 1560, 1561, 1562, 1563, 1564,
-      309, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573,
-     1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583,
-     1584, 1585, 1586, 1587, 1589, 1590,  310,   99,  100, 1591,
-
-       99, 1592,  312, 1594, 1595, 1596,  313,  314,  314,  314,
-      314,  314,  314,  314,   98, 1597, 1598, 1599, 1600, 1601,
-      315, 1602, 1603, 1604,  316, 1605, 1606, 1607, 1608, 1609,
-     1610, 1611, 1612, 1613, 1617, 1618, 1614, 1614, 1614, 1614,
-     1619, 1620, 1624, 1615, 1625, 1626, 1627, 1628, 1629, 1630,
-      317,   99,  100, 1616,   99, 1631,  312, 1632, 1633, 1634,
-      313,  314,  314,  314,  314,  314,  314,  314,   98, 1621,
-     1621, 1621, 1621, 1635,  315, 1636, 1622, 1637,  316, 1641,
-     1638, 1642, 1643, 1639, 1644, 1645, 1623, 1640, 1646, 1647,
-     1648, 1649, 1653, 1654, 1650, 1655, 1660, 1656, 1661, 1662,
-
-     1651, 1652, 1663, 1657,  317,   99,  100, 1658,   99, 1664,
-      323, 1665, 1666, 1659,  324,  325,  325,  325,  325,  325,
-      325,  325,   98, 1667, 1668, 1669, 1670, 1671, 1672, 1673,
-     1674, 1675,  326, 1676, 1677, 1678, 1679, 1680, 1681, 1682,
-     1683, 1687, 1688, 1689, 1614, 1614, 1684, 1614, 1693, 1694,
-     1695, 1685, 1696, 1697, 1698, 1699, 1700, 1701,  327,   99,
-      100, 1686,   99, 1702,  323, 1703, 1704, 1705,  324,  325,
-      325,  325,  325,  325,  325,  325,   98, 1621, 1621, 1690,
-     1621, 1706, 1707, 1710, 1691, 1708,  326, 1711, 1712, 1709,
-     1713, 1714, 1715, 1716, 1692, 1717, 1718, 1722, 1723, 1719,
-
-     1724, 1729, 1730, 1731, 1732, 1720, 1721, 1733, 1734, 1735,
-     1736, 1737,  327,   98,   99,  100,   98,   99,   98,  102,
-      332,   98,   98,  104,  105,  105,  105,  105,  105,  105,
-      105,   98,   98,   98,   98,  332,  332,  332,  332,  332,
-      332,  109,  332,  332,  332,  332,  332,  332,  332,  332,
-      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
-      332,  332,  332,  332,  332,  332,  332,  129,   99,  100,
-     1738,   99, 1739,  334, 1740, 1741, 1742,  104,  105,  105,
-      105,  105,  105,  105,  105,   98, 1725, 1743, 1744, 1745,
-     1746, 1747, 1726, 1748, 1749,  335, 1727, 1750, 1751, 1752,
-
-     1753, 1754, 1728, 1755, 1756, 1758, 1759, 1760, 1761, 1762,
-     1771, 1772, 1757, 1614, 1614, 1614, 1614, 1773, 1781, 1782,
-     1783,  336,   99,  100, 1787,   99, 1788,  334, 1789, 1790,
-     1616,  104,  105,  105,  105,  105,  105,  105,  105,   98,
-     1763, 1791, 1792, 1621, 1621, 1621, 1621, 1793, 1764,  335,
-     1765, 1794, 1784, 1774, 1766, 1785, 1767, 1768, 1769, 1770,
-     1623, 1775, 1795, 1776, 1786, 1796, 1797, 1777, 1798, 1799,
-     1778, 1779, 1780, 1800, 1801,  336,   99,  342, 1802,   99,
-     1803,  343, 1804, 1805,   98,  104,  105,  105,  105,  105,
-      105,  105,  105,   98, 1806, 1807, 1808, 1809, 1810, 1811,
-
-     1812, 1813, 1814,  344, 1815, 1816, 1817, 1818, 1819, 1820,
-     1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830,
-     1832, 1833, 1834, 1835, 1836, 1845, 1846, 1831, 1847,  345,
-       99,  342, 1855,   99, 1856,  343, 1857, 1861,   98,  104,
-      105,  105,  105,  105,  105,  105,  105,   98, 1614, 1614,
-     1684, 1614, 1837, 1862, 1863, 1858, 1864,  344, 1859, 1865,
-     1838, 1866, 1839, 1867, 1868, 1686, 1840, 1860, 1841, 1842,
-     1843, 1844, 1869, 1870, 1871, 1872, 1621, 1621, 1690, 1621,
-     1873, 1874, 1875,  345,  416,  417,  418,  418,  418,  418,
-      418,  418,  418, 1692, 1848, 1876, 1877, 1878, 1879, 1880,
-
-     1881, 1882, 1849, 1883, 1850, 1884, 1885, 1886, 1851, 1887,
-     1888, 1852, 1853, 1854, 1889, 1890, 1891, 1892, 1893, 1894,
-     1895, 1896, 1897, 1898, 1899, 1900, 1901,  419,  479,  480,
-      480,  480,  480,  480,  480,  480, 1902, 1903, 1904, 1905,
-     1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915,
-     1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925,
-     1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935,
-      481,  492,  493,  493,  493,  493,  493,  493,  493, 1936,
-     1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946,
-     1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956,
-
-     1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966,
-     1967, 1968, 1969,  494,  509,  510,  510,  510,  510,  510,
-      510,  510, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1826,
-     1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986,
-     1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996,
-     1997, 1998, 1999, 2000, 2001, 2002,  511,  514,  515,  515,
-      515,  515,  515,  515,  515, 2003, 2004, 2005, 2006, 2007,
-     2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017,
-     2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027,
-     2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036,  516,
-
-      519,  520,  520,  520,  520,  520,  520,  520, 2037, 2038,
-     2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048,
-     2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058,
-     2059, 2060, 2061, 2062, 2063, 2064, 2065, 1917, 1917, 2066,
-     2067, 2068,  521,  532, 2069, 2070, 2071, 2072, 2073,  535,
-      536,  536,  536,  536,  536,  536,  536,  532, 1928, 1928,
-     2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083,
-     2084, 2085, 2086, 2088, 2089, 2090, 2091, 2092, 2093, 2094,
-     2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104,
-     2105,  537,  539, 2106, 2107, 2108, 1974, 1976,  542,  543,
-
-      543,  543,  543,  543,  543,  543,  539, 2109, 2110, 2111,
-     2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121,
-     2122, 1986, 1986, 2123, 2124, 2125, 2126, 2127, 2128, 2129,
-     2130, 1997, 1997, 2131, 2132, 2133, 2134, 2135, 2136, 2137,
-      544,  547, 2138, 2139, 2140, 2141, 2142,  550,  551,  551,
-      551,  551,  551,  551,  551,  547, 2143, 2087, 2146, 2147,
-     2087, 2148, 2149, 2150, 2151, 2087, 2152, 2153, 2154, 2155,
-     2156, 2157, 2158, 2159, 2145, 2160, 2161, 2162, 2163, 2164,
-     2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173,  552,
-      554, 2174, 2175, 2176, 2177, 2178,  557,  558,  558,  558,
-
-      558,  558,  558,  558,  554, 2179, 2180, 2181, 2182, 2183,
-     2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193,
-     2194, 2195, 2196, 2197, 2198, 2200, 2201, 2202, 2203, 2204,
-     2088, 2199, 2206, 2207, 2208, 2209, 2210, 2211,  559,  561,
-     2212, 2213, 2214, 2215, 2216,  564,  565,  565,  565,  565,
-      565,  565,  565,  561, 2217, 2218, 2219, 2220, 2221, 2222,
-     2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232,
-     2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2241, 2242,
-     2243, 2244, 2245, 2246, 2247, 2248, 2249,  566,  568, 2250,
-     2253, 2254, 2255, 2256,  571,  572,  572,  572,  572,  572,
-
-      572,  572,  568, 2251, 2257, 2087, 2205, 2260, 2087, 2205,
-     2252, 2261, 2262, 2087, 2205, 2263, 2264, 2265, 2266, 2267,
-     2268, 2269, 2145, 2259, 2270, 2271, 2272, 2273, 2274, 2275,
-     2276, 2277, 2278, 2279, 2280, 2281,  573,  576,  577,  577,
-      577,  577,  577,  577,  577, 2282, 2283, 2285, 2286, 2287,
-     2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297,
-     2298, 2299, 2300, 2301, 2302, 2303, 2304, 2305, 2206, 2206,
-     2306, 2307, 2308, 2309, 2311, 2312, 2312, 2313, 2314,  578,
-      582,  583,  583,  583,  583,  583,  583,  583, 2315, 2316,
-     2317, 2318, 2319, 2320, 2321, 2322, 2323, 2284, 2326, 2327,
-
-     2284, 2328, 2329, 2330, 2331, 2284, 2332, 2333, 2334, 2335,
-     2336, 2337, 2338, 2339, 2325, 2340, 2341, 2342, 2343, 2344,
-     2345, 2346,  584,  587,  588,  588,  588,  588,  588,  588,
-      588, 2205, 2205, 2347, 2205, 2205, 2348, 2349, 2310, 2205,
-     2205, 2310, 2351, 2352, 2352, 2353, 2310, 2354, 2259, 2259,
-     2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364,
-     2365, 2285, 2367, 2368, 2369,  589,  597, 2370, 2371,  597,
-     2372,  597,  597,  597,  597, 1917,  597,  597,  597,  597,
-      597,  597,  597,  597, 2373,  597,  597,  597, 2374, 2375,
-     1928, 2376, 2377, 2378,  597,  597, 2379, 2380, 2381, 2307,
-
-     2382, 2383, 2384, 2387, 2385, 2389, 2390, 2391, 2392, 2393,
-     2394, 2386, 2395, 2396, 2399, 2400, 2401, 2402, 2403, 1986,
-      597,  599, 2284, 2404,  599, 2284,  599,  599,  599,  599,
-     2284,  599,  599,  599,  599,  599,  599,  599,  599, 2325,
-      599,  599,  599, 2366, 2405, 2406, 2366, 1997, 2407,  599,
-      599, 2366, 2408, 2409, 2410, 2411, 2412, 2347, 2413, 2414,
-     2398, 2415, 2418, 2416, 2388, 2420, 2421, 2388, 2422, 2423,
-     2417, 2424, 2388, 2425, 2426,  599,  603,  604,  604,  604,
-      604,  604,  604,  604, 2427, 2428, 2367, 2367, 2429, 2430,
-     2431, 2432, 2433, 2434, 2435, 2437, 2438, 2439, 2440, 2441,
-
-     2442, 2436, 2443, 2444, 2445, 2446, 2447, 2448, 2449, 2450,
-     2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458,  605,  608,
-      609,  609,  609,  609,  609,  609,  609, 2366, 2366, 2459,
-     2366, 2366, 2460, 2462, 2463, 2366, 2366, 2464, 2465, 2461,
-     2466, 2467, 2468, 2469, 2398, 2398, 2470, 2471, 2472, 2473,
-     2474, 2475, 2476, 2477, 2478, 2479, 2480, 2481, 2482, 2483,
-     2484,  610,  619,  620,  620,  620,  620,  620,  620,  620,
-     2485, 2486, 2487, 2488, 2489, 2490, 2491, 2492, 2493, 2494,
-     2495, 2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503, 2504,
-     2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2514,
-
-     2515, 2516, 2517, 2518,  621,  349,  633, 2519,  349, 2520,
-     2521, 2522, 2523,  349,  349,  349,  349,  349,  349,  349,
-      349,  349,  349,  417,  418,  418,  418,  418,  418,  418,
-      418, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532,
-     2533, 2533, 2534, 2499, 2535, 2536, 2537, 2538, 2539, 2540,
-     2541, 2542, 2543, 2544, 2545, 2545, 2546, 2522, 2547, 2548,
-     2549, 2550, 2551, 2552, 2553,  419,  418,  418,  418,  418,
-      418,  418,  418,  418, 2554, 2555, 2556, 2557,  418,  418,
-      418, 2558, 2559, 2560, 2561, 2562,  418,  418,  418,  418,
-      418,  418,  479,  480,  480,  480,  480,  480,  480,  480,
-
-     2563, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572,
-     2573, 2574, 1090, 1089, 1088, 1087, 1084, 1083, 1080, 1077,
-     1076, 1075, 1074, 1073, 1072, 1071, 1070, 1069, 1068, 1067,
-     1066, 1065, 1064, 1063,  481,  480,  480,  480,  480,  480,
-      480,  480,  480, 1062, 1061, 1060, 1059,  480,  480,  480,
-     1058, 1057, 1056, 1053, 1052,  480,  480,  480,  480,  480,
-      480,  492,  493,  493,  493,  493,  493,  493,  493, 1051,
-     1050, 1049, 1048, 1047, 1046, 1045, 1044, 1043, 1042, 1041,
-     1040, 1039, 1038, 1036, 1035, 1034, 1033, 1032, 1031, 1030,
-     1029, 1028, 1027, 1026, 1023, 1022, 1019, 1016, 1015, 1014,
-
-     1013, 1012, 1011,  494,  493,  493,  493,  493,  493,  493,
-      493,  493, 1010, 1009, 1008, 1007,  493,  493,  493, 1006,
-     1005, 1004, 1003, 1002,  493,  493,  493,  493,  493,  493,
-      509,  510,  510,  510,  510,  510,  510,  510, 1001, 1000,
-      999,  998,  997,  996,  993,  992,  991,  990,  989,  988,
-      987,  986,  985,  984,  983,  982,  981,  980,  979,  978,
-      977,  976,  975,  974,  973,  972,  971,  970,  969,  968,
-      965,  964,  511,  510,  510,  510,  510,  510,  510,  510,
-      510,  963,  962,  961,  960,  510,  510,  510,  959,  958,
-      957,  956,  955,  510,  510,  510,  510,  510,  510,  514,
-
-      515,  515,  515,  515,  515,  515,  515,  954,  953,  952,
-      951,  950,  949,  948,  946,  945,  944,  943,  942,  941,
-      940,  939,  938,  937,  936,  933,  932,  931,  930,  929,
-      928,  927,  926,  925,  924,  923,  922,  921,  920,  919,
-      918,  516,  515,  515,  515,  515,  515,  515,  515,  515,
-      917,  916,  915,  914,  515,  515,  515,  913,  912,  909,
-      906,  905,  515,  515,  515,  515,  515,  515,  519,  520,
-      520,  520,  520,  520,  520,  520,  904,  903,  902,  899,
-      898,  897,  896,  895,  717,  894,  893,  892,  891,  890,
-      889,  888,  887,  886,  885,  882,  881,  880,  879,  878,
-
-      877,  876,  875,  874,  873,  872,  871,  870,  869,  868,
-      521,  520,  520,  520,  520,  520,  520,  520,  520,  867,
-      866,  865,  864,  520,  520,  520,  863,  862,  861,  860,
-      859,  520,  520,  520,  520,  520,  520,  532,  858,  857,
-      856,  855,  854,  535,  536,  536,  536,  536,  536,  536,
-      536,  532,  853,  852,  851,  850,  849,  846,  843,  842,
-      841,  840,  839,  836,  835,  834,  833,  832,  831,  830,
-      829,  828,  827,  826,  825,  824,  823,  820,  819,  818,
-      817,  816,  815,  814,  813,  537,  536,  812,  811,  810,
-      809,  808,  807,  804,  803,  802,  801,  800,  536,  536,
-
-      536,  799,  798,  797,  796,  795,  536,  536,  536,  536,
-      536,  536,  794,  793,  792,  791,  790,  789,  788,  567,
-      349,  560,  349,  553,  349,  546,  349,  787,  531,  539,
-      538,  349,  531,  349,  786,  542,  543,  543,  543,  543,
-      543,  543,  543,  539,  785,  784,  783,  782,  781,  780,
-      779,  778,  777,  776,  775,  774,  773,  772,  771,  770,
-      769,  768,  767,  488,  766,  765,  764,  763,  762,  761,
-      760,  759,  758,  757,  756,  755,  754,  544,  543,  753,
-      751,  750,  749,  748,  747,  746,  745,  744,  743,  742,
-      543,  543,  543,  741,  740,  739,  735,  732,  543,  543,
-
-      543,  543,  543,  543,  731,  730,  729,  728,  725,  724,
-      723,  722,  721,  720,  719,  718,  717,  716,  715,  714,
-      538,  547,  713,  712,  711,  708,  707,  550,  551,  551,
-      551,  551,  551,  551,  551,  547,  706,  705,  704,  703,
-      700,  699,  698,  697,  696,  694,  693,  692,  691,  690,
-      689,  688,  687,  686,  685,  684,  683,  682,  681,  680,
-      679,  678,  677,  676,  672,  669,  668,  667,  666,  552,
-      551,  665,  662,  661,  660,  659,  658,  657,  656,  655,
-      654,  653,  551,  551,  551,  652,  651,  650,  647,  646,
-      551,  551,  551,  551,  551,  551,  645,  644,  643,  642,
-
-      639,  638,  637,  636,  635,  632,  631,  630,  629,  355,
-      625,  624,  546,  554,  623,  622,  355,  616,  615,  557,
-      558,  558,  558,  558,  558,  558,  558,  554,  612,  355,
-      611,  355,  596,  595,  594,  593,  592,  591,  590,  355,
-      355,  355,  579,  567,  560,  553,  546,  545,  538,  531,
-      530,  529,  528,  527,  526,  525,  524,  523,  522,  355,
-      355,  559,  558,  355,  506,  505,  504,  503,  502,  501,
-      500,  499,  498,  496,  558,  558,  558,  495,  355,  488,
-      487,  486,  558,  558,  558,  558,  558,  558,  485,  482,
-      355,  475,  474,  473,  472,  470,  463,  462,  420,  355,
-
-      412,  412,  412,  407,  553,  561,  397,  396,  373,  370,
-      356,  564,  565,  565,  565,  565,  565,  565,  565,  561,
-      355,  348,  348,  348, 2575,   98,   98,   98,   98,   98,
-       98, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575,  566,  565, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575,  565,  565,  565, 2575,
-     2575, 2575, 2575, 2575,  565,  565,  565,  565,  565,  565,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575,  560,  568, 2575, 2575,
-
-     2575, 2575, 2575,  571,  572,  572,  572,  572,  572,  572,
-      572,  568, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575,  573,  572, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,  572,  572,
-      572, 2575, 2575, 2575, 2575, 2575,  572,  572,  572,  572,
-      572,  572, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,  567,  576,
-      577,  577,  577,  577,  577,  577,  577, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575,  578,  577,  577,  577,  577,  577,  577,  577,  577,
-     2575, 2575, 2575, 2575,  577,  577,  577, 2575, 2575, 2575,
-     2575, 2575,  577,  577,  577,  577,  577,  577,  582,  583,
-      583,  583,  583,  583,  583,  583, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-
-      584,  583,  583,  583,  583,  583,  583,  583,  583, 2575,
-     2575, 2575, 2575,  583,  583,  583, 2575, 2575, 2575, 2575,
-     2575,  583,  583,  583,  583,  583,  583,  587,  588,  588,
-      588,  588,  588,  588,  588, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,  589,
-      588,  588,  588,  588,  588,  588,  588,  588, 2575, 2575,
-     2575, 2575,  588,  588,  588, 2575, 2575, 2575, 2575, 2575,
-      588,  588,  588,  588,  588,  588,  597, 2575, 2575,  597,
-
-     2575,  597,  597,  597,  597, 2575,  597,  597,  597,  597,
-      597,  597,  597,  597, 2575,  597,  597,  597, 2575, 2575,
-     2575, 2575, 2575, 2575,  597,  597, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-      597,  599, 2575, 2575,  599, 2575,  599,  599,  599,  599,
-     2575,  599,  599,  599,  599,  599,  599,  599,  599, 2575,
-      599,  599,  599, 2575, 2575, 2575, 2575, 2575, 2575,  599,
-      599, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2575, 2575,  599,  603,  604,  604,  604,
-      604,  604,  604,  604, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,  605,  604,
-      604,  604,  604,  604,  604,  604,  604, 2575, 2575, 2575,
-     2575,  604,  604,  604, 2575, 2575, 2575, 2575, 2575,  604,
-      604,  604,  604,  604,  604,  608,  609,  609,  609,  609,
-      609,  609,  609, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575,  610,  609,  609,
-      609,  609,  609,  609,  609,  609, 2575, 2575, 2575, 2575,
-      609,  609,  609, 2575, 2575, 2575, 2575, 2575,  609,  609,
-      609,  609,  609,  609,  619,  620,  620,  620,  620,  620,
-      620,  620, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575,  621,  620,  620,  620,
-      620,  620,  620,  620,  620, 2575, 2575, 2575, 2575,  620,
-
-      620,  620, 2575, 2575, 2575, 2575, 2575,  620,  620,  620,
-      620,  620,  620,  349,  633, 2575,  349, 2575, 2575, 2575,
-     2575,  349,  349,  349,  349,  349,  349,  349,  349,  349,
-      349, 1159, 1160, 1161, 1162, 2575, 1163, 1164, 2575, 2575,
-     1165, 2575, 1166, 2575, 2575, 1167, 2575, 2575, 1168, 2575,
-     1169, 1228, 1229, 1230, 1231, 2575, 1232, 1233, 2575, 2575,
-     1234, 2575, 1235, 2575, 2575, 1236, 2575, 2575, 1237, 2575,
-     1238,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  195,  195,  195,  195,  195,  195,  195,
-      195,  195,  195,  195,  195,  213,  213,  213,  213,  213,
-
-      213,  213,  213,  213,  213,  213,  213,  219,  219,  219,
-      219,  219,  219,  219,  219,  219,  219,  219,  219,  225,
-      225,  225,  225,  225,  225,  225,  225,  225,  225,  225,
-      225,  240,  240,  240,  240,  240,  240,  240,  240,  240,
-      240,  240,  240,  246,  246,  246,  246,  246,  246,  246,
-      246,  246,  246,  246,  246,  253,  253,  253,  253,  253,
-      253,  253,  253,  253,  253,  253,  253,  259,  259,  259,
-      259,  259,  259,  259,  259,  259,  259,  259,  259,  265,
-      265,  265,  265,  265,  265,  265,  265,  265,  265,  265,
-      265,  271,  271,  271,  271,  271,  271,  271,  271,  271,
-
-      271,  271,  271,  277,  277,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  284,  284,  284,  284,  284,
-      284,  284,  284,  284,  284,  284,  284,  290,  290,  290,
-      290,  290,  290,  290,  290,  290,  290,  290,  290,  305,
+       98,  305,  305,  305,  305,  305,  305,  109,   98,  305,
       305,  305,  305,  305,  305,  305,  305,  305,  305,  305,
-      305,  311,  311,  311,  311,  311,  311,  311,  311,  311,
-      311,  311,  311,  322,  322,  322,  322,  322,  322,  322,
-      322,  322,  322,  322,  322,  333,  333,  333,  333,  333,
-      333,  333,  333,  333,  333,  333,  333,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  349,
-
-      349, 2575,  349,  349,  349,  349,  349,  349,  349,  349,
-      349,  353, 2575, 2575,  353,  411, 2575, 2575,  411, 2575,
-      411,  411, 2575,  411,  411,  411,  411,  413,  413, 2575,
-      413,  413,  413,  413,  413,  413,  413,  413,  413,  476,
-      476, 2575,  476,  476,  476,  476,  476,  476,  476,  476,
-      476,  478,  478, 2575,  478,  478,  478,  478,  478,  478,
-      478,  478,  478,  489, 2575, 2575, 2575,  489,  489,  490,
-     2575, 2575,  490, 2575,  490,  490,  490,  490, 2575,  490,
-      490,  491,  491, 2575,  491,  491,  491,  491,  491,  491,
-      491,  491,  491,  497, 2575, 2575, 2575, 2575,  497,  497,
-
-      497,  497, 2575,  497,  497,  507, 2575, 2575,  507, 2575,
-      507,  507,  507,  507, 2575,  507,  507,  508,  508, 2575,
-      508,  508,  508,  508,  508,  508,  508,  508,  508,  512,
-     2575, 2575,  512, 2575,  512,  512,  512,  512, 2575,  512,
-      512,  513,  513, 2575,  513,  513,  513,  513,  513,  513,
-      513,  513,  513,  517, 2575, 2575,  517, 2575,  517,  517,
-      517,  517, 2575,  517,  517,  518,  518, 2575,  518,  518,
-      518,  518,  518,  518,  518,  518,  518,  531, 2575, 2575,
-      531,  531,  531,  531,  531,  531,  531,  531,  531,  533,
-      533, 2575,  533,  533,  533,  533,  533,  533,  533,  533,
-
-      533,  538, 2575, 2575,  538,  538,  538,  538,  538,  538,
-      538,  538,  538,  540,  540, 2575,  540,  540,  540,  540,
-      540,  540,  540,  540,  540,  546, 2575, 2575,  546,  546,
-      546,  546,  546,  546,  546,  546,  546,  548,  548, 2575,
-      548,  548,  548,  548,  548,  548,  548,  548,  548,  553,
-     2575, 2575,  553,  553,  553,  553,  553,  553,  553,  553,
-      553,  555,  555, 2575,  555,  555,  555,  555,  555,  555,
-      555,  555,  555,  560, 2575, 2575,  560,  560,  560,  560,
-      560,  560,  560,  560,  560,  562,  562, 2575,  562,  562,
-      562,  562,  562,  562,  562,  562,  562,  567, 2575, 2575,
-
-      567,  567,  567,  567,  567,  567,  567,  567,  567,  569,
-      569, 2575,  569,  569,  569,  569,  569,  569,  569,  569,
-      569,  574, 2575, 2575,  574, 2575,  574,  574,  574,  574,
-     2575,  574,  574,  575,  575, 2575,  575,  575,  575,  575,
-      575,  575,  575,  575,  575,  580, 2575, 2575,  580, 2575,
-      580,  580,  580,  580, 2575,  580,  580,  581,  581, 2575,
-      581,  581,  581,  581,  581,  581,  581,  581,  581,  585,
-     2575, 2575,  585, 2575,  585,  585,  585,  585, 2575,  585,
-      585,  586,  586, 2575,  586,  586,  586,  586,  586,  586,
-      586,  586,  586,  598, 2575, 2575,  598, 2575,  598,  598,
-
-     2575,  598, 2575,  598,  598,  600, 2575, 2575,  600, 2575,
-      600,  600, 2575,  600, 2575,  600,  600,  601, 2575, 2575,
-      601, 2575,  601,  601,  601,  601, 2575,  601,  601,  602,
-      602, 2575,  602,  602,  602,  602,  602,  602,  602,  602,
-      602,  606, 2575, 2575,  606, 2575,  606,  606,  606,  606,
-     2575,  606,  606,  607,  607, 2575,  607,  607,  607,  607,
-      607,  607,  607,  607,  607,  617, 2575, 2575,  617, 2575,
-      617,  617,  617,  617, 2575,  617,  617,  618,  618, 2575,
-      618,  618,  618,  618,  618,  618,  618,  618,  618,  626,
-      626, 2575,  626, 2575,  626,  626,  627, 2575, 2575,  627,
-
-     2575,  627,  627,  627,  627,  627,  627,  627,  628,  628,
-     2575,  628,  628,  628,  628,  628,  628,  628,  628,  628,
-      633, 2575,  633,  633, 2575,  633,  633, 2575, 2575, 2575,
-      633,  633,  634,  634,  634,  634,  634,  634,  634,  634,
-      634,  634,  634,  634,  349,  349, 2575,  349,  349,  349,
-      349,  349,  349,  349,  349,  349,  353, 2575, 2575,  353,
-      353, 2575,  353,  411, 2575, 2575,  411, 2575,  411,  411,
-     2575,  411,  411,  411,  411,  413,  413, 2575,  413,  413,
-      413,  413,  413,  413,  413,  413,  413,  476,  476, 2575,
-      476,  476,  476,  476,  476,  476,  476,  476,  476,  478,
-
-      478, 2575,  478,  478,  478,  478,  478,  478,  478,  478,
-      478,  489, 2575, 2575, 2575,  489,  489,  490, 2575, 2575,
-      490, 2575,  490,  490,  490,  490, 2575,  490,  490,  491,
-      491, 2575,  491,  491,  491,  491,  491,  491,  491,  491,
-      491,  497, 2575, 2575, 2575, 2575,  497,  497,  497,  497,
-     2575,  497,  497,  507, 2575, 2575,  507, 2575,  507,  507,
-      507,  507, 2575,  507,  507,  508,  508, 2575,  508,  508,
-      508,  508,  508,  508,  508,  508,  508,  512, 2575, 2575,
-      512, 2575,  512,  512,  512,  512, 2575,  512,  512,  513,
-      513, 2575,  513,  513,  513,  513,  513,  513,  513,  513,
-
-      513,  517, 2575, 2575,  517, 2575,  517,  517,  517,  517,
-     2575,  517,  517,  518,  518, 2575,  518,  518,  518,  518,
-      518,  518,  518,  518,  518,  531, 2575, 2575,  531,  531,
-      531,  531,  531,  531,  531,  531,  531,  532, 2575, 2575,
-      532,  532,  532,  532,  532,  532,  532,  532,  532,  533,
-      533, 2575,  533,  533,  533,  533,  533,  533,  533,  533,
-      533,  534,  534, 2575,  534,  534,  534,  534,  534,  534,
-      534,  534,  534,  538, 2575, 2575,  538,  538,  538,  538,
-      538,  538,  538,  538,  538,  539, 2575, 2575,  539,  539,
-      539,  539,  539,  539,  539,  539,  539,  540,  540, 2575,
-
-      540,  540,  540,  540,  540,  540,  540,  540,  540,  541,
-      541, 2575,  541,  541,  541,  541,  541,  541,  541,  541,
-      541,  546, 2575, 2575,  546,  546,  546,  546,  546,  546,
-      546,  546,  546,  547, 2575, 2575,  547,  547,  547,  547,
-      547,  547,  547,  547,  547,  548,  548, 2575,  548,  548,
-      548,  548,  548,  548,  548,  548,  548,  549,  549, 2575,
-      549,  549,  549,  549,  549,  549,  549,  549,  549,  553,
-     2575, 2575,  553,  553,  553,  553,  553,  553,  553,  553,
-      553,  554, 2575, 2575,  554,  554,  554,  554,  554,  554,
-      554,  554,  554,  555,  555, 2575,  555,  555,  555,  555,
-
-      555,  555,  555,  555,  555,  556,  556, 2575,  556,  556,
-      556,  556,  556,  556,  556,  556,  556,  560, 2575, 2575,
-      560,  560,  560,  560,  560,  560,  560,  560,  560,  561,
-     2575, 2575,  561,  561,  561,  561,  561,  561,  561,  561,
-      561,  562,  562, 2575,  562,  562,  562,  562,  562,  562,
-      562,  562,  562,  563,  563, 2575,  563,  563,  563,  563,
-      563,  563,  563,  563,  563,  567, 2575, 2575,  567,  567,
-      567,  567,  567,  567,  567,  567,  567,  568, 2575, 2575,
-      568,  568,  568,  568,  568,  568,  568,  568,  568,  569,
-      569, 2575,  569,  569,  569,  569,  569,  569,  569,  569,
-
-      569,  570,  570, 2575,  570,  570,  570,  570,  570,  570,
-      570,  570,  570,  574, 2575, 2575,  574, 2575,  574,  574,
-      574,  574, 2575,  574,  574,  575,  575, 2575,  575,  575,
-      575,  575,  575,  575,  575,  575,  575,  580, 2575, 2575,
-      580, 2575,  580,  580,  580,  580, 2575,  580,  580,  581,
-      581, 2575,  581,  581,  581,  581,  581,  581,  581,  581,
-      581,  585, 2575, 2575,  585, 2575,  585,  585,  585,  585,
-     2575,  585,  585,  586,  586, 2575,  586,  586,  586,  586,
-      586,  586,  586,  586,  586,  597, 2575, 2575,  597, 2575,
-      597,  597, 2575,  597, 2575,  597,  597,  598, 2575, 2575,
-
-      598, 2575,  598,  598, 2575,  598, 2575,  598,  598,  599,
-     2575, 2575,  599, 2575,  599,  599, 2575,  599, 2575,  599,
-      599,  600, 2575, 2575,  600, 2575,  600,  600, 2575,  600,
-     2575,  600,  600,  601, 2575, 2575,  601, 2575,  601,  601,
-      601,  601, 2575,  601,  601,  602,  602, 2575,  602,  602,
-      602,  602,  602,  602,  602,  602,  602,  606, 2575, 2575,
-      606, 2575,  606,  606,  606,  606, 2575,  606,  606,  607,
-      607, 2575,  607,  607,  607,  607,  607,  607,  607,  607,
-      607,  617, 2575, 2575,  617, 2575,  617,  617,  617,  617,
-     2575,  617,  617,  618,  618, 2575,  618,  618,  618,  618,
-
-      618,  618,  618,  618,  618,  626,  626, 2575,  626, 2575,
-      626,  626,  627, 2575, 2575,  627, 2575,  627,  627,  627,
-      627,  627,  627,  627,  628,  628, 2575,  628,  628,  628,
-      628,  628,  628,  628,  628,  628,  633, 2575,  633,  633,
-     2575,  633,  633, 2575, 2575, 2575,  633,  633,  634,  634,
-      634,  634,  634,  634,  634,  634,  634,  634,  634,  634,
-      411, 2575, 2575,  411, 2575,  411,  411, 2575,  411,  411,
-      411,  411,  947,  947, 2575,  947,  947,  947,  947,  947,
-      947,  947,  947,  947, 1139, 1139, 2575, 1139, 1139, 1139,
-     1139, 1139, 1139, 1139, 1139, 1139, 1208, 1208, 2575, 1208,
-
-     1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1292, 2575,
-     2575, 1292, 2575, 1292, 1292, 1292, 1292, 1292, 1292, 1292,
-     1297, 2575, 2575, 1297, 2575, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1353, 1353, 2575, 1353, 1353, 1353, 1353, 1353,
-     1353, 1353, 1353, 1353, 1383, 1383, 2575, 1383, 1383, 1383,
-     1383, 1383, 1383, 1383, 1383, 1383, 1416, 1416, 2575, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1444, 2575,
-     2575, 1444, 2575, 1444, 1444, 2575, 1444, 2575, 1444, 1444,
-     1467, 1467, 2575, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1531, 1531, 2575, 1531, 1531, 1531, 1531, 1531,
-
-     1531, 1531, 1531, 1531, 1588, 1588, 2575, 1588, 1588, 1588,
-     1588, 1588, 1588, 1588, 1588, 1588, 1593, 1593, 2575, 1593,
-     1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 2087, 2087,
-     2575, 2087, 2087, 2087, 2087, 2087, 2087, 2087, 2087, 2087,
-     2144, 2144, 2575, 2144, 2144, 2144, 2144, 2144, 2144, 2144,
-     2144, 2144, 2205, 2205, 2575, 2205, 2205, 2205, 2205, 2205,
-     2205, 2205, 2205, 2205, 2258, 2258, 2575, 2258, 2258, 2258,
-     2258, 2258, 2258, 2258, 2258, 2258, 2284, 2284, 2575, 2284,
-     2284, 2284, 2284, 2284, 2284, 2284, 2284, 2284, 2310, 2310,
-     2575, 2310, 2310, 2310, 2310, 2310, 2310, 2310, 2310, 2310,
-
-     2324, 2324, 2575, 2324, 2324, 2324, 2324, 2324, 2324, 2324,
-     2324, 2324, 2350, 2350, 2575, 2350, 2350, 2350, 2350, 2350,
-     2350, 2350, 2350, 2350, 2366, 2366, 2575, 2366, 2366, 2366,
-     2366, 2366, 2366, 2366, 2366, 2366, 2388, 2388, 2575, 2388,
-     2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2397, 2397,
-     2575, 2397, 2397, 2397, 2397, 2397, 2397, 2397, 2397, 2397,
-     2419, 2419, 2575, 2419, 2419, 2419, 2419, 2419, 2419, 2419,
-     2419, 2419,   97, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575
+      305,  305,  305,  305,  305,  305,  305,  305,  305,  305,
+      305,  305,  305,  130,   98,   99,  100,   98,   99,   98,
+      102,   98,   98,   98,  104,  105,  105,  105,  105,  105,
+      105,  105,   98,   98,   98,   98,  306,  306,  306,  306,
+      306,  306,  109,   98,  306,  306,  306,  306,  306,  306,
+      306,  306,  306,  306,  306,  306,  306,  306,  306,  306,
+      306,  306,  306,  306,  306,  306,  306,  306,  130,   99,
+      100, 1510,   99, 1511,  308, 1512, 1516, 1517,  309,  310,
+
+      310,  310,  310,  310,  310,  310,   98, 1513, 1518, 1519,
+     1520, 1521, 1514, 1522, 1523, 1524,  311, 1525, 1526, 1527,
+     1515, 1528, 1529, 1531, 1532, 1533, 1534, 1535, 1536, 1537,
+     1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547,
+     1548, 1530,  312,   99,  100, 1551,   99, 1552,  308, 1549,
+     1550, 1553,  309,  310,  310,  310,  310,  310,  310,  310,
+       98, 1554, 1555, 1556, 1557, 1558, 1401, 1402, 1563, 1564,
+      311, 1565, 1567, 1568, 1569, 1570, 1401, 1402, 1571, 1566,
+     1572, 1573, 1574, 1575, 1576, 1509, 1578, 1579, 1509, 1580,
+     1584, 1585, 1586, 1509, 1587, 1588,  312,   99,  100, 1589,
+
+       99, 1590,  314, 1559, 1561, 1591,  315,  316,  316,  316,
+      316,  316,  316,  316,   98, 1592, 1560, 1562, 1581, 1593,
+      317, 1594, 1595, 1582,  318, 1596, 1598, 1599, 1600, 1601,
+     1602, 1583, 1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610,
+     1611, 1612, 1613, 1614, 1597, 1615, 1616, 1617, 1618, 1619,
+      319,   99,  100, 1620,   99, 1621,  314, 1622, 1623, 1624,
+      315,  316,  316,  316,  316,  316,  316,  316,   98, 1625,
+     1626, 1627, 1628, 1629,  317, 1630, 1631, 1632,  318, 1633,
+     1634, 1635, 1637, 1638, 1639, 1640, 1642, 1643, 1644, 1645,
+     1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655,
+
+     1656, 1657, 1658, 1659,  319,   99,  100, 1660,   99, 1661,
+      325, 1662, 1663, 1667,  326,  327,  327,  327,  327,  327,
+      327,  327,   98, 1664, 1664, 1664, 1664, 1668, 1669, 1670,
+     1665, 1671,  328, 1672, 1673, 1673, 1673, 1673, 1676, 1677,
+     1666, 1674, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685,
+     1686, 1675, 1687, 1688, 1689, 1693, 1694, 1695,  329,   99,
+      100, 1696,   99, 1697,  325, 1698, 1699, 1700,  326,  327,
+      327,  327,  327,  327,  327,  327,   98, 1690, 1701, 1705,
+     1691, 1702, 1706, 1707, 1692, 1708,  328, 1703, 1704, 1712,
+     1713, 1709, 1714, 1715, 1716, 1710, 1717, 1718, 1719, 1720,
+
+     1721, 1711, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729,
+     1730, 1731,  329,   98,   99,  100,   98,   99,   98,  102,
+      334,   98,   98,  104,  105,  105,  105,  105,  105,  105,
+      105,   98,   98,   98,   98,  334,  334,  334,  334,  334,
+      334,  109,  334,  334,  334,  334,  334,  334,  334,  334,
+      334,  334,  334,  334,  334,  334,  334,  334,  334,  334,
+      334,  334,  334,  334,  334,  334,  334,  130,   99,  100,
+     1732,   99, 1733,  336, 1734, 1735, 1736,  104,  105,  105,
+      105,  105,  105,  105,  105,   98, 1737, 1664, 1664, 1738,
+     1664, 1741, 1742, 1743, 1739,  337, 1744, 1745, 1673, 1673,
+
+     1746, 1673, 1749, 1750, 1740, 1747, 1751, 1752, 1753, 1754,
+     1755, 1756, 1757, 1758, 1759, 1748, 1760, 1761, 1762, 1766,
+     1767,  338,   99,  100, 1768,   99, 1769,  336, 1770, 1771,
+     1772,  104,  105,  105,  105,  105,  105,  105,  105,   98,
+     1763, 1773, 1774, 1764, 1778, 1775, 1779, 1765, 1780,  337,
+     1781, 1776, 1777, 1785, 1786, 1787, 1782, 1788, 1789, 1790,
+     1783, 1791, 1792, 1793, 1794, 1795, 1784, 1796, 1797, 1798,
+     1799, 1800, 1801, 1802, 1803,  338,   99,  344, 1804,   99,
+     1805,  345, 1806, 1807,   98,  104,  105,  105,  105,  105,
+      105,  105,  105,   98, 1808, 1809, 1810, 1811, 1812, 1813,
+
+     1816, 1817, 1818,  346, 1819, 1814, 1820, 1821, 1664, 1664,
+     1664, 1664, 1830, 1815, 1831, 1832, 1833, 1834, 1842, 1673,
+     1673, 1673, 1673, 1843, 1844, 1666, 1848, 1849, 1850,  347,
+       99,  344, 1851,   99, 1852,  345, 1675, 1853,   98,  104,
+      105,  105,  105,  105,  105,  105,  105,   98, 1822, 1845,
+     1854, 1855, 1846, 1856, 1857, 1858, 1823,  346, 1824, 1859,
+     1835, 1847, 1825, 1860, 1826, 1827, 1828, 1829, 1836, 1861,
+     1837, 1862, 1863, 1864, 1838, 1865, 1866, 1839, 1840, 1841,
+     1867, 1868, 1869,  347,  421,  422,  423,  423,  423,  423,
+      423,  423,  423, 1870, 1871, 1872, 1873, 1874, 1875, 1876,
+
+     1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886,
+     1887, 1888, 1889, 1890, 1891, 1895, 1896, 1897, 1898, 1899,
+     1900, 1664, 1664, 1738, 1664, 1909, 1910,  424,  486,  487,
+      487,  487,  487,  487,  487,  487, 1892, 1901, 1740, 1911,
+     1912, 1913, 1893, 1921, 1922, 1902, 1923, 1903, 1927, 1924,
+     1894, 1904, 1925, 1905, 1906, 1907, 1908, 1928, 1929, 1930,
+     1931, 1926, 1673, 1673, 1746, 1673, 1932, 1933, 1934, 1935,
+      488,  499,  500,  500,  500,  500,  500,  500,  500, 1748,
+     1914, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1915, 1943,
+     1916, 1944, 1945, 1946, 1917, 1947, 1948, 1918, 1919, 1920,
+
+     1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958,
+     1959, 1960, 1961,  501,  516,  517,  517,  517,  517,  517,
+      517,  517, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969,
+     1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979,
+     1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989,
+     1990, 1991, 1992, 1993, 1994, 1995,  518,  521,  522,  522,
+      522,  522,  522,  522,  522, 1996, 1997, 1999, 2000, 2001,
+     2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011,
+     1998, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020,
+     2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029,  523,
+
+      526,  527,  527,  527,  527,  527,  527,  527, 2030, 2031,
+     2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041,
+     2042, 2043, 2044, 2045, 2046, 2047, 2048, 1887, 2049, 2050,
+     2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060,
+     2061, 2062,  528,  539, 2063, 2064, 2065, 2066, 2067,  542,
+      543,  543,  543,  543,  543,  543,  543,  539, 2068, 2069,
+     2070, 2071, 2072, 2074, 2075, 2076, 2077, 2078, 2079, 2080,
+     2081, 2082, 2083, 2084, 2085, 2086, 2073, 2087, 2088, 2089,
+     2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099,
+     2100,  544,  546, 2101, 2102, 2103, 2104, 2105,  549,  550,
+
+      550,  550,  550,  550,  550,  550,  546, 2106, 2107, 2108,
+     2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118,
+     2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2128,
+     2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138,
+      551,  554, 2139, 2140, 2141, 2142, 2143,  557,  558,  558,
+      558,  558,  558,  558,  558,  554, 2144, 2145, 2146, 1986,
+     1986, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155,
+     2156, 2157, 2000, 2000, 2158, 2159, 2160, 2161, 2162, 2163,
+     2164, 2165, 2166, 2167, 2168, 2169, 2170, 2172, 2173,  559,
+      561, 2174, 2175, 2176, 2177, 2178,  564,  565,  565,  565,
+
+      565,  565,  565,  565,  561, 2179, 2180, 2181, 2182, 2183,
+     2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2046,
+     2048, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201,
+     2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209,  566,  568,
+     2061, 2061, 2210, 2211, 2212,  571,  572,  572,  572,  572,
+      572,  572,  572,  568, 2213, 2214, 2215, 2216, 2217, 2218,
+     2219, 2220, 2075, 2075, 2221, 2222, 2223, 2224, 2225, 2226,
+     2227, 2228, 2229, 2230, 2231, 2232, 2233, 2236, 2237, 2238,
+     2239, 2240, 2241, 2242, 2243, 2244, 2245,  573,  575, 2246,
+     2247, 2248, 2249, 2250,  578,  579,  579,  579,  579,  579,
+
+      579,  579,  575, 2171, 2251, 2252, 2171, 2253, 2254, 2255,
+     2256, 2171, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264,
+     2235, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273,
+     2274, 2275, 2276, 2277, 2278, 2279,  580,  583,  584,  584,
+      584,  584,  584,  584,  584, 2280, 2281, 2282, 2283, 2284,
+     2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294,
+     2296, 2297, 2298, 2299, 2300, 2172, 2295, 2302, 2303, 2304,
+     2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313,  585,
+      589,  590,  590,  590,  590,  590,  590,  590, 2314, 2315,
+     2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323, 2324, 2325,
+
+     2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335,
+     2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345,
+     2346, 2347,  591,  594,  595,  595,  595,  595,  595,  595,
+      595, 2348, 2349, 2350, 2351, 2352, 2353, 2355, 2356, 2357,
+     2358, 2359, 2171, 2354, 2301, 2171, 2362, 2301, 2363, 2364,
+     2171, 2365, 2301, 2366, 2367, 2368, 2369, 2370, 2371, 2235,
+     2372, 2361, 2373, 2374, 2375,  596,  604, 2376, 2377,  604,
+     2378,  604,  604,  604,  604, 2379,  604,  604,  604,  604,
+      604,  604,  604,  604, 2380,  604,  604,  604, 2381, 2382,
+     2383, 2384, 2385, 2386,  604,  604, 2387, 2389, 2390, 2391,
+
+     2392, 2393, 2394, 2395, 2396, 2397, 2398, 2399, 2400, 2401,
+     2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411,
+      604,  606, 2412, 2413,  606, 2302,  606,  606,  606,  606,
+     2302,  606,  606,  606,  606,  606,  606,  606,  606, 2414,
+      606,  606,  606, 2415, 2416, 2417, 2419, 2420, 2420,  606,
+      606, 2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429,
+     2430, 2431, 2432, 2433, 2436, 2437, 2438, 2439, 2440, 2441,
+     2442, 2443, 2444, 2445, 2446,  606,  610,  611,  611,  611,
+      611,  611,  611,  611, 2388, 2447, 2448, 2388, 2449, 2450,
+     2451, 2452, 2388, 2453, 2454, 2455, 2456, 2457, 2458, 2459,
+
+     2301, 2435, 2460, 2301, 2461, 2462, 2463, 2418, 2301, 2465,
+     2418, 2466, 2466, 2467, 2468, 2418, 2469, 2361,  612,  615,
+      616,  616,  616,  616,  616,  616,  616, 2301, 2470, 2471,
+     2301, 2472, 2473, 2474, 2475, 2301, 2476, 2477, 2478, 2479,
+     2480, 2389, 2482, 2483, 2361, 2484, 2485, 2486, 2487, 2488,
+     1986, 2489, 2490, 2491, 2492, 2493, 2494, 2000, 2495, 2496,
+     2497,  617,  626,  627,  627,  627,  627,  627,  627,  627,
+     2498, 2499, 2500, 2415, 2501, 2502, 2503, 2506, 2504, 2508,
+     2509, 2510, 2511, 2512, 2513, 2505, 2514, 2515, 2516, 2519,
+     2388, 2520, 2481, 2388, 2521, 2481, 2522, 2523, 2388, 2524,
+
+     2481, 2061, 2525, 2526,  628,  352,  640, 2435,  352, 2518,
+     2527, 2528, 2529,  352,  352,  352,  352,  352,  352,  352,
+      352,  352,  352,  422,  423,  423,  423,  423,  423,  423,
+      423, 2530, 2075, 2531, 2532, 2533, 2534, 2535, 2536, 2461,
+     2537, 2538, 2539, 2542, 2540, 2507, 2544, 2545, 2507, 2546,
+     2547, 2541, 2548, 2507, 2549, 2550, 2551, 2552, 2553, 2482,
+     2482, 2554, 2555, 2556, 2557,  424,  423,  423,  423,  423,
+      423,  423,  423,  423, 2558, 2559, 2560, 2561,  423,  423,
+      423, 2563, 2566, 2567, 2568, 2562,  423,  423,  423,  423,
+      423,  423,  486,  487,  487,  487,  487,  487,  487,  487,
+
+     2564, 2569, 2570, 2571, 2572, 2573, 2574, 2565, 2575, 2576,
+     2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585, 2586,
+     2587, 2588, 2589, 2590, 2591, 2593, 2594, 2596, 2597, 2598,
+     2599, 2600, 2592, 2595,  488,  487,  487,  487,  487,  487,
+      487,  487,  487, 2601, 2602, 2603, 2604,  487,  487,  487,
+     2605, 2606, 2607, 2608, 2609,  487,  487,  487,  487,  487,
+      487,  499,  500,  500,  500,  500,  500,  500,  500, 2481,
+     2481, 2610, 2481, 2481, 2611, 2612, 2613, 2481, 2481, 2614,
+     2615, 2616, 2617, 2618, 2619, 2620, 2518, 2518, 2621, 2622,
+     2623, 2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632,
+
+     2633, 2634, 2635,  501,  500,  500,  500,  500,  500,  500,
+      500,  500, 2636, 2637, 2638, 2639,  500,  500,  500, 2640,
+     2641, 2642, 2643, 2644,  500,  500,  500,  500,  500,  500,
+      516,  517,  517,  517,  517,  517,  517,  517, 2645, 2646,
+     2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655, 2656,
+     2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666,
+     2667, 2670, 2671, 2672, 2668, 2673, 2674, 2675, 2669, 2676,
+     2677, 2678,  518,  517,  517,  517,  517,  517,  517,  517,
+      517, 2679, 2680, 2681, 2681,  517,  517,  517, 2682, 2638,
+     2686, 2687, 2688,  517,  517,  517,  517,  517,  517,  521,
+
+      522,  522,  522,  522,  522,  522,  522, 2683, 2689, 2690,
+     2691, 2684, 2692, 2693, 2694, 2685, 2695, 2696, 2697, 2697,
+     2698, 2666, 2699, 2700, 2701, 2702, 2703, 2704, 2705, 2706,
+     2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714, 2715, 2716,
+     2717,  523,  522,  522,  522,  522,  522,  522,  522,  522,
+     2718, 2719, 2720, 2721,  522,  522,  522, 2722, 2723, 2724,
+     2725, 2726,  522,  522,  522,  522,  522,  522,  526,  527,
+      527,  527,  527,  527,  527,  527, 2727, 2728, 2729, 2730,
+     2731, 2732, 2733, 2734, 2735, 2736, 2737, 2738, 2739, 2740,
+     2741, 2742, 2743, 2744, 2745, 2746, 2747, 2748, 2749, 2750,
+
+     2751, 2752, 2753, 2754, 2755, 2756, 2757, 2758, 1098, 1097,
+      528,  527,  527,  527,  527,  527,  527,  527,  527, 1096,
+     1095, 1094, 1093,  527,  527,  527, 1092, 1091, 1090, 1089,
+     1088,  527,  527,  527,  527,  527,  527,  539, 1087, 1086,
+     1085, 1084, 1083,  542,  543,  543,  543,  543,  543,  543,
+      543,  539, 1080, 1079, 1078, 1077, 1074, 1073, 1072, 1071,
+     1070, 1069, 1068, 1067, 1066, 1065, 1064, 1063, 1062, 1061,
+     1060, 1059, 1057, 1055, 1054, 1053, 1052, 1051, 1050, 1049,
+     1048, 1047, 1046, 1043, 1042,  544,  543, 1039, 1036, 1035,
+     1034, 1033, 1032, 1031, 1030, 1029, 1028, 1027,  543,  543,
+
+      543, 1026, 1025, 1024, 1023, 1022,  543,  543,  543,  543,
+      543,  543, 1021, 1020, 1019, 1016, 1015, 1014, 1011, 1010,
+     1009, 1008, 1007, 1006, 1005, 1004, 1003, 1002,  538,  546,
+     1001, 1000,  999,  998,  997,  549,  550,  550,  550,  550,
+      550,  550,  550,  546,  996,  995,  994,  993,  992,  991,
+      990,  989,  988,  987,  986,  985,  982,  981,  980,  979,
+      978,  977,  976,  975,  974,  973,  972,  971,  970,  969,
+      968,  967,  966,  965,  963,  962,  961,  551,  550,  960,
+      959,  958,  957,  956,  955,  954,  953,  950,  949,  948,
+      550,  550,  550,  947,  946,  945,  944,  943,  550,  550,
+
+      550,  550,  550,  550,  942,  941,  940,  939,  938,  937,
+      936,  935,  934,  933,  932,  931,  930,  929,  928,  925,
+      545,  554,  922,  921,  920,  919,  918,  557,  558,  558,
+      558,  558,  558,  558,  558,  554,  915,  914,  913,  912,
+      911,  727,  910,  909,  908,  907,  906,  905,  904,  903,
+      902,  901,  900,  897,  896,  895,  894,  893,  892,  891,
+      890,  889,  888,  887,  886,  885,  884,  883,  882,  559,
+      558,  881,  880,  879,  878,  877,  876,  875,  874,  873,
+      872,  871,  558,  558,  558,  870,  869,  868,  867,  866,
+      558,  558,  558,  558,  558,  558,  865,  864,  863,  860,
+
+      857,  856,  855,  854,  853,  850,  849,  848,  847,  846,
+      845,  844,  553,  561,  843,  842,  841,  840,  839,  564,
+      565,  565,  565,  565,  565,  565,  565,  561,  838,  837,
+      836,  833,  832,  831,  830,  829,  828,  827,  826,  825,
+      824,  823,  822,  821,  820,  819,  816,  815,  814,  813,
+      812,  811,  810,  809,  808,  807,  806,  805,  804,  803,
+      802,  566,  565,  801,  800,  574,  352,  567,  352,  560,
+      352,  553,  352,  799,  565,  565,  565,  545,  352,  538,
+      352,  798,  565,  565,  565,  565,  565,  565,  797,  796,
+      795,  794,  793,  792,  791,  790,  789,  788,  787,  786,
+
+      785,  784,  783,  782,  560,  568,  781,  780,  779,  495,
+      778,  571,  572,  572,  572,  572,  572,  572,  572,  568,
+      777,  776,  775,  774,  773,  772,  771,  770,  769,  768,
+      767,  766,  765,  763,  762,  761,  760,  759,  758,  757,
+      756,  755,  754,  753,  752,  751,  750,  746,  743,  742,
+      741,  740,  739,  573,  572,  736,  735,  734,  733,  732,
+      731,  730,  729,  728,  727,  726,  572,  572,  572,  725,
+      724,  723,  722,  721,  572,  572,  572,  572,  572,  572,
+      718,  717,  716,  715,  714,  713,  710,  709,  708,  707,
+      706,  704,  703,  702,  701,  700,  567,  575,  699,  698,
+
+      697,  696,  695,  578,  579,  579,  579,  579,  579,  579,
+      579,  575,  694,  693,  692,  691,  690,  689,  688,  687,
+      686,  685,  681,  678,  677,  676,  675,  674,  671,  670,
+      669,  668,  667,  666,  665,  664,  663,  662,  661,  660,
+      659,  658,  655,  654,  653,  580,  579,  652,  651,  650,
+      647,  646,  645,  644,  643,  642,  639,  638,  579,  579,
+      579,  637,  636,  358,  632,  631,  579,  579,  579,  579,
+      579,  579,  630,  629,  358,  623,  622,  619,  358,  618,
+      358,  603,  602,  601,  600,  599,  598,  597,  574,  583,
+      584,  584,  584,  584,  584,  584,  584,  358,  358,  358,
+
+      586,  574,  567,  560,  553,  552,  545,  538,  537,  536,
+      535,  534,  533,  532,  531,  530,  529,  358,  358,  358,
+      513,  512,  511,  510,  509,  508,  507,  506,  505,  503,
+      502,  585,  584,  584,  584,  584,  584,  584,  584,  584,
+      358,  495,  494,  493,  584,  584,  584,  492,  489,  358,
+      482,  481,  584,  584,  584,  584,  584,  584,  589,  590,
+      590,  590,  590,  590,  590,  590,  480,  470,  469,  468,
+      425,  358,  417,  417,  417,  402,  401,  400,  373,  359,
+      358,  351,  351,  351, 2759,   98,   98,   98,   98,   98,
+       98, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+
+      591,  590,  590,  590,  590,  590,  590,  590,  590, 2759,
+     2759, 2759, 2759,  590,  590,  590, 2759, 2759, 2759, 2759,
+     2759,  590,  590,  590,  590,  590,  590,  594,  595,  595,
+      595,  595,  595,  595,  595, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,  596,
+      595,  595,  595,  595,  595,  595,  595,  595, 2759, 2759,
+     2759, 2759,  595,  595,  595, 2759, 2759, 2759, 2759, 2759,
+      595,  595,  595,  595,  595,  595,  604, 2759, 2759,  604,
+
+     2759,  604,  604,  604,  604, 2759,  604,  604,  604,  604,
+      604,  604,  604,  604, 2759,  604,  604,  604, 2759, 2759,
+     2759, 2759, 2759, 2759,  604,  604, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+      604,  606, 2759, 2759,  606, 2759,  606,  606,  606,  606,
+     2759,  606,  606,  606,  606,  606,  606,  606,  606, 2759,
+      606,  606,  606, 2759, 2759, 2759, 2759, 2759, 2759,  606,
+      606, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+
+     2759, 2759, 2759, 2759, 2759,  606,  610,  611,  611,  611,
+      611,  611,  611,  611, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,  612,  611,
+      611,  611,  611,  611,  611,  611,  611, 2759, 2759, 2759,
+     2759,  611,  611,  611, 2759, 2759, 2759, 2759, 2759,  611,
+      611,  611,  611,  611,  611,  615,  616,  616,  616,  616,
+      616,  616,  616, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759,  617,  616,  616,
+      616,  616,  616,  616,  616,  616, 2759, 2759, 2759, 2759,
+      616,  616,  616, 2759, 2759, 2759, 2759, 2759,  616,  616,
+      616,  616,  616,  616,  626,  627,  627,  627,  627,  627,
+      627,  627, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759,  628,  627,  627,  627,
+      627,  627,  627,  627,  627, 2759, 2759, 2759, 2759,  627,
+
+      627,  627, 2759, 2759, 2759, 2759, 2759,  627,  627,  627,
+      627,  627,  627,  352,  640, 2759,  352, 2759, 2759, 2759,
+     2759,  352,  352,  352,  352,  352,  352,  352,  352,  352,
+      352, 1186, 1187, 1188, 1189, 2759, 1190, 1191, 2759, 2759,
+     1192, 2759, 1193, 2759, 2759, 1194, 2759, 2759, 1195, 2759,
+     1196, 1258, 1259, 1260, 1261, 2759, 1262, 1263, 2759, 2759,
+     1264, 2759, 1265, 2759, 2759, 1266, 2759, 2759, 1267, 2759,
+     1268,  184,  184,  184,  184,  184,  184,  184,  184,  184,
+      184,  184,  184,  197,  197,  197,  197,  197,  197,  197,
+      197,  197,  197,  197,  197,  215,  215,  215,  215,  215,
+
+      215,  215,  215,  215,  215,  215,  215,  221,  221,  221,
+      221,  221,  221,  221,  221,  221,  221,  221,  221,  227,
+      227,  227,  227,  227,  227,  227,  227,  227,  227,  227,
+      227,  242,  242,  242,  242,  242,  242,  242,  242,  242,
+      242,  242,  242,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  255,  255,  255,  255,  255,
+      255,  255,  255,  255,  255,  255,  255,  261,  261,  261,
+      261,  261,  261,  261,  261,  261,  261,  261,  261,  267,
+      267,  267,  267,  267,  267,  267,  267,  267,  267,  267,
+      267,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+
+      273,  273,  273,  279,  279,  279,  279,  279,  279,  279,
+      279,  279,  279,  279,  279,  286,  286,  286,  286,  286,
+      286,  286,  286,  286,  286,  286,  286,  292,  292,  292,
+      292,  292,  292,  292,  292,  292,  292,  292,  292,  307,
+      307,  307,  307,  307,  307,  307,  307,  307,  307,  307,
+      307,  313,  313,  313,  313,  313,  313,  313,  313,  313,
+      313,  313,  313,  324,  324,  324,  324,  324,  324,  324,
+      324,  324,  324,  324,  324,  335,  335,  335,  335,  335,
+      335,  335,  335,  335,  335,  335,  335,  343,  343,  343,
+      343,  343,  343,  343,  343,  343,  343,  343,  343,  352,
+
+      352, 2759,  352,  352,  352,  352,  352,  352,  352,  352,
+      352,  356, 2759, 2759,  356,  416, 2759, 2759,  416, 2759,
+      416,  416, 2759,  416,  416,  416,  416,  418,  418, 2759,
+      418,  418,  418,  418,  418,  418,  418,  418,  418,  483,
+      483, 2759,  483,  483,  483,  483,  483,  483,  483,  483,
+      483,  485,  485, 2759,  485,  485,  485,  485,  485,  485,
+      485,  485,  485,  496, 2759, 2759, 2759,  496,  496,  497,
+     2759, 2759,  497, 2759,  497,  497,  497,  497, 2759,  497,
+      497,  498,  498, 2759,  498,  498,  498,  498,  498,  498,
+      498,  498,  498,  504, 2759, 2759, 2759, 2759,  504,  504,
+
+      504,  504, 2759,  504,  504,  514, 2759, 2759,  514, 2759,
+      514,  514,  514,  514, 2759,  514,  514,  515,  515, 2759,
+      515,  515,  515,  515,  515,  515,  515,  515,  515,  519,
+     2759, 2759,  519, 2759,  519,  519,  519,  519, 2759,  519,
+      519,  520,  520, 2759,  520,  520,  520,  520,  520,  520,
+      520,  520,  520,  524, 2759, 2759,  524, 2759,  524,  524,
+      524,  524, 2759,  524,  524,  525,  525, 2759,  525,  525,
+      525,  525,  525,  525,  525,  525,  525,  538, 2759, 2759,
+      538,  538,  538,  538,  538,  538,  538,  538,  538,  540,
+      540, 2759,  540,  540,  540,  540,  540,  540,  540,  540,
+
+      540,  545, 2759, 2759,  545,  545,  545,  545,  545,  545,
+      545,  545,  545,  547,  547, 2759,  547,  547,  547,  547,
+      547,  547,  547,  547,  547,  553, 2759, 2759,  553,  553,
+      553,  553,  553,  553,  553,  553,  553,  555,  555, 2759,
+      555,  555,  555,  555,  555,  555,  555,  555,  555,  560,
+     2759, 2759,  560,  560,  560,  560,  560,  560,  560,  560,
+      560,  562,  562, 2759,  562,  562,  562,  562,  562,  562,
+      562,  562,  562,  567, 2759, 2759,  567,  567,  567,  567,
+      567,  567,  567,  567,  567,  569,  569, 2759,  569,  569,
+      569,  569,  569,  569,  569,  569,  569,  574, 2759, 2759,
+
+      574,  574,  574,  574,  574,  574,  574,  574,  574,  576,
+      576, 2759,  576,  576,  576,  576,  576,  576,  576,  576,
+      576,  581, 2759, 2759,  581, 2759,  581,  581,  581,  581,
+     2759,  581,  581,  582,  582, 2759,  582,  582,  582,  582,
+      582,  582,  582,  582,  582,  587, 2759, 2759,  587, 2759,
+      587,  587,  587,  587, 2759,  587,  587,  588,  588, 2759,
+      588,  588,  588,  588,  588,  588,  588,  588,  588,  592,
+     2759, 2759,  592, 2759,  592,  592,  592,  592, 2759,  592,
+      592,  593,  593, 2759,  593,  593,  593,  593,  593,  593,
+      593,  593,  593,  605, 2759, 2759,  605, 2759,  605,  605,
+
+     2759,  605, 2759,  605,  605,  607, 2759, 2759,  607, 2759,
+      607,  607, 2759,  607, 2759,  607,  607,  608, 2759, 2759,
+      608, 2759,  608,  608,  608,  608, 2759,  608,  608,  609,
+      609, 2759,  609,  609,  609,  609,  609,  609,  609,  609,
+      609,  613, 2759, 2759,  613, 2759,  613,  613,  613,  613,
+     2759,  613,  613,  614,  614, 2759,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  624, 2759, 2759,  624, 2759,
+      624,  624,  624,  624, 2759,  624,  624,  625,  625, 2759,
+      625,  625,  625,  625,  625,  625,  625,  625,  625,  633,
+      633, 2759,  633, 2759,  633,  633,  634, 2759, 2759,  634,
+
+     2759,  634,  634,  634,  634,  634,  634,  634,  635,  635,
+     2759,  635,  635,  635,  635,  635,  635,  635,  635,  635,
+      640, 2759,  640,  640, 2759,  640,  640, 2759, 2759, 2759,
+      640,  640,  641,  641,  641,  641,  641,  641,  641,  641,
+      641,  641,  641,  641,  352,  352, 2759,  352,  352,  352,
+      352,  352,  352,  352,  352,  352,  356, 2759, 2759,  356,
+      356, 2759,  356,  416, 2759, 2759,  416, 2759,  416,  416,
+     2759,  416,  416,  416,  416,  418,  418, 2759,  418,  418,
+      418,  418,  418,  418,  418,  418,  418,  483,  483, 2759,
+      483,  483,  483,  483,  483,  483,  483,  483,  483,  485,
+
+      485, 2759,  485,  485,  485,  485,  485,  485,  485,  485,
+      485,  496, 2759, 2759, 2759,  496,  496,  497, 2759, 2759,
+      497, 2759,  497,  497,  497,  497, 2759,  497,  497,  498,
+      498, 2759,  498,  498,  498,  498,  498,  498,  498,  498,
+      498,  504, 2759, 2759, 2759, 2759,  504,  504,  504,  504,
+     2759,  504,  504,  514, 2759, 2759,  514, 2759,  514,  514,
+      514,  514, 2759,  514,  514,  515,  515, 2759,  515,  515,
+      515,  515,  515,  515,  515,  515,  515,  519, 2759, 2759,
+      519, 2759,  519,  519,  519,  519, 2759,  519,  519,  520,
+      520, 2759,  520,  520,  520,  520,  520,  520,  520,  520,
+
+      520,  524, 2759, 2759,  524, 2759,  524,  524,  524,  524,
+     2759,  524,  524,  525,  525, 2759,  525,  525,  525,  525,
+      525,  525,  525,  525,  525,  538, 2759, 2759,  538,  538,
+      538,  538,  538,  538,  538,  538,  538,  539, 2759, 2759,
+      539,  539,  539,  539,  539,  539,  539,  539,  539,  540,
+      540, 2759,  540,  540,  540,  540,  540,  540,  540,  540,
+      540,  541,  541, 2759,  541,  541,  541,  541,  541,  541,
+      541,  541,  541,  545, 2759, 2759,  545,  545,  545,  545,
+      545,  545,  545,  545,  545,  546, 2759, 2759,  546,  546,
+      546,  546,  546,  546,  546,  546,  546,  547,  547, 2759,
+
+      547,  547,  547,  547,  547,  547,  547,  547,  547,  548,
+      548, 2759,  548,  548,  548,  548,  548,  548,  548,  548,
+      548,  553, 2759, 2759,  553,  553,  553,  553,  553,  553,
+      553,  553,  553,  554, 2759, 2759,  554,  554,  554,  554,
+      554,  554,  554,  554,  554,  555,  555, 2759,  555,  555,
+      555,  555,  555,  555,  555,  555,  555,  556,  556, 2759,
+      556,  556,  556,  556,  556,  556,  556,  556,  556,  560,
+     2759, 2759,  560,  560,  560,  560,  560,  560,  560,  560,
+      560,  561, 2759, 2759,  561,  561,  561,  561,  561,  561,
+      561,  561,  561,  562,  562, 2759,  562,  562,  562,  562,
+
+      562,  562,  562,  562,  562,  563,  563, 2759,  563,  563,
+      563,  563,  563,  563,  563,  563,  563,  567, 2759, 2759,
+      567,  567,  567,  567,  567,  567,  567,  567,  567,  568,
+     2759, 2759,  568,  568,  568,  568,  568,  568,  568,  568,
+      568,  569,  569, 2759,  569,  569,  569,  569,  569,  569,
+      569,  569,  569,  570,  570, 2759,  570,  570,  570,  570,
+      570,  570,  570,  570,  570,  574, 2759, 2759,  574,  574,
+      574,  574,  574,  574,  574,  574,  574,  575, 2759, 2759,
+      575,  575,  575,  575,  575,  575,  575,  575,  575,  576,
+      576, 2759,  576,  576,  576,  576,  576,  576,  576,  576,
+
+      576,  577,  577, 2759,  577,  577,  577,  577,  577,  577,
+      577,  577,  577,  581, 2759, 2759,  581, 2759,  581,  581,
+      581,  581, 2759,  581,  581,  582,  582, 2759,  582,  582,
+      582,  582,  582,  582,  582,  582,  582,  587, 2759, 2759,
+      587, 2759,  587,  587,  587,  587, 2759,  587,  587,  588,
+      588, 2759,  588,  588,  588,  588,  588,  588,  588,  588,
+      588,  592, 2759, 2759,  592, 2759,  592,  592,  592,  592,
+     2759,  592,  592,  593,  593, 2759,  593,  593,  593,  593,
+      593,  593,  593,  593,  593,  604, 2759, 2759,  604, 2759,
+      604,  604, 2759,  604, 2759,  604,  604,  605, 2759, 2759,
+
+      605, 2759,  605,  605, 2759,  605, 2759,  605,  605,  606,
+     2759, 2759,  606, 2759,  606,  606, 2759,  606, 2759,  606,
+      606,  607, 2759, 2759,  607, 2759,  607,  607, 2759,  607,
+     2759,  607,  607,  608, 2759, 2759,  608, 2759,  608,  608,
+      608,  608, 2759,  608,  608,  609,  609, 2759,  609,  609,
+      609,  609,  609,  609,  609,  609,  609,  613, 2759, 2759,
+      613, 2759,  613,  613,  613,  613, 2759,  613,  613,  614,
+      614, 2759,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  624, 2759, 2759,  624, 2759,  624,  624,  624,  624,
+     2759,  624,  624,  625,  625, 2759,  625,  625,  625,  625,
+
+      625,  625,  625,  625,  625,  633,  633, 2759,  633, 2759,
+      633,  633,  634, 2759, 2759,  634, 2759,  634,  634,  634,
+      634,  634,  634,  634,  635,  635, 2759,  635,  635,  635,
+      635,  635,  635,  635,  635,  635,  640, 2759,  640,  640,
+     2759,  640,  640, 2759, 2759, 2759,  640,  640,  641,  641,
+      641,  641,  641,  641,  641,  641,  641,  641,  641,  641,
+      416, 2759, 2759,  416, 2759,  416,  416, 2759,  416,  416,
+      416,  416,  964,  964, 2759,  964,  964,  964,  964,  964,
+      964,  964,  964,  964, 1164, 1164, 2759, 1164, 1164, 1164,
+     1164, 1164, 1164, 1164, 1164, 1164, 1236, 1236, 2759, 1236,
+
+     1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1323, 2759,
+     2759, 1323, 2759, 1323, 1323, 1323, 1323, 1323, 1323, 1323,
+     1328, 2759, 2759, 1328, 2759, 1328, 1328, 1328, 1328, 1328,
+     1328, 1328, 1389, 1389, 2759, 1389, 1389, 1389, 1389, 1389,
+     1389, 1389, 1389, 1389, 1421, 1421, 2759, 1421, 1421, 1421,
+     1421, 1421, 1421, 1421, 1421, 1421, 1456, 1456, 2759, 1456,
+     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1484, 2759,
+     2759, 1484, 2759, 1484, 1484, 2759, 1484, 2759, 1484, 1484,
+     1509, 1509, 2759, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
+     1509, 1509, 1577, 1577, 2759, 1577, 1577, 1577, 1577, 1577,
+
+     1577, 1577, 1577, 1577, 1636, 1636, 2759, 1636, 1636, 1636,
+     1636, 1636, 1636, 1636, 1636, 1636, 1641, 1641, 2759, 1641,
+     1641, 1641, 1641, 1641, 1641, 1641, 1641, 1641, 2171, 2171,
+     2759, 2171, 2171, 2171, 2171, 2171, 2171, 2171, 2171, 2171,
+     2234, 2234, 2759, 2234, 2234, 2234, 2234, 2234, 2234, 2234,
+     2234, 2234, 2301, 2301, 2759, 2301, 2301, 2301, 2301, 2301,
+     2301, 2301, 2301, 2301, 2360, 2360, 2759, 2360, 2360, 2360,
+     2360, 2360, 2360, 2360, 2360, 2360, 2388, 2388, 2759, 2388,
+     2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2418, 2418,
+     2759, 2418, 2418, 2418, 2418, 2418, 2418, 2418, 2418, 2418,
+
+     2434, 2434, 2759, 2434, 2434, 2434, 2434, 2434, 2434, 2434,
+     2434, 2434, 2464, 2464, 2759, 2464, 2464, 2464, 2464, 2464,
+     2464, 2464, 2464, 2464, 2481, 2481, 2759, 2481, 2481, 2481,
+     2481, 2481, 2481, 2481, 2481, 2481, 2507, 2507, 2759, 2507,
+     2507, 2507, 2507, 2507, 2507, 2507, 2507, 2507, 2517, 2517,
+     2759, 2517, 2517, 2517, 2517, 2517, 2517, 2517, 2517, 2517,
+     2543, 2543, 2759, 2543, 2543, 2543, 2543, 2543, 2543, 2543,
+     2543, 2543,   97, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759
     } ;
 
 static yyconst flex_int16_t yy_chk[6929] =
@@ -2358,10 +2432,10 @@ static yyconst flex_int16_t yy_chk[6929] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    2,    5,    9,    2,   10,
-       37,  927,   15,    5,   21,   22,   99,   39,   29,   99,
+       37,  930,   15,    5,   21,   22,   99,   39,   29,   99,
         9,    9,   10,   10,  103,  103,   15,   15,   15,   39,
        21,   22,   15,   37,   40,    2,    2,   29,    9,   37,
-       10,    2,   15,  929,   21,   22,   40,   29,    2,   29,
+       10,    2,   15,  931,   21,   22,   40,   29,    2,   29,
 
         2,    2,    3,    3,    3,    3,    3,    3,    3,    3,
         3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
@@ -2369,195 +2443,195 @@ static yyconst flex_int16_t yy_chk[6929] =
         3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
         3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
         3,    3,    3,    3,    3,    3,    3,    4,   65,   16,
-        4,    6,  125,   41,    6,   30,   42,  125,   49,  190,
-      104,  114,  114,   16,   16,   16,   38,  190,  114,   16,
+        4,    6,  125,   41,    6,   30,   42,  125,   49,  192,
+      104,  114,  114,   16,   16,   16,   38,  192,  114,   16,
        41,   65,   41,   42,   30,   42,   66,    4,    4,   16,
-       49,    6,    6,    4,   30,   50,   30,    6,   95,   38,
+       49,    6,    6,    4,   30,   50,   30,    6,  113,   38,
 
         4,   25,    4,    4,    6,   38,    6,    6,    7,   66,
-       95,    7,  104,  931,   25,  122,   96,   50,  113,   25,
-      932,    7,    7,    7,    7,   25,  134,   25,   96,   25,
-      113,  122,   25,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,  134,    7,    7,    7,  933,    7,   43,    7,
-        7,    7,    7,    7,  118,  118,    7,   13,   13,  384,
-       13,   26,   13,   69,   43,  384,   13,   13,   13,   13,
+      113,    7,  104,  117,   25,  933,   95,   50,  154,   25,
+      154,    7,    7,    7,    7,   25,  117,   25,   95,   25,
+      118,  118,   25,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,   95,    7,    7,    7,  121,    7,   43,    7,
+        7,    7,    7,    7,    7,  121,    7,   13,   13,  935,
+       13,   26,   13,   69,   43,  355,   13,   13,   13,   13,
        13,   13,   13,   13,   26,   44,   67,   43,   43,   26,
-       69,   43,   68,   69,   13,   26,  121,   26,  123,   26,
-       67,   44,   26,   69,   69,  121,   68,  123,   70,  126,
+       69,   43,   68,   69,   13,   26,  122,   26,  123,   26,
+       67,   44,   26,   69,   69,  126,   68,  123,   70,  382,
 
-       67,  140,  140,  934,   44,   44,   68,  153,   44,  153,
-       13,   14,   14,  126,   14,   70,   14,   85,   70,   81,
+       67,  152,  122,  382,   44,   44,   68,  355,   44,  126,
+       13,   14,   14,  152,   14,   70,   14,   85,   70,   81,
        14,   14,   14,   14,   14,   14,   14,   14,   70,   70,
-       82,   81,   86,   81,  135,  155,  935,   85,   14,   81,
-      155,  111,   82,  135,   82,   81,   85,   85,   85,  111,
-       82,  111,   86,  378,  111,  936,   82,  378,  111,  156,
-      156,   86,   86,   86,   14,   17,   17,   17,   17,   17,
+       82,   81,   86,   81,  141,  141,  936,   85,   14,   81,
+      134,  111,   82,  135,   82,   81,   85,   85,   85,  111,
+       82,  111,   86,  134,  111,  164,   82,  938,  111,  135,
+      164,   86,   86,   86,   14,   17,   17,   17,   17,   17,
        17,   17,   17,   17,   17,   17,   17,   17,   17,   17,
        17,   17,   17,   17,   17,   17,   17,   17,   17,   17,
        17,   17,   17,   17,   17,   17,   17,   17,   17,   17,
 
        17,   17,   17,   17,   17,   17,   17,   17,   17,   17,
        17,   17,   17,   17,   17,   17,   17,   17,   17,   17,
-       19,   19,   91,   19,  183,   19,  116,  183,   92,   19,
-       19,   19,   19,   19,   19,   19,   19,   19,  116,  116,
-      116,  139,   91,  151,  139,   91,   91,   19,   92,  139,
-       91,   92,   92,  164,  938,  151,   92,  105,  105,  105,
-      105,  105,  105,  105,  105,  112,  160,  164,  112,  152,
-      152,  112,  112,   19,   20,   20,  152,   20,  171,   20,
-      364,  364,  160,   20,   20,   20,   20,   20,   20,   20,
-       20,   20,  119,  119,  171,  120,  124,  119,  408,  120,
-
-      124,   20,  119,  131,  408,  428,  428,  119,  120,  124,
-      136,  131,  124,  131,  136,  132,  131,  939,  132,  163,
-      131,  132,  132,  136,  163,  940,  136,   20,   23,   23,
+       19,   19,   91,   19,  805,   19,  805,   96,   92,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,  161,   96,
+      136,  165,   91,  157,  157,   91,   91,   19,   92,  136,
+       91,   92,   92,   96,  161,  165,   92,  105,  105,  105,
+      105,  105,  105,  105,  105,  112,  173,  939,  112,  153,
+      153,  112,  112,   19,   20,   20,  153,   20,  131,   20,
+      116,  131,  173,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,  116,  116,  116,  119,  119,  160,  120,  124,
+
+      119,   20,  120,  124,  156,  119,  160,  940,  131,  131,
+      119,  120,  124,  133,  131,  124,  133,  156,  941,  133,
+      133,  131,  156,  131,  131,  367,  367,   20,   23,   23,
        23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
        23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
        23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
        23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
        23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
-       23,   23,   23,   31,   31,  444,   31,  130,   31,  444,
-      130,  941,   31,   31,   31,   31,   31,   31,   31,   31,
-
-       31,  142,  142,  142,  142,  142,  142,  142,  142,  150,
-       31,  149,  150,  154,  942,  150,  150,  130,  130,  149,
-      159,  149,  944,  130,  149,  154,  154,  154,  149,  159,
-      130,  158,  130,  130,  161,  158,   31,   32,   32,  450,
-       32,  945,   32,  161,  158,  450,   32,   32,   32,   32,
-       32,   32,   32,   32,   32,  157,  157,  467,  162,  168,
-      157,  170,  162,  467,   32,  157,  170,  168,  172,  168,
-      157,  162,  168,  175,  162,  169,  168,  172,  169,  240,
-      196,  169,  169,  196,  319,  245,  175,  319,  948,  175,
-       32,   33,   33,  240,   33,  949,   33,  196,  177,  245,
-
-       33,   33,   33,   33,   33,   33,   33,   33,   33,  173,
-      246,  177,  334,  173,  177,  334,  347,  477,   33,  347,
-      477,  352,  173,  950,  246,  173,  186,  186,  186,  186,
-      186,  186,  186,  186,  198,  198,  198,  198,  198,  198,
-      198,  198,  943,  943,   33,   34,   34,  630,   34,  214,
-       34,  251,  214,  630,   34,   34,   34,   34,   34,   34,
-       34,   34,   34,  352,  220,  251,  214,  220,  628,  951,
-      664,  628,   34,  216,  216,  216,  216,  216,  216,  216,
-      216,  220,  222,  222,  222,  222,  222,  222,  222,  222,
-      226,  253,  258,  226,  357,  664,  954,  672,   34,   35,
-
-       35,  672,   35,  357,   35,  253,  258,  226,   35,   35,
-       35,   35,   35,   35,   35,   35,   35,  228,  228,  228,
-      228,  228,  228,  228,  228,  241,   35,  244,  241,  244,
-      247,  259,  250,  247,  250,  257,  264,  257,  254,  956,
-      421,  254,  241,  244,  670,  259,  958,  247,  250,  421,
-      264,  257,   35,   36,   36,  254,   36,  260,   36,  263,
-      260,  263,   36,   36,   36,   36,   36,   36,   36,   36,
-       36,  265,  270,  266,  260,  263,  266,  269,  271,  269,
-       36,  272,  276,  670,  272,  265,  270,  275,  278,  275,
-      266,  278,  271,  269,  285,  959,  276,  285,  272,  531,
-
-      538,  413,  855,  275,  413,  278,   36,   45,   45,  413,
-       45,  285,   45,  531,  538,  855,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,  280,  280,  280,  280,  280,
-      280,  280,  280,  546,   45,  287,  287,  287,  287,  287,
-      287,  287,  287,  961,  553,  560,  291,  546,  853,  291,
-      293,  293,  293,  293,  293,  293,  293,  293,  553,  560,
-       45,   46,   46,  291,   46,  306,   46,  567,  306,  733,
-       46,   46,   46,   46,   46,   46,   46,   46,   46,  962,
-      312,  567,  306,  312,  648,  853,  727,  648,   46,  308,
-      308,  308,  308,  308,  308,  308,  308,  312,  314,  314,
-
-      314,  314,  314,  314,  314,  314,  323,  709,  733,  323,
-      709,  727,  963,  735,   46,   47,   47,  735,   47,  793,
-       47,  793,  964,  323,   47,   47,   47,   47,   47,   47,
-       47,   47,   47,  325,  325,  325,  325,  325,  325,  325,
-      325,  858,   47,  353,  353,  353,  353,  353,  353,  353,
-      353,  760,  871,  858,  386,  916,  452,  386,  398,  452,
-      491,  398,  827,  491,  921,  871,  827,  760,   47,   48,
-       48,  386,   48,  452,   48,  968,  921,  491,   48,   48,
-       48,   48,   48,   48,   48,   48,   48,  889,  398,  398,
-      969,  889,  916,  970,  398,  971,   48,  972,  960,  973,
-
-      974,  398,  947,  398,  398,  418,  418,  418,  418,  418,
-      418,  418,  418,  480,  480,  480,  480,  480,  480,  480,
-      480,  947,   48,   51,   51,  975,   51,  960,   51,  976,
-      977,  980,   51,   51,   51,   51,   51,   51,   51,   51,
-       51,  493,  493,  493,  493,  493,  493,  493,  493,  508,
-       51,  918,  508,  510,  510,  510,  510,  510,  510,  510,
-      510,  981,  513,  982,  918,  513,  508,  515,  515,  515,
-      515,  515,  515,  515,  515,  984,   51,   52,   52,  513,
-       52,  518,   52,  985,  518,  986,   52,   52,   52,   52,
-       52,   52,   52,   52,   52,  987,  533,  540,  518,  533,
-
-      540,  988,  928,  989,   52,  520,  520,  520,  520,  520,
-      520,  520,  520,  533,  540,  928,  548,  990,  555,  548,
-      562,  555,  569,  562,  992,  569,  993,  994,  995,  997,
-       52,   53,   53,  548,   53,  555,   53,  562,  999,  569,
-       53,   53,   53,   53,   53,   53,   53,   53,   53,  575,
-     1000, 1002,  575, 1003, 1004, 1005,  998, 1006,   53,  581,
-      586,  602,  581,  586,  602,  998,  575,  577,  577,  577,
-      577,  577,  577,  577,  577, 1007,  581,  586,  602, 1008,
-     1009, 1010, 1011, 1012,   53,   54,   54, 1014,   54, 1015,
-       54, 1016, 1017, 1018,   54,   54,   54,   54,   54,   54,
-
-       54,   54,   54,  583,  583,  583,  583,  583,  583,  583,
-      583, 1019,   54,  588,  588,  588,  588,  588,  588,  588,
-      588,  604,  604,  604,  604,  604,  604,  604,  604,  607,
-      618, 1020,  607,  618, 1021, 1022, 1023, 1024,   54,   55,
-       55, 1025,   55, 1027,   55, 1028,  607,  618,   55,   55,
-       55,   55,   55,   55,   55,   55,   55,  609,  609,  609,
-      609,  609,  609,  609,  609, 1029,   55,  620,  620,  620,
-      620,  620,  620,  620,  620, 1031, 1032, 1034,  978,  978,
-      978,  978,  979,  979,  979,  979, 1036, 1037, 1035, 1041,
-     1042, 1044,   55,   56,   56,  978,   56, 1035,   56,  979,
-
-     1045, 1046,   56,   56,   56,   56,   56,   56,   56,   56,
-       56, 1047, 1026, 1048, 1026, 1040, 1026, 1049, 1040, 1050,
-       56, 1026, 1040, 1040, 1037, 1038, 1038, 1038, 1038, 1052,
-     1053, 1054, 1039, 1039, 1039, 1039, 1055, 1056, 1058, 1059,
-     1060, 1061, 1038, 1063, 1064, 1065,   56,   57,   57, 1039,
-       57, 1066,   57, 1067, 1068, 1069,   57,   57,   57,   57,
-       57,   57,   57,   57,   57, 1070, 1071, 1072, 1073, 1075,
-     1076, 1077, 1078, 1079,   57, 1080, 1081, 1082, 1083, 1084,
-     1085, 1086, 1087, 1089, 1087, 1090, 1087, 1091, 1092, 1093,
-     1094, 1087, 1095, 1096, 1097, 1098, 1099, 1100, 1102, 1103,
-
-       57,   58,   58, 1105,   58, 1106,   58, 1107, 1108, 1110,
-       58,   58,   58,   58,   58,   58,   58,   58,   58, 1111,
-     1109, 1112, 1113, 1114, 1115, 1092, 1116, 1117,   58, 1109,
-     1118, 1119, 1120, 1122, 1123, 1116, 1124, 1127, 1128, 1129,
-     1130, 1131, 1132, 1133, 1124, 1134, 1135, 1135, 1135, 1135,
-     1139, 1140, 1141, 1142,   58,   59,   59, 1144,   59, 1145,
-       59, 1147, 1148, 1135,   59,   59,   59,   59,   59,   59,
-       59,   59,   59, 1137, 1137, 1137, 1137, 1146,   59, 1149,
-     1150, 1151,   59, 1152, 1153, 1154, 1146, 1156, 1157, 1158,
-     1137, 1159, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166,
-
-     1167, 1169, 1168, 1170, 1162, 1171, 1172, 1173,   59,   60,
-       60, 1175,   60, 1176,   60, 1168, 1177, 1178,   60,   60,
-       60,   60,   60,   60,   60,   60,   60, 1179, 1180, 1181,
-     1182, 1184,   60, 1185, 1186, 1188,   60, 1189, 1190, 1191,
-     1192, 1193, 1194, 1195, 1196, 1197, 1198, 1200, 1202, 1208,
-     1204, 1204, 1204, 1204, 1201, 1209, 1203, 1210, 1211, 1213,
-     1214, 1215,   60,   61,   61, 1216,   61, 1204,   61, 1217,
-     1215, 1218,   61,   61,   61,   61,   61,   61,   61,   61,
-       61, 1219, 1201, 1203, 1206, 1206, 1206, 1206, 1220, 1221,
-       61, 1201, 1222, 1224, 1226, 1227, 1203, 1228, 1228, 1229,
-
-     1230, 1206, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238,
-     1239, 1231, 1240, 1241, 1242, 1244,   61,   62,   62, 1245,
-       62, 1237,   62, 1246, 1247, 1248,   62,   62,   62,   62,
-       62,   62,   62,   62,   62, 1249, 1250, 1251, 1253, 1254,
-     1255, 1257, 1256, 1258,   62, 1256, 1259, 1260, 1261, 1262,
-     1256, 1263, 1264, 1265, 1267, 1268, 1269, 1270, 1271, 1272,
-     1273, 1274, 1266, 1275, 1276, 1277, 1278, 1280, 1281, 1282,
-       62,   63,   63, 1284,   63, 1285,   63, 1286, 1287, 1289,
-       63,   63,   63,   63,   63,   63,   63,   63,   63, 1291,
-     1266, 1293, 1294, 1295, 1296, 1298, 1299, 1300,   63, 1266,
-
-     1302, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312,
-     1314, 1306, 1315, 1317, 1318, 1319, 1320, 1321, 1322, 1323,
-     1324, 1320, 1325, 1326,   63,   64,   64, 1327,   64, 1320,
-       64, 1328, 1329, 1330,   64,   64,   64,   64,   64,   64,
-       64,   64,   64, 1331, 1332, 1333, 1334, 1335, 1336, 1337,
-     1338, 1339,   64, 1340, 1343, 1344, 1345, 1346, 1347, 1348,
-     1349, 1350, 1351, 1332, 1352, 1353, 1353, 1354, 1356, 1357,
-     1358, 1359, 1360, 1361, 1362, 1363, 1364, 1367,   64,   71,
+       23,   23,   23,   31,   31,  450,   31,  185,   31,  450,
+      185,  176,   31,   31,   31,   31,   31,   31,   31,   31,
+
+       31,  132,  159,  137,  176,  140,  159,  137,  140,  132,
+       31,  132,  944,  140,  132,  159,  137,  772,  132,  137,
+      143,  143,  143,  143,  143,  143,  143,  143,  151,  242,
+      162,  151,  174,  772,  151,  151,   31,   32,   32,  162,
+       32,  174,   32,  242,  155,  247,   32,   32,   32,   32,
+       32,   32,   32,   32,   32,  150,  155,  155,  155,  247,
+      949,  158,  158,  150,   32,  150,  158,  170,  150,  163,
+      172,  158,  150,  163,  178,  170,  158,  170,  198,  248,
+      170,  198,  163,  172,  170,  163,  321,  178,  172,  321,
+       32,   33,   33,  248,   33,  198,   33,  246,  950,  246,
+
+       33,   33,   33,   33,   33,   33,   33,   33,   33,  171,
+      175,  177,  171,  246,  175,  171,  171,  179,   33,  336,
+      433,  433,  336,  175,  177,  216,  175,  177,  216,  253,
+      179,  951,  952,  179,  188,  188,  188,  188,  188,  188,
+      188,  188,  216,  253,   33,   34,   34,  388,   34,  350,
+       34,  953,  350,  388,   34,   34,   34,   34,   34,   34,
+       34,   34,   34,  200,  200,  200,  200,  200,  200,  200,
+      200,  255,   34,  218,  218,  218,  218,  218,  218,  218,
+      218,  252,  260,  252,  222,  255,  955,  222,  224,  224,
+      224,  224,  224,  224,  224,  224,  260,  252,   34,   35,
+
+       35,  222,   35,  228,   35,  872,  228,  956,   35,   35,
+       35,   35,   35,   35,   35,   35,   35,  872,  243,  249,
+      228,  243,  249,  259,  673,  259,   35,  230,  230,  230,
+      230,  230,  230,  230,  230,  243,  249,  261,  256,  259,
+      262,  256,  413,  262,  265,  266,  265,  267,  413,  673,
+      957,  261,   35,   36,   36,  256,   36,  262,   36,  266,
+      265,  267,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,  268,  272,  271,  268,  271,  273,  277,  274,  277,
+       36,  274,  278,  360,  280,  958,  272,  280,  268,  271,
+      273,  426,  360,  277,  287,  274,  278,  287,  456,  474,
+
+      426,  280,  869,  637,  456,  474,   36,   45,   45,  637,
+       45,  287,   45,  959,  961,  869,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,  282,  282,  282,  282,  282,
+      282,  282,  282,  738,   45,  289,  289,  289,  289,  289,
+      289,  289,  289,  962,  484,  538,  293,  484,  965,  293,
+      295,  295,  295,  295,  295,  295,  295,  295,  738,  538,
+       45,   46,   46,  293,   46,  308,   46,  545,  308,  966,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,  845,
+      314,  545,  308,  314,  635,  845,  967,  635,   46,  310,
+      310,  310,  310,  310,  310,  310,  310,  314,  316,  316,
+
+      316,  316,  316,  316,  316,  316,  325,  553,  560,  325,
+      656,  883,  968,  656,   46,   47,   47,  883,   47,  971,
+       47,  553,  560,  325,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,  327,  327,  327,  327,  327,  327,  327,
+      327,  973,   47,  356,  356,  356,  356,  356,  356,  356,
+      356,  567,  418,  574,  390,  418,  458,  390,  403,  458,
+      418,  403,  681,  679,  886,  567,  681,  574,   47,   48,
+       48,  390,   48,  458,   48,  960,  960,  886,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,  719,  403,  403,
+      719,  746,  744,  840,  403,  746,   48,  840,  975,  976,
+
+      978,  403,  679,  403,  403,  423,  423,  423,  423,  423,
+      423,  423,  423,  487,  487,  487,  487,  487,  487,  487,
+      487,  904,   48,   51,   51,  904,   51,  498,   51,  964,
+      498,  744,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,  910,  515,  942,  498,  515,  867,  910,  964,  942,
+       51,  500,  500,  500,  500,  500,  500,  500,  500,  515,
+      517,  517,  517,  517,  517,  517,  517,  517,  520,  937,
+      979,  520,  980,  946,  981,  985,   51,   52,   52,  946,
+       52,  937,   52,  867,  986,  520,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,  522,  522,  522,  522,  522,
+
+      522,  522,  522,  525,   52,  987,  525,  527,  527,  527,
+      527,  527,  527,  527,  527,  934,  540,  988,  547,  540,
+      525,  547,  555,  932,  945,  555,  989,  990,  934,  991,
+       52,   53,   53,  540,   53,  547,   53,  945,  992,  555,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,  562,
+      569,  576,  562,  569,  576,  948,  582,  993,   53,  582,
+      932,  948,  977,  994,  995,  998,  562,  569,  576,  999,
+     1000, 1002, 1003,  582,  584,  584,  584,  584,  584,  584,
+      584,  584, 1004, 1005,   53,   54,   54, 1006,   54,  588,
+       54,  977,  588, 1007,   54,   54,   54,   54,   54,   54,
+
+       54,   54,   54, 1008,  593, 1010,  588,  593, 1011, 1012,
+     1013, 1015,   54,  590,  590,  590,  590,  590,  590,  590,
+      590,  593,  595,  595,  595,  595,  595,  595,  595,  595,
+      609, 1016, 1017,  609, 1018, 1019, 1020, 1022,   54,   55,
+       55, 1023,   55, 1018,   55, 1024, 1025,  609,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,  611,  611,  611,
+      611,  611,  611,  611,  611,  614,   55, 1026,  614,  616,
+      616,  616,  616,  616,  616,  616,  616, 1027,  625, 1028,
+     1029,  625,  614,  627,  627,  627,  627,  627,  627,  627,
+      627, 1030,   55,   56,   56,  625,   56, 1031,   56, 1032,
+
+     1034, 1035,   56,   56,   56,   56,   56,   56,   56,   56,
+       56,  996,  996,  996,  996,  997,  997,  997,  997, 1036,
+       56, 1037, 1038, 1039, 1040, 1041, 1042, 1043,  996, 1044,
+     1045, 1046,  997, 1046, 1047, 1046, 1048, 1049, 1050, 1052,
+     1046, 1053, 1055, 1057, 1056, 1058,   56,   57,   57, 1062,
+       57, 1063,   57, 1056, 1065, 1066,   57,   57,   57,   57,
+       57,   57,   57,   57,   57, 1067, 1059, 1059, 1059, 1059,
+     1060, 1060, 1060, 1060,   57, 1068, 1069, 1061, 1070, 1071,
+     1061, 1073, 1058, 1059, 1061, 1061, 1074, 1060, 1075, 1076,
+     1077, 1079, 1080, 1081, 1082, 1083, 1084, 1086, 1087, 1088,
+
+       57,   58,   58, 1089,   58, 1090,   58, 1091, 1092, 1093,
+       58,   58,   58,   58,   58,   58,   58,   58,   58, 1094,
+     1095, 1096, 1098, 1099, 1100, 1101, 1102, 1103,   58, 1104,
+     1105, 1106, 1107, 1108, 1109, 1110, 1111, 1110, 1113, 1110,
+     1114, 1115, 1116, 1117, 1110, 1118, 1119, 1120, 1121, 1122,
+     1123, 1124, 1126, 1127,   58,   59,   59, 1129,   59, 1130,
+       59, 1131, 1132, 1134,   59,   59,   59,   59,   59,   59,
+       59,   59,   59, 1135, 1133, 1136, 1137, 1138,   59, 1116,
+     1139, 1140,   59, 1133, 1141, 1142, 1143, 1144, 1146, 1147,
+     1140, 1148, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1148,
+
+     1158, 1159, 1164, 1165, 1166, 1167, 1169, 1171,   59,   60,
+       60, 1172,   60, 1173,   60, 1174, 1171, 1175,   60,   60,
+       60,   60,   60,   60,   60,   60,   60, 1160, 1160, 1160,
+     1160, 1170,   60, 1176, 1177, 1178,   60, 1162, 1162, 1162,
+     1162, 1179, 1170, 1180, 1160, 1181, 1183, 1170, 1184, 1185,
+     1186, 1186, 1187, 1188, 1162, 1190, 1189, 1191, 1192, 1193,
+     1194, 1196,   60,   61,   61, 1189,   61, 1197,   61, 1195,
+     1198, 1199,   61,   61,   61,   61,   61,   61,   61,   61,
+       61, 1200, 1195, 1202, 1203, 1204, 1205, 1206, 1207, 1208,
+       61, 1209, 1211, 1212, 1213, 1215, 1216, 1217, 1218, 1219,
+
+     1220, 1221, 1222, 1223, 1225, 1226, 1228, 1230, 1229, 1236,
+     1231, 1237, 1238, 1239, 1241, 1243,   61,   62,   62, 1244,
+       62, 1245,   62, 1246, 1243, 1247,   62,   62,   62,   62,
+       62,   62,   62,   62,   62, 1248, 1229, 1231, 1232, 1232,
+     1232, 1232, 1242, 1249,   62, 1229, 1234, 1234, 1234, 1234,
+     1231, 1250, 1252, 1242, 1253, 1232, 1254, 1256, 1242, 1257,
+     1258, 1258, 1259, 1234, 1260, 1262, 1261, 1263, 1264, 1265,
+       62,   63,   63, 1266,   63, 1261,   63, 1267, 1268, 1269,
+       63,   63,   63,   63,   63,   63,   63,   63,   63, 1270,
+     1267, 1271, 1272, 1274, 1275, 1276, 1277, 1278,   63, 1279,
+
+     1280, 1281, 1283, 1284, 1285, 1286, 1287, 1288, 1286, 1289,
+     1290, 1291, 1292, 1286, 1293, 1294, 1295, 1297, 1298, 1299,
+     1300, 1301, 1302, 1303,   63,   64,   64, 1304,   64, 1305,
+       64, 1306, 1307, 1308,   64,   64,   64,   64,   64,   64,
+       64,   64,   64, 1309, 1311, 1297, 1312, 1313, 1315, 1316,
+     1317, 1318,   64, 1320, 1297, 1322, 1324, 1325, 1326, 1327,
+     1329, 1330, 1331, 1333, 1335, 1336, 1338, 1339, 1340, 1341,
+     1342, 1343, 1344, 1345, 1338, 1346, 1348, 1349,   64,   71,
        71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
        71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
 
@@ -2570,567 +2644,567 @@ static yyconst flex_int16_t yy_chk[6929] =
        75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
        75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
        75,   75,   75,   75,   75,   75,   75,   75,   75,   77,
-       77, 1365,   77, 1366,   77, 1368, 1370, 1371,   77,   77,
-
-       77,   77,   77,   77,   77,   77,   77, 1369, 1372, 1373,
-     1374, 1375, 1377, 1378, 1379, 1369,   77, 1379, 1365, 1380,
-     1366, 1381, 1379, 1382, 1384, 1385, 1386, 1387, 1388, 1384,
-     1389, 1365, 1390, 1366, 1391, 1392, 1393, 1384, 1394, 1396,
-     1397, 1398,   77,   78,   78, 1395,   78, 1399,   78, 1400,
-     1401, 1402,   78,   78,   78,   78,   78,   78,   78,   78,
-       78, 1403, 1406, 1407, 1395, 1408, 1409, 1410, 1411, 1412,
-       78, 1413, 1414, 1415, 1416, 1416, 1417, 1419, 1420, 1421,
-     1422, 1423, 1424, 1425, 1426, 1428, 1429, 1431, 1432, 1434,
-     1435, 1437, 1439, 1440, 1442, 1442,   78,   79,   79, 1443,
-
-       79, 1445,   79, 1447, 1448, 1449,   79,   79,   79,   79,
-       79,   79,   79,   79,   79, 1450, 1451, 1452, 1453, 1455,
-       79, 1457, 1458, 1459,   79, 1460, 1461, 1462, 1463, 1464,
-     1465, 1466, 1467, 1469, 1471, 1472, 1470, 1470, 1470, 1470,
-     1473, 1474, 1476, 1470, 1477, 1478, 1479, 1480, 1481, 1482,
-       79,   80,   80, 1470,   80, 1483,   80, 1484, 1485, 1486,
-       80,   80,   80,   80,   80,   80,   80,   80,   80, 1475,
-     1475, 1475, 1475, 1487,   80, 1488, 1475, 1489,   80, 1493,
-     1492, 1494, 1495, 1492, 1496, 1497, 1475, 1492, 1499, 1501,
-     1502, 1504, 1505, 1506, 1504, 1507, 1509, 1508, 1510, 1511,
-
-     1504, 1504, 1512, 1508,   80,   83,   83, 1508,   83, 1513,
-       83, 1514, 1515, 1508,   83,   83,   83,   83,   83,   83,
-       83,   83,   83, 1516, 1517, 1518, 1519, 1520, 1521, 1522,
-     1523, 1524,   83, 1525, 1526, 1527, 1528, 1529, 1530, 1531,
-     1533, 1535, 1536, 1537, 1534, 1534, 1534, 1534, 1539, 1540,
-     1541, 1534, 1542, 1543, 1544, 1545, 1546, 1547,   83,   84,
-       84, 1534,   84, 1548,   84, 1549, 1550, 1551,   84,   84,
-       84,   84,   84,   84,   84,   84,   84, 1538, 1538, 1538,
-     1538, 1552, 1555, 1556, 1538, 1555,   84, 1557, 1558, 1555,
-     1559, 1560, 1562, 1564, 1538, 1565, 1567, 1568, 1569, 1567,
-
-     1570, 1572, 1573, 1574, 1575, 1567, 1567, 1576, 1577, 1578,
-     1579, 1581,   84,   87,   87,   87,   87,   87,   87,   87,
+       77, 1351,   77, 1352,   77, 1353, 1355, 1356,   77,   77,
+
+       77,   77,   77,   77,   77,   77,   77, 1354, 1357, 1358,
+     1359, 1360, 1354, 1361, 1362, 1363,   77, 1364, 1365, 1366,
+     1354, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375,
+     1376, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387,
+     1388, 1368,   77,   78,   78, 1390,   78, 1392,   78, 1389,
+     1389, 1393,   78,   78,   78,   78,   78,   78,   78,   78,
+       78, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1403, 1404,
+       78, 1405, 1406, 1407, 1408, 1409, 1401, 1402, 1410, 1405,
+     1411, 1412, 1413, 1415, 1416, 1417, 1418, 1419, 1417, 1420,
+     1423, 1424, 1425, 1417, 1426, 1427,   78,   79,   79, 1428,
+
+       79, 1429,   79, 1401, 1402, 1430,   79,   79,   79,   79,
+       79,   79,   79,   79,   79, 1431, 1401, 1402, 1422, 1432,
+       79, 1433, 1434, 1422,   79, 1435, 1436, 1437, 1438, 1439,
+     1440, 1422, 1441, 1442, 1443, 1446, 1447, 1448, 1449, 1450,
+     1451, 1452, 1453, 1454, 1435, 1455, 1456, 1456, 1457, 1459,
+       79,   80,   80, 1460,   80, 1461,   80, 1462, 1463, 1464,
+       80,   80,   80,   80,   80,   80,   80,   80,   80, 1465,
+     1466, 1468, 1469, 1471,   80, 1472, 1474, 1475,   80, 1477,
+     1479, 1480, 1482, 1482, 1483, 1485, 1487, 1488, 1489, 1490,
+     1491, 1492, 1493, 1495, 1497, 1498, 1499, 1500, 1501, 1502,
+
+     1503, 1504, 1505, 1506,   80,   83,   83, 1507,   83, 1508,
+       83, 1509, 1511, 1513,   83,   83,   83,   83,   83,   83,
+       83,   83,   83, 1512, 1512, 1512, 1512, 1514, 1515, 1516,
+     1512, 1517,   83, 1518, 1519, 1519, 1519, 1519, 1520, 1521,
+     1512, 1519, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529,
+     1530, 1519, 1531, 1532, 1533, 1537, 1538, 1539,   83,   84,
+       84, 1540,   84, 1541,   84, 1543, 1545, 1546,   84,   84,
+       84,   84,   84,   84,   84,   84,   84, 1536, 1548, 1549,
+     1536, 1548, 1550, 1551, 1536, 1552,   84, 1548, 1548, 1553,
+     1554, 1552, 1555, 1556, 1557, 1552, 1558, 1559, 1560, 1561,
+
+     1562, 1552, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570,
+     1571, 1572,   84,   87,   87,   87,   87,   87,   87,   87,
        87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
        87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
        87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
        87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
        87,   87,   87,   87,   87,   87,   87,   87,   89,   89,
-     1582,   89, 1583,   89, 1584, 1585, 1586,   89,   89,   89,
-       89,   89,   89,   89,   89,   89, 1571, 1588, 1592, 1594,
-     1595, 1596, 1571, 1597, 1598,   89, 1571, 1599, 1600, 1601,
-
-     1602, 1603, 1571, 1606, 1607, 1608, 1609, 1610, 1611, 1612,
-     1617, 1618, 1607, 1614, 1614, 1614, 1614, 1619, 1625, 1626,
-     1627,   89,   90,   90, 1629,   90, 1630,   90, 1631, 1632,
-     1614,   90,   90,   90,   90,   90,   90,   90,   90,   90,
-     1615, 1633, 1634, 1621, 1621, 1621, 1621, 1635, 1615,   90,
-     1615, 1636, 1628, 1622, 1615, 1628, 1615, 1615, 1615, 1615,
-     1621, 1622, 1637, 1622, 1628, 1638, 1639, 1622, 1640, 1641,
-     1622, 1622, 1622, 1644, 1645,   90,   93,   93, 1646,   93,
-     1647,   93, 1649, 1650,   93,   93,   93,   93,   93,   93,
-       93,   93,   93,   93, 1651, 1652, 1653, 1654, 1655, 1656,
-
-     1657, 1658, 1659,   93, 1660, 1661, 1662, 1663, 1664, 1665,
-     1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1676, 1677,
-     1678, 1679, 1680, 1681, 1682, 1687, 1688, 1677, 1689,   93,
-       94,   94, 1694,   94, 1695,   94, 1696, 1698,   94,   94,
-       94,   94,   94,   94,   94,   94,   94,   94, 1684, 1684,
-     1684, 1684, 1685, 1699, 1700, 1697, 1701,   94, 1697, 1702,
-     1685, 1703, 1685, 1704, 1705, 1684, 1685, 1697, 1685, 1685,
-     1685, 1685, 1706, 1707, 1708, 1709, 1690, 1690, 1690, 1690,
-     1710, 1713, 1714,   94,  141,  141,  141,  141,  141,  141,
-      141,  141,  141, 1690, 1691, 1715, 1716, 1718, 1719, 1720,
-
-     1721, 1722, 1691, 1723, 1691, 1724, 1725, 1726, 1691, 1727,
-     1728, 1691, 1691, 1691, 1729, 1730, 1731, 1732, 1733, 1734,
-     1736, 1737, 1738, 1739, 1740, 1741, 1742,  141,  185,  185,
-      185,  185,  185,  185,  185,  185, 1744, 1746, 1747, 1748,
-     1749, 1751, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761,
-     1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772,
-     1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782,
-      185,  197,  197,  197,  197,  197,  197,  197,  197, 1783,
-     1784, 1785, 1786, 1788, 1789, 1790, 1791, 1792, 1793, 1794,
-     1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804,
-
-     1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814,
-     1815, 1816, 1817,  197,  215,  215,  215,  215,  215,  215,
-      215,  215, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825,
-     1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1837, 1838,
-     1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848,
-     1849, 1850, 1851, 1852, 1853, 1854,  215,  221,  221,  221,
-      221,  221,  221,  221,  221, 1855, 1856, 1857, 1858, 1859,
-     1860, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870,
-     1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880,
-     1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889,  221,
-
-      227,  227,  227,  227,  227,  227,  227,  227, 1890, 1891,
-     1892, 1893, 1894, 1895, 1897, 1898, 1899, 1900, 1901, 1903,
-     1904, 1905, 1906, 1908, 1909, 1910, 1911, 1912, 1913, 1914,
-     1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924,
-     1925, 1926,  227,  242, 1927, 1928, 1929, 1930, 1931,  242,
-      242,  242,  242,  242,  242,  242,  242,  242, 1932, 1933,
-     1934, 1935, 1936, 1937, 1938, 1939, 1941, 1942, 1943, 1946,
-     1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1958,
-     1959, 1960, 1961, 1963, 1964, 1964, 1965, 1966, 1967, 1968,
-     1969,  242,  248, 1970, 1971, 1972, 1973, 1975,  248,  248,
-
-      248,  248,  248,  248,  248,  248,  248, 1977, 1978, 1979,
-     1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989,
-     1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999,
-     2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2010,
-      248,  255, 2011, 2012, 2015, 2017, 2018,  255,  255,  255,
-      255,  255,  255,  255,  255,  255, 2019, 2020, 2021, 2022,
-     2020, 2023, 2024, 2025, 2027, 2020, 2028, 2029, 2030, 2032,
-     2033, 2033, 2034, 2035, 2020, 2036, 2037, 2038, 2039, 2040,
-     2041, 2042, 2044, 2047, 2048, 2049, 2050, 2051, 2052,  255,
-      261, 2053, 2054, 2055, 2056, 2058,  261,  261,  261,  261,
-
-      261,  261,  261,  261,  261, 2059, 2060, 2062, 2063, 2064,
-     2065, 2066, 2067, 2068, 2069, 2071, 2072, 2073, 2074, 2075,
-     2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084, 2086,
-     2087, 2080, 2088, 2089, 2090, 2091, 2092, 2093,  261,  267,
-     2094, 2095, 2096, 2097, 2098,  267,  267,  267,  267,  267,
-      267,  267,  267,  267, 2099, 2100, 2101, 2102, 2103, 2104,
-     2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2115, 2116,
-     2117, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2128,
-     2129, 2130, 2131, 2132, 2133, 2134, 2135,  267,  273, 2136,
-     2138, 2139, 2140, 2141,  273,  273,  273,  273,  273,  273,
-
-      273,  273,  273, 2137, 2143, 2144, 2145, 2146, 2144, 2145,
-     2137, 2147, 2148, 2144, 2145, 2149, 2150, 2151, 2152, 2153,
-     2154, 2155, 2144, 2145, 2156, 2157, 2158, 2159, 2160, 2161,
-     2163, 2164, 2165, 2169, 2170, 2172,  273,  279,  279,  279,
-      279,  279,  279,  279,  279, 2173, 2174, 2175, 2176, 2177,
-     2179, 2180, 2182, 2183, 2184, 2185, 2187, 2188, 2190, 2191,
-     2192, 2194, 2195, 2198, 2199, 2200, 2201, 2204, 2205, 2206,
-     2207, 2208, 2210, 2211, 2213, 2214, 2215, 2216, 2217,  279,
-      286,  286,  286,  286,  286,  286,  286,  286, 2218, 2219,
-     2220, 2221, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230,
-
-     2228, 2232, 2233, 2235, 2236, 2228, 2237, 2238, 2240, 2241,
-     2243, 2244, 2245, 2247, 2228, 2248, 2251, 2252, 2253, 2254,
-     2257, 2260,  286,  292,  292,  292,  292,  292,  292,  292,
-      292, 2258, 2259, 2261, 2258, 2259, 2263, 2264, 2265, 2258,
-     2259, 2265, 2266, 2267, 2268, 2269, 2265, 2270, 2258, 2259,
-     2271, 2272, 2273, 2274, 2276, 2277, 2278, 2279, 2281, 2282,
-     2283, 2284, 2285, 2286, 2287,  292,  303, 2289, 2290,  303,
-     2291,  303,  303,  303,  303, 2292,  303,  303,  303,  303,
-      303,  303,  303,  303, 2294,  303,  303,  303, 2295, 2296,
-     2297, 2298, 2299, 2301,  303,  303, 2302, 2303, 2305, 2306,
-
-     2308, 2309, 2310, 2311, 2310, 2313, 2316, 2317, 2319, 2320,
-     2321, 2310, 2322, 2323, 2326, 2327, 2329, 2330, 2331, 2332,
-      303,  304, 2324, 2334,  304, 2324,  304,  304,  304,  304,
-     2324,  304,  304,  304,  304,  304,  304,  304,  304, 2324,
-      304,  304,  304, 2325, 2335, 2336, 2325, 2337, 2338,  304,
-      304, 2325, 2339, 2341, 2342, 2343, 2345, 2346, 2348, 2349,
-     2325, 2350, 2351, 2350, 2352, 2353, 2356, 2352, 2357, 2359,
-     2350, 2360, 2352, 2361, 2363,  304,  307,  307,  307,  307,
-      307,  307,  307,  307, 2364, 2365, 2366, 2367, 2368, 2369,
-     2371, 2372, 2373, 2375, 2376, 2377, 2378, 2380, 2381, 2383,
-
-     2384, 2376, 2385, 2386, 2387, 2388, 2388, 2390, 2391, 2392,
-     2394, 2395, 2396, 2399, 2400, 2402, 2403, 2404,  307,  313,
-      313,  313,  313,  313,  313,  313,  313, 2397, 2398, 2406,
-     2397, 2398, 2407, 2408, 2409, 2397, 2398, 2411, 2412, 2407,
-     2414, 2415, 2416, 2417, 2397, 2398, 2418, 2419, 2419, 2421,
-     2422, 2423, 2425, 2428, 2429, 2430, 2431, 2432, 2433, 2434,
-     2435,  313,  324,  324,  324,  324,  324,  324,  324,  324,
-     2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2446,
-     2447, 2448, 2449, 2450, 2451, 2453, 2454, 2455, 2456, 2457,
-     2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467,
-
-     2468, 2469, 2471, 2472,  324,  343,  343, 2473,  343, 2474,
-     2475, 2476, 2479,  343,  343,  343,  343,  343,  343,  343,
-      343,  343,  343,  417,  417,  417,  417,  417,  417,  417,
-      417, 2482, 2484, 2485, 2486, 2487, 2488, 2489, 2490, 2493,
-     2494, 2495, 2497, 2498, 2502, 2505, 2507, 2508, 2509, 2510,
-     2511, 2512, 2513, 2516, 2517, 2518, 2520, 2521, 2523, 2525,
-     2527, 2530, 2531, 2532, 2534,  417,  419,  419,  419,  419,
-      419,  419,  419,  419, 2535, 2537, 2539, 2542,  419,  419,
-      419, 2543, 2544, 2546, 2548, 2550,  419,  419,  419,  419,
-      419,  419,  479,  479,  479,  479,  479,  479,  479,  479,
-
-     2552, 2553, 2555, 2557, 2559, 2560, 2561, 2563, 2565, 2567,
-     2570, 2572,  925,  924,  923,  922,  920,  919,  917,  915,
-      914,  913,  912,  911,  910,  908,  907,  905,  904,  903,
-      902,  901,  899,  898,  479,  481,  481,  481,  481,  481,
-      481,  481,  481,  897,  896,  895,  894,  481,  481,  481,
-      893,  892,  891,  888,  887,  481,  481,  481,  481,  481,
-      481,  492,  492,  492,  492,  492,  492,  492,  492,  886,
-      885,  884,  883,  882,  881,  880,  879,  878,  876,  875,
-      874,  873,  872,  870,  868,  867,  866,  865,  864,  863,
-      862,  861,  860,  859,  857,  856,  854,  852,  851,  850,
-
-      849,  848,  847,  492,  494,  494,  494,  494,  494,  494,
-      494,  494,  845,  844,  842,  841,  494,  494,  494,  840,
-      839,  838,  836,  835,  494,  494,  494,  494,  494,  494,
-      509,  509,  509,  509,  509,  509,  509,  509,  834,  833,
-      832,  831,  830,  829,  826,  825,  824,  823,  822,  821,
-      820,  819,  818,  817,  816,  814,  813,  812,  811,  810,
-      808,  807,  806,  805,  802,  801,  800,  799,  798,  796,
-      792,  791,  509,  511,  511,  511,  511,  511,  511,  511,
-      511,  790,  789,  788,  787,  511,  511,  511,  786,  785,
-      784,  782,  781,  511,  511,  511,  511,  511,  511,  514,
-
-      514,  514,  514,  514,  514,  514,  514,  779,  778,  777,
-      776,  775,  774,  773,  771,  770,  769,  768,  767,  766,
-      765,  764,  763,  762,  761,  759,  758,  757,  756,  755,
-      754,  753,  752,  751,  750,  749,  746,  745,  744,  743,
-      742,  514,  516,  516,  516,  516,  516,  516,  516,  516,
-      741,  740,  739,  738,  516,  516,  516,  737,  736,  734,
-      732,  731,  516,  516,  516,  516,  516,  516,  519,  519,
-      519,  519,  519,  519,  519,  519,  730,  729,  728,  726,
-      725,  724,  723,  722,  721,  720,  719,  718,  717,  716,
-      715,  714,  713,  712,  710,  708,  707,  706,  705,  704,
-
-      703,  702,  701,  700,  699,  698,  697,  696,  695,  694,
-      519,  521,  521,  521,  521,  521,  521,  521,  521,  693,
-      692,  691,  690,  521,  521,  521,  689,  688,  687,  686,
-      683,  521,  521,  521,  521,  521,  521,  535,  682,  681,
-      680,  679,  678,  535,  535,  535,  535,  535,  535,  535,
-      535,  535,  677,  676,  675,  674,  673,  671,  669,  668,
-      667,  666,  665,  663,  662,  661,  660,  659,  658,  657,
-      656,  655,  654,  653,  652,  651,  649,  647,  646,  645,
-      644,  643,  642,  641,  640,  535,  537,  639,  638,  637,
-      636,  632,  631,  625,  624,  623,  616,  615,  537,  537,
-
-      537,  614,  613,  612,  611,  596,  537,  537,  537,  537,
-      537,  537,  595,  594,  593,  592,  591,  590,  579,  572,
-      570,  565,  563,  558,  556,  551,  549,  545,  537,  542,
-      543,  541,  536,  534,  530,  542,  542,  542,  542,  542,
-      542,  542,  542,  542,  529,  528,  527,  526,  525,  524,
-      523,  522,  506,  505,  504,  503,  502,  501,  500,  499,
-      498,  496,  495,  489,  487,  486,  485,  484,  483,  482,
-      475,  474,  473,  472,  471,  470,  469,  542,  544,  468,
-      466,  465,  464,  463,  462,  461,  460,  458,  457,  456,
-      544,  544,  544,  455,  454,  453,  451,  449,  544,  544,
-
-      544,  544,  544,  544,  448,  447,  446,  445,  443,  442,
-      441,  440,  439,  438,  437,  436,  435,  434,  433,  432,
-      544,  550,  431,  430,  429,  427,  426,  550,  550,  550,
-      550,  550,  550,  550,  550,  550,  425,  424,  423,  422,
-      420,  415,  414,  410,  409,  407,  406,  405,  404,  403,
-      402,  401,  400,  399,  397,  396,  395,  394,  392,  391,
-      390,  389,  388,  387,  385,  383,  382,  381,  380,  550,
-      552,  379,  377,  376,  375,  374,  373,  372,  371,  370,
-      369,  368,  552,  552,  552,  367,  366,  365,  363,  362,
-      552,  552,  552,  552,  552,  552,  361,  360,  359,  358,
-
-      356,  351,  350,  346,  344,  340,  339,  338,  337,  335,
-      331,  330,  552,  557,  329,  328,  326,  321,  320,  557,
-      557,  557,  557,  557,  557,  557,  557,  557,  318,  316,
-      315,  309,  302,  301,  300,  299,  298,  297,  296,  294,
-      288,  282,  281,  274,  268,  262,  256,  252,  249,  243,
-      239,  238,  237,  236,  235,  234,  233,  232,  231,  229,
-      223,  557,  559,  217,  212,  211,  210,  209,  208,  207,
-      206,  205,  204,  202,  559,  559,  559,  201,  199,  194,
-      193,  192,  559,  559,  559,  559,  559,  559,  191,  189,
-      187,  181,  180,  179,  176,  174,  166,  165,  148,  147,
-
-      146,  144,  138,  133,  559,  564,  128,  127,  117,  115,
-      110,  564,  564,  564,  564,  564,  564,  564,  564,  564,
+     1573,   89, 1574,   89, 1575, 1576, 1577,   89,   89,   89,
+       89,   89,   89,   89,   89,   89, 1579, 1580, 1580, 1580,
+     1580, 1581, 1582, 1583, 1580,   89, 1584, 1585, 1586, 1586,
+
+     1586, 1586, 1587, 1588, 1580, 1586, 1589, 1590, 1591, 1592,
+     1593, 1594, 1595, 1596, 1597, 1586, 1598, 1599, 1600, 1604,
+     1605,   89,   90,   90, 1606,   90, 1607,   90, 1608, 1610,
+     1612,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+     1603, 1613, 1615, 1603, 1616, 1615, 1617, 1603, 1618,   90,
+     1619, 1615, 1615, 1620, 1621, 1622, 1619, 1623, 1624, 1625,
+     1619, 1626, 1627, 1629, 1630, 1631, 1619, 1632, 1633, 1634,
+     1636, 1640, 1642, 1643, 1644,   90,   93,   93, 1645,   93,
+     1646,   93, 1647, 1648,   93,   93,   93,   93,   93,   93,
+       93,   93,   93,   93, 1649, 1650, 1651, 1654, 1655, 1656,
+
+     1657, 1658, 1659,   93, 1660, 1656, 1661, 1662, 1664, 1664,
+     1664, 1664, 1667, 1656, 1668, 1669, 1670, 1671, 1677, 1673,
+     1673, 1673, 1673, 1678, 1679, 1664, 1681, 1682, 1683,   93,
+       94,   94, 1684,   94, 1685,   94, 1673, 1686,   94,   94,
+       94,   94,   94,   94,   94,   94,   94,   94, 1665, 1680,
+     1687, 1688, 1680, 1689, 1690, 1691, 1665,   94, 1665, 1692,
+     1674, 1680, 1665, 1693, 1665, 1665, 1665, 1665, 1674, 1696,
+     1674, 1697, 1698, 1699, 1674, 1701, 1702, 1674, 1674, 1674,
+     1703, 1704, 1705,   94,  142,  142,  142,  142,  142,  142,
+      142,  142,  142, 1706, 1707, 1708, 1709, 1710, 1711, 1712,
+
+     1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722,
+     1723, 1724, 1725, 1728, 1729, 1731, 1732, 1733, 1734, 1735,
+     1736, 1738, 1738, 1738, 1738, 1741, 1742,  142,  187,  187,
+      187,  187,  187,  187,  187,  187, 1730, 1739, 1738, 1743,
+     1744, 1745, 1730, 1750, 1751, 1739, 1752, 1739, 1754, 1753,
+     1730, 1739, 1753, 1739, 1739, 1739, 1739, 1755, 1756, 1757,
+     1758, 1753, 1746, 1746, 1746, 1746, 1759, 1760, 1761, 1762,
+      187,  199,  199,  199,  199,  199,  199,  199,  199, 1746,
+     1747, 1763, 1764, 1765, 1766, 1769, 1770, 1771, 1747, 1772,
+     1747, 1774, 1775, 1776, 1747, 1777, 1778, 1747, 1747, 1747,
+
+     1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788,
+     1789, 1790, 1792,  199,  217,  217,  217,  217,  217,  217,
+      217,  217, 1793, 1794, 1795, 1796, 1797, 1798, 1800, 1802,
+     1803, 1804, 1805, 1807, 1810, 1811, 1812, 1813, 1814, 1815,
+     1816, 1817, 1818, 1819, 1820, 1822, 1823, 1824, 1825, 1826,
+     1827, 1828, 1829, 1830, 1831, 1832,  217,  223,  223,  223,
+      223,  223,  223,  223,  223, 1833, 1834, 1835, 1836, 1837,
+     1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847,
+     1834, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857,
+     1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866,  223,
+
+      229,  229,  229,  229,  229,  229,  229,  229, 1867, 1868,
+     1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878,
+     1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1889, 1890,
+     1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1901,
+     1902, 1903,  229,  244, 1904, 1905, 1906, 1907, 1908,  244,
+      244,  244,  244,  244,  244,  244,  244,  244, 1909, 1910,
+     1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920,
+     1921, 1922, 1923, 1924, 1925, 1926, 1913, 1928, 1929, 1930,
+     1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940,
+     1941,  244,  250, 1942, 1943, 1944, 1945, 1946,  250,  250,
+
+      250,  250,  250,  250,  250,  250,  250, 1947, 1948, 1949,
+     1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959,
+     1960, 1961, 1963, 1964, 1965, 1966, 1967, 1969, 1970, 1971,
+     1972, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982,
+      250,  257, 1983, 1984, 1985, 1986, 1987,  257,  257,  257,
+      257,  257,  257,  257,  257,  257, 1988, 1989, 1990, 1991,
+     1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001,
+     2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011,
+     2013, 2014, 2015, 2018, 2020, 2021, 2022, 2023, 2024,  257,
+      263, 2025, 2026, 2027, 2028, 2030,  263,  263,  263,  263,
+
+      263,  263,  263,  263,  263, 2031, 2032, 2033, 2035, 2036,
+     2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045,
+     2047, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057,
+     2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065,  263,  269,
+     2066, 2067, 2068, 2069, 2070,  269,  269,  269,  269,  269,
+      269,  269,  269,  269, 2071, 2072, 2073, 2074, 2075, 2076,
+     2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085, 2086,
+     2088, 2089, 2090, 2093, 2095, 2096, 2097, 2099, 2100, 2101,
+     2102, 2103, 2105, 2106, 2107, 2108, 2110,  269,  275, 2111,
+     2111, 2112, 2113, 2114,  275,  275,  275,  275,  275,  275,
+
+      275,  275,  275, 2098, 2115, 2116, 2098, 2117, 2118, 2119,
+     2120, 2098, 2122, 2125, 2126, 2127, 2128, 2129, 2130, 2131,
+     2098, 2132, 2133, 2134, 2135, 2136, 2137, 2139, 2140, 2141,
+     2143, 2144, 2145, 2146, 2147, 2148,  275,  281,  281,  281,
+      281,  281,  281,  281,  281, 2149, 2150, 2151, 2152, 2153,
+     2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164,
+     2165, 2166, 2167, 2168, 2170, 2171, 2164, 2172, 2173, 2174,
+     2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183,  281,
+      288,  288,  288,  288,  288,  288,  288,  288, 2184, 2185,
+     2186, 2187, 2188, 2190, 2191, 2192, 2193, 2194, 2195, 2196,
+
+     2197, 2198, 2199, 2200, 2202, 2203, 2204, 2206, 2207, 2208,
+     2209, 2210, 2211, 2212, 2213, 2214, 2215, 2216, 2218, 2219,
+     2220, 2221,  288,  294,  294,  294,  294,  294,  294,  294,
+      294, 2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230,
+     2231, 2233, 2234, 2227, 2235, 2234, 2236, 2235, 2237, 2238,
+     2234, 2239, 2235, 2240, 2241, 2242, 2243, 2244, 2245, 2234,
+     2246, 2235, 2247, 2248, 2249,  294,  305, 2250, 2251,  305,
+     2253,  305,  305,  305,  305, 2254,  305,  305,  305,  305,
+      305,  305,  305,  305, 2255,  305,  305,  305, 2259, 2260,
+     2262, 2263, 2264, 2265,  305,  305, 2266, 2267, 2268, 2269,
+
+     2270, 2272, 2273, 2275, 2276, 2277, 2278, 2280, 2281, 2282,
+     2283, 2284, 2286, 2287, 2288, 2290, 2291, 2294, 2295, 2296,
+      305,  306, 2297, 2300,  306, 2301,  306,  306,  306,  306,
+     2302,  306,  306,  306,  306,  306,  306,  306,  306, 2303,
+      306,  306,  306, 2304, 2306, 2307, 2309, 2310, 2311,  306,
+      306, 2312, 2313, 2314, 2315, 2316, 2317, 2319, 2320, 2321,
+     2322, 2323, 2324, 2325, 2327, 2328, 2329, 2331, 2332, 2334,
+     2335, 2336, 2337, 2339, 2340,  306,  309,  309,  309,  309,
+      309,  309,  309,  309, 2326, 2341, 2342, 2326, 2343, 2345,
+     2346, 2347, 2326, 2349, 2350, 2353, 2354, 2355, 2356, 2359,
+
+     2360, 2326, 2362, 2360, 2363, 2365, 2366, 2367, 2360, 2368,
+     2367, 2369, 2370, 2371, 2372, 2367, 2373, 2360,  309,  315,
+      315,  315,  315,  315,  315,  315,  315, 2361, 2374, 2375,
+     2361, 2376, 2378, 2379, 2380, 2361, 2381, 2383, 2384, 2385,
+     2387, 2388, 2389, 2390, 2361, 2391, 2392, 2394, 2395, 2396,
+     2397, 2399, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407,
+     2409,  315,  326,  326,  326,  326,  326,  326,  326,  326,
+     2410, 2411, 2413, 2414, 2416, 2417, 2418, 2419, 2418, 2421,
+     2424, 2425, 2427, 2428, 2429, 2418, 2430, 2431, 2433, 2436,
+     2434, 2437, 2435, 2434, 2438, 2435, 2440, 2441, 2434, 2442,
+
+     2435, 2443, 2445, 2446,  326,  345,  345, 2434,  345, 2435,
+     2447, 2448, 2449,  345,  345,  345,  345,  345,  345,  345,
+      345,  345,  345,  422,  422,  422,  422,  422,  422,  422,
+      422, 2450, 2451, 2452, 2453, 2455, 2456, 2457, 2459, 2460,
+     2462, 2463, 2464, 2465, 2464, 2466, 2467, 2470, 2466, 2471,
+     2473, 2464, 2474, 2466, 2475, 2477, 2478, 2479, 2480, 2481,
+     2482, 2483, 2485, 2487, 2488,  422,  424,  424,  424,  424,
+      424,  424,  424,  424, 2489, 2490, 2491, 2492,  424,  424,
+      424, 2494, 2496, 2497, 2499, 2492,  424,  424,  424,  424,
+      424,  424,  486,  486,  486,  486,  486,  486,  486,  486,
+
+     2495, 2500, 2502, 2503, 2504, 2505, 2506, 2495, 2507, 2507,
+     2509, 2510, 2511, 2513, 2514, 2515, 2516, 2519, 2521, 2523,
+     2524, 2525, 2526, 2527, 2528, 2530, 2531, 2532, 2533, 2535,
+     2536, 2538, 2528, 2531,  486,  488,  488,  488,  488,  488,
+      488,  488,  488, 2539, 2540, 2541, 2542,  488,  488,  488,
+     2543, 2543, 2545, 2546, 2547,  488,  488,  488,  488,  488,
+      488,  499,  499,  499,  499,  499,  499,  499,  499, 2517,
+     2518, 2549, 2517, 2518, 2552, 2553, 2554, 2517, 2518, 2555,
+     2556, 2557, 2558, 2559, 2560, 2561, 2517, 2518, 2562, 2563,
+     2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573,
+
+     2575, 2576, 2577,  499,  501,  501,  501,  501,  501,  501,
+      501,  501, 2578, 2579, 2580, 2582,  501,  501,  501, 2583,
+     2584, 2585, 2586, 2587,  501,  501,  501,  501,  501,  501,
+      516,  516,  516,  516,  516,  516,  516,  516, 2588, 2589,
+     2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597, 2598, 2599,
+     2600, 2601, 2602, 2603, 2605, 2606, 2607, 2608, 2609, 2610,
+     2612, 2614, 2617, 2618, 2612, 2623, 2624, 2625, 2612, 2626,
+     2627, 2628,  516,  518,  518,  518,  518,  518,  518,  518,
+      518, 2629, 2632, 2633, 2634,  518,  518,  518, 2636, 2637,
+     2642, 2645, 2646,  518,  518,  518,  518,  518,  518,  521,
+
+      521,  521,  521,  521,  521,  521,  521, 2640, 2651, 2652,
+     2653, 2640, 2654, 2655, 2656, 2640, 2657, 2660, 2661, 2662,
+     2664, 2665, 2667, 2668, 2669, 2670, 2672, 2673, 2675, 2678,
+     2679, 2680, 2682, 2683, 2684, 2685, 2686, 2688, 2689, 2691,
+     2694,  521,  523,  523,  523,  523,  523,  523,  523,  523,
+     2695, 2696, 2698, 2700,  523,  523,  523, 2701, 2704, 2706,
+     2708, 2709,  523,  523,  523,  523,  523,  523,  526,  526,
+      526,  526,  526,  526,  526,  526, 2711, 2712, 2715, 2717,
+     2719, 2720, 2721, 2722, 2723, 2725, 2727, 2728, 2729, 2731,
+     2733, 2734, 2736, 2737, 2738, 2740, 2741, 2742, 2744, 2745,
+
+     2747, 2748, 2749, 2750, 2751, 2753, 2755, 2756,  929,  928,
+      526,  528,  528,  528,  528,  528,  528,  528,  528,  927,
+      926,  924,  923,  528,  528,  528,  921,  920,  919,  918,
+      917,  528,  528,  528,  528,  528,  528,  542,  915,  914,
+      913,  912,  911,  542,  542,  542,  542,  542,  542,  542,
+      542,  542,  909,  908,  907,  906,  903,  902,  901,  900,
+      899,  898,  897,  896,  895,  894,  893,  891,  890,  889,
+      888,  887,  885,  882,  881,  880,  879,  878,  877,  876,
+      875,  874,  873,  871,  870,  542,  544,  868,  866,  865,
+      864,  863,  862,  861,  859,  858,  856,  855,  544,  544,
+
+      544,  854,  853,  852,  850,  849,  544,  544,  544,  544,
+      544,  544,  848,  847,  846,  844,  843,  842,  839,  838,
+      837,  836,  835,  834,  833,  832,  831,  830,  544,  549,
+      829,  827,  826,  825,  824,  549,  549,  549,  549,  549,
+      549,  549,  549,  549,  823,  822,  820,  819,  818,  817,
+      814,  813,  812,  811,  810,  808,  804,  803,  802,  801,
+      800,  799,  798,  797,  796,  794,  793,  791,  790,  789,
+      788,  787,  786,  785,  783,  782,  781,  549,  551,  780,
+      779,  778,  777,  776,  775,  774,  773,  771,  770,  769,
+      551,  551,  551,  768,  767,  766,  765,  764,  551,  551,
+
+      551,  551,  551,  551,  763,  762,  761,  759,  757,  756,
+      755,  754,  753,  752,  751,  750,  749,  748,  747,  745,
+      551,  557,  743,  742,  741,  740,  739,  557,  557,  557,
+      557,  557,  557,  557,  557,  557,  737,  736,  735,  734,
+      733,  732,  731,  730,  729,  728,  727,  726,  725,  724,
+      723,  722,  720,  718,  717,  716,  715,  714,  713,  712,
+      711,  710,  709,  708,  707,  706,  705,  704,  703,  557,
+      559,  702,  701,  700,  699,  698,  697,  696,  694,  692,
+      691,  690,  559,  559,  559,  689,  688,  687,  686,  685,
+      559,  559,  559,  559,  559,  559,  684,  683,  682,  680,
+
+      678,  677,  676,  675,  674,  672,  671,  670,  669,  668,
+      667,  666,  559,  564,  665,  664,  663,  662,  661,  564,
+      564,  564,  564,  564,  564,  564,  564,  564,  660,  659,
+      657,  655,  654,  653,  652,  651,  650,  649,  648,  647,
+      646,  645,  644,  643,  639,  638,  632,  631,  630,  623,
+      622,  621,  620,  619,  618,  603,  602,  601,  600,  599,
+      598,  564,  566,  597,  586,  579,  577,  572,  570,  565,
+      563,  558,  556,  552,  566,  566,  566,  550,  548,  543,
+      541,  537,  566,  566,  566,  566,  566,  566,  536,  535,
+      534,  533,  532,  531,  530,  529,  513,  512,  511,  510,
+
+      509,  508,  507,  506,  566,  571,  505,  503,  502,  496,
+      494,  571,  571,  571,  571,  571,  571,  571,  571,  571,
+      493,  492,  491,  490,  489,  482,  481,  480,  479,  478,
+      477,  476,  475,  473,  472,  471,  470,  469,  468,  467,
+      466,  464,  463,  462,  461,  460,  459,  457,  455,  454,
+      453,  452,  451,  571,  573,  449,  448,  447,  446,  445,
+      444,  443,  442,  441,  440,  439,  573,  573,  573,  438,
+      437,  436,  435,  434,  573,  573,  573,  573,  573,  573,
+      432,  431,  430,  429,  428,  427,  425,  420,  419,  415,
+      414,  412,  411,  410,  409,  408,  573,  578,  407,  406,
+
+      405,  404,  402,  578,  578,  578,  578,  578,  578,  578,
+      578,  578,  401,  400,  399,  398,  396,  395,  394,  393,
+      392,  391,  389,  387,  386,  385,  384,  383,  381,  380,
+      379,  378,  377,  376,  375,  374,  373,  372,  371,  370,
+      369,  368,  366,  365,  364,  578,  580,  363,  362,  361,
+      359,  354,  353,  349,  348,  346,  342,  341,  580,  580,
+      580,  340,  339,  337,  333,  332,  580,  580,  580,  580,
+      580,  580,  331,  330,  328,  323,  322,  320,  318,  317,
+      311,  304,  303,  302,  301,  300,  299,  298,  580,  583,
+      583,  583,  583,  583,  583,  583,  583,  296,  290,  284,
+
+      283,  276,  270,  264,  258,  254,  251,  245,  241,  240,
+      239,  238,  237,  236,  235,  234,  233,  231,  225,  219,
+      214,  213,  212,  211,  210,  209,  208,  207,  206,  204,
+      203,  583,  585,  585,  585,  585,  585,  585,  585,  585,
+      201,  196,  195,  194,  585,  585,  585,  193,  191,  189,
+      183,  182,  585,  585,  585,  585,  585,  585,  589,  589,
+      589,  589,  589,  589,  589,  589,  181,  168,  167,  166,
+      149,  148,  147,  145,  139,  129,  128,  127,  115,  110,
       109,  108,  106,  101,   97,   74,   73,   28,   27,   12,
        11,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  564,  566,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  566,  566,  566,    0,
-        0,    0,    0,    0,  566,  566,  566,  566,  566,  566,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  566,  571,    0,    0,
-
-        0,    0,    0,  571,  571,  571,  571,  571,  571,  571,
-      571,  571,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  571,  573,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  573,  573,
-      573,    0,    0,    0,    0,    0,  573,  573,  573,  573,
-      573,  573,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  573,  576,
-      576,  576,  576,  576,  576,  576,  576,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  576,  578,  578,  578,  578,  578,  578,  578,  578,
-        0,    0,    0,    0,  578,  578,  578,    0,    0,    0,
-        0,    0,  578,  578,  578,  578,  578,  578,  582,  582,
-      582,  582,  582,  582,  582,  582,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-      582,  584,  584,  584,  584,  584,  584,  584,  584,    0,
-        0,    0,    0,  584,  584,  584,    0,    0,    0,    0,
-        0,  584,  584,  584,  584,  584,  584,  587,  587,  587,
-      587,  587,  587,  587,  587,    0,    0,    0,    0,    0,
+      589,  591,  591,  591,  591,  591,  591,  591,  591,    0,
+        0,    0,    0,  591,  591,  591,    0,    0,    0,    0,
+        0,  591,  591,  591,  591,  591,  591,  594,  594,  594,
+      594,  594,  594,  594,  594,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  587,
-      589,  589,  589,  589,  589,  589,  589,  589,    0,    0,
-        0,    0,  589,  589,  589,    0,    0,    0,    0,    0,
-      589,  589,  589,  589,  589,  589,  598,    0,    0,  598,
-
-        0,  598,  598,  598,  598,    0,  598,  598,  598,  598,
-      598,  598,  598,  598,    0,  598,  598,  598,    0,    0,
-        0,    0,    0,    0,  598,  598,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  594,
+      596,  596,  596,  596,  596,  596,  596,  596,    0,    0,
+        0,    0,  596,  596,  596,    0,    0,    0,    0,    0,
+      596,  596,  596,  596,  596,  596,  605,    0,    0,  605,
+
+        0,  605,  605,  605,  605,    0,  605,  605,  605,  605,
+      605,  605,  605,  605,    0,  605,  605,  605,    0,    0,
+        0,    0,    0,    0,  605,  605,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      598,  600,    0,    0,  600,    0,  600,  600,  600,  600,
-        0,  600,  600,  600,  600,  600,  600,  600,  600,    0,
-      600,  600,  600,    0,    0,    0,    0,    0,    0,  600,
-      600,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      605,  607,    0,    0,  607,    0,  607,  607,  607,  607,
+        0,  607,  607,  607,  607,  607,  607,  607,  607,    0,
+      607,  607,  607,    0,    0,    0,    0,    0,    0,  607,
+      607,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,  600,  603,  603,  603,  603,
-      603,  603,  603,  603,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  607,  610,  610,  610,  610,
+      610,  610,  610,  610,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  603,  605,
-      605,  605,  605,  605,  605,  605,  605,    0,    0,    0,
-        0,  605,  605,  605,    0,    0,    0,    0,    0,  605,
-      605,  605,  605,  605,  605,  608,  608,  608,  608,  608,
-      608,  608,  608,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  610,  612,
+      612,  612,  612,  612,  612,  612,  612,    0,    0,    0,
+        0,  612,  612,  612,    0,    0,    0,    0,    0,  612,
+      612,  612,  612,  612,  612,  615,  615,  615,  615,  615,
+      615,  615,  615,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  608,  610,  610,
-      610,  610,  610,  610,  610,  610,    0,    0,    0,    0,
-      610,  610,  610,    0,    0,    0,    0,    0,  610,  610,
-      610,  610,  610,  610,  619,  619,  619,  619,  619,  619,
-      619,  619,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  615,  617,  617,
+      617,  617,  617,  617,  617,  617,    0,    0,    0,    0,
+      617,  617,  617,    0,    0,    0,    0,    0,  617,  617,
+      617,  617,  617,  617,  626,  626,  626,  626,  626,  626,
+      626,  626,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  619,  621,  621,  621,
-      621,  621,  621,  621,  621,    0,    0,    0,    0,  621,
-
-      621,  621,    0,    0,    0,    0,    0,  621,  621,  621,
-      621,  621,  621,  634,  634,    0,  634,    0,    0,    0,
-        0,  634,  634,  634,  634,  634,  634,  634,  634,  634,
-      634, 1001, 1001, 1001, 1001,    0, 1001, 1001,    0,    0,
-     1001,    0, 1001,    0,    0, 1001,    0,    0, 1001,    0,
-     1001, 1062, 1062, 1062, 1062,    0, 1062, 1062,    0,    0,
-     1062,    0, 1062,    0,    0, 1062,    0,    0, 1062,    0,
-     1062, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576,
-     2576, 2576, 2576, 2577, 2577, 2577, 2577, 2577, 2577, 2577,
-     2577, 2577, 2577, 2577, 2577, 2578, 2578, 2578, 2578, 2578,
-
-     2578, 2578, 2578, 2578, 2578, 2578, 2578, 2579, 2579, 2579,
-     2579, 2579, 2579, 2579, 2579, 2579, 2579, 2579, 2579, 2580,
-     2580, 2580, 2580, 2580, 2580, 2580, 2580, 2580, 2580, 2580,
-     2580, 2581, 2581, 2581, 2581, 2581, 2581, 2581, 2581, 2581,
-     2581, 2581, 2581, 2582, 2582, 2582, 2582, 2582, 2582, 2582,
-     2582, 2582, 2582, 2582, 2582, 2583, 2583, 2583, 2583, 2583,
-     2583, 2583, 2583, 2583, 2583, 2583, 2583, 2584, 2584, 2584,
-     2584, 2584, 2584, 2584, 2584, 2584, 2584, 2584, 2584, 2585,
-     2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585,
-     2585, 2586, 2586, 2586, 2586, 2586, 2586, 2586, 2586, 2586,
-
-     2586, 2586, 2586, 2587, 2587, 2587, 2587, 2587, 2587, 2587,
-     2587, 2587, 2587, 2587, 2587, 2588, 2588, 2588, 2588, 2588,
-     2588, 2588, 2588, 2588, 2588, 2588, 2588, 2589, 2589, 2589,
-     2589, 2589, 2589, 2589, 2589, 2589, 2589, 2589, 2589, 2590,
-     2590, 2590, 2590, 2590, 2590, 2590, 2590, 2590, 2590, 2590,
-     2590, 2591, 2591, 2591, 2591, 2591, 2591, 2591, 2591, 2591,
-     2591, 2591, 2591, 2592, 2592, 2592, 2592, 2592, 2592, 2592,
-     2592, 2592, 2592, 2592, 2592, 2593, 2593, 2593, 2593, 2593,
-     2593, 2593, 2593, 2593, 2593, 2593, 2593, 2594, 2594, 2594,
-     2594, 2594, 2594, 2594, 2594, 2594, 2594, 2594, 2594, 2595,
-
-     2595,    0, 2595, 2595, 2595, 2595, 2595, 2595, 2595, 2595,
-     2595, 2596,    0,    0, 2596, 2597,    0,    0, 2597,    0,
-     2597, 2597,    0, 2597, 2597, 2597, 2597, 2598, 2598,    0,
-     2598, 2598, 2598, 2598, 2598, 2598, 2598, 2598, 2598, 2599,
-     2599,    0, 2599, 2599, 2599, 2599, 2599, 2599, 2599, 2599,
-     2599, 2600, 2600,    0, 2600, 2600, 2600, 2600, 2600, 2600,
-     2600, 2600, 2600, 2601,    0,    0,    0, 2601, 2601, 2602,
-        0,    0, 2602,    0, 2602, 2602, 2602, 2602,    0, 2602,
-     2602, 2603, 2603,    0, 2603, 2603, 2603, 2603, 2603, 2603,
-     2603, 2603, 2603, 2604,    0,    0,    0,    0, 2604, 2604,
-
-     2604, 2604,    0, 2604, 2604, 2605,    0,    0, 2605,    0,
-     2605, 2605, 2605, 2605,    0, 2605, 2605, 2606, 2606,    0,
-     2606, 2606, 2606, 2606, 2606, 2606, 2606, 2606, 2606, 2607,
-        0,    0, 2607,    0, 2607, 2607, 2607, 2607,    0, 2607,
-     2607, 2608, 2608,    0, 2608, 2608, 2608, 2608, 2608, 2608,
-     2608, 2608, 2608, 2609,    0,    0, 2609,    0, 2609, 2609,
-     2609, 2609,    0, 2609, 2609, 2610, 2610,    0, 2610, 2610,
-     2610, 2610, 2610, 2610, 2610, 2610, 2610, 2611,    0,    0,
-     2611, 2611, 2611, 2611, 2611, 2611, 2611, 2611, 2611, 2612,
-     2612,    0, 2612, 2612, 2612, 2612, 2612, 2612, 2612, 2612,
-
-     2612, 2613,    0,    0, 2613, 2613, 2613, 2613, 2613, 2613,
-     2613, 2613, 2613, 2614, 2614,    0, 2614, 2614, 2614, 2614,
-     2614, 2614, 2614, 2614, 2614, 2615,    0,    0, 2615, 2615,
-     2615, 2615, 2615, 2615, 2615, 2615, 2615, 2616, 2616,    0,
-     2616, 2616, 2616, 2616, 2616, 2616, 2616, 2616, 2616, 2617,
-        0,    0, 2617, 2617, 2617, 2617, 2617, 2617, 2617, 2617,
-     2617, 2618, 2618,    0, 2618, 2618, 2618, 2618, 2618, 2618,
-     2618, 2618, 2618, 2619,    0,    0, 2619, 2619, 2619, 2619,
-     2619, 2619, 2619, 2619, 2619, 2620, 2620,    0, 2620, 2620,
-     2620, 2620, 2620, 2620, 2620, 2620, 2620, 2621,    0,    0,
-
-     2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2622,
-     2622,    0, 2622, 2622, 2622, 2622, 2622, 2622, 2622, 2622,
-     2622, 2623,    0,    0, 2623,    0, 2623, 2623, 2623, 2623,
-        0, 2623, 2623, 2624, 2624,    0, 2624, 2624, 2624, 2624,
-     2624, 2624, 2624, 2624, 2624, 2625,    0,    0, 2625,    0,
-     2625, 2625, 2625, 2625,    0, 2625, 2625, 2626, 2626,    0,
-     2626, 2626, 2626, 2626, 2626, 2626, 2626, 2626, 2626, 2627,
-        0,    0, 2627,    0, 2627, 2627, 2627, 2627,    0, 2627,
-     2627, 2628, 2628,    0, 2628, 2628, 2628, 2628, 2628, 2628,
-     2628, 2628, 2628, 2629,    0,    0, 2629,    0, 2629, 2629,
-
-        0, 2629,    0, 2629, 2629, 2630,    0,    0, 2630,    0,
-     2630, 2630,    0, 2630,    0, 2630, 2630, 2631,    0,    0,
-     2631,    0, 2631, 2631, 2631, 2631,    0, 2631, 2631, 2632,
-     2632,    0, 2632, 2632, 2632, 2632, 2632, 2632, 2632, 2632,
-     2632, 2633,    0,    0, 2633,    0, 2633, 2633, 2633, 2633,
-        0, 2633, 2633, 2634, 2634,    0, 2634, 2634, 2634, 2634,
-     2634, 2634, 2634, 2634, 2634, 2635,    0,    0, 2635,    0,
-     2635, 2635, 2635, 2635,    0, 2635, 2635, 2636, 2636,    0,
-     2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2637,
-     2637,    0, 2637,    0, 2637, 2637, 2638,    0,    0, 2638,
-
-        0, 2638, 2638, 2638, 2638, 2638, 2638, 2638, 2639, 2639,
-        0, 2639, 2639, 2639, 2639, 2639, 2639, 2639, 2639, 2639,
-     2640,    0, 2640, 2640,    0, 2640, 2640,    0,    0,    0,
-     2640, 2640, 2641, 2641, 2641, 2641, 2641, 2641, 2641, 2641,
-     2641, 2641, 2641, 2641, 2642, 2642,    0, 2642, 2642, 2642,
-     2642, 2642, 2642, 2642, 2642, 2642, 2643,    0,    0, 2643,
-     2644,    0, 2644, 2645,    0,    0, 2645,    0, 2645, 2645,
-        0, 2645, 2645, 2645, 2645, 2646, 2646,    0, 2646, 2646,
-     2646, 2646, 2646, 2646, 2646, 2646, 2646, 2647, 2647,    0,
-     2647, 2647, 2647, 2647, 2647, 2647, 2647, 2647, 2647, 2648,
-
-     2648,    0, 2648, 2648, 2648, 2648, 2648, 2648, 2648, 2648,
-     2648, 2649,    0,    0,    0, 2649, 2649, 2650,    0,    0,
-     2650,    0, 2650, 2650, 2650, 2650,    0, 2650, 2650, 2651,
-     2651,    0, 2651, 2651, 2651, 2651, 2651, 2651, 2651, 2651,
-     2651, 2652,    0,    0,    0,    0, 2652, 2652, 2652, 2652,
-        0, 2652, 2652, 2653,    0,    0, 2653,    0, 2653, 2653,
-     2653, 2653,    0, 2653, 2653, 2654, 2654,    0, 2654, 2654,
-     2654, 2654, 2654, 2654, 2654, 2654, 2654, 2655,    0,    0,
-     2655,    0, 2655, 2655, 2655, 2655,    0, 2655, 2655, 2656,
-     2656,    0, 2656, 2656, 2656, 2656, 2656, 2656, 2656, 2656,
-
-     2656, 2657,    0,    0, 2657,    0, 2657, 2657, 2657, 2657,
-        0, 2657, 2657, 2658, 2658,    0, 2658, 2658, 2658, 2658,
-     2658, 2658, 2658, 2658, 2658, 2659,    0,    0, 2659, 2659,
-     2659, 2659, 2659, 2659, 2659, 2659, 2659, 2660,    0,    0,
-     2660, 2660, 2660, 2660, 2660, 2660, 2660, 2660, 2660, 2661,
-     2661,    0, 2661, 2661, 2661, 2661, 2661, 2661, 2661, 2661,
-     2661, 2662, 2662,    0, 2662, 2662, 2662, 2662, 2662, 2662,
-     2662, 2662, 2662, 2663,    0,    0, 2663, 2663, 2663, 2663,
-     2663, 2663, 2663, 2663, 2663, 2664,    0,    0, 2664, 2664,
-     2664, 2664, 2664, 2664, 2664, 2664, 2664, 2665, 2665,    0,
-
-     2665, 2665, 2665, 2665, 2665, 2665, 2665, 2665, 2665, 2666,
-     2666,    0, 2666, 2666, 2666, 2666, 2666, 2666, 2666, 2666,
-     2666, 2667,    0,    0, 2667, 2667, 2667, 2667, 2667, 2667,
-     2667, 2667, 2667, 2668,    0,    0, 2668, 2668, 2668, 2668,
-     2668, 2668, 2668, 2668, 2668, 2669, 2669,    0, 2669, 2669,
-     2669, 2669, 2669, 2669, 2669, 2669, 2669, 2670, 2670,    0,
-     2670, 2670, 2670, 2670, 2670, 2670, 2670, 2670, 2670, 2671,
-        0,    0, 2671, 2671, 2671, 2671, 2671, 2671, 2671, 2671,
-     2671, 2672,    0,    0, 2672, 2672, 2672, 2672, 2672, 2672,
-     2672, 2672, 2672, 2673, 2673,    0, 2673, 2673, 2673, 2673,
-
-     2673, 2673, 2673, 2673, 2673, 2674, 2674,    0, 2674, 2674,
-     2674, 2674, 2674, 2674, 2674, 2674, 2674, 2675,    0,    0,
-     2675, 2675, 2675, 2675, 2675, 2675, 2675, 2675, 2675, 2676,
-        0,    0, 2676, 2676, 2676, 2676, 2676, 2676, 2676, 2676,
-     2676, 2677, 2677,    0, 2677, 2677, 2677, 2677, 2677, 2677,
-     2677, 2677, 2677, 2678, 2678,    0, 2678, 2678, 2678, 2678,
-     2678, 2678, 2678, 2678, 2678, 2679,    0,    0, 2679, 2679,
-     2679, 2679, 2679, 2679, 2679, 2679, 2679, 2680,    0,    0,
-     2680, 2680, 2680, 2680, 2680, 2680, 2680, 2680, 2680, 2681,
-     2681,    0, 2681, 2681, 2681, 2681, 2681, 2681, 2681, 2681,
-
-     2681, 2682, 2682,    0, 2682, 2682, 2682, 2682, 2682, 2682,
-     2682, 2682, 2682, 2683,    0,    0, 2683,    0, 2683, 2683,
-     2683, 2683,    0, 2683, 2683, 2684, 2684,    0, 2684, 2684,
-     2684, 2684, 2684, 2684, 2684, 2684, 2684, 2685,    0,    0,
-     2685,    0, 2685, 2685, 2685, 2685,    0, 2685, 2685, 2686,
-     2686,    0, 2686, 2686, 2686, 2686, 2686, 2686, 2686, 2686,
-     2686, 2687,    0,    0, 2687,    0, 2687, 2687, 2687, 2687,
-        0, 2687, 2687, 2688, 2688,    0, 2688, 2688, 2688, 2688,
-     2688, 2688, 2688, 2688, 2688, 2689,    0,    0, 2689,    0,
-     2689, 2689,    0, 2689,    0, 2689, 2689, 2690,    0,    0,
-
-     2690,    0, 2690, 2690,    0, 2690,    0, 2690, 2690, 2691,
-        0,    0, 2691,    0, 2691, 2691,    0, 2691,    0, 2691,
-     2691, 2692,    0,    0, 2692,    0, 2692, 2692,    0, 2692,
-        0, 2692, 2692, 2693,    0,    0, 2693,    0, 2693, 2693,
-     2693, 2693,    0, 2693, 2693, 2694, 2694,    0, 2694, 2694,
-     2694, 2694, 2694, 2694, 2694, 2694, 2694, 2695,    0,    0,
-     2695,    0, 2695, 2695, 2695, 2695,    0, 2695, 2695, 2696,
-     2696,    0, 2696, 2696, 2696, 2696, 2696, 2696, 2696, 2696,
-     2696, 2697,    0,    0, 2697,    0, 2697, 2697, 2697, 2697,
-        0, 2697, 2697, 2698, 2698,    0, 2698, 2698, 2698, 2698,
-
-     2698, 2698, 2698, 2698, 2698, 2699, 2699,    0, 2699,    0,
-     2699, 2699, 2700,    0,    0, 2700,    0, 2700, 2700, 2700,
-     2700, 2700, 2700, 2700, 2701, 2701,    0, 2701, 2701, 2701,
-     2701, 2701, 2701, 2701, 2701, 2701, 2702,    0, 2702, 2702,
-        0, 2702, 2702,    0,    0,    0, 2702, 2702, 2703, 2703,
-     2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703,
-     2704,    0,    0, 2704,    0, 2704, 2704,    0, 2704, 2704,
-     2704, 2704, 2705, 2705,    0, 2705, 2705, 2705, 2705, 2705,
-     2705, 2705, 2705, 2705, 2706, 2706,    0, 2706, 2706, 2706,
-     2706, 2706, 2706, 2706, 2706, 2706, 2707, 2707,    0, 2707,
-
-     2707, 2707, 2707, 2707, 2707, 2707, 2707, 2707, 2708,    0,
-        0, 2708,    0, 2708, 2708, 2708, 2708, 2708, 2708, 2708,
-     2709,    0,    0, 2709,    0, 2709, 2709, 2709, 2709, 2709,
-     2709, 2709, 2710, 2710,    0, 2710, 2710, 2710, 2710, 2710,
-     2710, 2710, 2710, 2710, 2711, 2711,    0, 2711, 2711, 2711,
-     2711, 2711, 2711, 2711, 2711, 2711, 2712, 2712,    0, 2712,
-     2712, 2712, 2712, 2712, 2712, 2712, 2712, 2712, 2713,    0,
-        0, 2713,    0, 2713, 2713,    0, 2713,    0, 2713, 2713,
-     2714, 2714,    0, 2714, 2714, 2714, 2714, 2714, 2714, 2714,
-     2714, 2714, 2715, 2715,    0, 2715, 2715, 2715, 2715, 2715,
-
-     2715, 2715, 2715, 2715, 2716, 2716,    0, 2716, 2716, 2716,
-     2716, 2716, 2716, 2716, 2716, 2716, 2717, 2717,    0, 2717,
-     2717, 2717, 2717, 2717, 2717, 2717, 2717, 2717, 2718, 2718,
-        0, 2718, 2718, 2718, 2718, 2718, 2718, 2718, 2718, 2718,
-     2719, 2719,    0, 2719, 2719, 2719, 2719, 2719, 2719, 2719,
-     2719, 2719, 2720, 2720,    0, 2720, 2720, 2720, 2720, 2720,
-     2720, 2720, 2720, 2720, 2721, 2721,    0, 2721, 2721, 2721,
-     2721, 2721, 2721, 2721, 2721, 2721, 2722, 2722,    0, 2722,
-     2722, 2722, 2722, 2722, 2722, 2722, 2722, 2722, 2723, 2723,
-        0, 2723, 2723, 2723, 2723, 2723, 2723, 2723, 2723, 2723,
-
-     2724, 2724,    0, 2724, 2724, 2724, 2724, 2724, 2724, 2724,
-     2724, 2724, 2725, 2725,    0, 2725, 2725, 2725, 2725, 2725,
-     2725, 2725, 2725, 2725, 2726, 2726,    0, 2726, 2726, 2726,
-     2726, 2726, 2726, 2726, 2726, 2726, 2727, 2727,    0, 2727,
-     2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2728, 2728,
-        0, 2728, 2728, 2728, 2728, 2728, 2728, 2728, 2728, 2728,
-     2729, 2729,    0, 2729, 2729, 2729, 2729, 2729, 2729, 2729,
-     2729, 2729, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575
+        0,    0,    0,    0,    0,    0,  626,  628,  628,  628,
+      628,  628,  628,  628,  628,    0,    0,    0,    0,  628,
+
+      628,  628,    0,    0,    0,    0,    0,  628,  628,  628,
+      628,  628,  628,  641,  641,    0,  641,    0,    0,    0,
+        0,  641,  641,  641,  641,  641,  641,  641,  641,  641,
+      641, 1021, 1021, 1021, 1021,    0, 1021, 1021,    0,    0,
+     1021,    0, 1021,    0,    0, 1021,    0,    0, 1021,    0,
+     1021, 1085, 1085, 1085, 1085,    0, 1085, 1085,    0,    0,
+     1085,    0, 1085,    0,    0, 1085,    0,    0, 1085,    0,
+     1085, 2760, 2760, 2760, 2760, 2760, 2760, 2760, 2760, 2760,
+     2760, 2760, 2760, 2761, 2761, 2761, 2761, 2761, 2761, 2761,
+     2761, 2761, 2761, 2761, 2761, 2762, 2762, 2762, 2762, 2762,
+
+     2762, 2762, 2762, 2762, 2762, 2762, 2762, 2763, 2763, 2763,
+     2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763, 2764,
+     2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764,
+     2764, 2765, 2765, 2765, 2765, 2765, 2765, 2765, 2765, 2765,
+     2765, 2765, 2765, 2766, 2766, 2766, 2766, 2766, 2766, 2766,
+     2766, 2766, 2766, 2766, 2766, 2767, 2767, 2767, 2767, 2767,
+     2767, 2767, 2767, 2767, 2767, 2767, 2767, 2768, 2768, 2768,
+     2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2769,
+     2769, 2769, 2769, 2769, 2769, 2769, 2769, 2769, 2769, 2769,
+     2769, 2770, 2770, 2770, 2770, 2770, 2770, 2770, 2770, 2770,
+
+     2770, 2770, 2770, 2771, 2771, 2771, 2771, 2771, 2771, 2771,
+     2771, 2771, 2771, 2771, 2771, 2772, 2772, 2772, 2772, 2772,
+     2772, 2772, 2772, 2772, 2772, 2772, 2772, 2773, 2773, 2773,
+     2773, 2773, 2773, 2773, 2773, 2773, 2773, 2773, 2773, 2774,
+     2774, 2774, 2774, 2774, 2774, 2774, 2774, 2774, 2774, 2774,
+     2774, 2775, 2775, 2775, 2775, 2775, 2775, 2775, 2775, 2775,
+     2775, 2775, 2775, 2776, 2776, 2776, 2776, 2776, 2776, 2776,
+     2776, 2776, 2776, 2776, 2776, 2777, 2777, 2777, 2777, 2777,
+     2777, 2777, 2777, 2777, 2777, 2777, 2777, 2778, 2778, 2778,
+     2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2779,
+
+     2779,    0, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779,
+     2779, 2780,    0,    0, 2780, 2781,    0,    0, 2781,    0,
+     2781, 2781,    0, 2781, 2781, 2781, 2781, 2782, 2782,    0,
+     2782, 2782, 2782, 2782, 2782, 2782, 2782, 2782, 2782, 2783,
+     2783,    0, 2783, 2783, 2783, 2783, 2783, 2783, 2783, 2783,
+     2783, 2784, 2784,    0, 2784, 2784, 2784, 2784, 2784, 2784,
+     2784, 2784, 2784, 2785,    0,    0,    0, 2785, 2785, 2786,
+        0,    0, 2786,    0, 2786, 2786, 2786, 2786,    0, 2786,
+     2786, 2787, 2787,    0, 2787, 2787, 2787, 2787, 2787, 2787,
+     2787, 2787, 2787, 2788,    0,    0,    0,    0, 2788, 2788,
+
+     2788, 2788,    0, 2788, 2788, 2789,    0,    0, 2789,    0,
+     2789, 2789, 2789, 2789,    0, 2789, 2789, 2790, 2790,    0,
+     2790, 2790, 2790, 2790, 2790, 2790, 2790, 2790, 2790, 2791,
+        0,    0, 2791,    0, 2791, 2791, 2791, 2791,    0, 2791,
+     2791, 2792, 2792,    0, 2792, 2792, 2792, 2792, 2792, 2792,
+     2792, 2792, 2792, 2793,    0,    0, 2793,    0, 2793, 2793,
+     2793, 2793,    0, 2793, 2793, 2794, 2794,    0, 2794, 2794,
+     2794, 2794, 2794, 2794, 2794, 2794, 2794, 2795,    0,    0,
+     2795, 2795, 2795, 2795, 2795, 2795, 2795, 2795, 2795, 2796,
+     2796,    0, 2796, 2796, 2796, 2796, 2796, 2796, 2796, 2796,
+
+     2796, 2797,    0,    0, 2797, 2797, 2797, 2797, 2797, 2797,
+     2797, 2797, 2797, 2798, 2798,    0, 2798, 2798, 2798, 2798,
+     2798, 2798, 2798, 2798, 2798, 2799,    0,    0, 2799, 2799,
+     2799, 2799, 2799, 2799, 2799, 2799, 2799, 2800, 2800,    0,
+     2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2801,
+        0,    0, 2801, 2801, 2801, 2801, 2801, 2801, 2801, 2801,
+     2801, 2802, 2802,    0, 2802, 2802, 2802, 2802, 2802, 2802,
+     2802, 2802, 2802, 2803,    0,    0, 2803, 2803, 2803, 2803,
+     2803, 2803, 2803, 2803, 2803, 2804, 2804,    0, 2804, 2804,
+     2804, 2804, 2804, 2804, 2804, 2804, 2804, 2805,    0,    0,
+
+     2805, 2805, 2805, 2805, 2805, 2805, 2805, 2805, 2805, 2806,
+     2806,    0, 2806, 2806, 2806, 2806, 2806, 2806, 2806, 2806,
+     2806, 2807,    0,    0, 2807,    0, 2807, 2807, 2807, 2807,
+        0, 2807, 2807, 2808, 2808,    0, 2808, 2808, 2808, 2808,
+     2808, 2808, 2808, 2808, 2808, 2809,    0,    0, 2809,    0,
+     2809, 2809, 2809, 2809,    0, 2809, 2809, 2810, 2810,    0,
+     2810, 2810, 2810, 2810, 2810, 2810, 2810, 2810, 2810, 2811,
+        0,    0, 2811,    0, 2811, 2811, 2811, 2811,    0, 2811,
+     2811, 2812, 2812,    0, 2812, 2812, 2812, 2812, 2812, 2812,
+     2812, 2812, 2812, 2813,    0,    0, 2813,    0, 2813, 2813,
+
+        0, 2813,    0, 2813, 2813, 2814,    0,    0, 2814,    0,
+     2814, 2814,    0, 2814,    0, 2814, 2814, 2815,    0,    0,
+     2815,    0, 2815, 2815, 2815, 2815,    0, 2815, 2815, 2816,
+     2816,    0, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816,
+     2816, 2817,    0,    0, 2817,    0, 2817, 2817, 2817, 2817,
+        0, 2817, 2817, 2818, 2818,    0, 2818, 2818, 2818, 2818,
+     2818, 2818, 2818, 2818, 2818, 2819,    0,    0, 2819,    0,
+     2819, 2819, 2819, 2819,    0, 2819, 2819, 2820, 2820,    0,
+     2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2821,
+     2821,    0, 2821,    0, 2821, 2821, 2822,    0,    0, 2822,
+
+        0, 2822, 2822, 2822, 2822, 2822, 2822, 2822, 2823, 2823,
+        0, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823,
+     2824,    0, 2824, 2824,    0, 2824, 2824,    0,    0,    0,
+     2824, 2824, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825,
+     2825, 2825, 2825, 2825, 2826, 2826,    0, 2826, 2826, 2826,
+     2826, 2826, 2826, 2826, 2826, 2826, 2827,    0,    0, 2827,
+     2828,    0, 2828, 2829,    0,    0, 2829,    0, 2829, 2829,
+        0, 2829, 2829, 2829, 2829, 2830, 2830,    0, 2830, 2830,
+     2830, 2830, 2830, 2830, 2830, 2830, 2830, 2831, 2831,    0,
+     2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831, 2832,
+
+     2832,    0, 2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832,
+     2832, 2833,    0,    0,    0, 2833, 2833, 2834,    0,    0,
+     2834,    0, 2834, 2834, 2834, 2834,    0, 2834, 2834, 2835,
+     2835,    0, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835,
+     2835, 2836,    0,    0,    0,    0, 2836, 2836, 2836, 2836,
+        0, 2836, 2836, 2837,    0,    0, 2837,    0, 2837, 2837,
+     2837, 2837,    0, 2837, 2837, 2838, 2838,    0, 2838, 2838,
+     2838, 2838, 2838, 2838, 2838, 2838, 2838, 2839,    0,    0,
+     2839,    0, 2839, 2839, 2839, 2839,    0, 2839, 2839, 2840,
+     2840,    0, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840,
+
+     2840, 2841,    0,    0, 2841,    0, 2841, 2841, 2841, 2841,
+        0, 2841, 2841, 2842, 2842,    0, 2842, 2842, 2842, 2842,
+     2842, 2842, 2842, 2842, 2842, 2843,    0,    0, 2843, 2843,
+     2843, 2843, 2843, 2843, 2843, 2843, 2843, 2844,    0,    0,
+     2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2845,
+     2845,    0, 2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845,
+     2845, 2846, 2846,    0, 2846, 2846, 2846, 2846, 2846, 2846,
+     2846, 2846, 2846, 2847,    0,    0, 2847, 2847, 2847, 2847,
+     2847, 2847, 2847, 2847, 2847, 2848,    0,    0, 2848, 2848,
+     2848, 2848, 2848, 2848, 2848, 2848, 2848, 2849, 2849,    0,
+
+     2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849, 2850,
+     2850,    0, 2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850,
+     2850, 2851,    0,    0, 2851, 2851, 2851, 2851, 2851, 2851,
+     2851, 2851, 2851, 2852,    0,    0, 2852, 2852, 2852, 2852,
+     2852, 2852, 2852, 2852, 2852, 2853, 2853,    0, 2853, 2853,
+     2853, 2853, 2853, 2853, 2853, 2853, 2853, 2854, 2854,    0,
+     2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2855,
+        0,    0, 2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855,
+     2855, 2856,    0,    0, 2856, 2856, 2856, 2856, 2856, 2856,
+     2856, 2856, 2856, 2857, 2857,    0, 2857, 2857, 2857, 2857,
+
+     2857, 2857, 2857, 2857, 2857, 2858, 2858,    0, 2858, 2858,
+     2858, 2858, 2858, 2858, 2858, 2858, 2858, 2859,    0,    0,
+     2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859, 2860,
+        0,    0, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860,
+     2860, 2861, 2861,    0, 2861, 2861, 2861, 2861, 2861, 2861,
+     2861, 2861, 2861, 2862, 2862,    0, 2862, 2862, 2862, 2862,
+     2862, 2862, 2862, 2862, 2862, 2863,    0,    0, 2863, 2863,
+     2863, 2863, 2863, 2863, 2863, 2863, 2863, 2864,    0,    0,
+     2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2865,
+     2865,    0, 2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865,
+
+     2865, 2866, 2866,    0, 2866, 2866, 2866, 2866, 2866, 2866,
+     2866, 2866, 2866, 2867,    0,    0, 2867,    0, 2867, 2867,
+     2867, 2867,    0, 2867, 2867, 2868, 2868,    0, 2868, 2868,
+     2868, 2868, 2868, 2868, 2868, 2868, 2868, 2869,    0,    0,
+     2869,    0, 2869, 2869, 2869, 2869,    0, 2869, 2869, 2870,
+     2870,    0, 2870, 2870, 2870, 2870, 2870, 2870, 2870, 2870,
+     2870, 2871,    0,    0, 2871,    0, 2871, 2871, 2871, 2871,
+        0, 2871, 2871, 2872, 2872,    0, 2872, 2872, 2872, 2872,
+     2872, 2872, 2872, 2872, 2872, 2873,    0,    0, 2873,    0,
+     2873, 2873,    0, 2873,    0, 2873, 2873, 2874,    0,    0,
+
+     2874,    0, 2874, 2874,    0, 2874,    0, 2874, 2874, 2875,
+        0,    0, 2875,    0, 2875, 2875,    0, 2875,    0, 2875,
+     2875, 2876,    0,    0, 2876,    0, 2876, 2876,    0, 2876,
+        0, 2876, 2876, 2877,    0,    0, 2877,    0, 2877, 2877,
+     2877, 2877,    0, 2877, 2877, 2878, 2878,    0, 2878, 2878,
+     2878, 2878, 2878, 2878, 2878, 2878, 2878, 2879,    0,    0,
+     2879,    0, 2879, 2879, 2879, 2879,    0, 2879, 2879, 2880,
+     2880,    0, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+     2880, 2881,    0,    0, 2881,    0, 2881, 2881, 2881, 2881,
+        0, 2881, 2881, 2882, 2882,    0, 2882, 2882, 2882, 2882,
+
+     2882, 2882, 2882, 2882, 2882, 2883, 2883,    0, 2883,    0,
+     2883, 2883, 2884,    0,    0, 2884,    0, 2884, 2884, 2884,
+     2884, 2884, 2884, 2884, 2885, 2885,    0, 2885, 2885, 2885,
+     2885, 2885, 2885, 2885, 2885, 2885, 2886,    0, 2886, 2886,
+        0, 2886, 2886,    0,    0,    0, 2886, 2886, 2887, 2887,
+     2887, 2887, 2887, 2887, 2887, 2887, 2887, 2887, 2887, 2887,
+     2888,    0,    0, 2888,    0, 2888, 2888,    0, 2888, 2888,
+     2888, 2888, 2889, 2889,    0, 2889, 2889, 2889, 2889, 2889,
+     2889, 2889, 2889, 2889, 2890, 2890,    0, 2890, 2890, 2890,
+     2890, 2890, 2890, 2890, 2890, 2890, 2891, 2891,    0, 2891,
+
+     2891, 2891, 2891, 2891, 2891, 2891, 2891, 2891, 2892,    0,
+        0, 2892,    0, 2892, 2892, 2892, 2892, 2892, 2892, 2892,
+     2893,    0,    0, 2893,    0, 2893, 2893, 2893, 2893, 2893,
+     2893, 2893, 2894, 2894,    0, 2894, 2894, 2894, 2894, 2894,
+     2894, 2894, 2894, 2894, 2895, 2895,    0, 2895, 2895, 2895,
+     2895, 2895, 2895, 2895, 2895, 2895, 2896, 2896,    0, 2896,
+     2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2897,    0,
+        0, 2897,    0, 2897, 2897,    0, 2897,    0, 2897, 2897,
+     2898, 2898,    0, 2898, 2898, 2898, 2898, 2898, 2898, 2898,
+     2898, 2898, 2899, 2899,    0, 2899, 2899, 2899, 2899, 2899,
+
+     2899, 2899, 2899, 2899, 2900, 2900,    0, 2900, 2900, 2900,
+     2900, 2900, 2900, 2900, 2900, 2900, 2901, 2901,    0, 2901,
+     2901, 2901, 2901, 2901, 2901, 2901, 2901, 2901, 2902, 2902,
+        0, 2902, 2902, 2902, 2902, 2902, 2902, 2902, 2902, 2902,
+     2903, 2903,    0, 2903, 2903, 2903, 2903, 2903, 2903, 2903,
+     2903, 2903, 2904, 2904,    0, 2904, 2904, 2904, 2904, 2904,
+     2904, 2904, 2904, 2904, 2905, 2905,    0, 2905, 2905, 2905,
+     2905, 2905, 2905, 2905, 2905, 2905, 2906, 2906,    0, 2906,
+     2906, 2906, 2906, 2906, 2906, 2906, 2906, 2906, 2907, 2907,
+        0, 2907, 2907, 2907, 2907, 2907, 2907, 2907, 2907, 2907,
+
+     2908, 2908,    0, 2908, 2908, 2908, 2908, 2908, 2908, 2908,
+     2908, 2908, 2909, 2909,    0, 2909, 2909, 2909, 2909, 2909,
+     2909, 2909, 2909, 2909, 2910, 2910,    0, 2910, 2910, 2910,
+     2910, 2910, 2910, 2910, 2910, 2910, 2911, 2911,    0, 2911,
+     2911, 2911, 2911, 2911, 2911, 2911, 2911, 2911, 2912, 2912,
+        0, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912,
+     2913, 2913,    0, 2913, 2913, 2913, 2913, 2913, 2913, 2913,
+     2913, 2913, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759,
+     2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759
     } ;
 
 /* Table of booleans, true if rule could match eol. */
-static yyconst flex_int32_t yy_rule_can_match_eol[226] =
+static yyconst flex_int32_t yy_rule_can_match_eol[237] =
     {   0,
 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 1, 1, 0, 0, 0,     };
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0,     };
 
 extern int socks_yy_flex_debug;
 int socks_yy_flex_debug = 0;
@@ -3303,7 +3377,7 @@ static int inroute, inclientrule;
 
 
 
-#line 3306 "config_scan.c"
+#line 3380 "config_scan.c"
 
 #define INITIAL 0
 #define start_address 1
@@ -3612,7 +3686,7 @@ YY_DECL
     * start-condition dependent stuff.
     */
 
-#line 3615 "config_scan.c"
+#line 3689 "config_scan.c"
 
 	while ( 1 )		/* loops until end-of-file is reached */
 		{
@@ -3639,7 +3713,7 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 2576 )
+				if ( yy_current_state >= 2760 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -4043,9 +4117,17 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 case 33:
-/* rule 33 can match eol */
 YY_RULE_SETUP
 #line 454 "config_scan.l"
+{
+   yylval.number = CPUMASK_PERCPU;
+   return NUMBER;
+}
+	YY_BREAK
+case 34:
+/* rule 34 can match eol */
+YY_RULE_SETUP
+#line 459 "config_scan.l"
 {
 #if SOCKS_CLIENT
    SERRX(0);
@@ -4069,9 +4151,9 @@ YY_RULE_SETUP
 /*
      * socket option stuff.
      */
-case 34:
+case 35:
 YY_RULE_SETUP
-#line 479 "config_scan.l"
+#line 484 "config_scan.l"
 {
    BEGIN(start_socketoption);
 
@@ -4079,9 +4161,9 @@ YY_RULE_SETUP
    return SOCKETPROTOCOL;
 }
 	YY_BREAK
-case 35:
+case 36:
 YY_RULE_SETUP
-#line 486 "config_scan.l"
+#line 491 "config_scan.l"
 {
    BEGIN(start_socketoption);
 
@@ -4089,9 +4171,9 @@ YY_RULE_SETUP
    return SOCKETPROTOCOL;
 }
 	YY_BREAK
-case 36:
+case 37:
 YY_RULE_SETUP
-#line 493 "config_scan.l"
+#line 498 "config_scan.l"
 {
    BEGIN(start_socketoption);
 
@@ -4099,9 +4181,9 @@ YY_RULE_SETUP
    return SOCKETPROTOCOL;
 }
 	YY_BREAK
-case 37:
+case 38:
 YY_RULE_SETUP
-#line 500 "config_scan.l"
+#line 505 "config_scan.l"
 {
    BEGIN(start_socketoption);
 
@@ -4109,9 +4191,9 @@ YY_RULE_SETUP
    return SOCKETPROTOCOL;
 }
 	YY_BREAK
-case 38:
+case 39:
 YY_RULE_SETUP
-#line 508 "config_scan.l"
+#line 513 "config_scan.l"
 {
    const sockopt_t *sockopt;
 
@@ -4124,9 +4206,9 @@ YY_RULE_SETUP
    return SOCKETOPTION_OPTID;
 }
 	YY_BREAK
-case 39:
+case 40:
 YY_RULE_SETUP
-#line 520 "config_scan.l"
+#line 525 "config_scan.l"
 {
    BEGIN(0);
 
@@ -4134,20 +4216,12 @@ YY_RULE_SETUP
    return SOCKETOPTION_SYMBOLICVALUE;
 }
 	YY_BREAK
-case 40:
-YY_RULE_SETUP
-#line 527 "config_scan.l"
-{
-   yylval.string = socks_yytext;
-   return RULE_LOG_CONNECT;
-}
-	YY_BREAK
 case 41:
 YY_RULE_SETUP
 #line 532 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return RULE_LOG_DATA;
+   return RULE_LOG_CONNECT;
 }
 	YY_BREAK
 case 42:
@@ -4155,7 +4229,7 @@ YY_RULE_SETUP
 #line 537 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return RULE_LOG_DISCONNECT;
+   return RULE_LOG_DATA;
 }
 	YY_BREAK
 case 43:
@@ -4163,7 +4237,7 @@ YY_RULE_SETUP
 #line 542 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return RULE_LOG_ERROR;
+   return RULE_LOG_DISCONNECT;
 }
 	YY_BREAK
 case 44:
@@ -4171,7 +4245,7 @@ YY_RULE_SETUP
 #line 547 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return RULE_LOG_IOOPERATION;
+   return RULE_LOG_ERROR;
 }
 	YY_BREAK
 case 45:
@@ -4179,15 +4253,23 @@ YY_RULE_SETUP
 #line 552 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return RULE_LOG_TCPINFO;
+   return RULE_LOG_IOOPERATION;
 }
 	YY_BREAK
 case 46:
+YY_RULE_SETUP
+#line 557 "config_scan.l"
+{
+   yylval.string = socks_yytext;
+   return RULE_LOG_TCPINFO;
+}
+	YY_BREAK
+case 47:
 *yy_cp = (yy_hold_char); /* undo effects of setting up socks_yytext */
 (yy_c_buf_p) = yy_cp -= 1;
 YY_DO_BEFORE_ACTION; /* set up socks_yytext again */
 YY_RULE_SETUP
-#line 557 "config_scan.l"
+#line 562 "config_scan.l"
 {
    const loglevel_t *l;
    char visbuf[256];
@@ -4202,9 +4284,9 @@ YY_RULE_SETUP
    return LOGLEVEL;
 }
 	YY_BREAK
-case 47:
+case 48:
 YY_RULE_SETUP
-#line 571 "config_scan.l"
+#line 576 "config_scan.l"
 {
    BEGIN(start_errorsymbol);
 
@@ -4212,9 +4294,9 @@ YY_RULE_SETUP
    return LOGTYPE_ERROR;
 }
 	YY_BREAK
-case 48:
+case 49:
 YY_RULE_SETUP
-#line 578 "config_scan.l"
+#line 583 "config_scan.l"
 {
    BEGIN(start_tcpoption);
 
@@ -4222,9 +4304,9 @@ YY_RULE_SETUP
    return LOGTYPE_TCP_DISABLED;
 }
 	YY_BREAK
-case 49:
+case 50:
 YY_RULE_SETUP
-#line 585 "config_scan.l"
+#line 590 "config_scan.l"
 {
    BEGIN(start_tcpoption);
 
@@ -4232,9 +4314,9 @@ YY_RULE_SETUP
    return LOGTYPE_TCP_ENABLED;
 }
 	YY_BREAK
-case 50:
+case 51:
 YY_RULE_SETUP
-#line 593 "config_scan.l"
+#line 598 "config_scan.l"
 {
 #if !SOCKS_CLIENT
 
@@ -4257,20 +4339,12 @@ YY_RULE_SETUP
    return ERRORVALUE;
 }
 	YY_BREAK
-case 51:
-YY_RULE_SETUP
-#line 615 "config_scan.l"
-{
-   yylval.string = socks_yytext;
-   return BSDAUTHSTYLENAME;
-}
-	YY_BREAK
 case 52:
 YY_RULE_SETUP
 #line 620 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return LOGFILE;
+   return BSDAUTHSTYLENAME;
 }
 	YY_BREAK
 case 53:
@@ -4278,7 +4352,7 @@ YY_RULE_SETUP
 #line 625 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return USERNAME;
+   return LOGFILE;
 }
 	YY_BREAK
 case 54:
@@ -4286,7 +4360,7 @@ YY_RULE_SETUP
 #line 630 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return GROUPNAME;
+   return USERNAME;
 }
 	YY_BREAK
 case 55:
@@ -4294,7 +4368,7 @@ YY_RULE_SETUP
 #line 635 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return LIBWRAP_FILE;
+   return GROUPNAME;
 }
 	YY_BREAK
 case 56:
@@ -4302,7 +4376,7 @@ YY_RULE_SETUP
 #line 640 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return LDAP_DOMAIN;
+   return LIBWRAP_FILE;
 }
 	YY_BREAK
 case 57:
@@ -4310,7 +4384,7 @@ YY_RULE_SETUP
 #line 645 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return LDAP_BASEDN;
+   return LDAP_DOMAIN;
 }
 	YY_BREAK
 case 58:
@@ -4318,7 +4392,7 @@ YY_RULE_SETUP
 #line 650 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return LDAP_FILTER;
+   return LDAP_BASEDN;
 }
 	YY_BREAK
 case 59:
@@ -4326,7 +4400,7 @@ YY_RULE_SETUP
 #line 655 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return LDAP_URL;
+   return LDAP_FILTER;
 }
 	YY_BREAK
 case 60:
@@ -4334,7 +4408,7 @@ YY_RULE_SETUP
 #line 660 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return LDAP_ATTRIBUTE;
+   return LDAP_URL;
 }
 	YY_BREAK
 case 61:
@@ -4342,7 +4416,7 @@ YY_RULE_SETUP
 #line 665 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return LDAPGROUP_NAME;
+   return LDAP_ATTRIBUTE;
 }
 	YY_BREAK
 case 62:
@@ -4350,7 +4424,7 @@ YY_RULE_SETUP
 #line 670 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return LDAPSERVER_NAME;
+   return LDAPGROUP_NAME;
 }
 	YY_BREAK
 case 63:
@@ -4358,7 +4432,7 @@ YY_RULE_SETUP
 #line 675 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return LDAP_CERTFILE;
+   return LDAPSERVER_NAME;
 }
 	YY_BREAK
 case 64:
@@ -4366,7 +4440,7 @@ YY_RULE_SETUP
 #line 680 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return LDAP_CERTPATH;
+   return LDAP_CERTFILE;
 }
 	YY_BREAK
 case 65:
@@ -4374,7 +4448,7 @@ YY_RULE_SETUP
 #line 685 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return LDAPKEYTABNAME;
+   return LDAP_CERTPATH;
 }
 	YY_BREAK
 case 66:
@@ -4390,7 +4464,7 @@ YY_RULE_SETUP
 #line 695 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return GSSAPIKEYTABNAME;
+   return LDAPKEYTABNAME;
 }
 	YY_BREAK
 case 68:
@@ -4406,35 +4480,35 @@ YY_RULE_SETUP
 #line 705 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return GSSAPISERVICENAME;
+   return GSSAPIKEYTABNAME;
 }
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
 #line 710 "config_scan.l"
 {
-   BEGIN(start_line);
-
    yylval.string = socks_yytext;
-   return *socks_yytext;
+   return GSSAPISERVICENAME;
 }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
-#line 717 "config_scan.l"
+#line 715 "config_scan.l"
 {
-   BEGIN(0);
+   BEGIN(start_line);
 
    yylval.string = socks_yytext;
-   return LINE;
+   return *socks_yytext;
 }
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
-#line 724 "config_scan.l"
+#line 722 "config_scan.l"
 {
+   BEGIN(0);
+
    yylval.string = socks_yytext;
-   return NODNSMISMATCH;
+   return LINE;
 }
 	YY_BREAK
 case 73:
@@ -4442,7 +4516,7 @@ YY_RULE_SETUP
 #line 729 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return NODNSUNKNOWN;
+   return NODNSMISMATCH;
 }
 	YY_BREAK
 case 74:
@@ -4450,7 +4524,7 @@ YY_RULE_SETUP
 #line 734 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return CHECKREPLYAUTH;
+   return NODNSUNKNOWN;
 }
 	YY_BREAK
 case 75:
@@ -4458,7 +4532,7 @@ YY_RULE_SETUP
 #line 739 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return PROTOCOL_TCP;
+   return CHECKREPLYAUTH;
 }
 	YY_BREAK
 case 76:
@@ -4466,7 +4540,7 @@ YY_RULE_SETUP
 #line 744 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return PROTOCOL_UDP;
+   return PROTOCOL_TCP;
 }
 	YY_BREAK
 case 77:
@@ -4474,7 +4548,7 @@ YY_RULE_SETUP
 #line 749 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return PROTOCOL_FAKE;
+   return PROTOCOL_UDP;
 }
 	YY_BREAK
 case 78:
@@ -4482,7 +4556,7 @@ YY_RULE_SETUP
 #line 754 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return GSSAPIENC_ANY;
+   return PROTOCOL_FAKE;
 }
 	YY_BREAK
 case 79:
@@ -4490,7 +4564,7 @@ YY_RULE_SETUP
 #line 759 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return GSSAPIENC_CLEAR;
+   return GSSAPIENC_ANY;
 }
 	YY_BREAK
 case 80:
@@ -4498,7 +4572,7 @@ YY_RULE_SETUP
 #line 764 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return GSSAPIENC_INTEGRITY;
+   return GSSAPIENC_CLEAR;
 }
 	YY_BREAK
 case 81:
@@ -4506,7 +4580,7 @@ YY_RULE_SETUP
 #line 769 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return GSSAPIENC_CONFIDENTIALITY;
+   return GSSAPIENC_INTEGRITY;
 }
 	YY_BREAK
 case 82:
@@ -4514,7 +4588,7 @@ YY_RULE_SETUP
 #line 774 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return GSSAPIENC_PERMESSAGE;
+   return GSSAPIENC_CONFIDENTIALITY;
 }
 	YY_BREAK
 case 83:
@@ -4522,22 +4596,22 @@ YY_RULE_SETUP
 #line 779 "config_scan.l"
 {
    yylval.string = socks_yytext;
-   return REALNAME;
+   return GSSAPIENC_PERMESSAGE;
 }
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
 #line 784 "config_scan.l"
 {
-   yylval.method = AUTHMETHOD_NONE;
-   return METHODNAME;
+   yylval.string = socks_yytext;
+   return REALNAME;
 }
 	YY_BREAK
 case 85:
 YY_RULE_SETUP
 #line 789 "config_scan.l"
 {
-   yylval.method = AUTHMETHOD_GSSAPI;
+   yylval.method = AUTHMETHOD_NONE;
    return METHODNAME;
 }
 	YY_BREAK
@@ -4545,7 +4619,7 @@ case 86:
 YY_RULE_SETUP
 #line 794 "config_scan.l"
 {
-   yylval.method = AUTHMETHOD_UNAME;
+   yylval.method = AUTHMETHOD_GSSAPI;
    return METHODNAME;
 }
 	YY_BREAK
@@ -4553,7 +4627,7 @@ case 87:
 YY_RULE_SETUP
 #line 799 "config_scan.l"
 {
-   yylval.method = AUTHMETHOD_RFC931;
+   yylval.method = AUTHMETHOD_UNAME;
    return METHODNAME;
 }
 	YY_BREAK
@@ -4561,7 +4635,7 @@ case 88:
 YY_RULE_SETUP
 #line 804 "config_scan.l"
 {
-   yylval.number = AUTHMETHOD_PAM_ANY;
+   yylval.method = AUTHMETHOD_RFC931;
    return METHODNAME;
 }
 	YY_BREAK
@@ -4569,7 +4643,7 @@ case 89:
 YY_RULE_SETUP
 #line 809 "config_scan.l"
 {
-   yylval.method = AUTHMETHOD_PAM_ADDRESS;
+   yylval.number = AUTHMETHOD_PAM_ANY;
    return METHODNAME;
 }
 	YY_BREAK
@@ -4577,13 +4651,21 @@ case 90:
 YY_RULE_SETUP
 #line 814 "config_scan.l"
 {
-   yylval.method = AUTHMETHOD_PAM_USERNAME;
+   yylval.method = AUTHMETHOD_PAM_ADDRESS;
    return METHODNAME;
 }
 	YY_BREAK
 case 91:
 YY_RULE_SETUP
 #line 819 "config_scan.l"
+{
+   yylval.method = AUTHMETHOD_PAM_USERNAME;
+   return METHODNAME;
+}
+	YY_BREAK
+case 92:
+YY_RULE_SETUP
+#line 824 "config_scan.l"
 {
    yywarnx_deprecated(socks_yytext, "pam.*");
 
@@ -4591,18 +4673,18 @@ YY_RULE_SETUP
    return METHODNAME;
 }
 	YY_BREAK
-case 92:
+case 93:
 YY_RULE_SETUP
-#line 827 "config_scan.l"
+#line 832 "config_scan.l"
 {
    yylval.method = AUTHMETHOD_BSDAUTH;
    return METHODNAME;
 }
 	YY_BREAK
 /* non-start condition dependents. */
-case 93:
+case 94:
 YY_RULE_SETUP
-#line 834 "config_scan.l"
+#line 839 "config_scan.l"
 {
    BEGIN(start_servicename);
 
@@ -4610,9 +4692,9 @@ YY_RULE_SETUP
    return OPERATOR;
 }
 	YY_BREAK
-case 94:
+case 95:
 YY_RULE_SETUP
-#line 841 "config_scan.l"
+#line 846 "config_scan.l"
 {
    inclientrule = 1;
 
@@ -4620,25 +4702,25 @@ YY_RULE_SETUP
    return CLIENTRULE;
 }
 	YY_BREAK
-case 95:
+case 96:
 YY_RULE_SETUP
-#line 848 "config_scan.l"
+#line 853 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return HOSTIDRULE;
 }
 	YY_BREAK
-case 96:
+case 97:
 YY_RULE_SETUP
-#line 853 "config_scan.l"
+#line 858 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return SOCKSRULE;
 }
 	YY_BREAK
-case 97:
+case 98:
 YY_RULE_SETUP
-#line 858 "config_scan.l"
+#line 863 "config_scan.l"
 { /* deprecated socks rule  syntax, without "socks "-prefix. */
 #if SOCKS_CLIENT
 
@@ -4661,28 +4743,28 @@ YY_RULE_SETUP
 #endif /* server */
 }
 	YY_BREAK
-case 98:
+case 99:
 YY_RULE_SETUP
-#line 881 "config_scan.l"
+#line 886 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return ALARMTYPE_DATA;
 }
 	YY_BREAK
-case 99:
+case 100:
 YY_RULE_SETUP
-#line 886 "config_scan.l"
+#line 891 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return ALARMTYPE_DISCONNECT;
 }
 	YY_BREAK
-case 100:
+case 101:
 *yy_cp = (yy_hold_char); /* undo effects of setting up socks_yytext */
 (yy_c_buf_p) = yy_cp = yy_bp + 5;
 YY_DO_BEFORE_ACTION; /* set up socks_yytext again */
 YY_RULE_SETUP
-#line 891 "config_scan.l"
+#line 896 "config_scan.l"
 {
    BEGIN(start_alarmtest);
 
@@ -4690,43 +4772,43 @@ YY_RULE_SETUP
    return ALARM;
 }
 	YY_BREAK
-case 101:
-/* rule 101 can match eol */
+case 102:
+/* rule 102 can match eol */
 *yy_cp = (yy_hold_char); /* undo effects of setting up socks_yytext */
 YY_LINENO_REWIND_TO(yy_bp + 5);
 (yy_c_buf_p) = yy_cp = yy_bp + 5;
 YY_DO_BEFORE_ACTION; /* set up socks_yytext again */
 YY_RULE_SETUP
-#line 899 "config_scan.l"
+#line 904 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return RECVSIDE;
 }
 	YY_BREAK
-case 102:
-/* rule 102 can match eol */
+case 103:
+/* rule 103 can match eol */
 *yy_cp = (yy_hold_char); /* undo effects of setting up socks_yytext */
 YY_LINENO_REWIND_TO(yy_bp + 5);
 (yy_c_buf_p) = yy_cp = yy_bp + 5;
 YY_DO_BEFORE_ACTION; /* set up socks_yytext again */
 YY_RULE_SETUP
-#line 904 "config_scan.l"
+#line 909 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return SENDSIDE;
 }
 	YY_BREAK
-case 103:
+case 104:
 YY_RULE_SETUP
-#line 909 "config_scan.l"
+#line 914 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return DEBUGGING;
 }
 	YY_BREAK
-case 104:
+case 105:
 YY_RULE_SETUP
-#line 914 "config_scan.l"
+#line 919 "config_scan.l"
 {
    inroute = 1;
 
@@ -4734,41 +4816,49 @@ YY_RULE_SETUP
    return ROUTE;
 }
 	YY_BREAK
-case 105:
+case 106:
 YY_RULE_SETUP
-#line 921 "config_scan.l"
+#line 926 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return ROUTE;
 }
 	YY_BREAK
-case 106:
+case 107:
 YY_RULE_SETUP
-#line 927 "config_scan.l"
+#line 932 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return GLOBALROUTEOPTION;
 }
 	YY_BREAK
-case 107:
+case 108:
 YY_RULE_SETUP
-#line 933 "config_scan.l"
+#line 938 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return MAXFAIL;
 }
 	YY_BREAK
-case 108:
+case 109:
 YY_RULE_SETUP
-#line 938 "config_scan.l"
+#line 943 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return BADROUTE_EXPIRE;
 }
 	YY_BREAK
-case 109:
+case 110:
 YY_RULE_SETUP
-#line 943 "config_scan.l"
+#line 948 "config_scan.l"
+{
+   yylval.string = socks_yytext;
+   return ROUTE_WEIGHT;
+}
+	YY_BREAK
+case 111:
+YY_RULE_SETUP
+#line 953 "config_scan.l"
 {
    BEGIN(start_protocol);
 
@@ -4776,9 +4866,9 @@ YY_RULE_SETUP
    return RESOLVEPROTOCOL;
 }
 	YY_BREAK
-case 110:
+case 112:
 YY_RULE_SETUP
-#line 950 "config_scan.l"
+#line 960 "config_scan.l"
 {
    BEGIN(start_srchost);
 
@@ -4786,9 +4876,9 @@ YY_RULE_SETUP
    return SRCHOST;
 }
 	YY_BREAK
-case 111:
+case 113:
 YY_RULE_SETUP
-#line 957 "config_scan.l"
+#line 967 "config_scan.l"
 {
    BEGIN(start_proxyprotocol);
 
@@ -4796,9 +4886,9 @@ YY_RULE_SETUP
    return PROXYPROTOCOL;
 }
 	YY_BREAK
-case 112:
+case 114:
 YY_RULE_SETUP
-#line 964 "config_scan.l"
+#line 974 "config_scan.l"
 {
    BEGIN(start_logoutput);
 
@@ -4806,9 +4896,9 @@ YY_RULE_SETUP
    return ERRORLOG;
 }
 	YY_BREAK
-case 113:
+case 115:
 YY_RULE_SETUP
-#line 971 "config_scan.l"
+#line 981 "config_scan.l"
 {
    BEGIN(start_logoutput);
 
@@ -4816,9 +4906,9 @@ YY_RULE_SETUP
    return LOGOUTPUT;
 }
 	YY_BREAK
-case 114:
+case 116:
 YY_RULE_SETUP
-#line 979 "config_scan.l"
+#line 989 "config_scan.l"
 {
    BEGIN(start_protocol);
 
@@ -4826,9 +4916,9 @@ YY_RULE_SETUP
    return PROTOCOL;
 }
 	YY_BREAK
-case 115:
+case 117:
 YY_RULE_SETUP
-#line 986 "config_scan.l"
+#line 996 "config_scan.l"
 {
    BEGIN(start_command);
 
@@ -4836,65 +4926,65 @@ YY_RULE_SETUP
    return COMMAND;
 }
 	YY_BREAK
-case 116:
+case 118:
 YY_RULE_SETUP
-#line 993 "config_scan.l"
+#line 1003 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return UDPPORTRANGE;
 }
 	YY_BREAK
-case 117:
+case 119:
 YY_RULE_SETUP
-#line 998 "config_scan.l"
+#line 1008 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return UDPCONNECTDST;
 }
 	YY_BREAK
-case 118:
+case 120:
 YY_RULE_SETUP
-#line 1003 "config_scan.l"
+#line 1013 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return REDIRECT;
 }
 	YY_BREAK
-case 119:
+case 121:
 YY_RULE_SETUP
-#line 1008 "config_scan.l"
+#line 1018 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return BANDWIDTH;
 }
 	YY_BREAK
-case 120:
+case 122:
 YY_RULE_SETUP
-#line 1013 "config_scan.l"
+#line 1023 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return SESSIONMAX;
 }
 	YY_BREAK
-case 121:
+case 123:
 YY_RULE_SETUP
-#line 1018 "config_scan.l"
+#line 1028 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return SESSION_INHERITABLE;
 }
 	YY_BREAK
-case 122:
+case 124:
 YY_RULE_SETUP
-#line 1023 "config_scan.l"
+#line 1033 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return SESSIONTHROTTLE;
 }
 	YY_BREAK
-case 123:
+case 125:
 YY_RULE_SETUP
-#line 1028 "config_scan.l"
+#line 1038 "config_scan.l"
 {
    BEGIN(start_statekey);
 
@@ -4902,33 +4992,33 @@ YY_RULE_SETUP
    return SESSIONSTATE_KEY;
 }
 	YY_BREAK
-case 124:
+case 126:
 YY_RULE_SETUP
-#line 1035 "config_scan.l"
+#line 1045 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return SESSIONSTATE_THROTTLE;
 }
 	YY_BREAK
-case 125:
+case 127:
 YY_RULE_SETUP
-#line 1040 "config_scan.l"
+#line 1050 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return SESSIONSTATE_MAX;
 }
 	YY_BREAK
-case 126:
+case 128:
 YY_RULE_SETUP
-#line 1046 "config_scan.l"
+#line 1056 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return WORD__IN;
 }
 	YY_BREAK
-case 127:
+case 129:
 YY_RULE_SETUP
-#line 1051 "config_scan.l"
+#line 1061 "config_scan.l"
 {
    BEGIN(start_address);
 
@@ -4936,9 +5026,9 @@ YY_RULE_SETUP
    return FROM;
 }
 	YY_BREAK
-case 128:
+case 130:
 YY_RULE_SETUP
-#line 1058 "config_scan.l"
+#line 1068 "config_scan.l"
 {
    BEGIN(start_address);
 
@@ -4946,9 +5036,9 @@ YY_RULE_SETUP
    return TO;
 }
 	YY_BREAK
-case 129:
+case 131:
 YY_RULE_SETUP
-#line 1065 "config_scan.l"
+#line 1075 "config_scan.l"
 {
    BEGIN(start_address);
 
@@ -4956,28 +5046,28 @@ YY_RULE_SETUP
    return VIA;
 }
 	YY_BREAK
-case 130:
+case 132:
 YY_RULE_SETUP
-#line 1072 "config_scan.l"
+#line 1082 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return YES;
 }
 	YY_BREAK
-case 131:
+case 133:
 YY_RULE_SETUP
-#line 1077 "config_scan.l"
+#line 1087 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return NO;
 }
 	YY_BREAK
-case 132:
+case 134:
 *yy_cp = (yy_hold_char); /* undo effects of setting up socks_yytext */
 (yy_c_buf_p) = yy_cp = yy_bp + 9;
 YY_DO_BEFORE_ACTION; /* set up socks_yytext again */
 YY_RULE_SETUP
-#line 1082 "config_scan.l"
+#line 1092 "config_scan.l"
 {
    BEGIN(start_socketprotocol);
 
@@ -4985,23 +5075,23 @@ YY_RULE_SETUP
    return INTERNALSOCKET;
 }
 	YY_BREAK
-case 133:
+case 135:
 *yy_cp = (yy_hold_char); /* undo effects of setting up socks_yytext */
 (yy_c_buf_p) = yy_cp = yy_bp + 9;
 YY_DO_BEFORE_ACTION; /* set up socks_yytext again */
 YY_RULE_SETUP
-#line 1089 "config_scan.l"
+#line 1099 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return ALARMIF_INTERNAL;
 }
 	YY_BREAK
-case 134:
+case 136:
 *yy_cp = (yy_hold_char); /* undo effects of setting up socks_yytext */
 (yy_c_buf_p) = yy_cp = yy_bp + 12;
 YY_DO_BEFORE_ACTION; /* set up socks_yytext again */
 YY_RULE_SETUP
-#line 1094 "config_scan.l"
+#line 1104 "config_scan.l"
 {
    BEGIN(start_loglevel);
 
@@ -5009,9 +5099,9 @@ YY_RULE_SETUP
    return LOGIF_INTERNAL;
 }
 	YY_BREAK
-case 135:
+case 137:
 YY_RULE_SETUP
-#line 1101 "config_scan.l"
+#line 1111 "config_scan.l"
 {
    BEGIN(start_protocol);
 
@@ -5019,14 +5109,14 @@ YY_RULE_SETUP
    return INTERNAL_PROTOCOL;
 }
 	YY_BREAK
-case 136:
-/* rule 136 can match eol */
+case 138:
+/* rule 138 can match eol */
 *yy_cp = (yy_hold_char); /* undo effects of setting up socks_yytext */
 YY_LINENO_REWIND_TO(yy_bp + 8);
 (yy_c_buf_p) = yy_cp = yy_bp + 8;
 YY_DO_BEFORE_ACTION; /* set up socks_yytext again */
 YY_RULE_SETUP
-#line 1109 "config_scan.l"
+#line 1119 "config_scan.l"
 {
    BEGIN(start_address);
 
@@ -5034,12 +5124,12 @@ YY_RULE_SETUP
    return INTERNAL;
 }
 	YY_BREAK
-case 137:
+case 139:
 *yy_cp = (yy_hold_char); /* undo effects of setting up socks_yytext */
 (yy_c_buf_p) = yy_cp = yy_bp + 9;
 YY_DO_BEFORE_ACTION; /* set up socks_yytext again */
 YY_RULE_SETUP
-#line 1117 "config_scan.l"
+#line 1127 "config_scan.l"
 {
    BEGIN(start_socketprotocol);
 
@@ -5047,20 +5137,20 @@ YY_RULE_SETUP
    return EXTERNALSOCKET;
 }
 	YY_BREAK
-case 138:
+case 140:
 *yy_cp = (yy_hold_char); /* undo effects of setting up socks_yytext */
 (yy_c_buf_p) = yy_cp = yy_bp + 9;
 YY_DO_BEFORE_ACTION; /* set up socks_yytext again */
 YY_RULE_SETUP
-#line 1124 "config_scan.l"
+#line 1134 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return ALARMIF_EXTERNAL;
 }
 	YY_BREAK
-case 139:
+case 141:
 YY_RULE_SETUP
-#line 1129 "config_scan.l"
+#line 1139 "config_scan.l"
 {
    BEGIN(start_protocol);
 
@@ -5068,20 +5158,20 @@ YY_RULE_SETUP
    return EXTERNAL_PROTOCOL;
 }
 	YY_BREAK
-case 140:
+case 142:
 YY_RULE_SETUP
-#line 1136 "config_scan.l"
+#line 1146 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return EXTERNAL_ROTATION;
 }
 	YY_BREAK
-case 141:
+case 143:
 *yy_cp = (yy_hold_char); /* undo effects of setting up socks_yytext */
 (yy_c_buf_p) = yy_cp = yy_bp + 12;
 YY_DO_BEFORE_ACTION; /* set up socks_yytext again */
 YY_RULE_SETUP
-#line 1141 "config_scan.l"
+#line 1151 "config_scan.l"
 {
    BEGIN(start_loglevel);
 
@@ -5089,14 +5179,14 @@ YY_RULE_SETUP
    return LOGIF_EXTERNAL;
 }
 	YY_BREAK
-case 142:
-/* rule 142 can match eol */
+case 144:
+/* rule 144 can match eol */
 *yy_cp = (yy_hold_char); /* undo effects of setting up socks_yytext */
 YY_LINENO_REWIND_TO(yy_bp + 8);
 (yy_c_buf_p) = yy_cp = yy_bp + 8;
 YY_DO_BEFORE_ACTION; /* set up socks_yytext again */
 YY_RULE_SETUP
-#line 1148 "config_scan.l"
+#line 1158 "config_scan.l"
 {
    BEGIN(start_address);
 
@@ -5104,40 +5194,112 @@ YY_RULE_SETUP
    return EXTERNAL;
 }
 	YY_BREAK
-case 143:
+case 145:
 YY_RULE_SETUP
-#line 1155 "config_scan.l"
+#line 1165 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return NONE;
 }
 	YY_BREAK
-case 144:
+case 146:
 YY_RULE_SETUP
-#line 1160 "config_scan.l"
+#line 1170 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return SAMESAME;
 }
 	YY_BREAK
-case 145:
+case 147:
 YY_RULE_SETUP
-#line 1166 "config_scan.l"
+#line 1176 "config_scan.l"
 {
    yywarnx_deprecated(socks_yytext, NULL);
 }
 	YY_BREAK
-case 146:
+case 148:
 YY_RULE_SETUP
-#line 1170 "config_scan.l"
+#line 1180 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return PROC_MAXREQUESTS;
 }
 	YY_BREAK
-case 147:
+case 149:
 YY_RULE_SETUP
-#line 1176 "config_scan.l"
+#line 1185 "config_scan.l"
+{
+   yylval.string = socks_yytext;
+   return PROC_MAXCLIENTS_NEGOTIATE;
+}
+	YY_BREAK
+case 150:
+YY_RULE_SETUP
+#line 1190 "config_scan.l"
+{
+   yylval.string = socks_yytext;
+   return PROC_MAXCLIENTS_IO;
+}
+	YY_BREAK
+case 151:
+YY_RULE_SETUP
+#line 1195 "config_scan.l"
+{
+   yylval.string = socks_yytext;
+   return PROC_MAXCLIENTS_REQUEST;
+}
+	YY_BREAK
+case 152:
+YY_RULE_SETUP
+#line 1200 "config_scan.l"
+{
+   yylval.string = socks_yytext;
+   return PROC_REUSEPORT;
+}
+	YY_BREAK
+case 153:
+YY_RULE_SETUP
+#line 1205 "config_scan.l"
+{
+   yylval.string = socks_yytext;
+   return PROC_ALLINONE;
+}
+	YY_BREAK
+case 154:
+YY_RULE_SETUP
+#line 1210 "config_scan.l"
+{
+   yylval.string = socks_yytext;
+   return HOSTCACHE_ENTRIES;
+}
+	YY_BREAK
+case 155:
+YY_RULE_SETUP
+#line 1215 "config_scan.l"
+{
+   yylval.string = socks_yytext;
+   return HOSTCACHE_TTL_MIN;
+}
+	YY_BREAK
+case 156:
+YY_RULE_SETUP
+#line 1220 "config_scan.l"
+{
+   yylval.string = socks_yytext;
+   return HOSTCACHE_TTL_MAX;
+}
+	YY_BREAK
+case 157:
+YY_RULE_SETUP
+#line 1225 "config_scan.l"
+{
+   yylval.string = socks_yytext;
+   return HAPPYEYEBALLS_DELAY;
+}
+	YY_BREAK
+case 158:
+YY_RULE_SETUP
+#line 1231 "config_scan.l"
 {
    BEGIN(start_username);
 
@@ -5145,9 +5307,9 @@ YY_RULE_SETUP
    return USER;
 }
 	YY_BREAK
-case 148:
+case 159:
 YY_RULE_SETUP
-#line 1183 "config_scan.l"
+#line 1238 "config_scan.l"
 {
    BEGIN(start_groupname);
 
@@ -5155,9 +5317,9 @@ YY_RULE_SETUP
    return GROUP;
 }
 	YY_BREAK
-case 149:
+case 160:
 YY_RULE_SETUP
-#line 1190 "config_scan.l"
+#line 1245 "config_scan.l"
 {
    BEGIN(start_username);
 
@@ -5165,9 +5327,9 @@ YY_RULE_SETUP
    return USER_PRIVILEGED;
 }
 	YY_BREAK
-case 150:
+case 161:
 YY_RULE_SETUP
-#line 1197 "config_scan.l"
+#line 1252 "config_scan.l"
 {
    BEGIN(start_username);
 
@@ -5175,9 +5337,9 @@ YY_RULE_SETUP
    return USER_UNPRIVILEGED;
 }
 	YY_BREAK
-case 151:
+case 162:
 YY_RULE_SETUP
-#line 1204 "config_scan.l"
+#line 1259 "config_scan.l"
 {
    BEGIN(start_username);
 
@@ -5185,113 +5347,113 @@ YY_RULE_SETUP
    return USER_LIBWRAP;
 }
 	YY_BREAK
-case 152:
+case 163:
 YY_RULE_SETUP
-#line 1211 "config_scan.l"
+#line 1266 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return CONNECTTIMEOUT;
 }
 	YY_BREAK
-case 153:
+case 164:
 YY_RULE_SETUP
-#line 1216 "config_scan.l"
+#line 1271 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return TCP_FIN_WAIT;
 }
 	YY_BREAK
-case 154:
+case 165:
 YY_RULE_SETUP
-#line 1222 "config_scan.l"
+#line 1277 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return IOTIMEOUT;
 }
 	YY_BREAK
-case 155:
+case 166:
 YY_RULE_SETUP
-#line 1227 "config_scan.l"
+#line 1282 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return IOTIMEOUT_TCP;
 }
 	YY_BREAK
-case 156:
+case 167:
 YY_RULE_SETUP
-#line 1232 "config_scan.l"
+#line 1287 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return IOTIMEOUT_UDP;
 }
 	YY_BREAK
-case 157:
+case 168:
 YY_RULE_SETUP
-#line 1237 "config_scan.l"
+#line 1292 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return NEGOTIATETIMEOUT;
 }
 	YY_BREAK
-case 158:
+case 169:
 YY_RULE_SETUP
-#line 1243 "config_scan.l"
+#line 1298 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return COMPATIBILITY;
 }
 	YY_BREAK
-case 159:
+case 170:
 YY_RULE_SETUP
-#line 1248 "config_scan.l"
+#line 1303 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return SAMEPORT;
 }
 	YY_BREAK
-case 160:
+case 171:
 YY_RULE_SETUP
-#line 1253 "config_scan.l"
+#line 1308 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return DRAFT_5_05;
 }
 	YY_BREAK
-case 161:
+case 172:
 YY_RULE_SETUP
-#line 1258 "config_scan.l"
+#line 1313 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return CLIENTCOMPATIBILITY;
 }
 	YY_BREAK
-case 162:
+case 173:
 YY_RULE_SETUP
-#line 1263 "config_scan.l"
+#line 1318 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return NECGSSAPI;
 }
 	YY_BREAK
-case 163:
+case 174:
 YY_RULE_SETUP
-#line 1268 "config_scan.l"
+#line 1323 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return EXTENSION;
 }
 	YY_BREAK
-case 164:
+case 175:
 YY_RULE_SETUP
-#line 1273 "config_scan.l"
+#line 1328 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return BIND;
 }
 	YY_BREAK
-case 165:
+case 176:
 YY_RULE_SETUP
-#line 1278 "config_scan.l"
+#line 1333 "config_scan.l"
 {
    BEGIN(start_address);
 
@@ -5299,17 +5461,17 @@ YY_RULE_SETUP
    return HOSTID;
 }
 	YY_BREAK
-case 166:
+case 177:
 YY_RULE_SETUP
-#line 1285 "config_scan.l"
+#line 1340 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return MONITOR;
 }
 	YY_BREAK
-case 167:
+case 178:
 YY_RULE_SETUP
-#line 1290 "config_scan.l"
+#line 1345 "config_scan.l"
 {
    BEGIN(start_hostindex);
 
@@ -5317,9 +5479,9 @@ YY_RULE_SETUP
    return HOSTINDEX;
 }
 	YY_BREAK
-case 168:
+case 179:
 YY_RULE_SETUP
-#line 1297 "config_scan.l"
+#line 1352 "config_scan.l"
 {
    BEGIN(0);
 
@@ -5327,9 +5489,9 @@ YY_RULE_SETUP
    return NUMBER;
 }
 	YY_BREAK
-case 169:
+case 180:
 YY_RULE_SETUP
-#line 1305 "config_scan.l"
+#line 1360 "config_scan.l"
 {
    BEGIN(start_method);
 
@@ -5337,9 +5499,9 @@ YY_RULE_SETUP
    return SOCKSMETHOD;
 }
 	YY_BREAK
-case 170:
+case 181:
 YY_RULE_SETUP
-#line 1312 "config_scan.l"
+#line 1367 "config_scan.l"
 {
    BEGIN(start_method);
 
@@ -5347,9 +5509,9 @@ YY_RULE_SETUP
    return CLIENTMETHOD;
 }
 	YY_BREAK
-case 171:
+case 182:
 YY_RULE_SETUP
-#line 1319 "config_scan.l"
+#line 1374 "config_scan.l"
 {
    BEGIN(start_method);
 
@@ -5371,28 +5533,28 @@ YY_RULE_SETUP
 /*
     * verdicts
     */
-case 172:
+case 183:
 YY_RULE_SETUP
-#line 1343 "config_scan.l"
+#line 1398 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return VERDICT_BLOCK;
 }
 	YY_BREAK
-case 173:
+case 184:
 YY_RULE_SETUP
-#line 1348 "config_scan.l"
+#line 1403 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return VERDICT_PASS;
 }
 	YY_BREAK
-case 174:
+case 185:
 *yy_cp = (yy_hold_char); /* undo effects of setting up socks_yytext */
 (yy_c_buf_p) = yy_cp = yy_bp + 3;
 YY_DO_BEFORE_ACTION; /* set up socks_yytext again */
 YY_RULE_SETUP
-#line 1353 "config_scan.l"
+#line 1408 "config_scan.l"
 {
    BEGIN(start_log);
 
@@ -5400,9 +5562,9 @@ YY_RULE_SETUP
    return RULE_LOG;
 }
 	YY_BREAK
-case 175:
+case 186:
 YY_RULE_SETUP
-#line 1361 "config_scan.l"
+#line 1416 "config_scan.l"
 {
    BEGIN(lineprefix);
 
@@ -5410,9 +5572,9 @@ YY_RULE_SETUP
    return LIBWRAPSTART;
 }
 	YY_BREAK
-case 176:
+case 187:
 YY_RULE_SETUP
-#line 1368 "config_scan.l"
+#line 1423 "config_scan.l"
 {
    BEGIN(start_libwrapfile);
 
@@ -5420,9 +5582,9 @@ YY_RULE_SETUP
    return LIBWRAP_ALLOW;
 }
 	YY_BREAK
-case 177:
+case 188:
 YY_RULE_SETUP
-#line 1375 "config_scan.l"
+#line 1430 "config_scan.l"
 {
    BEGIN(start_libwrapfile);
 
@@ -5430,17 +5592,17 @@ YY_RULE_SETUP
    return LIBWRAP_DENY;
 }
 	YY_BREAK
-case 178:
+case 189:
 YY_RULE_SETUP
-#line 1382 "config_scan.l"
+#line 1437 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return LIBWRAP_HOSTS_ACCESS;
 }
 	YY_BREAK
-case 179:
+case 190:
 YY_RULE_SETUP
-#line 1387 "config_scan.l"
+#line 1442 "config_scan.l"
 {
    BEGIN(start_servicename);
 
@@ -5448,9 +5610,9 @@ YY_RULE_SETUP
    return PAMSERVICENAME;
 }
 	YY_BREAK
-case 180:
+case 191:
 YY_RULE_SETUP
-#line 1394 "config_scan.l"
+#line 1449 "config_scan.l"
 {
    BEGIN(start_bsdauthstylename);
 
@@ -5458,9 +5620,9 @@ YY_RULE_SETUP
    return BSDAUTHSTYLE;
 }
 	YY_BREAK
-case 181:
+case 192:
 YY_RULE_SETUP
-#line 1401 "config_scan.l"
+#line 1456 "config_scan.l"
 {
    BEGIN(start_gssapiservicename);
 
@@ -5468,9 +5630,9 @@ YY_RULE_SETUP
    return GSSAPISERVICE;
 }
 	YY_BREAK
-case 182:
+case 193:
 YY_RULE_SETUP
-#line 1408 "config_scan.l"
+#line 1463 "config_scan.l"
 {
        BEGIN(start_gssapikeytabname);
 
@@ -5478,9 +5640,9 @@ YY_RULE_SETUP
    return GSSAPIKEYTAB;
 }
 	YY_BREAK
-case 183:
+case 194:
 YY_RULE_SETUP
-#line 1415 "config_scan.l"
+#line 1470 "config_scan.l"
 {
        BEGIN(start_encryption);
 
@@ -5488,9 +5650,9 @@ YY_RULE_SETUP
    return GSSAPIENCTYPE;
 }
 	YY_BREAK
-case 184:
+case 195:
 YY_RULE_SETUP
-#line 1422 "config_scan.l"
+#line 1477 "config_scan.l"
 {
        BEGIN(start_ldapbasedn);
 
@@ -5498,9 +5660,9 @@ YY_RULE_SETUP
    return LDAPBASEDN;
 }
 	YY_BREAK
-case 185:
+case 196:
 YY_RULE_SETUP
-#line 1429 "config_scan.l"
+#line 1484 "config_scan.l"
 {
        BEGIN(start_ldapbasedn);
 
@@ -5508,9 +5670,9 @@ YY_RULE_SETUP
    return LDAPBASEDN_HEX;
 }
 	YY_BREAK
-case 186:
+case 197:
 YY_RULE_SETUP
-#line 1436 "config_scan.l"
+#line 1491 "config_scan.l"
 {
        BEGIN(start_ldapbasedn);
 
@@ -5518,25 +5680,25 @@ YY_RULE_SETUP
    return LDAPBASEDN_HEX_ALL;
 }
 	YY_BREAK
-case 187:
+case 198:
 YY_RULE_SETUP
-#line 1443 "config_scan.l"
+#line 1498 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return LDAPPORT;
 }
 	YY_BREAK
-case 188:
+case 199:
 YY_RULE_SETUP
-#line 1448 "config_scan.l"
+#line 1503 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return LDAPPORTSSL;
 }
 	YY_BREAK
-case 189:
+case 200:
 YY_RULE_SETUP
-#line 1453 "config_scan.l"
+#line 1508 "config_scan.l"
 {
        BEGIN(start_ldapurl);
 
@@ -5544,9 +5706,9 @@ YY_RULE_SETUP
    return LDAPURL;
 }
 	YY_BREAK
-case 190:
+case 201:
 YY_RULE_SETUP
-#line 1460 "config_scan.l"
+#line 1515 "config_scan.l"
 {
    BEGIN(start_ldapcertfile);
 
@@ -5554,9 +5716,9 @@ YY_RULE_SETUP
    return LDAPCERTFILE;
 }
 	YY_BREAK
-case 191:
+case 202:
 YY_RULE_SETUP
-#line 1467 "config_scan.l"
+#line 1522 "config_scan.l"
 {
    BEGIN(start_ldapcertpath);
 
@@ -5564,9 +5726,9 @@ YY_RULE_SETUP
    return LDAPCERTPATH;
 }
 	YY_BREAK
-case 192:
+case 203:
 YY_RULE_SETUP
-#line 1474 "config_scan.l"
+#line 1529 "config_scan.l"
 {
        BEGIN(start_ldapdomain);
 
@@ -5574,57 +5736,57 @@ YY_RULE_SETUP
    return LDAPDOMAIN;
 }
 	YY_BREAK
-case 193:
+case 204:
 YY_RULE_SETUP
-#line 1481 "config_scan.l"
+#line 1536 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return LDAPDEBUG;
 }
 	YY_BREAK
-case 194:
+case 205:
 YY_RULE_SETUP
-#line 1486 "config_scan.l"
+#line 1541 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return LDAPDEPTH;
 }
 	YY_BREAK
-case 195:
+case 206:
 YY_RULE_SETUP
-#line 1491 "config_scan.l"
+#line 1546 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return LDAPSSL;
 }
 	YY_BREAK
-case 196:
+case 207:
 YY_RULE_SETUP
-#line 1496 "config_scan.l"
+#line 1551 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return LDAPAUTO;
 }
 	YY_BREAK
-case 197:
+case 208:
 YY_RULE_SETUP
-#line 1501 "config_scan.l"
+#line 1556 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return LDAPCERTCHECK;
 }
 	YY_BREAK
-case 198:
+case 209:
 YY_RULE_SETUP
-#line 1506 "config_scan.l"
+#line 1561 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return LDAPKEEPREALM;
 }
 	YY_BREAK
-case 199:
+case 210:
 YY_RULE_SETUP
-#line 1511 "config_scan.l"
+#line 1566 "config_scan.l"
 {
        BEGIN(start_ldapfilter);
 
@@ -5632,9 +5794,9 @@ YY_RULE_SETUP
    return LDAPFILTER;
 }
 	YY_BREAK
-case 200:
+case 211:
 YY_RULE_SETUP
-#line 1518 "config_scan.l"
+#line 1573 "config_scan.l"
 {
        BEGIN(start_ldapfilter);
 
@@ -5642,9 +5804,9 @@ YY_RULE_SETUP
    return LDAPFILTER_AD;
 }
 	YY_BREAK
-case 201:
+case 212:
 YY_RULE_SETUP
-#line 1525 "config_scan.l"
+#line 1580 "config_scan.l"
 {
        BEGIN(start_ldapfilter);
 
@@ -5652,9 +5814,9 @@ YY_RULE_SETUP
    return LDAPFILTER_HEX;
 }
 	YY_BREAK
-case 202:
+case 213:
 YY_RULE_SETUP
-#line 1532 "config_scan.l"
+#line 1587 "config_scan.l"
 {
        BEGIN(start_ldapfilter);
 
@@ -5662,9 +5824,9 @@ YY_RULE_SETUP
    return LDAPFILTER_AD_HEX;
 }
 	YY_BREAK
-case 203:
+case 214:
 YY_RULE_SETUP
-#line 1539 "config_scan.l"
+#line 1594 "config_scan.l"
 {
        BEGIN(start_ldapattribute);
 
@@ -5672,9 +5834,9 @@ YY_RULE_SETUP
    return LDAPATTRIBUTE;
 }
 	YY_BREAK
-case 204:
+case 215:
 YY_RULE_SETUP
-#line 1546 "config_scan.l"
+#line 1601 "config_scan.l"
 {
        BEGIN(start_ldapattribute);
 
@@ -5682,9 +5844,9 @@ YY_RULE_SETUP
    return LDAPATTRIBUTE_AD;
 }
 	YY_BREAK
-case 205:
+case 216:
 YY_RULE_SETUP
-#line 1553 "config_scan.l"
+#line 1608 "config_scan.l"
 {
        BEGIN(start_ldapattribute);
 
@@ -5692,9 +5854,9 @@ YY_RULE_SETUP
    return LDAPATTRIBUTE_HEX;
 }
 	YY_BREAK
-case 206:
+case 217:
 YY_RULE_SETUP
-#line 1560 "config_scan.l"
+#line 1615 "config_scan.l"
 {
        BEGIN(start_ldapattribute);
 
@@ -5702,9 +5864,9 @@ YY_RULE_SETUP
    return LDAPATTRIBUTE_AD_HEX;
 }
 	YY_BREAK
-case 207:
+case 218:
 YY_RULE_SETUP
-#line 1567 "config_scan.l"
+#line 1622 "config_scan.l"
 {
    BEGIN(start_ldapservername);
 
@@ -5712,9 +5874,9 @@ YY_RULE_SETUP
    return LDAPSERVER;
 }
 	YY_BREAK
-case 208:
+case 219:
 YY_RULE_SETUP
-#line 1574 "config_scan.l"
+#line 1629 "config_scan.l"
 {
    BEGIN(start_ldapgroupname);
 
@@ -5722,9 +5884,9 @@ YY_RULE_SETUP
    return LDAPGROUP;
 }
 	YY_BREAK
-case 209:
+case 220:
 YY_RULE_SETUP
-#line 1581 "config_scan.l"
+#line 1636 "config_scan.l"
 {
    BEGIN(start_ldapgroupname);
 
@@ -5732,9 +5894,9 @@ YY_RULE_SETUP
    return LDAPGROUP_HEX;
 }
 	YY_BREAK
-case 210:
+case 221:
 YY_RULE_SETUP
-#line 1588 "config_scan.l"
+#line 1643 "config_scan.l"
 {
    BEGIN(start_ldapgroupname);
 
@@ -5742,9 +5904,9 @@ YY_RULE_SETUP
    return LDAPGROUP_HEX_ALL;
 }
 	YY_BREAK
-case 211:
+case 222:
 YY_RULE_SETUP
-#line 1595 "config_scan.l"
+#line 1650 "config_scan.l"
 {
    BEGIN(start_ldapkeytabname);
 
@@ -5752,17 +5914,17 @@ YY_RULE_SETUP
    return LDAPKEYTAB;
 }
 	YY_BREAK
-case 212:
+case 223:
 YY_RULE_SETUP
-#line 1602 "config_scan.l"
+#line 1657 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return BOUNCE;
 }
 	YY_BREAK
-case 213:
+case 224:
 YY_RULE_SETUP
-#line 1607 "config_scan.l"
+#line 1662 "config_scan.l"
 {
   BEGIN(start_realmname);
 
@@ -5773,16 +5935,16 @@ YY_RULE_SETUP
 /*
   * global keywords that are no longer used.
   */
-case 214:
+case 225:
 YY_RULE_SETUP
-#line 1618 "config_scan.l"
+#line 1673 "config_scan.l"
 {
    yywarnx_deprecated(socks_yytext, NULL);
 }
 	YY_BREAK
-case 215:
+case 226:
 YY_RULE_SETUP
-#line 1622 "config_scan.l"
+#line 1677 "config_scan.l"
 {
    yywarnx_deprecated(socks_yytext, "timeout.connect");
 
@@ -5790,9 +5952,9 @@ YY_RULE_SETUP
    return CONNECTTIMEOUT;
 }
 	YY_BREAK
-case 216:
+case 227:
 YY_RULE_SETUP
-#line 1629 "config_scan.l"
+#line 1684 "config_scan.l"
 {
    yywarnx_deprecated(socks_yytext, "timeout.io");
 
@@ -5800,9 +5962,9 @@ YY_RULE_SETUP
    return IOTIMEOUT;
 }
 	YY_BREAK
-case 217:
+case 228:
 YY_RULE_SETUP
-#line 1636 "config_scan.l"
+#line 1691 "config_scan.l"
 {
    yylval.deprecated.oldname = socks_yytext;
 
@@ -5820,9 +5982,9 @@ YY_RULE_SETUP
     * note that to support negative numbers we need to handle number ranges
     * like port 1-65535 correctly also.
     */
-case 218:
+case 229:
 YY_RULE_SETUP
-#line 1655 "config_scan.l"
+#line 1710 "config_scan.l"
 {
    char *ep;
    long long llval;
@@ -5844,43 +6006,43 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 /* ignored */
-case 219:
+case 230:
 YY_RULE_SETUP
-#line 1676 "config_scan.l"
+#line 1731 "config_scan.l"
 {
    ;
 }
 	YY_BREAK
 /* shell style comment */
-case 220:
+case 231:
 YY_RULE_SETUP
-#line 1681 "config_scan.l"
+#line 1736 "config_scan.l"
 {
    BEGIN(0);
    ;
 }
 	YY_BREAK
 /* state always ends at eol ... */
-case 221:
-/* rule 221 can match eol */
+case 232:
+/* rule 232 can match eol */
 YY_RULE_SETUP
-#line 1687 "config_scan.l"
+#line 1742 "config_scan.l"
 {
    BEGIN(0);
 }
 	YY_BREAK
 /* ... unless it's escaped. */
-case 222:
-/* rule 222 can match eol */
+case 233:
+/* rule 233 can match eol */
 YY_RULE_SETUP
-#line 1692 "config_scan.l"
+#line 1747 "config_scan.l"
 {
    ;
 }
 	YY_BREAK
-case 223:
+case 234:
 YY_RULE_SETUP
-#line 1696 "config_scan.l"
+#line 1751 "config_scan.l"
 {
    inclientrule = inroute = 0;
 
@@ -5888,20 +6050,20 @@ YY_RULE_SETUP
    return *socks_yytext;
 }
 	YY_BREAK
-case 224:
+case 235:
 YY_RULE_SETUP
-#line 1703 "config_scan.l"
+#line 1758 "config_scan.l"
 {
    yylval.string = socks_yytext;
    return *socks_yytext;
 }
 	YY_BREAK
-case 225:
+case 236:
 YY_RULE_SETUP
-#line 1708 "config_scan.l"
+#line 1763 "config_scan.l"
 ECHO;
 	YY_BREAK
-#line 5904 "config_scan.c"
+#line 6066 "config_scan.c"
 			case YY_STATE_EOF(INITIAL):
 			case YY_STATE_EOF(start_address):
 			case YY_STATE_EOF(start_port):
@@ -6211,7 +6373,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 2576 )
+			if ( yy_current_state >= 2760 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -6234,11 +6396,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 2576 )
+		if ( yy_current_state >= 2760 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 2575);
+	yy_is_jam = (yy_current_state == 2759);
 	if ( ! yy_is_jam )
 		*(yy_state_ptr)++ = yy_current_state;
 
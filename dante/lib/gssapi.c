@@ -410,8 +410,8 @@ gssapi_decode_read(s, buf, len, flags, from, fromlen, recvflags, gs)
    gss_buffer_desc input_token, output_token;
    iobuffer_t *iobuf = NULL;
    unsigned short encodedlen;
-   unsigned char inputmem[sizeof(iobuf->buf[0])],
-                 outputmem[sizeof(iobuf->buf[0])];
+   unsigned char inputmem[SOCKD_BUFSIZE],
+                 outputmem[SOCKD_BUFSIZE];
    ssize_t nread, encoded_left_to_read;
    size_t tokennumber, p, readfrombuf, mintoread;
    char emsg[512];
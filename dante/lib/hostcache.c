@@ -54,19 +54,48 @@ static const char rcsid[] =
 
 #if !SOCKS_CLIENT
 
-#define MIN_HASH_SIZE (10240)
 /*
- * Assume this is so small a cache that it's better to just scan it
- * sequentially rather than expire DNS-entries that we could otherwise
- * have continued to keep in the cache.
+ * The hostcache is divided into buckets of SOCKD_HOSTCACHE_WAYS entries.
+ * A name or address can only be cached in the bucket it hashes to, so a
+ * lookup only has to look at that bucket, and only that bucket needs to
+ * be locked while we do it.
+ *
+ * Each bucket keeps a small index of the hash values of its entries,
+ * so we only need to touch the (large) entries whose hash matches.
  */
+typedef struct {
+   uint32_t       hashv[SOCKD_HOSTCACHE_WAYS]; /*
+                                                * hash of the key of the
+                                                * corresponding entry, or 0
+                                                * if the entry is free.
+                                                */
+   unsigned char  usedv[SOCKD_HOSTCACHE_WAYS]; /*
+                                                * entry used since last time
+                                                * the clock hand passed it?
+                                                */
+   unsigned char  hand;                        /*
+                                                * next entry to consider for
+                                                * reuse if bucket is full.
+                                                */
+} hostbucket_t;
 
-static size_t
-hosthash(const char *name, const size_t size);
 /*
- * Calculates a hash value for "name" and returns it's value.
- * Size of hash table is given by "size".
-*/
+ * Locks/unlocks bucket "bucket" of the hostcache.  Each bucket has its
+ * own byte in the lockfile, so processes looking up different buckets
+ * do not wait for each other.
+ */
+#define HOSTBUCKET_LOCK(bucket, exclusive)                                     \
+   socks_lock(sockscf.hostfd, (off_t)(bucket), (off_t)1, (exclusive), 1)
+
+#define HOSTBUCKET_UNLOCK(bucket)                                              \
+   socks_unlock(sockscf.hostfd, (off_t)(bucket), (off_t)1)
+
+static uint32_t
+hosthash(const char *name);
+/*
+ * Calculates a hash value for the hostname "name" and returns it's value.
+ * The value is never 0.
+ */
 
 static hostentry_t *
 hostentcopy(hostentry_t *to, const struct hostent *from);
@@ -88,12 +117,23 @@ hostentcopy(hostentry_t *to, const struct hostent *from);
 
 
 
-static size_t
-addrhash(const struct sockaddr_storage *addr, const size_t size);
+static uint32_t
+addrhash(const struct sockaddr_storage *addr);
 /*
  * Calculates a hash value for the IP-address "addr" and returns it's value.
- * Size of hash table is given by "size".
-*/
+ * The value is never 0.
+ */
+
+static size_t
+hostbucket_victim(const size_t bucket, const time_t timenow);
+/*
+ * Returns the index of the entry in bucket "bucket" that should be used
+ * for a new result.  A free or expired entry is used if there is one,
+ * otherwise the least recently used entry, as approximated by the clock
+ * algorithm.
+ *
+ * Must be called with the bucket locked exclusively.
+ */
 
 static int
 addrisinlist(const struct sockaddr *addr, struct addrinfo *ailist,
@@ -105,17 +145,36 @@ addrisinlist(const struct sockaddr *addr, struct addrinfo *ailist,
  * Returns false otherwise.
  */
 
-dnsinfo_t *
-getoldest( const size_t starti);
-/*
- * Returns the oldest entry at index "starti" or later.
- */
-
 static int
 name_matches_cache(const dnsinfo_t *cacheentry,
                    const char *name, const char *service,
                    const struct addrinfo *hints);
 static int
+resolved_matches_cache(const dnsinfo_t *cacheentry, const char *name);
+/*
+ * Returns true if "cacheentry" holds the result our own resolver got
+ * for the hostname "name".
+ */
+
+static int
+resolved_isusable(const dnsinfo_t *cacheentry, const time_t timenow);
+/*
+ * Returns true if the resolver-added "cacheentry" can be used at
+ * "timenow", i.e. if it has not expired yet, or has expired so recently
+ * that we still serve it while it is being refreshed.
+ */
+
+static int
+resolvedcopy(dnsinfo_t *to, const dnsinfo_t *from,
+             const struct addrinfo *hints);
+/*
+ * Copies the addresses in the resolver-added entry "from" matching "hints"
+ * into "to", in the form getaddrinfo(3) would have returned them.
+ *
+ * Returns an errorcode of the same type as getaddrinfo(3).
+ */
+
+static int
 addr_matches_cache(const dnsinfo_t *cacheentry, const struct sockaddr *addr,
                    const int flags);
 
@@ -133,9 +192,12 @@ size_t cbyaddr_hit, cbyaddr_miss;
 #endif /* !STANDALONE_UNIT_TEST */
 
 /*
- * hostname/ipaddress cache.  Shared among all processes.
+ * hostname/ipaddress cache.  Shared among all processes.  NULL if we
+ * have no cache, or have not yet set it up.
  */
 UNIT_TEST_STATIC_SCOPE dnsinfo_t *hostcache;
+static hostbucket_t              *hostbucketv;  /* index of hostcache.       */
+static size_t                    hostbucketc;   /* # of buckets in the above.*/
 
 
 static int
@@ -255,14 +317,14 @@ cgetaddrinfo(name, service, hints, res, resmem)
 
 #else /* !SOCKS_CLIENT */
 
-   static size_t i;
    static int count;
    const time_t timenow = time_monotonic(NULL);
 #if !STANDALONE_UNIT_TEST
    static size_t cbyname_hit, cbyname_miss;
 #endif /* !STANDALONE_UNIT_TEST */
-   dnsinfo_t *freehost;
-   size_t hashi;
+   dnsinfo_t *freehost, *entryv = NULL;
+   uint32_t hash;
+   size_t i, bucket = 0;
    int have_oldres = 0;
 
    SASSERTX(res    != NULL);
@@ -293,101 +355,86 @@ cgetaddrinfo(name, service, hints, res, resmem)
       return EAI_MEMORY;
    }
 
-   socks_lock(sockscf.hostfd, 0, 0, 0, 1);
+   hash = hosthash(name);
+
+   if (hostcache != NULL) {
+      bucket = hash % hostbucketc;
+      entryv = &hostcache[bucket * SOCKD_HOSTCACHE_WAYS];
+
+      HOSTBUCKET_LOCK(bucket, 0);
+
+      for (i = 0; i < SOCKD_HOSTCACHE_WAYS; ++i) {
+         if (hostbucketv[bucket].hashv[i] != hash
+         ||  !name_matches_cache(&entryv[i], name, service, hints))
+            continue;
+
+         if (socks_difftime(timenow, entryv[i].written) >= entryv[i].lifetime) {
+            /*
+             * In cache, but expired already.  Keep the old result in
+             * case we are unable to resolve the name now.
+             */
+            if (entryv[i].gai_rc == 0) {
+               gai_rc = addrinfocopy(resmem,
+                                     &entryv[i].data.getaddr.addrinfo,
+                                     hints);
+
+               SASSERTX(gai_rc == 0);
+               have_oldres = 1;
+            }
+
+            break;
+         }
 
-   /*
-    * First check if the desired name is the same as last time.
-    */
-   if (i < SOCKD_HOSTCACHE
-   &&  name_matches_cache(&hostcache[i], name, service, hints)) {
-      if (socks_difftime(timenow, hostcache[i].written) < SOCKD_CACHETIMEOUT) {
          ++cbyname_hit;
 
-         if (hostcache[i].gai_rc == 0) {
+         /*
+          * Only a hint for hostbucket_victim(), so no need for an
+          * exclusive lock when setting it.
+          */
+         hostbucketv[bucket].usedv[i] = 1;
+
+         if ((gai_rc = entryv[i].gai_rc) == 0) {
             gai_rc = addrinfocopy(resmem,
-                                  &hostcache[i].data.getaddr.addrinfo,
+                                  &entryv[i].data.getaddr.addrinfo,
                                   hints);
-            SASSERTX(gai_rc == 0);
 
+            SASSERTX(gai_rc == 0);
             *res = &resmem->data.getaddr.addrinfo;
          }
 
-         socks_unlock(sockscf.hostfd, 0, 0);
-         return hostcache[i].gai_rc;
+         HOSTBUCKET_UNLOCK(bucket);
+         return gai_rc;
       }
 
       /*
-       * Else; in cache, but expired already.
+       * Not cached for these hints, but our own resolver may have looked
+       * up the name on behalf of a request already.
        */
-      freehost = &hostcache[i];
-      hashi    = hosthash(name, SOCKD_HOSTCACHE);
-
-      if (freehost->gai_rc == 0) {
-         gai_rc = addrinfocopy(resmem,
-                               &freehost->data.getaddr.addrinfo,
-                               hints);
-
-         SASSERTX(gai_rc == 0);
-         have_oldres = 1;
-      }
-   }
-   else {
-      /*
-       * Go through the entire in the cache, looking for a match.
-       */
-
-      hashi = hosthash(name, SOCKD_HOSTCACHE);
-      for (i = hashi, freehost = NULL; i < SOCKD_HOSTCACHE; ++i) {
-         if (!hostcache[i].allocated) {
-            if (freehost == NULL)
-               freehost = &hostcache[i];
-
-            continue;
-         }
-
-         if (name_matches_cache(&hostcache[i], name, service, hints)) {
-            if (socks_difftime(timenow, hostcache[i].written)
-            >= SOCKD_CACHETIMEOUT) {
-               freehost = &hostcache[i];
-
-               if (freehost->gai_rc == 0) {
-                  gai_rc = addrinfocopy(resmem,
-                                        &freehost->data.getaddr.addrinfo,
-                                        hints);
-
-                  SASSERTX(gai_rc == 0);
-                  have_oldres = 1;
-               }
-
-               break;
-            }
+      if (service == NULL
+      && (hints == NULL || !(hints->ai_flags & AI_NUMERICHOST))) {
+         for (i = 0; i < SOCKD_HOSTCACHE_WAYS; ++i) {
+            if (hostbucketv[bucket].hashv[i] != hash
+            ||  !resolved_matches_cache(&entryv[i], name)
+            ||  !resolved_isusable(&entryv[i], timenow))
+               continue;
 
             ++cbyname_hit;
+            hostbucketv[bucket].usedv[i] = 1;
 
-            if (hostcache[i].gai_rc != 0) {
-               socks_unlock(sockscf.hostfd, 0, 0);
-               return hostcache[i].gai_rc;
-            }
-
-            gai_rc = addrinfocopy(resmem,
-                                  &hostcache[i].data.getaddr.addrinfo,
-                                  hints);
-
-            SASSERTX(gai_rc == 0);
+            if ((gai_rc = resolvedcopy(resmem, &entryv[i], hints)) == 0)
+               *res = &resmem->data.getaddr.addrinfo;
 
-            socks_unlock(sockscf.hostfd, 0, 0);
-
-            *res = &resmem->data.getaddr.addrinfo;
-            return 0;
+            HOSTBUCKET_UNLOCK(bucket);
+            return gai_rc;
          }
       }
-   }
 
-   /*
-    * Nope, this name is not in the cache.  Have to resolve.
-    */
+      /*
+       * Nope, this name is not in the cache.  Have to resolve.
+       */
 
-   socks_unlock(sockscf.hostfd, 0, 0);
+      HOSTBUCKET_UNLOCK(bucket);
+   }
 
    ++cbyname_miss;
 
@@ -491,18 +538,33 @@ cgetaddrinfo(name, service, hints, res, resmem)
       res  = NULL;
    }
 
-   socks_lock(sockscf.hostfd, 0, 0, 1, 1);
+   if (hostcache == NULL)
+      /*
+       * Nowhere to cache it; just give the caller the result.
+       */
+      freehost = resmem;
+   else {
+      HOSTBUCKET_LOCK(bucket, 1);
 
-   if (freehost == NULL)
-      freehost = getoldest(hashi);
-   /*
-    * else: contents pointed to can have changed, in which case we may now
-    * be overwriting one of the most recent entries, but never mind that;
-    * that unlikely case is not important enough to warrant locking and
-    * scanning for the oldest entry now.
-    */
+      /*
+       * Reuse the entry holding an old result for this name if there
+       * is one.  We, or another process, may have added it after we
+       * looked, so need to check again.
+       */
+      for (i = 0; i < SOCKD_HOSTCACHE_WAYS; ++i)
+         if (hostbucketv[bucket].hashv[i] == hash
+         &&  name_matches_cache(&entryv[i], name, service, hints))
+            break;
+
+      if (i >= SOCKD_HOSTCACHE_WAYS)
+         i = hostbucket_victim(bucket, timenow);
 
-   SASSERTX(freehost != NULL);
+      freehost = &entryv[i];
+
+      hostbucketv[bucket].hashv[i] = 0;
+      hostbucketv[bucket].usedv[i] = 0;
+      freehost->allocated          = 0;
+   }
 
    if (gai_rc == 0) {
       gai_rc = addrinfocopy(freehost, *res, hints);
@@ -524,7 +586,9 @@ cgetaddrinfo(name, service, hints, res, resmem)
                                        sizeof(servicebuf)),
                    gai_strerror(gai_rc));
 
-         socks_unlock(sockscf.hostfd, 0, 0);
+         if (freehost != resmem)
+            HOSTBUCKET_UNLOCK(bucket);
+
          return gai_rc;
       }
    }
@@ -545,17 +609,25 @@ cgetaddrinfo(name, service, hints, res, resmem)
       STRCPY_ASSERTLEN(freehost->service, service);
 
    freehost->written   = timenow;
+   freehost->lifetime  = hostcache_lifetime(gai_rc == 0 ?
+                                 SOCKD_CACHETIMEOUT
+                               : SOCKD_CACHETIMEOUT_NEGATIVE);
    freehost->gai_rc    = gai_rc;
+   freehost->resolved  = 0;
    freehost->allocated = 1;
 
    SASSERTX(freehost->key == id_name);
 
-   if (gai_rc == 0) {
-      gai_rc = addrinfocopy(resmem, &freehost->data.getaddr.addrinfo, hints);
-      SASSERTX(gai_rc == 0);
-   }
+   if (freehost != resmem) {
+      hostbucketv[bucket].hashv[i] = hash;
 
-   socks_unlock(sockscf.hostfd, 0, 0);
+      if (gai_rc == 0) {
+         gai_rc = addrinfocopy(resmem, &freehost->data.getaddr.addrinfo, hints);
+         SASSERTX(gai_rc == 0);
+      }
+
+      HOSTBUCKET_UNLOCK(bucket);
+   }
 
    resmem->gai_rc = gai_rc;
    if (resmem->gai_rc == 0)
@@ -581,23 +653,23 @@ cgetnameinfo(addr, addrlen, _host, _hostlen, _service, _servicelen, flags)
 #if !STANDALONE_UNIT_TEST
    static size_t cbyaddr_hit, cbyaddr_miss;
 #endif /* !STANDALONE_UNIT_TEST */
-   static size_t i;
    static int count;
-   dnsinfo_t *freehost;
-   size_t hashi;
+   dnsinfo_t *freehost, *entryv = NULL;
+   uint32_t hash;
+   size_t i, bucket = 0;
    char host[sizeof(freehost->data.getname.name)],
         service[sizeof(freehost->service)];
    int gai_rc, have_oldres = 0;
 
-#define DOCOPY(_host, _hostlen, _service, _servicelen, cacheentry)             \
+#define DOCOPY(_host, _hostlen, _service, _servicelen, fromhost, fromservice)  \
 do {                                                                           \
    if ((_hostlen) > 0) {                                                       \
-      strncpy((_host), (cacheentry)->data.getname.name, (_hostlen) - 1);       \
+      strncpy((_host), (fromhost), (_hostlen) - 1);                            \
       (_host)[(_hostlen) - 1] = NUL;                                           \
    }                                                                           \
                                                                                \
    if ((_servicelen) > 0) {                                                    \
-      strncpy((_service), (cacheentry)->service, (_servicelen) - 1);           \
+      strncpy((_service), (fromservice), (_servicelen) - 1);                   \
       (_service)[(_servicelen) - 1] = NUL;                                     \
    }                                                                           \
 } while (/* CONSTCOND */ 0)
@@ -607,81 +679,57 @@ do {                                                                           \
            function, (unsigned long)cbyaddr_hit, (unsigned long)cbyaddr_miss);
    }
 
-   socks_lock(sockscf.hostfd, 0, 0, 0, 1);
+   hash = addrhash(TOCSS(addr));
 
-   /*
-    * First check if the desired name is the same as last time.
-    */
-   if (i < SOCKD_HOSTCACHE
-   &&  addr_matches_cache(&hostcache[i], addr, flags)) {
-      if (socks_difftime(timenow, hostcache[i].written) < SOCKD_CACHETIMEOUT) {
-         ++cbyaddr_hit;
+   if (hostcache != NULL) {
+      bucket = hash % hostbucketc;
+      entryv = &hostcache[bucket * SOCKD_HOSTCACHE_WAYS];
 
-         if (hostcache[i].gai_rc == 0)
-            DOCOPY(_host, _hostlen, _service, _servicelen, &hostcache[i]);
-
-         socks_unlock(sockscf.hostfd, 0, 0);
-         return hostcache[i].gai_rc;
-      }
-
-      /*
-       * Else; have an entry, but it's expired already.
-       */
-
-      freehost = &hostcache[i];
-      hashi    = addrhash(TOCSS(addr), SOCKD_HOSTCACHE);
-
-      if (freehost->gai_rc == 0) {
-         DOCOPY(_host, _hostlen, _service, _servicelen, freehost);
-         have_oldres = 1;
-      }
-
-   }
-   else {
-      /*
-       * Go through the cache and see if there is match there.
-       */
-      hashi = addrhash(TOCSS(addr), SOCKD_HOSTCACHE);
-      for (i = hashi, freehost = NULL; i < SOCKD_HOSTCACHE; ++i) {
-         if (!hostcache[i].allocated) {
-            if (freehost == NULL)
-               freehost = &hostcache[i];
+      HOSTBUCKET_LOCK(bucket, 0);
 
+      for (i = 0; i < SOCKD_HOSTCACHE_WAYS; ++i) {
+         if (hostbucketv[bucket].hashv[i] != hash
+         ||  !addr_matches_cache(&entryv[i], addr, flags))
             continue;
-         }
 
-         if (addr_matches_cache(&hostcache[i], addr, flags)) {
-            if (socks_difftime(timenow, hostcache[i].written)
-            >= SOCKD_CACHETIMEOUT) {
-               freehost = &hostcache[i];
-
-               if (freehost->gai_rc == 0) {
-                  DOCOPY(_host, _hostlen, _service, _servicelen, freehost);
-                  have_oldres = 1;
-               }
-
-               break;
+         if (socks_difftime(timenow, entryv[i].written) >= entryv[i].lifetime) {
+            /*
+             * Have an entry, but it's expired already.
+             */
+            if (entryv[i].gai_rc == 0) {
+               DOCOPY(_host,
+                      _hostlen,
+                      _service,
+                      _servicelen,
+                      entryv[i].data.getname.name,
+                      entryv[i].service);
+
+               have_oldres = 1;
             }
 
-            ++cbyaddr_hit;
+            break;
+         }
 
-            if (hostcache[i].gai_rc != 0) {
-               socks_unlock(sockscf.hostfd, 0, 0);
-               return hostcache[i].gai_rc;
-            }
+         ++cbyaddr_hit;
+         hostbucketv[bucket].usedv[i] = 1;
 
-            DOCOPY(_host, _hostlen, _service, _servicelen, &hostcache[i]);
+         if ((gai_rc = entryv[i].gai_rc) == 0)
+            DOCOPY(_host,
+                   _hostlen,
+                   _service,
+                   _servicelen,
+                   entryv[i].data.getname.name,
+                   entryv[i].service);
 
-            socks_unlock(sockscf.hostfd, 0, 0);
-            return 0;
-         }
+         HOSTBUCKET_UNLOCK(bucket);
+         return gai_rc;
       }
+
+      HOSTBUCKET_UNLOCK(bucket);
    }
 
    ++cbyaddr_miss;
 
-   socks_unlock(sockscf.hostfd, 0, 0);
-
 #if SOCKSLIBRARY_DYNAMIC
    /*
     * In case getnameinfo(3) resolves to some other libresolv call
@@ -759,31 +807,45 @@ do {                                                                           \
          SERR(gai_rc);
    }
 
-   socks_lock(sockscf.hostfd, 0, 0, 1, -1);
+   if (hostcache != NULL) {
+      HOSTBUCKET_LOCK(bucket, 1);
 
-   if (freehost == NULL)
-      freehost = getoldest(hashi);
+      for (i = 0; i < SOCKD_HOSTCACHE_WAYS; ++i)
+         if (hostbucketv[bucket].hashv[i] == hash
+         &&  addr_matches_cache(&entryv[i], addr, flags))
+            break;
 
-   SASSERTX(freehost != NULL);
+      if (i >= SOCKD_HOSTCACHE_WAYS)
+         i = hostbucket_victim(bucket, timenow);
 
-   freehost->gai_rc = gai_rc;
+      freehost = &entryv[i];
 
-   STRCPY_ASSERTSIZE(freehost->service, service);
-   STRCPY_ASSERTSIZE(freehost->data.getname.name, host);
+      freehost->gai_rc = gai_rc;
 
-   freehost->data.getname.flags = flags;
-   freehost->written            = timenow;
-   freehost->key                = id_addr;
-   memcpy(&freehost->id.addr, addr, MIN(sizeof(freehost->id.addr), addrlen));
+      STRCPY_ASSERTSIZE(freehost->service, service);
+      STRCPY_ASSERTSIZE(freehost->data.getname.name, host);
 
-   freehost->allocated = 1;
+      freehost->data.getname.flags = flags;
+      freehost->written            = timenow;
+      freehost->lifetime           = hostcache_lifetime(gai_rc == 0 ?
+                                               SOCKD_CACHETIMEOUT
+                                             : SOCKD_CACHETIMEOUT_NEGATIVE);
+      freehost->resolved           = 0;
+      freehost->key                = id_addr;
+      memcpy(&freehost->id.addr, addr, MIN(sizeof(freehost->id.addr), addrlen));
 
-   socks_unlock(sockscf.hostfd, 0, 0);
+      freehost->allocated = 1;
 
-   if (freehost->gai_rc == 0)
-      DOCOPY(_host, _hostlen, _service, _servicelen, freehost);
+      hostbucketv[bucket].hashv[i] = hash;
+      hostbucketv[bucket].usedv[i] = 0;
+
+      HOSTBUCKET_UNLOCK(bucket);
+   }
+
+   if (gai_rc == 0)
+      DOCOPY(_host, _hostlen, _service, _servicelen, host, service);
 
-   return freehost->gai_rc;
+   return gai_rc;
 }
 #endif /* !SOCKS_CLIENT */
 
@@ -996,14 +1058,156 @@ hostcacheinvalidate(void)
 
    slog(LOG_DEBUG, "%s", function);
 
-   socks_lock(sockscf.hostfd, 0, 0, 0, 1);
+   if (hostcache == NULL)
+      return;
+
+   /*
+    * Locks all buckets.
+    */
+   socks_lock(sockscf.hostfd, 0, 0, 1, 1);
 
-   for (i = 0; i < SOCKD_HOSTCACHE; ++i)
+   for (i = 0; i < hostbucketc * SOCKD_HOSTCACHE_WAYS; ++i)
       hostcache[i].allocated = 0;
 
+   bzero(hostbucketv, sizeof(*hostbucketv) * hostbucketc);
+
    socks_unlock(sockscf.hostfd, 0, 0);
 }
 
+int
+hostcache_isresolved(name, dorefresh)
+   const char *name;
+   int *dorefresh;
+{
+   const time_t timenow = time_monotonic(NULL);
+   dnsinfo_t *entryv;
+   uint32_t hash;
+   size_t i, bucket;
+   int isresolved = 0;
+
+   *dorefresh = 0;
+
+   if (hostcache == NULL)
+      return 0;
+
+   hash   = hosthash(name);
+   bucket = hash % hostbucketc;
+   entryv = &hostcache[bucket * SOCKD_HOSTCACHE_WAYS];
+
+   HOSTBUCKET_LOCK(bucket, 0);
+
+   for (i = 0; i < SOCKD_HOSTCACHE_WAYS; ++i)
+      if (hostbucketv[bucket].hashv[i] == hash
+      &&  resolved_matches_cache(&entryv[i], name)
+      &&  resolved_isusable(&entryv[i], timenow)) {
+         isresolved = 1;
+
+         if (socks_difftime(timenow, entryv[i].written) >= entryv[i].lifetime
+         &&  entryv[i].refreshing == 0) {
+            /*
+             * Expired.  Only a hint to other processes that we will
+             * refresh it, so no need for an exclusive lock to set it.
+             */
+            entryv[i].refreshing = timenow;
+            *dorefresh           = 1;
+         }
+
+         break;
+      }
+
+   HOSTBUCKET_UNLOCK(bucket);
+
+   return isresolved;
+}
+
+void
+hostcache_addresolved(name, gai_rc, ai, lifetime)
+   const char *name;
+   const int gai_rc;
+   const struct addrinfo *ai;
+   const time_t lifetime;
+{
+   const char *function = "hostcache_addresolved()";
+   const time_t timenow = time_monotonic(NULL);
+   dnsinfo_t *entry, *entryv;
+   uint32_t hash;
+   size_t i, bucket;
+   int rc;
+   char visbuf[MAXHOSTNAMELEN * 4];
+
+   if (hostcache == NULL)
+      return;
+
+   SASSERTX(strlen(name) < sizeof(entry->id.name));
+
+   hash   = hosthash(name);
+   bucket = hash % hostbucketc;
+   entryv = &hostcache[bucket * SOCKD_HOSTCACHE_WAYS];
+
+   HOSTBUCKET_LOCK(bucket, 1);
+
+   for (i = 0; i < SOCKD_HOSTCACHE_WAYS; ++i)
+      if (hostbucketv[bucket].hashv[i] == hash
+      &&  resolved_matches_cache(&entryv[i], name))
+         break;
+
+   if (i >= SOCKD_HOSTCACHE_WAYS)
+      i = hostbucket_victim(bucket, timenow);
+   else if (gai_rc == EAI_AGAIN
+   &&       entryv[i].gai_rc != EAI_AGAIN
+   &&       resolved_isusable(&entryv[i], timenow)) {
+      /*
+       * Failed to refresh the entry.  Better to go on serving the old
+       * result until it becomes too old.
+       */
+      slog(LOG_DEBUG, "%s: keeping stale entry for \"%s\"",
+           function, str2vis(name, strlen(name), visbuf, sizeof(visbuf)));
+
+      HOSTBUCKET_UNLOCK(bucket);
+      return;
+   }
+
+   entry = &entryv[i];
+
+   hostbucketv[bucket].hashv[i] = 0;
+   hostbucketv[bucket].usedv[i] = 0;
+   entry->allocated             = 0;
+
+   if (gai_rc == 0 && (rc = addrinfocopy(entry, ai, NULL)) != 0) {
+      slog(LOG_DEBUG, "%s: not caching \"%s\"; addrinfocopy() failed: %s",
+           function,
+           str2vis(name, strlen(name), visbuf, sizeof(visbuf)),
+           gai_strerror(rc));
+
+      HOSTBUCKET_UNLOCK(bucket);
+      return;
+   }
+
+   entry->data.getaddr.hints = NULL;
+   entry->key                = id_name;
+   STRCPY_ASSERTLEN(entry->id.name, name);
+   *entry->service           = NUL;
+
+   entry->written    = timenow;
+   entry->lifetime   = lifetime;
+   entry->refreshing = 0;
+   entry->gai_rc     = gai_rc;
+   entry->resolved   = 1;
+   entry->allocated  = 1;
+
+   hostbucketv[bucket].hashv[i] = hash;
+
+   HOSTBUCKET_UNLOCK(bucket);
+}
+
+time_t
+hostcache_lifetime(ttl)
+   const time_t ttl;
+{
+
+   return MAX(MIN(ttl, sockscf.hostcache.ttl.max), sockscf.hostcache.ttl.min);
+}
+
 static int
 gai2h_errno(gai_rc)
    const int gai_rc;
@@ -1025,19 +1229,50 @@ void
 hostcachesetup(void)
 {
    const char *function = "hostcachesetup()";
+   size_t size;
+   void *mapping;
+
+   SASSERTX(hostcache == NULL);
+
+   sockscf.state.hostcacheentries = sockscf.hostcache.entries;
 
    if ((sockscf.hostfd = socks_mklock(SOCKD_SHMEMFILE, NULL, 0)) == -1)
       serr("%s: socks_mklock() failed to create shmemfile using base %s",
            function, SOCKD_SHMEMFILE);
 
-   if ((hostcache = sockd_mmap(NULL,
-                               sizeof(*hostcache) * SOCKD_HOSTCACHE,
-                               PROT_READ | PROT_WRITE,
-                               MAP_SHARED,
-                               sockscf.hostfd,
-                               1)) == MAP_FAILED)
+   if (sockscf.hostcache.entries == 0) {
+      slog(LOG_DEBUG, "%s: hostcache disabled", function);
+      return;
+   }
+
+   hostbucketc = (sockscf.hostcache.entries + SOCKD_HOSTCACHE_WAYS - 1)
+               / SOCKD_HOSTCACHE_WAYS;
+
+   /*
+    * The entries first, then the bucket index.  The mapping is not
+    * touched until used, so only the part of a large cache that is
+    * actually used takes up memory.
+    */
+   size = sizeof(*hostcache)   * hostbucketc * SOCKD_HOSTCACHE_WAYS
+        + sizeof(*hostbucketv) * hostbucketc;
+
+   if ((mapping = sockd_mmap(NULL,
+                             size,
+                             PROT_READ | PROT_WRITE,
+                             MAP_SHARED,
+                             sockscf.hostfd,
+                             1)) == MAP_FAILED)
       serr("%s: failed to mmap(2) hostcache of size %lu",
-           function, (unsigned long)(sizeof(*hostcache) * SOCKD_HOSTCACHE));
+           function, (unsigned long)size);
+
+   hostcache   = mapping;
+   hostbucketv = (hostbucket_t *)&hostcache[hostbucketc * SOCKD_HOSTCACHE_WAYS];
+
+   slog(LOG_DEBUG, "%s: hostcache has %lu buckets of %d entries, %lu bytes",
+        function,
+        (unsigned long)hostbucketc,
+        SOCKD_HOSTCACHE_WAYS,
+        (unsigned long)size);
 }
 
 
@@ -1219,100 +1454,96 @@ hostentcopy(to, from)
    return to;
 }
 
-static size_t
-hosthash(name, size)
+/*
+ * FNV-1a, 32 bits.
+ */
+#define FNV_OFFSET   (2166136261U)
+#define FNV_PRIME    (16777619U)
+
+static uint32_t
+hosthash(name)
    const char *name;
-   const size_t size;
 {
-   unsigned int value;
-   char *end;
-
-   if (size < MIN_HASH_SIZE)
-      return 0;
+   uint32_t value;
 
-   /* don't bother scanning past second dot. */
-   if ((end = strchr(name, '.')) != NULL)
-      end = strchr(end + 1, '.');
-
-   if (end == NULL) /* zero or one dot in name. */
-      end = strchr(name, NUL);
-
-   SASSERTX(name <= end);
-
-   value = 0;
-   while (name != end) {
-      value = (value << 5) + *name;   /* MAW - DS&A: Horner's rule. */
+   /*
+    * Names are compared case-insensitively, so must hash the same
+    * regardless of case.
+    */
+   value = FNV_OFFSET;
+   while (*name != NUL) {
+      value ^= (unsigned char)tolower((unsigned char)*name);
+      value *= FNV_PRIME;
       ++name;
    }
 
-   return value % size;
+   return value == 0 ? 1 : value;
 }
 
-static size_t
-addrhash(addr, size)
+static uint32_t
+addrhash(addr)
    const struct sockaddr_storage *addr;
-   const size_t size;
 {
-   size_t sum;
-
-   if (size < MIN_HASH_SIZE)
-      /*
-       * Assume this is so small a cache that it's better to just scan
-       * it sequentially, rather than risk premature expiry of cached
-       * DNS-entries.
-       */
-      return 0;
+   const unsigned char *byte;
+   uint32_t value;
+   size_t i, len;
 
    switch (addr->ss_family) {
       case AF_INET:
-         sum = ntohl(TOCIN(addr)->sin_addr.s_addr);
+         byte = (const unsigned char *)&TOCIN(addr)->sin_addr;
+         len  = sizeof(TOCIN(addr)->sin_addr);
          break;
 
-      case AF_INET6: {
-         const unsigned char *byte   = TOCIN6(addr)->sin6_addr.s6_addr;
-         const size_t len            = sizeof(TOCIN6(addr)->sin6_addr.s6_addr),
-                      digits_wanted  = 4;
-         ssize_t i;
-         size_t digits_summed;
-
-         sum           = 0;
-         digits_summed = 0;
-         i             = len - 1;
-
-         while (i >= 0 && digits_summed < digits_wanted) {
-            if (byte[i] != 0) {
-               sum += byte[i];
-               ++digits_summed;
-            }
-
-            --i;
-         }
-
+      case AF_INET6:
+         byte = (const unsigned char *)&TOCIN6(addr)->sin6_addr;
+         len  = sizeof(TOCIN6(addr)->sin6_addr);
          break;
-      }
 
       default:
          SERRX(addr->ss_family);
    }
 
-   return sum % size;
+   /*
+    * Seed differently from hosthash() so a name and an address are
+    * unlikely to share a hash value.
+    */
+   value = FNV_OFFSET ^ (uint32_t)addr->ss_family;
+   for (i = 0; i < len; ++i) {
+      value ^= byte[i];
+      value *= FNV_PRIME;
+   }
+
+   return value == 0 ? 1 : value;
 }
 
-dnsinfo_t *
-getoldest(starti)
-   const size_t starti;
+static size_t
+hostbucket_victim(bucket, timenow)
+   const size_t bucket;
+   const time_t timenow;
 {
-   dnsinfo_t *oldest;
+   hostbucket_t *hb = &hostbucketv[bucket];
+   const dnsinfo_t *entryv = &hostcache[bucket * SOCKD_HOSTCACHE_WAYS];
    size_t i;
 
-   for (i = starti, oldest = NULL; i < SOCKD_HOSTCACHE; ++i) {
-      if (oldest == NULL
-      ||  hostcache[i].written < oldest->written)
-         oldest = &hostcache[i];
+   for (i = 0; i < SOCKD_HOSTCACHE_WAYS; ++i)
+      if (hb->hashv[i] == 0
+      ||  socks_difftime(timenow, entryv[i].written) >= entryv[i].lifetime)
+         return i;
+
+   /*
+    * All entries in use.  Give those used since the hand last passed
+    * them a second chance, and take the first one not used.  Terminates
+    * after at most one round, as we clear the used-flag as we go.
+    */
+   while (hb->usedv[hb->hand]) {
+      hb->usedv[hb->hand] = 0;
+      hb->hand            = (hb->hand + 1) % SOCKD_HOSTCACHE_WAYS;
    }
 
-   SASSERTX(oldest != NULL);
-   return oldest;
+   i        = hb->hand;
+   hb->hand = (hb->hand + 1) % SOCKD_HOSTCACHE_WAYS;
+
+   return i;
 }
 
 static int
@@ -1322,7 +1553,7 @@ name_matches_cache(ce, name, service, hints)
    const char *service;
    const struct addrinfo *hints;
 {
-   if (ce->allocated && ce->key == id_name) {
+   if (ce->allocated && ce->key == id_name && !ce->resolved) {
       if (hints == NULL) {
          if (ce->data.getaddr.hints != NULL)
             return 0;
@@ -1357,6 +1588,79 @@ name_matches_cache(ce, name, service, hints)
    return 0;
 }
 
+static int
+resolved_matches_cache(ce, name)
+   const dnsinfo_t *ce; /* cache entry. */
+   const char *name;
+{
+
+   return ce->allocated
+   &&     ce->resolved
+   &&     ce->key == id_name
+   &&     strcasecmp(ce->id.name, name) == 0;
+}
+
+static int
+resolved_isusable(ce, timenow)
+   const dnsinfo_t *ce; /* cache entry. */
+   const time_t timenow;
+{
+   const time_t age = socks_difftime(timenow, ce->written);
+
+   if (age < ce->lifetime)
+      return 1;
+
+   if (ce->gai_rc == EAI_AGAIN)
+      return 0; /* no result to serve. */
+
+   return age < ce->lifetime + SOCKD_HOSTCACHE_STALE;
+}
+
+static int
+resolvedcopy(to, from, hints)
+   dnsinfo_t *to;
+   const dnsinfo_t *from;
+   const struct addrinfo *hints;
+{
+   const struct addrinfo *ai;
+   struct addrinfo aiv[MAX_ADDRINFO_NEXT];
+   size_t i;
+
+   if (from->gai_rc != 0)
+      return from->gai_rc;
+
+   for (i = 0, ai = &from->data.getaddr.addrinfo;
+   i < ELEMENTS(aiv) && ai != NULL;
+   ai = ai->ai_next) {
+      if (hints != NULL
+      &&  hints->ai_family != 0
+      &&  hints->ai_family != ai->ai_family)
+         continue;
+
+      aiv[i]          = *ai;
+      aiv[i].ai_flags = 0;
+      aiv[i].ai_next  = NULL;
+
+      if (hints != NULL) {
+         aiv[i].ai_socktype = hints->ai_socktype;
+         aiv[i].ai_protocol = hints->ai_protocol;
+      }
+
+      if (i > 0 || hints == NULL || !(hints->ai_flags & AI_CANONNAME))
+         aiv[i].ai_canonname = NULL;
+
+      if (i > 0)
+         aiv[i - 1].ai_next = &aiv[i];
+
+      ++i;
+   }
+
+   if (i == 0)
+      return EAI_NONAME; /* have the name, but no address of this family. */
+
+   return addrinfocopy(to, aiv, hints);
+}
+
 static int
 addr_matches_cache(ce, addr, flags)
    const dnsinfo_t *ce; /* cache entry. */
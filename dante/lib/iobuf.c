@@ -53,24 +53,59 @@ static int socks_flushallbuffers(void);
  * Returns -1 if we failed to completely flush at least one buffer.
  */
 
+static int bufmem_reserve(iobuffer_t *iobuf, const whichbuf_t which,
+                          const size_t len);
+/*
+ * Makes sure the memory attached to the "which" buffer of "iobuf" can
+ * hold at least "len" bytes, attaching or replacing it with memory
+ * from the pool as needed.  Any data already in the buffer is kept.
+ *
+ * Returns 0 on success, -1 if we failed to allocate the memory.
+ */
+
+static void bufmem_release(iobuffer_t *iobuf, const whichbuf_t which);
+/*
+ * Returns the memory attached to the "which" buffer of "iobuf", if any,
+ * to the pool.
+ */
+
 #if !SOCKS_CLIENT
+static void iobufv_grow(const int s);
 /*
- * - Each negotiate child client can use one iobuffer for control.
- * - Each request child and io child client can use one iobuffer for
- *   control, src, and st.
+ * Makes sure iobufv has an entry for descriptor "s".
+ * Exits on failure.
  */
-static iobuffer_t
-   iobufv[MAX((SOCKD_NEGOTIATEMAX * 1  /* control */),
-               MAX((SOCKD_IOMAX   * 4  /* control, src, dst1, dst2. */),
-                    (SOCKD_REQUESTMAX   * 3  /* control, src, dst */)))];
-static const size_t  iobufc = ELEMENTS(iobufv);
+#endif /* !SOCKS_CLIENT */
 
-#else /* SOCKS_CLIENT; allocate dynamically on per-need basis. */
+/*
+ * In the server iobufv is indexed by descriptor, so finding the buffer
+ * for a descriptor does not depend on the number of clients the process
+ * handles.  In the client we allocate dynamically on per-need basis.
+ */
 static iobuffer_t *iobufv;
 static size_t     iobufc;
-#endif /* SOCKS_CLIENT */
 
+#if SOCKS_CLIENT
 static size_t lastfreei;  /* last buffer freed, for quick allocation.  */
+#endif /* SOCKS_CLIENT */
+
+/*
+ * Pool of memory for buffers, one freelist per size class.  The freelist
+ * is linked through the first bytes of the unused memory.
+ */
+typedef struct bufmem_t {
+   struct bufmem_t *next;
+} bufmem_t;
+
+static struct {
+   const size_t size;
+   bufmem_t     *freelist;
+   size_t       freec;
+} bufpoolv[] = {
+   { MIN(SOCKD_BUFSIZE_SMALL,  SOCKD_BUFSIZE), NULL, 0 },
+   { MIN(SOCKD_BUFSIZE_MEDIUM, SOCKD_BUFSIZE), NULL, 0 },
+   { SOCKD_BUFSIZE,                            NULL, 0 }
+};
 
 void
 socks_setbuffer(iobuf, mode, size)
@@ -83,10 +118,10 @@ socks_setbuffer(iobuf, mode, size)
    iobuf->info[WRITE_BUF].mode = mode;
 
    if (size == -1)
-      size = sizeof(*iobuf->buf);
+      size = SOCKD_BUFSIZE;
 
    SASSERTX(size > 0);
-   SASSERTX(size <= (ssize_t)sizeof(*iobuf->buf));
+   SASSERTX(size <= SOCKD_BUFSIZE);
 
    iobuf->info[READ_BUF].size  = size;
    iobuf->info[WRITE_BUF].size = size;
@@ -117,7 +152,7 @@ socks_flushbuffer(s, len, sendtoflags)
 {
    const char *function = "socks_flushbuffer()";
 #if HAVE_GSSAPI || !SOCKS_CLIENT
-   unsigned char inputmem[sizeof(iobuffer_t)];
+   unsigned char inputmem[SOCKD_BUFSIZE];
    ssize_t written = 0;
    ssize_t p;
 #endif /* HAVE_GSSAPI || !SOCKS_CLIENT */
@@ -371,6 +406,14 @@ socks_getbuffer(s)
    const int s;
 {
 /*   const char *function = "socks_getbuffer()";  */
+#if !SOCKS_CLIENT
+
+   if (s >= 0 && (size_t)s < iobufc && iobufv[s].allocated) {
+      SASSERTX(iobufv[s].s == s);
+      return &iobufv[s];
+   }
+
+#else /* SOCKS_CLIENT */
    static size_t i;
 
    if (i < iobufc && iobufv[i].s == s && iobufv[i].allocated)
@@ -379,6 +422,7 @@ socks_getbuffer(s)
    for (i = 0; i < iobufc; ++i)
       if (iobufv[i].s == s && iobufv[i].allocated)
          return &iobufv[i];
+#endif /* SOCKS_CLIENT */
 
    return NULL;
 }
@@ -398,7 +442,7 @@ socks_clearbuffer(s, which)
    iobuf->info[which].readalready = 0;
 #endif /* SOCKS_CLIENT */
 
-   bzero(&iobuf->buf[which], sizeof(iobuf->buf[which]));
+   bufmem_release(iobuf, which);
 }
 
 iobuffer_t *
@@ -410,14 +454,19 @@ socks_allocbuffer(s, stype)
 
 #if SOCKS_CLIENT
    sigset_t oset;
+   size_t i;
 #endif /* SOCKS_CLIENT */
    iobuffer_t *freebuffer;
-   size_t i;
 
    slog(LOG_DEBUG, "%s: fd %d, stype = %d", function, s, stype);
 
    SASSERTX(socks_getbuffer(s) == NULL);
 
+#if !SOCKS_CLIENT
+   iobufv_grow(s);
+   freebuffer = &iobufv[s];
+
+#else /* SOCKS_CLIENT */
    /*
     * check if one of the already allocated ones is free.
     */
@@ -430,6 +479,7 @@ socks_allocbuffer(s, stype)
             break;
          }
    }
+#endif /* SOCKS_CLIENT */
 
 #if SOCKS_CLIENT
    /*
@@ -494,8 +544,22 @@ socks_reallocbuffer(old, new)
    slog(LOG_DEBUG, "%s: old %d, new %d, %s",
         function, old, new, iobuf == NULL ? "no iobuf" : "have iobuf");
 
-   if (iobuf != NULL)
-      iobuf->s = new;
+   if (iobuf == NULL)
+      return;
+
+#if !SOCKS_CLIENT
+   iobufv_grow(new);
+   iobuf = &iobufv[old]; /* may have moved. */
+
+   SASSERTX(!iobufv[new].allocated);
+
+   iobufv[new]   = *iobuf;
+   iobufv[new].s = new;
+   bzero(iobuf, sizeof(*iobuf));
+
+#else /* SOCKS_CLIENT */
+   iobuf->s = new;
+#endif /* SOCKS_CLIENT */
 }
 
 void
@@ -503,33 +567,45 @@ socks_freebuffer(s)
    const int s;
 {
    const char *function = "socks_freebuffer()";
+   iobuffer_t *iobuf;
 
    slog(LOG_DEBUG, "%s: fd %d", function, s);
 
+#if !SOCKS_CLIENT
+   if ((iobuf = socks_getbuffer(s)) == NULL)
+      return;
+
+#else /* SOCKS_CLIENT */
    if (lastfreei < iobufc
    && iobufv[lastfreei].s == s && iobufv[lastfreei].allocated)
       ;
    else
       lastfreei = 0;
 
-   for (; lastfreei < iobufc; ++lastfreei) {
-      if (!iobufv[lastfreei].allocated
-      ||  iobufv[lastfreei].s != s)
-         continue;
-
-      if (sockscf.option.debug >= DEBUG_VERBOSE
-      && ( socks_bufferhasbytes(s, READ_BUF)
-        || socks_bufferhasbytes(s, WRITE_BUF)))
-         slog(LOG_DEBUG, "%s: freeing buffer with data (%lu/%lu, %lu/%lu)",
-         function,
-         (unsigned long)socks_bytesinbuffer(s, READ_BUF, 0),
-         (unsigned long)socks_bytesinbuffer(s, READ_BUF, 1),
-         (unsigned long)socks_bytesinbuffer(s, WRITE_BUF, 0),
-         (unsigned long)socks_bytesinbuffer(s, WRITE_BUF, 1));
-
-      iobufv[lastfreei].allocated = 0;
+   for (; lastfreei < iobufc; ++lastfreei)
+      if (iobufv[lastfreei].allocated && iobufv[lastfreei].s == s)
+         break;
+
+   if (lastfreei >= iobufc)
       return;
-   }
+
+   iobuf = &iobufv[lastfreei];
+#endif /* SOCKS_CLIENT */
+
+   if (sockscf.option.debug >= DEBUG_VERBOSE
+   && ( socks_bufferhasbytes(s, READ_BUF)
+     || socks_bufferhasbytes(s, WRITE_BUF)))
+      slog(LOG_DEBUG, "%s: freeing buffer with data (%lu/%lu, %lu/%lu)",
+      function,
+      (unsigned long)socks_bytesinbuffer(s, READ_BUF, 0),
+      (unsigned long)socks_bytesinbuffer(s, READ_BUF, 1),
+      (unsigned long)socks_bytesinbuffer(s, WRITE_BUF, 0),
+      (unsigned long)socks_bytesinbuffer(s, WRITE_BUF, 1));
+
+   bufmem_release(iobuf, READ_BUF);
+   bufmem_release(iobuf, WRITE_BUF);
+
+   iobuf->allocated = 0;
 }
 
 size_t
@@ -561,6 +637,17 @@ socks_addtobuffer(s, which, encoded, data, datalen)
 
    SASSERTX(toadd == datalen);
 
+   if (bufmem_reserve(iobuf,
+                      which,
+                        socks_bytesinbuffer(s, which, 0)
+                      + socks_bytesinbuffer(s, which, 1)
+                      + toadd) != 0) {
+      swarn("%s: could not allocate memory to buffer %lu byte%s for fd %d",
+            function, (unsigned long)toadd, toadd == 1 ? "" : "s", s);
+
+      return 0;
+   }
+
    if (encoded) {
       /*
        * appended to the end of encoded data, after any unencoded data.
@@ -635,7 +722,7 @@ socks_bytesinbuffer(s, which, encoded)
    else
       rc = iobuf->info[which].len;
 
-   SASSERTX(rc <= sizeof(iobuf->buf[which]));
+   SASSERTX(rc <= iobuf->info[which].memsize);
    return rc;
 }
 
@@ -686,7 +773,7 @@ socks_freeinbuffer(s, which)
       slog(LOG_DEBUG, "%s: fd %d, which %d, free: %lu",
            function, s, which, (unsigned long)rc);
 
-   SASSERTX(rc <= sizeof(iobuf->buf[which]));
+   SASSERTX(rc <= SOCKD_BUFSIZE);
 
    return rc;
 }
@@ -756,6 +843,9 @@ socks_getfrombuffer(s, flags, which, encoded, data, datalen)
       }
    }
 
+   if (iobuf->info[which].len == 0 && iobuf->info[which].enclen == 0)
+      bufmem_release(iobuf, which);
+
    return toget;
 }
 
@@ -773,3 +863,117 @@ socks_flushallbuffers(void)
 
    return rc;
 }
+
+static int
+bufmem_reserve(iobuf, which, len)
+   iobuffer_t *iobuf;
+   const whichbuf_t which;
+   const size_t len;
+{
+   const char *function = "bufmem_reserve()";
+   const size_t inbuf = iobuf->info[which].len + iobuf->info[which].enclen;
+   char *mem;
+   size_t i;
+
+   SASSERTX(len <= SOCKD_BUFSIZE);
+
+   if (len <= iobuf->info[which].memsize)
+      return 0;
+
+   for (i = 0; i < ELEMENTS(bufpoolv); ++i)
+      if (bufpoolv[i].size >= len)
+         break;
+
+   SASSERTX(i < ELEMENTS(bufpoolv));
+
+   if (bufpoolv[i].freelist != NULL) {
+      mem                  = (char *)bufpoolv[i].freelist;
+      bufpoolv[i].freelist = bufpoolv[i].freelist->next;
+      --bufpoolv[i].freec;
+   }
+   else if ((mem = malloc(bufpoolv[i].size)) == NULL) {
+      swarn("%s: failed to allocate %lu bytes of memory for buffer",
+            function, (unsigned long)bufpoolv[i].size);
+
+      return -1;
+   }
+
+   if (sockscf.option.debug >= DEBUG_VERBOSE)
+      slog(LOG_DEBUG,
+           "%s: fd %d, %s buffer: %lu byte%s needed, replacing %lu bytes "
+           "of memory with %lu",
+           function,
+           iobuf->s,
+           which == READ_BUF ? "read" : "write",
+           (unsigned long)len,
+           len == 1 ? "" : "s",
+           (unsigned long)iobuf->info[which].memsize,
+           (unsigned long)bufpoolv[i].size);
+
+   if (inbuf > 0)
+      memcpy(mem, iobuf->buf[which], inbuf);
+
+   bufmem_release(iobuf, which);
+
+   iobuf->buf[which]          = mem;
+   iobuf->info[which].memsize = bufpoolv[i].size;
+
+   return 0;
+}
+
+static void
+bufmem_release(iobuf, which)
+   iobuffer_t *iobuf;
+   const whichbuf_t which;
+{
+   size_t i;
+
+   if (iobuf->buf[which] == NULL)
+      return;
+
+   for (i = 0; i < ELEMENTS(bufpoolv); ++i)
+      if (bufpoolv[i].size == iobuf->info[which].memsize)
+         break;
+
+   SASSERTX(i < ELEMENTS(bufpoolv));
+
+   if (bufpoolv[i].freec < SOCKD_BUFPOOLMAX) {
+      bufmem_t *mem = (bufmem_t *)iobuf->buf[which];
+
+      mem->next            = bufpoolv[i].freelist;
+      bufpoolv[i].freelist = mem;
+      ++bufpoolv[i].freec;
+   }
+   else
+      free(iobuf->buf[which]);
+
+   iobuf->buf[which]          = NULL;
+   iobuf->info[which].memsize = 0;
+}
+
+#if !SOCKS_CLIENT
+static void
+iobufv_grow(s)
+   const int s;
+{
+   const char *function = "iobufv_grow()";
+   iobuffer_t *p;
+   size_t newc;
+
+   SASSERTX(s >= 0);
+
+   if ((size_t)s < iobufc)
+      return;
+
+   newc = MAX((size_t)s + 1, iobufc * 2);
+
+   if ((p = realloc(iobufv, sizeof(*iobufv) * newc)) == NULL)
+      serr("%s: failed to allocate memory for %lu iobuffers",
+           function, (unsigned long)newc);
+
+   bzero(&p[iobufc], sizeof(*p) * (newc - iobufc));
+
+   iobufv = p;
+   iobufc = newc;
+}
+#endif /* !SOCKS_CLIENT */
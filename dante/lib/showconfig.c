@@ -166,6 +166,12 @@ showconfig(sockscf)
                             NULL,
                             0));
 
+   slog(LOG_DEBUG, "negotiate children accept clients themselves: %s",
+        sockscf->child.reuseport ? "yes" : "no");
+
+   slog(LOG_DEBUG, "i/o children handle all stages themselves: %s",
+        sockscf->child.allinone ? "yes" : "no");
+
 #if HAVE_SCHED_SETSCHEDULER
    bufused = 0;
    if (sockscf->cpu.mother.scheduling_isset)
@@ -259,6 +265,9 @@ showconfig(sockscf)
                           bufused ? ", " : "",
                           childtype2string(PROC_IO));
 
+      if (sockscf->cpu.io.percpu)
+         bufused += snprintf(&buf[bufused], sizeof(buf) - bufused, "percpu ");
+
       for (i = 0; i < setsize; ++i)
          if (cpu_isset(i, &sockscf->cpu.io.mask))
             bufused += snprintf(&buf[bufused], sizeof(buf) - bufused,
@@ -482,6 +491,9 @@ socks_showroute(route)
    for (i = 0; i < route->socketoptionc; ++i)
       slog(LOG_DEBUG, "socketoption %s", route->socketoptionv[i].info->name);
 
+   slog(LOG_DEBUG, "weight: %lu%s",
+        (unsigned long)route->weight, route->weight_isset ? "" : " (default)");
+
    slog(LOG_DEBUG, "route state: autoadded: %s, failed: %lu, badtime: %ld",
                    route->state.autoadded ? "yes" : "no",
                    (long)route->state.failed,
@@ -35,7 +35,7 @@ AC_CHECK_HEADERS(fcntl.h limits.h malloc.h paths.h strings.h syslog.h)
 AC_CHECK_HEADERS(unistd.h crypt.h stddef.h sys/file.h sys/ioctl.h sys/time.h)
 AC_CHECK_HEADERS(shadow.h ifaddrs.h sys/sem.h netinet/in.h rpc/rpc.h)
 AC_CHECK_HEADERS(sys/ipc.h arpa/nameser.h net/if_dl.h execinfo.h sys/pstat.h)
-AC_CHECK_HEADERS(sys/shm.h valgrind/valgrind.h netinet/tcp_fsm.h)
+AC_CHECK_HEADERS(sys/shm.h valgrind/valgrind.h netinet/tcp_fsm.h sys/epoll.h)
 
 #some header dependencies for netinet/ip.h, use compilation test
 AC_MSG_CHECKING([for netinet/ip.h])
@@ -660,6 +660,9 @@ AC_SEARCH_LIBS(getsockopt, socket)
 
 AC_CHECK_FUNCS(getprpwnam getspnam getpwnam_shadow bindresvport)
 AC_CHECK_FUNCS(getpass)
+AC_CHECK_FUNCS(splice)
+AC_CHECK_FUNCS(recvmmsg)
+AC_CHECK_FUNCS(arc4random_buf getrandom)
 
 AC_MSG_CHECKING([for system V getpwnam])
 unset getpwnam_alt
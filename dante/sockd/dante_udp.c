@@ -126,14 +126,13 @@ io_udp_client2target(control, client, twotargets, cauth, state,
    recvflags.type = SOCK_DGRAM;
 
    len = sizeof(from);
-   if ((r = socks_recvfrom(client->s,
-                           buf,
-                           sizeof(buf),
-                           0,
-                           &from,
-                           &len,
-                           &recvflags,
-                           &client->auth)) == -1) {
+   if ((r = udp_recvfrom(client->s,
+                         buf,
+                         sizeof(buf),
+                         &from,
+                         &len,
+                         &recvflags,
+                         &client->auth)) == -1) {
       if (ERRNOISPREVIOUSPACKET(errno)) {
          /*
           * error is from a previous packet sent by us out on this socket,
@@ -911,15 +910,14 @@ io_udp_client2target(control, client, twotargets, cauth, state,
       }
 
       sendtoflags.side = EXTERNALIF;
-      w = socks_sendto(target->s,
-                       payload,
-                       payloadlen,
-                       0,
-                       target->isconnected ?  NULL : &target->raddr,
-                       target->isconnected ?
-                       (socklen_t)0 : (socklen_t)sizeof(target->raddr),
-                       &sendtoflags,
-                       NULL);
+      w = udp_sendto(target->s,
+                     payload,
+                     payloadlen,
+                     target->isconnected ?  NULL : &target->raddr,
+                     target->isconnected ?
+                     (socklen_t)0 : (socklen_t)sizeof(target->raddr),
+                     &sendtoflags,
+                     NULL);
 
       if (w >= 0) {
          iostatus = io_packet_sent(payloadlen,
@@ -1043,14 +1041,13 @@ io_udp_target2client(control, client, twotargets, state,
    recvflags.type = SOCK_DGRAM;
 
    len = sizeof(from);
-   if ((r = socks_recvfrom(twotargets->s,
-                           buf,
-                           sizeof(buf),
-                           0,
-                           &from,
-                           &len,
-                           &recvflags,
-                           &twotargets->auth)) == -1) {
+   if ((r = udp_recvfrom(twotargets->s,
+                         buf,
+                         sizeof(buf),
+                         &from,
+                         &len,
+                         &recvflags,
+                         &twotargets->auth)) == -1) {
       if (ERRNOISPREVIOUSPACKET(errno)) {
          /*
           * error is from the target of an earlier packet from client,
@@ -1314,15 +1311,14 @@ io_udp_target2client(control, client, twotargets, state,
 
    headerlen = payloadlen - originallen;
 
-   w = socks_sendto(client->s,
-                    payload,
-                    payloadlen,
-                    0,
-                    client->state.isconnected ?  NULL : &client->raddr,
-                    client->state.isconnected ?
-                        (socklen_t)0 : (socklen_t)sizeof(client->raddr),
-                    &sendtoflags,
-                    &client->auth);
+   w = udp_sendto(client->s,
+                  payload,
+                  payloadlen,
+                  client->state.isconnected ?  NULL : &client->raddr,
+                  client->state.isconnected ?
+                      (socklen_t)0 : (socklen_t)sizeof(client->raddr),
+                  &sendtoflags,
+                  &client->auth);
 
    if (w >= 0) {
       iostatus = io_packet_sent(payloadlen,
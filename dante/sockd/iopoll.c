@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2017
+ *      Inferno Nettverk A/S, Norway.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. The above copyright notice, this list of conditions and the following
+ *    disclaimer must appear in all copies of the software, derivative works
+ *    or modified versions, and any portions thereof, aswell as in all
+ *    supporting documentation.
+ * 2. All advertising materials mentioning features or use of this software
+ *    must display the following acknowledgement:
+ *      This product includes software developed by
+ *      Inferno Nettverk A/S, Norway.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Inferno Nettverk A/S requests users of this software to return to
+ *
+ *  Software Distribution Coordinator  or  sdc@inet.no
+ *  Inferno Nettverk A/S
+ *  Oslo Research Park
+ *  Gaustadallen 21
+ *  NO-0349 Oslo
+ *  Norway
+ *
+ * any improvements or extensions that they make and grant Inferno Nettverk A/S
+ * the rights to redistribute these changes.
+ *
+ */
+
+#include "common.h"
+
+/*
+ * epoll(7)-based event notification for the i/o processes.  Unlike
+ * select(2), the set of descriptors we are interested in is kept by the
+ * kernel, and only changes to it need to be passed on.  We keep a copy
+ * of what we have told the kernel so that callers can simply state what
+ * they want for a descriptor each time, without it costing a system call
+ * unless something changed.
+ *
+ * We use level-triggered notification, so the semantics are the same
+ * as with select(2); a descriptor that is not drained will be reported
+ * as ready again the next time.
+ */
+
+static const char rcsid[] =
+"$Id$";
+
+#if HAVE_IOPOLL
+
+typedef struct {
+   int  events;   /* IOPOLL_* events currently registered with the kernel. */
+   void *data;    /* data to return with events on this fd.               */
+} iopollfd_t;
+
+static uint32_t iopoll2epoll(const int events);
+/*
+ * Returns the epoll(7) events corresponding to the IOPOLL_* "events".
+ */
+
+static int epoll2iopoll(const uint32_t revents, const int events);
+/*
+ * Returns the IOPOLL_* events corresponding to the epoll(7) events
+ * "revents", reported for a fd registered for the IOPOLL_* events "events".
+ */
+
+static int                pollfd = -1;  /* the epoll(7) descriptor.       */
+
+static iopollfd_t         *fdv;         /* indexed by fd.                 */
+static size_t             fdc;
+
+static struct epoll_event *epollv;      /* for epoll_pwait(2).            */
+static size_t             epollc;
+
+int
+iopoll_init(void)
+{
+   const char *function = "iopoll_init()";
+
+   if (pollfd != -1) {
+      close(pollfd);
+      pollfd = -1;
+   }
+
+   free(fdv);
+   fdv = NULL;
+   fdc = 0;
+
+   if ((pollfd = epoll_create1(EPOLL_CLOEXEC)) == -1) {
+      swarn("%s: epoll_create1() failed.  Will use select(2) instead",
+            function);
+
+      return -1;
+   }
+
+   slog(LOG_DEBUG, "%s: using epoll(7) via fd %d", function, pollfd);
+   return 0;
+}
+
+int
+iopoll_isactive(void)
+{
+
+   return pollfd != -1;
+}
+
+int
+iopoll_set(fd, events, data)
+   const int fd;
+   const int events;
+   void *data;
+{
+   const char *function = "iopoll_set()";
+   struct epoll_event event;
+   int op;
+
+   SASSERTX(pollfd != -1);
+   SASSERTX(fd >= 0);
+
+   if ((size_t)fd >= fdc) {
+      iopollfd_t *newfdv;
+      size_t newfdc;
+
+      if (events == 0)
+         return 0; /* can not be registered. */
+
+      newfdc = MAX((size_t)fd + 1, fdc * 2);
+
+      if ((newfdv = realloc(fdv, sizeof(*fdv) * newfdc)) == NULL) {
+         swarn("%s: failed to allocate memory for %lu descriptors",
+               function, (unsigned long)newfdc);
+
+         return -1;
+      }
+
+      bzero(&newfdv[fdc], sizeof(*newfdv) * (newfdc - fdc));
+
+      fdv = newfdv;
+      fdc = newfdc;
+   }
+
+   fdv[fd].data = data;
+
+   if (fdv[fd].events == events)
+      return 0;
+
+   if (fdv[fd].events == 0)
+      op = EPOLL_CTL_ADD;
+   else if (events == 0)
+      op = EPOLL_CTL_DEL;
+   else
+      op = EPOLL_CTL_MOD;
+
+   bzero(&event, sizeof(event));
+   event.events  = iopoll2epoll(events);
+   event.data.fd = fd;
+
+   if (epoll_ctl(pollfd, op, fd, &event) != 0) {
+      /*
+       * The kernel removes a descriptor by itself once the last reference
+       * to it is closed, so what we have recorded may be stale if the
+       * descriptor was closed somewhere we did not get to remove it first.
+       */
+      if (op == EPOLL_CTL_ADD && errno == EEXIST)
+         op = EPOLL_CTL_MOD;
+      else if (op == EPOLL_CTL_MOD && errno == ENOENT)
+         op = EPOLL_CTL_ADD;
+      else if (op == EPOLL_CTL_DEL && (errno == ENOENT || errno == EBADF))
+         op = -1;
+      else
+         op = -2;
+
+      if (op == -2
+      || (op != -1 && epoll_ctl(pollfd, op, fd, &event) != 0)) {
+         swarn("%s: epoll_ctl() on fd %d for events 0x%x failed",
+               function, fd, events);
+
+         return -1;
+      }
+   }
+
+   slog(LOG_DEBUG, "%s: events on fd %d changed from 0x%x to 0x%x",
+        function, fd, fdv[fd].events, events);
+
+   fdv[fd].events = events;
+
+   if (events == 0)
+      fdv[fd].data = NULL;
+
+   return 0;
+}
+
+int
+iopoll_wait(eventv, eventc, timeout)
+   iopollevent_t *eventv;
+   const size_t eventc;
+   struct timeval *timeout;
+{
+   const char *function = "iopoll_wait()";
+   sigset_t fullmask, oldmask;
+   int i, rc, errno_s, timeoutms;
+
+   SASSERTX(pollfd != -1);
+   SASSERTX(eventc > 0);
+
+   if (epollc < eventc) {
+      struct epoll_event *newepollv;
+
+      if ((newepollv = realloc(epollv, sizeof(*epollv) * eventc)) == NULL) {
+         swarn("%s: failed to allocate memory for %lu events",
+               function, (unsigned long)eventc);
+
+         return -1;
+      }
+
+      epollv = newepollv;
+      epollc = eventc;
+   }
+
+   if (timeout == NULL)
+      timeoutms = -1;
+   else {
+      if (timeout->tv_sec < 0 || timeout->tv_usec < 0) {
+         SWARNX(timeout->tv_sec);
+         SWARNX(timeout->tv_usec);
+
+         timeout->tv_sec  = 0;
+         timeout->tv_usec = 0;
+      }
+
+      if (timeout->tv_sec >= INT_MAX / 1000 - 1)
+         timeoutms = INT_MAX;
+      else /* round up so we do not busyloop on sub-millisecond timeouts. */
+         timeoutms = (int)(  timeout->tv_sec * 1000
+                           + (timeout->tv_usec + 999) / 1000);
+   }
+
+   /*
+    * Same as in selectn(); block signals until we are in epoll_pwait(2),
+    * so that any signal arriving between our check for pending signals
+    * and the wait will interrupt the wait.
+    */
+   (void)sigfillset(&fullmask);
+   if (sigprocmask(SIG_BLOCK, &fullmask, &oldmask) != 0)
+      SERR(errno);
+
+   if (sockd_handledsignals() != 0) {
+      if (sigprocmask(SIG_SETMASK, &oldmask, NULL) != 0)
+         SERR(errno);
+
+      errno = EINTR;
+      return -1;
+   }
+
+   errno = 0;
+   rc    = epoll_pwait(pollfd, epollv, (int)eventc, timeoutms, &oldmask);
+
+   if (rc == -1 && errno == EINTR)
+      (void)sockd_handledsignals();
+
+   errno_s = errno;
+
+   if (sigprocmask(SIG_SETMASK, &oldmask, NULL) != 0)
+      SERR(errno);
+
+   errno = errno_s;
+
+   if (rc == -1)
+      return rc;
+
+   for (i = 0; i < rc; ++i) {
+      const int fd = epollv[i].data.fd;
+
+      SASSERTX(fd >= 0 && (size_t)fd < fdc);
+
+      eventv[i].fd     = fd;
+      eventv[i].events = epoll2iopoll(epollv[i].events, fdv[fd].events);
+      eventv[i].data   = fdv[fd].data;
+   }
+
+   return rc;
+}
+
+static uint32_t
+iopoll2epoll(events)
+   const int events;
+{
+   uint32_t revents = 0;
+
+   if (events & IOPOLL_READ)
+      revents |= EPOLLIN;
+
+   if (events & IOPOLL_WRITE)
+      revents |= EPOLLOUT;
+
+   if (events & IOPOLL_EXCEPTION)
+      revents |= EPOLLPRI;
+
+   return revents;
+}
+
+static int
+epoll2iopoll(revents, events)
+   const uint32_t revents;
+   const int events;
+{
+   int rc = 0;
+
+   if (revents & EPOLLIN)
+      rc |= IOPOLL_READ;
+
+   if (revents & EPOLLOUT)
+      rc |= IOPOLL_WRITE;
+
+   if (revents & EPOLLPRI)
+      rc |= IOPOLL_EXCEPTION;
+
+   /*
+    * As with select(2), errors are reported as the descriptor being
+    * ready for whatever we were waiting for, and the error is then
+    * picked up by the following read or write.
+    */
+   if (revents & (EPOLLERR | EPOLLHUP))
+      rc |= events & (IOPOLL_READ | IOPOLL_WRITE);
+
+   return rc;
+}
+
+#endif /* HAVE_IOPOLL */
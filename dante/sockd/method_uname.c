@@ -249,7 +249,6 @@ recv_passwd(s, request, state)
 {
 /*   const char *function = "recv_passwd()"; */
    const size_t plen = (size_t)*request->auth->mdata.uname.password;
-   sendto_info_t sendtoflags;
    unsigned char response[1 /* version. */ + 1 /* status.   */];
    int isunique;
 
@@ -359,23 +358,16 @@ recv_passwd(s, request, state)
          response[UNAME_STATUS] = (unsigned char)UNAME_STATUS_ISNOK;
    }
 
-   bzero(&sendtoflags, sizeof(sendtoflags));
-   sendtoflags.side = INTERNALIF;
-
-   if (socks_sendton(s,
-                     response,
-                     sizeof(response),
-                     0,
-                     0,
-                     NULL,
-                     0,
-                     &sendtoflags,
-                     request->auth) != sizeof(response))
+   if (send_negotiatereply(s, response, sizeof(response), request, state) != 0)
       return NEGOTIATE_ERROR;
 
    if (response[UNAME_STATUS] == (unsigned char)UNAME_STATUS_ISOK) {
       state->rcurrent = recv_sockspacket;
 
+      /* the request may already be here if the client pipelines. */
+      if (negotiate_ispipelined(s, request))
+         return state->rcurrent(s, request, state);
+
       /* presumably client is awaiting our response. */
       return NEGOTIATE_CONTINUE;
    }
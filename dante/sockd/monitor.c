@@ -116,6 +116,10 @@ alarm_data_toggle(const monitor_t *monitor, const size_t alarmside,
 static void checkmonitors(void);
 /*
  * Checks all monitors, turns on/off alarms, resets, etc.
+ *
+ * The data counters are added to the monitors by the i/o processes
+ * in batches, so they may be up to SOCKD_MONITORSYNC_MS milliseconds
+ * behind.
  */
 
 static struct timeval *
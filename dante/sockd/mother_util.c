@@ -67,6 +67,15 @@ static void unexpecteddeath(void);
  * if appropriate, or the enable creation of further children.
  */
 
+static void
+childfdsneeded(rlim_t *minfd_neg, rlim_t *minfd_req, rlim_t *minfd_io);
+/*
+ * Fills in the minimum number of file descriptors a negotiate, request,
+ * and i/o child needs with the current child.maxclients.* values.
+ */
+
+static size_t fdreserved; /* fds each process uses besides the clients. */
+
 void
 mother_preconfigload(void)
 {
@@ -94,7 +103,6 @@ mother_envsetup(argc, argv)
       , SIGSYS
 #endif /* SIGSYS */
    };
-   const size_t pipetomotherfds = 2; /* fds needed for pipe to mother. */
    const size_t exitsignalc = ELEMENTS(exitsignalv);
    const int ignoresignalv[] = {
       SIGPIPE
@@ -106,7 +114,7 @@ mother_envsetup(argc, argv)
    struct rlimit maxproc;
 #endif /* RLIMIT_NPROC */
    rlim_t maxopenfd, minfd_neg, minfd_req, minfd_io, minfd;
-   size_t i, fdreserved;
+   size_t i;
 
    for (fdreserved = 0;
    fdreserved < ELEMENTS(sockscf.state.reservedfdv);
@@ -156,22 +164,8 @@ mother_envsetup(argc, argv)
 
    /*
     * Check system limits against what we need.
-    * Enough descriptors for each child process? + 2 for the pipes from
-    * the child to mother.
     */
-
-   minfd_neg = (SOCKD_NEGOTIATEMAX * 1)          + pipetomotherfds + fdreserved;
-
-   minfd_req = (SOCKD_REQUESTMAX   * FDPASS_MAX) + pipetomotherfds + fdreserved;
-
-   minfd_io  = (SOCKD_IOMAX        * FDPASS_MAX) + pipetomotherfds + fdreserved;
-
-   /* i/o process stays attached to bw and monitor shmem all the time. */
-   minfd_io  += SOCKD_IOMAX * (1 + 1);
-
-#if BAREFOOTD
-   minfd_io += MIN(10, MIN_UDPCLIENTS);
-#endif
+   childfdsneeded(&minfd_neg, &minfd_req, &minfd_io);
 
    slog(LOG_DEBUG,
         "%s: minfd_negotiate: %lu, minfd_request: %lu, minfd_io: %lu",
@@ -220,24 +214,22 @@ mother_envsetup(argc, argv)
       sockscf.state.maxopenfiles = getmaxofiles(hardlimit);
 
       if (sockscf.state.maxopenfiles      < minfd_neg)
-         problem = "SOCKD_NEGOTIATEMAX";
+         problem = "child.maxclients.negotiate value in sockd.conf";
       else if (sockscf.state.maxopenfiles < minfd_req)
-         problem = "SOCKD_REQUESTMAX";
+         problem = "child.maxclients.request value in sockd.conf";
       else if (sockscf.state.maxopenfiles < minfd_io)
-         problem = "SOCKD_IOMAX";
+         problem = "child.maxclients.io value in sockd.conf";
       else
          SERRX(sockscf.state.maxopenfiles);
 
       serrx("%s: failed to increase the max number of open file descriptors "
             "for ourselves via setrlimit(RLIMIT_OFILE) to %lu: %s.  "
             "Increase the kernel/shell's max open files limit, or reduce "
-            "the %s value in %s's include/config.h, or we will be unable to "
-            "start up",
+            "the %s, or we will be unable to start up",
             function,
             (unsigned long)rlimit.rlim_max,
             strerror(errno),
-            problem,
-            PRODUCT);
+            problem);
    }
 
 #ifdef RLIMIT_NPROC
@@ -386,9 +378,9 @@ mother_getlimitinfo(void)
       return "no applicable environment resource limits configured";
 
    proc_used   = sockscf.option.serverc
-               + childcheck(-PROC_NEGOTIATE) / SOCKD_NEGOTIATEMAX
-               + childcheck(-PROC_REQUEST)   / SOCKD_REQUESTMAX
-               + childcheck(-PROC_IO)        / SOCKD_IOMAX;
+               + childcheck(-PROC_NEGOTIATE) / maxfreeslots(PROC_NEGOTIATE)
+               + childcheck(-PROC_REQUEST)   / maxfreeslots(PROC_REQUEST)
+               + childcheck(-PROC_IO)        / maxfreeslots(PROC_IO);
    proc_free   = maxproc.rlim_cur - proc_used;
 
    if (maxproc.rlim_cur == RLIM_INFINITY)
@@ -412,31 +404,34 @@ mother_getlimitinfo(void)
 
    /*
     * Process-based limit, disregarding any other limits.
-    * Each process can handle SOCKD_{NEGOTIATE,REQUEST,IO}MAX clients.
+    * Each process can handle maxfreeslots(<process type>) clients.
     * We can create a max number of proc_free additional processes, so
     * the number of additional clients we can handle is the number
     * of additional clients multiplied by the number of clients each
     * process can handle.
     */
-   negc_proc = proc_free * SOCKD_NEGOTIATEMAX;
-   reqc_proc = proc_free * SOCKD_REQUESTMAX;
-   ioc_proc  = proc_free * SOCKD_IOMAX;
+   negc_proc = proc_free * maxfreeslots(PROC_NEGOTIATE);
+   reqc_proc = proc_free * maxfreeslots(PROC_REQUEST);
+   ioc_proc  = proc_free * maxfreeslots(PROC_IO);
 
    /*
     * FD-based limit, disregarding any other limits.
     * With the fds we have, we can create a given number of additional
     * processes (procs).
     * Each process needs fds_per_proc, and an additional
-    * SOCKD_{NEGOTIATE,REQUEST,IO}MAX * <number of fds per client in this
+    * maxfreeslots(<process type>) * <number of fds per client in this
     * phase> fds to handle the max number of clients, meaning we can handle
     * the following number of additional clients:
     */
    procs   = fds_free / fds_per_proc;
-   negc_fd = MIN(((fds_free - fds_per_proc) / 1), SOCKD_NEGOTIATEMAX)
+   negc_fd = MIN(((fds_free - fds_per_proc) / 1),
+                 maxfreeslots(PROC_NEGOTIATE))
            * procs;
-   reqc_fd = MIN(((fds_free - fds_per_proc) / FDPASS_MAX), SOCKD_REQUESTMAX)
+   reqc_fd = MIN(((fds_free - fds_per_proc) / FDPASS_MAX),
+                 maxfreeslots(PROC_REQUEST))
            * procs;
-   ioc_fd  = MIN(((fds_free - fds_per_proc) / FDPASS_MAX), SOCKD_IOMAX)
+   ioc_fd  = MIN(((fds_free - fds_per_proc) / FDPASS_MAX),
+                 maxfreeslots(PROC_IO))
            * procs;
 
    /*
@@ -525,6 +520,40 @@ log_rusage(childtype, pid, rusage)
 }
 
 
+static void
+childfdsneeded(minfd_neg, minfd_req, minfd_io)
+   rlim_t *minfd_neg;
+   rlim_t *minfd_req;
+   rlim_t *minfd_io;
+{
+   const size_t pipetomotherfds = 2; /* fds needed for pipe to mother. */
+
+   /*
+    * Enough descriptors for each child process? + 2 for the pipes from
+    * the child to mother.
+    */
+
+   *minfd_neg = (sockscf.child.maxclients.negotiate * 1)
+              + pipetomotherfds + fdreserved;
+
+   *minfd_req = (sockscf.child.maxclients.request * FDPASS_MAX)
+              + pipetomotherfds + fdreserved;
+
+   *minfd_io  = (sockscf.child.maxclients.io * FDPASS_MAX)
+              + pipetomotherfds + fdreserved;
+
+   /* i/o process stays attached to bw and monitor shmem all the time. */
+   *minfd_io  += sockscf.child.maxclients.io * (1 + 1);
+
+#if HAVE_SPLICE_RELAY
+   /* pipe used by the i/o process when splicing data. */
+   *minfd_io  += 2;
+#endif /* HAVE_SPLICE_RELAY */
+
+#if BAREFOOTD
+   *minfd_io += MIN(10, MIN_UDPCLIENTS);
+#endif
+}
 
 static void
 unexpecteddeath(void)
@@ -684,21 +713,21 @@ siginfo(sig, si, sc)
          (unsigned long)clients);
 
    slog(LOG_INFO, "negotiators (%lu): a: %lu, h: %lu, c: %lu, f: %lu",
-        max_negc / SOCKD_NEGOTIATEMAX,
+        max_negc / maxfreeslots(PROC_NEGOTIATE),
         (unsigned long)sockscf.stat.negotiate.sendt,
         (unsigned long)sockscf.stat.negotiate.received,
         max_negc - free_negc,
         free_negc);
 
    slog(LOG_INFO, "requesters (%lu): a: %lu, h: %lu, c: %lu, f: %lu",
-        max_reqc / SOCKD_REQUESTMAX,
+        max_reqc / maxfreeslots(PROC_REQUEST),
         (unsigned long)sockscf.stat.request.sendt,
         (unsigned long)sockscf.stat.request.received,
         max_reqc - free_reqc,
         free_reqc);
 
    slog(LOG_INFO, "iorelayers (%lu): a: %lu, h: %lu, c: %lu, f: %lu",
-        max_ioc / SOCKD_IOMAX,
+        max_ioc / maxfreeslots(PROC_IO),
         (unsigned long)sockscf.stat.io.sendt,
         (unsigned long)sockscf.stat.io.received,
         max_ioc - free_ioc,
@@ -751,7 +780,9 @@ sighup(sig, si, sc)
    const int errno_s = errno;
    struct config *newshmemconfig;
    internaladdress_t oldinternal;
-   size_t i, pointersize;
+   rlim_t minfd_neg, minfd_req, minfd_io;
+   size_t i, pointersize, oldmaxclients_neg, oldmaxclients_req,
+          oldmaxclients_io;
    int rc;
 
    SIGNAL_PROLOGUE(sig, si, errno_s);
@@ -808,6 +839,10 @@ sighup(sig, si, sc)
    for (i = 0; i < oldinternal.addrc; ++i)
       oldinternal.addrv[i] = sockscf.internal.addrv[i];
 
+   oldmaxclients_neg = sockscf.child.maxclients.negotiate;
+   oldmaxclients_req = sockscf.child.maxclients.request;
+   oldmaxclients_io  = sockscf.child.maxclients.io;
+
    resetconfig(&sockscf, 0);
    genericinit();
    checkconfig();
@@ -966,6 +1001,67 @@ sighup(sig, si, sc)
 
    free(oldinternal.addrv);
 
+   if (sockscf.child.allinone != sockscf.state.allinone)
+      swarnx("%s: child.allinone can not be changed while running.  "
+             "Keeping the old value (%s) until restart",
+             function, sockscf.state.allinone ? "yes" : "no");
+   else if (!sockscf.state.allinone
+   &&       sockscf.child.reuseport != sockscf.state.reuseport)
+      swarnx("%s: child.reuseport can not be changed while running.  "
+             "Keeping the old value (%s) until restart",
+             function, sockscf.state.reuseport ? "yes" : "no");
+
+   /*
+    * The limit on open files was set at startup, and the fd_sets of
+    * running processes are sized by it, so children created after this
+    * can not be given more clients than it allows.
+    */
+   childfdsneeded(&minfd_neg, &minfd_req, &minfd_io);
+
+   if (minfd_neg > sockscf.state.maxopenfiles) {
+      swarnx("%s: child.maxclients.negotiate %lu needs %lu file descriptors, "
+             "but the limit set at startup is %lu.  Keeping the old value "
+             "(%lu) until restart",
+             function,
+             (unsigned long)sockscf.child.maxclients.negotiate,
+             (unsigned long)minfd_neg,
+             (unsigned long)sockscf.state.maxopenfiles,
+             (unsigned long)oldmaxclients_neg);
+
+      sockscf.child.maxclients.negotiate = oldmaxclients_neg;
+   }
+
+   if (minfd_req > sockscf.state.maxopenfiles) {
+      swarnx("%s: child.maxclients.request %lu needs %lu file descriptors, "
+             "but the limit set at startup is %lu.  Keeping the old value "
+             "(%lu) until restart",
+             function,
+             (unsigned long)sockscf.child.maxclients.request,
+             (unsigned long)minfd_req,
+             (unsigned long)sockscf.state.maxopenfiles,
+             (unsigned long)oldmaxclients_req);
+
+      sockscf.child.maxclients.request = oldmaxclients_req;
+   }
+
+   if (minfd_io > sockscf.state.maxopenfiles) {
+      swarnx("%s: child.maxclients.io %lu needs %lu file descriptors, "
+             "but the limit set at startup is %lu.  Keeping the old value "
+             "(%lu) until restart",
+             function,
+             (unsigned long)sockscf.child.maxclients.io,
+             (unsigned long)minfd_io,
+             (unsigned long)sockscf.state.maxopenfiles,
+             (unsigned long)oldmaxclients_io);
+
+      sockscf.child.maxclients.io = oldmaxclients_io;
+   }
+
+   if (sockscf.hostcache.entries != sockscf.state.hostcacheentries)
+      swarnx("%s: hostcache.entries can not be changed while running.  "
+             "Keeping the old value (%lu) until restart",
+             function, (unsigned long)sockscf.state.hostcacheentries);
+
    /* may have added addresses in new config, rebind if necessary. */
    if (bindinternal(SOCKS_TCP) != 0)
       serr("%s: failed to bind internal addresses", function);
@@ -0,0 +1,1496 @@
+/*
+ * Copyright (c) 2017
+ *      Inferno Nettverk A/S, Norway.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. The above copyright notice, this list of conditions and the following
+ *    disclaimer must appear in all copies of the software, derivative works
+ *    or modified versions, and any portions thereof, aswell as in all
+ *    supporting documentation.
+ * 2. All advertising materials mentioning features or use of this software
+ *    must display the following acknowledgement:
+ *      This product includes software developed by
+ *      Inferno Nettverk A/S, Norway.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Inferno Nettverk A/S requests users of this software to return to
+ *
+ *  Software Distribution Coordinator  or  sdc@inet.no
+ *  Inferno Nettverk A/S
+ *  Oslo Research Park
+ *  Gaustadallen 21
+ *  NO-0349 Oslo
+ *  Norway
+ *
+ * any improvements or extensions that they make and grant Inferno Nettverk A/S
+ * the rights to redistribute these changes.
+ *
+ */
+
+#include "common.h"
+
+/*
+ * A small asynchronous stub resolver, used by the request children to
+ * resolve the hostnames given in requests without blocking the process
+ * in getaddrinfo(3) while waiting for the nameserver.
+ *
+ * For each hostname we send a question for the A records and one for
+ * the AAAA records to the nameservers listed in SOCKD_RESOLVCONF.  The
+ * questions are sent over udp, or over tcp if the answer is truncated or
+ * we are configured to resolve over tcp.  Each question sent over udp
+ * gets its own socket, connected to the nameserver, so that both the
+ * source port and the id of the query are random and only answers from
+ * the nameserver asked reach us.  That also lets us see when the
+ * nameserver is not listening, and go on to the next one at once.  A
+ * question not answered within the timeout is resent to the next
+ * nameserver, like the system resolver does.  When both questions have
+ * been answered, or we give up, the result is added to the hostcache,
+ * where cgetaddrinfo() will find it when the request is later processed
+ * as usual.
+ *
+ * Hostnames the system resolver would not simply look up in the DNS,
+ * i.e. names in SOCKD_HOSTSFILE and names the search list applies to,
+ * are left to the system resolver.
+ */
+
+static const char rcsid[] =
+"$Id$";
+
+#define DNS_PORT              (53)
+#define DNS_HEADERLEN         (12)
+#define DNS_MAXNAMELEN        (255)   /* encoded, including length octets. */
+#define DNS_MAXLABELLEN       (63)
+#define DNS_MAXPOINTERS       (32)    /* compression pointers to follow.   */
+#define DNS_MAXMSGLEN         (4096)  /* largest udp answer we read.       */
+
+#define DNS_TYPE_A            (1)
+#define DNS_TYPE_CNAME        (5)
+#define DNS_TYPE_SOA          (6)
+#define DNS_TYPE_AAAA         (28)
+#define DNS_CLASS_IN          (1)
+
+#define DNS_FLAG_QR           (0x8000)
+#define DNS_FLAG_TC           (0x0200)
+#define DNS_FLAG_RD           (0x0100)
+#define DNS_RCODE(flags)      ((flags) & 0x000f)
+
+#define DNS_RCODE_NOERROR     (0)
+#define DNS_RCODE_NXDOMAIN    (3)
+
+#define RESOLVER_MAXNS        (3)     /* nameservers we use, as MAXNS.     */
+
+#define GET16(p)  ((uint16_t)(((p)[0] << 8) | (p)[1]))
+#define GET32(p)  ((uint32_t)(((uint32_t)GET16(p) << 16) | GET16(&(p)[2])))
+
+/* TTLs with the high bit set are to be treated as zero; RFC 2181. */
+#define DNS_TTL(ttl)          ((ttl) & 0x80000000 ? (time_t)0 : (time_t)(ttl))
+
+#define PUT16(p, v)                                                            \
+do {                                                                           \
+   (p)[0] = (unsigned char)(((v) >> 8) & 0xff);                                \
+   (p)[1] = (unsigned char)((v) & 0xff);                                       \
+} while (/* CONSTCOND */ 0)
+
+typedef enum { QUESTION_FREE = 0,
+               QUESTION_UDP,        /* sent over udp, waiting for answer.    */
+               QUESTION_TCPCONNECT, /* waiting for tcp connect to complete.  */
+               QUESTION_TCPREAD,    /* sent over tcp, waiting for answer.    */
+               QUESTION_DONE        /* answered, or given up.                */
+} questionstate_t;
+
+typedef struct {
+   questionstate_t         state;
+   uint16_t                type;     /* DNS_TYPE_A or DNS_TYPE_AAAA.         */
+   uint16_t                id;       /* id of the last query sent.           */
+   size_t                  nsi;      /* index of nameserver last sent to.    */
+   size_t                  tries;    /* number of times sent so far.         */
+   time_t                  sent;     /* when we last sent it.                */
+
+   int                     rcode;    /* rcode of answer, -1 if none.         */
+   time_t                  ttl;      /* lowest TTL of the records used.      */
+   time_t                  negttl;   /*
+                                      * lifetime of a negative answer, from
+                                      * the SOA record.  -1 if none.
+                                      */
+
+   int                     s;        /* socket to nameserver, or -1.         */
+   unsigned char           tcplenmem[2];   /* length prefix of tcp answer.   */
+   unsigned char           *tcpbuf;  /* tcp answer, once we know the length. */
+   size_t                  tcplen;   /* length of tcp answer.                */
+   size_t                  tcpread;  /* bytes read, including the prefix.    */
+
+   struct sockaddr_storage addrv[MAX_ADDRINFO_NEXT / 2];
+   size_t                  addrc;
+} dnsquestion_t;
+
+typedef struct {
+   unsigned char  allocated;
+   unsigned char  completed;              /* not yet collected by caller.    */
+   int            gai_rc;                 /* result, once completed.         */
+
+   char           name[MAXHOSTNAMELEN];   /* as given to us.                 */
+   char           qname[MAXHOSTNAMELEN];  /* as sent; without trailing dot.  */
+   char           canonname[MAXHOSTNAMELEN];
+
+   dnsquestion_t  questionv[2];           /* A, then AAAA.                   */
+   sockd_timer_t  timer;                  /* next retransmit.                */
+} dnsquery_t;
+
+static struct {
+   struct sockaddr_storage nsv[RESOLVER_MAXNS];  /* nameservers.             */
+   size_t                  nsc;
+   size_t                  nextns;    /* first nameserver to use, if rotate. */
+   unsigned char           rotate;    /* spread queries over nameservers?    */
+   unsigned char           usetcp;    /* use tcp rather than udp?            */
+   unsigned char           hassearch; /* search list applies to names?       */
+   time_t                  timeout;   /* seconds to wait for an answer.      */
+   size_t                  attempts;  /* times to try each nameserver.       */
+   size_t                  ndots;
+
+   char                    **hostv;   /* names in SOCKD_HOSTSFILE, sorted.   */
+   size_t                  hostc;
+} resolver;
+
+static dnsquery_t   *queryv;   /* indexed by the id our caller gave us. */
+static size_t       queryc;
+static size_t       refreshfirst; /* ids from here on are for refreshes. */
+static timerwheel_t querytimers;
+
+static void readresolvconf(void);
+/*
+ * Reads the nameservers and options from SOCKD_RESOLVCONF into "resolver".
+ * What is not set there gets the same default as in the system resolver.
+ */
+
+static void readhostsfile(void);
+/*
+ * Reads the names listed in SOCKD_HOSTSFILE into resolver.hostv.
+ */
+
+static int ishostsname(const char *name);
+/*
+ * Returns true if "name" is listed in SOCKD_HOSTSFILE.
+ */
+
+static int hostcmp(const void *a, const void *b);
+/*
+ * qsort(3)/bsearch(3) comparison function for resolver.hostv.
+ */
+
+static void
+question_send(dnsquery_t *query, dnsquestion_t *question, const time_t tnow);
+/*
+ * Sends "question" of "query" to nameserver question->nsi, over udp or
+ * tcp as appropriate.
+ */
+
+static void
+question_failed(dnsquery_t *query, dnsquestion_t *question, const time_t tnow);
+/*
+ * Called when we got no usable answer to "question" from the last
+ * nameserver we sent it to.  Resends it to the next nameserver, or gives
+ * up if we have tried enough times.
+ */
+
+static void
+question_tcpstart(dnsquery_t *query, dnsquestion_t *question,
+                  const time_t tnow);
+/*
+ * Starts connecting to nameserver question->nsi over tcp, so we can send
+ * "question" over tcp.
+ */
+
+static void question_close(dnsquestion_t *question);
+/*
+ * Closes the socket of "question", if any.
+ */
+
+static void
+question_answer(dnsquery_t *query, dnsquestion_t *question,
+                const unsigned char *msg, const size_t msglen,
+                const time_t tnow);
+/*
+ * Handles the answer "msg", of length "msglen", to "question".
+ */
+
+static void query_checkdone(dnsquery_t *query);
+/*
+ * Checks whether all questions of "query" are done, and if so, adds the
+ * result to the hostcache and marks "query" as completed.
+ */
+
+static void query_settimer(dnsquery_t *query);
+/*
+ * Arms the timer of "query" for when the first outstanding question
+ * times out.
+ */
+
+static uint16_t newid(void);
+/*
+ * Returns a random id for a new query.
+ */
+
+static size_t
+dns_mkquery(unsigned char *buf, const size_t buflen, const uint16_t id,
+            const char *name, const uint16_t type);
+/*
+ * Writes a query with the id "id" for records of type "type" for the
+ * hostname "name" to "buf", of size "buflen".
+ *
+ * Returns the length of the query, or 0 if "name" can not be encoded.
+ */
+
+static ssize_t
+dns_getname(const unsigned char *msg, const size_t msglen, size_t offset,
+            char *name, const size_t namelen);
+/*
+ * Decodes the, possibly compressed, name at offset "offset" in the
+ * message "msg", of length "msglen", into "name", of size "namelen".
+ *
+ * Returns the offset of the first octet following the name, or -1 if
+ * the name is invalid.
+ */
+
+static int
+dns_parseanswer(dnsquery_t *query, dnsquestion_t *question,
+                const unsigned char *msg, const size_t msglen,
+                uint16_t *flags);
+/*
+ * Parses the answer "msg", of length "msglen", to "question", and adds
+ * the addresses in it to "question".  "flags" is set to the flags of
+ * the answer.
+ *
+ * Returns 0 if the answer is an answer to "question", -1 if not.
+ */
+
+int
+resolver_init(maxqueries, maxrefreshes)
+   const size_t maxqueries;
+   const size_t maxrefreshes;
+{
+   const char *function = "resolver_init()";
+
+   SASSERTX(queryv == NULL);
+
+   readresolvconf();
+
+   if ((queryv = calloc(maxqueries + maxrefreshes, sizeof(*queryv))) == NULL) {
+      swarn("%s: failed to allocate memory for %lu queries",
+            function, (unsigned long)(maxqueries + maxrefreshes));
+
+      return -1;
+   }
+
+   queryc       = maxqueries + maxrefreshes;
+   refreshfirst = maxqueries;
+   timerwheel_init(&querytimers, time_monotonic(NULL));
+
+   readhostsfile();
+
+   slog(LOG_DEBUG,
+        "%s: %lu nameserver%s, timeout %lds, %lu attempt%s, ndots %lu, "
+        "%s search list, using %s, %lu names in %s",
+        function,
+        (unsigned long)resolver.nsc,
+        resolver.nsc == 1 ? "" : "s",
+        (long)resolver.timeout,
+        (unsigned long)resolver.attempts,
+        resolver.attempts == 1 ? "" : "s",
+        (unsigned long)resolver.ndots,
+        resolver.hassearch ? "with" : "no",
+        resolver.usetcp ? "tcp" : "udp",
+        (unsigned long)resolver.hostc,
+        SOCKD_HOSTSFILE);
+
+   return 0;
+}
+
+int
+resolver_canresolve(name)
+   const char *name;
+{
+   unsigned char buf[DNS_HEADERLEN + DNS_MAXNAMELEN + 4];
+   struct in6_addr ipv6;
+   struct in_addr ipv4;
+   const char *p;
+   size_t dots, len;
+
+   if (queryv == NULL)
+      return 0;
+
+   if ((len = strlen(name)) == 0 || len >= MAXHOSTNAMELEN)
+      return 0;
+
+   for (dots = 0, p = name; *p != NUL; ++p)
+      if (*p == '.')
+         ++dots;
+
+   /*
+    * Names with fewer dots than this may be looked up with the search
+    * list appended first, so leave those to the system resolver.
+    */
+   if (name[len - 1] != '.' && dots < MAX(1, resolver.ndots))
+      return 0;
+
+   if (inet_pton(AF_INET, name, &ipv4) == 1
+   ||  inet_pton(AF_INET6, name, &ipv6) == 1)
+      return 0;
+
+   if (dns_mkquery(buf, sizeof(buf), 0, name, DNS_TYPE_A) == 0)
+      return 0;
+
+   if (ishostsname(name))
+      return 0;
+
+   return 1;
+}
+
+void
+resolver_start(id, name)
+   const size_t id;
+   const char *name;
+{
+   const char *function = "resolver_start()";
+   const time_t tnow = time_monotonic(NULL);
+   dnsquery_t *query;
+   size_t i, nsi;
+   char visbuf[MAXHOSTNAMELEN * 4];
+
+   SASSERTX(id < queryc);
+
+   query = &queryv[id];
+   SASSERTX(!query->allocated);
+
+   bzero(query, sizeof(*query));
+
+   STRCPY_ASSERTLEN(query->name, name);
+   STRCPY_ASSERTLEN(query->qname, name);
+
+   i = strlen(query->qname);
+   if (i > 0 && query->qname[i - 1] == '.')
+      query->qname[i - 1] = NUL;
+
+   slog(LOG_DEBUG, "%s: resolving \"%s\" as lookup #%lu",
+        function,
+        str2vis(name, strlen(name), visbuf, sizeof(visbuf)),
+        (unsigned long)id);
+
+   if (resolver.rotate)
+      nsi = resolver.nextns++ % resolver.nsc;
+   else
+      nsi = 0;
+
+   query->allocated = 1;
+
+   query->questionv[0].type = DNS_TYPE_A;
+   query->questionv[1].type = DNS_TYPE_AAAA;
+
+   for (i = 0; i < ELEMENTS(query->questionv); ++i) {
+      query->questionv[i].s     = -1;
+      query->questionv[i].rcode = -1;
+      query->questionv[i].nsi   = nsi;
+
+      question_send(query, &query->questionv[i], tnow);
+   }
+
+   query_checkdone(query);
+
+   if (!query->completed)
+      query_settimer(query);
+}
+
+void
+resolver_refresh(name)
+   const char *name;
+{
+   const char *function = "resolver_refresh()";
+   size_t id;
+   char visbuf[MAXHOSTNAMELEN * 4];
+
+   for (id = refreshfirst; id < queryc; ++id)
+      if (!queryv[id].allocated)
+         break;
+
+   if (id >= queryc) {
+      slog(LOG_DEBUG, "%s: too many refreshes in progress to refresh \"%s\"",
+           function, str2vis(name, strlen(name), visbuf, sizeof(visbuf)));
+
+      return;
+   }
+
+   resolver_start(id, name);
+}
+
+void
+resolver_cancel(id)
+   const size_t id;
+{
+   dnsquery_t *query;
+   size_t i;
+
+   SASSERTX(id < queryc);
+
+   query = &queryv[id];
+
+   if (!query->allocated)
+      return;
+
+   for (i = 0; i < ELEMENTS(query->questionv); ++i)
+      question_close(&query->questionv[i]);
+
+   timer_disarm(&querytimers, &query->timer);
+
+   query->allocated = 0;
+   query->completed = 0;
+}
+
+int
+resolver_fdset(fdbits, rset, wset)
+   int fdbits;
+   fd_set *rset;
+   fd_set *wset;
+{
+   size_t i, j;
+
+   for (i = 0; i < queryc; ++i) {
+      if (!queryv[i].allocated || queryv[i].completed)
+         continue;
+
+      for (j = 0; j < ELEMENTS(queryv[i].questionv); ++j) {
+         const dnsquestion_t *question = &queryv[i].questionv[j];
+
+         switch (question->state) {
+            case QUESTION_UDP:
+            case QUESTION_TCPREAD:
+               FD_SET(question->s, rset);
+               fdbits = MAX(fdbits, question->s);
+               break;
+
+            case QUESTION_TCPCONNECT:
+               FD_SET(question->s, wset);
+               fdbits = MAX(fdbits, question->s);
+               break;
+
+            default:
+               break;
+         }
+      }
+   }
+
+   return fdbits;
+}
+
+time_t
+resolver_timeuntil(tnow)
+   const time_t tnow;
+{
+
+   if (queryv == NULL)
+      return (time_t)-1;
+
+   return timerwheel_timeuntil(&querytimers, tnow);
+}
+
+void
+resolver_process(rset, wset)
+   const fd_set *rset;
+   const fd_set *wset;
+{
+   const char *function = "resolver_process()";
+   const time_t tnow = time_monotonic(NULL);
+   sockd_timer_t *timer;
+   size_t i, j;
+
+   if (queryv == NULL)
+      return;
+
+   for (i = 0; i < queryc; ++i) {
+      dnsquery_t *query = &queryv[i];
+
+      if (!query->allocated || query->completed)
+         continue;
+
+      for (j = 0; j < ELEMENTS(query->questionv); ++j) {
+         dnsquestion_t *question = &query->questionv[j];
+         ssize_t rc;
+
+         if (question->state == QUESTION_UDP && FD_ISSET(question->s, rset)) {
+            /*
+             * The socket is connected to the nameserver, so anything we
+             * read is from it.  Only the id needs checking.
+             */
+            while (question->state == QUESTION_UDP) {
+               unsigned char msg[DNS_MAXMSGLEN];
+
+               if ((rc = recv(question->s, msg, sizeof(msg), 0)) == -1) {
+                  if (ERRNOISTMP(errno) || errno == EAGAIN)
+                     break;
+
+                  slog(LOG_DEBUG, "%s: recv() from nameserver %s failed: %s",
+                       function,
+                       sockaddr2string(&resolver.nsv[question->nsi], NULL, 0),
+                       strerror(errno));
+
+                  /*
+                   * Most likely ECONNREFUSED, from an icmp port unreachable
+                   * error.  No answer is coming, so no point in waiting
+                   * for the timeout before trying the next nameserver.
+                   */
+                  question_failed(query, question, tnow);
+                  break;
+               }
+
+               if ((size_t)rc < DNS_HEADERLEN || GET16(msg) != question->id) {
+                  slog(LOG_DEBUG,
+                       "%s: ignoring unexpected answer of %ld bytes from %s",
+                       function,
+                       (long)rc,
+                       sockaddr2string(&resolver.nsv[question->nsi], NULL, 0));
+
+                  continue;
+               }
+
+               question_answer(query, question, msg, (size_t)rc, tnow);
+            }
+         }
+         else if (question->state == QUESTION_TCPCONNECT
+         &&  FD_ISSET(question->s, wset)) {
+            unsigned char buf[2 + DNS_HEADERLEN + DNS_MAXNAMELEN + 4];
+            socklen_t len;
+            size_t querylen;
+            int errnum;
+
+            len = sizeof(errnum);
+            if (getsockopt(question->s, SOL_SOCKET, SO_ERROR, &errnum, &len)
+            != 0)
+               errnum = errno;
+
+            if (errnum != 0) {
+               slog(LOG_DEBUG, "%s: tcp connect to nameserver %s failed: %s",
+                    function,
+                    sockaddr2string(&resolver.nsv[question->nsi], NULL, 0),
+                    strerror(errnum));
+
+               question_failed(query, question, tnow);
+               continue;
+            }
+
+            querylen = dns_mkquery(&buf[2],
+                                   sizeof(buf) - 2,
+                                   question->id,
+                                   query->qname,
+                                   question->type);
+            SASSERTX(querylen > 0);
+
+            PUT16(buf, querylen);
+
+            /* small enough that it should always fit in the sendbuffer. */
+            if ((rc = write(question->s, buf, querylen + 2))
+            != (ssize_t)(querylen + 2)) {
+               slog(LOG_DEBUG, "%s: write to nameserver %s failed: %s",
+                    function,
+                    sockaddr2string(&resolver.nsv[question->nsi], NULL, 0),
+                    rc == -1 ? strerror(errno) : "short write");
+
+               question_failed(query, question, tnow);
+               continue;
+            }
+
+            question->state   = QUESTION_TCPREAD;
+            question->tcpread = 0;
+         }
+         else if (question->state == QUESTION_TCPREAD
+         &&       FD_ISSET(question->s, rset)) {
+            if (question->tcpread < sizeof(question->tcplenmem))
+               rc = read(question->s,
+                         &question->tcplenmem[question->tcpread],
+                         sizeof(question->tcplenmem) - question->tcpread);
+            else
+               rc = read(question->s,
+                         &question->tcpbuf[question->tcpread
+                                           - sizeof(question->tcplenmem)],
+                         question->tcplen
+                         - (question->tcpread - sizeof(question->tcplenmem)));
+
+            if (rc <= 0) {
+               if (rc == -1 && (ERRNOISTMP(errno) || errno == EAGAIN))
+                  continue;
+
+               slog(LOG_DEBUG, "%s: read from nameserver %s failed: %s",
+                    function,
+                    sockaddr2string(&resolver.nsv[question->nsi], NULL, 0),
+                    rc == 0 ? "eof" : strerror(errno));
+
+               question_failed(query, question, tnow);
+               continue;
+            }
+
+            question->tcpread += (size_t)rc;
+
+            if (question->tcpread == sizeof(question->tcplenmem)) {
+               question->tcplen = GET16(question->tcplenmem);
+
+               if (question->tcplen < DNS_HEADERLEN
+               || (question->tcpbuf = malloc(question->tcplen)) == NULL) {
+                  question_failed(query, question, tnow);
+                  continue;
+               }
+            }
+            else if (question->tcpread
+            == sizeof(question->tcplenmem) + question->tcplen) {
+               unsigned char *msg = question->tcpbuf;
+
+               question->tcpbuf = NULL;
+               question_close(question);
+
+               if (GET16(msg) == question->id)
+                  question_answer(query, question, msg, question->tcplen, tnow);
+               else
+                  question_failed(query, question, tnow);
+
+               free(msg);
+            }
+         }
+      }
+
+      query_checkdone(query);
+   }
+
+   while ((timer = timerwheel_getexpired(&querytimers, tnow)) != NULL) {
+      dnsquery_t *query = (dnsquery_t *)((char *)timer
+                                         - offsetof(dnsquery_t, timer));
+
+      SASSERTX(query->allocated);
+      SASSERTX(!query->completed);
+
+      for (j = 0; j < ELEMENTS(query->questionv); ++j) {
+         dnsquestion_t *question = &query->questionv[j];
+
+         if (question->state == QUESTION_DONE
+         ||  socks_difftime(tnow, question->sent) < resolver.timeout)
+            continue;
+
+         slog(LOG_DEBUG,
+              "%s: no answer for \"%s\" from nameserver %s within %lds",
+              function,
+              query->qname,
+              sockaddr2string(&resolver.nsv[question->nsi], NULL, 0),
+              (long)resolver.timeout);
+
+         question_failed(query, question, tnow);
+      }
+
+      query_checkdone(query);
+
+      if (!query->completed)
+         query_settimer(query);
+   }
+}
+
+ssize_t
+resolver_getcompleted(gai_rc)
+   int *gai_rc;
+{
+   size_t i;
+
+   for (i = 0; i < queryc; ++i) {
+      if (!queryv[i].allocated || !queryv[i].completed)
+         continue;
+
+      queryv[i].allocated = 0;
+      queryv[i].completed = 0;
+
+      if (i >= refreshfirst)
+         continue; /* result is in the hostcache; nobody waiting for it. */
+
+      *gai_rc = queryv[i].gai_rc;
+      return (ssize_t)i;
+   }
+
+   return -1;
+}
+
+static void
+question_send(query, question, tnow)
+   dnsquery_t *query;
+   dnsquestion_t *question;
+   const time_t tnow;
+{
+   const char *function = "question_send()";
+   const struct sockaddr_storage *ns = &resolver.nsv[question->nsi];
+   unsigned char buf[DNS_HEADERLEN + DNS_MAXNAMELEN + 4];
+   size_t len;
+
+   question->id   = newid();
+   question->sent = tnow;
+   ++question->tries;
+
+   if (resolver.usetcp) {
+      question_tcpstart(query, question, tnow);
+      return;
+   }
+
+   len = dns_mkquery(buf, sizeof(buf), question->id, query->qname,
+                     question->type);
+   SASSERTX(len > 0);
+
+   /*
+    * A new socket for every query sent, so the kernel picks a new random
+    * source port for it each time.
+    */
+   question_close(question);
+
+   if ((question->s = socket(ns->ss_family, SOCK_DGRAM, 0)) == -1
+   ||  setnonblocking(question->s, function) == -1
+   ||  connect(question->s, TOCSA(ns), salen(ns->ss_family)) == -1) {
+      slog(LOG_DEBUG, "%s: could not create udp socket to nameserver %s: %s",
+           function, sockaddr2string(ns, NULL, 0), strerror(errno));
+
+      question_failed(query, question, tnow);
+      return;
+   }
+
+   if (send(question->s, buf, len, 0) != (ssize_t)len) {
+      slog(LOG_DEBUG, "%s: send(2) to nameserver %s failed: %s",
+           function, sockaddr2string(ns, NULL, 0), strerror(errno));
+
+      question_failed(query, question, tnow);
+      return;
+   }
+
+   question->state = QUESTION_UDP;
+}
+
+static void
+question_failed(query, question, tnow)
+   dnsquery_t *query;
+   dnsquestion_t *question;
+   const time_t tnow;
+{
+
+   question_close(question);
+
+   if (question->tries >= resolver.attempts * resolver.nsc) {
+      question->state = QUESTION_DONE;
+      question->rcode = -1;
+
+      return;
+   }
+
+   question->nsi = (question->nsi + 1) % resolver.nsc;
+   question_send(query, question, tnow);
+}
+
+static void
+question_tcpstart(query, question, tnow)
+   dnsquery_t *query;
+   dnsquestion_t *question;
+   const time_t tnow;
+{
+   const char *function = "question_tcpstart()";
+   const struct sockaddr_storage *ns = &resolver.nsv[question->nsi];
+
+   question_close(question);
+
+   if ((question->s = socket(ns->ss_family, SOCK_STREAM, 0)) == -1
+   ||  setnonblocking(question->s, function) == -1
+   || (connect(question->s, TOCSA(ns), salen(ns->ss_family)) == -1
+       && errno != EINPROGRESS)) {
+      slog(LOG_DEBUG, "%s: could not connect to nameserver %s: %s",
+           function, sockaddr2string(ns, NULL, 0), strerror(errno));
+
+      question_failed(query, question, tnow);
+      return;
+   }
+
+   question->state = QUESTION_TCPCONNECT;
+}
+
+static void
+question_close(question)
+   dnsquestion_t *question;
+{
+
+   if (question->s != -1) {
+      close(question->s);
+      question->s = -1;
+   }
+
+   free(question->tcpbuf);
+   question->tcpbuf = NULL;
+}
+
+static void
+question_answer(query, question, msg, msglen, tnow)
+   dnsquery_t *query;
+   dnsquestion_t *question;
+   const unsigned char *msg;
+   const size_t msglen;
+   const time_t tnow;
+{
+   const char *function = "question_answer()";
+   uint16_t flags;
+
+   if (dns_parseanswer(query, question, msg, msglen, &flags) != 0) {
+      slog(LOG_DEBUG,
+           "%s: answer from nameserver %s does not match our question "
+           "for \"%s\"",
+           function,
+           sockaddr2string(&resolver.nsv[question->nsi], NULL, 0),
+           query->qname);
+
+      if (question->state == QUESTION_UDP)
+         return; /* may be spoofed; keep waiting for the real one. */
+
+      question_failed(query, question, tnow);
+      return;
+   }
+
+   if (flags & DNS_FLAG_TC) {
+      if (question->state == QUESTION_UDP) {
+         slog(LOG_DEBUG, "%s: answer for \"%s\" truncated, retrying over tcp",
+              function, query->qname);
+
+         question_tcpstart(query, question, tnow);
+      }
+      else
+         question_failed(query, question, tnow);
+
+      return;
+   }
+
+   switch (DNS_RCODE(flags)) {
+      case DNS_RCODE_NOERROR:
+      case DNS_RCODE_NXDOMAIN:
+         question_close(question);
+
+         question->state = QUESTION_DONE;
+         question->rcode = DNS_RCODE(flags);
+
+         slog(LOG_DEBUG, "%s: %s for \"%s\": rcode %d, %lu address%s",
+              function,
+              question->type == DNS_TYPE_A ? "A" : "AAAA",
+              query->qname,
+              question->rcode,
+              (unsigned long)question->addrc,
+              question->addrc == 1 ? "" : "es");
+         break;
+
+      default:
+         slog(LOG_DEBUG, "%s: nameserver %s returned rcode %d for \"%s\"",
+              function,
+              sockaddr2string(&resolver.nsv[question->nsi], NULL, 0),
+              DNS_RCODE(flags),
+              query->qname);
+
+         question->addrc = 0;
+         question_failed(query, question, tnow);
+   }
+}
+
+static void
+query_checkdone(query)
+   dnsquery_t *query;
+{
+   const char *function = "query_checkdone()";
+   struct addrinfo aiv[MAX_ADDRINFO_NEXT];
+   size_t i, j, aic;
+   time_t ttl, lifetime;
+   int isnegative;
+
+   if (!query->allocated || query->completed)
+      return;
+
+   for (i = 0; i < ELEMENTS(query->questionv); ++i)
+      if (query->questionv[i].state != QUESTION_DONE)
+         return;
+
+   timer_disarm(&querytimers, &query->timer);
+
+   bzero(aiv, sizeof(aiv));
+   isnegative = 1;
+   ttl        = (time_t)-1;
+
+   for (i = aic = 0; i < ELEMENTS(query->questionv); ++i) {
+      dnsquestion_t *question = &query->questionv[i];
+      time_t questionttl;
+
+      if (question->rcode == -1) {
+         isnegative = 0;
+         continue;
+      }
+
+      if (question->addrc > 0)
+         questionttl = question->ttl;
+      else if (question->negttl != (time_t)-1)
+         questionttl = question->negttl;
+      else
+         questionttl = SOCKD_CACHETIMEOUT_NEGATIVE;
+
+      if (ttl == (time_t)-1 || questionttl < ttl)
+         ttl = questionttl;
+
+      for (j = 0; j < question->addrc; ++j, ++aic) {
+         aiv[aic].ai_family  = question->addrv[j].ss_family;
+         aiv[aic].ai_addrlen = salen(question->addrv[j].ss_family);
+         aiv[aic].ai_addr    = TOSA(&question->addrv[j]);
+
+         if (aic > 0)
+            aiv[aic - 1].ai_next = &aiv[aic];
+      }
+   }
+
+   if (aic > 0) {
+      if (*query->canonname == NUL)
+         STRCPY_ASSERTLEN(query->canonname, query->qname);
+
+      aiv[0].ai_canonname = query->canonname;
+
+      query->gai_rc = 0;
+      lifetime      = hostcache_lifetime(ttl);
+
+      hostcache_addresolved(query->name, 0, aiv, lifetime);
+   }
+   else if (isnegative) {
+      /*
+       * Nameservers say the name does not exist.  If a search list
+       * applies however, the system resolver would go on to try with
+       * that, so the answer is only final if there is none.
+       */
+      query->gai_rc = EAI_NONAME;
+      lifetime      = hostcache_lifetime(ttl);
+
+      if (!resolver.hassearch)
+         hostcache_addresolved(query->name, EAI_NONAME, NULL, lifetime);
+   }
+   else {
+      query->gai_rc = EAI_AGAIN;
+      lifetime      = SOCKD_RESOLVER_FAILTIMEOUT;
+
+      hostcache_addresolved(query->name, EAI_AGAIN, NULL, lifetime);
+   }
+
+   slog(LOG_DEBUG,
+        "%s: resolving \"%s\" completed with %lu address%s, "
+        "lifetime %lds: %s",
+        function,
+        query->qname,
+        (unsigned long)aic,
+        aic == 1 ? "" : "es",
+        (long)lifetime,
+        query->gai_rc == 0 ? "no error" : gai_strerror(query->gai_rc));
+
+   query->completed = 1;
+}
+
+static void
+query_settimer(query)
+   dnsquery_t *query;
+{
+   time_t expires = (time_t)-1;
+   size_t i;
+
+   for (i = 0; i < ELEMENTS(query->questionv); ++i) {
+      const dnsquestion_t *question = &query->questionv[i];
+
+      if (question->state == QUESTION_DONE)
+         continue;
+
+      if (expires == (time_t)-1 || question->sent + resolver.timeout < expires)
+         expires = question->sent + resolver.timeout;
+   }
+
+   SASSERTX(expires != (time_t)-1);
+   timer_arm(&querytimers, &query->timer, expires);
+}
+
+static uint16_t
+newid(void)
+{
+   uint16_t id;
+
+   /*
+    * Each question has its own socket, so ids need not be unique, only
+    * hard to guess.  random(3) is seeded with our pid, so is not.
+    */
+#if HAVE_ARC4RANDOM_BUF
+   arc4random_buf(&id, sizeof(id));
+#elif HAVE_GETRANDOM
+   if (getrandom(&id, sizeof(id), GRND_NONBLOCK) != (ssize_t)sizeof(id))
+      id = (uint16_t)random();
+#else /* !HAVE_ARC4RANDOM_BUF && !HAVE_GETRANDOM */
+   id = (uint16_t)random();
+#endif /* !HAVE_ARC4RANDOM_BUF && !HAVE_GETRANDOM */
+
+   return id;
+}
+
+static size_t
+dns_mkquery(buf, buflen, id, name, type)
+   unsigned char *buf;
+   const size_t buflen;
+   const uint16_t id;
+   const char *name;
+   const uint16_t type;
+{
+   const char *label, *end;
+   size_t len;
+
+   if (buflen < DNS_HEADERLEN)
+      return 0;
+
+   bzero(buf, DNS_HEADERLEN);
+   PUT16(&buf[0], id);
+   PUT16(&buf[2], DNS_FLAG_RD);
+   PUT16(&buf[4], 1); /* one question. */
+
+   len = DNS_HEADERLEN;
+
+   for (label = name; *label != NUL; label = *end == NUL ? end : end + 1) {
+      const size_t labellen = (end = strchr(label, '.')) == NULL ?
+                              strlen(label) : (size_t)(end - label);
+
+      if (end == NULL)
+         end = label + labellen;
+
+      if (labellen == 0 || labellen > DNS_MAXLABELLEN)
+         return 0;
+
+      if (len + 1 + labellen >= DNS_HEADERLEN + DNS_MAXNAMELEN
+      ||  len + 1 + labellen + 1 + 4 > buflen)
+         return 0;
+
+      buf[len++] = (unsigned char)labellen;
+      memcpy(&buf[len], label, labellen);
+      len += labellen;
+   }
+
+   if (len == DNS_HEADERLEN)
+      return 0; /* empty name. */
+
+   buf[len++] = 0; /* root label. */
+
+   PUT16(&buf[len], type);
+   len += 2;
+
+   PUT16(&buf[len], DNS_CLASS_IN);
+   len += 2;
+
+   return len;
+}
+
+static ssize_t
+dns_getname(msg, msglen, offset, name, namelen)
+   const unsigned char *msg;
+   const size_t msglen;
+   size_t offset;
+   char *name;
+   const size_t namelen;
+{
+   ssize_t next = -1;
+   size_t used = 0, pointers = 0;
+
+   SASSERTX(namelen > 0);
+
+   while (1) {
+      size_t labellen;
+
+      if (offset >= msglen)
+         return -1;
+
+      labellen = msg[offset];
+
+      if ((labellen & 0xc0) == 0xc0) { /* compression pointer. */
+         if (offset + 1 >= msglen || ++pointers > DNS_MAXPOINTERS)
+            return -1;
+
+         if (next == -1)
+            next = (ssize_t)offset + 2;
+
+         offset = ((labellen & 0x3f) << 8) | msg[offset + 1];
+         continue;
+      }
+
+      if (labellen & 0xc0)
+         return -1; /* reserved label types. */
+
+      ++offset;
+
+      if (labellen == 0)
+         break;
+
+      if (offset + labellen > msglen
+      ||  used + (used > 0 ? 1 : 0) + labellen >= namelen)
+         return -1;
+
+      if (used > 0)
+         name[used++] = '.';
+
+      memcpy(&name[used], &msg[offset], labellen);
+      used   += labellen;
+      offset += labellen;
+   }
+
+   name[used] = NUL;
+
+   return next == -1 ? (ssize_t)offset : next;
+}
+
+static int
+dns_parseanswer(query, question, msg, msglen, flags)
+   dnsquery_t *query;
+   dnsquestion_t *question;
+   const unsigned char *msg;
+   const size_t msglen;
+   uint16_t *flags;
+{
+   char name[MAXHOSTNAMELEN], owner[MAXHOSTNAMELEN];
+   ssize_t offset;
+   size_t i, ancount, nscount;
+
+   if (msglen < DNS_HEADERLEN)
+      return -1;
+
+   *flags  = GET16(&msg[2]);
+   ancount = GET16(&msg[6]);
+   nscount = GET16(&msg[8]);
+
+   if (!(*flags & DNS_FLAG_QR) || GET16(&msg[4]) != 1)
+      return -1;
+
+   if ((offset = dns_getname(msg, msglen, DNS_HEADERLEN, name, sizeof(name)))
+   == -1)
+      return -1;
+
+   if ((size_t)offset + 4 > msglen
+   ||  strcasecmp(name, query->qname)    != 0
+   ||  GET16(&msg[offset])     != question->type
+   ||  GET16(&msg[offset + 2]) != DNS_CLASS_IN)
+      return -1;
+
+   offset += 4;
+
+   if ((*flags & DNS_FLAG_TC)
+   ||  (DNS_RCODE(*flags) != DNS_RCODE_NOERROR
+     && DNS_RCODE(*flags) != DNS_RCODE_NXDOMAIN))
+      return 0;
+
+   /*
+    * The name the addresses are for; changes as we follow the CNAME chain.
+    */
+   STRCPY_ASSERTSIZE(name, query->qname);
+
+   question->addrc  = 0;
+   question->ttl    = DNS_TTL(0x7fffffff);
+   question->negttl = (time_t)-1;
+
+   for (i = 0; i < ancount; ++i) {
+      uint16_t type, class, rdlen;
+      time_t ttl;
+
+      if ((offset = dns_getname(msg, msglen, (size_t)offset, owner,
+                                sizeof(owner))) == -1
+      ||  (size_t)offset + 10 > msglen)
+         return -1;
+
+      type   = GET16(&msg[offset]);
+      class  = GET16(&msg[offset + 2]);
+      ttl    = DNS_TTL(GET32(&msg[offset + 4]));
+      rdlen  = GET16(&msg[offset + 8]);
+      offset += 10;
+
+      if ((size_t)offset + rdlen > msglen)
+         return -1;
+
+      if (class != DNS_CLASS_IN || strcasecmp(owner, name) != 0) {
+         offset += rdlen;
+         continue;
+      }
+
+      if (type == DNS_TYPE_CNAME) {
+         if (dns_getname(msg, msglen, (size_t)offset, name, sizeof(name))
+         == -1)
+            return -1;
+
+         question->ttl = MIN(question->ttl, ttl);
+      }
+      else if (type == question->type
+      &&       question->addrc < ELEMENTS(question->addrv)) {
+         struct sockaddr_storage *addr = &question->addrv[question->addrc];
+
+         bzero(addr, sizeof(*addr));
+
+         if (type == DNS_TYPE_A && rdlen == sizeof(TOIN(addr)->sin_addr)) {
+            SET_SOCKADDR(addr, AF_INET);
+            memcpy(&TOIN(addr)->sin_addr, &msg[offset], rdlen);
+            ++question->addrc;
+            question->ttl = MIN(question->ttl, ttl);
+         }
+         else if (type == DNS_TYPE_AAAA
+         &&       rdlen == sizeof(TOIN6(addr)->sin6_addr)) {
+            SET_SOCKADDR(addr, AF_INET6);
+            memcpy(&TOIN6(addr)->sin6_addr, &msg[offset], rdlen);
+            ++question->addrc;
+            question->ttl = MIN(question->ttl, ttl);
+         }
+      }
+
+      offset += rdlen;
+   }
+
+   if (question->addrc > 0) {
+      if (*query->canonname == NUL)
+         STRCPY_ASSERTSIZE(query->canonname, name);
+
+      return 0;
+   }
+
+   /*
+    * Negative answer.  How long we may cache that is given by the SOA
+    * record in the authority section, if there; RFC 2308.
+    */
+   for (i = 0; i < nscount; ++i) {
+      uint16_t type, class, rdlen;
+      ssize_t rdoffset;
+      time_t ttl;
+
+      if ((offset = dns_getname(msg, msglen, (size_t)offset, owner,
+                                sizeof(owner))) == -1
+      ||  (size_t)offset + 10 > msglen)
+         return -1;
+
+      type   = GET16(&msg[offset]);
+      class  = GET16(&msg[offset + 2]);
+      ttl    = DNS_TTL(GET32(&msg[offset + 4]));
+      rdlen  = GET16(&msg[offset + 8]);
+      offset += 10;
+
+      if ((size_t)offset + rdlen > msglen)
+         return -1;
+
+      if (type == DNS_TYPE_SOA && class == DNS_CLASS_IN) {
+         /*
+          * Skip the two names, mname and rname, and the serial, refresh,
+          * retry and expire fields, to get at the minimum field.
+          */
+         if ((rdoffset = dns_getname(msg, msglen, (size_t)offset, owner,
+                                     sizeof(owner))) == -1
+         ||  (rdoffset = dns_getname(msg, msglen, (size_t)rdoffset, owner,
+                                     sizeof(owner))) == -1
+         ||  (size_t)rdoffset + 20 > (size_t)offset + rdlen)
+            return -1;
+
+         question->negttl = MIN(ttl, DNS_TTL(GET32(&msg[rdoffset + 16])));
+         break;
+      }
+
+      offset += rdlen;
+   }
+
+   return 0;
+}
+
+static void
+readresolvconf(void)
+{
+   const char *function = "readresolvconf()";
+   FILE *fp;
+   char line[1024];
+
+   resolver.nsc       = 0;
+   resolver.timeout   = 5;   /* RES_TIMEOUT. */
+   resolver.attempts  = 2;   /* RES_DFLRETRY. */
+   resolver.ndots     = 1;
+   resolver.hassearch = 0;
+   resolver.rotate    = 0;
+   resolver.usetcp    = (sockscf.resolveprotocol == RESOLVEPROTOCOL_TCP);
+
+   if ((fp = fopen(SOCKD_RESOLVCONF, "r")) == NULL)
+      slog(LOG_DEBUG, "%s: could not open %s: %s",
+           function, SOCKD_RESOLVCONF, strerror(errno));
+   else {
+      while (fgets(line, sizeof(line), fp) != NULL) {
+         char *keyword, *arg;
+
+         if ((keyword = strtok(line, " \t\r\n")) == NULL
+         ||  *keyword == '#'
+         ||  *keyword == ';')
+            continue;
+
+         if (strcmp(keyword, "nameserver") == 0) {
+            struct sockaddr_storage *ns;
+            uint32_t scopeid = 0;
+
+            if ((arg = strtok(NULL, " \t\r\n")) == NULL
+            ||  resolver.nsc >= ELEMENTS(resolver.nsv))
+               continue;
+
+            ns = &resolver.nsv[resolver.nsc];
+            bzero(ns, sizeof(*ns));
+
+            if (socks_inet_pton(AF_INET, arg, &TOIN(ns)->sin_addr, NULL) == 1)
+               SET_SOCKADDR(ns, AF_INET);
+            else if (socks_inet_pton(AF_INET6,
+                                     arg,
+                                     &TOIN6(ns)->sin6_addr,
+                                     &scopeid) == 1) {
+               SET_SOCKADDR(ns, AF_INET6);
+               TOIN6(ns)->sin6_scope_id = scopeid;
+            }
+            else {
+               swarnx("%s: ignoring invalid nameserver \"%s\" in %s",
+                      function, arg, SOCKD_RESOLVCONF);
+
+               continue;
+            }
+
+            SET_SOCKADDRPORT(ns, htons(DNS_PORT));
+            ++resolver.nsc;
+         }
+         else if (strcmp(keyword, "search") == 0
+         ||       strcmp(keyword, "domain") == 0)
+            resolver.hassearch = 1;
+         else if (strcmp(keyword, "options") == 0) {
+            while ((arg = strtok(NULL, " \t\r\n")) != NULL) {
+               if (strncmp(arg, "timeout:", strlen("timeout:")) == 0)
+                  resolver.timeout
+                  = MIN(MAX(atoi(arg + strlen("timeout:")), 1), 30);
+               else if (strncmp(arg, "attempts:", strlen("attempts:")) == 0)
+                  resolver.attempts
+                  = MIN(MAX(atoi(arg + strlen("attempts:")), 1), 5);
+               else if (strncmp(arg, "ndots:", strlen("ndots:")) == 0)
+                  resolver.ndots
+                  = MIN(MAX(atoi(arg + strlen("ndots:")), 0), 15);
+               else if (strcmp(arg, "rotate") == 0)
+                  resolver.rotate = 1;
+               else if (strcmp(arg, "use-vc") == 0)
+                  resolver.usetcp = 1;
+            }
+         }
+      }
+
+      fclose(fp);
+   }
+
+   if (!resolver.hassearch) {
+      /*
+       * Without a search list, the system resolver uses the domain of
+       * our hostname as search list, if it has one.
+       */
+      char hostname[MAXHOSTNAMELEN];
+
+      if (gethostname(hostname, sizeof(hostname)) == 0
+      &&  strchr(hostname, '.') != NULL)
+         resolver.hassearch = 1;
+   }
+
+   if (resolver.nsc == 0) {
+      /* same default as the system resolver. */
+      struct sockaddr_storage *ns = &resolver.nsv[resolver.nsc++];
+
+      bzero(ns, sizeof(*ns));
+      SET_SOCKADDR(ns, AF_INET);
+      TOIN(ns)->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      SET_SOCKADDRPORT(ns, htons(DNS_PORT));
+   }
+}
+
+static int
+hostcmp(a, b)
+   const void *a;
+   const void *b;
+{
+
+   return strcasecmp(*(char * const *)a, *(char * const *)b);
+}
+
+static void
+readhostsfile(void)
+{
+   const char *function = "readhostsfile()";
+   FILE *fp;
+   char line[1024];
+   size_t allocated = 0;
+
+   if ((fp = fopen(SOCKD_HOSTSFILE, "r")) == NULL) {
+      slog(LOG_DEBUG, "%s: could not open %s: %s",
+           function, SOCKD_HOSTSFILE, strerror(errno));
+
+      return;
+   }
+
+   while (fgets(line, sizeof(line), fp) != NULL) {
+      char *p;
+
+      if ((p = strchr(line, '#')) != NULL)
+         *p = NUL;
+
+      if (strtok(line, " \t\r\n") == NULL) /* the address. */
+         continue;
+
+      while ((p = strtok(NULL, " \t\r\n")) != NULL) {
+         if (resolver.hostc >= allocated) {
+            const size_t newallocated = allocated == 0 ? 16 : allocated * 2;
+            char **newhostv;
+
+            if ((newhostv = realloc(resolver.hostv,
+                                    sizeof(*newhostv) * newallocated))
+            == NULL)
+               break;
+
+            resolver.hostv = newhostv;
+            allocated      = newallocated;
+         }
+
+         if ((resolver.hostv[resolver.hostc] = strdup(p)) == NULL)
+            break;
+
+         ++resolver.hostc;
+      }
+   }
+
+   fclose(fp);
+
+   if (resolver.hostc > 0)
+      qsort(resolver.hostv, resolver.hostc, sizeof(*resolver.hostv), hostcmp);
+}
+
+static int
+ishostsname(name)
+   const char *name;
+{
+   char namemem[MAXHOSTNAMELEN];
+   const char *key;
+   size_t len;
+
+   if (resolver.hostc == 0)
+      return 0;
+
+   /* "localhost." is the same name as "localhost". */
+   STRCPY_ASSERTLEN(namemem, name);
+
+   if ((len = strlen(namemem)) > 0 && namemem[len - 1] == '.')
+      namemem[len - 1] = NUL;
+
+   key = namemem;
+
+   return bsearch(&key,
+                  resolver.hostv,
+                  resolver.hostc,
+                  sizeof(*resolver.hostv),
+                  hostcmp) != NULL;
+}
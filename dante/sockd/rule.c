@@ -132,6 +132,236 @@ log_inheritable(const char *prefix, const rule_t *rule,
  * rule "rule" are inheritable or not, according to "inheritable".
  */
 
+/*
+ * Index over the addresses of a list of rules, so that rulespermit() only
+ * needs to check the rules that can possibly match the addresses of
+ * the request.  Rules are identified by their position in the list.
+ */
+typedef struct ruleindexnode_t {
+   struct ruleindexnode_t *child[2];
+   size_t                 rulec;
+   size_t                 *rulev;  /* rules with a prefix ending here.       */
+} ruleindexnode_t;
+
+typedef struct {
+   ruleindexnode_t ipv4;         /* binary trie over IPv4 prefixes.         */
+   ruleindexnode_t ipv6;         /* binary trie over IPv6 prefixes.         */
+
+   size_t          anyc;
+   size_t          *anyv;        /* rules with an address we can't index.   */
+} ruleindexaddr_t;
+
+typedef struct {
+   const rule_t    *rulebase;    /* list the index was built from.          */
+   unsigned char   isbuilt;
+   unsigned char   useindex;     /* too few rules to bother if not set.     */
+   unsigned char   srcportmatters;/* does any rule match on src port?       */
+
+   rule_t          **rulev;      /* the rules, in order.                    */
+   size_t          rulec;
+
+   ruleindexaddr_t src;
+   ruleindexaddr_t dst;
+
+   size_t          *positionv;   /* scratch, rulec elements.                */
+   rule_t          **candidatev; /* scratch, rulec elements.                */
+} ruleindex_t;
+
+static ruleindex_t cruleindex, hruleindex, sruleindex;
+
+static ruleindex_t *
+ruleindex_get(const objecttype_t ruletype, rule_t *rulebase);
+/*
+ * Returns the index for the rules of type "ruletype", starting with
+ * "rulebase", building it first if not already built.
+ */
+
+static void
+ruleindex_build(ruleindex_t *index, rule_t *rulebase);
+/*
+ * Builds the index "index" over the rules starting with "rulebase".
+ */
+
+static void
+ruleindex_addrule(ruleindexaddr_t *index, const ruleaddr_t *ruleaddr,
+                  const size_t position);
+/*
+ * Adds the address "ruleaddr" of the rule at position "position" to "index".
+ */
+
+static void
+ruleindex_freeaddr(ruleindexaddr_t *index);
+/*
+ * Frees the memory allocated for "index".
+ */
+
+static void
+ruleindex_freenode(ruleindexnode_t *node);
+/*
+ * Frees the memory allocated for the children of "node" and the rules
+ * in it, but not "node" itself.
+ */
+
+static const ruleindexnode_t *
+ruleindex_root(const ruleindexaddr_t *index, const sockshost_t *host,
+               const unsigned char **bytes, size_t *bits);
+/*
+ * Returns the root of the trie in "index" to use for looking up "host",
+ * with "bytes" and "bits" set to the address bits to use for the lookup,
+ * or NULL if "host" is not of a type we can look up in the index.
+ */
+
+static size_t
+ruleindex_count(const ruleindexaddr_t *index, const sockshost_t *host);
+/*
+ * Returns the number of rules in "index" that can possibly match "host",
+ * or (size_t)-1 if "host" can not be looked up in the index.
+ */
+
+static size_t
+ruleindex_lookup(const ruleindexaddr_t *index, const sockshost_t *host,
+                 size_t *positionv);
+/*
+ * Stores in "positionv" the positions of the rules in "index" that can
+ * possibly match "host", in no particular order.
+ * "host" must be of a type that can be looked up in "index".
+ *
+ * Returns the number of positions stored.
+ */
+
+static rule_t **
+rulecandidates(const objecttype_t ruletype, rule_t *rulebase,
+               const sockshost_t *src, const sockshost_t *dst,
+               size_t *candidatec);
+/*
+ * Returns the rules, of type "ruletype" and starting with "rulebase",
+ * that can possibly match a request from "src" to "dst", in rule order.
+ * Either of "src" and "dst" may be NULL if not known.
+ * The number of rules returned is stored in "candidatec".
+ *
+ * Returns NULL if all rules starting with "rulebase" must be checked.
+ */
+
+static int
+positioncmp(const void *a, const void *b);
+/*
+ * qsort(3) comparison function for rule positions.
+ */
+
+/*
+ * Cache of rulespermit() decisions, for requests whose outcome depends
+ * only on what is in the key.  The cache is flushed when the config is
+ * reloaded.
+ */
+typedef struct {
+   unsigned char     atype;
+   union {
+      struct in_addr  ipv4;
+      struct in6_addr ipv6;
+   } addr;
+   uint32_t          scopeid;
+   in_port_t         port;
+} rulecachehost_t;
+
+typedef struct {
+   objecttype_t      ruletype;
+   int               command;
+   int               protocol;
+   int               proxyprotocol;
+   int               clientmethod;
+   int               srcmethod;
+   rulecachehost_t   src;
+   rulecachehost_t   dst;
+} rulecachekey_t;
+
+typedef struct {
+   rulecachekey_t    key;
+   rule_t            *rule;      /* rule matched, or NULL if none.          */
+
+   /*
+    * Indexes in rulecache.entryv, plus one.  Zero means none.
+    */
+   size_t            hashnext;
+   size_t            lruprev;
+   size_t            lrunext;
+} rulecacheentry_t;
+
+static struct {
+   rulecacheentry_t  entryv[SOCKD_RULECACHE_SIZE];
+   size_t            entryc;
+
+   size_t            bucketv[SOCKD_RULECACHE_SIZE * 2];
+   size_t            lruhead;    /* most recently used.                     */
+   size_t            lrutail;    /* least recently used.                    */
+
+   unsigned long     hits;
+   unsigned long     misses;
+   unsigned long     bypassed;   /* requests we could not cache.            */
+} rulecache;
+
+static int
+rulecache_makekey(const objecttype_t ruletype, rule_t *rulebase,
+                  const connectionstate_t *state,
+                  const authmethod_t *clientauth, const authmethod_t *srcauth,
+                  const sockshost_t *src, const sockshost_t *dst,
+                  rulecachekey_t *key);
+/*
+ * Fills in "key" with the cache key for a request with the given
+ * parameters, to be matched against the rules starting with "rulebase".
+ *
+ * Returns true if the decision for such a request may be cached,
+ * false otherwise.
+ */
+
+static int
+rulecache_makehost(const sockshost_t *host, const int withport,
+                   rulecachehost_t *cachehost);
+/*
+ * Fills in "cachehost" from "host", including the port if "withport"
+ * is set.
+ *
+ * Returns true if "host" is an IP-address and can be used in a cache key,
+ * false otherwise.
+ */
+
+static rulecacheentry_t *
+rulecache_lookup(const rulecachekey_t *key);
+/*
+ * Returns the cache entry for "key", or NULL if there is none.
+ */
+
+static void
+rulecache_add(const rulecachekey_t *key, rule_t *rule);
+/*
+ * Adds an entry for "key" with the decision "rule" to the cache, evicting
+ * the least recently used entry if the cache is full.
+ */
+
+static void
+rulecache_unlink(const size_t id);
+/*
+ * Removes the entry with id "id" (index plus one) from the lru-list.
+ */
+
+static void
+rulecache_pushfront(const size_t id);
+/*
+ * Inserts the entry with id "id" (index plus one) first in the lru-list.
+ */
+
+static size_t
+rulecache_bucket(const rulecachekey_t *key);
+/*
+ * Returns the hash bucket in the cache for "key".
+ */
+
+static int
+rule_iscacheable(const rule_t *rule);
+/*
+ * Returns true if whether the rule "rule" matches depends only on things
+ * that are part of the cache key, false otherwise.
+ */
+
 
 rule_t *
 addclientrule(newrule)
@@ -640,10 +870,14 @@ rulespermit(s, peer, local, clientauth, srcauth, match, state,
    const char *function = "rulespermit()";
    static int init;
    static rule_t defrule;
-   rule_t *rule;
+   rule_t *rule, **candidatev, *cachedv[1];
+   rulecacheentry_t *cached;
+   rulecachekey_t cachekey;
    objecttype_t ruletype;
    authmethod_t oldauth;
    sockshost_t dstmatched_mem;
+   size_t candidatec, candidatei;
+   int iscacheable;
 #if HAVE_LIBWRAP
    struct request_info libwraprequest;
    struct sockaddr_storage _local, _peer;
@@ -810,12 +1044,58 @@ rulespermit(s, peer, local, clientauth, srcauth, match, state,
    else
       isreplycommand = 0;
 
+   /*
+    * If we have made the decision for an identical request before, only
+    * the rule matched then needs checking, which we still need to do
+    * for the side effects of matching.  Otherwise, if there are many rules,
+    * only check those that the rule index says can match on address.
+    * They are returned in rule order, so the first matching one is still
+    * the one that applies.
+    */
+   iscacheable = rulecache_makekey(ruletype,
+                                   rule,
+                                   state,
+                                   clientauth,
+                                   srcauth,
+                                   src,
+                                   dst,
+                                   &cachekey);
+
+   if (iscacheable && (cached = rulecache_lookup(&cachekey)) != NULL) {
+      ++rulecache.hits;
+
+      slog(LOG_DEBUG, "%s: cached decision: %s",
+           function,
+           cached->rule == NULL ? "no rule matches" : "rule matches");
+
+      cachedv[0]  = cached->rule;
+      candidatev  = cachedv;
+      candidatec  = cached->rule == NULL ? 0 : 1;
+      iscacheable = 0;
+   }
+   else {
+      if (iscacheable)
+         ++rulecache.misses;
+      else
+         ++rulecache.bypassed;
+
+      candidatev = rulecandidates(ruletype, rule, src, dst, &candidatec);
+   }
+
+   if (candidatev != NULL)
+      rule = candidatec > 0 ? candidatev[0] : NULL;
+
+   candidatei = 0;
+
    /*
     * let srcauth be unchanged from original unless we actually get a match.
     */
    for (oldauth = *srcauth;
    rule != NULL;
-   rule = rule->next, *srcauth = oldauth) {
+   rule = candidatev == NULL ?
+            rule->next
+          : (++candidatei < candidatec ? candidatev[candidatei] : NULL),
+   *srcauth = oldauth) {
       size_t methodc;
       int *methodv;
       size_t i;
@@ -827,6 +1107,9 @@ rulespermit(s, peer, local, clientauth, srcauth, match, state,
            (unsigned long)rule->number,
            verdict2string(rule->verdict));
 
+      if (iscacheable && !rule_iscacheable(rule))
+         iscacheable = 0;
+
       if (!protocol_matches(state->protocol, &rule->state.protocol))
          continue;
 
@@ -1456,6 +1739,12 @@ rulespermit(s, peer, local, clientauth, srcauth, match, state,
       break;
    }
 
+   /*
+    * Only cache decisions that did not need any credentials checked.
+    */
+   if (iscacheable && (rule == NULL || srcauth->method == AUTHMETHOD_NONE))
+      rulecache_add(&cachekey, rule);
+
    if (rule == NULL) {
       char buf[1024];
 
@@ -3251,3 +3540,657 @@ hostidmatches(hostidc, hostidv, hostindex, addr, ruletype, number)
    }
 }
 #endif /* HAVE_SOCKS_HOSTID */
+
+void
+ruleindex_free(void)
+{
+   ruleindex_t *indexv[] = { &cruleindex, &hruleindex, &sruleindex };
+   size_t i;
+
+   for (i = 0; i < ELEMENTS(indexv); ++i) {
+      ruleindex_freeaddr(&indexv[i]->src);
+      ruleindex_freeaddr(&indexv[i]->dst);
+
+      free(indexv[i]->rulev);
+      free(indexv[i]->positionv);
+      free(indexv[i]->candidatev);
+
+      bzero(indexv[i], sizeof(*indexv[i]));
+   }
+
+   /*
+    * The decisions cached were made by the rules being freed.
+    */
+   bzero(rulecache.entryv, sizeof(rulecache.entryv));
+   bzero(rulecache.bucketv, sizeof(rulecache.bucketv));
+   rulecache.entryc  = 0;
+   rulecache.lruhead = rulecache.lrutail = 0;
+}
+
+static ruleindex_t *
+ruleindex_get(ruletype, rulebase)
+   const objecttype_t ruletype;
+   rule_t *rulebase;
+{
+   ruleindex_t *index;
+
+   switch (ruletype) {
+      case object_crule:
+         index = &cruleindex;
+         break;
+
+#if HAVE_SOCKS_HOSTID
+      case object_hrule:
+         index = &hruleindex;
+         break;
+#endif /* HAVE_SOCKS_HOSTID */
+
+      case object_srule:
+         index = &sruleindex;
+         break;
+
+      default:
+         SERRX(ruletype);
+   }
+
+   if (!index->isbuilt || index->rulebase != rulebase) {
+      if (index->isbuilt) /* should not happen; resetconfig() frees it. */
+         ruleindex_free();
+
+      ruleindex_build(index, rulebase);
+   }
+
+   return index;
+}
+
+static void
+ruleindex_build(index, rulebase)
+   ruleindex_t *index;
+   rule_t *rulebase;
+{
+   const char *function = "ruleindex_build()";
+   rule_t *rule;
+   size_t i;
+
+   bzero(index, sizeof(*index));
+   index->rulebase = rulebase;
+   index->isbuilt  = 1;
+
+   for (rule = rulebase; rule != NULL; rule = rule->next) {
+      if (rule->src.operator != none)
+         index->srcportmatters = 1;
+
+      ++index->rulec;
+   }
+
+   if (index->rulec < SOCKD_RULEINDEX_MINRULES) {
+      slog(LOG_DEBUG, "%s: only %lu rules, not building any index",
+           function, (unsigned long)index->rulec);
+
+      return;
+   }
+
+   if ((index->rulev      = malloc(sizeof(*index->rulev) * index->rulec))
+   == NULL
+   ||  (index->positionv  = malloc(sizeof(*index->positionv) * index->rulec))
+   == NULL
+   ||  (index->candidatev = malloc(sizeof(*index->candidatev) * index->rulec))
+   == NULL) {
+      swarn("%s: could not allocate memory for index over %lu rules",
+            function, (unsigned long)index->rulec);
+
+      free(index->rulev);
+      free(index->positionv);
+      free(index->candidatev);
+
+      index->rulev      = NULL;
+      index->positionv  = NULL;
+      index->candidatev = NULL;
+
+      return;
+   }
+
+   for (rule = rulebase, i = 0; rule != NULL; rule = rule->next, ++i) {
+      index->rulev[i] = rule;
+
+      ruleindex_addrule(&index->src, &rule->src, i);
+      ruleindex_addrule(&index->dst, &rule->dst, i);
+   }
+
+   index->useindex = 1;
+
+   slog(LOG_DEBUG, "%s: built index over %lu rules, %lu/%lu not indexable "
+                   "on src/dst",
+                   function,
+                   (unsigned long)index->rulec,
+                   (unsigned long)index->src.anyc,
+                   (unsigned long)index->dst.anyc);
+}
+
+static void
+ruleindex_addrule(index, ruleaddr, position)
+   ruleindexaddr_t *index;
+   const ruleaddr_t *ruleaddr;
+   const size_t position;
+{
+   const char *function = "ruleindex_addrule()";
+   const unsigned char *bytes;
+   ruleindexnode_t *node;
+   size_t bits, i, **rulev, *rulec;
+
+   switch (ruleaddr->atype) {
+      case SOCKS_ADDR_IPV4: {
+         const uint32_t mask = ntohl(ruleaddr->addr.ipv4.mask.s_addr);
+
+         for (bits = 0; bits < 32 && (mask & (1U << (31 - bits))); ++bits)
+            ;
+
+         if (bits < 32 && (mask & (0xffffffffU >> bits)) != 0)
+            node = NULL; /* not a contiguous netmask; can't index. */
+         else
+            node = &index->ipv4;
+
+         bytes = (const unsigned char *)&ruleaddr->addr.ipv4.ip;
+         break;
+      }
+
+      case SOCKS_ADDR_IPV6:
+         bits  = ruleaddr->addr.ipv6.maskbits;
+         bytes = ruleaddr->addr.ipv6.ip.s6_addr;
+         node  = &index->ipv6;
+         break;
+
+      default:
+         bits = 0;
+         node = NULL;
+   }
+
+   for (i = 0; node != NULL && i < bits; ++i) {
+      const int bit
+      = (bytes[i / CHAR_BIT] >> (CHAR_BIT - 1 - i % CHAR_BIT)) & 1;
+
+      if (node->child[bit] == NULL
+      &&  (node->child[bit] = calloc(1, sizeof(*node->child[bit]))) == NULL)
+         serr("%s: could not allocate memory for rule index", function);
+
+      node = node->child[bit];
+   }
+
+   if (node == NULL) {
+      rulev = &index->anyv;
+      rulec = &index->anyc;
+   }
+   else {
+      rulev = &node->rulev;
+      rulec = &node->rulec;
+   }
+
+   if ((*rulev = realloc(*rulev, sizeof(**rulev) * (*rulec + 1))) == NULL)
+      serr("%s: could not allocate memory for rule index", function);
+
+   (*rulev)[(*rulec)++] = position;
+}
+
+static void
+ruleindex_freeaddr(index)
+   ruleindexaddr_t *index;
+{
+
+   ruleindex_freenode(&index->ipv4);
+   ruleindex_freenode(&index->ipv6);
+
+   free(index->anyv);
+   bzero(index, sizeof(*index));
+}
+
+static void
+ruleindex_freenode(node)
+   ruleindexnode_t *node;
+{
+   size_t i;
+
+   for (i = 0; i < ELEMENTS(node->child); ++i) {
+      if (node->child[i] == NULL)
+         continue;
+
+      ruleindex_freenode(node->child[i]);
+      free(node->child[i]);
+   }
+
+   free(node->rulev);
+}
+
+static const ruleindexnode_t *
+ruleindex_root(index, host, bytes, bits)
+   const ruleindexaddr_t *index;
+   const sockshost_t *host;
+   const unsigned char **bytes;
+   size_t *bits;
+{
+
+   switch (host->atype) {
+      case SOCKS_ADDR_IPV4:
+         *bytes = (const unsigned char *)&host->addr.ipv4;
+         *bits  = sizeof(host->addr.ipv4) * CHAR_BIT;
+         return &index->ipv4;
+
+      case SOCKS_ADDR_IPV6:
+         *bytes = host->addr.ipv6.ip.s6_addr;
+         *bits  = sizeof(host->addr.ipv6.ip) * CHAR_BIT;
+         return &index->ipv6;
+
+      default:
+         /*
+          * E.g., a hostname, which might resolve to anything the rules
+          * have.
+          */
+         return NULL;
+   }
+}
+
+static size_t
+ruleindex_count(index, host)
+   const ruleindexaddr_t *index;
+   const sockshost_t *host;
+{
+   const ruleindexnode_t *node;
+   const unsigned char *bytes;
+   size_t bits, count, i;
+
+   if ((node = ruleindex_root(index, host, &bytes, &bits)) == NULL)
+      return (size_t)-1;
+
+   count = index->anyc;
+   for (i = 0; node != NULL; ++i) {
+      count += node->rulec;
+
+      if (i == bits)
+         break;
+
+      node
+      = node->child[(bytes[i / CHAR_BIT] >> (CHAR_BIT - 1 - i % CHAR_BIT)) & 1];
+   }
+
+   return count;
+}
+
+static size_t
+ruleindex_lookup(index, host, positionv)
+   const ruleindexaddr_t *index;
+   const sockshost_t *host;
+   size_t *positionv;
+{
+   const ruleindexnode_t *node;
+   const unsigned char *bytes;
+   size_t bits, positionc, i;
+
+   node = ruleindex_root(index, host, &bytes, &bits);
+   SASSERTX(node != NULL);
+
+   memcpy(positionv, index->anyv, sizeof(*positionv) * index->anyc);
+   positionc = index->anyc;
+
+   for (i = 0; node != NULL; ++i) {
+      memcpy(&positionv[positionc],
+             node->rulev,
+             sizeof(*positionv) * node->rulec);
+      positionc += node->rulec;
+
+      if (i == bits)
+         break;
+
+      node
+      = node->child[(bytes[i / CHAR_BIT] >> (CHAR_BIT - 1 - i % CHAR_BIT)) & 1];
+   }
+
+   return positionc;
+}
+
+static rule_t **
+rulecandidates(ruletype, rulebase, src, dst, candidatec)
+   const objecttype_t ruletype;
+   rule_t *rulebase;
+   const sockshost_t *src;
+   const sockshost_t *dst;
+   size_t *candidatec;
+{
+   const char *function = "rulecandidates()";
+   const ruleindexaddr_t *lookup;
+   const sockshost_t *lookuphost;
+   ruleindex_t *index;
+   size_t srcc, dstc, i;
+
+   if (rulebase == NULL)
+      return NULL;
+
+   index = ruleindex_get(ruletype, rulebase);
+   if (!index->useindex)
+      return NULL;
+
+   /*
+    * hostid-rules match src against the hostids rather than the src
+    * address, so can't use the src index for them.
+    */
+   if (src == NULL || ruletype == object_hrule)
+      srcc = (size_t)-1;
+   else
+      srcc = ruleindex_count(&index->src, src);
+
+   if (dst == NULL)
+      dstc = (size_t)-1;
+   else
+      dstc = ruleindex_count(&index->dst, dst);
+
+   /*
+    * Use whichever of src and dst narrows it down the most.  The
+    * other address will be checked against each candidate as usual.
+    */
+   if (srcc == (size_t)-1 && dstc == (size_t)-1)
+      return NULL;
+
+   if (srcc <= dstc) {
+      lookup     = &index->src;
+      lookuphost = src;
+   }
+   else {
+      lookup     = &index->dst;
+      lookuphost = dst;
+   }
+
+   *candidatec = ruleindex_lookup(lookup, lookuphost, index->positionv);
+   SASSERTX(*candidatec == MIN(srcc, dstc));
+
+   qsort(index->positionv,
+         *candidatec,
+         sizeof(*index->positionv),
+         positioncmp);
+
+   for (i = 0; i < *candidatec; ++i)
+      index->candidatev[i] = index->rulev[index->positionv[i]];
+
+   slog(LOG_DEBUG, "%s: %lu/%lu %ss can match based on %s address %s",
+        function,
+        (unsigned long)*candidatec,
+        (unsigned long)index->rulec,
+        objecttype2string(ruletype),
+        lookup == &index->src ? "src" : "dst",
+        sockshost2string(lookuphost, NULL, 0));
+
+   return index->candidatev;
+}
+
+static int
+positioncmp(a, b)
+   const void *a;
+   const void *b;
+{
+   const size_t pa = *(const size_t *)a, pb = *(const size_t *)b;
+
+   return pa < pb ? -1 : pa > pb;
+}
+
+void
+log_rulecachestats(void)
+{
+
+   slog(LOG_INFO, "rule cache: %lu/%lu entries used, %lu hit%s, %lu miss%s, "
+                  "%lu not cacheable",
+                  (unsigned long)rulecache.entryc,
+                  (unsigned long)ELEMENTS(rulecache.entryv),
+                  rulecache.hits,
+                  rulecache.hits == 1 ? "" : "s",
+                  rulecache.misses,
+                  rulecache.misses == 1 ? "" : "es",
+                  rulecache.bypassed);
+}
+
+static int
+rulecache_makekey(ruletype, rulebase, state, clientauth, srcauth, src, dst,
+                  key)
+   const objecttype_t ruletype;
+   rule_t *rulebase;
+   const connectionstate_t *state;
+   const authmethod_t *clientauth;
+   const authmethod_t *srcauth;
+   const sockshost_t *src;
+   const sockshost_t *dst;
+   rulecachekey_t *key;
+{
+   const ruleindex_t *index;
+
+   /*
+    * hostid-rules match on the hostids set on the connection, not on
+    * the address.
+    */
+   if (ruletype == object_hrule || rulebase == NULL)
+      return 0;
+
+   if (src == NULL || dst == NULL)
+      return 0;
+
+   index = ruleindex_get(ruletype, rulebase);
+
+   bzero(key, sizeof(*key)); /* key is compared and hashed bytewise. */
+
+   /*
+    * The src port is usually an ephemeral port, different for each
+    * request, so leave it out unless some rule cares about it.
+    */
+   if (!rulecache_makehost(src, index->srcportmatters, &key->src)
+   ||  !rulecache_makehost(dst, 1, &key->dst))
+      return 0;
+
+   key->ruletype      = ruletype;
+   key->command       = state->command;
+   key->protocol      = state->protocol;
+   key->proxyprotocol = state->proxyprotocol;
+   key->clientmethod  = clientauth == NULL ?
+                              AUTHMETHOD_NOTSET : clientauth->method;
+   key->srcmethod     = srcauth->method;
+
+   return 1;
+}
+
+static int
+rulecache_makehost(host, withport, cachehost)
+   const sockshost_t *host;
+   const int withport;
+   rulecachehost_t *cachehost;
+{
+
+   switch (host->atype) {
+      case SOCKS_ADDR_IPV4:
+         cachehost->addr.ipv4 = host->addr.ipv4;
+         break;
+
+      case SOCKS_ADDR_IPV6:
+         cachehost->addr.ipv6 = host->addr.ipv6.ip;
+         cachehost->scopeid   = host->addr.ipv6.scopeid;
+         break;
+
+      default:
+         return 0;
+   }
+
+   cachehost->atype = host->atype;
+
+   if (withport)
+      cachehost->port = host->port;
+
+   return 1;
+}
+
+static rulecacheentry_t *
+rulecache_lookup(key)
+   const rulecachekey_t *key;
+{
+   size_t id;
+
+   for (id = rulecache.bucketv[rulecache_bucket(key)];
+   id != 0;
+   id = rulecache.entryv[id - 1].hashnext) {
+      if (memcmp(&rulecache.entryv[id - 1].key, key, sizeof(*key)) == 0) {
+         rulecache_unlink(id);
+         rulecache_pushfront(id);
+
+         return &rulecache.entryv[id - 1];
+      }
+   }
+
+   return NULL;
+}
+
+static void
+rulecache_add(key, rule)
+   const rulecachekey_t *key;
+   rule_t *rule;
+{
+   rulecacheentry_t *entry;
+   size_t id, *bucket;
+
+   if (rulecache.entryc < ELEMENTS(rulecache.entryv))
+      id = ++rulecache.entryc;
+   else {
+      /*
+       * Full.  Reuse the least recently used entry, first removing it
+       * from its hash chain.
+       */
+      id = rulecache.lrutail;
+      SASSERTX(id != 0);
+
+      bucket = &rulecache.bucketv[rulecache_bucket(&rulecache.entryv[id - 1]
+                                                                  .key)];
+      while (*bucket != id)
+         bucket = &rulecache.entryv[*bucket - 1].hashnext;
+
+      *bucket = rulecache.entryv[id - 1].hashnext;
+
+      rulecache_unlink(id);
+   }
+
+   entry       = &rulecache.entryv[id - 1];
+   entry->key  = *key;
+   entry->rule = rule;
+
+   bucket          = &rulecache.bucketv[rulecache_bucket(key)];
+   entry->hashnext = *bucket;
+   *bucket         = id;
+
+   rulecache_pushfront(id);
+}
+
+static void
+rulecache_unlink(id)
+   const size_t id;
+{
+   rulecacheentry_t *entry = &rulecache.entryv[id - 1];
+
+   if (entry->lruprev == 0)
+      rulecache.lruhead = entry->lrunext;
+   else
+      rulecache.entryv[entry->lruprev - 1].lrunext = entry->lrunext;
+
+   if (entry->lrunext == 0)
+      rulecache.lrutail = entry->lruprev;
+   else
+      rulecache.entryv[entry->lrunext - 1].lruprev = entry->lruprev;
+
+   entry->lruprev = entry->lrunext = 0;
+}
+
+static void
+rulecache_pushfront(id)
+   const size_t id;
+{
+   rulecacheentry_t *entry = &rulecache.entryv[id - 1];
+
+   entry->lruprev = 0;
+   entry->lrunext = rulecache.lruhead;
+
+   if (rulecache.lruhead != 0)
+      rulecache.entryv[rulecache.lruhead - 1].lruprev = id;
+
+   rulecache.lruhead = id;
+
+   if (rulecache.lrutail == 0)
+      rulecache.lrutail = id;
+}
+
+static size_t
+rulecache_bucket(key)
+   const rulecachekey_t *key;
+{
+   const unsigned char *p = (const unsigned char *)key;
+   size_t i, hash;
+
+   /* FNV-1a. */
+   hash = (size_t)2166136261UL;
+   for (i = 0; i < sizeof(*key); ++i) {
+      hash ^= p[i];
+      hash *= (size_t)16777619UL;
+   }
+
+   return hash % ELEMENTS(rulecache.bucketv);
+}
+
+static int
+rule_iscacheable(rule)
+   const rule_t *rule;
+{
+   const ruleaddr_t *addrv[] = { &rule->src, &rule->dst };
+   const int *methodv[]      = { rule->state.cmethodv, rule->state.smethodv };
+   const size_t methodc[]    = { rule->state.cmethodc, rule->state.smethodc };
+   size_t i, j;
+
+   /*
+    * Matching on user or group requires checking the credentials,
+    * each time.
+    */
+   if (rule->user != NULL || rule->group != NULL)
+      return 0;
+
+#if HAVE_LDAP
+   if (rule->ldapgroup != NULL)
+      return 0;
+#endif /* HAVE_LDAP */
+
+#if HAVE_SOCKS_HOSTID
+   if (rule->hostid.atype != SOCKS_ADDR_NOTSET)
+      return 0;
+#endif /* HAVE_SOCKS_HOSTID */
+
+   /*
+    * Hostnames and interfaces are resolved when matching, and the
+    * result may change.
+    */
+   for (i = 0; i < ELEMENTS(addrv); ++i) {
+      switch (addrv[i]->atype) {
+         case SOCKS_ADDR_IPV4:
+         case SOCKS_ADDR_IPV6:
+         case SOCKS_ADDR_IPVANY:
+            break;
+
+         default:
+            return 0;
+      }
+   }
+
+   /*
+    * Methods other than these may involve external lookups (ident, PAM,
+    * etc.) to see if the rule matches.
+    */
+   for (i = 0; i < ELEMENTS(methodv); ++i) {
+      for (j = 0; j < methodc[i]; ++j) {
+         switch (methodv[i][j]) {
+            case AUTHMETHOD_NONE:
+            case AUTHMETHOD_UNAME:
+               break;
+
+            default:
+               return 0;
+         }
+      }
+   }
+
+   return 1;
+}
@@ -555,6 +555,9 @@ resetconfig(config, exiting)
    /* can always be changed from config. */
    bzero(&config->cpu, sizeof(config->cpu));
 
+   /* index refers to the rules we are about to free. */
+   ruleindex_free();
+
    for (i = 0; i < ELEMENTS(rulev); ++i) {
       rule_t *rule, prevrule, *next;
       int haveprevrule;
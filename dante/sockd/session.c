@@ -139,6 +139,43 @@ session_use(shmem, cinfo, lock, emsg, emsglen)
       }
 #endif /* HAVE_SOCKS_HOSTID */
 
+   if (HAVE_SHMEM_ATOMICS
+   &&  shmem->keystate.key == key_unset
+   &&  !ss->throttle_isset) {
+      /*
+       * Only a limit on the total number of sessions.  Reserve one
+       * without taking the lock, if any are left.
+       */
+      size_t clients = SHMEM_ATOMIC_LOAD(&shmem->mstate.clients);
+
+      SASSERTX(ss->max_isset);
+
+      MUNPROTECT_SHMEMHEADER(shmem);
+
+      do {
+         if (clients >= ss->max)
+            break;
+      } while (!SHMEM_ATOMIC_CAS(&shmem->mstate.clients,
+                                 &clients,
+                                 clients + 1));
+
+      MPROTECT_SHMEMHEADER(shmem);
+
+      if (clients >= ss->max) {
+         if (emsglen > 0)
+            sessionlimitstring(clients, ss->max, emsg, emsglen);
+
+         slog(LOG_DEBUG, "%s: sessionlimit reached for shmid %lu: %s",
+              function,
+              (unsigned long)shmem->mstate.shmid,
+              emsglen > 0 ? emsg : "");
+
+         return 0;
+      }
+
+      return 1;
+   }
+
    socks_lock(lock, (off_t)shmem->mstate.shmid, 1, 1, 1);
 
    if (shmem->keystate.key == key_unset)
@@ -269,6 +306,7 @@ session_unuse(ss, cinfo, lock)
 #if DEBUG /* memory-mapped file contents may not be saved in coredumps. */
    shmem_object_t _shmem = *ss;
 #endif /* DEBUG */
+   int dolock;
 
    SASSERTX(ss != NULL);
 
@@ -279,7 +317,12 @@ session_unuse(ss, cinfo, lock)
                    clientinfo2string(cinfo, NULL, 0),
                    lock);
 
-   socks_lock(lock, (off_t)ss->mstate.shmid, 1, 1, 1);
+   if (HAVE_SHMEM_ATOMICS && ss->keystate.key == key_unset)
+      dolock = -1; /* only the client count changes. */
+   else
+      dolock = lock;
+
+   socks_lock(dolock, (off_t)ss->mstate.shmid, 1, 1, 1);
 
    shmem_unuse(ss, cinfo, -1);
 
@@ -291,7 +334,7 @@ session_unuse(ss, cinfo, lock)
                       session_isavailable(ss, cinfo, -1, 0, NULL, 0) ?
                            "yes" : "no");
 
-   socks_unlock(lock, (off_t)ss->mstate.shmid, 1);
+   socks_unlock(dolock, (off_t)ss->mstate.shmid, 1);
 }
 
 static int
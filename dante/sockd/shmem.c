@@ -50,6 +50,9 @@ static const char rcsid[] =
 
 #define FIRST_SHMEMID  (0)
 
+#define KEYSTATE_MINSIZE    (16) /* initial number of slots in keyv.      */
+#define KEYSTATE_EXPIRESTEP (8)  /* keyv slots to check for expiry a time. */
+
 typedef enum { keytype_ipv4 = 1, keytype_ipv6 } keystate_data_type;
 
 typedef struct {
@@ -103,20 +106,45 @@ keystate_clientcount(const keystate_t *keystate, const size_t index);
  * Returns the current clientcount for the keystate entry with index "index".
  */
 
-static ssize_t
-keystate_timer(const shmem_object_t *shmem);
+static keystate_data_t *
+cinfo2keydata(const keystate_t *keystate, const clientinfo_t *cinfo,
+              keystate_data_t *keydata);
 /*
- * is there a relevant timer we can use for calculating how often to
- * scan for old keystate entries to expire and remove in "shmem"?
+ * Stores the data from "cinfo" corresponding to the key set in "keystate"
+ * in "keydata".
  *
- * Returns the timer as number of seconds if so, or -1 if not.
+ * Returns a pointer to keydata.
+ */
+
+static size_t
+keystate_hash(const keystate_data_t *keydata);
+/*
+ * Returns a hash value for the keystate data "keydata".
+ */
+
+static size_t
+keystate_slot(const keystate_t *keystate, const keystate_data_t *keydata);
+/*
+ * Returns the index of the slot in keystate's keyv holding "keydata",
+ * or, if there is no such slot, the index of the free slot where keydata
+ * should be inserted.
  */
 
 static int
-should_do_expirescan(const shmem_object_t *shmem);
+keystate_grow(shmem_object_t *shmem, size_t *sizemapped);
+/*
+ * Doubles the number of slots in shmem's keyv, rehashing the entries
+ * already there.  "sizemapped" is the size currently mapped, and is
+ * updated to the size of the new mapping.
+ *
+ * Returns 0 on success, -1 on failure.
+ */
+
+static void
+keystate_expirescan(shmem_object_t *shmem, const struct timeval *timenow);
 /*
- * Should we do a scan for old keyentries in shmem at this time?
- * Returns true if so, false otherwise.
+ * Checks the next KEYSTATE_EXPIRESTEP slots in shmem's keyv, removing
+ * entries that have expired and are no longer in use.
  */
 
 void
@@ -175,11 +203,6 @@ shmem_setup(void)
       serr("%s: socks_mklock() failed to create shmemfile using base %s",
            function, SOCKD_SHMEMFILE);
 
-   /*
-    * Hostcache also uses shmem, but has it's own area.
-    */
-   hostcachesetup();
-
 #if HAVE_LDAP
    /*
     * And so does the LDAP module.
@@ -433,6 +456,7 @@ shmem_use(shmem, cinfo, lock, mapisopen)
    shmem_object_t _shmem = *shmem;
 #endif /* DEBUG */
    ssize_t statecount = -1;
+   int dolock;
 
    SASSERTX(shmem != NULL);
    SASSERTX(shmem->mstate.number > 0);
@@ -463,11 +487,20 @@ shmem_use(shmem, cinfo, lock, mapisopen)
          SERRX(shmem->type);
    }
 
-   socks_lock(lock, (off_t)shmem->mstate.shmid, 1, 1, 1);
+   /*
+    * Unless we need to update the keystate, only the client count
+    * changes, and that we can do without the lock.
+    */
+   if (HAVE_SHMEM_ATOMICS && shmem->keystate.key == key_unset)
+      dolock = -1;
+   else
+      dolock = lock;
+
+   socks_lock(dolock, (off_t)shmem->mstate.shmid, 1, 1, 1);
 
    MUNPROTECT_SHMEMHEADER(shmem);
 
-   ++shmem->mstate.clients;
+   SHMEM_ATOMIC_ADD(&shmem->mstate.clients, 1);
 
    MPROTECT_SHMEMHEADER(shmem);
    if (shmem->keystate.key != key_unset) {
@@ -485,7 +518,7 @@ shmem_use(shmem, cinfo, lock, mapisopen)
          MPROTECT_SHMEMHEADER(shmem);
 
          if (rc != 0) {
-            socks_unlock(lock, (off_t)shmem->mstate.shmid, 1);
+            socks_unlock(dolock, (off_t)shmem->mstate.shmid, 1);
 
             slog(LOG_DEBUG, "%s: keystate_openmap() of shmid %lu failed: %s",
                  function, (unsigned long)shmem->mstate.shmid, strerror(errno));
@@ -496,28 +529,21 @@ shmem_use(shmem, cinfo, lock, mapisopen)
       /*
        * increment the current count for address, or add an entry for the addr.
        */
-      if ((i = keystate_index(shmem, cinfo, should_do_expirescan(shmem))) >= 0)
+      if ((i = keystate_index(shmem, cinfo, 1)) >= 0)
          slog(LOG_DEBUG, "%s: entry exists at index #%lu",
               function, (unsigned long)i);
       else {
          /*
-          * a bit more complex.  Need to expand the array and add the new
-          * entry; remap with a larger size first.
+          * a bit more complex.  Need to add a new entry, first growing
+          * the table if it would otherwise become more than half full.
           */
-         const char *fname = sockd_getshmemname(shmem->mstate.shmid,
-                                                shmem->keystate.key);
-         void *newmap;
-         int fd;
-
-         slog(LOG_DEBUG,
-              "%s: need to expand keyv array to %lu entries for cinfo %s",
-              function,
-              (unsigned long)shmem->keystate.keyc + 1,
-              clientinfo2string(cinfo, NULL, 0));
+         keystate_data_t keydata;
 
-         if ((fd = open(fname, O_RDWR)) == -1) {
-            swarn("%s: could not open shmemfile %s", function, fname);
+         if (mapisopen)
+            sizemapped = shmem->keystate.keyc * sizeof(*shmem->keystate.keyv);
 
+         if ((shmem->keystate.keyinuse + 1) * 2 > shmem->keystate.keyc
+         &&  keystate_grow(shmem, &sizemapped) != 0) {
             if (doclosemap) {
                MUNPROTECT_SHMEMHEADER(shmem);
 
@@ -529,43 +555,26 @@ shmem_use(shmem, cinfo, lock, mapisopen)
                MPROTECT_SHMEMHEADER(shmem);
             }
 
-            socks_unlock(lock, (off_t)shmem->mstate.shmid, 1);
-
-            return -1;
-         }
-
-         sizemapped
-         = (shmem->keystate.keyc + 1) * sizeof(*shmem->keystate.keyv);
-
-         MUNPROTECT_SHMEMHEADER(shmem);
-
-         newmap = sockd_mmap(shmem->keystate.keyv,
-                             sizemapped,
-                             PROT_READ | PROT_WRITE,
-                             MAP_SHARED,
-                             fd,
-                             1);
-
-         MPROTECT_SHMEMHEADER(shmem);
-
-         close(fd);
-
-         if (newmap == MAP_FAILED) {
-            swarn("%s: failed to mmap(2) shmeminfo of size %lu from "
-                  "file %s on fd %d",
-                  function, (unsigned long)sizemapped, fname, fd);
+            socks_unlock(dolock, (off_t)shmem->mstate.shmid, 1);
 
-            socks_unlock(lock, (off_t)shmem->mstate.shmid, 1);
             return -1;
          }
 
-         shmem->keystate.keyv = newmap;
+         i = (ssize_t)keystate_slot(&shmem->keystate,
+                                    cinfo2keydata(&shmem->keystate,
+                                                  cinfo,
+                                                  &keydata));
 
-         i = shmem->keystate.keyc;
+         slog(LOG_DEBUG, "%s: adding entry for cinfo %s at index #%lu",
+              function,
+              clientinfo2string(cinfo, NULL, 0),
+              (unsigned long)i);
 
          MUNPROTECT_SHMEMHEADER(shmem);
 
-         ++shmem->keystate.keyc;
+         SASSERTX(!shmem->keystate.keyv[i].inuse);
+         shmem->keystate.keyv[i].inuse = 1;
+         ++shmem->keystate.keyinuse;
 
          MPROTECT_SHMEMHEADER(shmem);
       }
@@ -649,7 +658,7 @@ shmem_use(shmem, cinfo, lock, mapisopen)
            shmem->mstate.shmid,
            clientinfo2string(cinfo, NULL, 0));
 
-   socks_unlock(lock, (off_t)shmem->mstate.shmid, 1);
+   socks_unlock(dolock, (off_t)shmem->mstate.shmid, 1);
    return 0;
 }
 
@@ -664,6 +673,7 @@ shmem_unuse(shmem, cinfo, lock)
    shmem_object_t _shmem = *shmem;
 #endif /* DEBUG */
    ssize_t statecount = -1;
+   int dolock;
 
    SASSERTX(shmem != NULL);
    SASSERTX(shmem->mstate.number > 0);
@@ -690,7 +700,16 @@ shmem_unuse(shmem, cinfo, lock)
          SERRX(shmem->type);
    }
 
-   socks_lock(lock, (off_t)shmem->mstate.shmid, 1, 1, 1);
+   /*
+    * Unless we need to update the keystate, only the client count
+    * changes, and that we can do without the lock.
+    */
+   if (HAVE_SHMEM_ATOMICS && shmem->keystate.key == key_unset)
+      dolock = -1;
+   else
+      dolock = lock;
+
+   socks_lock(dolock, (off_t)shmem->mstate.shmid, 1, 1, 1);
 
    if (shmem->keystate.key != key_unset) {
 #if DEBUG /* memory-mapped file contents may not be saved in coredumps. */
@@ -710,7 +729,7 @@ shmem_unuse(shmem, cinfo, lock)
       MPROTECT_SHMEMHEADER(shmem);
 
       if (rc != 0) {
-         socks_unlock(lock, (off_t)shmem->mstate.shmid, 1);
+         socks_unlock(dolock, (off_t)shmem->mstate.shmid, 1);
 
          slog(LOG_DEBUG, "%s: keystate_openmap() of shmid %lu failed: %s",
               function, (unsigned long)shmem->mstate.shmid, strerror(errno));
@@ -726,7 +745,7 @@ shmem_unuse(shmem, cinfo, lock)
       SASSERTX(shmem->keystate.keyv != NULL);
       SASSERTX(shmem->keystate.keyc > 0);
 
-      i = keystate_index(shmem, cinfo, should_do_expirescan(shmem));
+      i = keystate_index(shmem, cinfo, 1);
       SASSERTX(i >= 0);
       SASSERTX((size_t)i < shmem->keystate.keyc);
 
@@ -751,6 +770,16 @@ shmem_unuse(shmem, cinfo, lock)
             SERRX(shmem->keystate.key);
       }
 
+      /*
+       * Unless there is a per-state throttle that needs to remember
+       * this entry until it expires, it can go now.
+       */
+      if (statecount == 0
+      && !(shmem->type == SHMEM_SS && shmem->object.ss.throttle_perstate_isset)) {
+         keystate_removeindex(&shmem->keystate, (size_t)i);
+         i = -1;
+      }
+
       keystate_closemap(shmem->mstate.shmid, &shmem->keystate, sizemapped, i);
 
       MPROTECT_SHMEMHEADER(shmem);
@@ -758,8 +787,8 @@ shmem_unuse(shmem, cinfo, lock)
 
    MUNPROTECT_SHMEMHEADER(shmem);
 
-   SASSERTX(shmem->mstate.clients > 0);
-   --shmem->mstate.clients;
+   SASSERTX(SHMEM_ATOMIC_LOAD(&shmem->mstate.clients) > 0);
+   SHMEM_ATOMIC_SUB(&shmem->mstate.clients, 1);
 
    MPROTECT_SHMEMHEADER(shmem);
 
@@ -775,7 +804,7 @@ shmem_unuse(shmem, cinfo, lock)
            shmem->mstate.shmid,
            clientinfo2string(cinfo, NULL, 0));
 
-   socks_unlock(lock, (off_t)shmem->mstate.shmid, 1);
+   socks_unlock(dolock, (off_t)shmem->mstate.shmid, 1);
    return 0;
 }
 
@@ -1016,291 +1045,309 @@ do {                                                                           \
 static void
 keystate_removeindex(keystate, index)
    keystate_t *keystate;
-   const size_t index;
+   size_t index;
 {
    const char *function = "keystate_removeindex()";
-   sa_family_t safamily;
-   void *addr;
-
-   switch (keystate->key) {
-      case key_from:
-         switch (keystate->keyv[index].data.from.safamily) {
-            case AF_INET:
-               safamily = AF_INET;
-               addr     = &keystate->keyv[index].data.from.addr.ipv4;
-               break;
-
-            case AF_INET6:
-               safamily = AF_INET6;
-               addr     = &keystate->keyv[index].data.from.addr.ipv6;
-               break;
-
-            default:
-               SERRX(keystate->keyv[index].data.from.safamily);
-         }
-
-         break;
-
-
-#if HAVE_SOCKS_HOSTID
-      case key_hostid:
-         safamily = AF_INET6;
-         addr     = &keystate->keyv[index].data.hostid.ipv4;
-         break;
-#endif /* HAVE_SOCKS_HOSTID */
-
-      default:
-         SERRX(keystate->key);
-   }
-
-   if (sockscf.option.debug) {
-      char ntop[MAXSOCKADDRSTRING];
+   const size_t mask = keystate->keyc - 1;
+   keystate_data_t keydata;
+   size_t i;
 
-      if (inet_ntop(safamily, addr, ntop, sizeof(ntop)) == NULL) {
-         swarn("%s: inet_ntop(3) failed on safamily %s, addr %s",
-              function,
-              safamily2string(safamily),
-              addr2hexstring(addr, safamily, NULL, 0));
-      }
+   SASSERTX(index < keystate->keyc);
+   SASSERTX(keystate->keyv[index].inuse);
+   SASSERTX(keystate->keyinuse > 0);
 
+   if (sockscf.option.debug)
       slog(LOG_DEBUG,
            "%s: removing entry for address %s (key: %s) at index #%lu "
            "from keystate. Will have %lu entries in keyv afterwards",
            function,
-           ntop,
+           keydata2string(keystate_data(keystate, index, &keydata), NULL, 0),
            statekey2string(keystate->key),
            (unsigned long)index,
-           (unsigned long)keystate->keyc - 1);
-   }
-
+           (unsigned long)keystate->keyinuse - 1);
 
    /*
     * bzero the removed entry, so that if somebody overwrites it before
     * we close and reopen the mmap(2)-ed file, it will be zero.
     */
    bzero(&keystate->keyv[index], sizeof(*keystate->keyv));
+   --keystate->keyinuse;
 
-   if (keystate->keyc > 1)
-      memmove(&keystate->keyv[index],
-              &keystate->keyv[index + 1],
-              sizeof(*keystate->keyv) * (keystate->keyc - (index + 1)));
+   keystate->movedentries = 1;
 
-   --keystate->keyc;
+   /*
+    * Move back any following entries in the same probe sequence that
+    * would otherwise no longer be found, as we do not use tombstones.
+    */
+   i = index;
+   while (1) {
+      size_t home;
 
-   if (sockscf.option.debug) {
-      size_t i;
+      i = (i + 1) & mask;
 
-      for (i = 0; i < keystate->keyc; ++i) {
-         const char *keystring;
-         keystate_data_t key;
+      if (!keystate->keyv[i].inuse)
+         break;
 
-         keystate_data(keystate, i, &key);
-         keystring = keydata2string(&key, NULL, 0);
+      home = keystate_hash(keystate_data(keystate, i, &keydata)) & mask;
 
-         slog(LOG_DEBUG, "%s: entry #%lu: %s",
-              function, (unsigned long)i, keystring);
+      if (index <= i ?
+            (home <= index || home > i) : (home <= index && home > i)) {
+         keystate->keyv[index] = keystate->keyv[i];
+         bzero(&keystate->keyv[i], sizeof(*keystate->keyv));
+
+         index = i;
       }
    }
 }
 
-ssize_t
-keystate_index(shmem, cinfo, doexpirescan)
-   shmem_object_t *shmem;
-   const clientinfo_t *cinfo;
-   const int doexpirescan;
+static size_t
+keystate_slot(keystate, keydata)
+   const keystate_t *keystate;
+   const keystate_data_t *keydata;
 {
-   const char *function = "keystate_index()";
-   static ssize_t lastmatched = -1;
-   const void *datatomatch;
-   keystate_data_t keydata;
-   keystate_data_type datatype;
-   struct timeval timenow;
-   ssize_t matchedi;
-   size_t i, datalen;
-   char extrainfo[128] = { NUL };
+   const size_t mask = keystate->keyc - 1;
+   size_t i;
 
-   if (doexpirescan)
-      gettimeofday_monotonic(&timenow);
+   SASSERTX(keystate->keyc > 0);
+   SASSERTX((keystate->keyc & mask) == 0);
+   SASSERTX(keystate->keyinuse < keystate->keyc);
 
-   SASSERTX(shmem->keystate.key != key_unset);
+   i = keystate_hash(keydata) & mask;
+   while (keystate->keyv[i].inuse) {
+      keystate_data_t slotdata;
 
-   switch (shmem->keystate.key) {
-      case key_from:
-         switch (cinfo->from.ss_family) {
-            case AF_INET:
-               datatype = keytype_ipv4;
+      keystate_data(keystate, i, &slotdata);
+      if (slotdata.type == keydata->type) {
+         switch (keydata->type) {
+            case keytype_ipv4:
+               if (memcmp(&slotdata.data.ipv4,
+                          &keydata->data.ipv4,
+                          sizeof(keydata->data.ipv4)) == 0)
+                  return i;
                break;
 
-            case AF_INET6:
-               datatype = keytype_ipv6;
+            case keytype_ipv6:
+               if (memcmp(&slotdata.data.ipv6,
+                          &keydata->data.ipv6,
+                          sizeof(keydata->data.ipv6)) == 0)
+                  return i;
                break;
 
             default:
-               SERRX(cinfo->from.ss_family);
+               SERRX(keydata->type);
          }
+      }
 
-         datatomatch = GET_SOCKADDRADDR(&cinfo->from);
-         datalen     = inaddrlen(cinfo->from.ss_family);
-         break;
+      i = (i + 1) & mask;
+   }
 
-#if HAVE_SOCKS_HOSTID
-      case key_hostid:
-         SASSERTX(shmem->keystate.keyinfo.hostindex <= cinfo->hostidc);
+   return i;
+}
 
-         datatomatch = &cinfo->hostidv[shmem->keystate.keyinfo.hostindex - 1];
-         datatype    = keytype_ipv4;
-         datalen     = sizeof(keydata.data.ipv4);
+static size_t
+keystate_hash(keydata)
+   const keystate_data_t *keydata;
+{
+   const unsigned char *data;
+   size_t i, len, hash;
 
-         snprintf(extrainfo, sizeof(extrainfo), "(hostindex = %u)",
-                  (unsigned)shmem->keystate.keyinfo.hostindex);
+   switch (keydata->type) {
+      case keytype_ipv4:
+         data = (const unsigned char *)&keydata->data.ipv4;
+         len  = sizeof(keydata->data.ipv4);
+         break;
 
+      case keytype_ipv6:
+         data = (const unsigned char *)&keydata->data.ipv6;
+         len  = sizeof(keydata->data.ipv6);
          break;
-#endif /* HAVE_SOCKS_HOSTID */
 
       default:
-         SERRX(shmem->keystate.key);
+         SERRX(keydata->type);
    }
 
-   if (lastmatched != -1 && lastmatched < (ssize_t)shmem->keystate.keyc) {
-      keystate_data(&shmem->keystate, lastmatched, &keydata);
+   /*
+    * FNV-1a.  The low bits, which is what we use, are well enough mixed
+    * for the addresses we expect.
+    */
+   hash = (size_t)2166136261UL;
+   for (i = 0; i < len; ++i) {
+      hash ^= data[i];
+      hash *= (size_t)16777619UL;
+   }
 
-      switch (keydata.type) {
-         case keytype_ipv4:
-            if (memcmp(&keydata.data.ipv4, datatomatch, datalen) == 0)
-               matchedi = lastmatched;
-            else
-               matchedi = -1;
-            break;
+   return hash;
+}
 
-         case keytype_ipv6:
-            if (memcmp(&keydata.data.ipv6, datatomatch, datalen) == 0)
-               matchedi = lastmatched;
-            else
-               matchedi = -1;
-            break;
+static void
+keystate_expirescan(shmem, timenow)
+   shmem_object_t *shmem;
+   const struct timeval *timenow;
+{
+   keystate_t *keystate = &shmem->keystate;
+   const size_t mask    = keystate->keyc - 1;
+   size_t checked;
 
-         default:
-            SERRX(keydata.type);
-      }
+   SASSERTX(keystate->keyc > 0);
+
+   MUNPROTECT_SHMEMHEADER(shmem);
+
+   for (checked = 0;
+   checked < KEYSTATE_EXPIRESTEP && keystate->keyinuse > 0;
+   ++checked) {
+      const size_t i = keystate->expirenext & mask;
+
+      if (keystate->keyv[i].inuse
+      &&  keystate_clientcount(keystate, i) == 0
+      &&  keystate_hasexpired(shmem, i, timenow))
+         /*
+          * Another entry may be moved into this slot, so check it again.
+          */
+         keystate_removeindex(keystate, i);
+      else
+         keystate->expirenext = (i + 1) & mask;
    }
+
+   MPROTECT_SHMEMHEADER(shmem);
+}
+
+static int
+keystate_grow(shmem, sizemapped)
+   shmem_object_t *shmem;
+   size_t *sizemapped;
+{
+   const char *function = "keystate_grow()";
+   const char *fname    = sockd_getshmemname(shmem->mstate.shmid,
+                                             shmem->keystate.key);
+   keystate_t *keystate = &shmem->keystate, oldstate;
+   size_t newc, i;
+   void *newmap;
+   int fd;
+
+   SASSERTX(*sizemapped == keystate->keyc * sizeof(*keystate->keyv));
+
+   if (keystate->keyc == 0)
+      newc = KEYSTATE_MINSIZE;
    else
-      matchedi = -1;
+      newc = keystate->keyc * 2;
 
-   if (sockscf.option.debug) {
-      char ntop[MAXSOCKADDRSTRING];
+   slog(LOG_DEBUG, "%s: growing keyv of shmid %lu from %lu to %lu entries",
+        function,
+        (unsigned long)shmem->mstate.shmid,
+        (unsigned long)keystate->keyc,
+        (unsigned long)newc);
 
-      switch (datatype) {
-         case keytype_ipv4:
-            if (inet_ntop(AF_INET, datatomatch, ntop, sizeof(ntop)) == NULL) {
-               swarn("%s: inet_ntop(3) failed on %s %x",
-                    function,
-                    atype2string(AF_INET),
-                    ((const struct in_addr *)datatomatch)->s_addr);
+   /*
+    * The new mapping is of the same file, so save what we have first.
+    */
+   oldstate = *keystate;
+   if (oldstate.keyc > 0) {
+      if ((oldstate.keyv = malloc(*sizemapped)) == NULL) {
+         swarn("%s: could not allocate %lu bytes of memory",
+               function, (unsigned long)*sizemapped);
 
-               snprintf(ntop, sizeof(ntop), "<unknown>");
-            }
-            break;
+         return -1;
+      }
 
-         case keytype_ipv6:
-            if (inet_ntop(AF_INET6, datatomatch, ntop, sizeof(ntop)) == NULL) {
-               swarn("%s: inet_ntop(3) failed on %s " IP6_FMTSTR,
-                    function,
-                    atype2string(AF_INET6),
-                    IP6_ELEMENTS((const struct in6_addr *)datatomatch));
+      memcpy(oldstate.keyv, keystate->keyv, *sizemapped);
+   }
 
-               snprintf(ntop, sizeof(ntop), "<unknown>");
-            }
-            break;
+   if ((fd = open(fname, O_RDWR)) == -1) {
+      swarn("%s: could not open shmemfile %s", function, fname);
 
-         default:
-            SERRX(datatype);
-      }
+      free(oldstate.keyv);
+      return -1;
+   }
 
-      slog(LOG_DEBUG,
-           "%s: trying to find a match for key %s, address %s%s%s in keyv "
-           "array with %lu entries.  Doexpirescan = %d, matchedi = %ld%s",
-           function,
-           statekey2string(shmem->keystate.key),
-           ntop,
-           *extrainfo == NUL ? "" : " ",
-           *extrainfo == NUL ? "" : extrainfo,
-           (unsigned long)shmem->keystate.keyc,
-           doexpirescan,
-           (long)matchedi,
-           matchedi == -1 ?
-               "" : doexpirescan ?
-                 ".  Not scanning since index from last time matches" :  "");
+   newmap = sockd_mmap(NULL,
+                       newc * sizeof(*keystate->keyv),
+                       PROT_READ | PROT_WRITE,
+                       MAP_SHARED,
+                       fd,
+                       1);
+
+   close(fd);
+
+   if (newmap == MAP_FAILED) {
+      swarn("%s: failed to mmap(2) shmeminfo of size %lu from file %s",
+            function, (unsigned long)(newc * sizeof(*keystate->keyv)), fname);
+
+      free(oldstate.keyv);
+      return -1;
    }
 
-   if (matchedi != -1)
-      return matchedi;
+   MUNPROTECT_SHMEMHEADER(shmem);
+
+   if (keystate->keyv != NULL
+   &&  munmap(keystate->keyv, *sizemapped) != 0)
+      swarn("%s: munmap(2) of keystate.keyv (%p) of size %lu failed",
+            function, keystate->keyv, (unsigned long)*sizemapped);
+
+   keystate->keyv         = newmap;
+   keystate->keyc         = newc;
+   keystate->expirenext   = 0;
+   keystate->movedentries = 1;
+
+   bzero(keystate->keyv, newc * sizeof(*keystate->keyv));
 
-   i  = 0;
-   while (i < shmem->keystate.keyc) {
+   for (i = 0; i < oldstate.keyc; ++i) {
       keystate_data_t keydata;
-      int matches;
 
-      if (doexpirescan && keystate_hasexpired(shmem, i, &timenow)) {
-         MUNPROTECT_SHMEMHEADER(shmem);
+      if (!oldstate.keyv[i].inuse)
+         continue;
 
-         if (keystate_clientcount(&shmem->keystate, i) == 0) {
-            keystate_removeindex(&shmem->keystate, i);
-            continue;
-         }
-         else /* can't remove as long as long as entry is in use; just reset. */
-            RESET_THROTTLE(&shmem->object.ss.throttle, timenow);
+      keystate_data(&oldstate, i, &keydata);
+      keystate->keyv[keystate_slot(keystate, &keydata)] = oldstate.keyv[i];
+   }
 
-         MPROTECT_SHMEMHEADER(shmem);
-      }
+   MPROTECT_SHMEMHEADER(shmem);
 
-      keystate_data(&shmem->keystate, i, &keydata);
+   free(oldstate.keyv);
 
-      if (keydata.type == datatype) {
-         switch (keydata.type) {
-            case keytype_ipv4:
-               matches
-               = (memcmp(&keydata.data.ipv4, datatomatch, datalen) == 0);
-               break;
+   *sizemapped = newc * sizeof(*keystate->keyv);
 
-            case keytype_ipv6:
-               matches
-               = (memcmp(&keydata.data.ipv6, datatomatch, datalen) == 0);
-               break;
+   return 0;
+}
 
-            default:
-               SERRX(keydata.type);
-         }
+ssize_t
+keystate_index(shmem, cinfo, doexpirescan)
+   shmem_object_t *shmem;
+   const clientinfo_t *cinfo;
+   const int doexpirescan;
+{
+   const char *function = "keystate_index()";
+   keystate_data_t keydata;
+   ssize_t matchedi;
 
-         if (sockscf.option.debug)
-            slog(LOG_DEBUG,
-                 "%s: compared against %s at index #%lu using %lu bytes: %s",
-                 function,
-                 keydata2string(&keydata, NULL, 0),
-                 (unsigned long)i,
-                 (unsigned long)datalen,
-                 matches ? "matches" : "no match");
-      }
-      else /* can't possibly match. */
-         matches = 0;
+   SASSERTX(shmem->keystate.key != key_unset);
 
-      if (matches) {
-         SASSERTX(matchedi == -1);
-         matchedi = lastmatched = (ssize_t)i;
+   if (shmem->keystate.keyc == 0)
+      return -1;
 
-         if (!doexpirescan)
-            break;
-      }
+   if (doexpirescan && shmem->keystate.keyinuse > 0) {
+      struct timeval timenow;
 
-      ++i;
+      gettimeofday_monotonic(&timenow);
+      keystate_expirescan(shmem, &timenow);
    }
 
-   if (doexpirescan) {
-      MUNPROTECT_SHMEMHEADER(shmem);
+   cinfo2keydata(&shmem->keystate, cinfo, &keydata);
 
-      shmem->keystate.lastexpirescan = timenow.tv_sec;
+   matchedi = (ssize_t)keystate_slot(&shmem->keystate, &keydata);
+   if (!shmem->keystate.keyv[matchedi].inuse)
+      matchedi = -1;
+
+   if (sockscf.option.debug)
+      slog(LOG_DEBUG,
+           "%s: key %s, address %s: index %ld in keyv with %lu/%lu entries "
+           "in use",
+           function,
+           statekey2string(shmem->keystate.key),
+           keydata2string(&keydata, NULL, 0),
+           (long)matchedi,
+           (unsigned long)shmem->keystate.keyinuse,
+           (unsigned long)shmem->keystate.keyc);
 
-      MPROTECT_SHMEMHEADER(shmem);
-   }
    return matchedi;
 }
 
@@ -1395,22 +1442,27 @@ keystate_closemap(id, keystate, mappedsize, changedindex)
 
    slog(LOG_DEBUG,
         "%s: mapped size for keystate of id %lu is %lu, newsize is %lu, "
-        "changedindex: %ld",
+        "changedindex: %ld, movedentries: %d",
         function,
         (unsigned long)id,
         (unsigned long)mappedsize,
         (unsigned long)newsize,
-        (long)changedindex);
+        (long)changedindex,
+        (int)keystate->movedentries);
 
    if (sockscf.option.debug) {
       keystate_data_t keydata;
       size_t i;
 
-      for (i = 0; i < keystate->keyc; ++i)
+      for (i = 0; i < keystate->keyc; ++i) {
+         if (!keystate->keyv[i].inuse)
+            continue;
+
          slog(LOG_DEBUG, "%s: entry #%lu: %s",
               function,
               (unsigned long)i,
               keydata2string(keystate_data(keystate, i, &keydata), NULL, 0));
+      }
    }
 
    if (mappedsize == 0)
@@ -1440,7 +1492,7 @@ keystate_closemap(id, keystate, mappedsize, changedindex)
 
       SASSERTX(keystate->keyv != NULL);
 
-      if (mappedsize < newsize) {
+      if (mappedsize < newsize || keystate->movedentries) {
          needmsync = 1;
 
          /*
@@ -1471,13 +1523,15 @@ keystate_closemap(id, keystate, mappedsize, changedindex)
 
          slog(rc == 0 ? LOG_DEBUG : LOG_WARNING,
               "%s: msync(%p, %lu, MS_SYNC), based on mappedsize %lu, "
-              "newsize %lu, changedindex %ld, keyv %p %s (%s)",
+              "newsize %lu, changedindex %ld, movedentries %d, keyv %p "
+              "%s (%s)",
               function,
               addr,
               len,
               (unsigned long)mappedsize,
               (unsigned long)newsize,
               (long)changedindex,
+              (int)keystate->movedentries,
               keystate->keyv,
               rc == 0 ? "is ok" : "failed",
               strerror(errno));
@@ -1493,6 +1547,8 @@ keystate_closemap(id, keystate, mappedsize, changedindex)
       keystate->keyv = NULL;
    }
 
+   keystate->movedentries = 0;
+
    if (newsize != mappedsize) {
       if (truncate(fname, (off_t)newsize) == 0)
          slog(LOG_DEBUG, "%s: truncated shmemfile %s to size %lu",
@@ -1574,35 +1630,46 @@ shmemcheck(void)
 }
 #endif /* DIAGNOSTIC && !SOCKS_CLIENT */
 
-static int
-should_do_expirescan(shmem)
-   const shmem_object_t *shmem;
+static keystate_data_t *
+cinfo2keydata(keystate, cinfo, keydata)
+   const keystate_t *keystate;
+   const clientinfo_t *cinfo;
+   keystate_data_t *keydata;
 {
-   ssize_t timer;
 
-   if ((timer = keystate_timer(shmem)) != -1
-   && socks_difftime(time_monotonic(NULL),
-                     shmem->keystate.lastexpirescan) >= timer)
-      return 1;
+   switch (keystate->key) {
+      case key_from:
+         switch (cinfo->from.ss_family) {
+            case AF_INET:
+               keydata->type      = keytype_ipv4;
+               keydata->data.ipv4 = TOCIN(&cinfo->from)->sin_addr;
+               break;
 
-   return 0;
-}
+            case AF_INET6:
+               keydata->type      = keytype_ipv6;
+               keydata->data.ipv6 = TOCIN6(&cinfo->from)->sin6_addr;
+               break;
 
-static ssize_t
-keystate_timer(shmem)
-   const shmem_object_t *shmem;
-{
+            default:
+               SERRX(cinfo->from.ss_family);
+         }
 
-   switch (shmem->type) {
-      case SHMEM_SS:
-         if (shmem->object.ss.throttle_perstate_isset)
-            return (size_t)shmem->object.ss.throttle_perstate.limit.seconds;
-         else
-            return -1;
+         break;
+
+#if HAVE_SOCKS_HOSTID
+      case key_hostid:
+         SASSERTX(keystate->keyinfo.hostindex <= cinfo->hostidc);
+
+         keydata->type      = keytype_ipv4;
+         keydata->data.ipv4 = cinfo->hostidv[keystate->keyinfo.hostindex - 1];
+         break;
+#endif /* HAVE_SOCKS_HOSTID */
 
       default:
-         return -1;
+         SERRX(keystate->key);
    }
+
+   return keydata;
 }
 
 static keystate_data_t *
@@ -1613,6 +1680,7 @@ keystate_data(keystate, index, keydata)
 {
 
    SASSERTX(index < keystate->keyc);
+   SASSERTX(keystate->keyv[index].inuse);
    switch (keystate->key) {
       case key_from:
          switch (keystate->keyv[index].data.from.safamily) {
@@ -95,6 +95,20 @@ handlechildcommand(const unsigned int command, sockd_child_t *child,
  * requests and should be removed, or false otherwise.
  */
 
+static size_t
+handoff_clients(sockd_client_t *clientv, size_t *clientc, const int isresend);
+/*
+ * Passes the "clientc" clients in "clientv" on to negotiate children,
+ * sending as many clients as the child has free slots for in one message.
+ * "isresend" indicates whether we have tried to send these clients before.
+ *
+ * Clients we failed to send due to a temporary error are moved to the
+ * start of "clientv", and "clientc" is updated to the number of such
+ * clients.  Clients we fail to send for any other reason are dropped.
+ *
+ * Returns the number of clients sent.
+ */
+
 const int socks_configtype = CONFIGTYPE_SERVER;
 
 #if DIAGNOSTIC && HAVE_MALLOC_OPTIONS
@@ -142,11 +156,11 @@ main(argc, argv)
    fd_set *rset;
    ssize_t p;
    size_t i;
-   sockd_client_t  saved_client;
+   sockd_client_t  saved_clientv[SOCKD_HANDOFFMAX];
    sockd_io_t      saved_io;
    sockd_request_t saved_req;
-   int have_saved_client = 0,
-       have_saved_req    = 0,
+   size_t saved_clientc = 0;
+   int have_saved_req    = 0,
        have_saved_io     = 0;
 
 #if DIAGNOSTIC && HAVE_MALLOC_OPTIONS
@@ -267,9 +281,9 @@ main(argc, argv)
          sockopts_dump();
    }
 
-   if (childcheck(PROC_NEGOTIATE) < SOCKD_FREESLOTS_NEGOTIATE
-   ||  childcheck(PROC_REQUEST)   < SOCKD_FREESLOTS_REQUEST
-   ||  childcheck(PROC_IO)        < SOCKD_FREESLOTS_IO)
+   if (childcheck(PROC_NEGOTIATE) < minfreeslots(PROC_NEGOTIATE)
+   ||  childcheck(PROC_REQUEST)   < minfreeslots(PROC_REQUEST)
+   ||  childcheck(PROC_IO)        < minfreeslots(PROC_IO))
       serr("initial childcheck() failed: %s",
            sockscf.child.noaddchild_reason != NULL ?
                   sockscf.child.noaddchild_reason
@@ -327,9 +341,9 @@ moncontrol(1);
       errno = 0; /* reset for each iteration. */
       rbits = fillset(rset, &free_negc, &free_reqc, &free_ioc);
 
-      if (free_negc  < SOCKD_FREESLOTS_NEGOTIATE
-      ||  free_reqc  < SOCKD_FREESLOTS_REQUEST
-      ||  free_ioc   < SOCKD_FREESLOTS_IO) {
+      if (free_negc  < minfreeslots(PROC_NEGOTIATE)
+      ||  free_reqc  < minfreeslots(PROC_REQUEST)
+      ||  free_ioc   < minfreeslots(PROC_IO)) {
          static time_t lastloggedtime;
          time_t tnow;
 
@@ -355,7 +369,7 @@ moncontrol(1);
       }
 #endif /* BAREFOOTD */
 
-      if (have_saved_client || have_saved_req || have_saved_io) {
+      if (saved_clientc > 0 || have_saved_req || have_saved_io) {
          slog(LOG_DEBUG,
               "have previously unsent clientobjects; setting timeout to zero");
 
@@ -388,14 +402,18 @@ moncontrol(1);
        * require the children to send us any new client objects.
        */
       while ((child = getset(ACKPIPE, rset)) != NULL) {
-         unsigned char command;
+         /*
+          * A busy child may have acked several slots since last time,
+          * so read all the acks it has sent us in one go.
+          */
+         unsigned char commandv[SOCKD_HANDOFFMAX * 4];
          int childisbad = 0, childhasfinished = 0;
 
          errno = 0;
          p     = socks_recvfromn(child->ack,
-                                 &command,
-                                 sizeof(command),
-                                 0,
+                                 commandv,
+                                 sizeof(commandv),
+                                 sizeof(*commandv),
                                  0,
                                  NULL,
                                  NULL,
@@ -403,29 +421,20 @@ moncontrol(1);
                                  NULL);
          clearset(ACKPIPE, child, rset);
 
-         if (p != sizeof(command)) {
-            switch (p) {
-               case -1:
-                  swarn("socks_recvfrom(child->ack) from %s %ld failed",
-                        childtype2string(child->type), (long)child->pid);
-                  break;
-
-               case 0:
-                  swarnx("EOF from %s %ld",
-                         childtype2string(child->type), (long)child->pid);
-                  break;
-
-               default:
-                  swarnx("unexpected byte count from %s %ld.  "
-                         "Expected %lu, got %lu",
-                         childtype2string(child->type), (long)child->pid,
-                         (unsigned long)sizeof(command), (unsigned long)p);
-            }
+         if (p <= 0) {
+            if (p == -1)
+               swarn("socks_recvfrom(child->ack) from %s %ld failed",
+                     childtype2string(child->type), (long)child->pid);
+            else
+               swarnx("EOF from %s %ld",
+                      childtype2string(child->type), (long)child->pid);
 
             childisbad = 1;
          }
-         else
-            handlechildcommand(command, child, &childhasfinished);
+         else {
+            for (i = 0; i < (size_t)p && !childhasfinished; ++i)
+               handlechildcommand(commandv[i], child, &childhasfinished);
+         }
 
          if (childhasfinished || childisbad) {
             closechild(child->pid, childhasfinished ? 1 : 0);
@@ -447,36 +456,10 @@ moncontrol(1);
        * as the child not having yet drained the socket it receives
        * new objects on.
        */
-      if (have_saved_client) {
-         if ((child = nextchild(PROC_NEGOTIATE, SOCKS_TCP)) == NULL) {
-            log_clientdropped(&saved_client.from);
-
-            close(saved_client.s);
-            continue;
-         }
-
-         SASSERTX(child != NULL);
-         SASSERTX(child->freec > 0);
-
-         log_clientsend(&saved_client.from, child, 1);
-         p = send_client(child->s, &saved_client, NULL, 0);
-
-         if (p == 0) {
-            --child->freec;
-            ++child->sentc;
-            ++sockscf.stat.negotiate.sendt;
-
-            close(saved_client.s);
-            have_saved_client = 0;
-         }
-         else {
-            log_sendfailed(&saved_client.from, saved_client.s, child, 0);
+      if (saved_clientc > 0) {
+         const size_t sent = handoff_clients(saved_clientv, &saved_clientc, 1);
 
-            if (!ERRNOISTMP(errno)) {
-               close(saved_client.s);
-               have_saved_client = 0;
-            }
-         }
+         free_negc -= MIN(free_negc, sent);
       }
 
       if (have_saved_req && free_reqc > 0) {
@@ -673,7 +656,7 @@ moncontrol(1);
           */
          const sockd_child_t fromchild = *child;
          unsigned char command;
-         int childhasfinished;
+         int type, childhasfinished;
 
          if (sockd_handledsignals())
             /* some child could have been removed from rset.  Can't use it. */
@@ -691,7 +674,18 @@ moncontrol(1);
          clearset(DATAPIPE, &fromchild, rset);
          errno = 0;
 
-         switch (fromchild.type) {
+#if SOCKD_FASTCONNECT
+         if (fromchild.type == PROC_NEGOTIATE && recv_isio(fromchild.s))
+            /*
+             * negotiate child performed the request itself; what it
+             * sends us is the resulting io, as a request child would.
+             */
+            type = PROC_REQUEST;
+         else
+#endif /* SOCKD_FASTCONNECT */
+            type = fromchild.type;
+
+         switch (type) {
             /*
              * in the order a packet travels between children;
              * negotiate -> request -> io
@@ -854,12 +848,16 @@ moncontrol(1);
                   continue;
                }
 
-               ++sockscf.stat.request.received;
+               if (fromchild.type == PROC_NEGOTIATE)
+                  ++sockscf.stat.negotiate.received;
+               else
+                  ++sockscf.stat.request.received;
+
                command = io.reqinfo.command;
 
                switch (io.state.protocol) {
                   case SOCKS_TCP:
-                     child = getchild(pid_tcp);
+                     child = nextiochild(pid_tcp, CONTROLIO(&io)->s);
                      break;
 
                   case SOCKS_UDP:
@@ -881,7 +879,7 @@ moncontrol(1);
                   ++child->sentc;
                   ++sockscf.stat.io.sendt;
 
-                  SASSERTX(child->freec  < maxfreeslots(child->type));
+                  SASSERTX(child->freec  < child->maxfreec);
                   close_iodescriptors(&io);
 #if BAREFOOTD
                   if (io.state.protocol == SOCKS_UDP) {
@@ -976,7 +974,7 @@ moncontrol(1);
                   continue;
                }
 
-               if (have_saved_client) {
+               if (saved_clientc > 0) {
                   log_noclientrecv(&fromchild);
                   continue;
                }
@@ -1019,10 +1017,8 @@ moncontrol(1);
 
                log_sendfailed(&client.from, client.s, child, 1);
 
-               if (ERRNOISTMP(errno)) {
-                  saved_client      = client;
-                  have_saved_client = 1;
-               }
+               if (ERRNOISTMP(errno))
+                  saved_clientv[saved_clientc++] = client;
                else {
                   /*
                    * XXX
@@ -1058,7 +1054,7 @@ moncontrol(1);
             }
 
             default:
-               SERRX(fromchild.type);
+               SERRX(type);
          }
 
          handlechildcommand(command,
@@ -1072,9 +1068,10 @@ moncontrol(1);
       /*
        * handled our children.  Is there a new connection pending now?
        */
-      for (i = 0; i < sockscf.internal.addrc && !have_saved_client; ++i) {
+      for (i = 0; i < sockscf.internal.addrc && saved_clientc == 0; ++i) {
          char astr[MAXSOCKADDRSTRING];
          sockd_client_t client;
+         size_t sent;
 
          if (sockd_handledsignals())
             break; /* don't know what happened; restart loop. */
@@ -1092,11 +1089,22 @@ moncontrol(1);
              * Run until there are no more clients pending on the socket,
              * to somewhat reduce the chance of the listen queue filling
              * up before we have time to shrink it.
+             * New clients are collected in saved_clientv and passed on
+             * to the negotiate children SOCKD_HANDOFFMAX at a time,
+             * rather than one message per client.
              */
             do {
                socklen_t len;
                int nomoreclients = 0;
 
+               if (saved_clientc >= ELEMENTS(saved_clientv)) {
+                  sent = handoff_clients(saved_clientv, &saved_clientc, 0);
+                  free_negc -= MIN(free_negc, sent);
+
+                  if (saved_clientc > 0)
+                     break; /* failed to send some; retry later. */
+               }
+
                len       = sizeof(client.from);
 
                client.s  = acceptn(sockscf.internal.addrv[i].s,
@@ -1177,38 +1185,13 @@ moncontrol(1);
                     sockaddr2string(&sockscf.internal.addrv[i].addr, NULL, 0),
                     sockscf.internal.addrv[i].s);
 
-               if ((child = nextchild(PROC_NEGOTIATE, SOCKS_TCP)) == NULL) {
-                  log_clientdropped(&client.from);
-
-                  close(client.s);
-                  continue;
-               }
-
-               log_clientsend(&client.from, child, 0);
-
-               p = send_client(child->s, &client, NULL, 0);
-
-               if (p == 0) {
-                  --free_negc;
-                  --child->freec;
-                  ++child->sentc;
-                  ++sockscf.stat.negotiate.sendt;
-
-                  close(client.s);
-               }
-               else {
-                  log_sendfailed(&client.from, client.s, child, 1);
-
-                  if (ERRNOISTMP(errno)) {
-                     saved_client      = client;
-                     have_saved_client = 1;
-                  }
-                  else
-                     close(client.s);
-
-                  break;
-               }
+               saved_clientv[saved_clientc++] = client;
             } while (1);
+
+            if (saved_clientc > 0) {
+               sent = handoff_clients(saved_clientv, &saved_clientc, 0);
+               free_negc -= MIN(free_negc, sent);
+            }
          }
       }
    }
@@ -1562,6 +1545,19 @@ serverinit(argc, argv)
    checkconfig();
    newprocinit();
 
+   sockscf.state.reuseport = sockscf.child.reuseport;
+   sockscf.state.allinone  = sockscf.child.allinone;
+
+   if (sockscf.state.allinone)
+      /* the i/o children accept the clients themselves. */
+      sockscf.state.reuseport = 1;
+
+   /*
+    * Hostcache also uses shmem, but has it's own area, the size of
+    * which is set in the config, so can only be set up now.
+    */
+   hostcachesetup();
+
    if (!sockscf.option.verifyonly) {
       if (bindinternal(SOCKS_TCP) != 0)
          serr("%s: failed to bind internal addresses", function);
@@ -1572,6 +1568,86 @@ serverinit(argc, argv)
    sockscf.state.inited = 1;
 }
 
+static size_t
+handoff_clients(clientv, clientc, isresend)
+   sockd_client_t *clientv;
+   size_t *clientc;
+   const int isresend;
+{
+   const char *function = "handoff_clients()";
+   sockd_child_t *child;
+   size_t i, j, n, sent, maxn;
+
+   slog(LOG_DEBUG, "%s: %lu client%s to hand off",
+        function, (unsigned long)*clientc, *clientc == 1 ? "" : "s");
+
+   i = sent = 0;
+   maxn     = SOCKD_HANDOFFMAX;
+   while (i < *clientc) {
+      if ((child = nextchild(PROC_NEGOTIATE, SOCKS_TCP)) == NULL) {
+         for (; i < *clientc; ++i) {
+            log_clientdropped(&clientv[i].from);
+            close(clientv[i].s);
+         }
+
+         break;
+      }
+
+      SASSERTX(child->freec > 0);
+
+      n = MIN(MIN(*clientc - i, child->freec), maxn);
+
+      for (j = i; j < i + n; ++j)
+         log_clientsend(&clientv[j].from, child, isresend);
+
+      if (send_clients(child->s, &clientv[i], n) == 0) {
+         child->freec                   -= n;
+         child->sentc                   += n;
+         sockscf.stat.negotiate.sendt   += n;
+
+         for (j = i; j < i + n; ++j)
+            close(clientv[j].s);
+
+         sent += n;
+         i    += n;
+
+         continue;
+      }
+
+      if (errno == EMSGSIZE && n > 1) {
+         /*
+          * Our socket buffer towards this child was not set as large
+          * as we wanted.  Send fewer clients per message.
+          */
+         slog(LOG_DEBUG, "%s: message with %lu clients too large: %s",
+              function, (unsigned long)n, strerror(errno));
+
+         maxn = n / 2;
+         continue;
+      }
+
+      log_sendfailed(&clientv[i].from, clientv[i].s, child, !isresend);
+
+      if (ERRNOISTMP(errno))
+         break; /* keep the rest for later. */
+
+      for (j = i; j < i + n; ++j)
+         close(clientv[j].s);
+
+      i += n;
+   }
+
+   /*
+    * Move what remains unsent to the start of the array.
+    */
+   if (i > 0 && i < *clientc)
+      memmove(clientv, &clientv[i], sizeof(*clientv) * (*clientc - i));
+
+   *clientc -= i;
+
+   return sent;
+}
+
 static void
 handlechildcommand(command, child, finished)
    const unsigned int command;
@@ -1602,7 +1678,7 @@ handlechildcommand(command, child, finished)
               (unsigned long)child->freec,
               child->freec == 1 ? "" : "s");
 
-         SASSERTX(child->freec <= maxfreeslots(child->type));
+         SASSERTX(child->freec <= child->maxfreec);
 
          if (child->type == PROC_IO) {
             /*
@@ -1625,12 +1701,40 @@ handlechildcommand(command, child, finished)
 
          break;
 
+      case SOCKD_NEWCLIENT_TCP:
+         /*
+          * child accept(2)-ed a client on its own SO_REUSEPORT socket,
+          * so account for it as if we had sent it the client.
+          */
+         SASSERTX(child->type == PROC_NEGOTIATE
+         ||      (child->type == PROC_IO && sockscf.state.allinone));
+         SASSERTX(child->freec > 0);
+
+         --child->freec;
+         ++child->sentc;
+         ++sockscf.stat.accepted;
+
+         if (child->type == PROC_IO)
+            ++sockscf.stat.io.sendt;
+         else
+            ++sockscf.stat.negotiate.sendt;
+
+         slog(LOG_DEBUG,
+              "%s: %s %ld has accepted a new client, now has %lu slot%s free",
+              function,
+              childtype2string(child->type),
+              (long)child->pid,
+              (unsigned long)child->freec,
+              child->freec == 1 ? "" : "s");
+
+         break;
+
       default:
          SWARNX(command);
    }
 
    if (sockscf.child.maxrequests != 0
-   &&  child->freec              == maxfreeslots(child->type)
+   &&  child->freec              == child->maxfreec
    &&  child->sentc              >= sockscf.child.maxrequests) {
       slog(LOG_DEBUG,
            "%s: should close  connection to %s %ld: %lu request%s handled",
@@ -1679,7 +1783,7 @@ dotest(void)
    if (kill(child->pid, SIGTERM) != 0)
       serr("%s: kill(SIGTERM) of child %ld failed", function, (long)child->pid);
 
-   if (i >= SOCKD_NEGOTIATEMAX)
+   if (i >= (int)child->maxfreec)
       slog(LOG_INFO, "%s: send_client() test completed ok, sent %d requests",
       function, i);
    else
@@ -1705,7 +1809,7 @@ dotest(void)
    if (kill(child->pid, SIGTERM) != 0)
       serr("%s: kill(SIGTERM) of child %ld failed", function, (long)child->pid);
 
-   if (i >= SOCKD_REQUESTMAX)
+   if (i >= (int)sockscf.child.maxclients.request)
       slog(LOG_INFO, "%s: send_req() test completed ok, sent %d requests",
       function, i);
    else
@@ -1733,7 +1837,7 @@ dotest(void)
    if (kill(child->pid, SIGTERM) != 0)
       serr("%s: kill(SIGTERM) of child %ld failed", function, (long)child->pid);
 
-   if (i >= SOCKD_IOMAX)
+   if (i >= (int)child->maxfreec)
       slog(LOG_INFO, "%s: send_io() test completed ok, sent %d requests",
       function, i);
    else
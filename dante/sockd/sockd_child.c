@@ -77,6 +77,15 @@ addchild(const int type);
  *    On failure: NULL.  (resource shortage.)
  */
 
+#if HAVE_SCHED_SETAFFINITY
+static int
+leastusedcpu(const cpu_set_t *mask);
+/*
+ * Returns the cpu in "mask" that the fewest i/o children are bound to,
+ * or -1 if "mask" contains no cpus.
+ */
+#endif /* HAVE_SCHED_SETAFFINITY */
+
 
 static sockd_child_t *monitorv;          /* all our monitorchildren.          */
 static size_t monitorc;
@@ -140,8 +149,7 @@ childcheck(type)
    static time_t lastaddchildfailure_time;
    const int errno_s = errno;
    sockd_child_t **childv, *idlechild;
-   size_t child, *childc, minfreeslots, maxslotsperproc, proxyc,
-          minclientshandled;
+   size_t child, *childc, minfreec, proxyc, minclientshandled;
    time_t  minlifetime;
 #if BAREFOOTD
    pid_t hasfreeudpslot = (pid_t)-1;
@@ -155,9 +163,7 @@ childcheck(type)
       case PROC_MONITOR:
          childc            = &monitorc;
          childv            = &monitorv;
-         minfreeslots      = 1;
          minclientshandled = 1;
-         maxslotsperproc   = 1;
          break;
 
 
@@ -165,27 +171,21 @@ childcheck(type)
       case PROC_NEGOTIATE:
          childc            = &negchildc;
          childv            = &negchildv;
-         minfreeslots      = SOCKD_FREESLOTS_NEGOTIATE;
          minclientshandled = SOCKD_MIN_CLIENTS_HANDLED_NEGOTIATE;
-         maxslotsperproc   = SOCKD_NEGOTIATEMAX;
          break;
 
       case -PROC_REQUEST:
       case PROC_REQUEST:
          childc            = &reqchildc;
          childv            = &reqchildv;
-         minfreeslots      = SOCKD_FREESLOTS_REQUEST;
          minclientshandled = SOCKD_MIN_CLIENTS_HANDLED_REQUEST;
-         maxslotsperproc   = SOCKD_REQUESTMAX;
          break;
 
       case -PROC_IO:
       case PROC_IO:
          childc            = &iochildc;
          childv            = &iochildv;
-         minfreeslots      = SOCKD_FREESLOTS_IO;
          minclientshandled = SOCKD_MIN_CLIENTS_HANDLED_IO;
-         maxslotsperproc   = SOCKD_IOMAX;
          break;
 
       default:
@@ -194,6 +194,7 @@ childcheck(type)
 
    /* same for all. */
    minlifetime = SOCKD_MIN_LIFETIME_SECONDS;
+   minfreec    = minfreeslots(type < 0 ? -type : type);
 
    /*
     * get an estimate over how many (new or in total) clients our children are
@@ -202,7 +203,7 @@ childcheck(type)
     */
    idlechild = NULL;
    for (child = proxyc = 0; child < *childc; ++child) {
-      SASSERTX((*childv)[child].freec <= maxslotsperproc);
+      SASSERTX((*childv)[child].freec <= (*childv)[child].maxfreec);
 
       if ((*childv)[child].waitingforexit)
          continue;
@@ -217,7 +218,7 @@ childcheck(type)
                  (long)(*childv)[child].pid,
                  (unsigned long)(*childv)[child].sentc,
                  (unsigned long)(*childv)[child].freec,
-                 (unsigned long)maxfreeslots((*childv)[child].type));
+                 (unsigned long)(*childv)[child].maxfreec);
 
             continue;
          }
@@ -233,7 +234,7 @@ childcheck(type)
       }
 #endif /* BAREFOOTD */
 
-      proxyc += type < 0 ? maxslotsperproc :
+      proxyc += type < 0 ? (*childv)[child].maxfreec :
 #if BAREFOOTD
                            /*
                             * Don't know what the next client for this
@@ -252,7 +253,7 @@ childcheck(type)
 
 #endif /* !BAREFOOTD */
 
-      if ((*childv)[child].freec == maxslotsperproc) {
+      if ((*childv)[child].freec == (*childv)[child].maxfreec) {
 #if BAREFOOTD
          if (type == PROC_IO) {
             if (hasfreeudpslot != (pid_t)-1
@@ -303,14 +304,18 @@ childcheck(type)
    if (type >= 0) {
       /*
        * Idle child to remove?
+       * Not if the child has its own SO_REUSEPORT listen queue, as any
+       * clients waiting in it would be lost when the child exits.
        */
       if (idlechild != NULL
-      && (proxyc - maxslotsperproc) >= minfreeslots) {
+      && !(idlechild->type == PROC_NEGOTIATE && sockscf.state.reuseport)
+      && !(idlechild->type == PROC_IO        && sockscf.state.allinone)
+      && (proxyc - idlechild->maxfreec) >= minfreec) {
          slog(LOG_DEBUG,
               "%s: counted %lu free %s slots.  Removing pid %ld which has "
               "handled %lu client%s during %lds",
               function,
-              (unsigned long)(proxyc - maxslotsperproc),
+              (unsigned long)(proxyc - idlechild->maxfreec),
               childtype2string(idlechild->type),
               (long)(idlechild->pid),
               (unsigned long)(idlechild->sentc),
@@ -320,7 +325,7 @@ childcheck(type)
          /*
           * will remove this now, no longer part of free slots pool.
           */
-         SASSERTX(idlechild->freec == maxslotsperproc);
+         SASSERTX(idlechild->freec == idlechild->maxfreec);
          proxyc -= idlechild->freec;
          closechild(idlechild->pid, 1);
       }
@@ -329,7 +334,7 @@ childcheck(type)
        * Should we create an additional child?
        */
       if (!sockscf.child.noaddchild
-      && ((proxyc < minfreeslots)
+      && ((proxyc < minfreec)
 #if BAREFOOTD
             ||    (type == PROC_IO && hasfreeudpslot == (pid_t)-1)
 #endif /* BAREFOOTD */
@@ -378,7 +383,7 @@ childcheck(type)
          }
 
          while (!sockscf.child.noaddchild
-         &&       ((proxyc < minfreeslots)
+         &&       ((proxyc < minfreec)
 #if BAREFOOTD
             ||    (type == PROC_IO && hasfreeudpslot == (pid_t)-1)
 #endif /* BAREFOOTD */
@@ -397,14 +402,14 @@ childcheck(type)
                   function,
                   childtype2string(type),
                   (unsigned long)proxyc,
-                  (unsigned long)minfreeslots,
+                  (unsigned long)minfreec,
                   childtype2string(type));
 
             if ((addedchild = addchild(type)) != NULL) {
                slog(LOG_DEBUG, "%s: added child, pid %lu",
                     function, (unsigned long)addedchild->pid);
 
-               proxyc += maxslotsperproc;
+               proxyc += addedchild->maxfreec;
 
 #if BAREFOOTD
                if (type == PROC_IO)
@@ -459,7 +464,11 @@ fillset(set, negc, reqc, ioc)
    FD_ZERO(set);
    dbits = -1;
 
-   for (i = 0; i < sockscf.internal.addrc; ++i) {
+   /*
+    * If using SO_REUSEPORT the negotiate children accept(2) the clients
+    * themselves and our sockets are only bound, not listened on.
+    */
+   for (i = 0; i < sockscf.internal.addrc && !sockscf.state.reuseport; ++i) {
 #if BAREFOOTD
       if (sockscf.internal.addrv[i].protocol != SOCKS_TCP)
          continue; /* udp handled by io children. */
@@ -890,6 +899,65 @@ tryagain:
    return NULL;
 }
 
+sockd_child_t *
+nextiochild(pid, s)
+   const pid_t pid;
+   const int s;
+{
+#if HAVE_SCHED_SETAFFINITY && defined(SO_INCOMING_CPU)
+   const char *function = "nextiochild()";
+
+   if (sockscf.cpu.io.percpu) {
+      sockd_child_t *mostbusy;
+      socklen_t len;
+      size_t i;
+      int cpu;
+
+      len = sizeof(cpu);
+      if (getsockopt(s, SOL_SOCKET, SO_INCOMING_CPU, &cpu, &len) != 0) {
+         slog(LOG_DEBUG, "%s: getsockopt(SO_INCOMING_CPU) on fd %d failed: %s",
+              function, s, strerror(errno));
+
+         cpu = -1;
+      }
+
+      /*
+       * Same policy as nextchild(), but only considering the children
+       * bound to the cpu the client's packets are being processed on.
+       */
+      mostbusy = NULL;
+      for (i = 0; cpu >= 0 && i < iochildc; ++i) {
+         if (iochildv[i].cpuid != cpu
+         ||  iochildv[i].freec <= 0
+         ||  iochildv[i].waitingforexit)
+            continue;
+
+         if (mostbusy == NULL || iochildv[i].freec < mostbusy->freec)
+            mostbusy = &iochildv[i];
+
+         if (mostbusy->freec == 1)
+            break;
+      }
+
+      if (mostbusy != NULL) {
+         slog(LOG_DEBUG, "%s: using %s %ld on cpu %d for client on fd %d",
+              function,
+              childtype2string(mostbusy->type),
+              (long)mostbusy->pid,
+              cpu,
+              s);
+
+         return mostbusy;
+      }
+
+      slog(LOG_DEBUG, "%s: no free %s slot on cpu %d for client on fd %d",
+           function, childtype2string(PROC_IO), cpu, s);
+   }
+#endif /* HAVE_SCHED_SETAFFINITY && SO_INCOMING_CPU */
+
+   return getchild(pid);
+}
+
 int
 childtype(pid)
    const pid_t pid;
@@ -988,6 +1056,8 @@ send_io(s, io)
    SASSERTX(!SHMID_ISATTACHED(CRULE_OR_HRULE(io)));
    SASSERTX(!SHMID_ISATTACHED(&io->srule));
 
+   io->reqinfo.isio = 1;
+
    bzero(iov, sizeof(iov));
    length = 0;
    ioc    = 0;
@@ -1114,9 +1184,10 @@ send_io(s, io)
    }
 
    /*
-    * if not mother, request child.  Since that child only handles one
-    * client at a time, it's safe to block as long as it takes.  Mother
-    * on the other hand can not block.
+    * if not mother, request child (or a negotiate child that performed
+    * the request itself).  The object has been fully set up by now and
+    * mother reads it as soon as she can, so it's safe to block as long as
+    * it takes.  Mother on the other hand can not block.
     */
    if (sendmsgn(s, &msg, 0, sockscf.state.type == PROC_MOTHER ? 0 : -1)
    != length) {
@@ -1142,6 +1213,23 @@ send_io(s, io)
    return 0;
 }
 
+int
+recv_isio(s)
+   int s;
+{
+   reqinfo_t reqinfo;
+
+   /*
+    * All objects sent to mother start with a reqinfo_t, so peek at that.
+    * Any descriptors passed with the object stay queued until the object
+    * is read for real.
+    */
+   if (recv(s, &reqinfo, sizeof(reqinfo), MSG_PEEK) != sizeof(reqinfo))
+      return 0;
+
+   return reqinfo.isio;
+}
+
 int
 send_client(s, _client, buf, buflen)
    int s;
@@ -1194,6 +1282,55 @@ send_client(s, _client, buf, buflen)
    return 0;
 }
 
+int
+send_clients(s, clientv, clientc)
+   int s;
+   const sockd_client_t *clientv;
+   const size_t clientc;
+{
+   const char *function = "send_clients()";
+   struct iovec iovec[1];
+   struct msghdr msg;
+   CMSG_AALLOC(cmsg, sizeof(int) * SOCKD_HANDOFFMAX);
+   size_t i;
+   int fdtosend;
+
+   SASSERTX(clientc > 0);
+   SASSERTX(clientc <= SOCKD_HANDOFFMAX);
+
+   bzero(iovec, sizeof(iovec));
+   iovec[0].iov_base = (void *)clientv;
+   iovec[0].iov_len  = sizeof(*clientv) * clientc;
+
+   fdtosend = 0;
+   for (i = 0; i < clientc; ++i)
+      CMSG_ADDOBJECT(clientv[i].s, cmsg, sizeof(clientv[i].s) * fdtosend++);
+
+   bzero(&msg, sizeof(msg));
+   msg.msg_iov     = iovec;
+   msg.msg_iovlen  = ELEMENTS(iovec);
+   msg.msg_name    = NULL;
+
+   CMSG_SETHDR_SEND(msg, cmsg, sizeof(int) * fdtosend);
+
+   if (sockscf.option.debug >= DEBUG_VERBOSE)
+      slog(LOG_DEBUG, "%s: sending %lu client%s on fd %d ...",
+           function, (unsigned long)clientc, clientc == 1 ? "" : "s", s);
+
+   if (sendmsgn(s, &msg, 0, 0) != (ssize_t)iovec[0].iov_len) {
+      slog(LOG_DEBUG, "%s: sending %lu client%s on fd %d failed: %s",
+           function,
+           (unsigned long)clientc,
+           clientc == 1 ? "" : "s",
+           s,
+           strerror(errno));
+
+      return -1;
+   }
+
+   return 0;
+}
+
 int
 send_req(s, req)
    int s;
@@ -1338,13 +1475,44 @@ maxfreeslots(childtype)
          return 1;
 
       case PROC_NEGOTIATE:
-         return SOCKD_NEGOTIATEMAX;
+         return sockscf.child.maxclients.negotiate;
 
       case PROC_REQUEST:
-         return SOCKD_REQUESTMAX;
+         return sockscf.child.maxclients.request;
 
       case PROC_IO:
-         return SOCKD_IOMAX;
+         return sockscf.child.maxclients.io;
+
+      default:
+         SERRX(childtype);
+   }
+
+   return 0; /* NOTREACHED */
+}
+
+size_t
+minfreeslots(childtype)
+   const int childtype;
+{
+
+   switch (childtype) {
+      case PROC_MONITOR:
+         return 1;
+
+      case PROC_NEGOTIATE:
+         if (sockscf.state.allinone)
+            return 0; /* i/o children do it. */
+
+         return SOCKD_FREESLOTS_NEGOTIATE;
+
+      case PROC_REQUEST:
+         if (sockscf.state.allinone)
+            return 0; /* i/o children do it. */
+
+         return SOCKD_FREESLOTS_REQUEST;
+
+      case PROC_IO:
+         return SOCKD_FREESLOTS_IO;
 
       default:
          SERRX(childtype);
@@ -1383,7 +1551,7 @@ addchild(type)
    size_t *childc;
    char *reason;
    int min, rcvbuf, sndbuf, rcvbuf_set1, rcvbuf_set2, sndbuf_set1, sndbuf_set2,
-       p, optname_sndbuf, optname_rcvbuf, ackpipev[2], datapipev[2];
+       p, optname_sndbuf, optname_rcvbuf, ackpipev[2], datapipev[2], cpuid;
 
    slog(LOG_DEBUG, "%s: type is %s", function, childtype2string(type));
 
@@ -1479,11 +1647,18 @@ addchild(type)
       case PROC_NEGOTIATE:
          /*
           * A negotiator child receives a sockd_client_t struct,
-          * and sends back a sockd_request_t struct.
+          * and sends back a sockd_request_t struct, or a sockd_io_t
+          * struct if it performed the request itself.
           */
-         rcvbuf = (MAX(sizeof(sockd_client_t), sizeof(sockd_request_t))
-                + sizeof(struct msghdr)
-                + CMSG_SPACE(sizeof(int)) * FDPASS_MAX);
+#if SOCKD_FASTCONNECT
+         rcvbuf = MAX(sizeof(sockd_client_t),
+                      MAX(sizeof(sockd_request_t), sizeof(sockd_io_t)));
+#else /* !SOCKD_FASTCONNECT */
+         rcvbuf = MAX(sizeof(sockd_client_t), sizeof(sockd_request_t));
+#endif /* !SOCKD_FASTCONNECT */
+
+         rcvbuf += (sizeof(struct msghdr)
+                 +  CMSG_SPACE(sizeof(int)) * FDPASS_MAX);
 
          rcvbuf += SENDMSG_PADBYTES;
 
@@ -1491,7 +1666,7 @@ addchild(type)
          rcvbuf += (MAX_GSS_STATE + sizeof(struct iovec));
 #endif /* HAVE_GSSAPI */
 
-         sndbuf = rcvbuf * SOCKD_NEGOTIATEMAX;
+         sndbuf = rcvbuf * sockscf.child.maxclients.negotiate;
          break;
 
       case PROC_REQUEST:
@@ -1509,7 +1684,7 @@ addchild(type)
          rcvbuf += (MAX_GSS_STATE + sizeof(struct iovec));
 #endif /* HAVE_GSSAPI */
 
-         sndbuf = rcvbuf * SOCKD_REQUESTMAX;
+         sndbuf = rcvbuf * sockscf.child.maxclients.request;
          break;
 
       case PROC_IO:
@@ -1528,7 +1703,7 @@ addchild(type)
          rcvbuf += (MAX_GSS_STATE + sizeof(struct iovec));
 #endif /* HAVE_GSSAPI */
 
-         sndbuf = rcvbuf * SOCKD_IOMAX;
+         sndbuf = rcvbuf * sockscf.child.maxclients.io;
          break;
 
       default:
@@ -1678,7 +1853,7 @@ addchild(type)
              loggedalready       = local_loggedalready;
              local_loggedalready = 1;
 
-             value = "SOCKD_NEGOTIATEMAX";
+             value = "child.maxclients.negotiate";
              break;
          }
 
@@ -1688,7 +1863,7 @@ addchild(type)
              loggedalready       = local_loggedalready;
              local_loggedalready = 1;
 
-            value = "SOCKD_REQUESTMAX";
+            value = "child.maxclients.request";
             break;
          }
 
@@ -1698,7 +1873,7 @@ addchild(type)
              loggedalready       = local_loggedalready;
              local_loggedalready = 1;
 
-            value = "SOCKD_IOMAX";
+            value = "child.maxclients.io";
             break;
          }
 
@@ -1733,11 +1908,11 @@ addchild(type)
            "buffers for IPC between mother and child processes.  "
            "Requested send size: %d, returned: %d and %d.  "
            "Requested receive size: %d, returned: %d and %d. "
-           "This probably means %s's %s was at compile-time set to a value "
+           "This probably means %s's %s was set to a value "
            "too large for the current kernel settings.  "
            "To avoid this warning you will need to either increase the "
            "kernel's max-size socket buffers somehow, or decrease the %s "
-           "value in %s and recompile.  "
+           "value.  "
            "%s",
            function,
            sndbuf, sndbuf_set1, sndbuf_set2,
@@ -1745,7 +1920,6 @@ addchild(type)
            PRODUCT,
            value,
            value,
-           PRODUCT,
            isfatal ? "" : "We will continue with the smaller buffersize, as "
                           "if our internal maxvalue was reduced, but "
                           "performance might be degraded");
@@ -1773,6 +1947,12 @@ addchild(type)
    slog(LOG_DEBUG, "%s: highest fd in use at the moment: %d",
         function, sockscf.state.highestfdinuse);
 
+   cpuid = -1;
+#if HAVE_SCHED_SETAFFINITY
+   if (type == PROC_IO && sockscf.cpu.io.percpu)
+      cpuid = leastusedcpu(&sockscf.cpu.io.mask);
+#endif /* HAVE_SCHED_SETAFFINITY */
+
    /*
     * Temporarily block signals to avoid mixing up signals to us
     * and to child created as well as any races between child receiving
@@ -1834,9 +2014,10 @@ addchild(type)
          if (sigaction(SIGHUP, &sigact, NULL) != 0)
             serr("%s: could not install signalhandler for SIGHUP", function);
 
-         mother.s           = datapipev[CHILD];
-         mother.ack         = ackpipev[CHILD];
-         sockscf.state.type = type;
+         mother.s            = datapipev[CHILD];
+         mother.ack          = ackpipev[CHILD];
+         sockscf.state.type  = type;
+         sockscf.state.cpuid = cpuid;
 
          newprocinit();
          postconfigloadinit(); /* may be something special for this process. */
@@ -1877,9 +2058,8 @@ addchild(type)
 
             case PROC_NEGOTIATE:
 #if HAVE_LIBWRAP
-#if SOCKD_NEGOTIATEMAX > 1
-               resident = 1;
-#endif /* SOCKD_NEGOTIATEMAX > 1 */
+               if (sockscf.child.maxclients.negotiate > 1)
+                  resident = 1;
 #endif /* HAVE_LIBWRAP */
 
 #if HAVE_PRIVILEGES
@@ -1900,17 +2080,15 @@ addchild(type)
 
             case PROC_REQUEST:
 #if HAVE_LIBWRAP
-#if SOCKD_REQUESTMAX > 1
-               resident = 1;
-#endif /* SOCKD_REQUESTMAX > 1 */
+               if (sockscf.child.maxclients.request > 1)
+                  resident = 1;
 #endif /* HAVE_LIBWRAP */
                break;
 
             case PROC_IO:
 #if HAVE_LIBWRAP
-#if SOCKD_IOMAX > 1
-               resident = 1;
-#endif /* SOCKD_IOMAX > 1 */
+               if (sockscf.child.maxclients.io > 1)
+                  resident = 1;
 #endif /* HAVE_LIBWRAP */
                break;
 
@@ -2011,6 +2189,7 @@ addchild(type)
          (*childv)[*childc].pid            = pid;
          (*childv)[*childc].s              = datapipev[MOTHER];
          (*childv)[*childc].ack            = ackpipev[MOTHER];
+         (*childv)[*childc].cpuid          = cpuid;
 
          close(datapipev[CHILD]);
          close(ackpipev[CHILD]);
@@ -2037,20 +2216,23 @@ addchild(type)
                break;
 
             case PROC_NEGOTIATE:
-               (*childv)[*childc].freec = SOCKD_NEGOTIATEMAX;
+               (*childv)[*childc].freec = sockscf.child.maxclients.negotiate;
                break;
 
             case PROC_REQUEST:
-               (*childv)[*childc].freec = SOCKD_REQUESTMAX;
+               (*childv)[*childc].freec = sockscf.child.maxclients.request;
                break;
 
             case PROC_IO:
-               (*childv)[*childc].freec = SOCKD_IOMAX;
+               (*childv)[*childc].freec = sockscf.child.maxclients.io;
                break;
 
             default:
                SERRX((*childv)[*childc].type);
          }
+
+         /* child keeps this capacity, even if the config changes later. */
+         (*childv)[*childc].maxfreec = (*childv)[*childc].freec;
       }
    }
 
@@ -2058,6 +2240,37 @@ addchild(type)
 }
 
 
+#if HAVE_SCHED_SETAFFINITY
+static int
+leastusedcpu(mask)
+   const cpu_set_t *mask;
+{
+   const char *function = "leastusedcpu()";
+   size_t i, usedc, leastusedc = 0;
+   int cpu, leastused = -1;
+
+   for (cpu = 0; cpu < (int)cpu_get_setsize(); ++cpu) {
+      if (!cpu_isset(cpu, mask))
+         continue;
+
+      for (i = usedc = 0; i < iochildc; ++i)
+         if (iochildv[i].cpuid == cpu && !iochildv[i].waitingforexit)
+            ++usedc;
+
+      if (leastused == -1 || usedc < leastusedc) {
+         leastused  = cpu;
+         leastusedc = usedc;
+      }
+   }
+
+   slog(LOG_DEBUG, "%s: cpu %d has the fewest %ss bound to it (%lu)",
+        function, leastused, childtype2string(PROC_IO),
+        (unsigned long)leastusedc);
+
+   return leastused;
+}
+#endif /* HAVE_SCHED_SETAFFINITY */
+
 static int
 setchildtype(type, childv, childc, function)
    int type;
@@ -112,12 +112,38 @@ io_getset(const int nfds, const fd_set *set);
  *    of this function.
  */
 
+static int
+io_getset_ispartof(sockd_io_t *io, const int s);
+/*
+ * Returns true if "s" is one of the descriptors io_getset() should
+ * consider to be part of "io".
+ */
+
 static sockd_io_t *
 io_finddescriptor(int d);
 /*
  * Finds the io object where one of the descriptors matches "fd".
  */
 
+static int
+io_hasdescriptor(sockd_io_t *io, const int d);
+/*
+ * Returns true if "d" is one of the descriptors belonging to "io".
+ */
+
+static sockd_io_t *
+iofd_get(const int d);
+/*
+ * Returns the io last registered as using descriptor "d", or NULL.
+ * The caller must verify the io is still using "d".
+ */
+
+static void
+iofd_set(const int d, sockd_io_t *io);
+/*
+ * Registers "io" as using descriptor "d".
+ */
+
 static int
 io_fillset(fd_set *set, int antiflags, fd_set *antiflags_set,
            struct timeval *bwoverflowtil);
@@ -206,6 +232,15 @@ io_timeuntiltimeout(sockd_io_t *io, const struct timeval *tnow,
  *    that has timed out.
  */
 
+static void
+io_settimer(sockd_io_t *io);
+/*
+ * Arms or disarms the timer for "io" according to when "io" will
+ * timeout, if ever.  Must be called after anything happens that may
+ * make "io" timeout earlier than previously set; i/o only makes the
+ * timeout later, which is detected when the timer expires.
+ */
+
 static struct timeval *
 io_gettimeout(struct timeval *timeout);
 /*
@@ -221,8 +256,8 @@ io_gettimeout(struct timeval *timeout);
 static sockd_io_t *
 io_gettimedout(void);
 /*
- * Scans all clients for one that has timed out according to sockscf
- * settings.
+ * Checks the clients whose timers have expired for one that has timed
+ * out according to sockscf settings.
  *
  * Returns:
  *      If timed out client found: pointer to timed out i/o object.
@@ -262,6 +297,173 @@ connectstatus(sockd_io_t *io, int *badfd);
  *            otherwise it will be -1.
  */
 
+static void
+io_deletetimedout(void);
+/*
+ * Deletes all i/o objects that have timed out, sending a response to
+ * the client first if appropriate.
+ */
+
+static sockd_io_t *
+io_getfree(size_t *ioi);
+/*
+ * Returns a free slot in iov, and its index in "ioi", or NULL if there
+ * is no free slot.
+ */
+
+static int
+io_setup(sockd_io_t *io, const size_t ioi);
+/*
+ * Sets up "io", newly received and stored at index "ioi" of iov, for
+ * i/o by us.
+ * Returns 0 on success, or -1 if "io" could not be set up, in which case
+ * it has not been added.
+ */
+
+#if SOCKD_ALLINONE
+
+static void
+allinone_init(void);
+/*
+ * Sets up the negotiate and request stages of this process, which with
+ * child.allinone run as part of our select(2) loop.
+ */
+
+static size_t
+allinone_freec(void);
+/*
+ * Returns the number of new clients we have room for.  A client uses
+ * one of our iomax slots from it is accepted until its session ends,
+ * whatever stage it is in.
+ */
+
+static size_t
+allinone_clients(void);
+/*
+ * Returns the number of clients in the negotiate and request stages.
+ */
+
+static int
+allinone_fdset(int fdbits, fd_set *rset, fd_set *bufrset, fd_set *wset);
+/*
+ * Adds the descriptors of the negotiate and request stages to "rset",
+ * "bufrset" (if not NULL) and "wset", remembering which they were.
+ * Returns the highest descriptor set, or "fdbits" if that is higher.
+ */
+
+static struct timeval *
+allinone_gettimeout(struct timeval *iotimeout, struct timeval *timeout);
+/*
+ * Fills in "timeout" with the shorter of "iotimeout" and the time until
+ * the negotiate or request stage needs to be called again.
+ * Returns "timeout", or NULL if there is no timeout.
+ */
+
+static int
+allinone_process(const int nfds, fd_set *rset, fd_set *bufrset, fd_set *wset);
+/*
+ * Removes the descriptors of the negotiate and request stages from
+ * "rset", "bufrset" (if not NULL) and "wset", as returned by select(2),
+ * and lets the stages handle the ones set.  Ios set up by the request
+ * stage are then added to our own.
+ *
+ * Returns true if any descriptor of the stages was set or any io added,
+ * in which case the caller should regenerate its fd_sets before doing
+ * i/o.
+ */
+
+#if HAVE_IOPOLL
+static size_t
+allinone_pollset(const int set, fd_set *bufrset);
+/*
+ * If "set" is true, registers the descriptors of the negotiate and
+ * request stages, as last added by allinone_fdset(), with iopoll.
+ * Descriptors with data already buffered for read are also added to
+ * "bufrset".  If "set" is false, the descriptors are removed from iopoll
+ * again, which must be done before the stages are called, as they may
+ * close them or hand them over to us as ios.
+ *
+ * Returns the number of descriptors added to "bufrset".
+ */
+#endif /* HAVE_IOPOLL */
+
+#endif /* SOCKD_ALLINONE */
+
+typedef struct {
+   size_t         bytes;   /* bytes transferred since last sync.            */
+   struct timeval lastio;  /* time of last i/o.                             */
+} monitorside_t;
+
+typedef struct {
+   unsigned long   mstats_shmid; /* monitor the counters are for.           */
+   shmem_object_t  *mstats;      /* only attached while syncing.            */
+
+   struct timeval  firstio;      /* first i/o not yet synced.               */
+   size_t          bytes;        /* sum of bytes over all sides.            */
+
+   monitorside_t   i_recv, i_send, e_recv, e_send;
+} monitorsync_t;
+
+static void
+io_syncmonitor(monitorsync_t *counters, shmem_object_t *mstats);
+/*
+ * Adds "counters" to the monitor "mstats", which must be the one
+ * "counters" is for.
+ */
+
+static void
+io_syncmonitors(const int force);
+/*
+ * Syncs to shared memory all counters in monitorsyncv that have been
+ * kept for longer than SOCKD_MONITORSYNC_MS, or all of them if "force"
+ * is set, and removes them from monitorsyncv.
+ */
+
+#if HAVE_CONTROL_CONNECTION
+static iostatus_t
+io_readcontrol(sockd_io_t *io);
+/*
+ * Reads from the control connection of "io", which should be readable.
+ * The only thing we expect from the client on the control connection
+ * is an EOF, which means the session should be closed.
+ *
+ * Returns IO_NOERROR if the session should continue, or the reason
+ * the session should be closed otherwise.  In the latter case the
+ * caller should delete "io".
+ */
+#endif /* HAVE_CONTROL_CONNECTION */
+
+#if HAVE_IOPOLL
+
+static void
+io_pollloop(void);
+/*
+ * The main i/o loop used instead of the select(2)-based one in run_io()
+ * when we have epoll(7).  Does not return.
+ */
+
+static void
+io_pollevents(sockd_io_t *io, fd_set *rset, fd_set *wset);
+/*
+ * Does what i/o we can on "io", based on the events recorded for it
+ * in the current iteration of io_pollloop().  "rset" and "wset" are
+ * scratch sets of the size expected by doio_tcp() and doio_udp(), with
+ * no descriptors set.
+ *
+ * If an error occurs, "io" is deleted.
+ */
+
+static void
+io_setinterest(sockd_io_t *io);
+/*
+ * Updates what events we want to be notified about for the descriptors
+ * belonging to the i/o object "io", based on its current state.  Must
+ * be called each time the state of "io" may have changed in a way that
+ * affects what we want to do with it next.
+ */
+
+#endif /* HAVE_IOPOLL */
+
 #if SOCKS_SERVER
 
 /*
@@ -279,14 +481,14 @@ connectstatus(sockd_io_t *io, int *badfd);
  * on a per-packet basis (except in Dante when we have connected to the
  * destination).
  */
-static rule_t fwdrulev[SOCKD_IOMAX];
-static rule_t replyrulev[SOCKD_IOMAX];
+static rule_t *fwdrulev;
+static rule_t *replyrulev;
 
 /*
  * Each udpsession can have up to two target sockets.  One for IPv4 and
  * one for IPv6.
  */
-udptarget_t udptargetv[SOCKD_IOMAX][2];
+udptarget_t (*udptargetv)[2];
 
 #endif /* SOCKS_SERVER */
 
@@ -303,10 +505,30 @@ do {                                                   \
    io_clearset((io), (clearalltargets), xset);         \
 } while (/* CONSTCOND */ 0)
 
-sockd_io_t   iov[SOCKD_IOMAX];   /* each child has these ios. */
-const size_t ioc = ELEMENTS(iov);
+/*
+ * Each child has room for iomax ios, as configured when it started.
+ * ioc is the number of slots in iov used so far, so untouched parts of
+ * iov, and the arrays indexed the same way, need not be resident.
+ */
+sockd_io_t   *iov;
+size_t       ioc;
+static size_t iomax;
 iostate_t iostate;
 
+/*
+ * The io using a given descriptor, indexed by descriptor.  Only a hint;
+ * io_finddescriptor() and io_getset() verify it before use and fall back
+ * to searching iov if it is wrong.
+ */
+static sockd_io_t **iofdv;
+static size_t     iofdc;
+
+/*
+ * Timers for when the ios in iov may timeout, indexed the same way.
+ */
+static sockd_timer_t *iotimerv;
+static timerwheel_t  iotimers;
+
 /*
  * if not 0, we have "overflowed" according to max bandwidth configured.
  * We can not attribute it to any given client though, so we penalize
@@ -316,6 +538,57 @@ iostate_t iostate;
  */
 static struct timeval bwoverflowtil;
 
+/*
+ * Data counters for monitors not yet added to the monitors in shmem.
+ */
+static monitorsync_t monitorsyncv[SOCKD_MONITORSYNC_MAX];
+static size_t        monitorsyncc;
+
+#if HAVE_IOPOLL
+/*
+ * State we only need when using epoll(7).  Indexed the same way as iov.
+ */
+static struct {
+   unsigned char control;   /* IOPOLL_* events reported on control.s.     */
+   unsigned char src;       /* IOPOLL_* events reported on src.s.         */
+   unsigned char dst;       /* IOPOLL_* events reported on dst.s (tcp).   */
+   int           udpreadv[2]; /* udp target sockets reported readable.    */
+   size_t        udpreadc;
+
+   unsigned char touched;   /* any events for this io in current batch?   */
+   unsigned char pending;   /* have data buffered for read; no event.     */
+   unsigned char throttled; /* i/o disabled due to bandwidth overflow.    */
+} *iopollv;
+
+static size_t iopendingc;   /* number of ios with pending set.            */
+static size_t iothrottledc; /* number of ios with throttled set.          */
+#endif /* HAVE_IOPOLL */
+
+#if SOCKD_ALLINONE
+/*
+ * Ios the request stage has handed us, waiting to be set up until the
+ * request stage is done with the descriptors in them.
+ */
+static sockd_io_t *pendingiov;
+static size_t     pendingioc;
+
+/*
+ * The descriptors of the negotiate and request stages, as last added to
+ * our fd_sets, and the ones of those reported as ready.
+ */
+static fd_set *stagerset, *stagebufrset, *stagewset;
+static fd_set *stagereadyrset, *stagereadywset;
+static int    stagebits;
+
+#if HAVE_IOPOLL
+/*
+ * Registered with iopoll as the data of the descriptors of the
+ * negotiate and request stages, to tell them from descriptors of ios.
+ */
+static char stagepollmark;
+#endif /* HAVE_IOPOLL */
+#endif /* SOCKD_ALLINONE */
+
 void
 run_io()
 {
@@ -323,7 +596,10 @@ run_io()
    struct sigaction sigact;
    fd_set *rset, *wset, *xset, *newrset, *tmpset, *bufrset, *buffwset, *udprset,
           *zeroset;
-   int p, mayhavetimedout;
+   int p;
+#if HAVE_IOPOLL
+   int usepoll;
+#endif /* HAVE_IOPOLL */
 #if DIAGNOSTIC && 0 /* XXX not fully tested yet. */
    size_t freefds_initially, logfds_initially;
 #endif /* DIAGNOSTIC */
@@ -341,6 +617,23 @@ run_io()
    if (sigaction(SIGUSR1, &sigact, NULL) != 0)
       serr("%s: sigaction(SIGUSR1)", function);
 
+   iomax = iostate.maxclients = sockscf.child.maxclients.io;
+   if ((iov        = calloc(iomax, sizeof(*iov)))        == NULL
+   ||  (iotimerv   = calloc(iomax, sizeof(*iotimerv)))   == NULL
+#if SOCKS_SERVER
+   ||  (fwdrulev   = calloc(iomax, sizeof(*fwdrulev)))   == NULL
+   ||  (replyrulev = calloc(iomax, sizeof(*replyrulev))) == NULL
+   ||  (udptargetv = calloc(iomax, sizeof(*udptargetv))) == NULL
+#endif /* SOCKS_SERVER */
+#if HAVE_IOPOLL
+   ||  (iopollv    = calloc(iomax, sizeof(*iopollv)))    == NULL
+#endif /* HAVE_IOPOLL */
+   )
+      serr("%s: failed to allocate memory for %lu clients",
+           function, (unsigned long)iomax);
+
+   timerwheel_init(&iotimers, time_monotonic(NULL));
+
 #if HAVE_UDP_SUPPORT
    sockd_priv(SOCKD_PRIV_NET_ICMPACCESS, PRIV_ON);
    if ((rawsocket = socket(AF_INET, SOCK_RAW, IPPROTO_ICMP)) == -1)
@@ -406,12 +699,25 @@ run_io()
 
    proctitleupdate();
 
-   iostate.freefds = (size_t)freedescriptors(NULL, NULL);
+#if SOCKD_ALLINONE
+   if (sockscf.state.allinone)
+      allinone_init();
+#endif /* SOCKD_ALLINONE */
 
-   mayhavetimedout = 0;
+#if HAVE_IOPOLL
+   /* before counting free descriptors, as the epoll(7) one uses one. */
+   usepoll = (iopoll_init() == 0);
+#endif /* HAVE_IOPOLL */
+
+   iostate.freefds = (size_t)freedescriptors(NULL, NULL);
 
    sockd_print_child_ready_message(iostate.freefds);
 
+#if HAVE_IOPOLL
+   if (usepoll)
+      io_pollloop(); /* does not return. */
+#endif /* HAVE_IOPOLL */
+
 #if DIAGNOSTIC && 0 /* XXX not fully tested yet. */
    freefds_initially = iostate.freefds;
    logfds_initially
@@ -481,31 +787,11 @@ run_io()
 
       errno = 0; /* reset for each iteration. */
 
-      /* look for timed-out clients and calculate the next timeout, if any. */
-      if (mayhavetimedout) {
-         while ((io = io_gettimedout()) != NULL) {
-#if HAVE_NEGOTIATE_PHASE
-            if (io_connectisinprogress(io)
-            && (SOCKS_SERVER || io->reqflags.httpconnect)) {
-               response_t response;
-
-               create_response(NULL,
-                               &io->src.auth,
-                               io->state.proxyprotocol,
-                               (int)sockscode(io->state.proxyprotocol,
-                                              SOCKS_TTLEXPIRED),
-                               &response);
-
-               if (send_response(io->src.s, &response) != 0)
-                  errno = 0; /* real error is the timeout. */
-            }
-#endif /* HAVE_NEGOTIATE_PHASE */
+      /* look for timed-out clients. */
+      io_deletetimedout();
 
-            io_delete(sockscf.state.mother.ack, io, -1, IO_TIMEOUT);
-         }
-      }
+      io_syncmonitors(0);
 
-      mayhavetimedout = 0;
       rbits           = io_fillset(rset, MSG_OOB, xset, &bwoverflowtil);
 
       /*
@@ -531,13 +817,19 @@ run_io()
          rbits = MAX(rbits, sockscf.state.mother.ack);
       }
       else { /* no mother.  Do we have any other descriptors to work with? */
-         if (rbits == -1 && !timerisset(&bwoverflowtil)) {
+         if (rbits == -1 && !timerisset(&bwoverflowtil)
+#if SOCKD_ALLINONE
+         && !(sockscf.state.allinone && allinone_clients() > 0)
+#endif /* SOCKD_ALLINONE */
+         ) {
             /* no clients in fd_sets, and not due to bwoverflow ... */
             SASSERTX(io_allocated(NULL, NULL, NULL, NULL) == 0);
 
             slog(LOG_DEBUG, "%s: no connection to mother, no clients; exiting",
                  function);
 
+            io_syncmonitors(1);
+
 #if HAVE_VALGRIND_VALGRIND_H
          if (RUNNING_ON_VALGRIND) {
             /* for some reason Valgrind complains the rset pointer is lost. */
@@ -573,6 +865,15 @@ run_io()
 
       wbits               = io_fillset_connectinprogress(wset);
       newsocketsconnected = 0;
+      timeoutpointer      = io_gettimeout(&timeout);
+
+#if SOCKD_ALLINONE
+      if (sockscf.state.allinone) {
+         rbits          = allinone_fdset(MAX(rbits, wbits), rset, bufrset, wset);
+         timeoutpointer = allinone_gettimeout(timeoutpointer, &timeout);
+      }
+#endif /* SOCKD_ALLINONE */
+
       bits                = MAX(rbits, wbits) + 1;
 
       slog(LOG_DEBUG, "%s: first select; readable/connected?", function);
@@ -582,13 +883,17 @@ run_io()
                       buffwset,
                       wset,
                       xset,
-                      io_gettimeout(&timeout))) {
+                      timeoutpointer)) {
          case -1:
             SASSERT(ERRNOISTMP(errno));
             continue;
 
          case 0:
-            mayhavetimedout = 1;
+#if SOCKD_ALLINONE
+            if (sockscf.state.allinone) /* stages may have timers expired. */
+               (void)allinone_process(bits, rset, bufrset, wset);
+#endif /* SOCKD_ALLINONE */
+
             continue; /* restart the loop. */
       }
 
@@ -642,6 +947,11 @@ run_io()
          }
       }
 
+#if SOCKD_ALLINONE
+      if (sockscf.state.allinone && allinone_process(bits, rset, bufrset, wset))
+         continue; /* stages may have added or removed descriptors. */
+#endif /* SOCKD_ALLINONE */
+
       first_rbits = bits;
 
       /*
@@ -896,8 +1206,6 @@ run_io()
              * Since it doesn't have any side to forward the data to
              * it is simpler to handle it here and now.
              */
-            ssize_t r;
-            char buf[1024];
 
             SASSERTX(io->control.s == p);
             SASSERTX(io->control.s != io->src.s);
@@ -905,69 +1213,14 @@ run_io()
 
             sockettoset = io->control.s;
 
-            SASSERTX(io->state.command  == SOCKS_UDPASSOCIATE
-            ||       (io->state.command == SOCKS_BINDREPLY
-                 &&   io->state.extension.bind));
-
-            /*
-             * Only thing we expect from client's control connection is
-             * an eof.
-             */
-            r = socks_recvfrom(io->control.s,
-                               buf,
-                               sizeof(buf),
-                               0,
-                               NULL,
-                               NULL,
-                               NULL,
-                               &io->control.auth);
-
-            if (r <= 0) {
-               slog(LOG_DEBUG,
-                    "%s: TCP control connection from client %s closed: %s",
-                    function,
-                    sockaddr2string(&CONTROLIO(io)->raddr, NULL, 0),
-                    r == 0 ? "EOF" : strerror(errno));
-
-               if (io->srule.mstats_shmid != 0
-               &&  (io->srule.alarmsconfigured & ALARM_DISCONNECT)) {
-                  clientinfo_t cinfo;
-
-                  cinfo.from = io->control.raddr;
-                  HOSTIDCOPY(&io->state, &cinfo);
-
-                  SASSERTX(!io->control.state.alarmdisconnectdone);
-                  alarm_add_disconnect(0,
-                                       &io->srule,
-                                       ALARM_INTERNAL,
-                                       &cinfo,
-                                       r == 0 ? "EOF" : strerror(errno),
-                                       sockscf.shmemfd);
-
-                  io->control.state.alarmdisconnectdone = 1;
-               }
-
+            if ((iostatus = io_readcontrol(io)) != IO_NOERROR) {
                IO_CLEAR_ALL_SETS(io, 1);
-
                io_delete(sockscf.state.mother.ack,
                          io,
                          io->control.s,
-                         r == 0 ? IO_CLOSE : IO_IOERROR);
+                         iostatus);
             }
             else {
-               char visbuf[256];
-
-               slog(LOG_NOTICE, "%s: %ld unexpected byte%s over control "
-                                "connection from client %s: %s",
-                                function,
-                                (long)r,
-                                r == 1 ? "" : "s",
-                                sockaddr2string(&CONTROLIO(io)->raddr, NULL, 0),
-                                str2vis(buf,
-                                        (size_t)r,
-                                        visbuf,
-                                        sizeof(visbuf)));
-
                FD_CLR(io->control.s, rset);
 
                FD_SET(io->control.s, newrset);
@@ -987,9 +1240,24 @@ run_io()
          timeoutpointer = &timeout;
          bzero(timeoutpointer, sizeof(*timeoutpointer));
       }
-      else
+      else {
          timeoutpointer = io_gettimeout(&timeout);
 
+#if SOCKD_ALLINONE
+         if (sockscf.state.allinone)
+            timeoutpointer = allinone_gettimeout(timeoutpointer, &timeout);
+#endif /* SOCKD_ALLINONE */
+      }
+
+#if SOCKD_ALLINONE
+      /*
+       * Stage descriptors that become ready while we wait for writability
+       * are also a status change to loop around for.
+       */
+      if (sockscf.state.allinone)
+         rbits = allinone_fdset(rbits, newrset, NULL, wset);
+#endif /* SOCKD_ALLINONE */
+
       ++rbits;
       ++wbits;
 
@@ -1015,9 +1283,6 @@ run_io()
          case -1:
             SASSERT(ERRNOISTMP(errno));
             continue;
-
-         case 0:
-            mayhavetimedout = 1;
       }
 
       if (sockscf.state.mother.ack != -1
@@ -1030,6 +1295,11 @@ run_io()
          getnewios();
       }
 
+#if SOCKD_ALLINONE
+      if (sockscf.state.allinone && allinone_process(bits, newrset, NULL, wset))
+         continue; /* as above. */
+#endif /* SOCKD_ALLINONE */
+
       /*
        * If newrset has any udp i/os, add them to udprset.
        */
@@ -1166,6 +1436,9 @@ run_io()
 
             if (io->src.s != -1)
                FD_CLR(io->src.s, udprset);
+
+            if (io->allocated)
+               io_settimer(io);
          }
          else {
             /*
@@ -1186,6 +1459,8 @@ run_io()
 
             if (IOSTATUS_FATALERROR(iostatus) && badfd != -1)
                io_delete(sockscf.state.mother.ack, io, badfd, iostatus);
+            else
+               io_settimer(io);
          }
 
 #else /* Dante */
@@ -1207,6 +1482,8 @@ run_io()
 
          if (IOSTATUS_FATALERROR(iostatus))
             io_delete(sockscf.state.mother.ack, io, badfd, iostatus);
+         else
+            io_settimer(io);
 
 #endif /* Dante */
       }
@@ -1258,6 +1535,8 @@ run_io()
 
          if (IOSTATUS_FATALERROR(iostatus))
             io_delete(sockscf.state.mother.ack, io, badfd, iostatus);
+         else
+            io_settimer(io);
       }
 
 #if BAREFOOTD
@@ -1281,57 +1560,741 @@ run_io()
    }
 }
 
-void
-io_preconfigload(void)
+#if HAVE_IOPOLL
+
+static void
+io_pollloop(void)
 {
-   const char *function = "io_preconfigload()";
+   const char *function = "io_pollloop()";
+   /*
+    * Up to four descriptors per io (control, src and two udp targets),
+    * but normally only a few will be ready at the same time.  Any not
+    * returned in this batch will be returned in the next one.
+    */
+   iopollevent_t *eventv;
+   fd_set *rset, *wset;
+   size_t *touchedv, eventvc;
+#if SOCKD_ALLINONE
+   /*
+    * With child.allinone, the descriptors of the negotiate and request
+    * stages are polled together with our own.  "readystagerset" and
+    * "readystagewset" are the stage descriptors found ready, to be passed
+    * on to the stages.
+    */
+   struct timeval stagedeadline;
+   fd_set *readystagerset, *readystagewset;
+   size_t stagesready;
+   int stagesdirty, stageshadroom;
+#endif /* SOCKD_ALLINONE */
+
+   slog(LOG_DEBUG, "%s: using epoll(7) for i/o", function);
+
+   eventvc = iomax * 2 + 2;
+   if ((eventv   = malloc(sizeof(*eventv) * eventvc)) == NULL
+   ||  (touchedv = malloc(sizeof(*touchedv) * iomax)) == NULL)
+      serr("%s: failed to allocate memory for epoll events", function);
+
+   rset = allocate_maxsize_fdset();
+   wset = allocate_maxsize_fdset();
+
+   FD_ZERO(rset);
+   FD_ZERO(wset);
+
+#if SOCKD_ALLINONE
+   readystagerset = allocate_maxsize_fdset();
+   readystagewset = allocate_maxsize_fdset();
+
+   FD_ZERO(readystagerset);
+   FD_ZERO(readystagewset);
+
+   timerclear(&stagedeadline);
+   stagesready   = 0;
+   stagesdirty   = 1; /* nothing registered yet. */
+   stageshadroom = 0;
+#endif /* SOCKD_ALLINONE */
+
+   if (sockscf.state.mother.s != -1) {
+      if (iopoll_set(sockscf.state.mother.s, IOPOLL_READ, NULL) != 0
+      ||  iopoll_set(sockscf.state.mother.ack, IOPOLL_READ, NULL) != 0)
+         serrx("%s: could not add descriptors from mother to epoll set",
+               function);
+   }
 
-   slog(LOG_DEBUG, "%s", function);
-}
+   /* CONSTCOND */
+   while (1) {
+      /*
+       * Unlike the select(2)-based loop, we do not need two passes to
+       * avoid busy-looping on readable descriptors we can not write the
+       * data from to the other side.  Rather than asking the kernel for
+       * readability on all descriptors every time, we only register
+       * interest in reading from a descriptor as long as the other side
+       * has no data buffered for write, and register interest in
+       * writability only for descriptors that have data buffered for
+       * write.
+       *
+       * We therefore consider the other side writable as long as it has
+       * no data buffered; whatever we read that can not be written is
+       * buffered by socks_sendto(), and we then stop reading until the
+       * buffer has been flushed.
+       */
+      struct timeval timeout, *timeoutpointer;
+      size_t touchedc, i;
+      int eventc, motherreadable, ackreadable, stagedue;
 
-void
-io_postconfigload(void)
-{
-   const char *function = "io_postconfigload()";
-   size_t i;
+      errno = 0; /* reset for each iteration. */
 
-   slog(LOG_DEBUG, "%s: ioc = %ld", function, (long)ioc);
+      io_deletetimedout();
 
-   for (i = 0; i < ioc; ++i) {
-      if (!iov[i].allocated)
-         continue;
+      io_syncmonitors(0);
 
-      io_updatemonitor(&iov[i]);
+      if (sockscf.state.mother.s == -1
+      &&  io_allocated(NULL, NULL, NULL, NULL) == 0
+#if SOCKD_ALLINONE
+      && !(sockscf.state.allinone && allinone_clients() > 0)
+#endif /* SOCKD_ALLINONE */
+      ) {
+         slog(LOG_DEBUG, "%s: no connection to mother, no clients; exiting",
+              function);
 
-      if (iov[i].state.protocol == SOCKS_TCP)
+         io_syncmonitors(1);
+         sockdexit(EXIT_SUCCESS);
+      }
+
+      if (iothrottledc > 0) {
+         struct timeval tnow;
+
+         gettimeofday_monotonic(&tnow);
+
+         if (!timerisset(&bwoverflowtil)
+         ||  !timercmp(&tnow, &bwoverflowtil, <)) {
+            /*
+             * time for at least one of the ios we disabled due to
+             * bandwidth overflow to be enabled again.  Check them all.
+             */
+            timerclear(&bwoverflowtil);
+
+            for (i = 0; i < ioc && iothrottledc > 0; ++i)
+               if (iov[i].allocated && iopollv[i].throttled)
+                  io_setinterest(&iov[i]);
+         }
+      }
+
+#if SOCKD_ALLINONE
+      if (sockscf.state.allinone
+      && (stagesdirty || (allinone_freec() > 0) != stageshadroom)) {
+         /*
+          * The stages have run since we last registered their descriptors,
+          * or whether we have room for new clients, and so whether they
+          * should listen for them, has changed.  Find out what descriptors
+          * they want to wait for now.
+          */
+         struct timeval stagetimeout;
+
+         if (!stagesdirty) /* else removed already, before they ran. */
+            (void)allinone_pollset(0, NULL);
+
+         stageshadroom = (allinone_freec() > 0);
+         (void)allinone_fdset(-1, readystagerset, NULL, readystagewset);
+
+         FD_ZERO(readystagerset);
+         FD_ZERO(readystagewset);
+
+         stagesready = allinone_pollset(1, readystagerset);
+         stagesdirty = 0;
+
+         if (allinone_gettimeout(NULL, &stagetimeout) == NULL)
+            timerclear(&stagedeadline);
+         else {
+            gettimeofday_monotonic(&stagedeadline);
+            timeradd(&stagedeadline, &stagetimeout, &stagedeadline);
+         }
+      }
+#endif /* SOCKD_ALLINONE */
+
+      if (iopendingc > 0
+#if SOCKD_ALLINONE
+      ||  stagesready > 0
+#endif /* SOCKD_ALLINONE */
+      ) {
+         /* have data buffered for read; don't wait for anything more. */
+         timeoutpointer = &timeout;
+         bzero(timeoutpointer, sizeof(*timeoutpointer));
+      }
+      else
+         timeoutpointer = io_gettimeout(&timeout);
+
+#if SOCKD_ALLINONE
+      if (timerisset(&stagedeadline)) {
+         struct timeval tnow, stagetimeout;
+
+         gettimeofday_monotonic(&tnow);
+
+         if (timercmp(&tnow, &stagedeadline, <))
+            timersub(&stagedeadline, &tnow, &stagetimeout);
+         else
+            timerclear(&stagetimeout);
+
+         if (timeoutpointer == NULL || timercmp(&stagetimeout, &timeout, <)) {
+            timeout        = stagetimeout;
+            timeoutpointer = &timeout;
+         }
+      }
+#endif /* SOCKD_ALLINONE */
+
+      if ((eventc = iopoll_wait(eventv, eventvc, timeoutpointer))
+      == -1) {
+         SASSERT(ERRNOISTMP(errno));
          continue;
+      }
 
-      SASSERTX(iov[i].state.protocol == SOCKS_UDP);
+      stagedue = 0;
 
-      /*
-       * In the UDP case we should check rules on each packet, so indicate
-       * we should not reuse the saved rules after sighup, which may have
-       * changed the ACLs.
-       * XXX ideally we would also do a rulespermit() to remove clients that
-       * no longer have any hope if being allowed to pass packets through.
-       */
+#if SOCKD_ALLINONE
+      if (timerisset(&stagedeadline)) {
+         struct timeval tnow;
 
-#if !BAREFOOTD
-      iov[i].src.state.use_saved_srule = 0;
-      iov[i].dst.state.use_saved_srule = 0;
+         gettimeofday_monotonic(&tnow);
+         stagedue = !timercmp(&tnow, &stagedeadline, <);
+      }
+
+      stagedue = stagedue || stagesready > 0;
+#endif /* SOCKD_ALLINONE */
+
+      if (eventc == 0 && iopendingc == 0 && !stagedue)
+         continue;
 
-#else /* BAREFOOTD */
       /*
-       * Nothing to do.  Those clients that were permitted we continue
-       * to permit.
+       * First record what events we got for each io.  We do not do any
+       * i/o until we have gone through all events, so that we can handle
+       * both directions of an io in one go, and so that no io is deleted
+       * while we still have events referring to it.
        */
+      touchedc       = 0;
+      motherreadable = ackreadable = 0;
 
-      slog(LOG_DEBUG, "%s: iov #%ld, dstc = %ld",
-           function, (long)ioc, (long)iov[i].dst.dstc);
-#endif /* BAREFOOTD */
-   }
+      for (i = 0; i < (size_t)eventc; ++i) {
+         const int fd = eventv[i].fd;
+         sockd_io_t *io;
+         size_t ioi;
 
-#if BAREFOOTD
+#if SOCKD_ALLINONE
+         if (eventv[i].data == &stagepollmark) {
+            if (eventv[i].events & (IOPOLL_READ | IOPOLL_EXCEPTION))
+               FD_SET(fd, readystagerset);
+
+            if (eventv[i].events & IOPOLL_WRITE)
+               FD_SET(fd, readystagewset);
+
+            stagedue = 1;
+            continue;
+         }
+#endif /* SOCKD_ALLINONE */
+
+         if (eventv[i].data == NULL) {
+            if (fd == sockscf.state.mother.ack)
+               ackreadable = 1;
+            else {
+               SASSERTX(fd == sockscf.state.mother.s);
+               motherreadable = 1;
+            }
+
+            continue;
+         }
+
+         io  = eventv[i].data;
+         ioi = io - iov;
+
+         SASSERTX(ioi < ioc);
+         SASSERTX(io->allocated);
+
+         if (fd == io->control.s)
+            iopollv[ioi].control |= eventv[i].events;
+         else if (fd == io->src.s)
+            iopollv[ioi].src |= eventv[i].events;
+         else if (io->state.protocol == SOCKS_TCP) {
+            SASSERTX(fd == io->dst.s);
+            iopollv[ioi].dst |= eventv[i].events;
+         }
+         else {
+            SASSERTX(io->state.protocol == SOCKS_UDP);
+            SASSERTX(iopollv[ioi].udpreadc < ELEMENTS(iopollv[ioi].udpreadv));
+
+            iopollv[ioi].udpreadv[iopollv[ioi].udpreadc++] = fd;
+         }
+
+         if (!iopollv[ioi].touched) {
+            iopollv[ioi].touched  = 1;
+            touchedv[touchedc++] = ioi;
+         }
+      }
+
+      if (iopendingc > 0) {
+         /*
+          * These ios have data buffered for read, which the kernel does
+          * not know about, so add them too.
+          */
+         for (i = 0; i < ioc && iopendingc > 0; ++i) {
+            if (!iopollv[i].pending)
+               continue;
+
+            iopollv[i].pending = 0; /* io_setinterest() sets it again. */
+            --iopendingc;
+
+            if (!iov[i].allocated || iopollv[i].touched)
+               continue;
+
+            iopollv[i].touched   = 1;
+            touchedv[touchedc++] = i;
+         }
+      }
+
+      for (i = 0; i < touchedc; ++i) {
+         sockd_io_t *io = &iov[touchedv[i]];
+
+         iopollv[touchedv[i]].touched = 0;
+
+         if (io->allocated)
+            io_pollevents(io, rset, wset);
+      }
+
+#if SOCKD_ALLINONE
+      if (stagedue) {
+         /*
+          * The stages may close their descriptors, or hand them over to
+          * us as ios, so they must be removed before the stages run, and
+          * registered again afterwards.
+          */
+         (void)allinone_pollset(0, NULL);
+         (void)allinone_process(stagebits + 1,
+                                readystagerset,
+                                NULL,
+                                readystagewset);
+
+         FD_ZERO(readystagerset);
+         FD_ZERO(readystagewset);
+
+         stagesready = 0;
+         stagesdirty = 1;
+      }
+#endif /* SOCKD_ALLINONE */
+
+      if (ackreadable) { /* only eof expected. */
+         sockd_readmotherscontrolsocket(function, sockscf.state.mother.ack);
+
+         /* will remain readable, so must be removed. */
+         (void)iopoll_set(sockscf.state.mother.s, 0, NULL);
+         (void)iopoll_set(sockscf.state.mother.ack, 0, NULL);
+
+         sockscf.state.mother.s = sockscf.state.mother.ack = -1;
+
+         /*
+          * this process can continue independent of mother as long as it
+          * has clients, because each client has it's own unique
+          * udp socket on the client-side also.
+          */
+         continue;
+      }
+
+      if (motherreadable) {
+         if (getnewios() != -1)
+            proctitleupdate();
+      }
+   }
+}
+
+static void
+io_pollevents(io, rset, wset)
+   sockd_io_t *io;
+   fd_set *rset;
+   fd_set *wset;
+{
+   const char *function = "io_pollevents()";
+   const size_t ioi = io - iov;
+   const int control = iopollv[ioi].control,
+             src     = iopollv[ioi].src,
+             dst     = iopollv[ioi].dst;
+   iostatus_t iostatus;
+   int srcread, srcwrite, dstread, dstwrite, flags, badfd;
+
+   iopollv[ioi].control = iopollv[ioi].src = iopollv[ioi].dst = 0;
+
+   slog(LOG_DEBUG,
+        "%s: io #%lu, events control/src/dst: 0x%x/0x%x/0x%x, %lu udp",
+        function,
+        (unsigned long)ioi,
+        control,
+        src,
+        dst,
+        (unsigned long)iopollv[ioi].udpreadc);
+
+#if HAVE_CONTROL_CONNECTION
+   if ((control & IOPOLL_READ)
+   ||  (io->control.s != -1
+     && socks_bytesinbuffer(io->control.s, READ_BUF, 0) > 0)) {
+      if ((iostatus = io_readcontrol(io)) != IO_NOERROR) {
+         iopollv[ioi].udpreadc = 0;
+         io_delete(sockscf.state.mother.ack, io, io->control.s, iostatus);
+
+         return;
+      }
+   }
+#endif /* HAVE_CONTROL_CONNECTION */
+
+#if HAVE_UDP_SUPPORT
+   if (io->state.protocol == SOCKS_UDP) {
+      const size_t udpreadc = iopollv[ioi].udpreadc;
+      int udpreadv[ELEMENTS(iopollv[ioi].udpreadv)];
+      size_t i;
+
+      memcpy(udpreadv, iopollv[ioi].udpreadv, sizeof(udpreadv));
+      iopollv[ioi].udpreadc = 0;
+
+      if (src & IOPOLL_READ) {
+         /* will have to demux later based on packet read from src. */
+         io->dst.s = -1;
+
+         FD_SET(io->src.s, rset);
+         iostatus = doio_udp(io, rset, &badfd);
+         FD_CLR(io->src.s, rset);
+
+         if (IOSTATUS_FATALERROR(iostatus)) {
+            io_delete(sockscf.state.mother.ack, io, badfd, iostatus);
+            return;
+         }
+      }
+
+      for (i = 0; i < udpreadc; ++i) {
+         udptarget_t *target;
+
+         if ((target = clientofsocket(udpreadv[i],
+                                      io->dst.dstc,
+                                      io->dst.dstv)) == NULL)
+            continue;
+
+         io_syncudp(io, target);
+         SASSERTX(io->dst.s == udpreadv[i]);
+
+         FD_SET(io->dst.s, rset);
+         iostatus = doio_udp(io, rset, &badfd);
+         FD_CLR(udpreadv[i], rset);
+
+         if (IOSTATUS_FATALERROR(iostatus)) {
+            io_delete(sockscf.state.mother.ack, io, badfd, iostatus);
+            return;
+         }
+      }
+
+      io_settimer(io);
+      io_setinterest(io);
+      return;
+   }
+#endif /* HAVE_UDP_SUPPORT */
+
+   SASSERTX(io->state.protocol == SOCKS_TCP);
+
+   if (io_connectisinprogress(io)) {
+      if (dst != 0) {
+         if (connectstatus(io, &badfd) == -1) {
+            SASSERTX(badfd == io->src.s || badfd == io->dst.s);
+            io_delete(sockscf.state.mother.ack, io, badfd, IO_IOERROR);
+
+            return;
+         }
+
+         proctitleupdate();
+      }
+
+      io_setinterest(io);
+      return;
+   }
+
+   if (SHMEMRULE(io)->bw_shmid != 0) {
+      /* may have overflown due to other ios using the same rule. */
+      io_setinterest(io);
+
+      if (iopollv[ioi].throttled)
+         return;
+   }
+
+   /*
+    * What directions can we do i/o in?  A side is readable if the kernel
+    * says so, or if we have data buffered for read from it.  A side is
+    * writable if the kernel says so, or if we have nothing buffered for
+    * write to it; in the latter case we may not be able to write all we
+    * read, but the rest will then be buffered.
+    */
+   srcread  = (src & (IOPOLL_READ | IOPOLL_EXCEPTION))
+           || socks_bytesinbuffer(io->src.s, READ_BUF, 0) > 0;
+   dstread  = (dst & (IOPOLL_READ | IOPOLL_EXCEPTION))
+           || socks_bytesinbuffer(io->dst.s, READ_BUF, 0) > 0;
+   srcwrite = (src & IOPOLL_WRITE) || !socks_bufferhasbytes(io->src.s, WRITE_BUF);
+   dstwrite = (dst & IOPOLL_WRITE) || !socks_bufferhasbytes(io->dst.s, WRITE_BUF);
+
+   /*
+    * If a side with data buffered for write has become writable, doio_tcp()
+    * will flush it when called to do i/o from the other side, so mark
+    * the other side as readable regardless of whether it is.
+    */
+   if (dst & IOPOLL_WRITE)
+      srcread = 1;
+
+   if (src & IOPOLL_WRITE)
+      dstread = 1;
+
+   if (io->src.state.fin_received)
+      srcread = 0;
+
+   if (io->dst.state.fin_received)
+      dstread = 0;
+
+   if (!((srcread && dstwrite) || (dstread && srcwrite))) {
+      io_setinterest(io);
+      return;
+   }
+
+   if ((src | dst) & IOPOLL_EXCEPTION)
+      flags = MSG_OOB;
+   else
+      flags = 0;
+
+   if (srcread)
+      FD_SET(io->src.s, rset);
+
+   if (srcwrite)
+      FD_SET(io->src.s, wset);
+
+   if (dstread)
+      FD_SET(io->dst.s, rset);
+
+   if (dstwrite)
+      FD_SET(io->dst.s, wset);
+
+   iostatus = doio_tcp(io, rset, wset, flags, &badfd);
+
+   FD_CLR(io->src.s, rset);
+   FD_CLR(io->src.s, wset);
+   FD_CLR(io->dst.s, rset);
+   FD_CLR(io->dst.s, wset);
+
+   if (IOSTATUS_FATALERROR(iostatus)) {
+      io_delete(sockscf.state.mother.ack, io, badfd, iostatus);
+      return;
+   }
+
+   io_settimer(io);
+   io_setinterest(io);
+}
+
+static void
+io_setinterest(io)
+   sockd_io_t *io;
+{
+   const char *function = "io_setinterest()";
+   const size_t ioi = io - iov;
+   int control, src, dst, pending, throttled;
+
+   SASSERTX(ioi < ioc);
+   SASSERTX(io->allocated);
+
+   control = src = dst = pending = throttled = 0;
+
+#if HAVE_CONTROL_CONNECTION
+   /*
+    * Don't care about bandwidth-limits on control-connections.
+    */
+   if (io->control.s != -1) {
+      control = IOPOLL_READ;
+
+      if (socks_bytesinbuffer(io->control.s, READ_BUF, 0) > 0)
+         pending = 1;
+   }
+#endif /* HAVE_CONTROL_CONNECTION */
+
+   if (io->state.protocol == SOCKS_TCP && io_connectisinprogress(io))
+      /*
+       * Nothing to do until the connect has completed.  Once it has,
+       * the socket will become writable.
+       */
+      dst = IOPOLL_WRITE;
+   else {
+      if (SHMEMRULE(io)->bw_shmid != 0) {
+         struct timeval tnow, bwoverflowok;
+
+         gettimeofday_monotonic(&tnow);
+
+         if (bw_rulehasoverflown(SHMEMRULE(io), &tnow, &bwoverflowok)) {
+            if (!timerisset(&bwoverflowtil)
+            ||  timercmp(&bwoverflowok, &bwoverflowtil, <))
+               bwoverflowtil = bwoverflowok;
+
+            slog(LOG_DEBUG,
+                 "%s: disabling i/o on io #%lu belonging to rule #%lu "
+                 "due to bwoverflow, until %ld.%06ld",
+                 function,
+                 (unsigned long)ioi,
+                 (unsigned long)SHMEMRULE(io)->number,
+                 (long)bwoverflowok.tv_sec,
+                 (long)bwoverflowok.tv_usec);
+
+            throttled = 1;
+         }
+      }
+
+      if (!throttled) {
+         switch (io->state.protocol) {
+            case SOCKS_TCP:
+               /*
+                * Only read from a side if the other side has nothing
+                * buffered for write; if it has, wait for it to become
+                * writable first.
+                */
+               if (socks_bufferhasbytes(io->dst.s, WRITE_BUF))
+                  dst |= IOPOLL_WRITE;
+               else if (!io->src.state.fin_received)
+                  src |= IOPOLL_READ | IOPOLL_EXCEPTION;
+
+               if (socks_bufferhasbytes(io->src.s, WRITE_BUF))
+                  src |= IOPOLL_WRITE;
+               else if (!io->dst.state.fin_received)
+                  dst |= IOPOLL_READ | IOPOLL_EXCEPTION;
+
+               if (((src & IOPOLL_READ)
+                 && socks_bytesinbuffer(io->src.s, READ_BUF, 0) > 0)
+               ||  ((dst & IOPOLL_READ)
+                 && socks_bytesinbuffer(io->dst.s, READ_BUF, 0) > 0))
+                  pending = 1;
+
+               break;
+
+            case SOCKS_UDP:
+               src = IOPOLL_READ;
+
+               /*
+                * if the client has not sent us anything yet, we have
+                * no target sockets.
+                */
+               if (io->src.state.isconnected)
+                  dst = IOPOLL_READ;
+
+               break;
+
+            default:
+               SERRX(io->state.protocol);
+         }
+      }
+   }
+
+#if HAVE_CONTROL_CONNECTION
+   if (io->control.s != -1)
+      (void)iopoll_set(io->control.s, control, io);
+#endif /* HAVE_CONTROL_CONNECTION */
+
+   (void)iopoll_set(io->src.s, src, io);
+
+   if (io->state.protocol == SOCKS_TCP)
+      (void)iopoll_set(io->dst.s, dst, io);
+#if HAVE_UDP_SUPPORT
+   else {
+      size_t i;
+
+      for (i = 0; i < io->dst.dstc; ++i)
+         (void)iopoll_set(io->dst.dstv[i].s, dst, io);
+   }
+#endif /* HAVE_UDP_SUPPORT */
+
+   if (iopollv[ioi].pending != pending) {
+      if (pending)
+         ++iopendingc;
+      else
+         --iopendingc;
+
+      iopollv[ioi].pending = pending;
+   }
+
+   if (iopollv[ioi].throttled != throttled) {
+      if (throttled)
+         ++iothrottledc;
+      else
+         --iothrottledc;
+
+      iopollv[ioi].throttled = throttled;
+   }
+}
+
+#endif /* HAVE_IOPOLL */
+
+void
+io_preconfigload(void)
+{
+   const char *function = "io_preconfigload()";
+
+   slog(LOG_DEBUG, "%s", function);
+
+   /*
+    * The monitors are recreated on reload, so counters must be added to
+    * the current ones before that.
+    */
+   io_syncmonitors(1);
+
+#if SOCKD_ALLINONE
+   if (sockscf.state.allinone) {
+      negotiate_preconfigload();
+      request_preconfigload();
+   }
+#endif /* SOCKD_ALLINONE */
+}
+
+void
+io_postconfigload(void)
+{
+   const char *function = "io_postconfigload()";
+   size_t i;
+
+   slog(LOG_DEBUG, "%s: ioc = %ld", function, (long)ioc);
+
+   for (i = 0; i < ioc; ++i) {
+      if (!iov[i].allocated)
+         continue;
+
+      io_updatemonitor(&iov[i]);
+
+      if (iov[i].state.protocol == SOCKS_TCP)
+         continue;
+
+      SASSERTX(iov[i].state.protocol == SOCKS_UDP);
+
+      /*
+       * In the UDP case we should check rules on each packet, so indicate
+       * we should not reuse the saved rules after sighup, which may have
+       * changed the ACLs.
+       * XXX ideally we would also do a rulespermit() to remove clients that
+       * no longer have any hope if being allowed to pass packets through.
+       */
+
+#if !BAREFOOTD
+      iov[i].src.state.use_saved_srule = 0;
+      iov[i].dst.state.use_saved_srule = 0;
+
+#else /* BAREFOOTD */
+      /*
+       * Nothing to do.  Those clients that were permitted we continue
+       * to permit.
+       */
+
+      slog(LOG_DEBUG, "%s: iov #%ld, dstc = %ld",
+           function, (long)ioc, (long)iov[i].dst.dstc);
+#endif /* BAREFOOTD */
+   }
+
+#if HAVE_IOPOLL
+   /* bandwidth limits may have changed. */
+   if (iopoll_isactive())
+      for (i = 0; i < ioc; ++i)
+         if (iov[i].allocated)
+            io_setinterest(&iov[i]);
+#endif /* HAVE_IOPOLL */
+
+#if BAREFOOTD
 #warning "missing code to remove unused internal udp sessions."
 /*
  * i.e. sessions belonging to internal addresses we should no longer
@@ -1348,6 +2311,13 @@ io_postconfigload(void)
          proctitleupdate();
 #endif
 #endif /* BAREFOOTD */
+
+#if SOCKD_ALLINONE
+   if (sockscf.state.allinone) {
+      negotiate_postconfigload();
+      request_postconfigload();
+   }
+#endif /* SOCKD_ALLINONE */
 }
 
 void
@@ -1380,6 +2350,16 @@ close_iodescriptors(io)
 
    for (i = 0; i < ELEMENTS(fdv); ++i) {
       if (fdv[i] != -1) {
+#if HAVE_IOPOLL
+         /*
+          * The kernel only removes the descriptor from the epoll set
+          * once all references to it are closed, and we may not have
+          * the only one.
+          */
+         if (iopoll_isactive())
+            (void)iopoll_set(fdv[i], 0, NULL);
+#endif /* HAVE_IOPOLL */
+
          if (close(fdv[i]) == 0) {
             ++iostate.freefds;
             fdv[i] = -1;
@@ -1403,7 +2383,6 @@ recv_io(s, io)
    char gssapistatemem[MAX_GSS_STATE];
 #endif /* HAVE_GSSAPI */
    struct iovec iovecv[2];
-   struct timeval tnow;
    struct msghdr msg;
    sockd_io_t tmpio;
    ssize_t received;
@@ -1466,13 +2445,7 @@ recv_io(s, io)
    if (wearechild) { /* child semantics; find a free io ourselves. */
       SASSERTX(io == NULL);
 
-      for (; ioi < ioc; ++ioi)
-         if (!iov[ioi].allocated) {
-            io = &iov[ioi];
-            break;
-         }
-
-      if (io == NULL) {
+      if ((io = io_getfree(&ioi)) == NULL) {
          /*
           * Only reason this should happen is if mother died/closed connection,
           * and what we are getting now is not actually an i/o, but just an
@@ -1625,7 +2598,9 @@ recv_io(s, io)
             &gssapistate) != 0)
                return -1;
          }
+         else
 #endif /* HAVE_GSSAPI */
+            udp_enableoffload(io->src.s);
 
 #else /* !SOCKS_SERVER */
          SASSERTX(io->control.s == -1);
@@ -1719,177 +2694,460 @@ recv_io(s, io)
 #endif /* DIAGNOSTIC */
    }
 
-   if (wearechild) { /* only child does i/o, wait till then before initing. */
-      size_t i;
+   if (wearechild) /* only child does i/o, wait till then before initing. */
+      if (io_setup(io, ioi) != 0)
+         return -1;
+
+   iostate.freefds -= fdreceived;
+
+   return 0;
+}
 
-      for (i = 0; i < io->extsocketoptionc; ++i)
-         io->extsocketoptionv[i].info
-         = optval2sockopt(io->extsocketoptionv[i].level,
-                          io->extsocketoptionv[i].optname);
+static sockd_io_t *
+io_getfree(ioi)
+   size_t *ioi;
+{
+   size_t i;
 
-      gettimeofday_monotonic(&tnow);
+   for (i = 0; i < ioc; ++i)
+      if (!iov[i].allocated) {
+         *ioi = i;
+         return &iov[i];
+      }
 
-      sockd_check_ipclatency("client object received from request process",
-                             &io->state.time.requestend,
-                             &tnow,
-                             &tnow);
+   if (ioc < iomax) {
+      *ioi = ioc++;
+      return &iov[*ioi];
+   }
 
-      /* needs to be set now for correct bandwidth calculation/limiting. */
-      io->lastio = tnow;
+   return NULL;
+}
 
-      switch (io->state.command) {
+static int
+io_setup(io, ioi)
+   sockd_io_t *io;
+   const size_t ioi;
+{
+   const char *function = "io_setup()";
+   struct timeval tnow;
+   size_t i;
+
+
+   for (i = 0; i < io->extsocketoptionc; ++i)
+      io->extsocketoptionv[i].info
+      = optval2sockopt(io->extsocketoptionv[i].level,
+                       io->extsocketoptionv[i].optname);
+
+   gettimeofday_monotonic(&tnow);
+
+   sockd_check_ipclatency("client object received from request process",
+                          &io->state.time.requestend,
+                          &tnow,
+                          &tnow);
+
+   /* needs to be set now for correct bandwidth calculation/limiting. */
+   io->lastio = tnow;
+
+   switch (io->state.command) {
 #if SOCKS_SERVER
-         case SOCKS_BINDREPLY:
-            socks_allocbuffer(io->src.s, SOCK_STREAM);
-            socks_allocbuffer(io->dst.s, SOCK_STREAM);
+      case SOCKS_BINDREPLY:
+         socks_allocbuffer(io->src.s, SOCK_STREAM);
+         socks_allocbuffer(io->dst.s, SOCK_STREAM);
 
-            io->dst.isclientside = 1;
+         io->dst.isclientside = 1;
 
-            if (io->control.s != -1) {
-               SASSERTX(io->state.extension.bind);
-               socks_allocbuffer(io->control.s, SOCK_STREAM);
-            }
+         if (io->control.s != -1) {
+            SASSERTX(io->state.extension.bind);
+            socks_allocbuffer(io->control.s, SOCK_STREAM);
+         }
 
-            break;
+         break;
 #endif /* SOCKS_SERVER */
 
 #if HAVE_UDP_SUPPORT
-         case SOCKS_UDPASSOCIATE: {
+      case SOCKS_UDPASSOCIATE: {
 
-            io->src.isclientside = 1;
+         io->src.isclientside = 1;
 
 #if SOCKS_SERVER
-            io->cmd.udp.sfwdrule   = &fwdrulev[ioi];
-            io->cmd.udp.sreplyrule = &replyrulev[ioi];
-            io->dst.dstv           = udptargetv[ioi];
-            io->dst.dstcmax        = ELEMENTS(udptargetv[ioi]);
-            io->dst.dstc           = 0;
-
-            if (ADDRISBOUND(&io->src.raddr))
-               SASSERTX(io->src.state.isconnected);
-            else
-               SASSERTX(!io->src.state.isconnected);
+         io->cmd.udp.sfwdrule   = &fwdrulev[ioi];
+         io->cmd.udp.sreplyrule = &replyrulev[ioi];
+         io->dst.dstv           = udptargetv[ioi];
+         io->dst.dstcmax        = ELEMENTS(udptargetv[ioi]);
+         io->dst.dstc           = 0;
+
+         if (ADDRISBOUND(&io->src.raddr))
+            SASSERTX(io->src.state.isconnected);
+         else
+            SASSERTX(!io->src.state.isconnected);
 
-            SASSERTX(io->control.s != -1);
-            socks_allocbuffer(io->control.s, SOCK_STREAM);
+         SASSERTX(io->control.s != -1);
+         socks_allocbuffer(io->control.s, SOCK_STREAM);
 
 #else /* BAREFOOTD */
-            const size_t mallocsize
-                         = UDP_INITIALCLIENTCOUNT * sizeof(*io->dst.dstv);
+         const size_t mallocsize
+                      = UDP_INITIALCLIENTCOUNT * sizeof(*io->dst.dstv);
 
-            SASSERTX(io->src.auth.method == AUTHMETHOD_NONE);
+         SASSERTX(io->src.auth.method == AUTHMETHOD_NONE);
 
-            SASSERTX(io->dst.s == -1);
+         SASSERTX(io->dst.s == -1);
 
-            /* only used for select(2) regarding writability. */
-            io->dst.s = io->src.s;
+         /* only used for select(2) regarding writability. */
+         io->dst.s = io->src.s;
 
-            if ((io->dst.dstv = malloc(mallocsize)) == NULL) {
-               struct sockaddr_storage laddr;
-               char buf[MAXSOCKADDRSTRING];
-               socklen_t len = sizeof(laddr);
+         if ((io->dst.dstv = malloc(mallocsize)) == NULL) {
+            struct sockaddr_storage laddr;
+            char buf[MAXSOCKADDRSTRING];
+            socklen_t len = sizeof(laddr);
 
-               if (getsockname(io->src.s, TOSA(&laddr), &len) == 0)
-                  sockaddr2string(&laddr, buf, sizeof(buf));
-               else {
-                  SWARN(errno);
-                  snprintf(buf, sizeof(buf), "<unknown>");
-               }
+            if (getsockname(io->src.s, TOSA(&laddr), &len) == 0)
+               sockaddr2string(&laddr, buf, sizeof(buf));
+            else {
+               SWARN(errno);
+               snprintf(buf, sizeof(buf), "<unknown>");
+            }
 
-               swarn("%s: failed to allocate %lu bytes of memory for initial "
-                     "%d udp clients to accept on internal address %s",
-                     function,
-                     (unsigned long)(mallocsize),
-                     UDP_INITIALCLIENTCOUNT,
-                     buf);
+            swarn("%s: failed to allocate %lu bytes of memory for initial "
+                  "%d udp clients to accept on internal address %s",
+                  function,
+                  (unsigned long)(mallocsize),
+                  UDP_INITIALCLIENTCOUNT,
+                  buf);
 
-               close(io->src.s);
+            close(io->src.s);
 
-               return -1;
-            }
+            return -1;
+         }
 
-            io->dst.dstc    = 0;
-            io->dst.dstcmax = UDP_INITIALCLIENTCOUNT;
+         io->dst.dstc    = 0;
+         io->dst.dstcmax = UDP_INITIALCLIENTCOUNT;
 #endif /* BAREFOOTD */
 
-            /*
-             * Each client will have it's own target/dst object, set once
-             * we receive the first packet from it.  The client/source socket
-             * is however the same for all clients.
-             */
-            socks_allocbuffer(io->src.s, SOCK_DGRAM);
+         /*
+          * Each client will have it's own target/dst object, set once
+          * we receive the first packet from it.  The client/source socket
+          * is however the same for all clients.
+          */
+         socks_allocbuffer(io->src.s, SOCK_DGRAM);
 
-            break;
-         }
+         break;
+      }
 #endif /* HAVE_UDP_SUPPORT */
 
-         case SOCKS_CONNECT:
-            if (!io->dst.state.isconnected)
-               iostate.haveconnectinprogress = 1;
+      case SOCKS_CONNECT:
+         if (!io->dst.state.isconnected)
+            iostate.haveconnectinprogress = 1;
 
-            io->src.isclientside = 1;
+         io->src.isclientside = 1;
 
-            socks_allocbuffer(io->src.s, SOCK_STREAM);
-            socks_allocbuffer(io->dst.s, SOCK_STREAM);
-            break;
+         socks_allocbuffer(io->src.s, SOCK_STREAM);
+         socks_allocbuffer(io->dst.s, SOCK_STREAM);
+         break;
 
-      }
+   }
 
 #if HAVE_NEGOTIATE_PHASE
-      if (io->clientdatalen != 0) {
-         slog(LOG_DEBUG,
-              "%s: adding initial data of size %ld from client %s to iobuf",
-              function,
-              (long)io->clientdatalen,
-              sockshost2string(&io->src.host, NULL, 0));
+   if (io->clientdatalen != 0) {
+      slog(LOG_DEBUG,
+           "%s: adding initial data of size %ld from client %s to iobuf",
+           function,
+           (long)io->clientdatalen,
+           sockshost2string(&io->src.host, NULL, 0));
 
-         /*
-          * XXX if covenant, this request has already been parsed and we
-          * already know we need to forward it; should optimize away
-          * re-parsing.
-          */
+      /*
+       * XXX if covenant, this request has already been parsed and we
+       * already know we need to forward it; should optimize away
+       * re-parsing.
+       */
 
-         socks_addtobuffer(CONTROLIO(io)->s,
-                           READ_BUF,
-                           0,
-                           io->clientdata,
-                           io->clientdatalen);
+      socks_addtobuffer(CONTROLIO(io)->s,
+                        READ_BUF,
+                        0,
+                        io->clientdata,
+                        io->clientdatalen);
 
-         io->clientdatalen = 0;
-      }
+      io->clientdatalen = 0;
+   }
 #endif /* HAVE_NEGOTIATE_PHASE */
 
-      log_ruleinfo_shmid(CRULE_OR_HRULE(io), function, NULL);
+   log_ruleinfo_shmid(CRULE_OR_HRULE(io), function, NULL);
 
-      if (io->srule.type == object_none) {
-         SASSERTX(io->state.protocol == SOCKS_UDP);
-         SASSERTX(!HAVE_SOCKS_RULES);
+   if (io->srule.type == object_none) {
+      SASSERTX(io->state.protocol == SOCKS_UDP);
+      SASSERTX(!HAVE_SOCKS_RULES);
+   }
+   else
+      log_ruleinfo_shmid(&io->srule, function, NULL);
+
+   /*
+    * attach to shmem now and keep attached, so we don't have to
+    * attach/detach for every i/o op later.  Session is not important
+    * to attach to as we won't need it until we delete the client,
+    * though it would still be preferable to attach to that also to
+    * avoid having to wait for pagein of sessionmemory upon disconnect.
+    */
+   (void)sockd_shmat(SHMEMRULE(io), SHMEM_ALL);
+
+   io_updatemonitor(io);
+
+   /*
+    * only update now, as it's added to us (us, the i/o process)
+    * without problems.
+    */
+   io->allocated = 1;
+
+   iofd_set(io->src.s, io);
+
+   if (io->dst.s != -1)
+      iofd_set(io->dst.s, io);
+
+   if (io->control.s != -1)
+      iofd_set(io->control.s, io);
+
+   io_settimer(io);
+
+#if HAVE_IOPOLL
+   if (iopoll_isactive())
+      io_setinterest(io);
+#endif /* HAVE_IOPOLL */
+
+   return 0;
+}
+
+#if SOCKD_ALLINONE
+
+int
+add_io(io)
+   const sockd_io_t *io;
+{
+   const char *function = "add_io()";
+
+   if (io_allocated(NULL, NULL, NULL, NULL) + pendingioc >= iomax) {
+      slog(LOG_DEBUG, "%s: all %lu i/o slots are in use",
+           function, (unsigned long)iomax);
+
+      errno = ENOBUFS;
+      return -1;
+   }
+
+   pendingiov[pendingioc++] = *io;
+   return 0;
+}
+
+static void
+allinone_init(void)
+{
+   const char *function = "allinone_init()";
+
+   negotiate_init(iomax);
+   request_init(iomax);
+
+   if ((pendingiov = calloc(iomax, sizeof(*pendingiov))) == NULL)
+      serr("%s: failed to allocate memory for %lu clients",
+           function, (unsigned long)iomax);
+
+   stagerset      = allocate_maxsize_fdset();
+   stagebufrset   = allocate_maxsize_fdset();
+   stagewset      = allocate_maxsize_fdset();
+   stagereadyrset = allocate_maxsize_fdset();
+   stagereadywset = allocate_maxsize_fdset();
+
+   stagebits = -1;
+}
+
+static size_t
+allinone_freec(void)
+{
+   size_t usedc;
+
+   if (sockscf.state.mother.s == -1)
+      return 0; /* going away; no new clients. */
+
+   usedc = io_allocated(NULL, NULL, NULL, NULL) + allinone_clients();
+
+   return usedc >= iomax ? 0 : iomax - usedc;
+}
+
+static size_t
+allinone_clients(void)
+{
+
+   return negotiate_allocated() + request_allocated() + pendingioc;
+}
+
+static int
+allinone_fdset(fdbits, rset, bufrset, wset)
+   int fdbits;
+   fd_set *rset;
+   fd_set *bufrset;
+   fd_set *wset;
+{
+   int p;
+
+   FD_ZERO(stagerset);
+   FD_ZERO(stagebufrset);
+   FD_ZERO(stagewset);
+
+   stagebits = negotiate_fdset(-1, stagerset, stagebufrset, allinone_freec());
+   stagebits = request_fdset(stagebits, stagerset, stagewset);
+
+   for (p = 0; p <= stagebits; ++p) {
+      if (FD_ISSET(p, stagerset))
+         FD_SET(p, rset);
+
+      if (bufrset != NULL && FD_ISSET(p, stagebufrset))
+         FD_SET(p, bufrset);
+
+      if (FD_ISSET(p, stagewset))
+         FD_SET(p, wset);
+   }
+
+   return MAX(fdbits, stagebits);
+}
+
+static struct timeval *
+allinone_gettimeout(iotimeout, timeout)
+   struct timeval *iotimeout;
+   struct timeval *timeout;
+{
+   struct timeval negtimeout, *negtimeoutp, reqtimeout, *reqtimeoutp;
+
+   if (iotimeout != NULL && iotimeout != timeout)
+      *timeout = *iotimeout;
+
+   if ((negtimeoutp = negotiate_gettimeout(&negtimeout)) != NULL
+   &&  (iotimeout == NULL || timercmp(negtimeoutp, timeout, <))) {
+      *timeout  = *negtimeoutp;
+      iotimeout = timeout;
+   }
+
+   if ((reqtimeoutp = request_gettimeout(&reqtimeout)) != NULL
+   &&  (iotimeout == NULL || timercmp(reqtimeoutp, timeout, <))) {
+      *timeout  = *reqtimeoutp;
+      iotimeout = timeout;
+   }
+
+   return iotimeout == NULL ? NULL : timeout;
+}
+
+static int
+allinone_process(nfds, rset, bufrset, wset)
+   const int nfds;
+   fd_set *rset;
+   fd_set *bufrset;
+   fd_set *wset;
+{
+   const char *function = "allinone_process()";
+   size_t i, addedc;
+   int p, readyc;
+
+   FD_ZERO(stagereadyrset);
+   FD_ZERO(stagereadywset);
+
+   for (p = readyc = 0; p <= stagebits; ++p) {
+      if (FD_ISSET(p, stagerset)) {
+         if (p < nfds && (FD_ISSET(p, rset)
+                      || (bufrset != NULL && FD_ISSET(p, bufrset)))) {
+            FD_SET(p, stagereadyrset);
+            ++readyc;
+         }
+
+         FD_CLR(p, rset);
+
+         if (bufrset != NULL)
+            FD_CLR(p, bufrset);
       }
-      else
-         log_ruleinfo_shmid(&io->srule, function, NULL);
 
-      /*
-       * attach to shmem now and keep attached, so we don't have to
-       * attach/detach for every i/o op later.  Session is not important
-       * to attach to as we won't need it until we delete the client,
-       * though it would still be preferable to attach to that also to
-       * avoid having to wait for pagein of sessionmemory upon disconnect.
-       */
-      (void)sockd_shmat(SHMEMRULE(io), SHMEM_ALL);
+      if (FD_ISSET(p, stagewset)) {
+         if (p < nfds && FD_ISSET(p, wset)) {
+            FD_SET(p, stagereadywset);
+            ++readyc;
+         }
 
-      io_updatemonitor(io);
+         FD_CLR(p, wset);
+      }
+   }
 
-      /*
-       * only update now, as it's added to us (us, the i/o process)
-       * without problems.
-       */
-      io->allocated = 1;
+   /*
+    * The request stage first, as clients the negotiate stage passes on
+    * to it now may get descriptors numbered as ones set above.
+    */
+   request_process(stagereadyrset, stagereadywset);
+   negotiate_process(stagereadyrset, allinone_freec());
+
+   for (i = addedc = 0; i < pendingioc; ++i) {
+      sockd_io_t *io;
+      size_t ioi;
+
+      io = io_getfree(&ioi);
+      SASSERTX(io != NULL); /* add_io() made sure there is room. */
+
+      *io = pendingiov[i];
+
+      if (io_setup(io, ioi) != 0)
+         continue;
+
+      iostate.freefds -= 1
+                       + (io->dst.s     != -1 && io->dst.s != io->src.s)
+                       + (io->control.s != -1);
+      ++addedc;
    }
 
-   iostate.freefds -= fdreceived;
+   pendingioc = 0;
 
-   return 0;
+   if (addedc > 0 || readyc > 0)
+      proctitleupdate();
+
+   slog(LOG_DEBUG, "%s: %d stage descriptor%s ready, %lu new io%s",
+        function,
+        readyc,
+        readyc == 1 ? "" : "s",
+        (unsigned long)addedc,
+        addedc == 1 ? "" : "s");
+
+   return readyc > 0 || addedc > 0;
+}
+
+#if HAVE_IOPOLL
+static size_t
+allinone_pollset(set, bufrset)
+   const int set;
+   fd_set *bufrset;
+{
+   size_t bufferedc;
+   int p;
+
+   for (p = bufferedc = 0; p <= stagebits; ++p) {
+      int events = 0;
+
+      if (FD_ISSET(p, stagerset))
+         events |= IOPOLL_READ;
+
+      if (FD_ISSET(p, stagewset))
+         events |= IOPOLL_WRITE;
+
+      if (events == 0)
+         continue;
+
+      if (!set) {
+         (void)iopoll_set(p, 0, NULL);
+         continue;
+      }
+
+      (void)iopoll_set(p, events, &stagepollmark);
+
+      if (FD_ISSET(p, stagebufrset)
+      &&  socks_bytesinbuffer(p, READ_BUF, 0) > 0) {
+         FD_SET(p, bufrset);
+         ++bufferedc;
+      }
+   }
+
+   return bufferedc;
 }
+#endif /* HAVE_IOPOLL */
+
+#endif /* SOCKD_ALLINONE */
 
 static void
 io_clearset(io, clearalltargets, set)
@@ -2025,7 +3283,7 @@ proctitleupdate(void)
    setproctitle("%s: %lu/%lu (%lu in progress)",
                 childtype2string(sockscf.state.type),
                 (unsigned long)io_allocated(NULL, NULL, NULL, NULL),
-                (unsigned long)SOCKD_IOMAX,
+                (unsigned long)iomax,
                 (unsigned long)inprogress);
 }
 
@@ -2046,134 +3304,205 @@ io_getset(nfds, set)
       /*
        * find the io 's' is part of.
        */
-      for (i = 0, evaluating = NULL; i < ioc; ++i) {
-         if (!iov[i].allocated)
-            continue;
+      if ((evaluating = iofd_get(s)) != NULL
+      &&  !io_getset_ispartof(evaluating, s))
+         evaluating = NULL;
+
+      for (i = 0; evaluating == NULL && i < ioc; ++i)
+         if (io_getset_ispartof(&iov[i], s)) {
+            evaluating = &iov[i];
+            iofd_set(s, evaluating);
+         }
 
-         switch (iov[i].state.command) {
-            case SOCKS_CONNECT:
-               if (s == iov[i].src.s || s == iov[i].dst.s)
-                  evaluating = &iov[i];
+      SASSERTX(evaluating != NULL);
 
-               break;
+      /* want the i/o object that has least recently done i/o. */
+      if (best == NULL || timercmp(&evaluating->lastio, &best->lastio, <))
+         best = evaluating;
+   }
+
+   return best;
+}
+
+static int
+io_getset_ispartof(io, s)
+   sockd_io_t *io;
+   const int s;
+{
+
+   if (!io->allocated)
+      return 0;
+
+   switch (io->state.command) {
+      case SOCKS_CONNECT:
+         if (s == io->src.s || s == io->dst.s)
+            return 1;
+
+         break;
 
 #if SOCKS_SERVER
-            case SOCKS_BINDREPLY:
-               if (s == iov[i].src.s || s == iov[i].dst.s)
-                  evaluating = &iov[i];
-               else if (iov[i].state.extension.bind && s == iov[i].control.s)
-                  evaluating = &iov[i];
+      case SOCKS_BINDREPLY:
+         if (s == io->src.s || s == io->dst.s)
+            return 1;
+         else if (io->state.extension.bind && s == io->control.s)
+            return 1;
 
-               break;
+         break;
 #endif /* SOCKS_SERVER */
 
 #if HAVE_UDP_SUPPORT
-            case SOCKS_UDPASSOCIATE: {
-               udptarget_t *target;
-
-               if (s == iov[i].src.s) {
-                  /* will have to demux later based on packet read from src. */
-                  iov[i].dst.s = -1;
-                  evaluating = &iov[i];
-               }
-               else if ((target = clientofsocket(s,
-                                                 iov[i].dst.dstc,
-                                                 iov[i].dst.dstv)) != NULL) {
-                     io_syncudp(&iov[i], target);
-
-                     SASSERTX(iov[i].dst.s != -1);
-                     SASSERTX(iov[i].dst.s == s);
+      case SOCKS_UDPASSOCIATE: {
+         udptarget_t *target;
 
-                     evaluating = &iov[i];
-               }
-#if HAVE_CONTROL_CONNECTION
-               else if (s == iov[i].control.s)
-                  evaluating = &iov[i];
-#endif /* HAVE_CONTROL_CONNECTION */
+         if (s == io->src.s) {
+            /* will have to demux later based on packet read from src. */
+            io->dst.s = -1;
+            return 1;
+         }
+         else if ((target = clientofsocket(s,
+                                           io->dst.dstc,
+                                           io->dst.dstv)) != NULL) {
+            io_syncudp(io, target);
 
-               break;
-            }
-#endif /* HAVE_UDP_SUPPORT */
+            SASSERTX(io->dst.s != -1);
+            SASSERTX(io->dst.s == s);
 
-            default:
-               break;
+            return 1;
          }
+#if HAVE_CONTROL_CONNECTION
+         else if (s == io->control.s)
+            return 1;
+#endif /* HAVE_CONTROL_CONNECTION */
 
-         if (evaluating != NULL)
-            break;
+         break;
       }
+#endif /* HAVE_UDP_SUPPORT */
 
-      SASSERTX(evaluating != NULL);
-
-      /* want the i/o object that has least recently done i/o. */
-      if (best == NULL || timercmp(&evaluating->lastio, &best->lastio, <))
-         best = evaluating;
+      default:
+         break;
    }
 
-   return best;
+   return 0;
 }
 
 static sockd_io_t *
 io_finddescriptor(d)
    int d;
 {
+   sockd_io_t *io;
    size_t i;
 
-   for (i = 0; i < ioc; ++i) {
-      if (!iov[i].allocated)
-         continue;
+   if ((io = iofd_get(d)) != NULL && io_hasdescriptor(io, d))
+      return io;
 
-      switch (iov[i].state.command) {
-         case SOCKS_BIND:
-         case SOCKS_BINDREPLY:
-            if (d == iov[i].src.s || d == iov[i].dst.s)
-               return &iov[i];
-            else if (!iov[i].state.extension.bind) {
-               if (d == iov[i].control.s)
-                  return &iov[i];
-            }
-            break;
+   for (i = 0; i < ioc; ++i)
+      if (io_hasdescriptor(&iov[i], d)) {
+         iofd_set(d, &iov[i]);
+         return &iov[i];
+      }
 
-         case SOCKS_CONNECT:
-            if (d == iov[i].src.s || d == iov[i].dst.s)
-               return &iov[i];
-            break;
+   return NULL;
+}
+
+static int
+io_hasdescriptor(io, d)
+   sockd_io_t *io;
+   const int d;
+{
+
+   if (!io->allocated)
+      return 0;
+
+   switch (io->state.command) {
+      case SOCKS_BIND:
+      case SOCKS_BINDREPLY:
+         if (d == io->src.s || d == io->dst.s)
+            return 1;
+         else if (!io->state.extension.bind) {
+            if (d == io->control.s)
+               return 1;
+         }
+         break;
+
+      case SOCKS_CONNECT:
+         if (d == io->src.s || d == io->dst.s)
+            return 1;
+         break;
 
 #if HAVE_UDP_SUPPORT
-         case SOCKS_UDPASSOCIATE: {
-            udptarget_t *target;
+      case SOCKS_UDPASSOCIATE: {
+         udptarget_t *target;
 
-            if (d == iov[i].src.s) {
-               /* will have to demux later based on packet read from src. */
-               iov[i].dst.s = -1;
-               return &iov[i];
-            }
+         if (d == io->src.s) {
+            /* will have to demux later based on packet read from src. */
+            io->dst.s = -1;
+            return 1;
+         }
 
-            target = clientofsocket(d, iov[i].dst.dstc, iov[i].dst.dstv);
-            if (target != NULL) {
-               io_syncudp(&iov[i], target);
+         target = clientofsocket(d, io->dst.dstc, io->dst.dstv);
+         if (target != NULL) {
+            io_syncudp(io, target);
 
-               SASSERTX(iov[i].dst.s != -1);
-               SASSERTX(iov[i].dst.s == d);
+            SASSERTX(io->dst.s != -1);
+            SASSERTX(io->dst.s == d);
 
-               return &iov[i];
-            }
+            return 1;
+         }
 
 #if HAVE_CONTROL_CONNECTION
-            if (d == iov[i].control.s)
-               return &iov[i];
+         if (d == io->control.s)
+            return 1;
 #endif /* HAVE_CONTROL_CONNECTION */
 
-            break;
-         }
+         break;
+      }
 #endif /* HAVE_UDP_SUPPORT */
 
-         default:
-            SERRX(iov[i].state.command);
+      default:
+         SERRX(io->state.command);
+   }
+
+   return 0;
+}
+
+static sockd_io_t *
+iofd_get(d)
+   const int d;
+{
+
+   if (d < 0 || (size_t)d >= iofdc)
+      return NULL;
+
+   return iofdv[d];
+}
+
+static void
+iofd_set(d, io)
+   const int d;
+   sockd_io_t *io;
+{
+   const char *function = "iofd_set()";
+
+   SASSERTX(d >= 0);
+
+   if ((size_t)d >= iofdc) {
+      const size_t newc = MAX((size_t)d + 1, iofdc * 2);
+      sockd_io_t **p;
+
+      if ((p = realloc(iofdv, sizeof(*iofdv) * newc)) == NULL) {
+         /* only a hint; will have to search for it instead. */
+         swarn("%s: failed to allocate memory for %lu descriptors",
+               function, (unsigned long)newc);
+         return;
       }
+
+      bzero(&p[iofdc], sizeof(*p) * (newc - iofdc));
+
+      iofdv = p;
+      iofdc = newc;
    }
 
-   return NULL;
+   iofdv[d] = io;
 }
 
 static int
@@ -2408,20 +3737,57 @@ io_fillset_connectinprogress(set)
    return bits;
 }
 
+static void
+io_settimer(io)
+   sockd_io_t *io;
+{
+   struct timeval tnow;
+   time_t timeout;
+
+   SASSERTX(io->allocated);
+
+   gettimeofday_monotonic(&tnow);
+
+   if ((timeout = io_timeuntiltimeout(io, &tnow, NULL, 0)) == (time_t)-1)
+      timer_disarm(&iotimers, &iotimerv[io - iov]);
+   else
+      timer_arm(&iotimers, &iotimerv[io - iov], tnow.tv_sec + timeout);
+}
+
 static struct timeval *
 io_gettimeout(timeout)
    struct timeval *timeout;
 {
    const char *function = "io_gettimeout()";
-   static struct timeval last_timeout;
-   static time_t last_time;
-   static int last_timeout_isset;
-   struct timeval tnow, time_havebw;
-   size_t i, tcpc, udpc;
+   struct timeval tnow, time_havebw, time_sync;
+   time_t timeout_found;
+   size_t i;
    int havetimeout;
 
    gettimeofday_monotonic(&tnow);
 
+   if (monitorsyncc > 0) {
+      /*
+       * Make sure we wake up in time to sync the monitor counters.
+       */
+      const struct timeval syncinterval
+      = { SOCKD_MONITORSYNC_MS / 1000, (SOCKD_MONITORSYNC_MS % 1000) * 1000 };
+      struct timeval firstio = monitorsyncv[0].firstio;
+
+      for (i = 1; i < monitorsyncc; ++i)
+         if (timercmp(&monitorsyncv[i].firstio, &firstio, <))
+            firstio = monitorsyncv[i].firstio;
+
+      timeradd(&firstio, &syncinterval, &time_sync);
+
+      if (!timercmp(&time_sync, &tnow, >)) {
+         timerclear(timeout);
+         return timeout;
+      }
+
+      timersub(&time_sync, &tnow, &time_sync);
+   }
+
    if (timerisset(&bwoverflowtil)) {
       const struct timeval shortenough = { 1, 0 };
 
@@ -2443,7 +3809,8 @@ io_gettimeout(timeout)
       }
 
       *timeout = time_havebw;
-      if (timercmp(timeout, &shortenough, <))
+      if (timercmp(timeout, &shortenough, <)
+      && (monitorsyncc == 0 || !timercmp(&time_sync, timeout, <)))
          return timeout;
 
       havetimeout = 1;
@@ -2451,149 +3818,187 @@ io_gettimeout(timeout)
    else
       havetimeout = 0;
 
-   slog(LOG_DEBUG,
-        "%s: last_time = %ld, tnow = %ld, last_timeout_isset = %ld, "
-        "last_timeout = %ld.%06ld",
-        function,
-        (long)last_time,
-        (long)tnow.tv_sec,
-        (long)last_timeout_isset,
-        (long)last_timeout.tv_sec,
-        (long)last_timeout.tv_usec);
+   if (monitorsyncc > 0
+   && (!havetimeout || timercmp(&time_sync, timeout, <))) {
+      *timeout    = time_sync;
+      havetimeout = 1;
+   }
 
    /*
-    * If last timeout scan was the same second as now, see if we
-    * can reuse it without scanning all clients again.
+    * The timers may expire earlier than the ios really timeout, if there
+    * has been i/o since they were armed.  That is detected and the
+    * timers rearmed once they expire.
     */
-   if (last_timeout_isset && last_time == tnow.tv_sec) {
-      /*
-       * Don't know if the last timeout is still valid.  Could be it was a
-       * temporary timeout that no longer is valid (e.g., a timeout waiting
-       * for connect(2) to complete.  Since we don't know, make sure we
-       * don't wait too long, and not too little either.
-       */
-      last_timeout.tv_sec  = 1;
-      last_timeout.tv_usec = 0;
+   timeout_found = timerwheel_timeuntil(&iotimers, tnow.tv_sec);
 
-      if (!havetimeout
-      || (havetimeout && timercmp(timeout, &last_timeout, <)))
-         *timeout = last_timeout;
+   slog(LOG_DEBUG, "%s: first io timer expires in %lds, %lu timer%s armed",
+        function,
+        (long)timeout_found,
+        (unsigned long)iotimers.armedc,
+        iotimers.armedc == 1 ? "" : "s");
 
-      return timeout;
-   }
+   if (timeout_found != (time_t)-1) {
+      if (!havetimeout || timeout_found < timeout->tv_sec) {
+         havetimeout     = 1;
+         timeout->tv_sec = timeout_found;
 
-   /*
-    * Could perhaps add a "timeoutispossible" object also by checking
-    * each io object as we receive it (and each udp client as we
-    * add it).  If we find one where timeout is possible, set the
-    * global timeoutispossible, if not, don't set it.  Each time
-    * we io_delete(), we change timeoutispossible to true, and
-    * upon scanning through all i/o's here, we may possible set it
-    * to false again.  Since the default is to not have any timeout
-    * in the i/o phase (except for FIN_WAIT), this might save time in
-    * the common cases.
-    */
-   if (io_allocated(&tcpc, NULL, &udpc, NULL) == 0) {
-      last_timeout_isset = 0;
-      return NULL;
+         /*
+          * never mind sub-second accuracy, but do make sure we don't end up
+          * with {0, 0} if there is less than one second till timeout.  If
+          * there is more than one second, never mind if the timeout is a
+          * little longer than necessary.
+          */
+         timeout->tv_usec = 999999;
+      }
    }
 
-   last_time = tnow.tv_sec;
+   if (!havetimeout)
+      return NULL;
 
-   /*
-    * go through all i/o-objects, finding the one who has least left
-    * until timeout, or the first with a timeout that is soon enough.
-    */
-   for (i = 0; i < ioc && (tcpc > 0 || udpc > 0); ++i) {
-      struct timeval timeout_found;
+   SASSERTX(timeout->tv_sec  >= 0);
+   SASSERTX(timeout->tv_usec >= 0);
 
-      if (!iov[i].allocated)
-         continue;
+   return timeout;
+}
 
-      if (iov[i].state.protocol == SOCKS_TCP)
-         --tcpc;
-      else {
-         SASSERTX(iov[i].state.protocol == SOCKS_UDP);
-         --udpc;
-      }
+static sockd_io_t *
+io_gettimedout(void)
+{
+   const char *function = "io_gettimedout()";
+   sockd_timer_t *timer;
+   struct timeval tnow;
 
-      timeout_found.tv_sec  = io_timeuntiltimeout(&iov[i], &tnow, NULL, 0);
-      timeout_found.tv_usec = 0;
+   gettimeofday_monotonic(&tnow);
+   while ((timer = timerwheel_getexpired(&iotimers, tnow.tv_sec)) != NULL) {
+      sockd_io_t *io = &iov[timer - iotimerv];
+      time_t timeout;
 
-      slog(LOG_DEBUG, "%s: timeout for iov #%lu is in %lds",
-           function, (unsigned long)i, (long)timeout_found.tv_sec);
+      SASSERTX(io->allocated);
 
-      if (timeout_found.tv_sec != (time_t)-1) {
-         if (!havetimeout || timercmp(&timeout_found, timeout, <)) {
-            havetimeout = 1;
-            *timeout    = timeout_found;
-         }
+      if ((timeout = io_timeuntiltimeout(io, &tnow, NULL, 1)) == (time_t)-1)
+         continue;  /* no timeout on this object any longer. */
 
-         SASSERTX(havetimeout);
-         if (timeout->tv_sec <= 0)
-            break; /* timeout soon enough or already there. */
+      if (timeout > 0) { /* has done i/o since timer was armed. */
+         timer_arm(&iotimers, timer, tnow.tv_sec + timeout);
+         continue;
       }
-   }
 
-   if (havetimeout) {
-      SASSERTX(timeout->tv_sec  >= 0);
-      SASSERTX(timeout->tv_usec >= 0);
+      slog(LOG_DEBUG,
+           "%s: io #%lu with control %d, src %d, dst %d, has reached the "
+           "timeout point.  I/O last done at %ld.%06ld",
+           function,
+           (unsigned long)(io - iov),
+           io->control.s,
+           io->src.s,
+           io->dst.s,
+           (long)io->lastio.tv_sec,
+           (long)io->lastio.tv_usec);
+
+      return io;
+   }
 
-      /*
-       * never mind sub-second accuracy, but do make sure we don't end up
-       * with {0, 0} if there is less than one second till timeout.  If
-       * there is more than one second, never mind if the timeout is a
-       * little longer than necessary.
-       */
-      timeout->tv_usec = 999999;
+   return NULL;
+}
 
-      last_timeout = *timeout;
-   }
-   else
-      timeout = NULL;
+static void
+io_deletetimedout(void)
+{
+   sockd_io_t *io;
 
-   last_timeout_isset = havetimeout;
+   while ((io = io_gettimedout()) != NULL) {
+#if HAVE_NEGOTIATE_PHASE
+      if (io_connectisinprogress(io)
+      && (SOCKS_SERVER || io->reqflags.httpconnect)) {
+         response_t response;
+
+         create_response(NULL,
+                         &io->src.auth,
+                         io->state.proxyprotocol,
+                         (int)sockscode(io->state.proxyprotocol,
+                                        SOCKS_TTLEXPIRED),
+                         &response);
+
+         if (send_response(io->src.s, &response) != 0)
+            errno = 0; /* real error is the timeout. */
+      }
+#endif /* HAVE_NEGOTIATE_PHASE */
 
-   return timeout;
+      io_delete(sockscf.state.mother.ack, io, -1, IO_TIMEOUT);
+   }
 }
 
-static sockd_io_t *
-io_gettimedout(void)
+#if HAVE_CONTROL_CONNECTION
+static iostatus_t
+io_readcontrol(io)
+   sockd_io_t *io;
 {
-   const char *function = "io_gettimedout()";
-   struct timeval tnow;
-   size_t i;
+   const char *function = "io_readcontrol()";
+   ssize_t r;
+   char buf[1024], visbuf[256];
 
-   gettimeofday_monotonic(&tnow);
-   for (i = 0; i < ioc; ++i) {
-      struct timeval timeout;
+   SASSERTX(io->control.s != -1);
+   SASSERTX(io->control.s != io->src.s);
+   SASSERTX(io->control.s != io->dst.s);
 
-      if (!iov[i].allocated)
-         continue;
+   SASSERTX(io->state.command  == SOCKS_UDPASSOCIATE
+   ||       (io->state.command == SOCKS_BINDREPLY
+        &&   io->state.extension.bind));
+
+   /*
+    * Only thing we expect from client's control connection is
+    * an eof.
+    */
+   r = socks_recvfrom(io->control.s,
+                      buf,
+                      sizeof(buf),
+                      0,
+                      NULL,
+                      NULL,
+                      NULL,
+                      &io->control.auth);
+
+   if (r <= 0) {
+      slog(LOG_DEBUG,
+           "%s: TCP control connection from client %s closed: %s",
+           function,
+           sockaddr2string(&CONTROLIO(io)->raddr, NULL, 0),
+           r == 0 ? "EOF" : strerror(errno));
 
-      if ((timeout.tv_sec = io_timeuntiltimeout(&iov[i], &tnow, NULL, 1))
-      == (time_t)-1)
-         continue;  /* no timeout on this object. */
+      if (io->srule.mstats_shmid != 0
+      &&  (io->srule.alarmsconfigured & ALARM_DISCONNECT)) {
+         clientinfo_t cinfo;
 
-      timeout.tv_usec = 0; /* whole seconds is good enough. */
-      if (timeout.tv_sec <= 0) { /* has timed out already. */
-         slog(LOG_DEBUG,
-              "%s: io #%lu with control %d, src %d, dst %d, has reached the "
-              "timeout point.  I/O last done at %ld.%06ld",
-              function,
-              (unsigned long)i,
-              iov[i].control.s,
-              iov[i].src.s,
-              iov[i].dst.s,
-              (long)iov[i].lastio.tv_sec,
-              (long)iov[i].lastio.tv_usec);
+         cinfo.from = io->control.raddr;
+         HOSTIDCOPY(&io->state, &cinfo);
 
-         return &iov[i];
+         SASSERTX(!io->control.state.alarmdisconnectdone);
+         alarm_add_disconnect(0,
+                              &io->srule,
+                              ALARM_INTERNAL,
+                              &cinfo,
+                              r == 0 ? "EOF" : strerror(errno),
+                              sockscf.shmemfd);
+
+         io->control.state.alarmdisconnectdone = 1;
       }
+
+      return r == 0 ? IO_CLOSE : IO_IOERROR;
    }
 
-   return NULL;
+   slog(LOG_NOTICE, "%s: %ld unexpected byte%s over control "
+                    "connection from client %s: %s",
+                    function,
+                    (long)r,
+                    r == 1 ? "" : "s",
+                    sockaddr2string(&CONTROLIO(io)->raddr, NULL, 0),
+                    str2vis(buf,
+                            (size_t)r,
+                            visbuf,
+                            sizeof(visbuf)));
+
+   return IO_NOERROR;
 }
+#endif /* HAVE_CONTROL_CONNECTION */
 
 static int
 io_timeoutispossible(io)
@@ -2771,7 +4176,7 @@ static int
 getnewios()
 {
    const char *function = "getnewios()";
-   const size_t freec = SOCKD_IOMAX - io_allocated(NULL, NULL, NULL, NULL);
+   const size_t freec = iomax - io_allocated(NULL, NULL, NULL, NULL);
    size_t receivedc;
 
    receivedc = errno = 0;
@@ -2796,7 +4201,7 @@ getnewios()
            "but no new client was there to receive: %s",
            function,
            (unsigned long)(freec + 1),
-           (unsigned long)SOCKD_IOMAX,
+           (unsigned long)iomax,
            strerror(errno));
 
       return -1;
@@ -2829,6 +4234,8 @@ siginfo(sig, si, sc)
    slog(LOG_INFO, "io-child up %lu day%s, %lu:%.2lu:%.2lu",
         days, days == 1 ? "" : "s", hours, minutes, seconds);
 
+   log_rulecachestats();
+
 #if HAVE_UDP_SUPPORT
    if ((stats = io_get_ro_stats()) == NULL)
       slog(LOG_INFO, "no read-only latency information available (yet)");
@@ -3294,6 +4701,7 @@ connectstatus(io, badfd)
            function, sockshost2string(&io->dst.host, NULL, 0), io->dst.s);
 
       io->dst.state.isconnected = 1;
+      io_settimer(io);
 
 #if HAVE_NEGOTIATE_PHASE
       if (SOCKS_SERVER || io->reqflags.httpconnect) {
@@ -3451,7 +4859,9 @@ io_update(timenow, bwused, i_read, i_written,
 {
    const char *function = "io_update()";
    const iocount_t zero = { 0 };
-   monitor_stats_t *monitor;
+   monitorsync_t *counters, nocounters;
+   struct timeval tdiff;
+   size_t i;
    int didattach;
 
    slog(LOG_DEBUG, "%s: bwused %lu, bw_shmid %lu, mstats_shmid %lu",
@@ -3470,6 +4880,59 @@ io_update(timenow, bwused, i_read, i_written,
    || !(packetrule->alarmsconfigured & ALARM_DATA))
       return;
 
+   /*
+    * Rather than lock and update the monitor in shmem after every i/o
+    * operation, with all processes handling clients for the same monitor
+    * contending for the lock, accumulate the counters here and add them
+    * to the monitor every now and then.
+    */
+   for (i = 0; i < monitorsyncc; ++i)
+      if (monitorsyncv[i].mstats_shmid == packetrule->mstats_shmid)
+         break;
+
+   if (i < monitorsyncc)
+      counters = &monitorsyncv[i];
+   else {
+      if (monitorsyncc < ELEMENTS(monitorsyncv))
+         counters = &monitorsyncv[monitorsyncc++];
+      else
+         counters = &nocounters; /* no room; add it to the monitor immediately. */
+
+      bzero(counters, sizeof(*counters));
+      counters->mstats_shmid = packetrule->mstats_shmid;
+      counters->firstio      = *timenow;
+   }
+
+   if (i_read != NULL && memcmp(&zero, i_read, sizeof(zero)) != 0) {
+      counters->i_recv.bytes  += i_read->bytes;
+      counters->i_recv.lastio  = *timenow;
+      counters->bytes         += i_read->bytes;
+   }
+
+   if (i_written != NULL && memcmp(&zero, i_written, sizeof(zero)) != 0) {
+      counters->i_send.bytes  += i_written->bytes;
+      counters->i_send.lastio  = *timenow;
+      counters->bytes         += i_written->bytes;
+   }
+
+   if (e_read != NULL && memcmp(&zero, e_read, sizeof(zero)) != 0) {
+      counters->e_recv.bytes  += e_read->bytes;
+      counters->e_recv.lastio  = *timenow;
+      counters->bytes         += e_read->bytes;
+   }
+
+   if (e_written != NULL && memcmp(&zero, e_written, sizeof(zero)) != 0) {
+      counters->e_send.bytes  += e_written->bytes;
+      counters->e_send.lastio  = *timenow;
+      counters->bytes         += e_written->bytes;
+   }
+
+   timersub(timenow, &counters->firstio, &tdiff);
+   if (counters != &nocounters
+   &&  counters->bytes <= SOCKD_MONITORSYNC_BYTES
+   &&  tdiff.tv_sec * 1000 + tdiff.tv_usec / 1000 < SOCKD_MONITORSYNC_MS)
+      return;
+
    if (packetrule->mstats == NULL) {
       /*
        * Must be a Dante UDP session.
@@ -3477,8 +4940,12 @@ io_update(timenow, bwused, i_read, i_written,
       SASSERTX(packetrule != rule);
       SASSERTX(SOCKS_SERVER);
 
-      if (sockd_shmat(packetrule, SHMEM_MONITOR) != 0)
+      if (sockd_shmat(packetrule, SHMEM_MONITOR) != 0) {
+         if (counters != &nocounters)
+            *counters = monitorsyncv[--monitorsyncc];
+
          return;
+      }
 
       didattach = 1;
    }
@@ -3486,60 +4953,111 @@ io_update(timenow, bwused, i_read, i_written,
       didattach = 0;
 
    SASSERTX(packetrule->mstats != NULL);
-   monitor = &packetrule->mstats->object.monitor;
+   io_syncmonitor(counters, packetrule->mstats);
+
+   if (counters != &nocounters)
+      *counters = monitorsyncv[--monitorsyncc];
+
+   if (didattach)
+      sockd_shmdt(packetrule, SHMEM_MONITOR);
+}
+
+static void
+io_syncmonitor(counters, mstats)
+   monitorsync_t *counters;
+   shmem_object_t *mstats;
+{
+   const char *function = "io_syncmonitor()";
+   monitor_stats_t *monitor = &mstats->object.monitor;
 
-   socks_lock(sockscf.shmemfd, (off_t)packetrule->mstats_shmid, 1, 1, 1);
+   SASSERTX(counters->mstats_shmid == mstats->mstate.shmid);
 
-   MUNPROTECT_SHMEMHEADER(packetrule->mstats);
+   socks_lock(sockscf.shmemfd, (off_t)counters->mstats_shmid, 1, 1, 1);
+
+   MUNPROTECT_SHMEMHEADER(mstats);
 
    if (monitor->internal.alarm.data.recv.isconfigured
-   &&  i_read != NULL
-   &&  memcmp(&zero, i_read, sizeof(zero)) != 0) {
-      monitor->internal.alarm.data.recv.bytes  += i_read->bytes;
-      monitor->internal.alarm.data.recv.lastio  = *timenow;
+   &&  counters->i_recv.bytes != 0) {
+      monitor->internal.alarm.data.recv.bytes  += counters->i_recv.bytes;
+      monitor->internal.alarm.data.recv.lastio  = counters->i_recv.lastio;
    }
 
    if (monitor->internal.alarm.data.send.isconfigured
-   && i_written != NULL
-   && memcmp(&zero, i_written, sizeof(zero)) != 0) {
-      monitor->internal.alarm.data.send.bytes  += i_written->bytes;
-      monitor->internal.alarm.data.send.lastio  = *timenow;
+   &&  counters->i_send.bytes != 0) {
+      monitor->internal.alarm.data.send.bytes  += counters->i_send.bytes;
+      monitor->internal.alarm.data.send.lastio  = counters->i_send.lastio;
    }
 
    if (monitor->external.alarm.data.recv.isconfigured
-   && e_read != NULL
-   && memcmp(&zero, e_read, sizeof(zero)) != 0) {
-      monitor->external.alarm.data.recv.bytes  += e_read->bytes;
-      monitor->external.alarm.data.recv.lastio  = *timenow;
+   &&  counters->e_recv.bytes != 0) {
+      monitor->external.alarm.data.recv.bytes  += counters->e_recv.bytes;
+      monitor->external.alarm.data.recv.lastio  = counters->e_recv.lastio;
    }
 
    if (monitor->external.alarm.data.send.isconfigured
-   && e_written != NULL
-   && memcmp(&zero, e_written, sizeof(zero)) != 0) {
-      monitor->external.alarm.data.send.bytes  += e_written->bytes;
-      monitor->external.alarm.data.send.lastio  = *timenow;
+   &&  counters->e_send.bytes != 0) {
+      monitor->external.alarm.data.send.bytes  += counters->e_send.bytes;
+      monitor->external.alarm.data.send.lastio  = counters->e_send.lastio;
    }
 
-   MPROTECT_SHMEMHEADER(packetrule->mstats);
+   MPROTECT_SHMEMHEADER(mstats);
 
-   socks_unlock(sockscf.shmemfd, (off_t)packetrule->mstats_shmid, 1);
+   socks_unlock(sockscf.shmemfd, (off_t)counters->mstats_shmid, 1);
 
    slog(LOG_DEBUG,
         "%s: data sides configured in monitor with shmid: %lu.  "
         "Data added: i_recv/i_send/e_recv/e_send: %lu/%lu/%lu/%lu bytes",
         function,
-        (unsigned long)packetrule->mstats_shmid,
-        i_read    != NULL && monitor->internal.alarm.data.recv.isconfigured ?
-            (unsigned long)i_read->bytes    : 0,
-        i_written != NULL && monitor->internal.alarm.data.send.isconfigured ?
-            (unsigned long)i_written->bytes : 0,
-        e_read    != NULL && monitor->external.alarm.data.recv.isconfigured ?
-            (unsigned long)e_read->bytes    : 0,
-        e_written != NULL && monitor->external.alarm.data.send.isconfigured ?
-            (unsigned long)e_written->bytes : 0);
+        (unsigned long)counters->mstats_shmid,
+        monitor->internal.alarm.data.recv.isconfigured ?
+            (unsigned long)counters->i_recv.bytes : 0,
+        monitor->internal.alarm.data.send.isconfigured ?
+            (unsigned long)counters->i_send.bytes : 0,
+        monitor->external.alarm.data.recv.isconfigured ?
+            (unsigned long)counters->e_recv.bytes : 0,
+        monitor->external.alarm.data.send.isconfigured ?
+            (unsigned long)counters->e_send.bytes : 0);
+}
 
-   if (didattach)
-      sockd_shmdt(packetrule, SHMEM_MONITOR);
+static void
+io_syncmonitors(force)
+   const int force;
+{
+   const char *function = "io_syncmonitors()";
+   struct timeval tnow, tdiff;
+   size_t i;
+
+   if (monitorsyncc == 0)
+      return;
+
+   gettimeofday_monotonic(&tnow);
+
+   i = monitorsyncc;
+   while (i-- > 0) {
+      monitorsync_t *counters = &monitorsyncv[i];
+
+      timersub(&tnow, &counters->firstio, &tdiff);
+      if (!force
+      &&  tdiff.tv_sec * 1000 + tdiff.tv_usec / 1000 < SOCKD_MONITORSYNC_MS)
+         continue;
+
+      /*
+       * The io(s) the counters came from may be gone, so attach
+       * to the monitor by shmid only.
+       */
+      SASSERTX(counters->mstats == NULL);
+      HANDLE_SHMAT(counters, mstats, mstats_shmid);
+
+      if (counters->mstats == NULL)
+         slog(LOG_DEBUG, "%s: monitor no longer exists; dropping counters",
+              function);
+      else {
+         io_syncmonitor(counters, counters->mstats);
+         HANDLE_SHMDT(counters, mstats, mstats_shmid);
+      }
+
+      *counters = monitorsyncv[--monitorsyncc];
+   }
 }
 
 void
@@ -4135,7 +5653,15 @@ io_delete(mother, io, badfd, status)
    io_add_alarmdisconnects(io, "session delete");
    close_iodescriptors(io);
 
-   if (mother != -1) {
+   if (mother != -1
+#if SOCKD_ALLINONE
+   /*
+    * extra ios of the bind extension share the slot of the client's
+    * original bind request, as we accepted the client ourselves.
+    */
+   && !(sockscf.state.allinone && io->reqinfo.command == SOCKD_NOP)
+#endif /* SOCKD_ALLINONE */
+   ) {
       const char info = (io->state.command == SOCKS_UDPASSOCIATE ?
                                        SOCKD_FREESLOT_UDP : SOCKD_FREESLOT_TCP);
 
@@ -4188,6 +5714,23 @@ io_delete(mother, io, badfd, status)
    bzero(io->dst.dstv, sizeof(*io->dst.dstv) * io->dst.dstc);
 #endif /* SOCKS_SERVER */
 
+#if HAVE_IOPOLL
+   if (iopoll_isactive()) {
+      const size_t ioi = io - iov;
+
+      SASSERTX(ioi < ioc);
+
+      if (iopollv[ioi].pending)
+         --iopendingc;
+
+      if (iopollv[ioi].throttled)
+         --iothrottledc;
+
+      bzero(&iopollv[ioi], sizeof(iopollv[ioi]));
+   }
+#endif /* HAVE_IOPOLL */
+
+   timer_disarm(&iotimers, &iotimerv[io - iov]);
    bzero(io, sizeof(*io));
 
    proctitleupdate();
@@ -49,8 +49,36 @@
 static const char rcsid[] =
 "$Id: sockd_negotiate.c,v 1.477.4.5.2.2 2017/01/31 08:17:38 karls Exp $";
 
-static sockd_negotiate_t negv[SOCKD_NEGOTIATEMAX];
-static const size_t negc = ELEMENTS(negv);
+/*
+ * negv has room for negmax clients, as configured when we started.
+ * negc is the number of slots in negv used so far, so untouched parts
+ * of negv need not be resident.
+ */
+static sockd_negotiate_t *negv;
+static size_t negc;
+static size_t negmax;
+
+/*
+ * Timers for when the clients in negv timeout, indexed the same way.
+ */
+static sockd_timer_t *negtimerv;
+static timerwheel_t  negtimers;
+
+/*
+ * Our own sockets listening on the internal addresses, if child.reuseport
+ * is set.  The sockets are closed (-1) while we have no room for more
+ * clients.
+ */
+static listenaddress_t *acceptv;
+static size_t          acceptc;
+
+#if SOCKD_FASTCONNECT
+/*
+ * Set if the config allows us to perform connect requests to IP-addresses
+ * ourselves.  Updated on each config load.
+ */
+static unsigned char fastconnect_isok;
+#endif /* SOCKD_FASTCONNECT */
 
 static void siginfo(int sig, siginfo_t *si, void *sc);
 
@@ -77,6 +105,50 @@ send_negotiate(sockd_negotiate_t *neg);
  *                     errno will be set.
  */
 
+static int
+negotiate2request(sockd_negotiate_t *neg, sockd_request_t *req);
+/*
+ * Fills in "req" with what is needed to perform the request of "neg",
+ * which has completed negotiation.  Any payload the client has already
+ * sent us is moved from the clients buffer to "req".
+ * Returns:
+ *      On success: 0
+ *      On error: -1.
+ */
+
+#if SOCKD_FASTCONNECT
+static int
+neg_canfastconnect(const sockd_negotiate_t *neg);
+/*
+ * Returns true if the request of "neg" needs nothing that can block,
+ * so that we can perform it ourselves rather than via a request child.
+ */
+
+static int
+perform_negotiate(sockd_negotiate_t *neg);
+/*
+ * Performs the request of "neg" ourselves and sends the resulting io
+ * object to mother, or an ack if the request failed.  On return the
+ * client descriptor has been closed and neg->s is -1.
+ * Returns:
+ *      On success: 0.  Mother has been told about the result.
+ *      On error: -1.  Nothing has been sent to mother.
+ */
+#endif /* SOCKD_FASTCONNECT */
+
+#if SOCKD_ALLINONE
+static int
+pass_negotiate(sockd_negotiate_t *neg);
+/*
+ * Passes the request of "neg" on to the request stage of this process.
+ * On return the client descriptor belongs to the request stage and
+ * neg->s is -1.
+ * Returns:
+ *      On success: 0.
+ *      On error: -1.  Nothing has been passed on.
+ */
+#endif /* SOCKD_ALLINONE */
+
 static int
 recv_negotiate(void);
 /*
@@ -88,12 +160,73 @@ recv_negotiate(void);
  * received passed the ACL-checks.
  */
 
+static int
+add_negotiate(const sockd_client_t *client);
+/*
+ * Adds the new client "client", received from mother or accept(2)-ed by
+ * ourselves, to the clients we are negotiating with.
+ * Returns 0 if the client was added, or -1 if it was not (e.g., blocked),
+ * in which case it has been deleted again.
+ */
+
+static size_t
+accept_negotiate(const listenaddress_t *l, const size_t freec);
+/*
+ * accept(2)s new clients on our listen socket "l", at most "freec".
+ * Returns the number of new clients added.
+ */
+
+static void
+neg_bindinternal(void);
+/*
+ * Makes sure we have our own SO_REUSEPORT socket listening on each of
+ * the internal addresses, closing the ones no longer configured.
+ */
+
+static void
+neg_setlistening(const int dolisten);
+/*
+ * If "dolisten" is set, makes sure our sockets in acceptv are open and
+ * listening.  If not, closes them, so the kernel sends new clients to
+ * the other processes sharing the internal addresses, rather than
+ * queueing them for us until we have room for them.
+ */
+
+static int
+neg_listen(listenaddress_t *l);
+/*
+ * Binds our own SO_REUSEPORT socket to the address of "l" and listens on
+ * it.
+ *
+ * Returns 0 on success, -1 on failure.
+ */
+
 static void
 delete_negotiate(sockd_negotiate_t *neg, const int forwardedtomother);
 /*
  * Frees any state occupied by "neg", including closing any descriptors.
  * If "forwardedtomother" is set, we are deleting the negotiate after
  * forwarding the client object to mother (and thus need not ack mother).
+ * neg->s is -1 if the descriptor has already been closed.
+ */
+
+#if HAVE_NEGOTIATE_PHASE
+static void
+neg_deletetimedout(void);
+/*
+ * Deletes the clients that have not completed negotiation in time.
+ */
+#endif /* HAVE_NEGOTIATE_PHASE */
+
+static void
+neg_process(fd_set *rset, fd_set *wset, int *sendfailed);
+/*
+ * Continues negotiating with the clients set in "rset", and forwards
+ * the clients that have completed negotiation.
+ *
+ * "wset", if not NULL, is the set we checked mother for writability in.
+ * "sendfailed" is set if forwarding a client to mother failed due to
+ * a temporary error, and cleared if forwarding succeeded.
  */
 
 static int
@@ -162,7 +295,7 @@ neg_gettimeout(struct timeval *timeout);
 static sockd_negotiate_t *
 neg_gettimedout(const struct timeval *tnow);
 /*
- * Scans all clients for one that has timed out according to sockscf settings.
+ * Returns a client that has timed out according to sockscf settings.
  * "tnow" is the current time.
  *
  * Returns:
@@ -244,62 +377,24 @@ run_negotiate()
    tmpset   = allocate_maxsize_fdset();
    wsetmem  = allocate_maxsize_fdset();
 
+   negotiate_init(sockscf.child.maxclients.negotiate);
+
    proctitleupdate();
 
    sockd_print_child_ready_message((size_t)freedescriptors(NULL, NULL));
 
    sendfailed  = 0;
    while (1 /* CONSTCOND */) {
-      negotiate_result_t negstatus;
       struct timeval *timeout, timeoutmem;
-      sockd_negotiate_t *neg;
-      struct timeval tnow;
       fd_set *wset;
+      size_t i;
       int fdbits;
 
       errno = 0; /* reset for each iteration. */
 
 
 #if HAVE_NEGOTIATE_PHASE
-      gettimeofday_monotonic(&tnow);
-      while ((neg = neg_gettimedout(&tnow)) != NULL) {
-         const time_t duration
-         = socks_difftime(tnow.tv_sec, neg->state.time.accepted.tv_sec);
-
-         iologaddr_t src;
-         size_t buflen;
-         char buf[512];
-
-         init_iologaddr(&src,
-                        object_sockshost,
-                        &neg->negstate.dst,
-                        object_sockshost,
-                        &neg->negstate.src,
-                        &neg->cauth,
-                        GET_HOSTIDV(&neg->state),
-                        GET_HOSTIDC(&neg->state));
-
-         if (neg->negstate.complete) {
-            struct sockaddr_storage p;
-
-            log_clientdropped(sockshost2sockaddr(&neg->negstate.src, &p));
-         }
-         /*
-          * else; nothing special.  Negotiation simply did not complete in time.
-          */
-
-         buflen = snprintf(buf, sizeof(buf),
-                           "%s after %ld second%s%s",
-                           timeouttype2string(TIMEOUT_NEGOTIATE),
-                           (long)duration,
-                           duration == 1 ? "" : "s",
-                           neg->negstate.complete ?
-                        " while waiting for mother to become available" : "");
-
-
-         logdisconnect(neg->s, neg, OPERATION_ERROR, &src, NULL, buf, buflen);
-         delete_negotiate(neg, 0);
-      }
+      neg_deletetimedout();
 
       fdbits = neg_fillset(rset,
                            sendfailed, /*
@@ -358,6 +453,17 @@ run_negotiate()
       FD_SET(sockscf.state.mother.ack, rset);
       fdbits = MAX(fdbits, sockscf.state.mother.ack);
 
+      /* and our own listen sockets, if we have room for more clients. */
+      neg_setlistening(neg_allocated() < negmax);
+
+      for (i = 0; i < acceptc; ++i) {
+         if (acceptv[i].s == -1)
+            continue;
+
+         FD_SET(acceptv[i].s, rset);
+         fdbits = MAX(fdbits, acceptv[i].s);
+      }
+
       SASSERTX(fdbits >= 0);
 
       ++fdbits;
@@ -417,350 +523,580 @@ run_negotiate()
          FD_CLR(sockscf.state.mother.s, rset);
       }
 
-      while ((neg = neg_getset(rset)) != NULL) {
-         int io_errno;
+      for (i = 0; i < acceptc; ++i) {
+         if (acceptv[i].s == -1 || !FD_ISSET(acceptv[i].s, rset))
+            continue;
 
-         neg_clearset(neg, rset);
+         FD_CLR(acceptv[i].s, rset);
 
-         errno     = 0; /* reset before each client. */
-         negstatus = recv_clientrequest(neg->s, &neg->req, &neg->negstate);
-         io_errno  = errno;
+         if (accept_negotiate(&acceptv[i], negmax - neg_allocated()) > 0)
+            proctitleupdate();
+      }
 
-         slog(LOG_DEBUG,
-              "%s: recv_clientrequest() from client %s returned %d, "
-              "errno is %d (%s)",
-              function,
-              sockshost2string(&neg->negstate.src, NULL, 0),
-              negstatus,
-              errno,
-              errno == 0 ?
-                  "no error" : ERRNOISTMP(errno) ?
-                        "temp error" : "fatal error");
-
-         switch (negstatus) {
-            case NEGOTIATE_CONTINUE:
-               break;
+      neg_process(rset, wset, &sendfailed);
+   }
+}
+
+#if HAVE_NEGOTIATE_PHASE
+static void
+neg_deletetimedout(void)
+{
+   sockd_negotiate_t *neg;
+   struct timeval tnow;
+
+   gettimeofday_monotonic(&tnow);
+   while ((neg = neg_gettimedout(&tnow)) != NULL) {
+      const time_t duration
+      = socks_difftime(tnow.tv_sec, neg->state.time.accepted.tv_sec);
+
+      iologaddr_t src;
+      size_t buflen;
+      char buf[512];
+
+      init_iologaddr(&src,
+                     object_sockshost,
+                     &neg->negstate.dst,
+                     object_sockshost,
+                     &neg->negstate.src,
+                     &neg->cauth,
+                     GET_HOSTIDV(&neg->state),
+                     GET_HOSTIDC(&neg->state));
+
+      if (neg->negstate.complete) {
+         struct sockaddr_storage p;
+
+         log_clientdropped(sockshost2sockaddr(&neg->negstate.src, &p));
+      }
+      /*
+       * else; nothing special.  Negotiation simply did not complete in time.
+       */
+
+      buflen = snprintf(buf, sizeof(buf),
+                        "%s after %ld second%s%s",
+                        timeouttype2string(TIMEOUT_NEGOTIATE),
+                        (long)duration,
+                        duration == 1 ? "" : "s",
+                        neg->negstate.complete ?
+                     " while waiting for mother to become available" : "");
+
+
+      logdisconnect(neg->s, neg, OPERATION_ERROR, &src, NULL, buf, buflen);
+      delete_negotiate(neg, 0);
+   }
+}
+#endif /* HAVE_NEGOTIATE_PHASE */
+
+static void
+neg_process(rset, wset, sendfailed)
+   fd_set *rset;
+   fd_set *wset;
+   int *sendfailed;
+{
+   const char *function = "neg_process()";
+   negotiate_result_t negstatus;
+   sockd_negotiate_t *neg;
+   struct timeval tnow;
+
+   while ((neg = neg_getset(rset)) != NULL) {
+      int io_errno;
+
+      neg_clearset(neg, rset);
+
+      errno     = 0; /* reset before each client. */
+      negstatus = recv_clientrequest(neg->s, &neg->req, &neg->negstate);
+      io_errno  = errno;
+
+      slog(LOG_DEBUG,
+           "%s: recv_clientrequest() from client %s returned %d, "
+           "errno is %d (%s)",
+           function,
+           sockshost2string(&neg->negstate.src, NULL, 0),
+           negstatus,
+           errno,
+           errno == 0 ?
+               "no error" : ERRNOISTMP(errno) ?
+                     "temp error" : "fatal error");
+
+      switch (negstatus) {
+         case NEGOTIATE_CONTINUE:
+            break;
 
-            case NEGOTIATE_FINISHED: {
-               if (!timerisset(&neg->state.time.negotiateend))
-                  gettimeofday_monotonic(&neg->state.time.negotiateend);
+         case NEGOTIATE_FINISHED: {
+            int rc;
 
-               neg->state.command       = neg->req.command;
-               neg->state.protocol      = neg->req.protocol;
-               neg->state.proxyprotocol = neg->req.version;
+            if (!timerisset(&neg->state.time.negotiateend))
+               gettimeofday_monotonic(&neg->state.time.negotiateend);
+
+            neg->state.command       = neg->req.command;
+            neg->state.protocol      = neg->req.protocol;
+            neg->state.proxyprotocol = neg->req.version;
 
 #if COVENANT
-               if (neg->negstate.havedonerulespermit)
-                  slog(LOG_DEBUG,
-                       "%s: must have failed to send client %s to mother "
-                       "before trying again",
-                       function,
-                       sockshost2string(&neg->negstate.src, NULL, 0));
+            if (neg->negstate.havedonerulespermit)
+               slog(LOG_DEBUG,
+                    "%s: must have failed to send client %s to mother "
+                    "before trying again",
+                    function,
+                    sockshost2string(&neg->negstate.src, NULL, 0));
+            else {
+               /*
+                * Need to do rulespermit() of second-level acl in this
+                * process as well, as if it fails due to missing proxy
+                * authentication we need to inform the client and restart
+                * negotiation (i.e., wait for the client to repeat the
+                * request, but this time with proxy authentication).
+                */
+               struct sockaddr_storage src, dst;
+               int permit;
+
+               sockshost2sockaddr(&neg->negstate.src, &src);
+               sockshost2sockaddr(&neg->negstate.dst, &dst);
+
+               slog(LOG_DEBUG, "%s: second-level acl check on %s -> %s",
+                    function,
+                    sockaddr2string(&src, NULL, 0),
+                    sockshost2string(&neg->req.host, NULL, 0));
+
+               permit = rulespermit(neg->s,
+                                    &src,
+                                    &dst,
+                                    &neg->cauth,
+                                    &neg->sauth,
+                                    &neg->srule,
+                                    &neg->state,
+                                    &neg->negstate.src,
+                                    &neg->req.host,
+                                    NULL,
+                                    neg->negstate.emsg,
+                                    sizeof(neg->negstate.emsg));
+
+               if (permit)
+                  neg->negstate.havedonerulespermit = 1;
                else {
-                  /*
-                   * Need to do rulespermit() of second-level acl in this
-                   * process as well, as if it fails due to missing proxy
-                   * authentication we need to inform the client and restart
-                   * negotiation (i.e., wait for the client to repeat the
-                   * request, but this time with proxy authentication).
-                   */
-                  struct sockaddr_storage src, dst;
-                  int permit;
-
-                  sockshost2sockaddr(&neg->negstate.src, &src);
-                  sockshost2sockaddr(&neg->negstate.dst, &dst);
-
-                  slog(LOG_DEBUG, "%s: second-level acl check on %s -> %s",
-                       function,
-                       sockaddr2string(&src, NULL, 0),
-                       sockshost2string(&neg->req.host, NULL, 0));
-
-                  permit = rulespermit(neg->s,
-                                       &src,
-                                       &dst,
-                                       &neg->cauth,
-                                       &neg->sauth,
-                                       &neg->srule,
-                                       &neg->state,
-                                       &neg->negstate.src,
-                                       &neg->req.host,
-                                       NULL,
-                                       neg->negstate.emsg,
-                                       sizeof(neg->negstate.emsg));
-
-                  if (permit)
-                     neg->negstate.havedonerulespermit = 1;
-                  else {
-                     iologaddr_t src;
-                     response_t response;
-
-                     if (neg->srule.whyblock.missingproxyauth) {
-                        if (!neg->negstate.haverequestedproxyauth) {
-                           slog(LOG_DEBUG,
-                                "%s: telling client at %s to provide proxy "
-                                 "authentication before restarting negotiation",
-                                  function,
-                                 sockshost2string(&neg->negstate.src, NULL, 0));
-
-                           bzero(&response, sizeof(response));
-                           response.version    = neg->state.proxyprotocol;
-                           response.host       = neg->req.host;
-                           response.reply.http
-                           = response.version == PROXY_HTTP_10 ?
-                              HTTP_NOTALLOWED : HTTP_PROXYAUTHREQUIRED;
-
-                           send_response(neg->s, &response);
-
-                           neg->negstate.complete               = 0;
-                           neg->negstate.haverequestedproxyauth = 1;
-                           bzero(neg->negstate.mem, sizeof(neg->negstate.mem));
-
-                           continue;
-                        }
+                  iologaddr_t src;
+                  response_t response;
 
+                  if (neg->srule.whyblock.missingproxyauth) {
+                     if (!neg->negstate.haverequestedproxyauth) {
                         slog(LOG_DEBUG,
-                             "%s: already told client at %s to provide "
-                             "proxy authentication, but again it sent "
-                             "us a request without authentication",
-                             function,
-                             sockshost2string(&neg->negstate.src, NULL, 0));
-                     }
+                             "%s: telling client at %s to provide proxy "
+                              "authentication before restarting negotiation",
+                               function,
+                              sockshost2string(&neg->negstate.src, NULL, 0));
 
-                     /*
-                      * only log on deny.  Pass will be logged as usual later.
-                      */
+                        bzero(&response, sizeof(response));
+                        response.version    = neg->state.proxyprotocol;
+                        response.host       = neg->req.host;
+                        response.reply.http
+                        = response.version == PROXY_HTTP_10 ?
+                           HTTP_NOTALLOWED : HTTP_PROXYAUTHREQUIRED;
 
-                     init_iologaddr(&src,
-                                    object_sockshost,
-                                    &neg->negstate.dst,
-                                    object_sockshost,
-                                    &neg->negstate.src,
-                                    &neg->cauth,
-                                    GET_HOSTIDV(&neg->state),
-                                    GET_HOSTIDC(&neg->state));
+                        send_response(neg->s, &response);
 
-                     if (neg->srule.log.tcpinfo) {
-                        int fdv[] = { neg->s };
+                        neg->negstate.complete               = 0;
+                        neg->negstate.haverequestedproxyauth = 1;
+                        bzero(neg->negstate.mem, sizeof(neg->negstate.mem));
 
-                        neg->state.tcpinfo
-                        = get_tcpinfo(ELEMENTS(fdv), fdv, NULL, 0);
+                        continue;
                      }
 
-                     iolog(&neg->srule,
-                           &neg->state,
-                           OPERATION_CONNECT,
-                           &src,
-                           NULL,
-                           NULL,
-                           NULL,
-                           neg->negstate.emsg,
-                           strlen(neg->negstate.emsg));
-
-                     iolog(&neg->crule,
-                           &neg->state,
-                           OPERATION_CONNECT,
-                           &src,
-                           NULL,
-                           NULL,
-                           NULL,
-                           neg->negstate.emsg,
-                           strlen(neg->negstate.emsg));
+                     slog(LOG_DEBUG,
+                          "%s: already told client at %s to provide "
+                          "proxy authentication, but again it sent "
+                          "us a request without authentication",
+                          function,
+                          sockshost2string(&neg->negstate.src, NULL, 0));
+                  }
 
-                     neg->state.tcpinfo = NULL;
+                  /*
+                   * only log on deny.  Pass will be logged as usual later.
+                   */
 
-                     bzero(&response, sizeof(response));
-                     response.version    = neg->state.proxyprotocol;
-                     response.host       = neg->req.host;
-                     response.reply.http = HTTP_FORBIDDEN;
+                  init_iologaddr(&src,
+                                 object_sockshost,
+                                 &neg->negstate.dst,
+                                 object_sockshost,
+                                 &neg->negstate.src,
+                                 &neg->cauth,
+                                 GET_HOSTIDV(&neg->state),
+                                 GET_HOSTIDC(&neg->state));
 
-                     send_response(neg->s, &response);
-                     delete_negotiate(neg, 0);
+                  if (neg->srule.log.tcpinfo) {
+                     int fdv[] = { neg->s };
 
-                     continue;
+                     neg->state.tcpinfo
+                     = get_tcpinfo(ELEMENTS(fdv), fdv, NULL, 0);
                   }
-               }
-#endif /* COVENANT */
 
-               if (wset != NULL && !FD_ISSET(sockscf.state.mother.s, wset)) {
-                  sendfailed = 1;
-                  continue; /* don't bother trying to send to mother now. */
-               }
+                  iolog(&neg->srule,
+                        &neg->state,
+                        OPERATION_CONNECT,
+                        &src,
+                        NULL,
+                        NULL,
+                        NULL,
+                        neg->negstate.emsg,
+                        strlen(neg->negstate.emsg));
 
-               errno = 0;
-               if (send_negotiate(neg) == 0) {
-                  delete_negotiate(neg, 1);
-                  sendfailed = 0;
-               }
-               else if (ERRNOISTMP(errno))
-                  sendfailed = 1; /* we will retry sending this object later. */
-               else {
-                  struct sockaddr_storage p;
+                  iolog(&neg->crule,
+                        &neg->state,
+                        OPERATION_CONNECT,
+                        &src,
+                        NULL,
+                        NULL,
+                        NULL,
+                        neg->negstate.emsg,
+                        strlen(neg->negstate.emsg));
+
+                  neg->state.tcpinfo = NULL;
 
-                  log_clientdropped(sockshost2sockaddr(&neg->negstate.src, &p));
+                  bzero(&response, sizeof(response));
+                  response.version    = neg->state.proxyprotocol;
+                  response.host       = neg->req.host;
+                  response.reply.http = HTTP_FORBIDDEN;
 
+                  send_response(neg->s, &response);
                   delete_negotiate(neg, 0);
 
-                  /*
-                   * assume what failed was not related to the send to mother,
-                   * but some (network) error related to the connection between
-                   * us and the client.  If the error is between us and mother,
-                   * it will be picked up on the control-pipe.
-                   */
-                  sendfailed = 0;
+                  continue;
                }
+            }
+#endif /* COVENANT */
 
-               break;
+            if (wset != NULL && !FD_ISSET(sockscf.state.mother.s, wset)) {
+               *sendfailed = 1;
+               continue; /* don't bother trying to send to mother now. */
             }
 
-            case NEGOTIATE_ERROR:
-            case NEGOTIATE_EOF: {
-               const char *error;
-               const time_t duration = socks_difftime(time_monotonic(NULL),
-                                               neg->state.time.accepted.tv_sec);
-               iologaddr_t src;
-               char reason[256];
-               int takingtoolong = 0, erroriseof = 0;
+            errno = 0;
+#if SOCKD_ALLINONE
+            if (sockscf.state.allinone)
+               rc = pass_negotiate(neg);
+            else
+#endif /* SOCKD_ALLINONE */
+#if SOCKD_FASTCONNECT
+            if (neg_canfastconnect(neg))
+               rc = perform_negotiate(neg);
+            else
+#endif /* SOCKD_FASTCONNECT */
+               rc = send_negotiate(neg);
 
-               if (ERRNOISTMP(io_errno))
-                  continue;
+            if (rc == 0) {
+               delete_negotiate(neg, 1);
+               *sendfailed = 0;
+            }
+            else if (ERRNOISTMP(errno))
+               *sendfailed = 1; /* we will retry sending this object later. */
+            else {
+               struct sockaddr_storage p;
 
-               if (negstatus == NEGOTIATE_EOF) {
-                  error      = "eof from local client";
-                  erroriseof = 1;
-               }
-               else {
-                  if (*neg->negstate.emsg == NUL) {
-                     if (io_errno == 0)
-                        error = "local client protocol error";
-                     else
-                        error = strerror(io_errno);
-                  }
-                  else
-                     error = neg->negstate.emsg;
-               }
+               log_clientdropped(sockshost2sockaddr(&neg->negstate.src, &p));
 
-               if (CRULE_OR_HRULE(neg)->mstats_shmid != 0
-               && (CRULE_OR_HRULE(neg)->alarmsconfigured & ALARM_DISCONNECT)) {
-                  clientinfo_t cinfo;
-                  int weclosed;
+               delete_negotiate(neg, 0);
 
-                  if (negstatus == NEGOTIATE_EOF || ERRNOISNETWORK(errno))
-                     weclosed = 0;
-                  else
-                     weclosed = 1;
+               /*
+                * assume what failed was not related to the send to mother,
+                * but some (network) error related to the connection between
+                * us and the client.  If the error is between us and mother,
+                * it will be picked up on the control-pipe.
+                */
+               *sendfailed = 0;
+            }
 
-                  sockshost2sockaddr(&neg->negstate.src, &cinfo.from);
-                  HOSTIDCOPY(&neg->state, &cinfo);
+            break;
+         }
+
+         case NEGOTIATE_ERROR:
+         case NEGOTIATE_EOF: {
+            const char *error;
+            const time_t duration = socks_difftime(time_monotonic(NULL),
+                                            neg->state.time.accepted.tv_sec);
+            iologaddr_t src;
+            char reason[256];
+            int takingtoolong = 0, erroriseof = 0;
+
+            if (ERRNOISTMP(io_errno))
+               continue;
 
-                  alarm_add_disconnect(weclosed,
-                                       CRULE_OR_HRULE(neg),
-                                       ALARM_INTERNAL,
-                                       &cinfo,
-                                       error,
-                                       sockscf.shmemfd);
+            if (negstatus == NEGOTIATE_EOF) {
+               error      = "eof from local client";
+               erroriseof = 1;
+            }
+            else {
+               if (*neg->negstate.emsg == NUL) {
+                  if (io_errno == 0)
+                     error = "local client protocol error";
+                  else
+                     error = strerror(io_errno);
                }
+               else
+                  error = neg->negstate.emsg;
+            }
 
-               if (!erroriseof && neg->negstate.complete) {
-                  struct timeval tdiff;
+            if (CRULE_OR_HRULE(neg)->mstats_shmid != 0
+            && (CRULE_OR_HRULE(neg)->alarmsconfigured & ALARM_DISCONNECT)) {
+               clientinfo_t cinfo;
+               int weclosed;
+
+               if (negstatus == NEGOTIATE_EOF || ERRNOISNETWORK(errno))
+                  weclosed = 0;
+               else
+                  weclosed = 1;
+
+               sockshost2sockaddr(&neg->negstate.src, &cinfo.from);
+               HOSTIDCOPY(&neg->state, &cinfo);
+
+               alarm_add_disconnect(weclosed,
+                                    CRULE_OR_HRULE(neg),
+                                    ALARM_INTERNAL,
+                                    &cinfo,
+                                    error,
+                                    sockscf.shmemfd);
+            }
 
-                  gettimeofday_monotonic(&tnow);
-                  timersub(&tnow, &neg->state.time.negotiateend, &tdiff);
+            if (!erroriseof && neg->negstate.complete) {
+               struct timeval tdiff;
 
-                  if (tdiff.tv_sec >= CRULE_OR_HRULE(neg)->timeout.negotiate)
-                     takingtoolong = 1;
-               }
+               gettimeofday_monotonic(&tnow);
+               timersub(&tnow, &neg->state.time.negotiateend, &tdiff);
 
-               snprintf(reason, sizeof(reason),
-                       "error after reading %lu byte%s%s in %ld second%s: %s",
-                       (unsigned long)neg->negstate.reqread,
-                       (unsigned long)neg->negstate.reqread == 1 ? "" : "s",
-                       takingtoolong ?
-                           ", possibly due to us taking too "
-                           "long to send the clientobject to mother"  :  "",
-                       (long)duration,
-                       duration == 1 ? "" : "s",
-                       error);
-
-               init_iologaddr(&src,
-                              object_sockshost,
-                              &neg->negstate.dst,
-                              object_sockshost,
-                              &neg->negstate.src,
-                              &neg->cauth,
-                              GET_HOSTIDV(&neg->state),
-                              GET_HOSTIDC(&neg->state));
-
-               if (neg->crule.log.tcpinfo) {
-                  int fdv[] = { neg->s };
-
-                  neg->state.tcpinfo = get_tcpinfo(ELEMENTS(fdv), fdv, NULL, 0);
-               }
+               if (tdiff.tv_sec >= CRULE_OR_HRULE(neg)->timeout.negotiate)
+                  takingtoolong = 1;
+            }
 
-               logdisconnect(neg->s,
-                             neg,
-                             OPERATION_ERROR,
-                             &src,
-                             NULL,
-                             reason,
-                             strlen(reason));
+            snprintf(reason, sizeof(reason),
+                    "error after reading %lu byte%s%s in %ld second%s: %s",
+                    (unsigned long)neg->negstate.reqread,
+                    (unsigned long)neg->negstate.reqread == 1 ? "" : "s",
+                    takingtoolong ?
+                        ", possibly due to us taking too "
+                        "long to send the clientobject to mother"  :  "",
+                    (long)duration,
+                    duration == 1 ? "" : "s",
+                    error);
+
+            init_iologaddr(&src,
+                           object_sockshost,
+                           &neg->negstate.dst,
+                           object_sockshost,
+                           &neg->negstate.src,
+                           &neg->cauth,
+                           GET_HOSTIDV(&neg->state),
+                           GET_HOSTIDC(&neg->state));
 
-               delete_negotiate(neg, 0);
-               break;
+            if (neg->crule.log.tcpinfo) {
+               int fdv[] = { neg->s };
+
+               neg->state.tcpinfo = get_tcpinfo(ELEMENTS(fdv), fdv, NULL, 0);
             }
 
-            default:
-               SERRX(negstatus);
+            logdisconnect(neg->s,
+                          neg,
+                          OPERATION_ERROR,
+                          &src,
+                          NULL,
+                          reason,
+                          strlen(reason));
+
+            delete_negotiate(neg, 0);
+            break;
          }
+
+         default:
+            SERRX(negstatus);
       }
    }
 }
 
 void
-negotiate_preconfigload(void)
+negotiate_init(maxclients)
+   const size_t maxclients;
 {
-   const char *function = "negotiate_preconfigload()";
+   const char *function = "negotiate_init()";
 
-   slog(LOG_DEBUG, "%s", function);
+   negmax = maxclients;
+   if ((negv      = calloc(negmax, sizeof(*negv)))      == NULL
+   ||  (negtimerv = calloc(negmax, sizeof(*negtimerv))) == NULL)
+      serr("%s: failed to allocate memory for %lu clients",
+           function, (unsigned long)negmax);
+
+   timerwheel_init(&negtimers, time_monotonic(NULL));
+
+   if (sockscf.state.reuseport)
+      neg_bindinternal();
 }
 
-void
-negotiate_postconfigload(void)
+#if SOCKD_ALLINONE
+
+int
+negotiate_fdset(fdbits, rset, bufrset, freec)
+   int fdbits;
+   fd_set *rset;
+   fd_set *bufrset;
+   const size_t freec;
 {
-   const char *function = "negotiate_postconfigload()";
    size_t i;
 
-   slog(LOG_DEBUG, "%s", function);
+   for (i = 0; i < negc; ++i) {
+      if (!negv[i].allocated || negv[i].negstate.complete)
+         continue;
+
+      FD_SET(negv[i].s, rset);
+      FD_SET(negv[i].s, bufrset);
+      fdbits = MAX(fdbits, negv[i].s);
+   }
 
    /*
-    * update monitor shmids in rules used by current clients.
+    * As in run_negotiate(), don't leave new clients waiting in our queue
+    * while we have no room for them.
     */
-   for (i = 0; i < negc; ++i) {
-      const monitor_t *p;
-      monitor_t oldmonitor, newmonitor;
-      clientinfo_t cinfo;
+   neg_setlistening(freec > 0);
 
-      if (!negv[i].allocated)
+   for (i = 0; i < acceptc; ++i) {
+      if (acceptv[i].s == -1)
          continue;
 
-      SASSERTX(CRULE_OR_HRULE(&negv[i])->mstats == NULL);
+      FD_SET(acceptv[i].s, rset);
+      fdbits = MAX(fdbits, acceptv[i].s);
+   }
 
-      bzero(&oldmonitor, sizeof(oldmonitor));
-      if (CRULE_OR_HRULE(&negv[i])->mstats_shmid != 0)
-         COPY_MONITORFIELDS(CRULE_OR_HRULE(&negv[i]), &oldmonitor);
+   return fdbits;
+}
 
-      p = monitormatch(&negv[i].negstate.src,
-                       &negv[i].negstate.dst,
-                       &negv[i].cauth,
-                       &negv[i].state);
+struct timeval *
+negotiate_gettimeout(timeout)
+   struct timeval *timeout;
+{
 
-      if (p == NULL)
-         bzero(&newmonitor, sizeof(newmonitor));
-      else {
-         SASSERTX(p->mstats == NULL);
-         newmonitor = *p;
-      }
+   return neg_gettimeout(timeout);
+}
 
-      if (oldmonitor.mstats_shmid == 0 && newmonitor.mstats_shmid == 0)
+void
+negotiate_process(rset, freec)
+   fd_set *rset;
+   size_t freec;
+{
+   size_t i;
+   int sendfailed;
+
+   for (i = 0; i < acceptc; ++i) {
+      if (acceptv[i].s == -1 || !FD_ISSET(acceptv[i].s, rset))
+         continue;
+
+      FD_CLR(acceptv[i].s, rset);
+
+      if (freec > 0)
+         freec -= accept_negotiate(&acceptv[i], freec);
+   }
+
+   /*
+    * Clients that complete negotiation are passed on to the request stage
+    * at once, so unlike in run_negotiate(), there are no completed clients
+    * waiting to be forwarded that we need to add to rset.
+    */
+   sendfailed = 0;
+   neg_process(rset, NULL, &sendfailed);
+
+   neg_deletetimedout();
+}
+
+size_t
+negotiate_allocated(void)
+{
+
+   return neg_allocated();
+}
+
+#endif /* SOCKD_ALLINONE */
+
+void
+negotiate_preconfigload(void)
+{
+   const char *function = "negotiate_preconfigload()";
+
+   slog(LOG_DEBUG, "%s", function);
+}
+
+void
+negotiate_postconfigload(void)
+{
+   const char *function = "negotiate_postconfigload()";
+#if SOCKD_FASTCONNECT
+   const rule_t *rule;
+#endif /* SOCKD_FASTCONNECT */
+   size_t i;
+
+   slog(LOG_DEBUG, "%s", function);
+
+   if (sockscf.state.reuseport && negv != NULL)
+      neg_bindinternal(); /* internal addresses may have changed. */
+
+#if SOCKD_FASTCONNECT
+   /*
+    * We can only perform requests ourselves if doing so will not block
+    * us.  With routes, the request may go via an upstream proxy, and
+    * socks-rules may need to resolve hostnames, ask an external service
+    * (pam, bsdauth, ldap, libwrap/ident) or redirect the request.
+    */
+   fastconnect_isok = (sockscf.route == NULL);
+
+   for (rule = sockscf.srule; rule != NULL; rule = rule->next) {
+      if (rule->src.atype      == SOCKS_ADDR_DOMAIN
+      ||  rule->dst.atype      == SOCKS_ADDR_DOMAIN
+      ||  rule->rdr_from.atype != SOCKS_ADDR_NOTSET
+      ||  rule->rdr_to.atype   != SOCKS_ADDR_NOTSET)
+         fastconnect_isok = 0;
+
+#if HAVE_LIBWRAP
+      if (*rule->libwrap != NUL)
+         fastconnect_isok = 0;
+#endif /* HAVE_LIBWRAP */
+
+#if HAVE_LDAP
+      if (rule->ldapgroup != NULL)
+         fastconnect_isok = 0;
+#endif /* HAVE_LDAP */
+
+      for (i = 0; i < rule->state.smethodc; ++i)
+         if (rule->state.smethodv[i] != AUTHMETHOD_NONE
+         &&  rule->state.smethodv[i] != AUTHMETHOD_UNAME)
+            fastconnect_isok = 0;
+   }
+
+   slog(LOG_DEBUG, "%s: performing connect requests ourselves is %spossible",
+        function, fastconnect_isok ? "" : "not ");
+#endif /* SOCKD_FASTCONNECT */
+
+   /*
+    * update monitor shmids in rules used by current clients.
+    */
+   for (i = 0; i < negc; ++i) {
+      const monitor_t *p;
+      monitor_t oldmonitor, newmonitor;
+      clientinfo_t cinfo;
+
+      if (!negv[i].allocated)
+         continue;
+
+      SASSERTX(CRULE_OR_HRULE(&negv[i])->mstats == NULL);
+
+      bzero(&oldmonitor, sizeof(oldmonitor));
+      if (CRULE_OR_HRULE(&negv[i])->mstats_shmid != 0)
+         COPY_MONITORFIELDS(CRULE_OR_HRULE(&negv[i]), &oldmonitor);
+
+      p = monitormatch(&negv[i].negstate.src,
+                       &negv[i].negstate.dst,
+                       &negv[i].cauth,
+                       &negv[i].state);
+
+      if (p == NULL)
+         bzero(&newmonitor, sizeof(newmonitor));
+      else {
+         SASSERTX(p->mstats == NULL);
+         newmonitor = *p;
+      }
+
+      if (oldmonitor.mstats_shmid == 0 && newmonitor.mstats_shmid == 0)
          continue; /* no monitors for this client before, and no now. */
 
       sockshost2sockaddr(&negv[i].negstate.src, &cinfo.from);
@@ -793,11 +1129,109 @@ send_negotiate(neg)
 #endif /* HAVE_GSSAPI */
    struct iovec iov[2];
    sockd_request_t req;
-   clientinfo_t cinfo;
    struct msghdr msg;
    ssize_t w;
    size_t length, ioc, fdsendt;
    CMSG_AALLOC(cmsg, sizeof(int));
+
+   if (negotiate2request(neg, &req) != 0)
+      return -1;
+
+   bzero(iov, sizeof(iov));
+   ioc               = 0;
+   length            = 0;
+   iov[ioc].iov_base = &req;
+   iov[ioc].iov_len  = sizeof(req);
+   length           += iov[ioc].iov_len;
+   ++ioc;
+
+#if HAVE_GSSAPI
+   if (req.sauth.method == AUTHMETHOD_GSSAPI) {
+      gssapistate.value   = gssapistatemem;
+      gssapistate.length  = sizeof(gssapistatemem);
+
+      if (gssapi_export_state(&req.sauth.mdata.gssapi.state.id, &gssapistate)
+      != 0)
+         return -1;
+
+      iov[ioc].iov_base = gssapistate.value;
+      iov[ioc].iov_len  = gssapistate.length;
+      length           += iov[ioc].iov_len;
+      ++ioc;
+
+      if (sockscf.option.debug >= DEBUG_VERBOSE)
+         slog(LOG_DEBUG, "%s: gssapistate has length %lu",
+              function, (long unsigned)gssapistate.length);
+   }
+#endif /* HAVE_GSSAPI */
+
+   fdsendt = 0;
+
+#if BAREFOOTD
+   if (req.state.command != SOCKS_UDPASSOCIATE)
+      /* udp has no control/client socket until set up in request-child. */
+      CMSG_ADDOBJECT(neg->s, cmsg, sizeof(neg->s) * fdsendt++);
+
+#else /* !BAREFOOTD */
+
+   CMSG_ADDOBJECT(neg->s, cmsg, sizeof(neg->s) * fdsendt++);
+
+#endif /* !BAREFOOTD */
+
+   bzero(&msg, sizeof(msg));
+   msg.msg_iov     = iov;
+   msg.msg_iovlen  = ioc;
+   msg.msg_name    = NULL;
+   msg.msg_namelen = 0;
+
+   /* LINTED pointer casts may be troublesome */
+   CMSG_SETHDR_SEND(msg, cmsg, sizeof(int) * fdsendt);
+
+   if (sockscf.option.debug >= DEBUG_VERBOSE && neg->s != -1)
+      slog(LOG_DEBUG, "%s: sending fd %d (%s) ...",
+           function, neg->s, socket2string(neg->s, NULL, 0));
+
+   if ((w = sendmsgn(sockscf.state.mother.s, &msg, 0, 100)) != (ssize_t)length){
+      slog(LOG_DEBUG, "%s: sending client to mother failed: %s",
+           function, strerror(errno));
+
+#if HAVE_GSSAPI
+      /*
+       * re-import the gssapi state so we can delete if needed.
+       */
+      if (gssapistate.value != NULL) {
+         if (gssapi_import_state(&req.sauth.mdata.gssapi.state.id, &gssapistate)
+         != 0)
+            swarnx("%s: could not re-import gssapi state", function);
+      }
+#endif /* HAVE_GSSAPI */
+   }
+   else {
+      if (sockscf.option.debug >= DEBUG_VERBOSE)
+         slog(LOG_DEBUG,
+              "%s: sent %ld descriptors for command %d.  cauth %s, sauth %s, "
+              "neg->s %d",
+              function,
+              (unsigned long)fdsendt,
+              req.state.command,
+              method2string(req.cauth.method),
+              method2string(req.sauth.method),
+              neg->s);
+   }
+
+   return (size_t)w == length ? 0 : -1;
+}
+
+static int
+negotiate2request(neg, req)
+   sockd_negotiate_t *neg;
+   sockd_request_t *req;
+{
+   const char *function = "negotiate2request()";
+   clientinfo_t cinfo;
+#if HAVE_NEGOTIATE_PHASE
+   size_t length;
+#endif /* HAVE_NEGOTIATE_PHASE */
    int unuse = 0;
 
    sockshost2sockaddr(&neg->negstate.src, &cinfo.from);
@@ -825,12 +1259,12 @@ send_negotiate(neg)
    /*
     * copy needed fields from negotiate.
     */
-   bzero(&req, sizeof(req)); /* silence valgrind warning */
-   sockshost2sockaddr(&neg->negstate.src, &req.from);
-   sockshost2sockaddr(&neg->negstate.dst, &req.to);
+   bzero(req, sizeof(*req)); /* silence valgrind warning */
+   sockshost2sockaddr(&neg->negstate.src, &req->from);
+   sockshost2sockaddr(&neg->negstate.dst, &req->to);
 
-   req.req             = neg->req;
-   req.reqinfo.command = (neg->state.protocol == SOCKS_TCP ?
+   req->req             = neg->req;
+   req->reqinfo.command = (neg->state.protocol == SOCKS_TCP ?
                               SOCKD_FREESLOT_TCP : SOCKD_FREESLOT_UDP);
 
 #if HAVE_NEGOTIATE_PHASE
@@ -844,165 +1278,181 @@ send_negotiate(neg)
    else {
       /* XXX should probably strip out any authorization headers if present. */
       length = neg->negstate.reqread;
-      memcpy(req.clientdata, neg->negstate.mem, length);
+      memcpy(req->clientdata, neg->negstate.mem, length);
    }
 
 #else /* SOCKS_SERVER */
    if ((length = socks_bytesinbuffer(neg->s, READ_BUF, 0)) != 0) {
-      slog(length > sizeof(req.clientdata) ? LOG_INFO : LOG_DEBUG,
+      slog(length > sizeof(req->clientdata) ? LOG_INFO : LOG_DEBUG,
            "%s: local socks client at %s sent us %lu bytes of payload before "
            "we told it that it can do that.  Not permitted by the SOCKS "
            "standard.  %s",
            function,
            socket2string(neg->s, NULL, 0),
            (unsigned long)length,
-           length > sizeof(req.clientdata) ?
+           length > sizeof(req->clientdata) ?
                  "Too much unexpected data for us to handle"
                : "Trying to handle it however");
 
-      if (length > sizeof(req.clientdata))
+      if (length > sizeof(req->clientdata))
         return -1;
 
-      socks_getfrombuffer(neg->s, 0, READ_BUF, 0, req.clientdata, length);
+      socks_getfrombuffer(neg->s, 0, READ_BUF, 0, req->clientdata, length);
    }
 #endif /* SOCKS_SERVER */
 
-    req.clientdatalen = length;
+    req->clientdatalen = length;
 
-    if (req.clientdatalen > 0)
+    if (req->clientdatalen > 0)
        slog(LOG_DEBUG,
             "%s: saving local client data of length %lu for later forwarding",
-            function, (unsigned long)req.clientdatalen);
+            function, (unsigned long)req->clientdatalen);
 #endif /* HAVE_NEGOTIATE_PHASE */
 
-   req.crule       = neg->crule;
+   req->crule       = neg->crule;
 
 #if HAVE_SOCKS_HOSTID
-   req.hrule       = neg->hrule;
-   req.hrule_isset = neg->hrule_isset;
+   req->hrule       = neg->hrule;
+   req->hrule_isset = neg->hrule_isset;
 #endif /* HAVE_SOCKS_HOSTID */
 
 #if COVENANT
-   req.srule         = neg->srule;
+   req->srule         = neg->srule;
 #endif /* COVENANT */
 
-   req.cauth         = neg->cauth;
-   req.sauth         = neg->sauth;
+   req->cauth         = neg->cauth;
+   req->sauth         = neg->sauth;
 
-   req.state         = neg->state;
+   req->state         = neg->state;
 
-   SASSERTX(proxyprotocolisknown(req.state.proxyprotocol));
+   SASSERTX(proxyprotocolisknown(req->state.proxyprotocol));
 
    slog(LOG_DEBUG,
         "%s: client %s finished negotiate phase for command %s using "
         "proxyprotocol %s",
         function,
-        sockaddr2string(&req.from, NULL, 0),
-        command2string(req.state.command),
-        proxyprotocol2string(req.state.proxyprotocol));
+        sockaddr2string(&req->from, NULL, 0),
+        command2string(req->state.command),
+        proxyprotocol2string(req->state.proxyprotocol));
 
-   bzero(iov, sizeof(iov));
-   ioc               = 0;
-   length            = 0;
-   iov[ioc].iov_base = &req;
-   iov[ioc].iov_len  = sizeof(req);
-   length           += iov[ioc].iov_len;
-   ++ioc;
+   return 0;
+}
 
-#if HAVE_GSSAPI
-   if (req.sauth.method == AUTHMETHOD_GSSAPI) {
-      gssapistate.value   = gssapistatemem;
-      gssapistate.length  = sizeof(gssapistatemem);
+#if SOCKD_FASTCONNECT
 
-      if (gssapi_export_state(&req.sauth.mdata.gssapi.state.id, &gssapistate)
-      != 0)
-         return -1;
+static int
+neg_canfastconnect(neg)
+   const sockd_negotiate_t *neg;
+{
+   const char *function = "neg_canfastconnect()";
 
-      iov[ioc].iov_base = gssapistate.value;
-      iov[ioc].iov_len  = gssapistate.length;
-      length           += iov[ioc].iov_len;
-      ++ioc;
+   if (!fastconnect_isok)
+      return 0;
 
-      if (sockscf.option.debug >= DEBUG_VERBOSE)
-         slog(LOG_DEBUG, "%s: gssapistate has length %lu",
-              function, (long unsigned)gssapistate.length);
+   if (neg->req.command != SOCKS_CONNECT)
+      return 0;
+
+   switch (neg->req.host.atype) {
+      case SOCKS_ADDR_IPV4:
+      case SOCKS_ADDR_IPV6:
+         break;
+
+      default:
+         return 0; /* needs resolving. */
    }
-#endif /* HAVE_GSSAPI */
 
-   fdsendt = 0;
+   switch (neg->sauth.method) {
+      case AUTHMETHOD_NONE:
+      case AUTHMETHOD_UNAME:
+         break;
 
-#if BAREFOOTD
-   if (req.state.command != SOCKS_UDPASSOCIATE)
-      /* udp has no control/client socket until set up in request-child. */
-      CMSG_ADDOBJECT(neg->s, cmsg, sizeof(neg->s) * fdsendt++);
+      default:
+         return 0;
+   }
 
-#else /* !BAREFOOTD */
+   /*
+    * We do not have the privileges needed to bind a reserved port, which
+    * a request child may have to do for a client connecting from one.
+    */
+   if (ntohs(neg->negstate.src.port) < IPPORT_RESERVED)
+      return 0;
 
-   CMSG_ADDOBJECT(neg->s, cmsg, sizeof(neg->s) * fdsendt++);
+   slog(LOG_DEBUG, "%s: will perform request from client %s ourselves",
+        function, sockshost2string(&neg->negstate.src, NULL, 0));
 
-#endif /* !BAREFOOTD */
+   return 1;
+}
 
-   bzero(&msg, sizeof(msg));
-   msg.msg_iov     = iov;
-   msg.msg_iovlen  = ioc;
-   msg.msg_name    = NULL;
-   msg.msg_namelen = 0;
+static int
+perform_negotiate(neg)
+   sockd_negotiate_t *neg;
+{
+   sockd_request_t req;
 
-   /* LINTED pointer casts may be troublesome */
-   CMSG_SETHDR_SEND(msg, cmsg, sizeof(int) * fdsendt);
+   if (negotiate2request(neg, &req) != 0)
+      return -1;
 
-   if (sockscf.option.debug >= DEBUG_VERBOSE && neg->s != -1)
-      slog(LOG_DEBUG, "%s: sending fd %d (%s) ...",
-           function, neg->s, socket2string(neg->s, NULL, 0));
+   req.s = neg->s;
 
-   if ((w = sendmsgn(sockscf.state.mother.s, &msg, 0, 100)) != (ssize_t)length){
-      slog(LOG_DEBUG, "%s: sending client to mother failed: %s",
-           function, strerror(errno));
+   /*
+    * Result, successful or not, has been reported to mother by now, and
+    * the client descriptor closed.  Only the buffer remains to be freed.
+    */
+   (void)request_fastpath(&req);
 
-#if HAVE_GSSAPI
-      /*
-       * re-import the gssapi state so we can delete if needed.
-       */
-      if (gssapistate.value != NULL) {
-         if (gssapi_import_state(&req.sauth.mdata.gssapi.state.id, &gssapistate)
-         != 0)
-            swarnx("%s: could not re-import gssapi state", function);
-      }
-#endif /* HAVE_GSSAPI */
-   }
-   else {
-      if (sockscf.option.debug >= DEBUG_VERBOSE)
-         slog(LOG_DEBUG,
-              "%s: sent %ld descriptors for command %d.  cauth %s, sauth %s, "
-              "neg->s %d",
-              function,
-              (unsigned long)fdsendt,
-              req.state.command,
-              method2string(req.cauth.method),
-              method2string(req.sauth.method),
-              neg->s);
-   }
+#if HAVE_NEGOTIATE_PHASE
+   socks_freebuffer(neg->s);
+#endif /* HAVE_NEGOTIATE_PHASE */
 
-   return (size_t)w == length ? 0 : -1;
+   neg->s = -1;
+
+   return 0;
 }
 
+#endif /* SOCKD_FASTCONNECT */
+
+#if SOCKD_ALLINONE
+
+static int
+pass_negotiate(neg)
+   sockd_negotiate_t *neg;
+{
+   sockd_request_t req;
+
+   if (negotiate2request(neg, &req) != 0)
+      return -1;
+
+   /*
+    * Any payload from the client has been moved to "req", and the request
+    * stage allocates its own buffer for the client.
+    */
+   socks_freebuffer(neg->s);
+
+   req.s  = neg->s;
+   neg->s = -1;
+
+   add_request(&req);
+
+   return 0;
+}
+
+#endif /* SOCKD_ALLINONE */
+
 static int
 recv_negotiate(void)
 {
    const char *function = "recv_negotiate()";
-   sockd_client_t client;
-   sockd_negotiate_t *neg;
+   sockd_client_t clientv[SOCKD_HANDOFFMAX];
    struct iovec iov[1];
    struct msghdr msg;
    ssize_t r;
-   size_t i, freec, newc, failedc;
-   CMSG_AALLOC(cmsg, sizeof(int));
-   char ruleinfo[256];
-   int permit, fdreceived;
+   size_t freec, newc, failedc, fdexpect, i;
+   CMSG_AALLOC(cmsg, sizeof(int) * SOCKD_HANDOFFMAX);
+   int fdreceived;
 
    bzero(iov, sizeof(iov));
-   iov[0].iov_base = &client;
-   iov[0].iov_len  = sizeof(client);
+   iov[0].iov_base = clientv;
+   iov[0].iov_len  = sizeof(clientv);
 
    bzero(&msg, sizeof(msg));
    msg.msg_iov     = iov;
@@ -1010,22 +1460,25 @@ recv_negotiate(void)
    msg.msg_name    = NULL;
    msg.msg_namelen = 0;
 
-   /* LINTED pointer casts may be troublesome */
-   CMSG_SETHDR_RECV(msg, cmsg, CMSG_MEMSIZE(cmsg));
-
    newc  = failedc = errno = 0;
-   freec = SOCKD_NEGOTIATEMAX - neg_allocated();
+   freec = negmax - neg_allocated();
 
    while (newc < freec) {
-      const size_t fdexpect = 1;
-      iologaddr_t src, dst;
-      clientinfo_t cinfo;
-
 #if DIAGNOSTIC /* for internal debugging/testing. */
       shmemcheck();
 #endif /* DIAGNOSTIC */
 
-      if ((r = recvmsgn(sockscf.state.mother.s, &msg, 0)) != sizeof(client)) {
+      /*
+       * Mother may send us up to SOCKD_HANDOFFMAX clients in one message,
+       * so reset the control length each time as recvmsg(2) shrinks it to
+       * what was received the last time.
+       */
+      /* LINTED pointer casts may be troublesome */
+      CMSG_SETHDR_RECV(msg, cmsg, CMSG_MEMSIZE(cmsg));
+
+      r = recvmsgn(sockscf.state.mother.s, &msg, 0);
+
+      if (r <= 0 || (size_t)r % sizeof(*clientv) != 0) {
          switch (r) {
             case -1:
             case 0:
@@ -1044,32 +1497,19 @@ recv_negotiate(void)
                       function,
                       (unsigned long)newc,
                       (long)r,
-                      (unsigned long)sizeof(client));
+                      (unsigned long)sizeof(*clientv));
          }
 
          break;
       }
 
+      fdexpect = (size_t)r / sizeof(*clientv);
+
       if (socks_msghaserrors(function, &msg)) {
          ++failedc;
          continue;
       }
 
-      /*
-       * Got packet of expected size, now find a free slot for it.
-       */
-      for (i = 0, neg = NULL; i < negc; ++i)
-         if (!negv[i].allocated) {
-            /*
-             * don't allocate it yet, so siginfo() doesn't print before ready.
-             */
-            neg = &negv[i];
-            break;
-         }
-
-      if (neg == NULL)
-         SERRX(neg_allocated());
-
       if (!CMSG_RCPTLEN_ISOK(msg, sizeof(int) * fdexpect)) {
          swarnx("%s: received control message has the invalid len of %d",
                  function, (int)CMSG_TOTLEN(msg));
@@ -1082,259 +1522,353 @@ recv_negotiate(void)
       SASSERTX(cmsg->cmsg_type  == SCM_RIGHTS);
 
       fdreceived = 0;
-      CMSG_GETOBJECT(neg->s, cmsg, sizeof(neg->s) * fdreceived++);
+      for (i = 0; i < fdexpect; ++i) {
+         CMSG_GETOBJECT(clientv[i].s,
+                        cmsg,
+                        sizeof(clientv[i].s) * fdreceived++);
+
+         if (sockscf.option.debug >= DEBUG_VERBOSE)
+            slog(LOG_DEBUG, "%s: received fd %d (%s) ...",
+                 function, clientv[i].s, socket2string(clientv[i].s, NULL, 0));
+      }
 
-      if (sockscf.option.debug >= DEBUG_VERBOSE)
-         slog(LOG_DEBUG, "%s: received fd %d (%s) ...",
-              function, neg->s, socket2string(neg->s, NULL, 0));
+      for (i = 0; i < fdexpect; ++i) {
+         if (add_negotiate(&clientv[i]) == 0)
+            ++newc;
+         else
+            ++failedc;
+      }
+   }
+
+   if (newc == 0 && failedc == 0) {
+      slog(LOG_DEBUG,
+           "%s: strange ... we were called to receive a new client (%lu/%lu), "
+           "but no new client was there to receive: %s",
+           function,
+           (unsigned long)(freec + 1),
+           (unsigned long)negmax,
+           strerror(errno));
 
-      neg->state.time.accepted = client.accepted;
-      gettimeofday_monotonic(&neg->state.time.negotiatestart);
+      return -1;
+   }
 
-      sockd_check_ipclatency("client object received from mother",
-                             &neg->state.time.accepted,
-                             &neg->state.time.negotiatestart,
-                             &neg->state.time.negotiatestart);
+   if (ERRNOISTMP(errno))
+      errno = 0;
 
-      /*
-       * init state correctly for checking a connection to us.
-       */
+   return newc;
+}
 
-      sockaddr2sockshost(&client.from, &neg->negstate.src);
-      sockaddr2sockshost(&client.to,   &neg->negstate.dst);
+static int
+add_negotiate(client)
+   const sockd_client_t *client;
+{
+   const char *function = "add_negotiate()";
+   sockd_negotiate_t *neg;
+   iologaddr_t src, dst;
+   clientinfo_t cinfo;
+   size_t i;
+   char ruleinfo[256];
+   int permit;
 
-      neg->state.command  = SOCKS_ACCEPT;
-      neg->state.protocol = SOCKS_TCP;
+   /*
+    * find a free slot for the new client.
+    */
+   for (i = 0, neg = NULL; i < negc; ++i)
+      if (!negv[i].allocated) {
+         /*
+          * don't allocate it yet, so siginfo() doesn't print before ready.
+          */
+         neg = &negv[i];
+         break;
+      }
 
-      neg->req.auth       = &neg->sauth;       /* pointer fixup    */
-      neg->cauth.method   = AUTHMETHOD_NOTSET; /* nothing so far   */
+   if (neg == NULL && negc < negmax)
+      neg = &negv[negc++];
 
-#if PRERELEASE
-#warning "XXX add call to sockd_handledsignals() here.  This loop could be long"
-#endif /* PRERELEASE */
+   if (neg == NULL)
+      SERRX(neg_allocated());
 
-      permit = rulespermit(neg->s,
-                           &client.from,
-                           &client.to,
-                           NULL,
-                           &neg->cauth,
-                           &neg->crule,
-                           &neg->state,
-                           &neg->negstate.src,
-                           &neg->negstate.dst,
-                           NULL,
-                           ruleinfo,
-                           sizeof(ruleinfo));
+   neg->s = client->s;
+
+   neg->state.time.accepted = client->accepted;
+   gettimeofday_monotonic(&neg->state.time.negotiatestart);
+
+   sockd_check_ipclatency("client object received from mother",
+                          &neg->state.time.accepted,
+                          &neg->state.time.negotiatestart,
+                          &neg->state.time.negotiatestart);
+
+   /*
+    * init state correctly for checking a connection to us.
+    */
+
+   sockaddr2sockshost(&client->from, &neg->negstate.src);
+   sockaddr2sockshost(&client->to,   &neg->negstate.dst);
+
+   neg->state.command  = SOCKS_ACCEPT;
+   neg->state.protocol = SOCKS_TCP;
 
-      cinfo.from = client.from;
-      HOSTIDCOPY(&neg->state, &cinfo);
+   neg->req.auth       = &neg->sauth;       /* pointer fixup    */
+   neg->cauth.method   = AUTHMETHOD_NOTSET; /* nothing so far   */
 
-      setconfsockoptions(neg->s,
-                         neg->s,
-                         SOCKS_TCP,
-                         1,
-                         neg->crule.socketoptionc,
-                         neg->crule.socketoptionv,
-                         SOCKETOPT_ANYTIME | SOCKETOPT_POST,
-                         SOCKETOPT_ANYTIME | SOCKETOPT_POST);
+#if PRERELEASE
+#warning "XXX add call to sockd_handledsignals() here.  This loop could be long"
+#endif /* PRERELEASE */
 
-      /*
-       * Might need to use some values from cauth when negotiating,
-       * i.e. gssapi or pam-values.  Also, in some cases (gssapi), the
-       * authmethod to be used for socks negotiation needs to be
-       * set at the client acl pass, so start by copying the current
-       * cauth into what will become the sauth proper.
-       */
-      neg->sauth = neg->cauth;
+   permit = rulespermit(neg->s,
+                        &client->from,
+                        &client->to,
+                        NULL,
+                        &neg->cauth,
+                        &neg->crule,
+                        &neg->state,
+                        &neg->negstate.src,
+                        &neg->negstate.dst,
+                        NULL,
+                        ruleinfo,
+                        sizeof(ruleinfo));
 
-      /* but don't actually set the authmethod.  rulespermit() will do that. */
-      neg->sauth.method = AUTHMETHOD_NOTSET;
+   cinfo.from = client->from;
+   HOSTIDCOPY(&neg->state, &cinfo);
 
-      if (permit) {
-         if (shmem_userule(&neg->crule, &cinfo, ruleinfo, sizeof(ruleinfo))
-         != 0) {
-            permit             = 0;
-            neg->crule.verdict = VERDICT_BLOCK;
+   setconfsockoptions(neg->s,
+                      neg->s,
+                      SOCKS_TCP,
+                      1,
+                      neg->crule.socketoptionc,
+                      neg->crule.socketoptionv,
+                      SOCKETOPT_ANYTIME | SOCKETOPT_POST,
+                      SOCKETOPT_ANYTIME | SOCKETOPT_POST);
 
-            SASSERTX(!SHMID_ISATTACHED(&neg->crule));
-            SHMEM_CLEAR(&neg->crule, SHMEM_ALL, 1); /* could not use it. */
-         }
-      }
+   /*
+    * Might need to use some values from cauth when negotiating,
+    * i.e. gssapi or pam-values.  Also, in some cases (gssapi), the
+    * authmethod to be used for socks negotiation needs to be
+    * set at the client acl pass, so start by copying the current
+    * cauth into what will become the sauth proper.
+    */
+   neg->sauth = neg->cauth;
 
-      init_iologaddr(&src,
-                     object_sockaddr,
-                     &client.to,
-                     object_sockshost,
-                     &neg->negstate.src,
-                     &neg->cauth,
-                     GET_HOSTIDV(&neg->state),
-                     GET_HOSTIDC(&neg->state));
+   /* but don't actually set the authmethod.  rulespermit() will do that. */
+   neg->sauth.method = AUTHMETHOD_NOTSET;
 
-      init_iologaddr(&dst,
-                     object_none,
-                     NULL,
-                     object_sockshost,
+   if (permit) {
+      if (shmem_userule(&neg->crule, &cinfo, ruleinfo, sizeof(ruleinfo))
+      != 0) {
+         permit             = 0;
+         neg->crule.verdict = VERDICT_BLOCK;
+
+         SASSERTX(!SHMID_ISATTACHED(&neg->crule));
+         SHMEM_CLEAR(&neg->crule, SHMEM_ALL, 1); /* could not use it. */
+      }
+   }
+
+   init_iologaddr(&src,
+                  object_sockaddr,
+                  &client->to,
+                  object_sockshost,
+                  &neg->negstate.src,
+                  &neg->cauth,
+                  GET_HOSTIDV(&neg->state),
+                  GET_HOSTIDC(&neg->state));
+
+   init_iologaddr(&dst,
+                  object_none,
+                  NULL,
+                  object_sockshost,
 #if BAREFOOTD
-                     &neg->crule.extra.bounceto,
+                  &neg->crule.extra.bounceto,
 #else /* !BAREFOOTD */
-                     NULL,
+                  NULL,
 #endif /* !BAREFOOTD */
-                     NULL,
-                     NULL,
-                     0);
+                  NULL,
+                  NULL,
+                  0);
 
 
 #if !HAVE_SOCKS_RULES
-      /*
-       * If it's a block, this is the only logging that will be done, so
-       * do it now.
-       */
+   /*
+    * If it's a block, this is the only logging that will be done, so
+    * do it now.
+    */
 
-      if (!permit) /* really SOCKS_ACCEPT, but user does not know about that. */
-         neg->state.command = SOCKS_CONNECT;
+   if (!permit) /* really SOCKS_ACCEPT, but user does not know about that. */
+      neg->state.command = SOCKS_CONNECT;
 
-      if (!permit || sockscf.option.debug) {
+   if (!permit || sockscf.option.debug) {
 #endif /* !HAVE_SOCKS_RULES */
 
-      logdisconnect(neg->s,
-                    neg,
-                    permit ? OPERATION_ACCEPT  : OPERATION_BLOCK,
-                    &src,
+   logdisconnect(neg->s,
+                 neg,
+                 permit ? OPERATION_ACCEPT  : OPERATION_BLOCK,
+                 &src,
 #if BAREFOOTD
-                    &dst,
+                 &dst,
 #else /* !HAVE_SOCKS_RULES */
-                    NULL,
+                 NULL,
 #endif /* !HAVE_SOCKS_RULES */
 
-                    ruleinfo,
-                    strlen(ruleinfo));
+                 ruleinfo,
+                 strlen(ruleinfo));
 
 #if !HAVE_SOCKS_RULES
-      }
+   }
 #endif /* !HAVE_SOCKS_RULES */
 
-      if (!permit) {
-         ++failedc;
-         delete_negotiate(neg, 0);
-
-         continue;
-      }
+   if (!permit) {
+      delete_negotiate(neg, 0);
+      return -1;
+   }
 
 #if HAVE_NEGOTIATE_PHASE
-    socks_allocbuffer(neg->s, SOCK_STREAM);
-
-    /*
-     * We don't want this buffer to be bigger than MAXREQLEN, as that is
-     * the amount of memory we have allocated to hold possible client data.
-     *
-     * Normally there is no client data in Dante's case, but some clients
-     * may piggy-back the payload together with the socks request, without
-     * waiting for our response.  That is not legal to do, but some clients
-     * do it anyway, so we better support it.
-     * We therefor need to make sure we never read more of the payload than
-     * we can send on to the i/o process, which will eventually need to
-     * forward it to the destination.
-     */
-    socks_setbufferfd(neg->s, _IONBF, MAXREQLEN);
+   socks_allocbuffer(neg->s, SOCK_STREAM);
+
+   /*
+   * We don't want this buffer to be bigger than MAXREQLEN, as that is
+   * the amount of memory we have allocated to hold possible client data.
+   *
+   * Normally there is no client data in Dante's case, but some clients
+   * may piggy-back the payload together with the socks request, without
+   * waiting for our response.  That is not legal to do, but some clients
+   * do it anyway, so we better support it.
+   * We therefor need to make sure we never read more of the payload than
+   * we can send on to the i/o process, which will eventually need to
+   * forward it to the destination.
+   */
+   socks_setbufferfd(neg->s, _IONBF, MAXREQLEN);
 #endif /* HAVE_NEGOTIATE_PHASE */
 
 #if HAVE_PAM
-      /* copy over pam-values from matched rule. */
-      STRCPY_ASSERTSIZE(neg->sauth.mdata.pam.servicename,
-                        CRULE_OR_HRULE(neg)->state.pamservicename);
+   /* copy over pam-values from matched rule. */
+   STRCPY_ASSERTSIZE(neg->sauth.mdata.pam.servicename,
+                     CRULE_OR_HRULE(neg)->state.pamservicename);
 #endif /* HAVE_PAM */
 
 #if HAVE_BSDAUTH
-      /* copy over bsdauth-values from matched rule. */
-      STRCPY_ASSERTSIZE(neg->sauth.mdata.bsd.style,
-                        CRULE_OR_HRULE(neg)->state.bsdauthstylename);
+   /* copy over bsdauth-values from matched rule. */
+   STRCPY_ASSERTSIZE(neg->sauth.mdata.bsd.style,
+                     CRULE_OR_HRULE(neg)->state.bsdauthstylename);
 #endif /* HAVE_BSDAUTH */
 
 #if HAVE_GSSAPI
-      /* copy over gssapi-values from matched rule. */
-      STRCPY_ASSERTSIZE(neg->sauth.mdata.gssapi.servicename,
-                        CRULE_OR_HRULE(neg)->state.gssapiservicename);
+   /* copy over gssapi-values from matched rule. */
+   STRCPY_ASSERTSIZE(neg->sauth.mdata.gssapi.servicename,
+                     CRULE_OR_HRULE(neg)->state.gssapiservicename);
 
-      STRCPY_ASSERTSIZE(neg->sauth.mdata.gssapi.keytab,
-                        CRULE_OR_HRULE(neg)->state.gssapikeytab);
+   STRCPY_ASSERTSIZE(neg->sauth.mdata.gssapi.keytab,
+                     CRULE_OR_HRULE(neg)->state.gssapikeytab);
 
-      neg->sauth.mdata.gssapi.encryption
-      = CRULE_OR_HRULE(neg)->state.gssapiencryption;
+   neg->sauth.mdata.gssapi.encryption
+   = CRULE_OR_HRULE(neg)->state.gssapiencryption;
 #endif /* HAVE_GSSAPI */
 
 #if HAVE_SOCKS_HOSTID
-      if (sockscf.hrule != NULL) {
-         /*
-          * Unlike the client- and socks-rules, we assume that if no
-          * hostid-rules are configured, we should simply skip/pass
-          * that step.  The reason for this is that hostid may not be
-          * available or in use on the network, or the user may not want
-          * to care about it.  So unless the user explicitly enables
-          * hostid-usage by providing at least one hostid-rule, the most
-          * sensible default is to not require hostid-rules permitting the
-          * client.
-          */
-         size_t p;
-
-         slog(LOG_DEBUG, "%s: checking access through hostid rules", function);
-
-         neg->state.command = SOCKS_HOSTID;
-         permit = rulespermit(neg->s,
-                              &client.from,
-                              &client.to,
-                              &neg->cauth,
-                              &neg->cauth,
-                              &neg->hrule,
-                              &neg->state,
-                              &neg->negstate.src,
-                              &neg->negstate.dst,
-                              NULL,
-                              ruleinfo,
-                              sizeof(ruleinfo));
+   if (sockscf.hrule != NULL) {
+      /*
+       * Unlike the client- and socks-rules, we assume that if no
+       * hostid-rules are configured, we should simply skip/pass
+       * that step.  The reason for this is that hostid may not be
+       * available or in use on the network, or the user may not want
+       * to care about it.  So unless the user explicitly enables
+       * hostid-usage by providing at least one hostid-rule, the most
+       * sensible default is to not require hostid-rules permitting the
+       * client.
+       */
+      size_t p;
 
-         /*
-          * if no hostids, no rules will have been checked.
-          */
-         if (!permit || (permit && neg->state.hostidc > 0)) {
-            neg->hrule_isset = 1;
+      slog(LOG_DEBUG, "%s: checking access through hostid rules", function);
+
+      neg->state.command = SOCKS_HOSTID;
+      permit = rulespermit(neg->s,
+                           &client->from,
+                           &client->to,
+                           &neg->cauth,
+                           &neg->cauth,
+                           &neg->hrule,
+                           &neg->state,
+                           &neg->negstate.src,
+                           &neg->negstate.dst,
+                           NULL,
+                           ruleinfo,
+                           sizeof(ruleinfo));
 
-            setconfsockoptions(neg->s,
-                               -1,
-                               SOCKS_TCP,
-                               1,
-                               neg->hrule.socketoptionc,
-                               neg->hrule.socketoptionv,
-                               SOCKETOPT_PRE | SOCKETOPT_ANYTIME,
-                               0 /* should already be set. */);
+      /*
+       * if no hostids, no rules will have been checked.
+       */
+      if (!permit || (permit && neg->state.hostidc > 0)) {
+         neg->hrule_isset = 1;
 
-            HOSTIDCOPY(&src, &neg->state);
+         setconfsockoptions(neg->s,
+                            -1,
+                            SOCKS_TCP,
+                            1,
+                            neg->hrule.socketoptionc,
+                            neg->hrule.socketoptionv,
+                            SOCKETOPT_PRE | SOCKETOPT_ANYTIME,
+                            0 /* should already be set. */);
 
-            if (permit) {
-               /*
-                * Let the hostid-rule inherit settings from the client-rule,
-                * or use it's own.
-                */
-               if (rule_inheritoruse(&neg->crule,
-                                     &cinfo,
-                                     &neg->hrule,
-                                     &cinfo,
-                                     ALARM_INTERNAL,
-                                     ruleinfo,
-                                     sizeof(ruleinfo)) != 0) {
-                  SHMEM_CLEAR(&neg->hrule, SHMEM_ALL, 1);
-                  permit = 0;
-               }
+         HOSTIDCOPY(&src, &neg->state);
+
+         if (permit) {
+            /*
+             * Let the hostid-rule inherit settings from the client-rule,
+             * or use it's own.
+             */
+            if (rule_inheritoruse(&neg->crule,
+                                  &cinfo,
+                                  &neg->hrule,
+                                  &cinfo,
+                                  ALARM_INTERNAL,
+                                  ruleinfo,
+                                  sizeof(ruleinfo)) != 0) {
+               SHMEM_CLEAR(&neg->hrule, SHMEM_ALL, 1);
+               permit = 0;
             }
+         }
+
+         if (neg->hrule.log.tcpinfo) {
+            int fdv[] = { neg->s };
+
+            neg->state.tcpinfo = get_tcpinfo(ELEMENTS(fdv), fdv, NULL, 0);
+         }
+
+         iolog(&neg->hrule,
+               &neg->state,
+               permit ? OPERATION_HOSTID  : OPERATION_BLOCK,
+               &src,
 
-            if (neg->hrule.log.tcpinfo) {
+#if BAREFOOTD
+               &dst,
+#else /* !HAVE_SOCKS_RULES */
+               NULL,
+#endif /* !HAVE_SOCKS_RULES */
+
+               NULL,
+               NULL,
+               ruleinfo,
+               strlen(ruleinfo));
+
+         if (!permit) {
+            /*
+             * log the client-rule close too.
+             */
+            p = snprintf(ruleinfo, sizeof(ruleinfo),
+                         "blocked by higher-level %s #%lu",
+                         objecttype2string(neg->hrule.type),
+                         (unsigned long)neg->hrule.number);
+
+            if (neg->crule.log.tcpinfo && neg->state.tcpinfo == NULL) {
                int fdv[] = { neg->s };
 
                neg->state.tcpinfo = get_tcpinfo(ELEMENTS(fdv), fdv, NULL, 0);
             }
 
-            iolog(&neg->hrule,
+            neg->state.command = HAVE_SOCKS_RULES ?
+                                    SOCKS_ACCEPT : SOCKS_CONNECT;
+
+            iolog(&neg->crule,
                   &neg->state,
-                  permit ? OPERATION_HOSTID  : OPERATION_BLOCK,
+                  OPERATION_BLOCK,
                   &src,
 
 #if BAREFOOTD
@@ -1346,140 +1880,293 @@ recv_negotiate(void)
                   NULL,
                   NULL,
                   ruleinfo,
-                  strlen(ruleinfo));
+                  p);
 
-            if (!permit) {
+#if !HAVE_SOCKS_RULES
+            if (sockscf.option.debug) {
+               neg->state.command = SOCKS_ACCEPT;
                /*
-                * log the client-rule close too.
+                * normally not logging tcp/accept, but if debug is enabled,
+                * we do.
                 */
-               p = snprintf(ruleinfo, sizeof(ruleinfo),
-                            "blocked by higher-level %s #%lu",
-                            objecttype2string(neg->hrule.type),
-                            (unsigned long)neg->hrule.number);
-
-               if (neg->crule.log.tcpinfo && neg->state.tcpinfo == NULL) {
-                  int fdv[] = { neg->s };
-
-                  neg->state.tcpinfo = get_tcpinfo(ELEMENTS(fdv), fdv, NULL, 0);
-               }
-
-               neg->state.command = HAVE_SOCKS_RULES ?
-                                       SOCKS_ACCEPT : SOCKS_CONNECT;
-
                iolog(&neg->crule,
                      &neg->state,
                      OPERATION_BLOCK,
                      &src,
-
-#if BAREFOOTD
                      &dst,
-#else /* !HAVE_SOCKS_RULES */
-                     NULL,
-#endif /* !HAVE_SOCKS_RULES */
-
                      NULL,
                      NULL,
                      ruleinfo,
                      p);
-
-#if !HAVE_SOCKS_RULES
-               if (sockscf.option.debug) {
-                  neg->state.command = SOCKS_ACCEPT;
-                  /*
-                   * normally not logging tcp/accept, but if debug is enabled,
-                   * we do.
-                   */
-                  iolog(&neg->crule,
-                        &neg->state,
-                        OPERATION_BLOCK,
-                        &src,
-                        &dst,
-                        NULL,
-                        NULL,
-                        ruleinfo,
-                        p);
-               }
-#endif /* !HAVE_SOCKS_RULES */
-
-               neg->state.tcpinfo = NULL;
-
-               ++failedc;
-               delete_negotiate(neg, 0);
-
-               continue;
             }
+#endif /* !HAVE_SOCKS_RULES */
 
             neg->state.tcpinfo = NULL;
+
+            delete_negotiate(neg, 0);
+            return -1;
          }
+
+         neg->state.tcpinfo = NULL;
       }
+   }
 #endif /* HAVE_SOCKS_HOSTID */
 
 #if BAREFOOTD
 
-      neg->req.version       = PROXY_SOCKS_V5;
-      neg->req.command       = SOCKS_CONNECT;
-      neg->req.flag          = 0;
-      neg->req.protocol      = SOCKS_TCP;
+   neg->req.version       = PROXY_SOCKS_V5;
+   neg->req.command       = SOCKS_CONNECT;
+   neg->req.flag          = 0;
+   neg->req.protocol      = SOCKS_TCP;
 
-      ruleaddr2sockshost(&neg->crule.extra.bounceto,
-                         &neg->req.host,
-                         neg->req.protocol);
+   ruleaddr2sockshost(&neg->crule.extra.bounceto,
+                      &neg->req.host,
+                      neg->req.protocol);
 
-      neg->negstate.complete = 1; /* nothing to do in barefoot's case. */
+   neg->negstate.complete = 1; /* nothing to do in barefoot's case. */
 
 #elif COVENANT /* !BAREFOOTD */
 
-      if (client.clientdatalen > 0) {
-         slog(LOG_DEBUG,
-              "%s: received client already has %lu bytes read from it.  "
-              "Must be a client that is changing it's http server target "
-              "to %s, so request should already be parsed",
-              function,
-              (unsigned long)client.clientdatalen,
-              sockshost2string(&client.request.host, NULL, 0));
-
-         SASSERTX(client.clientdatalen <= sizeof(neg->negstate.mem));
-         memcpy(neg->negstate.mem, client.clientdata, client.clientdatalen);
-         neg->negstate.reqread  = client.clientdatalen;
-         neg->negstate.complete = 1;
-         neg->req               = client.request;
-         *neg->req.auth         = client.auth; /* pointer fixup. */
-      }
+   if (client->clientdatalen > 0) {
+      slog(LOG_DEBUG,
+           "%s: received client already has %lu bytes read from it.  "
+           "Must be a client that is changing it's http server target "
+           "to %s, so request should already be parsed",
+           function,
+           (unsigned long)client->clientdatalen,
+           sockshost2string(&client->request.host, NULL, 0));
+
+      SASSERTX(client->clientdatalen <= sizeof(neg->negstate.mem));
+      memcpy(neg->negstate.mem, client->clientdata, client->clientdatalen);
+      neg->negstate.reqread  = client->clientdatalen;
+      neg->negstate.complete = 1;
+      neg->req               = client->request;
+      *neg->req.auth         = client->auth; /* pointer fixup. */
+   }
 #endif /* COVENANT */
 
+   /*
+    * wait with this until the end, when we know that the client was
+    * accepted and by what rule (crule or hrule).
+    */
+   if (CRULE_OR_HRULE(neg)->mstats_shmid != 0
+   &&  CRULE_OR_HRULE(neg)->alarmsconfigured & ALARM_DISCONNECT)
+     alarm_add_connect(CRULE_OR_HRULE(neg),
+                       ALARM_INTERNAL,
+                       &cinfo,
+                       sockscf.shmemfd);
+
+   neg->negstate.crule = &neg->crule;
+
+   if (CRULE_OR_HRULE(neg)->timeout.negotiate != 0)
+      timer_arm(&negtimers,
+                &negtimerv[neg - negv],
+                neg->state.time.negotiatestart.tv_sec
+                + CRULE_OR_HRULE(neg)->timeout.negotiate);
+
+   neg->allocated = 1;
+
+   return 0;
+}
+
+static size_t
+accept_negotiate(l, freec)
+   const listenaddress_t *l;
+   const size_t freec;
+{
+   const char *function = "accept_negotiate()";
+   const unsigned char cmd = SOCKD_NEWCLIENT_TCP;
+   size_t newc;
+
+   newc = 0;
+   while (newc < freec) {
+      sockd_client_t client;
+      socklen_t len;
+
+      bzero(&client, sizeof(client));
+
+      len = sizeof(client.from);
+      if ((client.s = acceptn(l->s, &client.from, &len)) == -1) {
+         if (errno == ENFILE || errno == EMFILE)
+            swarn("%s: could not accept new client", function);
+         else if (!ERRNOISTMP(errno))
+            slog(LOG_DEBUG, "%s: accept(2) of new client failed: %s",
+                 function, strerror(errno));
+
+         break;
+      }
+
+      if (IPADDRISBOUND(&l->addr))
+         client.to = l->addr;
+      else {
+         /*
+          * wildcard address.  Don't know what address client was
+          * accepted on.
+          */
+         len = sizeof(client.to);
+         if (getsockname(client.s, TOSA(&client.to), &len) != 0) {
+            slog(LOG_DEBUG, "%s: getsockname(2) failed after accept(2): %s",
+                 function, strerror(errno));
+
+            close(client.s);
+            continue;
+         }
+      }
+
+      gettimeofday_monotonic(&client.accepted);
+
+      slog(LOG_DEBUG, "%s: accepted tcp client %s on address %s, fd %d",
+           function,
+           sockaddr2string(&client.from, NULL, 0),
+           sockaddr2string(&l->addr, NULL, 0),
+           l->s);
+
       /*
-       * wait with this until the end, when we know that the client was
-       * accepted and by what rule (crule or hrule).
+       * Mother needs to know this slot is taken before we possibly
+       * free it again in add_negotiate().
        */
-      if (CRULE_OR_HRULE(neg)->mstats_shmid != 0
-      &&  CRULE_OR_HRULE(neg)->alarmsconfigured & ALARM_DISCONNECT)
-        alarm_add_connect(CRULE_OR_HRULE(neg),
-                          ALARM_INTERNAL,
-                          &cinfo,
-                          sockscf.shmemfd);
+      if (socks_sendton(sockscf.state.mother.ack,
+                        &cmd,
+                        sizeof(cmd),
+                        sizeof(cmd),
+                        0,
+                        NULL,
+                        0,
+                        NULL,
+                        NULL) != sizeof(cmd)) {
+         slog(sockd_motherexists() ? LOG_WARNING : LOG_DEBUG,
+              "%s: sending ack to mother failed: %s",
+              function, strerror(errno));
+
+         close(client.s);
+         break;
+      }
+
+      if (add_negotiate(&client) == 0)
+         ++newc;
+   }
+
+   return newc;
+}
 
-      neg->negstate.crule = &neg->crule;
+static void
+neg_bindinternal(void)
+{
+   const char *function = "neg_bindinternal()";
+   listenaddress_t *newv;
+   size_t i, newc;
+
+   if ((newv = malloc(sizeof(*newv) * MAX(sockscf.internal.addrc, 1)))
+   == NULL)
+      serr("%s: failed to allocate memory for %lu internal addresses",
+           function, (unsigned long)sockscf.internal.addrc);
+
+   for (i = newc = 0; i < sockscf.internal.addrc; ++i) {
+      ssize_t old;
+
+      if (sockscf.internal.addrv[i].protocol != SOCKS_TCP)
+         continue;
+
+      newv[newc] = sockscf.internal.addrv[i];
+
+      if ((old = addrindex_on_listenlist(acceptc,
+                                         acceptv,
+                                         &newv[newc].addr,
+                                         SOCKS_TCP)) != -1) {
+         /* already listening on this one; keep it and its queue. */
+         newv[newc]     = acceptv[old];
+         acceptv[old].s = -1;
+      }
+      else if (neg_listen(&newv[newc]) != 0) {
+         swarnx("%s: will not accept clients on address %s",
+                function, sockaddr2string(&newv[newc].addr, NULL, 0));
+         continue;
+      }
 
-      neg->allocated = 1;
       ++newc;
    }
 
-   if (newc == 0 && failedc == 0) {
-      slog(LOG_DEBUG,
-           "%s: strange ... we were called to receive a new client (%lu/%lu), "
-           "but no new client was there to receive: %s",
-           function,
-           (unsigned long)(freec + 1),
-           (unsigned long)SOCKD_NEGOTIATEMAX,
-           strerror(errno));
+   for (i = 0; i < acceptc; ++i)
+      if (acceptv[i].s != -1) {
+         slog(LOG_DEBUG, "%s: no longer listening on address %s",
+              function, sockaddr2string(&acceptv[i].addr, NULL, 0));
 
-      return -1;
+         close(acceptv[i].s);
+      }
+
+   free(acceptv);
+   acceptv = newv;
+   acceptc = newc;
+}
+
+static void
+neg_setlistening(dolisten)
+   const int dolisten;
+{
+   const char *function = "neg_setlistening()";
+   static time_t lastfailed;
+   size_t i;
+
+   for (i = 0; i < acceptc; ++i) {
+      if (dolisten == (acceptv[i].s != -1))
+         continue;
+
+      if (!dolisten) {
+         /*
+          * Clients already queued on the socket are reset by the close,
+          * unless net.ipv4.tcp_migrate_req lets the kernel move them to
+          * another process listening on the same address.
+          */
+         slog(LOG_DEBUG, "%s: no room for more clients; closing fd %d "
+                         "listening on address %s",
+              function,
+              acceptv[i].s,
+              sockaddr2string(&acceptv[i].addr, NULL, 0));
+
+         close(acceptv[i].s);
+         acceptv[i].s = -1;
+
+         continue;
+      }
+
+      /*
+       * Don't retry on every loop if the address can not be bound again.
+       */
+      if (lastfailed == time_monotonic(NULL))
+         continue;
+
+      if (neg_listen(&acceptv[i]) != 0) {
+         swarnx("%s: could not listen on address %s again.  Will retry",
+                function, sockaddr2string(&acceptv[i].addr, NULL, 0));
+
+         acceptv[i].s = -1;
+         lastfailed   = time_monotonic(NULL);
+      }
    }
+}
 
-   if (ERRNOISTMP(errno))
-      errno = 0;
+static int
+neg_listen(l)
+   listenaddress_t *l;
+{
+   const char *function = "neg_listen()";
+   int rc;
 
-   return newc;
+   /*
+    * Needs the same privileges as mother had when she bound the
+    * address, or the kernel will not let us share it.
+    */
+   sockd_priv(SOCKD_PRIV_PRIVILEGED, PRIV_ON);
+   rc = bindlistenaddress(l, 1, 1);
+   sockd_priv(SOCKD_PRIV_PRIVILEGED, PRIV_OFF);
+
+   if (rc != 0)
+      return -1;
+
+   slog(LOG_DEBUG, "%s: listening on address %s, fd %d",
+        function, sockaddr2string(&l->addr, NULL, 0), l->s);
+
+   return 0;
 }
 
 static void
@@ -1544,11 +2231,15 @@ delete_negotiate(neg, forwardedtomother)
                   SHMEM_ALL);
    }
 
+   if (neg->s != -1) {
 #if HAVE_NEGOTIATE_PHASE
-   socks_freebuffer(neg->s);
+      socks_freebuffer(neg->s);
 #endif /* HAVE_NEGOTIATE_PHASE */
 
-   close(neg->s);
+      close(neg->s);
+   }
+
+   timer_disarm(&negtimers, &negtimerv[neg - negv]);
    bzero(neg, sizeof(*neg));
    proctitleupdate();
 }
@@ -1640,10 +2331,13 @@ static void
 proctitleupdate(void)
 {
 
+   if (sockscf.state.allinone)
+      return; /* the i/o stage updates the title for all of us. */
+
    setproctitle("%s: %lu/%lu",
                 childtype2string(sockscf.state.type),
                 (unsigned long)neg_allocated(),
-                (unsigned long)SOCKD_NEGOTIATEMAX);
+                (unsigned long)negmax);
 }
 
 static void
@@ -1702,39 +2396,10 @@ neg_gettimeout(timeout)
    struct timeval *timeout;
 {
 #if HAVE_NEGOTIATE_PHASE
-   const char *function = "neg_gettimeout()";
-   time_t timenow;
-   size_t i;
-   int havetimeout;
-
-   havetimeout = 0;
-   time_monotonic(&timenow);
-
-   for (i = 0; i < negc; ++i) {
-      if (!negv[i].allocated)
-         continue;
-
-      if (CRULE_OR_HRULE(&negv[i])->timeout.negotiate == 0)
-         continue;
-
-      if (havetimeout)
-         timeout->tv_sec
-         = MAX(0,
-               MIN(timeout->tv_sec,
-                   socks_difftime(CRULE_OR_HRULE(&negv[i])->timeout.negotiate,
-                                  socks_difftime(timenow,
-                                   negv[i].state.time.negotiatestart.tv_sec))));
-      else {
-         timeout->tv_sec
-         = MAX(0,
-               socks_difftime(CRULE_OR_HRULE(&negv[i])->timeout.negotiate,
-                              socks_difftime(timenow,
-                                    negv[i].state.time.negotiatestart.tv_sec)));
-         havetimeout = 1;
-      }
-   }
 
-   if (!havetimeout)
+   if ((timeout->tv_sec = timerwheel_timeuntil(&negtimers,
+                                               time_monotonic(NULL)))
+   == (time_t)-1)
       timeout = NULL;
    else {
       /*
@@ -1774,6 +2439,8 @@ siginfo(sig, si, sc)
    slog(LOG_INFO, "negotiate-child up %lu day%s, %lu:%.2lu:%.2lu",
                   days, days == 1 ? "" : "s", hours, minutes, seconds);
 
+   log_rulecachestats();
+
    for (i = 0; i < negc; ++i) {
       char srcstring[MAX_IOLOGADDR], *tcpinfo;
 
@@ -1816,18 +2483,18 @@ siginfo(sig, si, sc)
 static sockd_negotiate_t *
 neg_gettimedout(const struct timeval *tnow)
 {
-   size_t i;
+   sockd_timer_t *timer;
+   sockd_negotiate_t *neg;
 
-   for (i = 0; i < negc; ++i) {
-      if (!negv[i].allocated
-      || CRULE_OR_HRULE(&negv[i])->timeout.negotiate == 0)
-         continue;
+   if ((timer = timerwheel_getexpired(&negtimers, tnow->tv_sec)) == NULL)
+      return NULL;
 
-      if (socks_difftime(tnow->tv_sec, negv[i].state.time.negotiatestart.tv_sec)
-      >= CRULE_OR_HRULE(&negv[i])->timeout.negotiate)
-         return &negv[i];
-   }
+   neg = &negv[timer - negtimerv];
 
-   return NULL;
+   SASSERTX(neg->allocated);
+   SASSERTX(socks_difftime(tnow->tv_sec, neg->state.time.negotiatestart.tv_sec)
+   >=       CRULE_OR_HRULE(neg)->timeout.negotiate);
+
+   return neg;
 }
 #endif /* HAVE_NEGOTIATE_PHASE */
@@ -48,6 +48,13 @@ static const char rcsid[] =
 "$Id: sockd_protocol.c,v 1.214.4.1 2014/08/15 18:16:43 karls Exp $";
 
 #if SOCKS_SERVER
+static int
+flush_negotiatereply(int s, request_t *request, negotiate_state_t *state);
+/*
+ * Sends the replies saved in "state" by send_negotiatereply(), if any.
+ * Returns 0 on success, -1 on failure.
+ */
+
 static negotiate_result_t
 recv_v4req(int s, request_t *request, negotiate_state_t *state);
 
@@ -158,6 +165,19 @@ recv_clientrequest(s, request, state)
       rc = state->rcurrent(s, request, state);
    }
 
+#if SOCKS_SERVER
+   /*
+    * Whatever happened, don't keep the client waiting for our replies.
+    */
+   if (state->replylen > 0 && flush_negotiatereply(s, request, state) != 0) {
+      if (rc != NEGOTIATE_ERROR)
+         snprintf(state->emsg, sizeof(state->emsg),
+                  "could not send reply to client: %s", strerror(errno));
+
+      rc = NEGOTIATE_ERROR;
+   }
+#endif /* SOCKS_SERVER */
+
    state->complete = (rc == NEGOTIATE_FINISHED);
    return rc;
 #else /* !HAVE_NEGOTIATE_PHASE */
@@ -422,6 +442,92 @@ recv_sockspacket(s, request, state)
    return recv_ver(s, request, state);
 }
 
+int
+send_negotiatereply(s, reply, replylen, request, state)
+   int s;
+   const unsigned char *reply;
+   const size_t replylen;
+   request_t *request;
+   negotiate_state_t *state;
+{
+   const char *function = "send_negotiatereply()";
+
+   SASSERTX(state->replylen + replylen <= sizeof(state->reply));
+
+   memcpy(&state->reply[state->replylen], reply, replylen);
+   state->replylen += replylen;
+
+   if (negotiate_ispipelined(s, request)) {
+      slog(LOG_DEBUG,
+           "%s: client %s has pipelined its requests.  Holding back our "
+           "reply of %lu bytes until our next reply",
+           function,
+           sockshost2string(&state->src, NULL, 0),
+           (unsigned long)state->replylen);
+
+      return 0;
+   }
+
+   return flush_negotiatereply(s, request, state);
+}
+
+int
+negotiate_ispipelined(s, request)
+   int s;
+   const request_t *request;
+{
+
+   /*
+    * The methods we negotiate ourselves, so no other replies need to be
+    * sent in between.
+    */
+   switch (request->auth->method) {
+      case AUTHMETHOD_NONE:
+      case AUTHMETHOD_UNAME:
+         break;
+
+      default:
+         return 0;
+   }
+
+   return socks_bytesinbuffer(s, READ_BUF, 0) > 0;
+}
+
+static int
+flush_negotiatereply(s, request, state)
+   int s;
+   request_t *request;
+   negotiate_state_t *state;
+{
+   const char *function = "flush_negotiatereply()";
+   sendto_info_t sendtoflags;
+
+   if (state->replylen == 0)
+      return 0;
+
+   slog(LOG_DEBUG, "%s: sending %lu bytes of replies to client %s",
+        function,
+        (unsigned long)state->replylen,
+        sockshost2string(&state->src, NULL, 0));
+
+   bzero(&sendtoflags, sizeof(sendtoflags));
+   sendtoflags.side = INTERNALIF;
+
+   if (socks_sendton(s,
+                     state->reply,
+                     state->replylen,
+                     state->replylen,
+                     0,
+                     NULL,
+                     0,
+                     &sendtoflags,
+                     request->auth) != (ssize_t)state->replylen)
+      return -1;
+
+   state->replylen = 0;
+   return 0;
+}
+
 static negotiate_result_t
 recv_v4req (s, request, state)
    int s;
@@ -501,7 +607,6 @@ recv_methods(s, request, state)
 
 {
    const char *function = "recv_methods()";
-   sendto_info_t sendtoflags;
    const unsigned char methodc = state->mem[AUTH_NMETHODS];
    unsigned char reply[   1 /* VERSION   */
                         + 1 /* METHOD    */
@@ -595,18 +700,7 @@ recv_methods(s, request, state)
    reply[AUTH_VERSION]        = request->version;
    reply[AUTH_SELECTEDMETHOD] = (unsigned char)request->auth->method;
 
-   bzero(&sendtoflags, sizeof(sendtoflags));
-   sendtoflags.side = EXTERNALIF;
-
-   if (socks_sendton(s,
-                     reply,
-                     sizeof(reply),
-                     sizeof(reply),
-                     0,
-                     NULL,
-                     0,
-                     &sendtoflags,
-                     request->auth) != sizeof(reply))
+   if (send_negotiatereply(s, reply, sizeof(reply), request, state) != 0)
       return NEGOTIATE_ERROR;
 
    if (request->auth->method == AUTHMETHOD_NOACCEPT) {
@@ -617,6 +711,14 @@ recv_methods(s, request, state)
    }
 
    state->rcurrent = methodnegotiate;
+
+   /*
+    * If the client has not waited for our response, but already sent
+    * what comes next, go on with that now.
+    */
+   if (negotiate_ispipelined(s, request))
+      return state->rcurrent(s, request, state);
+
    return NEGOTIATE_CONTINUE; /* presumably client is awaiting our response. */
 }
 
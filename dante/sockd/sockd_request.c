@@ -49,15 +49,24 @@ static const char rcsid[] =
 "$Id: sockd_request.c,v 1.849.4.15.2.4 2017/01/31 08:17:39 karls Exp $";
 
 /*
- * XXX Should fix things so this process too can support multiple clients.
- * Will also fix the terrible fact that we just sit around and wait if the
- * command is bind, wasting the whole process on practically nothing.
+ * XXX A request process can handle child.maxclients.request clients at a
+ * time, but only waits for connects to upstream proxies and to the
+ * addresses of a hostname in parallel.
+ * We still just sit around and wait if the command is bind, wasting the
+ * whole process on practically nothing.
  */
 
+typedef enum { REQUEST_PROCESSING = 0,
+               REQUEST_RESOLVE,
+               REQUEST_CHAINCONNECT,
+               REQUEST_HOSTCONNECT } reqstate_t;
 
-/* start of siginfo struct for requestchild.  Just the basics for now. */
+/* a request we are handling. */
 static struct req {
    unsigned char             allocated;
+   reqstate_t                state;           /* what we are doing with it.   */
+
+   sockd_request_t           sockdrequest;    /* request as received.         */
 
    rule_t                    crule;           /* crule matched for client.    */
 #if HAVE_SOCKS_HOSTID
@@ -73,8 +82,38 @@ static struct req {
                                                */
    int                       s;               /* control-connection to client */
    time_t                    starttime;       /* time we started handling req */
-} reqv[1];
-static const size_t reqc = ELEMENTS(reqv);
+
+   /*
+    * Set while in state REQUEST_CHAINCONNECT, i.e. while waiting for the
+    * connect to the upstream proxy to complete.  "io" and "response" are
+    * also set in state REQUEST_HOSTCONNECT.
+    */
+   struct {
+      sockd_io_t             io;              /* io as set up so far.         */
+      response_t             response;        /* response to client.          */
+      socks_t                packet;          /* request to upstream proxy.   */
+      route_t                *route;          /* route used, if not reloaded. */
+   } chain;
+
+   /*
+    * Set while in state REQUEST_HOSTCONNECT, i.e. while waiting for the
+    * connects to the addresses of the target hostname.
+    */
+   connecthost_t             hostconnect;
+} *reqv;
+static size_t reqc, requsedc;
+
+static sockd_timer_t *reqtimerv;  /* timer for slot in reqv with same index. */
+static timerwheel_t  reqtimers;
+
+/* connects we have started to check whether a bad route works again. */
+static struct {
+   unsigned char allocated;
+   int           number;     /* number of route probed.                     */
+   int           s;          /* socket connecting to the upstream proxy.    */
+   time_t        starttime;  /* time we started the connect.                */
+} routeprobev[SOCKD_ROUTEPROBE_MAX];
+static size_t routeprobec;   /* number of probes in progress.               */
 
 static void siginfo(int sig, siginfo_t *si, void *sc);
 
@@ -99,7 +138,19 @@ auth2standard(const authmethod_t *auth, authmethod_t *stdauth);
 static void init_req(struct req *req, const sockd_request_t *request);
 static void delete_req(struct req *req);
 /*
- * Inits and de-inits "req".  For siginfo printing.
+ * Inits and de-inits "req".
+ */
+
+static void
+request_failed(sockd_request_t *request, const iostatus_t iostatus,
+               const int weclosedfirst, const char *emsg);
+/*
+ * Cleans up after the request "request" was not performed because of
+ * "iostatus", as returned by dorequest() or dochainedrequest().
+ * "weclosedfirst" and "emsg" are as set by the same call.
+ *
+ * Logs the client-level close of the session and tells mother the slot
+ * used for the request is free again.
  */
 
 static void
@@ -118,13 +169,66 @@ convertresponse(const response_t *oldres, response_t *newres,
  * to a new response on form "newversion".
  */
 
+static int resolvefirst(const sockd_request_t *request);
+/*
+ * Returns true if the hostname in "request" should be resolved by our
+ * own resolver before we perform "request".  If the hostcache has an
+ * expired entry for it that can still be used, starts refreshing the
+ * entry in the background and returns false.
+ */
+
+static void performreq(struct req *req);
+/*
+ * Performs the request in "req" via dorequest(), and deletes "req"
+ * afterwards, unless it has to wait for something first.
+ */
+
+static void request_start(struct req *req);
+/*
+ * Starts on the newly added request "req", either by having our resolver
+ * look up the hostname in it first, or by performing it right away.
+ */
+
+static int routeprobe_isdue(const route_t *route, const time_t tnow);
+/*
+ * Returns true if "route" is marked as bad and is one we can probe.
+ */
+
+static time_t routeprobe_timeout(void);
+/*
+ * Returns the number of seconds to wait for a probe to complete.
+ */
+
+static int routeprobe_fdset(int fdbits, fd_set *wset);
+/*
+ * Adds the sockets of our probes of bad routes to "wset".
+ * Returns the highest descriptor in "wset", or "fdbits" if that is higher.
+ */
+
+static time_t routeprobe_timeuntil(const time_t tnow);
+/*
+ * Returns the number of seconds until routeprobe_process() should be
+ * called, or -1 if there is nothing to wait for.
+ */
+
+static void routeprobe_process(fd_set *wset, const time_t tnow);
+/*
+ * Checks the probes whose sockets are set in "wset", or that have timed
+ * out, and starts new probes of the routes marked as bad that are due
+ * to be probed again.
+ *
+ * A route whose upstream proxy accepts our connect(2) is no longer
+ * considered bad, so that it can be used again without waiting for
+ * route.badexpire, if set, to expire.
+ */
+
 static iostatus_t
-dorequest(const sockd_mother_t *mother, sockd_request_t *request,
+dorequest(const sockd_mother_t *mother, struct req *req,
           struct sockaddr_storage *clientudpaddr, int *weclosedfirst,
           char *emsg, const size_t emsglen);
 /*
- * When a complete request has been read, this function can be
- * called.  It will perform the request "request->req" and send the
+ * When a complete request has been read into "req->sockdrequest", and
+ * "req" initialized, this function can be called.  It will perform the request and send the
  * result to "mother".
  *
  * If the request is for a udp-associate, the address the client told
@@ -139,11 +243,62 @@ dorequest(const sockd_mother_t *mother, sockd_request_t *request,
  *
  * Returns:
  *    If request was successfully completed: IO_NOERROR.
+ *    If request is waiting for the connect to an upstream proxy to
+ *        complete: IO_EAGAIN.  "req" is then in state REQUEST_CHAINCONNECT
+ *        and dochainedrequest() should be called once io.dst.s of
+ *        "req->chain" becomes writable, or the timer for "req" expires.
+ *    If request is waiting for the connects to the addresses of the
+ *        target hostname: IO_EAGAIN.  "req" is then in state
+ *        REQUEST_HOSTCONNECT and dohostconnect() should be called as
+ *        described for connecthost_process(), or when the timer for "req"
+ *        expires.
  *    If request was not performed: an iostauts indicating the reason.
  *        In this case "weclosedfirst" is also set to true or false,
  *        indicating whether we or a peer first closed the connection.
  */
 
+static iostatus_t
+dochainedrequest(const sockd_mother_t *mother, struct req *req,
+                 const int timedout, int *weclosedfirst,
+                 char *emsg, const size_t emsglen);
+/*
+ * Completes the request "req", which dorequest() left waiting for the
+ * connect to the upstream proxy to complete.  If "timedout" is set, the
+ * connect did not complete in time.
+ *
+ * Returns as dorequest(), except IO_EAGAIN is never returned.
+ */
+
+static iostatus_t
+dohostconnect(const sockd_mother_t *mother, struct req *req, fd_set *wset,
+              const int timedout, int *weclosedfirst,
+              char *emsg, const size_t emsglen);
+/*
+ * Continues the connects to the addresses of the target hostname of "req",
+ * which dorequest() left in progress, checking the ones set in "wset".
+ * If "timedout" is set, the connects did not complete in time.
+ *
+ * Returns as dorequest().  If IO_EAGAIN is returned, "req" is still
+ * waiting.
+ */
+
+static iostatus_t
+finishconnect(const sockd_mother_t *mother, sockd_request_t *request,
+              sockd_io_t *io, const int rc, const int hostresolved,
+              const iologaddr_t *src, const iologaddr_t *dst,
+              const clientinfo_t *cinfo, int *weclosedfirst,
+              char *emsg, const size_t emsglen);
+/*
+ * Completes the CONNECT request "request", set up in "io", once
+ * sockd_connecthost() or connecthost_process() has returned "rc", with
+ * errno as set by it.  "hostresolved" is set if the target is an address
+ * the rules resolved the hostname in the request to, in which case we may
+ * have connected to another address of that hostname.
+ * "src", "dst" and "cinfo" are as for logging the request.
+ *
+ * Returns as dorequest(), except IO_EAGAIN is never returned.
+ */
+
 static int
 reqhostisok(sockshost_t *host, const int cmd, char *emsg,
             const size_t emsglen);
@@ -168,7 +323,7 @@ flushio(int mother, sockd_io_t *io);
  */
 
 static void
-proctitleupdate(const struct sockaddr_storage *from);
+proctitleupdate(void);
 /*
  * Updates the title of this process.
  */
@@ -186,27 +341,44 @@ getroute(const struct sockaddr_storage *client, request_t *req,
 
 
 static int
-serverchain(const int targetsocket, const int clientsocket,
-            const struct sockaddr_storage *client, const request_t *req,
-            proxychaininfo_t *proxychain, authmethod_t *proxychainauth,
-            char *emsg, const size_t emsglen);
+serverchain(const int targetsocket, const struct sockaddr_storage *client,
+            const request_t *req, socks_t *packet, route_t **route,
+            proxychaininfo_t *proxychain, char *emsg, const size_t emsglen);
 /*
  * Checks if we should create a serverchain to the target on  targetsocket
  * "targetsocket" for the request "req".
- *
- * "clientsocket" is the socket we accepted the client on,.
  * "client" is the clients address.
  *
- * If a serverchain was created, the proxyprotocol used in the chain is set
- * in "proxyprotocol", and further information is provided in "proxychain".
- * If proxychain->proxyprotocol is set to PROXY_DIRECT, no server-chaining
- * should be done.
+ * If a serverchain should be created, the connect to the upstream proxy
+ * is started on "targetsocket", and "packet" and "route" are set to the
+ * request to send the upstream proxy and the route used.  The
+ * serverchain is then completed by serverchain_negotiate() once the
+ * connect has completed.
  *
- * If a serverchain was established, "proxychainauth" is the authentication
- * used with the upsteream proxy.
+ * Returns:
+ *       0: No serverchain.  proxychain->proxyprotocol is set to PROXY_DIRECT.
+ *       1: Connect to upstream proxy is in progress.
+ *      -1: Some error occurred.  "emsg" will contain the details.
+ */
+
+static int
+serverchain_negotiate(const int targetsocket, const int clientsocket,
+                      const request_t *req, socks_t *packet, route_t *route,
+                      proxychaininfo_t *proxychain,
+                      authmethod_t *proxychainauth,
+                      char *emsg, const size_t emsglen);
+/*
+ * Completes the serverchain started by serverchain() on "targetsocket",
+ * using "packet" and "route" as set by serverchain().  Negotiates the
+ * request "req" with the upstream proxy and sends the response to the
+ * client on "clientsocket".
+ *
+ * Further information about the serverchain is provided in "proxychain",
+ * and "proxychainauth" is set to the authentication used with the
+ * upstream proxy.
  *
  * Returns:
- *       0: Call successful.  See proxychain for information about the results.
+ *       0: Serverchain established.
  *      -1: Some error occurred.  "emsg" will contain the details.
  */
 
@@ -242,9 +414,9 @@ void
 run_request()
 {
    const char *function = "run_request()";
-   sockd_request_t req;
    struct sigaction sigact;
-   fd_set *rset;
+   fd_set *rset, *wset;
+   size_t i;
 
    bzero(&sigact, sizeof(sigact));
    sigact.sa_flags     = SA_RESTART | SA_NOCLDSTOP | SA_SIGINFO;
@@ -260,31 +432,35 @@ run_request()
       serr("%s: sigaction(SIGINFO)", function);
 
    rset  = allocate_maxsize_fdset();
-   req.s = -1;
+   wset  = allocate_maxsize_fdset();
+
+   request_init(sockscf.child.maxclients.request);
 
    sockd_print_child_ready_message((size_t)freedescriptors(NULL, NULL));
 
    while (1) {
       /*
-       * Get request from mother, perform it, get next request.
+       * Get requests from mother and perform them, while waiting for
+       * connects to upstream proxies started by earlier requests to
+       * complete.
        */
 #if DIAGNOSTIC
-      const int freec
-      = freedescriptors(sockscf.option.debug ? "start" : NULL, NULL);
+      const int freec = (requsedc == 0 && routeprobec == 0 ?
+           freedescriptors(sockscf.option.debug ? "start" : NULL, NULL) : -1);
 #endif /* DIAGNOSTIC */
-      iostatus_t iostatus;
-      struct sockaddr_storage clientudpaddr;
-      char command, emsg[2048];
-      int fdbits, weclosedfirst;
+      struct timeval timeoutmem, *timeout;
+      struct req *req;
+      int fdbits;
 
       errno = 0; /* reset for each iteration. */
 
-      proctitleupdate(NULL);
+      proctitleupdate();
 
       FD_ZERO(rset);
+      FD_ZERO(wset);
       fdbits = -1;
 
-      if (sockscf.state.mother.s != -1) {
+      if (sockscf.state.mother.s != -1 && requsedc < reqc) {
          FD_SET(sockscf.state.mother.s, rset);
          fdbits = sockscf.state.mother.s;
       }
@@ -293,229 +469,795 @@ run_request()
       FD_SET(sockscf.state.mother.ack, rset);
       fdbits = MAX(fdbits, sockscf.state.mother.ack);
 
+      fdbits = request_fdset(fdbits, rset, wset);
+
+      timeout = request_gettimeout(&timeoutmem);
+
       ++fdbits;
-      switch (selectn(fdbits, rset, NULL, NULL, NULL, NULL, NULL)) {
+      switch (selectn(fdbits, rset, NULL, NULL, wset, NULL, timeout)) {
          case -1:
             SASSERT(ERRNOISTMP(errno));
             continue;
 
          case 0:
-            SERRX(0);
+            SASSERTX(timeout != NULL);
+            break;
       }
 
-      if (FD_ISSET(sockscf.state.mother.ack, rset)) { /* only eof expected. */
-         sockd_readmotherscontrolsocket(function, sockscf.state.mother.ack);
+      if (FD_ISSET(sockscf.state.mother.ack, rset)) { /* only eof expected. */
+         sockd_readmotherscontrolsocket(function, sockscf.state.mother.ack);
+
+#if HAVE_VALGRIND_VALGRIND_H
+         if (RUNNING_ON_VALGRIND) {
+            /* for some reason Valgrind complains the rset pointer is lost. */
+            free(rset);
+            free(wset);
+         }
+#endif /* HAVE_VALGRIND_VALGRIND_H */
+
+         sockdexit(EXIT_FAILURE);
+      }
+
+      /*
+       * First finish what the requests we already have were waiting for.
+       */
+      request_process(rset, wset);
+
+      if (sockscf.state.mother.s != -1
+      &&  FD_ISSET(sockscf.state.mother.s, rset)) {
+         for (i = 0; i < reqc; ++i)
+            if (!reqv[i].allocated)
+               break;
+
+         SASSERTX(i < reqc);
+         req = &reqv[i];
+
+         if (recv_req(sockscf.state.mother.s, &req->sockdrequest) == -1) {
+            slog(LOG_INFO, "%s: recv_req() from mother failed: %s",
+                 function, strerror(errno));
+
+             close(sockscf.state.mother.s);
+             sockscf.state.mother.s = -1;
+
+             continue;
+         }
+
+         init_req(req, &req->sockdrequest);
+         request_start(req);
+      }
+
+#if DIAGNOSTIC
+      if (freec != -1
+      &&  requsedc == 0
+      &&  routeprobec == 0
+      &&  freec != freedescriptors(sockscf.option.debug ?  "end" : NULL, NULL))
+         swarnx("%s: lost %d file descriptor%s in total while handling request",
+                function,
+                freec - freedescriptors(NULL, NULL),
+                freec - freedescriptors(NULL, NULL) == 1 ? "" : "s");
+#endif /* DIAGNOSTIC */
+   }
+}
+
+void
+request_init(maxclients)
+   const size_t maxclients;
+{
+   const char *function = "request_init()";
+
+   reqc = maxclients;
+   if ((reqv      = calloc(reqc, sizeof(*reqv)))      == NULL
+   ||  (reqtimerv = calloc(reqc, sizeof(*reqtimerv))) == NULL)
+      serr("%s: failed to allocate memory for %lu clients",
+           function, (unsigned long)reqc);
+
+   timerwheel_init(&reqtimers, time_monotonic(NULL));
+
+#if SOCKD_RESOLVER_ASYNC
+   if (sockscf.state.hostcacheentries != 0 && resolver_init(reqc, reqc) != 0)
+      swarnx("%s: could not initialize our resolver.  Hostnames will be "
+             "resolved by the system resolver, one at a time",
+             function);
+#endif /* SOCKD_RESOLVER_ASYNC */
+}
+
+int
+request_fdset(fdbits, rset, wset)
+   int fdbits;
+   fd_set *rset;
+   fd_set *wset;
+{
+   size_t i;
+
+   for (i = 0; i < reqc; ++i) {
+      if (!reqv[i].allocated)
+         continue;
+
+      if (reqv[i].state == REQUEST_CHAINCONNECT) {
+         FD_SET(reqv[i].chain.io.dst.s, wset);
+         fdbits = MAX(fdbits, reqv[i].chain.io.dst.s);
+      }
+      else if (reqv[i].state == REQUEST_HOSTCONNECT)
+         fdbits = connecthost_fdset(&reqv[i].hostconnect, fdbits, wset);
+   }
+
+   fdbits = resolver_fdset(fdbits, rset, wset);
+   fdbits = routeprobe_fdset(fdbits, wset);
+
+   return fdbits;
+}
+
+struct timeval *
+request_gettimeout(timeout)
+   struct timeval *timeout;
+{
+   struct timeval hosttimeout;
+   const time_t tnow = time_monotonic(NULL);
+   time_t seconds, resolvetimeout, probetimeout;
+   size_t i;
+   int havetimeout;
+
+   seconds = timerwheel_timeuntil(&reqtimers, tnow);
+
+   if ((resolvetimeout = resolver_timeuntil(tnow)) != (time_t)-1
+   &&  (seconds == (time_t)-1 || resolvetimeout < seconds))
+      seconds = resolvetimeout;
+
+   if ((probetimeout = routeprobe_timeuntil(tnow)) != (time_t)-1
+   &&  (seconds == (time_t)-1 || probetimeout < seconds))
+      seconds = probetimeout;
+
+   if (seconds == (time_t)-1)
+      havetimeout = 0;
+   else {
+      /*
+       * never mind sub-second accuracy, but be sure we don't end up with
+       * {0, 0}.
+       */
+      timeout->tv_sec  = seconds;
+      timeout->tv_usec = 999999;
+      havetimeout      = 1;
+   }
+
+   /*
+    * The attempts to connect to the addresses of a hostname are staggered
+    * by less than a second, so those we do need to be accurate about.
+    */
+   for (i = 0; i < reqc; ++i) {
+      if (!reqv[i].allocated || reqv[i].state != REQUEST_HOSTCONNECT)
+         continue;
+
+      if (connecthost_gettimeout(&reqv[i].hostconnect, &hosttimeout) != NULL
+      &&  (!havetimeout || timercmp(&hosttimeout, timeout, <))) {
+         *timeout    = hosttimeout;
+         havetimeout = 1;
+      }
+   }
+
+   return havetimeout ? timeout : NULL;
+}
+
+void
+request_process(rset, wset)
+   fd_set *rset;
+   fd_set *wset;
+{
+   const char *function = "request_process()";
+   iostatus_t iostatus;
+   sockd_timer_t *timer;
+   struct req *req;
+   ssize_t id;
+   size_t i;
+   char emsg[2048];
+   int weclosedfirst, gai_rc;
+
+   /*
+    * First finish requests that were waiting for an upstream proxy, or
+    * for the addresses of a hostname.
+    */
+   for (i = 0; i < reqc; ++i) {
+      req = &reqv[i];
+
+      if (!req->allocated)
+         continue;
+
+      if (req->state == REQUEST_CHAINCONNECT) {
+         if (!FD_ISSET(req->chain.io.dst.s, wset))
+            continue;
+
+         iostatus = dochainedrequest(&sockscf.state.mother,
+                                     req,
+                                     0,
+                                     &weclosedfirst,
+                                     emsg,
+                                     sizeof(emsg));
+      }
+      else if (req->state == REQUEST_HOSTCONNECT) {
+         iostatus = dohostconnect(&sockscf.state.mother,
+                                  req,
+                                  wset,
+                                  0,
+                                  &weclosedfirst,
+                                  emsg,
+                                  sizeof(emsg));
+
+         if (iostatus == IO_EAGAIN)
+            continue;
+      }
+      else
+         continue;
+
+      if (iostatus != IO_NOERROR)
+         request_failed(&req->sockdrequest, iostatus, weclosedfirst, emsg);
+
+      delete_req(req);
+   }
+
+   while ((timer = timerwheel_getexpired(&reqtimers, time_monotonic(NULL)))
+   != NULL) {
+      req = &reqv[timer - reqtimerv];
+
+      SASSERTX(req->allocated);
+
+      if (req->state == REQUEST_HOSTCONNECT)
+         iostatus = dohostconnect(&sockscf.state.mother,
+                                  req,
+                                  NULL,
+                                  1,
+                                  &weclosedfirst,
+                                  emsg,
+                                  sizeof(emsg));
+      else {
+         SASSERTX(req->state == REQUEST_CHAINCONNECT);
+
+         iostatus = dochainedrequest(&sockscf.state.mother,
+                                     req,
+                                     1,
+                                     &weclosedfirst,
+                                     emsg,
+                                     sizeof(emsg));
+      }
+
+      SASSERTX(iostatus != IO_NOERROR);
+      request_failed(&req->sockdrequest, iostatus, weclosedfirst, emsg);
+
+      delete_req(req);
+   }
+
+   resolver_process(rset, wset);
+   routeprobe_process(wset, time_monotonic(NULL));
+
+   /*
+    * Lastly perform requests whose hostname has now been resolved.
+    * The result is in the hostcache, where dorequest() will find it.
+    */
+   while ((id = resolver_getcompleted(&gai_rc)) != -1) {
+      req = &reqv[id];
+
+      SASSERTX(req->allocated);
+      SASSERTX(req->state == REQUEST_RESOLVE);
+
+      slog(LOG_DEBUG, "%s: lookup for request #%ld completed: %s",
+           function,
+           (long)id,
+           gai_rc == 0 ? "no error" : gai_strerror(gai_rc));
+
+      req->state = REQUEST_PROCESSING;
+      performreq(req);
+   }
+}
+
+#if SOCKD_ALLINONE
+
+void
+add_request(request)
+   const sockd_request_t *request;
+{
+   struct req *req;
+   size_t i;
+
+   for (i = 0; i < reqc; ++i)
+      if (!reqv[i].allocated)
+         break;
+
+   SASSERTX(i < reqc);
+   req = &reqv[i];
+
+   req->sockdrequest          = *request;
+   req->sockdrequest.req.auth = &req->sockdrequest.sauth; /* pointer fixup */
+
+   init_req(req, &req->sockdrequest);
+   request_start(req);
+}
+
+size_t
+request_allocated(void)
+{
+
+   return requsedc;
+}
+
+#endif /* SOCKD_ALLINONE */
+
+static void
+request_start(req)
+   struct req *req;
+{
+
+   if (resolvefirst(&req->sockdrequest)) {
+      /*
+       * Let our resolver look up the hostname while we go on with
+       * other requests, rather than block in getaddrinfo(3) when
+       * performing the request.
+       */
+      req->state = REQUEST_RESOLVE;
+      resolver_start((size_t)(req - reqv), req->sockdrequest.req.host.addr.domain);
+   }
+   else
+      performreq(req);
+}
+
+static int
+routeprobe_isdue(route, tnow)
+   const route_t *route;
+   const time_t tnow;
+{
+
+   if (sockscf.routeoptions.maxfail == 0
+   ||  route->state.failed < sockscf.routeoptions.maxfail)
+      return 0;
+
+   if (sockscf.routeoptions.badexpire != 0
+   &&  socks_difftime(tnow, route->state.badtime)
+       > sockscf.routeoptions.badexpire)
+      return 0; /* will be used again anyway. */
+
+   if (route->gw.state.proxyprotocol.direct
+   ||  route->gw.state.proxyprotocol.upnp)
+      return 0; /* nothing to connect to. */
+
+   return 1;
+}
+
+static time_t
+routeprobe_timeout(void)
+{
+
+   if (sockscf.timeout.connect != 0)
+      return sockscf.timeout.connect;
+
+   return SOCKD_ROUTEPROBE_INTERVAL;
+}
+
+static int
+routeprobe_fdset(fdbits, wset)
+   int fdbits;
+   fd_set *wset;
+{
+   size_t i;
+
+   for (i = 0; i < ELEMENTS(routeprobev); ++i) {
+      if (!routeprobev[i].allocated)
+         continue;
+
+      FD_SET(routeprobev[i].s, wset);
+      fdbits = MAX(fdbits, routeprobev[i].s);
+   }
+
+   return fdbits;
+}
+
+static time_t
+routeprobe_timeuntil(tnow)
+   const time_t tnow;
+{
+   const route_t *route;
+   time_t timeout, next;
+   size_t i;
+
+   timeout = (time_t)-1;
+
+   for (i = 0; i < ELEMENTS(routeprobev); ++i) {
+      if (!routeprobev[i].allocated)
+         continue;
+
+      next = MAX(0, routeprobev[i].starttime + routeprobe_timeout() - tnow);
+
+      if (timeout == (time_t)-1 || next < timeout)
+         timeout = next;
+   }
+
+   if (routeprobec >= ELEMENTS(routeprobev))
+      return timeout;
+
+   for (route = sockscf.route; route != NULL; route = route->next) {
+      if (!routeprobe_isdue(route, tnow))
+         continue;
+
+      next = MAX(0,   route->state.probetime
+                    + SOCKD_ROUTEPROBE_INTERVAL
+                    - tnow);
+
+      if (timeout == (time_t)-1 || next < timeout)
+         timeout = next;
+   }
+
+   return timeout;
+}
+
+static void
+routeprobe_process(wset, tnow)
+   fd_set *wset;
+   const time_t tnow;
+{
+   const char *function = "routeprobe_process()";
+   struct sockaddr_storage addr;
+   route_t *route;
+   socklen_t len;
+   size_t i;
+   char emsg[256];
+   int rc, gaierr, probing;
+
+   for (i = 0; i < ELEMENTS(routeprobev); ++i) {
+      if (!routeprobev[i].allocated)
+         continue;
+
+      if (FD_ISSET(routeprobev[i].s, wset)) {
+         len = sizeof(rc);
+         if (getsockopt(routeprobev[i].s, SOL_SOCKET, SO_ERROR, &rc, &len)
+         != 0)
+            rc = errno;
+      }
+      else if (socks_difftime(tnow, routeprobev[i].starttime)
+      >= routeprobe_timeout())
+         rc = ETIMEDOUT;
+      else
+         continue;
+
+      /*
+       * The config may have been reloaded since we started, so look the
+       * route up again.
+       */
+      for (route = sockscf.route; route != NULL; route = route->next)
+         if (route->number == routeprobev[i].number)
+            break;
+
+      if (route != NULL && routeprobe_isdue(route, tnow)) {
+         if (rc == 0) {
+            slog(LOG_INFO,
+                 "%s: upstream proxy %s of route #%d can be connected to "
+                 "again.  No longer considering the route bad",
+                 function,
+                 sockshost2string(&route->gw.addr, NULL, 0),
+                 route->number);
+
+            socks_clearblacklist(route);
+         }
+         else {
+            slog(LOG_DEBUG,
+                 "%s: upstream proxy %s of route #%d still not reachable: %s",
+                 function,
+                 sockshost2string(&route->gw.addr, NULL, 0),
+                 route->number,
+                 strerror(rc));
+
+            time_monotonic(&route->state.badtime);
+         }
+      }
+
+      close(routeprobev[i].s);
+      routeprobev[i].allocated = 0;
+      --routeprobec;
+   }
+
+   /*
+    * Start probing the bad routes that are due.
+    */
+   for (route = sockscf.route; route != NULL; route = route->next) {
+      if (routeprobec >= ELEMENTS(routeprobev))
+         break;
+
+      if (!routeprobe_isdue(route, tnow)
+      ||  socks_difftime(tnow, route->state.probetime)
+          < SOCKD_ROUTEPROBE_INTERVAL)
+         continue;
+
+      for (i = 0, probing = 0; i < ELEMENTS(routeprobev); ++i)
+         if (routeprobev[i].allocated
+         &&  routeprobev[i].number == route->number)
+            probing = 1;
+
+      if (probing)
+         continue;
+
+      route->state.probetime = tnow;
+
+      sockshost2sockaddr2(&route->gw.addr, &addr, &gaierr, emsg, sizeof(emsg));
+      if (gaierr != 0 || !IPADDRISBOUND(&addr)) {
+         slog(LOG_DEBUG, "%s: can not probe route #%d: %s",
+              function, route->number, emsg);
+
+         continue;
+      }
+
+      for (i = 0; i < ELEMENTS(routeprobev); ++i)
+         if (!routeprobev[i].allocated)
+            break;
+
+      SASSERTX(i < ELEMENTS(routeprobev));
+
+      if ((routeprobev[i].s = socket(addr.ss_family, SOCK_STREAM, 0)) == -1) {
+         swarn("%s: could not create socket to probe route #%d",
+               function, route->number);
+
+         break;
+      }
+
+      if (setnonblocking(routeprobev[i].s, function) == -1) {
+         close(routeprobev[i].s);
+         break;
+      }
+
+      slog(LOG_DEBUG, "%s: probing route #%d by connecting to %s",
+           function, route->number, sockaddr2string(&addr, NULL, 0));
+
+      if (connect(routeprobev[i].s, TOSA(&addr), salen(addr.ss_family)) == -1
+      &&  errno != EINPROGRESS) {
+         slog(LOG_DEBUG, "%s: connect to %s failed: %s",
+              function, sockaddr2string(&addr, NULL, 0), strerror(errno));
+
+         close(routeprobev[i].s);
+         time_monotonic(&route->state.badtime);
+
+         continue;
+      }
+
+      /*
+       * If the connect completed at once, the socket is writable and the
+       * probe is finished next time we are called.
+       */
+      routeprobev[i].allocated = 1;
+      routeprobev[i].number    = route->number;
+      routeprobev[i].starttime = tnow;
+      ++routeprobec;
+   }
+}
+
+static int
+resolvefirst(request)
+   const sockd_request_t *request;
+{
+   int dorefresh;
+
+   /*
+    * If we have routes, the request may be forwarded to an upstream proxy
+    * that will resolve the hostname itself.
+    */
+   if (request->req.command    != SOCKS_CONNECT
+   ||  request->req.host.atype != SOCKS_ADDR_DOMAIN
+   ||  sockscf.route           != NULL
+   ||  !resolver_canresolve(request->req.host.addr.domain))
+      return 0;
+
+   if (!hostcache_isresolved(request->req.host.addr.domain, &dorefresh))
+      return 1;
 
-#if HAVE_VALGRIND_VALGRIND_H
-         if (RUNNING_ON_VALGRIND) {
-            /* for some reason Valgrind complains the rset pointer is lost. */
-            free(rset);
-         }
-#endif /* HAVE_VALGRIND_VALGRIND_H */
+   if (dorefresh)
+      resolver_refresh(request->req.host.addr.domain);
 
-         sockdexit(EXIT_FAILURE);
-      }
+   return 0;
+}
 
-      if (FD_ISSET(sockscf.state.mother.s, rset)) {
-         if (recv_req(sockscf.state.mother.s, &req) == -1) {
-            slog(LOG_INFO, "%s: recv_req() from mother failed: %s",
-                 function, strerror(errno));
+static void
+performreq(req)
+   struct req *req;
+{
+   iostatus_t iostatus;
+   struct sockaddr_storage clientudpaddr;
+   char emsg[2048];
+   int weclosedfirst;
+
+   iostatus = dorequest(&sockscf.state.mother,
+                        req,
+                        &clientudpaddr,
+                        &weclosedfirst,
+                        emsg,
+                        sizeof(emsg));
 
-             close(sockscf.state.mother.s);
-             sockscf.state.mother.s = -1;
+   if (iostatus == IO_EAGAIN)
+      return; /* dorequest() has parked it; will be completed later. */
 
-             continue;
-          }
-      }
+   if (iostatus != IO_NOERROR)
+      request_failed(&req->sockdrequest, iostatus, weclosedfirst, emsg);
 
-      iostatus = dorequest(&sockscf.state.mother,
-                           &req,
-                           &clientudpaddr,
-                           &weclosedfirst,
-                           emsg,
-                           sizeof(emsg));
+   delete_req(req);
+}
 
-      if (iostatus != IO_NOERROR) {
-         /*
-          * log the client-rule and hostid-rule close also if appropriate,
-          * as this will not be logged on the normal session-close in the i/o
-          * process because the session was not successfully established.
-          */
-         operation_t op;
-         clientinfo_t cinfo;
-         iologaddr_t src;
-         rule_t *rule;
-         size_t rused;
-         char reason[sizeof(emsg) + 1024];
+static void
+request_failed(request, iostatus, weclosedfirst, emsg)
+   sockd_request_t *request;
+   const iostatus_t iostatus;
+   const int weclosedfirst;
+   const char *emsg;
+{
+   const char *function = "request_failed()";
+   operation_t op;
+   clientinfo_t cinfo;
+   iologaddr_t src;
+   rule_t *rule;
+   size_t rused;
+   char command, reason[2048 + 1024];
 
-         slog(LOG_DEBUG,
-              "%s: dorequest() failed.  srule_isset = %d, weclosedfirst = %d, "
-              "iostatus = %d, error: %s",
-              function, req.srule_isset, weclosedfirst, iostatus, emsg);
+   slog(LOG_DEBUG,
+        "%s: dorequest() failed.  srule_isset = %d, weclosedfirst = %d, "
+        "iostatus = %d, error: %s",
+        function, request->srule_isset, weclosedfirst, iostatus, emsg);
 
-         log_ruleinfo_shmid(CRULE_OR_HRULE(&req), function, NULL);
+   log_ruleinfo_shmid(CRULE_OR_HRULE(request), function, NULL);
 
-         if (req.srule_isset)
-            rule = &req.srule;
-         else
-            rule = CRULE_OR_HRULE(&req);
+   if (request->srule_isset)
+      rule = &request->srule;
+   else
+      rule = CRULE_OR_HRULE(request);
 
-         log_ruleinfo_shmid(rule, function, NULL);
+   log_ruleinfo_shmid(rule, function, NULL);
 
-         if (req.s == -1) {
-            SASSERTX(BAREFOOTD);
-            SASSERTX(req.state.protocol == SOCKS_UDP);
+   if (request->s == -1) {
+      SASSERTX(BAREFOOTD);
+      SASSERTX(request->state.protocol == SOCKS_UDP);
 
-            /*
-             * nothing can have been used as we need to wait
-             * for the udp clients.
-             */
-            SHMEM_CLEAR(CRULE_OR_HRULE(&req), SHMEM_ALL, 1);
+      /*
+       * nothing can have been used as we need to wait
+       * for the udp clients.
+       */
+      SHMEM_CLEAR(CRULE_OR_HRULE(request), SHMEM_ALL, 1);
 
-            SASSERTX(!req.srule_isset);
-         }
+      SASSERTX(!request->srule_isset);
+   }
 
-         /*
-          * Clean up shmem usage, whether the request failed before or
-          * after we progressed to the socks-rule level.  In the former case,
-          * no shmid-fields will be set in req->srule.
-          */
+   /*
+    * Clean up shmem usage, whether the request failed before or
+    * after we progressed to the socks-rule level.  In the former case,
+    * no shmid-fields will be set in request->srule.
+    */
 
-         cinfo.from = req.from;
-         HOSTIDCOPY(&req.state, &cinfo);
+   cinfo.from = request->from;
+   HOSTIDCOPY(&request->state, &cinfo);
 
-         switch (iostatus) {
-            case IO_BLOCK:
-               rused = 0;
-               op    = OPERATION_BLOCK;
-               break;
+   switch (iostatus) {
+      case IO_BLOCK:
+         rused = 0;
+         op    = OPERATION_BLOCK;
+         break;
 
-            case IO_CLOSE:
-               op    = OPERATION_DISCONNECT;
-               rused = 0;
-               break;
+      case IO_CLOSE:
+         op    = OPERATION_DISCONNECT;
+         rused = 0;
+         break;
 
-            case IO_IOERROR:
-            case IO_ERROR:
-               rused = snprintf(reason, sizeof(reason),
-                                "request was not performed due to error");
-               op    = OPERATION_ERROR;
-               break;
+      case IO_IOERROR:
+      case IO_ERROR:
+         rused = snprintf(reason, sizeof(reason),
+                          "request was not performed due to error");
+         op    = OPERATION_ERROR;
+         break;
 
-            default:
-               SWARNX(iostatus);
+      default:
+         SWARNX(iostatus);
 
-               rused = 0;
-               op    = OPERATION_ERROR;
-         }
+         rused = 0;
+         op    = OPERATION_ERROR;
+   }
 
-         if (*emsg != NUL)
-            snprintf(&reason[rused], sizeof(reason) - rused,
-                     "%s%s",
-                     rused > 0 ? ": " : "",
-                     emsg);
+   /*
+    * log the client-rule and hostid-rule close also if appropriate,
+    * as this will not be logged on the normal session-close in the i/o
+    * process because the session was not successfully established.
+    */
+   if (*emsg != NUL)
+      snprintf(&reason[rused], sizeof(reason) - rused,
+               "%s%s",
+               rused > 0 ? ": " : "",
+               emsg);
 
-         if (rule->mstats_shmid != 0
-         && (rule->alarmsconfigured & ALARM_DISCONNECT))
-            alarm_add_disconnect(weclosedfirst,
-                                 rule,
-                                 ALARM_INTERNAL,
-                                 &cinfo,
-                                 strerror(errno),
-                                 sockscf.shmemfd);
+   if (rule->mstats_shmid != 0
+   && (rule->alarmsconfigured & ALARM_DISCONNECT))
+      alarm_add_disconnect(weclosedfirst,
+                           rule,
+                           ALARM_INTERNAL,
+                           &cinfo,
+                           strerror(errno),
+                           sockscf.shmemfd);
 
-         SHMEM_UNUSE(rule, &cinfo, sockscf.shmemfd, SHMEM_ALL);
+   SHMEM_UNUSE(rule, &cinfo, sockscf.shmemfd, SHMEM_ALL);
 
-         switch (req.state.protocol) {
-            case SOCKS_TCP:
-               command = SOCKD_FREESLOT_TCP;
-               break;
+   switch (request->state.protocol) {
+      case SOCKS_TCP:
+         command = SOCKD_FREESLOT_TCP;
+         break;
 
-            case SOCKS_UDP:
-               command = SOCKD_FREESLOT_UDP;
-               break;
+      case SOCKS_UDP:
+         command = SOCKD_FREESLOT_UDP;
+         break;
 
-            default:
-               SERRX(req.state.protocol);
-         }
+      default:
+         SERRX(request->state.protocol);
+   }
 
-         if (socks_sendton(sockscf.state.mother.ack,
-                           &command,
-                           sizeof(command),
-                           sizeof(command),
-                           0,
-                           NULL,
-                           0,
-                           NULL,
-                           NULL) != sizeof(command))
-            slog(sockd_motherexists() ? LOG_WARNING : LOG_DEBUG,
-                 "%s: sending ack to mother failed: %s",
-                 function, strerror(errno));
+   if (socks_sendton(sockscf.state.mother.ack,
+                     &command,
+                     sizeof(command),
+                     sizeof(command),
+                     0,
+                     NULL,
+                     0,
+                     NULL,
+                     NULL) != sizeof(command))
+      slog(sockd_motherexists() ? LOG_WARNING : LOG_DEBUG,
+           "%s: sending ack to mother failed: %s",
+           function, strerror(errno));
 
 
-         /*
-          * dorequest() logs the failed socks-level session close with
-          * appropriate details, but we need to log the client-level close.
-          */
-         init_iologaddr(&src,
-                        object_sockaddr,
-                        &req.to,
-                        object_sockaddr,
-                        &req.from,
-                        &req.cauth,
-                        GET_HOSTIDV(&req.state),
-                        GET_HOSTIDC(&req.state));
+   /*
+    * dorequest() logs the failed socks-level session close with
+    * appropriate details, but we need to log the client-level close.
+    */
+   init_iologaddr(&src,
+                  object_sockaddr,
+                  &request->to,
+                  object_sockaddr,
+                  &request->from,
+                  &request->cauth,
+                  GET_HOSTIDV(&request->state),
+                  GET_HOSTIDC(&request->state));
 
 #if HAVE_SOCKS_HOSTID
-         if (req.hrule_isset) {
-            req.state.command = SOCKS_HOSTID;
-            iolog(&req.hrule,
-                  &req.state,
-                  op,
-                  &src,
-                  NULL,
-                  NULL,
-                  NULL,
-                  reason,
-                  strlen(reason));
-         }
+   if (request->hrule_isset) {
+      request->state.command = SOCKS_HOSTID;
+      iolog(&request->hrule,
+            &request->state,
+            op,
+            &src,
+            NULL,
+            NULL,
+            NULL,
+            reason,
+            strlen(reason));
+   }
 #endif /* HAVE_SOCKS_HOSTID */
 
-         req.state.command  = SOCKS_ACCEPT;
-         req.state.protocol = SOCKS_TCP;
+   request->state.command  = SOCKS_ACCEPT;
+   request->state.protocol = SOCKS_TCP;
 
 #if !HAVE_SOCKS_RULES /* only logged if debug is enabled. */
-         if (sockscf.option.debug)
+   if (sockscf.option.debug)
 #endif /* HAVE_SOCKS_RULES */
-         iolog(&req.crule,
-               &req.state,
-               op,
-               &src,
-               NULL,
-               NULL,
-               NULL,
-               reason,
-               strlen(reason));
-      }
-
-      delete_req(&reqv[0]);
-
-#if DIAGNOSTIC
-      if (freec != freedescriptors(sockscf.option.debug ?  "end" : NULL, NULL))
-         swarnx("%s: lost %d file descriptor%s in total while handling request",
-                function,
-                freec - freedescriptors(NULL, NULL),
-                freec - freedescriptors(NULL, NULL) == 1 ? "" : "s");
-#endif /* DIAGNOSTIC */
-   }
+   iolog(&request->crule,
+         &request->state,
+         op,
+         &src,
+         NULL,
+         NULL,
+         NULL,
+         reason,
+         strlen(reason));
 }
 
 void
 request_preconfigload(void)
 {
    const char *function = "request_preconfigload()";
+   size_t i;
 
    slog(LOG_DEBUG, "%s", function);
+
+   /*
+    * routes are about to be freed.  Requests waiting for a connect to an
+    * upstream proxy will just not be able to blacklist the route if the
+    * connect fails.
+    */
+   for (i = 0; i < reqc; ++i)
+      reqv[i].chain.route = NULL;
 }
 
 void
@@ -852,21 +1594,85 @@ recv_req(s, req)
    return 0;
 }
 
+int
+request_fastpath(request)
+   const sockd_request_t *request;
+{
+   const char *function = "request_fastpath()";
+   iostatus_t iostatus;
+   struct sockaddr_storage clientudpaddr;
+   struct req req;
+   char emsg[2048];
+   int weclosedfirst;
+
+   SASSERTX(request->req.command == SOCKS_CONNECT);
+   SASSERTX(sockscf.route == NULL);
+
+   slog(LOG_DEBUG, "%s: performing request from client %s ourselves",
+        function, sockaddr2string(&request->from, NULL, 0));
+
+   /*
+    * Same as init_req(), but the object is not one of ours and has no
+    * timer.  The client's buffer is still the one the negotiate process
+    * allocated for it.
+    */
+   bzero(&req, sizeof(req));
+   req.sockdrequest          = *request;
+   req.sockdrequest.req.auth = &req.sockdrequest.sauth; /* pointer fixup */
+
+   req.state                 = REQUEST_PROCESSING;
+   req.starttime             = time_monotonic(NULL);
+
+   req.crule                 = req.sockdrequest.crule;
+#if HAVE_SOCKS_HOSTID
+   req.hrule                 = req.sockdrequest.hrule;
+   req.hrule_isset           = req.sockdrequest.hrule_isset;
+#endif /* HAVE_SOCKS_HOSTID */
+
+   req.client                = req.sockdrequest.from;
+   req.request_isvalid       = 1;
+   req.request               = req.sockdrequest.req;
+   req.s                     = req.sockdrequest.s;
+   req.allocated             = 1;
+
+   iostatus = dorequest(&sockscf.state.mother,
+                        &req,
+                        &clientudpaddr,
+                        &weclosedfirst,
+                        emsg,
+                        sizeof(emsg));
+
+   /*
+    * No upstream proxy or hostname to wait for, so can not have been
+    * parked.
+    */
+   SASSERTX(iostatus != IO_EAGAIN);
+
+   if (iostatus != IO_NOERROR) {
+      request_failed(&req.sockdrequest, iostatus, weclosedfirst, emsg);
+      return -1;
+   }
+
+   return 0;
+}
+
 static iostatus_t
-dorequest(mother, request, clientudpaddr, weclosedfirst, emsg, emsglen)
+dorequest(mother, req, clientudpaddr, weclosedfirst, emsg, emsglen)
    const sockd_mother_t *mother;
-   sockd_request_t *request;
+   struct req *req;
    struct sockaddr_storage *clientudpaddr;
    int *weclosedfirst;
    char *emsg;
    const size_t emsglen;
 {
    const char *function = "dorequest()";
+   sockd_request_t *request = &req->sockdrequest;
    iostatus_t iostatus;
    sockd_io_t io;
    response_t response;
    iologaddr_t *src, srcmem, *dst, dstmem;
    clientinfo_t cinfo;
+   sockshost_t dstname, dstresolved;
    size_t msglen;
    char strhost[MAXSOCKSHOSTSTRING], buf[(MAXHOSTNAMELEN * 4) + 256];
    int rc;
@@ -900,8 +1706,7 @@ dorequest(mother, request, clientudpaddr, weclosedfirst, emsg, emsglen)
         method2string(request->req.auth->method),
         socks_packet2string(&request->req, 1));
 
-   proctitleupdate(&request->from);
-   init_req(&reqv[0], request);
+   proctitleupdate();
 
    bzero(&response, sizeof(response));
    response.host   = request->req.host;
@@ -909,6 +1714,12 @@ dorequest(mother, request, clientudpaddr, weclosedfirst, emsg, emsglen)
 
    bzero(&io, sizeof(io));
 
+   /*
+    * Set if the rules resolve a hostname in the request to the address
+    * to connect to.
+    */
+   dstname.atype = SOCKS_ADDR_NOTSET;
+
    io.control.auth.method = AUTHMETHOD_NOTSET;
    io.control.s           = -1;
    io.src                 = io.control;
@@ -1121,7 +1932,7 @@ dorequest(mother, request, clientudpaddr, weclosedfirst, emsg, emsglen)
    /*
     * packet looks ok to, fill in remaining bits and check rules.
     */
-   reqv[0].request_isvalid = 1;
+   req->request_isvalid = 1;
 
    switch (request->req.command) {
 #if SOCKS_SERVER
@@ -1426,6 +2237,11 @@ dorequest(mother, request, clientudpaddr, weclosedfirst, emsg, emsglen)
                     sockshost2string(&io.dst.host, strhost, sizeof(strhost)),
                     sockshost2string(&dsthostmatched, NULL, 0));
 
+               if (io.dst.host.atype == SOCKS_ADDR_DOMAIN) {
+                  dstname     = io.dst.host;
+                  dstresolved = dsthostmatched;
+               }
+
                request->req.host = io.dst.host = dsthostmatched;
             }
          }
@@ -1761,95 +2577,53 @@ dorequest(mother, request, clientudpaddr, weclosedfirst, emsg, emsglen)
    }
 
    errno = 0;
-   if (serverchain(io.dst.s,
-                   CONTROLIO(&io)->s,
-                   &io.src.raddr,
-                   &request->req,
-                   &io.state.proxychain,
-                   io.state.protocol == SOCKS_TCP ? &io.dst.auth : NULL,
-                   buf,
-                   sizeof(buf)) == 0) {
-      if (io.state.proxychain.proxyprotocol != PROXY_DIRECT) {
-         socklen_t sinlen;
-
-         io.src.state.isconnected = 1;
-         io.dst.state.isconnected = 1;
-
-         sinlen = sizeof(io.dst.raddr);
-         if (getpeername(io.dst.s, TOSA(&io.dst.raddr), &sinlen) != 0) {
-            slog(LOG_DEBUG,
-                 "%s: strange ... serverchain() succeeded, but now "
-                 "getpeername(2) failed: %s",
-                 function, strerror(errno));
-
-            if (io.srule.log.error) {
-               msglen = snprintf(emsg, emsglen,
-                                 "getpeername(io.dst.s) failed: %s",
-                                 strerror(errno));
-
-               iolog(&io.srule,
-                     &io.state,
-                     OPERATION_ERROR,
-                     src,
-                     dst,
-                     NULL,
-                     NULL,
-                     emsg,
-                     msglen);
-            }
-
-            *weclosedfirst = 0;
-
-            close_iodescriptors(&io);
-
-            return IO_ERROR;
-         }
-
-         setconfsockoptions(io.dst.s,
-                            request->s,
-                            io.state.protocol,
-                            0,
-                            io.srule.socketoptionc,
-                            io.srule.socketoptionv,
-                            SOCKETOPT_POST,
-                            SOCKETOPT_POST);
+   switch (serverchain(io.dst.s,
+                       &io.src.raddr,
+                       &request->req,
+                       &req->chain.packet,
+                       &req->chain.route,
+                       &io.state.proxychain,
+                       buf,
+                       sizeof(buf))) {
+      case 0: /* go direct. */
+         break;
 
-         if (SHMEMRULE(&io)->mstats_shmid != 0
-         && (SHMEMRULE(&io)->alarmsconfigured & ALARM_DISCONNECT))
-            alarm_add_connect(SHMEMRULE(&io),
-                              ALARM_EXTERNAL,
-                              &cinfo,
-                              sockscf.shmemfd);
+      case 1:
+         /*
+          * Wait for the connect to the upstream proxy to complete
+          * together with whatever other requests we are handling.
+          */
+         req->chain.io       = io;
+         req->chain.response = response;
+         req->state          = REQUEST_CHAINCONNECT;
 
-         io.reqinfo.command = (io.state.protocol == SOCKS_TCP ?
-                                 SOCKD_FREESLOT_TCP : SOCKD_FREESLOT_UDP);
+         if (sockscf.timeout.connect != 0)
+            timer_arm(&reqtimers,
+                      &reqtimerv[req - reqv],
+                      time_monotonic(NULL) + sockscf.timeout.connect);
 
-         flushio(mother->s, &io);
+         return IO_EAGAIN;
 
-         return IO_NOERROR;
-      }
-      /* else: go direct.  */
-   }
-   else { /* some error occurred. */
-      msglen = snprintf(emsg, emsglen, "serverchain failed: %s", buf);
+      default: /* some error occurred. */
+         msglen = snprintf(emsg, emsglen, "serverchain failed: %s", buf);
 
-      iolog(IORULE(&io),
-            &io.state,
-            OPERATION_ERROR,
-            src,
-            dst,
-            NULL,
-            NULL,
-            emsg,
-            msglen);
+         iolog(IORULE(&io),
+               &io.state,
+               OPERATION_ERROR,
+               src,
+               dst,
+               NULL,
+               NULL,
+               emsg,
+               msglen);
 
-      send_failure(request->s,
-                   &response,
-                   errno2reply(errno,
-                   response.version));
+         send_failure(request->s,
+                      &response,
+                      errno2reply(errno,
+                      response.version));
 
-      close_iodescriptors(&io);
-      return IO_ERROR;
+         close_iodescriptors(&io);
+         return IO_ERROR;
    }
 
    SASSERTX(io.state.proxychain.proxyprotocol == PROXY_DIRECT);
@@ -2730,100 +3504,60 @@ dorequest(mother, request, clientudpaddr, weclosedfirst, emsg, emsglen)
       }
 #endif /* SOCKS_SERVER */
 
-      case SOCKS_CONNECT: {
-         rc = socks_connecthost(io.dst.s,
-                                EXTERNALIF,
-                                &io.dst.host,
-                                &io.dst.laddr,
-                                &io.dst.raddr,
-                                (long)0, /* wait for completion in i/o child. */
-                                emsg,
-                                emsglen);
-
-         if (rc == 0) {
-            io.dst.state.isconnected = 1;
-
-#if HAVE_NEGOTIATE_PHASE
-            if (SOCKS_SERVER || io.reqflags.httpconnect) {
-               errno = 0;
-               if (send_connectresponse(request->s, errno, &io) != 0) {
-                  *weclosedfirst = 0;
-                  iostatus       = IO_IOERROR;
-
-                  snprintf(emsg, emsglen,
-                           "could not send connect response to client: %s",
-                           strerror(errno));
-
-                  close_iodescriptors(&io);
-                  break;
-               }
-            }
-#endif /* HAVE_NEGOTIATE_PHASE */
-         }
-         else {
-            if (errno == EINPROGRESS)
-               /*
-                * we don't wait for the result but instead push the io object
-                * on to i/o process.  This allows the connect(2)-time to
-                * overlap with the sending of the io-object to the io-process.
-                */
-               rc = 0;
-            else {
-               rc       = -1;
-               iostatus = IO_IOERROR;
-
-#if HAVE_NEGOTIATE_PHASE
-
-               SASSERTX(errno != 0);
-               if (send_connectresponse(request->s, errno, &io) != 0)
-                  slog(LOG_DEBUG,
-                       "%s: could not send connect response to client: %s",
-                       function, strerror(errno));
-
-#else /* !HAVE_NEGOTIATE_PHASE */
-
-               if (ERRNOISRST(errno))
-                  sockd_rstonclose(io.dst.s); /* no other way to tell client. */
-
-#endif /* !HAVE_NEGOTIATE_PHASE */
-            }
-         }
-
-         if (rc != 0) {
-            iolog(&io.srule,
-                  &io.state,
-                  OPERATION_ERROR,
-                  src,
-                  dst,
-                  NULL,
-                  NULL,
-                  emsg,
-                  strlen(emsg));
-
-            close_iodescriptors(&io);
-         }
-         else {
-            if (SHMEMRULE(&io)->mstats_shmid != 0
-            && (SHMEMRULE(&io)->alarmsconfigured & ALARM_DISCONNECT))
-               /*
-                * Connect(2) in progress or already completed, so add it now.
-                */
-               alarm_add_connect(SHMEMRULE(&io),
-                                 ALARM_EXTERNAL,
-                                 &cinfo,
-                                 sockscf.shmemfd);
+      case SOCKS_CONNECT:
+         /*
+          * Waits for completion in the i/o child, unless the hostname
+          * has several addresses we need to try in parallel.  The other
+          * addresses of a hostname the rules resolved can only be used
+          * if the target was not redirected.
+          */
+         rc = sockd_connecthost(io.dst.s,
+                                &io.dst.host,
+                                dstname.atype == SOCKS_ADDR_DOMAIN
+                                && sockshostareeq(&io.dst.host, &dstresolved) ?
+                                    dstname.addr.domain : NULL,
+#if HAVE_SOCKS_RULES
+                                &io.srule.dst,
+#else /* !HAVE_SOCKS_RULES */
+                                NULL,
+#endif /* !HAVE_SOCKS_RULES */
+                                &io.src.laddr,
+                                &io.src.raddr,
+                                &io.dst.laddr,
+                                &io.dst.raddr,
+                                &req->hostconnect,
+                                emsg,
+                                emsglen);
 
-            io.src.state.isconnected = 1;
+         if (rc == 1) {
+            /*
+             * Wait for the connects to complete together with whatever
+             * other requests we are handling.
+             */
+            req->chain.io       = io;
+            req->chain.response = response;
+            req->state          = REQUEST_HOSTCONNECT;
 
-            SASSERTX(io.state.proxychain.proxyprotocol == PROXY_DIRECT);
-            io.reqinfo.command = (io.state.protocol == SOCKS_TCP ?
-                                       SOCKD_FREESLOT_TCP : SOCKD_FREESLOT_UDP);
+            if (sockscf.timeout.connect != 0)
+               timer_arm(&reqtimers,
+                         &reqtimerv[req - reqv],
+                         time_monotonic(NULL) + sockscf.timeout.connect);
 
-            flushio(mother->s, &io);
+            return IO_EAGAIN;
          }
 
+         iostatus = finishconnect(mother,
+                                  request,
+                                  &io,
+                                  rc,
+                                  dstname.atype == SOCKS_ADDR_DOMAIN,
+                                  src,
+                                  dst,
+                                  &cinfo,
+                                  weclosedfirst,
+                                  emsg,
+                                  emsglen);
          break;
-      }
 
 #if HAVE_UDP_SUPPORT
       case SOCKS_UDPASSOCIATE: {
@@ -3146,12 +3880,347 @@ dorequest(mother, request, clientudpaddr, weclosedfirst, emsg, emsglen)
    }
 
    rc = errno;
-   SASSERTX(close(request->s) == -1);
+   /*
+    * With child.allinone, the descriptor may belong to our i/o stage now.
+    */
+   SASSERTX(sockscf.state.allinone || close(request->s) == -1);
    errno = rc;
 
    return iostatus;
 }
 
+static iostatus_t
+dochainedrequest(mother, req, timedout, weclosedfirst, emsg, emsglen)
+   const sockd_mother_t *mother;
+   struct req *req;
+   const int timedout;
+   int *weclosedfirst;
+   char *emsg;
+   const size_t emsglen;
+{
+   const char *function = "dochainedrequest()";
+   sockd_request_t *request = &req->sockdrequest;
+   sockd_io_t *io           = &req->chain.io;
+   iologaddr_t src, dst;
+   clientinfo_t cinfo;
+   socklen_t sinlen;
+   size_t msglen;
+   char buf[(MAXHOSTNAMELEN * 4) + 256];
+   int rc;
+
+   SASSERTX(req->allocated);
+   SASSERTX(req->state == REQUEST_CHAINCONNECT);
+
+   slog(LOG_DEBUG, "%s: connect to upstream proxy on fd %d for client %s %s",
+        function,
+        io->dst.s,
+        sockaddr2string(&request->from, NULL, 0),
+        timedout ? "timed out" : "completed");
+
+   timer_disarm(&reqtimers, &reqtimerv[req - reqv]);
+   req->state = REQUEST_PROCESSING;
+
+   *emsg          = NUL;
+   *weclosedfirst = 1;
+
+   init_iologaddr(&src,
+                  object_sockaddr,
+                  &request->to,
+                  object_sockaddr,
+                  &request->from,
+                  request->req.auth,
+                  GET_HOSTIDV(&request->state),
+                  GET_HOSTIDC(&request->state));
+
+   initlogaddrs(io, NULL, &dst, NULL);
+
+   if (timedout) {
+      snprintf(buf, sizeof(buf),
+               "connect to upstream proxyserver %s timed out after %lds",
+               sockshost2string(&req->chain.packet.gw.addr, NULL, 0),
+               (long)sockscf.timeout.connect);
+
+      socks_blacklist(req->chain.route, buf);
+
+      errno = ETIMEDOUT;
+      rc    = -1;
+   }
+   else
+      rc = serverchain_negotiate(io->dst.s,
+                                 request->s,
+                                 &request->req,
+                                 &req->chain.packet,
+                                 req->chain.route,
+                                 &io->state.proxychain,
+                                 &io->dst.auth,
+                                 buf,
+                                 sizeof(buf));
+
+   if (rc != 0) {
+      msglen = snprintf(emsg, emsglen, "serverchain failed: %s", buf);
+
+      iolog(IORULE(io),
+            &io->state,
+            OPERATION_ERROR,
+            &src,
+            &dst,
+            NULL,
+            NULL,
+            emsg,
+            msglen);
+
+      send_failure(request->s,
+                   &req->chain.response,
+                   errno2reply(errno,
+                   req->chain.response.version));
+
+      close_iodescriptors(io);
+      return IO_ERROR;
+   }
+
+   io->src.state.isconnected = 1;
+   io->dst.state.isconnected = 1;
+
+   sinlen = sizeof(io->dst.raddr);
+   if (getpeername(io->dst.s, TOSA(&io->dst.raddr), &sinlen) != 0) {
+      slog(LOG_DEBUG,
+           "%s: strange ... serverchain() succeeded, but now "
+           "getpeername(2) failed: %s",
+           function, strerror(errno));
+
+      if (io->srule.log.error) {
+         msglen = snprintf(emsg, emsglen,
+                           "getpeername(io.dst.s) failed: %s",
+                           strerror(errno));
+
+         iolog(&io->srule,
+               &io->state,
+               OPERATION_ERROR,
+               &src,
+               &dst,
+               NULL,
+               NULL,
+               emsg,
+               msglen);
+      }
+
+      *weclosedfirst = 0;
+
+      close_iodescriptors(io);
+
+      return IO_ERROR;
+   }
+
+   setconfsockoptions(io->dst.s,
+                      request->s,
+                      io->state.protocol,
+                      0,
+                      io->srule.socketoptionc,
+                      io->srule.socketoptionv,
+                      SOCKETOPT_POST,
+                      SOCKETOPT_POST);
+
+   if (SHMEMRULE(io)->mstats_shmid != 0
+   && (SHMEMRULE(io)->alarmsconfigured & ALARM_DISCONNECT)) {
+      cinfo.from = request->from;
+      HOSTIDCOPY(&request->state, &cinfo);
+
+      alarm_add_connect(SHMEMRULE(io),
+                        ALARM_EXTERNAL,
+                        &cinfo,
+                        sockscf.shmemfd);
+   }
+
+   io->reqinfo.command = (io->state.protocol == SOCKS_TCP ?
+                           SOCKD_FREESLOT_TCP : SOCKD_FREESLOT_UDP);
+
+   flushio(mother->s, io);
+
+   return IO_NOERROR;
+}
+
+static iostatus_t
+finishconnect(mother, request, io, rc, hostresolved, src, dst, cinfo,
+              weclosedfirst, emsg, emsglen)
+   const sockd_mother_t *mother;
+   sockd_request_t *request;
+   sockd_io_t *io;
+   const int rc;
+   const int hostresolved;
+   const iologaddr_t *src;
+   const iologaddr_t *dst;
+   const clientinfo_t *cinfo;
+   int *weclosedfirst;
+   char *emsg;
+   const size_t emsglen;
+{
+   const char *function = "finishconnect()";
+
+   if (hostresolved && (rc == 0 || errno == EINPROGRESS)) {
+      const int errno_s = errno;
+
+      /* may be another address of the hostname than the rules said. */
+      sockaddr2sockshost(&io->dst.raddr, &io->dst.host);
+      errno = errno_s;
+   }
+
+   if (rc == 0) {
+      io->dst.state.isconnected = 1;
+
+#if HAVE_NEGOTIATE_PHASE
+      if (SOCKS_SERVER || io->reqflags.httpconnect) {
+         errno = 0;
+         if (send_connectresponse(request->s, errno, io) != 0) {
+            *weclosedfirst = 0;
+
+            snprintf(emsg, emsglen,
+                     "could not send connect response to client: %s",
+                     strerror(errno));
+
+            close_iodescriptors(io);
+            return IO_IOERROR;
+         }
+      }
+#endif /* HAVE_NEGOTIATE_PHASE */
+   }
+   else if (errno == EINPROGRESS)
+      /*
+       * we don't wait for the result but instead push the io object
+       * on to i/o process.  This allows the connect(2)-time to
+       * overlap with the sending of the io-object to the io-process.
+       */
+      ;
+   else {
+#if HAVE_NEGOTIATE_PHASE
+
+      SASSERTX(errno != 0);
+      if (send_connectresponse(request->s, errno, io) != 0)
+         slog(LOG_DEBUG,
+              "%s: could not send connect response to client: %s",
+              function, strerror(errno));
+
+#else /* !HAVE_NEGOTIATE_PHASE */
+
+      if (ERRNOISRST(errno))
+         sockd_rstonclose(io->dst.s); /* no other way to tell client. */
+
+#endif /* !HAVE_NEGOTIATE_PHASE */
+
+      iolog(&io->srule,
+            &io->state,
+            OPERATION_ERROR,
+            src,
+            dst,
+            NULL,
+            NULL,
+            emsg,
+            strlen(emsg));
+
+      close_iodescriptors(io);
+      return IO_IOERROR;
+   }
+
+   if (SHMEMRULE(io)->mstats_shmid != 0
+   && (SHMEMRULE(io)->alarmsconfigured & ALARM_DISCONNECT))
+      /*
+       * Connect(2) in progress or already completed, so add it now.
+       */
+      alarm_add_connect(SHMEMRULE(io),
+                        ALARM_EXTERNAL,
+                        cinfo,
+                        sockscf.shmemfd);
+
+   io->src.state.isconnected = 1;
+
+   SASSERTX(io->state.proxychain.proxyprotocol == PROXY_DIRECT);
+   io->reqinfo.command = (io->state.protocol == SOCKS_TCP ?
+                              SOCKD_FREESLOT_TCP : SOCKD_FREESLOT_UDP);
+
+   flushio(mother->s, io);
+
+   return IO_NOERROR;
+}
+
+static iostatus_t
+dohostconnect(mother, req, wset, timedout, weclosedfirst, emsg, emsglen)
+   const sockd_mother_t *mother;
+   struct req *req;
+   fd_set *wset;
+   const int timedout;
+   int *weclosedfirst;
+   char *emsg;
+   const size_t emsglen;
+{
+   const char *function = "dohostconnect()";
+   sockd_request_t *request = &req->sockdrequest;
+   sockd_io_t *io           = &req->chain.io;
+   iologaddr_t src, dst;
+   clientinfo_t cinfo;
+   int rc, errno_s;
+
+   SASSERTX(req->allocated);
+   SASSERTX(req->state == REQUEST_HOSTCONNECT);
+
+   *emsg          = NUL;
+   *weclosedfirst = 1;
+
+   if (timedout) {
+      connecthost_cancel(&req->hostconnect, emsg, emsglen);
+      rc = -1;
+   }
+   else if ((rc = connecthost_process(&req->hostconnect,
+                                      wset,
+                                      &io->dst.laddr,
+                                      &io->dst.raddr,
+                                      emsg,
+                                      emsglen)) == 1)
+      return IO_EAGAIN; /* none completed yet. */
+
+   errno_s = errno;
+
+   slog(LOG_DEBUG, "%s: connect to %s on fd %d for client %s %s",
+        function,
+        sockshost2string(&io->dst.host, NULL, 0),
+        io->dst.s,
+        sockaddr2string(&request->from, NULL, 0),
+        timedout ? "timed out" : "completed");
+
+   timer_disarm(&reqtimers, &reqtimerv[req - reqv]);
+   req->state = REQUEST_PROCESSING;
+
+   init_iologaddr(&src,
+                  object_sockaddr,
+                  &request->to,
+                  object_sockaddr,
+                  &request->from,
+                  request->req.auth,
+                  GET_HOSTIDV(&request->state),
+                  GET_HOSTIDC(&request->state));
+
+   initlogaddrs(io, NULL, &dst, NULL);
+
+   cinfo.from = request->from;
+   HOSTIDCOPY(&request->state, &cinfo);
+
+   /*
+    * Only a hostname, or an address the rules resolved a hostname to,
+    * has several addresses to connect to, so the latter is the case if
+    * the target is an address.
+    */
+   errno = errno_s;
+   return finishconnect(mother,
+                        request,
+                        io,
+                        rc,
+                        io->dst.host.atype != SOCKS_ADDR_DOMAIN,
+                        &src,
+                        &dst,
+                        &cinfo,
+                        weclosedfirst,
+                        emsg,
+                        emsglen);
+}
+
 static int
 reqhostisok(host, cmd, emsg, emsglen)
    sockshost_t *host;
@@ -3412,7 +4481,7 @@ flushio(mother, io)
    sockd_io_t *io;
 {
    const char *function = "flushio()";
-   int dolog;
+   int dolog, failed;
 
    SASSERTX(io->allocated == 0);
 
@@ -3588,13 +4657,31 @@ flushio(mother, io)
       io->state.tcpinfo = NULL;
    }
 
-   if (send_io(mother, io) != 0) {
+#if SOCKD_ALLINONE
+   if (sockscf.state.allinone) {
+      /*
+       * The i/o stage is part of this process, so hand it the io directly.
+       */
+      if (add_io(io) == 0)
+         return; /* the descriptors belong to the i/o stage now. */
+
+      failed = 1;
+   }
+   else
+#endif /* SOCKD_ALLINONE */
+      failed = (send_io(mother, io) != 0);
+
+   if (failed) {
 #if HAVE_NEGOTIATE_PHASE
       response_t response;
 #endif /* HAVE_NEGOTIATE_PHASE */
       iologaddr_t src, dst, proxy;
 
-      if (sockd_motherexists())
+      if (sockscf.state.allinone)
+        swarn("%s: no free i/o slot for session with local client %s",
+              function,
+             sockaddr2string(&CONTROLIO(io)->raddr, NULL, 0));
+      else if (sockd_motherexists())
         swarn("%s: sending io object with local client %s to mother failed",
               function,
              sockaddr2string(&CONTROLIO(io)->raddr, NULL, 0));
@@ -3633,18 +4720,43 @@ flushio(mother, io)
             io->state.proxychain.proxyprotocol == PROXY_DIRECT ? NULL : &proxy,
             NULL,
             0);
+
+      if (sockscf.state.allinone && io->reqinfo.command != SOCKD_NOP) {
+         /*
+          * Nobody else will know the session is gone, so we need to tell
+          * mother the slot the client used is free again.
+          */
+         const unsigned char cmd = io->reqinfo.command;
+
+         if (socks_sendton(sockscf.state.mother.ack,
+                           &cmd,
+                           sizeof(cmd),
+                           sizeof(cmd),
+                           0,
+                           NULL,
+                           0,
+                           NULL,
+                           NULL) != sizeof(cmd))
+            slog(sockd_motherexists() ? LOG_WARNING : LOG_DEBUG,
+                 "%s: sending ack to mother failed: %s",
+                 function, strerror(errno));
+      }
    }
 
    close_iodescriptors(io);
 }
 
 static void
-proctitleupdate(from)
-   const struct sockaddr_storage *from;
+proctitleupdate(void)
 {
-   setproctitle("%s: %s",
+
+   if (sockscf.state.allinone)
+      return; /* the i/o stage updates the title for all of us. */
+
+   setproctitle("%s: %lu/%lu",
                 childtype2string(sockscf.state.type),
-                from == NULL ?  "0/1" : "1/1");
+                (unsigned long)requsedc,
+                (unsigned long)reqc);
 }
 
 static route_t *
@@ -3791,23 +4903,19 @@ getroute(client, req, emsg, emsglen)
 }
 
 static int
-serverchain(targetsocket, clientsocket, client, req,
-            proxychain, proxychainauth, emsg, emsglen)
+serverchain(targetsocket, client, req, packet, route, proxychain,
+            emsg, emsglen)
    const int targetsocket;
-   const int clientsocket;
    const struct sockaddr_storage *client;
    const request_t *req;
+   socks_t *packet;
+   route_t **route;
    proxychaininfo_t *proxychain;
-   authmethod_t *proxychainauth;
    char *emsg;
-   size_t emsglen;
+   const size_t emsglen;
 {
    const char *function = "serverchain()";
-   response_t response;
-   route_t *route;
-   socks_t packet;
    char lemsg[512];
-   int rc, flags;
 
    slog(LOG_DEBUG, "%s: client %s, auth %s, request %s",
         function,
@@ -3815,17 +4923,17 @@ serverchain(targetsocket, clientsocket, client, req,
         method2string(req->auth->method),
         socks_packet2string(req, 1));
 
-   bzero(&packet, sizeof(packet));
-   packet.state.auth = *req->auth;
-   packet.req        = *req;
+   bzero(packet, sizeof(*packet));
+   packet->state.auth = *req->auth;
+   packet->req        = *req;
 
-   packet.req.auth = &packet.state.auth;
-   packet.res.auth = &packet.state.auth;
+   packet->req.auth = &packet->state.auth;
+   packet->res.auth = &packet->state.auth;
 
-   if ((route = getroute(client, &packet.req, emsg, emsglen)) == NULL)
+   if ((*route = getroute(client, &packet->req, emsg, emsglen)) == NULL)
       return -1;
 
-   if (route->gw.state.proxyprotocol.direct) {
+   if ((*route)->gw.state.proxyprotocol.direct) {
       slog(LOG_DEBUG, "%s: using direct system calls for fd %d",
            function, targetsocket);
 
@@ -3833,24 +4941,61 @@ serverchain(targetsocket, clientsocket, client, req,
       return 0;
    }
 
-   if (socks_routesetup(targetsocket, targetsocket, route, emsg, emsglen) != 0){
+   if (socks_routesetup(targetsocket, targetsocket, *route, emsg, emsglen)
+   != 0) {
       swarnx("%s: socks_routesetup() failed: %s", function, emsg);
       return -1;
    }
 
-   if ((route = socks_connectroute(targetsocket,
-                                   &packet,
-                                   sockaddr2sockshost(client, NULL),
-                                   &packet.req.host,
-                                   lemsg,
-                                   sizeof(lemsg))) == NULL) {
+   if ((*route = socks_connectroute(targetsocket,
+                                    packet,
+                                    sockaddr2sockshost(client, NULL),
+                                    &packet->req.host,
+                                    lemsg,
+                                    sizeof(lemsg))) == NULL) {
       snprintf(emsg, emsglen,
                "could not connect to upstream proxyserver: %s", lemsg);
 
       return -1;
    }
 
-   proxychain->proxyprotocol = packet.req.version;
+   proxychain->proxyprotocol = packet->req.version;
+
+   return 1;
+}
+
+static int
+serverchain_negotiate(targetsocket, clientsocket, req, packet, route,
+                      proxychain, proxychainauth, emsg, emsglen)
+   const int targetsocket;
+   const int clientsocket;
+   const request_t *req;
+   socks_t *packet;
+   route_t *route;
+   proxychaininfo_t *proxychain;
+   authmethod_t *proxychainauth;
+   char *emsg;
+   const size_t emsglen;
+{
+   const char *function = "serverchain_negotiate()";
+   response_t response;
+   socklen_t len;
+   int rc, flags;
+
+   len = sizeof(rc);
+   if (getsockopt(targetsocket, SOL_SOCKET, SO_ERROR, &rc, &len) != 0)
+      rc = errno;
+
+   if (rc != 0) {
+      snprintf(emsg, emsglen,
+               "could not connect to upstream proxyserver %s: %s",
+               sockshost2string(&packet->gw.addr, NULL, 0), strerror(rc));
+
+      socks_blacklist(route, emsg);
+
+      errno = rc;
+      return -1;
+   }
 
    /*
     * we're not interested the extra hassle of negotiating over a
@@ -3870,7 +5015,7 @@ serverchain(targetsocket, clientsocket, client, req,
 
    rc = socks_negotiate(targetsocket,
                         targetsocket,
-                        &packet,
+                        packet,
                         route,
                         emsg,
                         emsglen);
@@ -3889,20 +5034,20 @@ serverchain(targetsocket, clientsocket, client, req,
    }
 
    /* Use request-version as response-version differs in v4 (is 0 there). */
-   proxychain->proxyprotocol = (int)packet.req.version;
+   proxychain->proxyprotocol = (int)packet->req.version;
 
-   switch (packet.req.command) {
+   switch (packet->req.command) {
       case SOCKS_CONNECT:
-         proxychain->extaddr = packet.res.host;
+         proxychain->extaddr = packet->res.host;
          break;
 
       default:
-         SERRX(packet.req.command);
+         SERRX(packet->req.command);
    }
 
-   *proxychainauth = *packet.req.auth;
+   *proxychainauth = *packet->req.auth;
 
-   convertresponse(&packet.res, &response, req->version);
+   convertresponse(&packet->res, &response, req->version);
    response.auth = req->auth; /* must use the auth negotiated with client. */
 
    if (send_response(clientsocket, &response) != 0)
@@ -4061,6 +5206,9 @@ init_req(req, request)
    const sockd_request_t *request;
 {
 
+   SASSERTX(!req->allocated);
+
+   req->state            = REQUEST_PROCESSING;
    req->starttime        = time_monotonic(NULL);
 
    req->crule            = request->crule;
@@ -4079,6 +5227,7 @@ init_req(req, request)
 #endif /* HAVE_NEGOTIATE_PHASE */
 
    req->allocated        = 1;
+   ++requsedc;
 }
 
 static void
@@ -4086,11 +5235,17 @@ delete_req(req)
    struct req *req;
 {
 
+   SASSERTX(req->allocated);
+   SASSERTX(requsedc > 0);
+
 #if HAVE_NEGOTIATE_PHASE
    socks_freebuffer(req->s);
 #endif /* HAVE_NEGOTIATE_PHASE */
 
+   timer_disarm(&reqtimers, &reqtimerv[req - reqv]);
+
    req->allocated = req->request_isvalid = 0;
+   --requsedc;
 }
 
 /* ARGSUSED */
@@ -4116,6 +5271,8 @@ siginfo(sig, si, sc)
    slog(LOG_INFO, "request-child up %lu day%s, %lu:%.2lu:%.2lu",
                   days, days == 1 ? "" : "s", hours, minutes, seconds);
 
+   log_rulecachestats();
+
    for (i = 0; i < reqc; ++i) {
       char *tcpinfo, reqinfo[64];
 
@@ -4130,7 +5287,22 @@ siginfo(sig, si, sc)
       else
          tcpinfo = NULL;
 
-      if (reqv[i].request_isvalid)
+      if (reqv[i].state == REQUEST_CHAINCONNECT)
+         snprintf(reqinfo, sizeof(reqinfo),
+                  "%s %s-request waiting for upstream proxy",
+                  protocol2string(reqv[i].request.protocol),
+                  command2string(reqv[i].request.command));
+      else if (reqv[i].state == REQUEST_HOSTCONNECT)
+         snprintf(reqinfo, sizeof(reqinfo),
+                  "%s %s-request waiting for connect to target",
+                  protocol2string(reqv[i].request.protocol),
+                  command2string(reqv[i].request.command));
+      else if (reqv[i].state == REQUEST_RESOLVE)
+         snprintf(reqinfo, sizeof(reqinfo),
+                  "%s %s-request waiting for hostname lookup",
+                  protocol2string(reqv[i].request.protocol),
+                  command2string(reqv[i].request.command));
+      else if (reqv[i].request_isvalid)
          snprintf(reqinfo, sizeof(reqinfo),
                   "%s %s-request",
                   protocol2string(reqv[i].request.protocol),
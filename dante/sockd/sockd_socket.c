@@ -77,6 +77,25 @@ getoptions(const sa_family_t family, const int type, const int isclientside,
  * Returns the number of options set (always <= MAXSOCKETOPTIONS).
  */
 
+static int
+connectattempt_start(const int s, const int uses, connectattempt_t *attempt,
+                     const struct sockaddr_storage *client_l,
+                     const struct sockaddr_storage *client_r,
+                     char *emsg, const size_t emsglen);
+/*
+ * Starts a non-blocking connect(2) to attempt->raddr, on the already bound
+ * socket "s" if "uses" is set, or on a new socket with the same options
+ * as "s", bound to an external address we can use for attempt->raddr.
+ * "client_l" and "client_r" are the local and remote addresses of the
+ * client we are connecting for.
+ *
+ * Returns:
+ *      0 if the connect completed at once.
+ *      1 if the connect is in progress.
+ *     -1 if the connect failed.  attempt->s is then closed, unless it
+ *        is "s", and set to -1.
+ */
+
 int
 sockd_unconnect(s, oldpeer)
    const int s;
@@ -221,6 +240,396 @@ sockd_rstonclose(s)
            function, s, strerror(errno));
 }
 
+int
+sockd_connecthost(s, host, hostname, dst, client_l, client_r, laddr, raddr,
+                  state, emsg, emsglen)
+   const int s;
+   const sockshost_t *host;
+   const char *hostname;
+   const ruleaddr_t *dst;
+   const struct sockaddr_storage *client_l;
+   const struct sockaddr_storage *client_r;
+   struct sockaddr_storage *laddr;
+   struct sockaddr_storage *raddr;
+   connecthost_t *state;
+   char *emsg;
+   const size_t emsglen;
+{
+   const char *function = "sockd_connecthost()";
+   struct sockaddr_storage *familyv[2][1 + MAX_ADDRINFO_NEXT], hostaddr;
+   struct addrinfo hints, *res, *next;
+   dnsinfo_t resmem;
+   size_t familyc[2], i, j;
+   sa_family_t firstfamily;
+   const char *name;
+
+   if (sockscf.happyeyeballs.delay == 0)
+      name = NULL;
+   else if (host->atype == SOCKS_ADDR_DOMAIN)
+      name = host->addr.domain;
+   else
+      name = hostname;
+
+   if (name == NULL)
+      return socks_connecthost(s,
+                               EXTERNALIF,
+                               host,
+                               laddr,
+                               raddr,
+                               (long)0,
+                               emsg,
+                               emsglen);
+
+   bzero(&hints, sizeof(hints));
+   hints.ai_socktype = SOCK_STREAM;
+
+   if (cgetaddrinfo(name, NULL, &hints, &res, &resmem) != 0
+   ||  res->ai_next == NULL)
+      /*
+       * Nothing to do in parallel.  Let socks_connecthost() handle it
+       * as usual, including reporting the error if any.
+       */
+      return socks_connecthost(s,
+                               EXTERNALIF,
+                               host,
+                               laddr,
+                               raddr,
+                               (long)0,
+                               emsg,
+                               emsglen);
+
+   /*
+    * Order the addresses so that the address families alternate, starting
+    * with the family of the first address; RFC 8305, section 4.  If we
+    * were given the address to use, that is the first one, and the others
+    * are only used if "dst" permits them.  Addresses of a family we have no
+    * external address for are skipped.
+    */
+   familyc[0] = familyc[1] = 0;
+
+   if (host->atype == SOCKS_ADDR_DOMAIN)
+      firstfamily = res->ai_family;
+   else {
+      sockshost2sockaddr(host, &hostaddr);
+      firstfamily = hostaddr.ss_family;
+
+      familyv[0][familyc[0]++] = &hostaddr;
+   }
+
+   for (next = res; next != NULL; next = next->ai_next) {
+      const size_t family = (next->ai_family == firstfamily ? 0 : 1);
+
+      if (!external_has_safamily(next->ai_family))
+         continue;
+
+      if (host->atype != SOCKS_ADDR_DOMAIN) {
+         sockshost_t addrhost;
+
+         if (sockaddrareeq(TOSS(next->ai_addr), &hostaddr, ADDRINFO_PORT))
+            continue;
+
+         sockaddr2sockshost(TOSS(next->ai_addr), &addrhost);
+         addrhost.port = host->port;
+
+         if (dst != NULL
+         &&  !addrmatch(dst, &addrhost, NULL, SOCKS_TCP, 0))
+            continue;
+      }
+
+      familyv[family][familyc[family]++] = TOSS(next->ai_addr);
+   }
+
+   bzero(state, sizeof(*state));
+
+   for (i = j = 0; i < familyc[0] || j < familyc[1];) {
+      if (i < familyc[0]) {
+         sockaddrcpy(&state->attemptv[state->attemptc].raddr,
+                     familyv[0][i++],
+                     sizeof(state->attemptv[state->attemptc].raddr));
+         ++state->attemptc;
+      }
+
+      if (j < familyc[1]) {
+         sockaddrcpy(&state->attemptv[state->attemptc].raddr,
+                     familyv[1][j++],
+                     sizeof(state->attemptv[state->attemptc].raddr));
+         ++state->attemptc;
+      }
+   }
+
+   if (state->attemptc <= 1)
+      return socks_connecthost(s,
+                               EXTERNALIF,
+                               host,
+                               laddr,
+                               raddr,
+                               (long)0,
+                               emsg,
+                               emsglen);
+
+   for (i = 0; i < state->attemptc; ++i) {
+      state->attemptv[i].s = -1;
+      SET_SOCKADDRPORT(&state->attemptv[i].raddr, host->port);
+   }
+
+   slog(LOG_NEGOTIATE,
+        "%s: connect to %s, which has %lu addresses, staggered by %ldms",
+        function,
+        sockshost2string(host, NULL, 0),
+        (unsigned long)state->attemptc,
+        sockscf.happyeyeballs.delay);
+
+   if ((state->flags = fcntl(s, F_GETFL, 0)) == -1) {
+      snprintf(emsg, emsglen, "fcntl(F_GETFL) failed: %s", strerror(errno));
+      return -1;
+   }
+
+   state->s            = s;
+   state->laddr        = *laddr;
+   state->client_l     = *client_l;
+   state->client_r     = *client_r;
+   state->host         = *host;
+   state->failed_errno = ETIMEDOUT;
+
+   gettimeofday_monotonic(&state->nextstart);
+
+   return connecthost_process(state, NULL, laddr, raddr, emsg, emsglen);
+}
+
+int
+connecthost_fdset(state, fdbits, wset)
+   const connecthost_t *state;
+   int fdbits;
+   fd_set *wset;
+{
+   size_t i;
+
+   for (i = 0; i < state->started; ++i) {
+      if (state->attemptv[i].s == -1)
+         continue;
+
+      FD_SET(state->attemptv[i].s, wset);
+      fdbits = MAX(fdbits, state->attemptv[i].s);
+   }
+
+   return fdbits;
+}
+
+struct timeval *
+connecthost_gettimeout(state, timeout)
+   const connecthost_t *state;
+   struct timeval *timeout;
+{
+   struct timeval tnow;
+
+   if (state->started == state->attemptc)
+      return NULL;
+
+   gettimeofday_monotonic(&tnow);
+
+   if (timercmp(&tnow, &state->nextstart, <))
+      timersub(&state->nextstart, &tnow, timeout);
+   else
+      timerclear(timeout);
+
+   return timeout;
+}
+
+int
+connecthost_process(state, wset, laddr, raddr, emsg, emsglen)
+   connecthost_t *state;
+   fd_set *wset;
+   struct sockaddr_storage *laddr;
+   struct sockaddr_storage *raddr;
+   char *emsg;
+   const size_t emsglen;
+{
+   const char *function = "connecthost_process()";
+   struct timeval tnow, tdelay;
+   socklen_t len;
+   ssize_t winner;
+   size_t i;
+   char hoststr[MAXSOCKSHOSTSTRING];
+   int rc, inprogress;
+
+   gettimeofday_monotonic(&tnow);
+
+   tdelay.tv_sec  = sockscf.happyeyeballs.delay / 1000;
+   tdelay.tv_usec = (sockscf.happyeyeballs.delay % 1000) * 1000;
+
+   winner     = -1;
+   inprogress = 0;
+
+   /*
+    * First see how the attempts we were waiting for went.
+    */
+   for (i = 0; i < state->started && wset != NULL; ++i) {
+      connectattempt_t *attempt = &state->attemptv[i];
+      char addrstr[MAXSOCKADDRSTRING];
+      int errno_s;
+
+      if (attempt->s == -1 || !FD_ISSET(attempt->s, wset))
+         continue;
+
+      len = sizeof(errno_s);
+      if (getsockopt(attempt->s, SOL_SOCKET, SO_ERROR, &errno_s, &len) == -1)
+         errno_s = errno;
+
+      if (errno_s == 0) {
+         winner = (ssize_t)i;
+         break;
+      }
+
+      sockaddr2string(&attempt->raddr, addrstr, sizeof(addrstr));
+
+      slog(LOG_NEGOTIATE, "%s: connect to %s on fd %d failed (%s)",
+           function, addrstr, attempt->s, strerror(errno_s));
+
+      log_connectfailed(EXTERNALIF, addrstr);
+
+      snprintf(emsg, emsglen, "connect(2) to %s failed: %s",
+               addrstr, strerror(errno_s));
+
+      if (attempt->s != state->s)
+         close(attempt->s);
+
+      attempt->s          = -1;
+      state->failed_errno = errno_s;
+      --state->pending;
+
+      /*
+       * Don't wait for the stagger delay to start the next one when
+       * this one failed; RFC 8305, section 5.
+       */
+      state->nextstart = tnow;
+   }
+
+   /*
+    * Then start the next attempt, if it is time for it.
+    */
+   while (winner == -1
+   &&     state->started < state->attemptc
+   &&     (state->pending == 0 || !timercmp(&tnow, &state->nextstart, <))) {
+      connectattempt_t *attempt = &state->attemptv[state->started++];
+      const int uses = (!state->useds
+                     && attempt->raddr.ss_family == state->laddr.ss_family);
+
+      if (uses) {
+         attempt->laddr = state->laddr;
+         state->useds   = 1;
+      }
+
+      rc = connectattempt_start(state->s,
+                                uses,
+                                attempt,
+                                &state->client_l,
+                                &state->client_r,
+                                emsg,
+                                emsglen);
+
+      if (rc == 0)
+         winner = attempt - state->attemptv;
+      else if (rc == -1)
+         state->failed_errno = errno;
+      else {
+         ++state->pending;
+         timeradd(&tnow, &tdelay, &state->nextstart);
+      }
+   }
+
+   if (winner == -1) {
+      if (state->pending == 0) {
+         SASSERTX(state->started == state->attemptc);
+
+         errno = state->failed_errno;
+         return -1; /* all failed. */
+      }
+
+      if (state->pending > 1 || state->started < state->attemptc)
+         return 1; /* wait some more. */
+
+      /*
+       * Only one attempt left, so no reason to wait for it here.
+       * Let the i/o child wait for it, as it does for a single address.
+       */
+      for (i = 0; i < state->attemptc; ++i)
+         if (state->attemptv[i].s != -1)
+            break;
+
+      SASSERTX(i < state->attemptc);
+
+      winner     = (ssize_t)i;
+      inprogress = 1;
+   }
+
+   /*
+    * Cancel the attempts that lost.
+    */
+   for (i = 0; i < state->started; ++i)
+      if ((ssize_t)i != winner
+      &&  state->attemptv[i].s != -1
+      &&  state->attemptv[i].s != state->s)
+         close(state->attemptv[i].s);
+
+   if (state->attemptv[winner].s != state->s) {
+      if (dup2(state->attemptv[winner].s, state->s) == -1) {
+         snprintf(emsg, emsglen, "dup2() failed: %s", strerror(errno));
+         close(state->attemptv[winner].s);
+
+         return -1;
+      }
+
+      close(state->attemptv[winner].s);
+   }
+
+   if (fcntl(state->s, F_SETFL, state->flags) == -1)
+      swarn("%s: failed reverting fd %d back to the original flags",
+            function, state->s);
+
+   *laddr = state->attemptv[winner].laddr;
+   *raddr = state->attemptv[winner].raddr;
+
+   slog(LOG_NEGOTIATE, "%s: connect to %s via %s on fd %d %s",
+        function,
+        sockshost2string(&state->host, hoststr, sizeof(hoststr)),
+        sockaddr2string(raddr, NULL, 0),
+        state->s,
+        inprogress ? "is in progress" : "ok");
+
+   if (inprogress) {
+      snprintf(emsg, emsglen, "connect(2) to %s is in progress",
+               sockaddr2string(raddr, NULL, 0));
+
+      errno = EINPROGRESS;
+      return -1;
+   }
+
+   *emsg = NUL;
+   errno = 0;
+
+   return 0;
+}
+
+void
+connecthost_cancel(state, emsg, emsglen)
+   connecthost_t *state;
+   char *emsg;
+   const size_t emsglen;
+{
+   size_t i;
+
+   for (i = 0; i < state->started; ++i)
+      if (state->attemptv[i].s != -1 && state->attemptv[i].s != state->s)
+         close(state->attemptv[i].s);
+
+   snprintf(emsg, emsglen,
+            "connect(2) to %s timed out on all %lu addresses",
+            sockshost2string(&state->host, NULL, 0),
+            (unsigned long)state->attemptc);
+
+   errno = ETIMEDOUT;
+}
+
 int
 bindinternal(protocol)
    const int protocol;
@@ -259,105 +668,140 @@ bindinternal(protocol)
          continue;
       }
 
-      if ((l->s = socket(l->addr.ss_family, SOCK_STREAM, 0)) == -1) {
-         swarn("%s: could not create %s socket(2)",
-               function, safamily2string(l->addr.ss_family));
-
+      if (bindlistenaddress(l,
+                            sockscf.state.reuseport,
+                            !sockscf.state.reuseport) != 0)
          return -1;
-      }
+   }
+
+   return 0;
+}
 
-      setsockoptions(l->s, l->addr.ss_family, SOCK_STREAM, 1);
+int
+bindlistenaddress(l, reuseport, dolisten)
+   listenaddress_t *l;
+   const int reuseport;
+   const int dolisten;
+{
+   const char *function = "bindlistenaddress()";
+   int val;
 
-      /*
-       * This breaks the principle that we should only set socket options
-       * on sockets used for data (rather than sockets used for the control
-       * messages), but some options can only be set at pre-connect time,
-       * so if we do not set them here, we will never be able to set them.
-       * Possibly we should limit the settings here to the options that
-       * can _only_ be set at pre-connect time, so that at least other
-       * options are not set unnecessarily.
-       */
+   if ((l->s = socket(l->addr.ss_family, SOCK_STREAM, 0)) == -1) {
+      swarn("%s: could not create %s socket(2)",
+            function, safamily2string(l->addr.ss_family));
+
+      return -1;
+   }
 
-       /* XXX missing code to unset any previously set options. */
-      setconfsockoptions(l->s,
-                         l->s,
-                         SOCKS_TCP,
-                         1,
-                         0,
-                         NULL,
-                         0,
-                         SOCKETOPT_PRE | SOCKETOPT_ANYTIME);
+   setsockoptions(l->s, l->addr.ss_family, SOCK_STREAM, 1);
 
+   /*
+    * This breaks the principle that we should only set socket options
+    * on sockets used for data (rather than sockets used for the control
+    * messages), but some options can only be set at pre-connect time,
+    * so if we do not set them here, we will never be able to set them.
+    * Possibly we should limit the settings here to the options that
+    * can _only_ be set at pre-connect time, so that at least other
+    * options are not set unnecessarily.
+    */
+
+    /* XXX missing code to unset any previously set options. */
+   setconfsockoptions(l->s,
+                      l->s,
+                      SOCKS_TCP,
+                      1,
+                      0,
+                      NULL,
+                      0,
+                      SOCKETOPT_PRE | SOCKETOPT_ANYTIME);
+
+   val = 1;
+   if (setsockopt(l->s, SOL_SOCKET, SO_REUSEADDR, &val, sizeof(val)) != 0)
+      swarn("%s: setsockopt(SO_REUSEADDR)", function);
+
+#ifdef SO_REUSEPORT
+   if (reuseport) {
       val = 1;
-      if (setsockopt(l->s, SOL_SOCKET, SO_REUSEADDR, &val, sizeof(val)) != 0)
-         swarn("%s: setsockopt(SO_REUSEADDR)", function);
+      if (setsockopt(l->s, SOL_SOCKET, SO_REUSEPORT, &val, sizeof(val)) != 0)
+         swarn("%s: setsockopt(SO_REUSEPORT)", function);
+   }
+#endif /* SO_REUSEPORT */
 
 #if !HAVE_PRIVILEGES
 {
-      /*
-       * Specialcase this so that if we are started as root we do bind
-       * the listen port requested, regardless of whether user.privileged is
-       * set to root or not.  Allows a user who does not want Dante to
-       * run as root, ever, but does want Dante to bind a privileged port
-       * when initially starting, get what he wants.
-       */
-      socklen_t len;
-      uid_t old_euid;
-      int changed_euid = 0;
+   /*
+    * Specialcase this so that if we are started as root we do bind
+    * the listen port requested, regardless of whether user.privileged is
+    * set to root or not.  Allows a user who does not want Dante to
+    * run as root, ever, but does want Dante to bind a privileged port
+    * when initially starting, get what he wants.
+    */
+   socklen_t len;
+   uid_t old_euid;
+   int changed_euid = 0;
 
-      len = salen(l->addr.ss_family);
+   len = salen(l->addr.ss_family);
 
-      if (PORTISRESERVED(GET_SOCKADDRPORT(&l->addr))) {
-         old_euid = geteuid();
+   if (PORTISRESERVED(GET_SOCKADDRPORT(&l->addr))) {
+      old_euid = geteuid();
 
-         if (old_euid != 0) {
-            if (seteuid(0) == 0) {
-               sockscf.state.euid = 0;
-               changed_euid       = 1;
-            }
+      if (old_euid != 0) {
+         if (seteuid(0) == 0) {
+            sockscf.state.euid = 0;
+            changed_euid       = 1;
          }
       }
+   }
 
-      if ((val = bind(l->s, TOSA(&l->addr), len)) == -1 && errno == EADDRINUSE)
-         /* retry once. */
-         val = bind(l->s, TOSA(&l->addr), len);
+   if ((val = bind(l->s, TOSA(&l->addr), len)) == -1 && errno == EADDRINUSE)
+      /* retry once. */
+      val = bind(l->s, TOSA(&l->addr), len);
 
-      if (changed_euid) {
-         if (seteuid(old_euid) == 0)
-            sockscf.state.euid = old_euid;
-      }
+   if (changed_euid) {
+      if (seteuid(old_euid) == 0)
+         sockscf.state.euid = old_euid;
+   }
 }
 #else /* HAVE_PRIVILEGES */
 
-      val = socks_bind(l->s, &l->addr, 1);
+   val = socks_bind(l->s, &l->addr, 1);
 
 #endif /* HAVE_PRIVILEGES */
 
-      if (val != 0) {
-         swarn("%s: bind of address %s (address #%lu/%lu) for server to "
-               "listen on failed",
-               function,
-               sockaddr2string(&l->addr, NULL, 0),
-               (unsigned long)i + 1,
-               (unsigned long)sockscf.internal.addrc);
+   if (val != 0) {
+      swarn("%s: bind of address %s for server to listen on failed",
+            function, sockaddr2string(&l->addr, NULL, 0));
 
-         return -1;
-      }
+      close(l->s);
+      l->s = -1;
 
-      val = 1;
-      if (setsockopt(l->s, SOL_SOCKET, SO_REUSEADDR, &val, sizeof(val)) != 0)
-         swarn("%s: setsockopt(SO_REUSEADDR)", function);
+      return -1;
+   }
 
-      if (listen(l->s, SOCKD_MAXCLIENTQUEUE) == -1) {
-         swarn("%s: listen(%d) failed", function, SOCKD_MAXCLIENTQUEUE);
-         return -1;
-      }
+   val = 1;
+   if (setsockopt(l->s, SOL_SOCKET, SO_REUSEADDR, &val, sizeof(val)) != 0)
+      swarn("%s: setsockopt(SO_REUSEADDR)", function);
 
-      /*
-       * We want to accept(2) the client on a non-blocking descriptor.
-       */
-      if (setnonblocking(l->s, "accepting new clients") == -1)
-         return -1;
+   if (!dolisten)
+      return 0;
+
+   if (listen(l->s, SOCKD_MAXCLIENTQUEUE) == -1) {
+      swarn("%s: listen(%d) failed", function, SOCKD_MAXCLIENTQUEUE);
+
+      close(l->s);
+      l->s = -1;
+
+      return -1;
+   }
+
+   /*
+    * We want to accept(2) the client on a non-blocking descriptor.
+    */
+   if (setnonblocking(l->s, "accepting new clients") == -1) {
+      close(l->s);
+      l->s = -1;
+
+      return -1;
    }
 
    return 0;
@@ -606,3 +1050,113 @@ getoptions(family, type, isclientside, optionsv, optionsc)
    SASSERTX(optc <= optionsc);
    return optc;
 }
+
+static int
+connectattempt_start(s, uses, attempt, client_l, client_r, emsg, emsglen)
+   const int s;
+   const int uses;
+   connectattempt_t *attempt;
+   const struct sockaddr_storage *client_l;
+   const struct sockaddr_storage *client_r;
+   char *emsg;
+   const size_t emsglen;
+{
+   const char *function = "connectattempt_start()";
+   socklen_t len;
+   char addrstr[MAXSOCKADDRSTRING];
+   int flags, rc, connect_errno;
+
+   sockaddr2string(&attempt->raddr, addrstr, sizeof(addrstr));
+
+   if (uses)
+      attempt->s = s;
+   else {
+      sockshost_t host;
+
+      sockaddr2sockshost(&attempt->raddr, &host);
+
+      if (getoutaddr(&attempt->laddr,
+                     client_l,
+                     client_r,
+                     SOCKS_CONNECT,
+                     &host,
+                     emsg,
+                     emsglen) == NULL) {
+         slog(LOG_DEBUG, "%s: no external address to connect to %s from: %s",
+              function, addrstr, emsg);
+
+         errno = EADDRNOTAVAIL;
+         return -1;
+      }
+
+      SET_SOCKADDRPORT(&attempt->laddr, htons(0));
+
+      if ((attempt->s = socket(attempt->raddr.ss_family, SOCK_STREAM, 0))
+      == -1) {
+         snprintf(emsg, emsglen, "could not create socket: %s",
+                  strerror(errno));
+
+         return -1;
+      }
+
+      socketoptdup(s, attempt->s);
+      setsockoptions(attempt->s, attempt->raddr.ss_family, SOCK_STREAM, 0);
+
+      if (socks_bind(attempt->s, &attempt->laddr, 0) != 0) {
+         connect_errno = errno;
+
+         log_bind_failed(function, SOCKS_TCP, &attempt->laddr);
+         snprintf(emsg, emsglen,
+                  "failed to bind address on external side: %s",
+                  strerror(connect_errno));
+
+         close(attempt->s);
+         attempt->s = -1;
+
+         errno = connect_errno;
+         return -1;
+      }
+   }
+
+   if ((flags = fcntl(attempt->s, F_GETFL, 0))            == -1
+   ||           fcntl(attempt->s, F_SETFL, flags | O_NONBLOCK) == -1)
+      swarn("%s: fcntl(F_GETFL/F_SETFL) on fd %d", function, attempt->s);
+
+   rc            = connect(attempt->s,
+                           TOSA(&attempt->raddr),
+                           salen(attempt->raddr.ss_family));
+   connect_errno = errno;
+
+   slog(LOG_NEGOTIATE, "%s: connect to %s on fd %d %s (%s)",
+        function,
+        addrstr,
+        attempt->s,
+        rc == 0 ?   "ok"
+                  : connect_errno == EINPROGRESS ? "in progress" : "failed",
+        rc == 0 ? "no error" : strerror(connect_errno));
+
+   if (rc == 0 || connect_errno == EINPROGRESS) {
+      /*
+       * if local addr was incomplete before, it should be complete now.
+       */
+      len = sizeof(attempt->laddr);
+      if (getsockname(attempt->s, TOSA(&attempt->laddr), &len) == -1)
+         slog(LOG_DEBUG, "%s: getsockname(2) on fd %d failed: %s",
+              function, attempt->s, strerror(errno));
+
+      return rc == 0 ? 0 : 1;
+   }
+
+   log_connectfailed(EXTERNALIF, addrstr);
+
+   snprintf(emsg, emsglen, "connect(2) to %s failed: %s",
+            addrstr, strerror(connect_errno));
+
+   if (attempt->s != s)
+      close(attempt->s);
+
+   attempt->s = -1;
+
+   errno = connect_errno;
+   return -1;
+}
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2017
+ *      Inferno Nettverk A/S, Norway.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. The above copyright notice, this list of conditions and the following
+ *    disclaimer must appear in all copies of the software, derivative works
+ *    or modified versions, and any portions thereof, aswell as in all
+ *    supporting documentation.
+ * 2. All advertising materials mentioning features or use of this software
+ *    must display the following acknowledgement:
+ *      This product includes software developed by
+ *      Inferno Nettverk A/S, Norway.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Inferno Nettverk A/S requests users of this software to return to
+ *
+ *  Software Distribution Coordinator  or  sdc@inet.no
+ *  Inferno Nettverk A/S
+ *  Oslo Research Park
+ *  Gaustadallen 21
+ *  NO-0349 Oslo
+ *  Norway
+ *
+ * any improvements or extensions that they make and grant Inferno Nettverk A/S
+ * the rights to redistribute these changes.
+ *
+ */
+
+/*
+ * Access to splice(2) on Linux requires _GNU_SOURCE to be defined.
+ * As in cpuaffinity.c, it is only defined in this file, and the code
+ * needing it is kept here.
+ */
+#define _GNU_SOURCE
+
+#include "common.h"
+
+/*
+ * splice(2)-based relaying of tcp data for the i/o processes.
+ *
+ * Data is moved from the socket we read from into a pipe, and from the
+ * pipe to the socket we write to, without being copied to userspace.
+ * The pipe is shared by all sessions in the process, so it is always
+ * empty between calls; whatever the socket we write to does not accept
+ * right away is moved from the pipe into the socket's write buffer, the
+ * same as with data that has been read normally.  This means the rest of
+ * the i/o code does not need to know whether the data was spliced or not.
+ */
+
+static const char rcsid[] =
+"$Id$";
+
+#if HAVE_SPLICE_RELAY
+
+static void splice_reset(void);
+/*
+ * Closes the pipe, if open.  A new one will be created on next use.
+ */
+
+static int pipev[2] = { -1, -1 };
+
+int
+splice_isavailable(void)
+{
+   const char *function = "splice_isavailable()";
+   static int failed;
+
+   if (pipev[0] != -1)
+      return 1;
+
+   if (failed)
+      return 0;
+
+   if (pipe(pipev) == -1) {
+      swarn("%s: could not create pipe for splicing.  "
+            "Will relay data the normal way",
+            function);
+
+      failed   = 1;
+      pipev[0] = pipev[1] = -1;
+
+      return 0;
+   }
+
+   if (setnonblocking(pipev[0], function) == -1
+   ||  setnonblocking(pipev[1], function) == -1) {
+      splice_reset();
+      failed = 1;
+
+      return 0;
+   }
+
+#ifdef F_SETPIPE_SZ
+   /*
+    * Make sure the pipe can hold as much as we can read in one go.
+    * Not fatal if it fails; we will just read less each time.
+    */
+   if (fcntl(pipev[1], F_SETPIPE_SZ, SOCKD_BUFSIZE) == -1)
+      slog(LOG_DEBUG, "%s: could not set pipe size to %lu: %s",
+           function, (unsigned long)SOCKD_BUFSIZE, strerror(errno));
+#endif /* F_SETPIPE_SZ */
+
+   slog(LOG_DEBUG, "%s: splicing via pipe fds %d/%d",
+        function, pipev[0], pipev[1]);
+
+   return 1;
+}
+
+ssize_t
+splice_read(s, len)
+   const int s;
+   const size_t len;
+{
+   const char *function = "splice_read()";
+   ssize_t r;
+
+   SASSERTX(pipev[1] != -1);
+
+   r = splice(s, NULL, pipev[1], NULL, len, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+
+   if (sockscf.option.debug >= DEBUG_VERBOSE)
+      slog(LOG_DEBUG, "%s: spliced %ld/%lu byte%s from fd %d, errno = %d (%s)",
+           function,
+           (long)r,
+           (unsigned long)len,
+           len == 1 ? "" : "s",
+           s,
+           errno,
+           strerror(errno));
+
+   if (r >= 0)
+      errno = 0;
+
+   return r;
+}
+
+ssize_t
+splice_write(s, len, sendtoflags, buf, bufsize)
+   const int s;
+   const size_t len;
+   sendto_info_t *sendtoflags;
+   char *buf;
+   const size_t bufsize;
+{
+   const char *function = "splice_write()";
+   ssize_t w, p;
+   size_t left;
+   int errno_s;
+
+   SASSERTX(pipev[0] != -1);
+   SASSERTX(bufsize > 0);
+
+   sendtoflags->tosocket = 0;
+
+   w       = splice(pipev[0], NULL, s, NULL, len,
+                    SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+   errno_s = errno;
+
+   if (w == -1) {
+      log_writefailed(sendtoflags->side, s, NULL);
+      left = len;
+   }
+   else {
+      sendtoflags->tosocket = w;
+      left                  = len - w;
+   }
+
+   if (sockscf.option.debug >= DEBUG_VERBOSE)
+      slog(LOG_DEBUG, "%s: spliced %ld/%lu byte%s to fd %d.  %lu left in pipe",
+           function,
+           (long)w,
+           (unsigned long)len,
+           len == 1 ? "" : "s",
+           s,
+           (unsigned long)left);
+
+   /*
+    * Move what is left into the write buffer of the socket, so that the
+    * pipe is empty for the next caller.  Our caller should not have
+    * spliced more than there is room for in the buffer.
+    */
+   while (left > 0) {
+      if ((p = read(pipev[0], buf, MIN(left, bufsize))) <= 0) {
+         swarn("%s: failed to read %lu byte%s back from splice pipe fd %d",
+               function,
+               (unsigned long)left,
+               left == 1 ? "" : "s",
+               pipev[0]);
+
+         /* don't know what is left in the pipe now, so start over. */
+         splice_reset();
+
+         if (p == 0)
+            errno = EIO;
+
+         return -1;
+      }
+
+      if (socks_addtobuffer(s, WRITE_BUF, 0, buf, (size_t)p) != p)
+         SERRX(p);
+
+      left -= (size_t)p;
+   }
+
+   if (w == -1 && !ERRNOISTMP(errno_s)) {
+      errno = errno_s;
+      return -1;
+   }
+
+   errno = 0;
+   return (ssize_t)len;
+}
+
+static void
+splice_reset(void)
+{
+
+   if (pipev[0] != -1)
+      close(pipev[0]);
+
+   if (pipev[1] != -1)
+      close(pipev[1]);
+
+   pipev[0] = pipev[1] = -1;
+}
+
+#endif /* HAVE_SPLICE_RELAY */
@@ -53,13 +53,17 @@ io_tcp_rw(sockd_io_direction_t *in, sockd_io_direction_t *out, int *badfd,
 #if COVENANT
           const requestflags_t *reqflags, size_t *bufused,
 #endif /* COVENANT */
-          char *buf, size_t bufsize, int flags);
+          char *buf, size_t bufsize, const int needdata, int flags);
 /*
  * Transfers TCP data from "in" to "out" using "buf" as a temporary buffer
  * to store the data, and sets flag "flags" on the send/recv system call
  * used to do the i/o.
  * The data transferred uses "buf" as a buffer, which is of size "bufsize".
  *
+ * If "needdata" is not set, the caller does not need the data transferred
+ * to be in "buf" upon return, and we may splice(2) it directly from "in"
+ * to "out" instead, if possible.
+ *
  * Covenant has these additional arguments:
  * - "reqflags" is flags for the client side of the request.
  * - "bufused", indicates how much of "buf" has previously been used, but
@@ -336,6 +340,7 @@ do {                                                                           \
 #endif /* COVENANT */
                        buf,
                        buflen,
+                       io->srule.log.data,
                        flags);
 
          CHECK_ALARM(iostatus);
@@ -419,6 +424,7 @@ do {                                                                           \
 #endif /* COVENANT */
                        buf,
                        buflen,
+                       io->srule.log.data,
                        flags);
 
          CHECK_ALARM(iostatus);
@@ -486,7 +492,7 @@ io_tcp_rw(in, out, badfd, iostatus,
 #if COVENANT
           reqflags, bufused,
 #endif /* COVENANT */
-          buf, bufsize, flags)
+          buf, bufsize, needdata, flags)
           sockd_io_direction_t *in;
           sockd_io_direction_t *out;
           int *badfd;
@@ -497,12 +503,16 @@ io_tcp_rw(in, out, badfd, iostatus,
 #endif /* COVENANT */
           char *buf;
           size_t bufsize;
+          const int needdata;
           int flags;
 {
    const char *function = "io_tcp_rw()";
    sendto_info_t sendtoflags;
    recvfrom_info_t recvfromflags;
    ssize_t r, w, p;
+#if HAVE_SPLICE_RELAY
+   int dosplice;
+#endif /* HAVE_SPLICE_RELAY */
 #if 0 /* for aid in debuging bufferproblems. */
    static size_t j;
    size_t lenv[] = { 60000, 60001, 60002, 60003, 60004, 60005, 60006, 60007,
@@ -660,15 +670,41 @@ io_tcp_rw(in, out, badfd, iostatus,
    ++j;
 #endif
 
+#if HAVE_SPLICE_RELAY
+   /*
+    * Splice the data if nobody needs to see it.  The OOB byte must be sent
+    * with MSG_OOB however, and data already buffered must go first, so
+    * those cases are handled the normal way.
+    */
+   if (!needdata
+   &&  !(flags & MSG_OOB)
+   &&  in->auth.method  != AUTHMETHOD_GSSAPI
+   &&  out->auth.method != AUTHMETHOD_GSSAPI
+   &&  socks_bytesinbuffer(in->s,  READ_BUF,  0) == 0
+   &&  socks_bytesinbuffer(out->s, WRITE_BUF, 0) == 0
+   &&  splice_isavailable())
+      dosplice = 1;
+   else
+      dosplice = 0;
+#endif /* HAVE_SPLICE_RELAY */
+
    SASSERTX(p >= 0);
-   r = socks_recvfrom(in->s,
-                      &buf[*bufused],
-                      (size_t)p,
-                      flags & ~MSG_OOB,
-                      NULL,
-                      NULL,
-                      &recvfromflags,
-                      &in->auth);
+
+#if HAVE_SPLICE_RELAY
+   if (dosplice) {
+      if ((r = splice_read(in->s, (size_t)p)) > 0)
+         recvfromflags.fromsocket = (size_t)r;
+   }
+   else
+#endif /* HAVE_SPLICE_RELAY */
+      r = socks_recvfrom(in->s,
+                         &buf[*bufused],
+                         (size_t)p,
+                         flags & ~MSG_OOB,
+                         NULL,
+                         NULL,
+                         &recvfromflags,
+                         &in->auth);
 
    if (r <= 0) {
       *badfd = in->s;
@@ -881,6 +917,11 @@ io_tcp_rw(in, out, badfd, iostatus,
    else
       sendtoflags.side = INTERNALIF;
 
+#if HAVE_SPLICE_RELAY
+   if (dosplice)
+      w = splice_write(out->s, (size_t)r, &sendtoflags, buf, bufsize);
+   else
+#endif /* HAVE_SPLICE_RELAY */
    if ((w = socks_sendto(out->s,
                          buf,
                          r,
@@ -197,113 +197,125 @@ doio_udp(io, rset, badfd)
 
    if (FD_ISSET(io->src.s, rset)) {
       const int originaldst = io->dst.s;
-      iocount_t src_read    = io->src.read,
-                src_written = io->src.written,
-                dst_read    = io->dst.read,
-                dst_written = io->dst.written;
-      iologaddr_t lsrc = src, ldst = dst;
-      size_t bwused = 0;
 
       ++sideschecked;
 
       /*
-       * Don't yet know what the target address/socket used will be.
-       * If any data is actually to be forwarded to a target, this will
-       * be updated based on the target.
+       * Handle all the packets read from the socket, which may be more
+       * than one if we read several at a time.
        */
-      io->dst.s = -1;
+      do {
+         iocount_t src_read    = io->src.read,
+                   src_written = io->src.written,
+                   dst_read    = io->dst.read,
+                   dst_written = io->dst.written;
+         iologaddr_t lsrc = src, ldst = dst;
+         size_t bwused = 0;
+
+         /*
+          * Don't yet know what the target address/socket used will be.
+          * If any data is actually to be forwarded to a target, this will
+          * be updated based on the target.
+          */
+         io->dst.s = -1;
 
 #if BAREFOOTD
-      /*
-       * initalize to crule, and if we get far enough, rulespermit() will
-       * update it, possibly changing it to another crule based on the source
-       * address of the client who sent the packet we will read.
-       *
-       * Since we want to be sure to not change the original crule,
-       * don't use a pointer for packetrule.
-       */
-      packetrule = io->crule;
-
-      slog(LOG_DEBUG, "%s: client2target i/o on fd %d -> fd %d",
-           function, io->src.s, io->dst.s);
-
-      iostatus = io_udp_client2target(&io->src,
-                                      &io->dst,
-                                      &io->cauth,
-                                      &io->state,
-                                      &lsrc,
-                                      &ldst,
-                                      badfd,
-                                      &packetrule,
-                                      &bwused);
+         /*
+          * initalize to crule, and if we get far enough, rulespermit() will
+          * update it, possibly changing it to another crule based on the
+          * source address of the client who sent the packet we will read.
+          *
+          * Since we want to be sure to not change the original crule,
+          * don't use a pointer for packetrule.
+          */
+         packetrule = io->crule;
+
+         slog(LOG_DEBUG, "%s: client2target i/o on fd %d -> fd %d",
+              function, io->src.s, io->dst.s);
+
+         iostatus = io_udp_client2target(&io->src,
+                                         &io->dst,
+                                         &io->cauth,
+                                         &io->state,
+                                         &lsrc,
+                                         &ldst,
+                                         badfd,
+                                         &packetrule,
+                                         &bwused);
 
 #else /* SOCKS_SERVER */
 
-      /*
-       * Default to packetrule being the rule matched for this udp session,
-       * unless we've progressed far enough to have a previously saved rule
-       * to use.
-       */
-      if (!io->src.state.use_saved_srule)
-         *io->cmd.udp.sfwdrule = io->srule; /* reset to initial match. */
-
-      packetrule = io->cmd.udp.sfwdrule;
-
-      slog(LOG_DEBUG, "%s: client2target i/o on fd %d -> {fd %d, fd %d}",
-           function, io->src.s, io->dst.dstv[0].s, io->dst.dstv[1].s);
-
-      iostatus = io_udp_client2target(&io->control,
-                                      &io->src,
-                                      &io->dst,
-                                      &io->cauth,
-                                      &io->state,
-                                      &lsrc,
-                                      &ldst,
-                                      badfd,
-                                      packetrule,
-                                      &bwused);
+         /*
+          * Default to packetrule being the rule matched for this udp
+          * session, unless we've progressed far enough to have a previously
+          * saved rule to use.
+          */
+         if (!io->src.state.use_saved_srule)
+            *io->cmd.udp.sfwdrule = io->srule; /* reset to initial match. */
+
+         packetrule = io->cmd.udp.sfwdrule;
+
+         slog(LOG_DEBUG,
+              "%s: client2target i/o on fd %d -> {fd %d, fd %d}",
+              function, io->src.s, io->dst.dstv[0].s, io->dst.dstv[1].s);
+
+         iostatus = io_udp_client2target(&io->control,
+                                         &io->src,
+                                         &io->dst,
+                                         &io->cauth,
+                                         &io->state,
+                                         &lsrc,
+                                         &ldst,
+                                         badfd,
+                                         packetrule,
+                                         &bwused);
 #endif /* SOCKS_SERVER */
 
-      if (IOSTATUS_FATALERROR(iostatus))
-         /* can not be sure the error did not affect dst, so return now. */
-         return iostatus;
-
-      if (iostatus == IO_NOERROR) {
-         DO_IOCOUNT(&src_read,
-                    &src_written,
-                    &dst_read,
-                    &dst_written,
-                    io);
-
-         io_update(&io->lastio,
-                   bwused,
-                   &src_read,
-                   NULL,
-                   NULL,
-                   &dst_written,
+         if (IOSTATUS_FATALERROR(iostatus)) {
+            /* can not be sure the error did not affect dst, so return now. */
+            udp_recvflush();
+            udp_sendflush();
+            return iostatus;
+         }
+
+         if (iostatus == IO_NOERROR) {
+            DO_IOCOUNT(&src_read,
+                       &src_written,
+                       &dst_read,
+                       &dst_written,
+                       io);
+
+            io_update(&io->lastio,
+                      bwused,
+                      &src_read,
+                      NULL,
+                      NULL,
+                      &dst_written,
 
 #if BAREFOOTD
-                   &packetrule,
-                   &packetrule,
+                      &packetrule,
+                      &packetrule,
 
 #else /* SOCKS_SERVER */
 
-                   &io->srule,
-                   packetrule,
+                      &io->srule,
+                      packetrule,
 
 #endif /* SOCKS_SERVER */
 
-                   sockscf.shmemfd);
-
-          /*
-           * client2target will have changed dst to the object associated with
-           * the client it read the packet from, possibly a brand new dst.
-           */
-         io->dst.s = originaldst;
-      }
-      else
-         slog(LOG_DEBUG, "%s: some non-fatal error, iostatus = %d",
-              function, (int)iostatus);
+                      sockscf.shmemfd);
+
+            /*
+             * client2target will have changed dst to the object associated
+             * with the client it read the packet from, possibly a brand new
+             * dst.
+             */
+            io->dst.s = originaldst;
+         }
+         else
+            slog(LOG_DEBUG, "%s: some non-fatal error, iostatus = %d",
+                 function, (int)iostatus);
+      } while (udp_recvpending(io->src.s) > 0);
    }
 
    /*
@@ -316,93 +328,103 @@ doio_udp(io, rset, badfd)
        * - io->dst is (presumably) one of client's target and can vary for
        *   each packet.
        */
-      iocount_t src_read    = io->src.read,
-                src_written = io->src.written,
-                dst_read    = io->dst.read,
-                dst_written = io->dst.written;
-      iologaddr_t lsrc = src, ldst = dst;
-      connectionstate_t replystate;
-      size_t bwused = 0;
+
+      ++sideschecked;
+
+      /*
+       * As for the client side, handle all packets read.
+       */
+      do {
+         iocount_t src_read    = io->src.read,
+                   src_written = io->src.written,
+                   dst_read    = io->dst.read,
+                   dst_written = io->dst.written;
+         iologaddr_t lsrc = src, ldst = dst;
+         connectionstate_t replystate;
+         size_t bwused = 0;
 
 #if BAREFOOTD
-      packetrule = io->crule;
+         packetrule = io->crule;
 
 #else /* SOCKS_SERVER */
-      SASSERTX(io->cmd.udp.sfwdrule   != NULL);
-      SASSERTX(io->cmd.udp.sreplyrule != NULL);
+         SASSERTX(io->cmd.udp.sfwdrule   != NULL);
+         SASSERTX(io->cmd.udp.sreplyrule != NULL);
 
-      if (!io->dst.state.use_saved_srule)
-         *io->cmd.udp.sreplyrule = io->srule; /* reset to initial match. */
+         if (!io->dst.state.use_saved_srule)
+            *io->cmd.udp.sreplyrule = io->srule; /* reset to initial match. */
 
-      packetrule = io->cmd.udp.sreplyrule;
+         packetrule = io->cmd.udp.sreplyrule;
 #endif /* SOCKS_SERVER */
 
-      replystate         = io->state;
-      replystate.command = SOCKS_UDPREPLY;
-
-      ++sideschecked;
+         replystate         = io->state;
+         replystate.command = SOCKS_UDPREPLY;
 
-      slog(LOG_DEBUG,
-           "%s: target2client i/o on fd %d -> fd %d",
-           function, io->dst.s, io->src.s);
+         slog(LOG_DEBUG,
+              "%s: target2client i/o on fd %d -> fd %d",
+              function, io->dst.s, io->src.s);
 
 #if BAREFOOTD
-      iostatus = io_udp_target2client(&io->src,
-                                      &io->dst,
-                                      &io->cauth,
-                                      &replystate,
-                                      &lsrc,
-                                      &ldst,
-                                      badfd,
-                                      &packetrule,
-                                      &bwused);
+         iostatus = io_udp_target2client(&io->src,
+                                         &io->dst,
+                                         &io->cauth,
+                                         &replystate,
+                                         &lsrc,
+                                         &ldst,
+                                         badfd,
+                                         &packetrule,
+                                         &bwused);
 #else /* SOCKS_SERVER */
-      iostatus = io_udp_target2client(&io->control,
-                                      &io->src,
-                                      &io->dst,
-                                      &replystate,
-                                      &lsrc,
-                                      &ldst,
-                                      badfd,
-                                      packetrule,
-                                      &bwused);
+         iostatus = io_udp_target2client(&io->control,
+                                         &io->src,
+                                         &io->dst,
+                                         &replystate,
+                                         &lsrc,
+                                         &ldst,
+                                         badfd,
+                                         packetrule,
+                                         &bwused);
 #endif /* SOCKS_SERVER */
 
-
-      if (IOSTATUS_FATALERROR(iostatus))
-         return iostatus;
-
-      if (iostatus == IO_NOERROR) {
-         DO_IOCOUNT(&src_read,
-                    &src_written,
-                    &dst_read,
-                    &dst_written,
-                    io);
-
-         io_update(&io->lastio,
-                   bwused,
-                   NULL,
-                   &src_written,
-                   &dst_read,
-                   NULL,
+         if (IOSTATUS_FATALERROR(iostatus)) {
+            udp_recvflush();
+            udp_sendflush();
+            return iostatus;
+         }
+
+         if (iostatus == IO_NOERROR) {
+            DO_IOCOUNT(&src_read,
+                       &src_written,
+                       &dst_read,
+                       &dst_written,
+                       io);
+
+            io_update(&io->lastio,
+                      bwused,
+                      NULL,
+                      &src_written,
+                      &dst_read,
+                      NULL,
 
 #if BAREFOOTD
-                   &packetrule,
-                   &packetrule,
+                      &packetrule,
+                      &packetrule,
 
 #else /* SOCKS_SERVER */
 
-                   &io->srule,
-                   packetrule,
+                      &io->srule,
+                      packetrule,
 
 #endif /* SOCKS_SERVER */
 
-                   sockscf.shmemfd);
-      }
+                      sockscf.shmemfd);
+         }
+      } while (udp_recvpending(io->dst.s) > 0);
    }
 
    SASSERTX(sideschecked > 0);
 
+   udp_sendflush();
+
    gettimeofday_monotonic(&io->lastio);
 
    return iostatus;
@@ -643,14 +665,14 @@ initclient(control, client_l, client_r, tohost, toaddr, rule,
     * we will thus know who it's destined for (from).
     * Since we place no bound on the number of udp clients we
     * handle, we need to make sure we leave room for at least
-    * SOCKD_IOMAX tcp clients, so we don't fail on recvmsg(2)
+    * iostate.maxclients tcp clients, so we don't fail on recvmsg(2)
     * when mother sends us a new tcp client.
     */
 
    errno = 0;
    s     = -1;
 
-   if (iostate.freefds  <= ((SOCKD_IOMAX - 1) * FDPASS_MAX)
+   if (iostate.freefds  <= ((iostate.maxclients - 1) * FDPASS_MAX)
    || (s = socket(udpdst->raddr.ss_family, SOCK_DGRAM, 0)) == -1) {
       snprintf(emsg, emsglen, "could not create %s udp socket: %s",
                safamily2string(udpdst->raddr.ss_family),
@@ -683,6 +705,7 @@ initclient(control, client_l, client_r, tohost, toaddr, rule,
    }
 
    setsockoptions(s, udpdst->raddr.ss_family, SOCK_DGRAM, 0);
+   udp_enableoffload(s);
 
    setconfsockoptions(s,
                       control,
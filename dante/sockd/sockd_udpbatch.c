@@ -0,0 +1,702 @@
+/*
+ * Copyright (c) 2017
+ *      Inferno Nettverk A/S, Norway.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. The above copyright notice, this list of conditions and the following
+ *    disclaimer must appear in all copies of the software, derivative works
+ *    or modified versions, and any portions thereof, aswell as in all
+ *    supporting documentation.
+ * 2. All advertising materials mentioning features or use of this software
+ *    must display the following acknowledgement:
+ *      This product includes software developed by
+ *      Inferno Nettverk A/S, Norway.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Inferno Nettverk A/S requests users of this software to return to
+ *
+ *  Software Distribution Coordinator  or  sdc@inet.no
+ *  Inferno Nettverk A/S
+ *  Oslo Research Park
+ *  Gaustadallen 21
+ *  NO-0349 Oslo
+ *  Norway
+ *
+ * any improvements or extensions that they make and grant Inferno Nettverk A/S
+ * the rights to redistribute these changes.
+ *
+ */
+
+/*
+ * Access to recvmmsg(2) on Linux requires _GNU_SOURCE to be defined.
+ * As in sockd_splice.c, it is only defined in this file, and the code
+ * needing it is kept here.
+ */
+#define _GNU_SOURCE
+
+#include "common.h"
+
+/*
+ * Batched reading and writing of udp packets for the i/o processes.
+ *
+ * Rather than one recvfrom(2) per packet, up to SOCKD_UDPBATCH packets
+ * are read from a socket with one recvmmsg(2), and then returned one at
+ * a time by udp_recvfrom(), so that the rest of the udp code can go on
+ * handling one packet at a time as before.  Only the packets from one
+ * socket are kept at a time, and doio_udp() handles all of them before
+ * it returns, so nothing is kept between calls to it.
+ *
+ * Where the kernel supports udp segmentation offload, each packet read
+ * can also be several packets of the same size coalesced by the kernel
+ * (UDP_GRO), which udp_recvfrom() splits up again.  Correspondingly,
+ * packets of the same size written by udp_sendto() to the same
+ * destination are collected and written with one sendmsg(2), to be split
+ * up again by the kernel (UDP_SEGMENT).  These are flushed by
+ * udp_sendflush(), which doio_udp() calls before it returns.
+ */
+
+static const char rcsid[] =
+"$Id$";
+
+#if HAVE_UDP_BATCHRECV
+
+typedef struct {
+   int                     s;     /* socket packets were read from.       */
+   size_t                  c;     /* number of packets read.              */
+   size_t                  i;     /* index of next packet to return.      */
+   size_t                  off;   /* offset of next segment in packet i.  */
+
+   struct mmsghdr          msgv[SOCKD_UDPBATCH];
+   struct iovec            iovv[SOCKD_UDPBATCH];
+   struct sockaddr_storage fromv[SOCKD_UDPBATCH];
+   size_t                  segsizev[SOCKD_UDPBATCH]; /* 0 if not coalesced.*/
+
+#if HAVE_SO_TIMESTAMP || HAVE_UDP_OFFLOAD
+   union {
+      struct cmsghdr       align;
+      char                 mem[0
+#if HAVE_SO_TIMESTAMP
+                               + CMSG_SPACE(sizeof(struct timeval))
+#endif /* HAVE_SO_TIMESTAMP */
+#if HAVE_UDP_OFFLOAD
+                               + CMSG_SPACE(sizeof(int))
+#endif /* HAVE_UDP_OFFLOAD */
+                              ];
+   } cmsgv[SOCKD_UDPBATCH];
+#endif /* HAVE_SO_TIMESTAMP || HAVE_UDP_OFFLOAD */
+
+   char                    bufv[SOCKD_UDPBATCH][SOCKD_BUFSIZE
+                                                + sizeof(udpheader_t)];
+} udpbatch_t;
+
+static udpbatch_t *batch;
+
+static ssize_t
+udp_recvbatch(const int s, recvfrom_info_t *recvflags);
+/*
+ * Reads up to SOCKD_UDPBATCH packets from "s" into "batch".
+ * "recvflags" is used only for logging on error.
+ *
+ * Returns:
+ *      On success: the number of packets read.
+ *      On failure: -1.
+ */
+
+#if HAVE_UDP_OFFLOAD
+
+/*
+ * Max number of packets and bytes we collect before writing them with
+ * one sendmsg(2).  Older Linux kernels do not accept more than 64
+ * segments in one write.
+ */
+#define UDP_SENDSEGMENTSMAX   (64)
+#define UDP_SENDBYTESMAX      (1024 * 63)
+
+typedef struct {
+   int                     s;       /* socket to write to, or -1.         */
+   int                     hasto;   /* is "to" set?                       */
+   struct sockaddr_storage to;      /* address to write to, if not connected*/
+   size_t                  segsize; /* size of each packet but the last.  */
+   size_t                  segc;    /* number of packets collected.       */
+   size_t                  len;     /* total length of packets collected. */
+   char                    buf[UDP_SENDBYTESMAX];
+} udpsendq_t;
+
+static udpsendq_t *sendq;
+static int gso_failed;
+
+static int
+udp_sendqueue(const int s, const void *buf, const size_t len,
+              const struct sockaddr_storage *to);
+/*
+ * Adds the packet "buf", of length "len", to be written to "to" on "s",
+ * to the packets collected for writing with one sendmsg(2).
+ * If packets for a different destination, or of a different size, are
+ * already collected, they are written first.
+ *
+ * Returns true if the packet was added, or false if it should be
+ * written normally instead.
+ */
+
+static void
+udp_sendsegments(void);
+/*
+ * Writes the packets collected in "sendq", one by one if it turns out
+ * the kernel does not accept them being written together.
+ */
+
+#endif /* HAVE_UDP_OFFLOAD */
+
+ssize_t
+udp_recvfrom(s, buf, len, from, fromlen, recvflags, auth)
+   const int s;
+   void *buf;
+   const size_t len;
+   struct sockaddr_storage *from;
+   socklen_t *fromlen;
+   recvfrom_info_t *recvflags;
+   authmethod_t *auth;
+{
+   const char *function = "udp_recvfrom()";
+   struct msghdr *msg;
+   size_t tocaller, pktlen;
+
+#if HAVE_GSSAPI
+   /*
+    * Decoding is done by socks_recvfrom(), one packet at a time.
+    */
+   if (auth != NULL
+   && auth->method == AUTHMETHOD_GSSAPI && auth->mdata.gssapi.state.wrap)
+      return socks_recvfrom(s, buf, len, 0, from, fromlen, recvflags, auth);
+#endif /* HAVE_GSSAPI */
+
+   if (batch == NULL) {
+      static int failed;
+
+      if (!failed && (batch = malloc(sizeof(*batch))) == NULL) {
+         swarn("%s: failed to allocate %lu bytes of memory for reading "
+               "several udp packets at a time.  Will read one at a time",
+               function, (unsigned long)sizeof(*batch));
+
+         failed = 1;
+      }
+
+      if (batch == NULL)
+         return socks_recvfrom(s, buf, len, 0, from, fromlen, recvflags, auth);
+
+      batch->s = -1;
+      batch->c = batch->i = batch->off = 0;
+   }
+
+   if (recvflags != NULL) {
+      recvflags->flags      = 0;
+      recvflags->fromsocket = 0;
+      timerclear(&recvflags->ts);
+   }
+
+   if (batch->s != s || batch->i >= batch->c) {
+      if (batch->s != s && batch->i < batch->c)
+         slog(LOG_DEBUG, "%s: discarding %lu packet%s read from fd %d",
+              function,
+              (unsigned long)(batch->c - batch->i),
+              batch->c - batch->i == 1 ? "" : "s",
+              batch->s);
+
+      if (udp_recvbatch(s, recvflags) == -1)
+         return -1;
+   }
+
+   SASSERTX(batch->s == s);
+   SASSERTX(batch->i < batch->c);
+
+   msg = &batch->msgv[batch->i].msg_hdr;
+
+   /*
+    * If the kernel coalesced several packets into this one, return the
+    * next of them.  All but the last have the same size.
+    */
+   if (batch->segsizev[batch->i] != 0)
+      pktlen = MIN(batch->segsizev[batch->i],
+                   batch->msgv[batch->i].msg_len - batch->off);
+   else
+      pktlen = batch->msgv[batch->i].msg_len;
+
+   tocaller = MIN(len, pktlen);
+
+   memcpy(buf, &batch->bufv[batch->i][batch->off], tocaller);
+
+   if (from != NULL) {
+      SASSERTX(fromlen != NULL);
+
+      memcpy(from, msg->msg_name, MIN(*fromlen, msg->msg_namelen));
+      *fromlen = msg->msg_namelen;
+   }
+
+   if (recvflags != NULL) {
+      recvflags->flags      = msg->msg_flags;
+      recvflags->fromsocket = pktlen;
+
+      if (tocaller < pktlen)
+         recvflags->flags |= MSG_TRUNC;
+
+#if HAVE_SO_TIMESTAMP
+      if (CMSG_TOTLEN(*msg) != 0) {
+         struct cmsghdr *cmsg;
+         int hasts = 0;
+
+         for (cmsg = CMSG_FIRSTHDR(msg);
+         cmsg != NULL;
+         cmsg = CMSG_NXTHDR(msg, cmsg)) {
+            if (cmsg->cmsg_level == SOL_SOCKET
+            &&  cmsg->cmsg_type  == SCM_TIMESTAMP
+            &&  cmsg->cmsg_len   == CMSG_LEN(sizeof(struct timeval))) {
+               CMSG_GETOBJECT(recvflags->ts, cmsg, 0);
+               hasts = 1;
+            }
+         }
+
+         if (!hasts)
+            swarnx("%s: did not receive a timestamp for packet "
+                   "of length %lu (cmsglen is %lu)",
+                   function,
+                   (unsigned long)pktlen,
+                   (unsigned long)CMSG_TOTLEN(*msg));
+      }
+#endif /* HAVE_SO_TIMESTAMP */
+   }
+
+   batch->off += pktlen;
+   if (batch->off >= batch->msgv[batch->i].msg_len) {
+      ++batch->i;
+      batch->off = 0;
+   }
+
+   if (sockscf.option.debug >= DEBUG_VERBOSE)
+      slog(LOG_DEBUG, "%s: returning packet of %lu bytes from fd %d.  "
+                      "%lu more packet%s read",
+           function,
+           (unsigned long)tocaller,
+           s,
+           (unsigned long)(batch->c - batch->i),
+           batch->c - batch->i == 1 ? "" : "s");
+
+   errno = 0;
+   return (ssize_t)tocaller;
+}
+
+size_t
+udp_recvpending(s)
+   const int s;
+{
+
+   if (batch == NULL || batch->s != s)
+      return 0;
+
+   return batch->c - batch->i;
+}
+
+void
+udp_recvflush(void)
+{
+   const char *function = "udp_recvflush()";
+
+   if (batch == NULL)
+      return;
+
+   if (batch->i < batch->c)
+      slog(LOG_DEBUG, "%s: discarding %lu packet%s read from fd %d",
+           function,
+           (unsigned long)(batch->c - batch->i),
+           batch->c - batch->i == 1 ? "" : "s",
+           batch->s);
+
+   batch->s = -1;
+   batch->c = batch->i = batch->off = 0;
+}
+
+ssize_t
+udp_sendto(s, buf, len, to, tolen, sendtoflags, auth)
+   const int s;
+   const void *buf;
+   const size_t len;
+   const struct sockaddr_storage *to;
+   const socklen_t tolen;
+   sendto_info_t *sendtoflags;
+   authmethod_t *auth;
+{
+
+#if HAVE_UDP_OFFLOAD
+   if (auth == NULL || auth->method != AUTHMETHOD_GSSAPI) {
+      if (udp_sendqueue(s, buf, len, tolen == 0 ? NULL : to)) {
+         if (sendtoflags != NULL)
+            sendtoflags->tosocket = len;
+
+         return (ssize_t)len;
+      }
+   }
+
+   /*
+    * Any packets collected for this socket must be written first.
+    */
+   if (sendq != NULL && sendq->s == s)
+      udp_sendflush();
+#endif /* HAVE_UDP_OFFLOAD */
+
+   return socks_sendto(s, buf, len, 0, to, tolen, sendtoflags, auth);
+}
+
+void
+udp_sendflush(void)
+{
+
+#if HAVE_UDP_OFFLOAD
+   if (sendq == NULL || sendq->s == -1)
+      return;
+
+   udp_sendsegments();
+
+   sendq->s    = -1;
+   sendq->segc = sendq->len = 0;
+#endif /* HAVE_UDP_OFFLOAD */
+}
+
+void
+udp_enableoffload(s)
+   const int s;
+{
+#if HAVE_UDP_OFFLOAD
+   const char *function = "udp_enableoffload()";
+   static int failed;
+   const int val = 1;
+
+   if (failed)
+      return;
+
+   if (setsockopt(s, IPPROTO_UDP, UDP_GRO, &val, sizeof(val)) != 0) {
+      /*
+       * Not supported by this kernel.  Not an error, but no point in
+       * trying again.
+       */
+      slog(LOG_DEBUG, "%s: could not enable UDP_GRO on fd %d: %s",
+           function, s, strerror(errno));
+
+      failed = 1;
+   }
+#endif /* HAVE_UDP_OFFLOAD */
+}
+
+static ssize_t
+udp_recvbatch(s, recvflags)
+   const int s;
+   recvfrom_info_t *recvflags;
+{
+   const char *function = "udp_recvbatch()";
+   size_t i;
+   int r;
+
+   batch->s = -1;
+   batch->c = batch->i = batch->off = 0;
+
+   for (i = 0; i < ELEMENTS(batch->msgv); ++i) {
+      struct msghdr *msg = &batch->msgv[i].msg_hdr;
+
+      batch->iovv[i].iov_base = batch->bufv[i];
+      batch->iovv[i].iov_len  = sizeof(batch->bufv[i]);
+
+      bzero(msg, sizeof(*msg));
+      msg->msg_name    = &batch->fromv[i];
+      msg->msg_namelen = sizeof(batch->fromv[i]);
+      msg->msg_iov     = &batch->iovv[i];
+      msg->msg_iovlen  = 1;
+
+#if HAVE_SO_TIMESTAMP || HAVE_UDP_OFFLOAD
+      msg->msg_control    = batch->cmsgv[i].mem;
+      msg->msg_controllen = sizeof(batch->cmsgv[i].mem);
+#endif /* HAVE_SO_TIMESTAMP || HAVE_UDP_OFFLOAD */
+
+      batch->msgv[i].msg_len = 0;
+   }
+
+   r = recvmmsg(s, batch->msgv, ELEMENTS(batch->msgv), MSG_DONTWAIT, NULL);
+
+   if (r <= 0) {
+      if (r == 0)
+         errno = EAGAIN; /* should not happen. */
+
+      slog(LOG_DEBUG, "%s: recvmmsg() on fd %d failed (%s)",
+           function, s, strerror(errno));
+
+      if (recvflags != NULL && ERRNOISPREVIOUSPACKET(errno))
+         log_writefailed(recvflags->side == INTERNALIF ?
+                                                        EXTERNALIF : INTERNALIF,
+                         s,
+                         &recvflags->peer);
+
+      return -1;
+   }
+
+   for (i = 0; i < (size_t)r; ++i) {
+#if HAVE_UDP_OFFLOAD
+      struct msghdr *msg = &batch->msgv[i].msg_hdr;
+      struct cmsghdr *cmsg;
+#endif /* HAVE_UDP_OFFLOAD */
+
+      batch->segsizev[i] = 0;
+
+#if HAVE_UDP_OFFLOAD
+      if (CMSG_TOTLEN(*msg) == 0)
+         continue;
+
+      for (cmsg = CMSG_FIRSTHDR(msg);
+      cmsg != NULL;
+      cmsg = CMSG_NXTHDR(msg, cmsg)) {
+         int segsize;
+
+         if (cmsg->cmsg_level != IPPROTO_UDP
+         ||  cmsg->cmsg_type  != UDP_GRO
+         ||  cmsg->cmsg_len   != CMSG_LEN(sizeof(segsize)))
+            continue;
+
+         CMSG_GETOBJECT(segsize, cmsg, 0);
+
+         if (segsize > 0 && (size_t)segsize < batch->msgv[i].msg_len)
+            batch->segsizev[i] = (size_t)segsize;
+      }
+#endif /* HAVE_UDP_OFFLOAD */
+   }
+
+   if (sockscf.option.debug >= DEBUG_VERBOSE)
+      slog(LOG_DEBUG, "%s: read %d packet%s from fd %d",
+           function, r, r == 1 ? "" : "s", s);
+
+   batch->s = s;
+   batch->c = (size_t)r;
+
+   return r;
+}
+
+#if HAVE_UDP_OFFLOAD
+
+static int
+udp_sendqueue(s, buf, len, to)
+   const int s;
+   const void *buf;
+   const size_t len;
+   const struct sockaddr_storage *to;
+{
+   const char *function = "udp_sendqueue()";
+
+   if (gso_failed || len == 0 || len > sizeof(sendq->buf))
+      return 0;
+
+   if (sendq == NULL) {
+      if ((sendq = malloc(sizeof(*sendq))) == NULL) {
+         swarn("%s: failed to allocate %lu bytes of memory for writing "
+               "several udp packets at a time.  Will write one at a time",
+               function, (unsigned long)sizeof(*sendq));
+
+         gso_failed = 1;
+         return 0;
+      }
+
+      sendq->s    = -1;
+      sendq->segc = sendq->len = 0;
+   }
+
+   if (sendq->s != -1) {
+      /*
+       * Can only add to what we have if it is for the same destination,
+       * of the same size, and the last packet was not shorter.
+       */
+      if (sendq->s                       != s
+      ||  sendq->hasto                   != (to != NULL)
+      ||  (to != NULL && !sockaddrareeq(&sendq->to, to, 0))
+      ||  len                            >  sendq->segsize
+      ||  sendq->len % sendq->segsize    != 0
+      ||  sendq->segc                    >= UDP_SENDSEGMENTSMAX
+      ||  sendq->len + len               >  sizeof(sendq->buf))
+         udp_sendflush();
+   }
+
+   if (sendq->s == -1) {
+      sendq->s       = s;
+      sendq->hasto   = (to != NULL);
+      sendq->segsize = len;
+
+      if (to != NULL)
+         sockaddrcpy(&sendq->to, to, sizeof(sendq->to));
+   }
+
+   memcpy(&sendq->buf[sendq->len], buf, len);
+   sendq->len  += len;
+   sendq->segc += 1;
+
+   return 1;
+}
+
+static void
+udp_sendsegments(void)
+{
+   const char *function = "udp_sendsegments()";
+   struct msghdr msg;
+   struct iovec iov;
+   union {
+      struct cmsghdr       align;
+      char                 mem[CMSG_SPACE(sizeof(uint16_t))];
+   } cmsgmem;
+   size_t off;
+   ssize_t w;
+
+   SASSERTX(sendq->segc > 0);
+
+   bzero(&msg, sizeof(msg));
+   iov.iov_base   = sendq->buf;
+   iov.iov_len    = sendq->len;
+   msg.msg_iov    = &iov;
+   msg.msg_iovlen = 1;
+
+   if (sendq->hasto) {
+      msg.msg_name    = &sendq->to;
+      msg.msg_namelen = salen(sendq->to.ss_family);
+   }
+
+   if (sendq->segc > 1) {
+      const uint16_t segsize = (uint16_t)sendq->segsize;
+      struct cmsghdr *cmsg;
+
+      bzero(&cmsgmem, sizeof(cmsgmem));
+      msg.msg_control    = cmsgmem.mem;
+      msg.msg_controllen = sizeof(cmsgmem.mem);
+
+      cmsg             = CMSG_FIRSTHDR(&msg);
+      cmsg->cmsg_level = IPPROTO_UDP;
+      cmsg->cmsg_type  = UDP_SEGMENT;
+      cmsg->cmsg_len   = CMSG_LEN(sizeof(segsize));
+      memcpy(CMSG_DATA(cmsg), &segsize, sizeof(segsize));
+   }
+
+   if (sockscf.option.debug >= DEBUG_VERBOSE)
+      slog(LOG_DEBUG, "%s: writing %lu packet%s of %lu bytes on fd %d",
+           function,
+           (unsigned long)sendq->segc,
+           sendq->segc == 1 ? "" : "s",
+           (unsigned long)sendq->segsize,
+           sendq->s);
+
+   if ((w = sendmsg(sendq->s, &msg, 0)) == (ssize_t)sendq->len)
+      return;
+
+   if (sendq->segc == 1 || ERRNOISTMP(errno)) {
+      slog(LOG_DEBUG, "%s: writing %lu packet%s on fd %d failed: %s",
+           function,
+           (unsigned long)sendq->segc,
+           sendq->segc == 1 ? "" : "s",
+           sendq->s,
+           strerror(errno));
+
+      return;
+   }
+
+   /*
+    * Presumably the kernel, or the interface, does not support it.
+    * Write the packets one by one, and do not try again.
+    */
+   swarn("%s: writing %lu packets of %lu bytes on fd %d with UDP_SEGMENT "
+         "failed.  Will write one packet at a time from now on",
+         function,
+         (unsigned long)sendq->segc,
+         (unsigned long)sendq->segsize,
+         sendq->s);
+
+   gso_failed = 1;
+
+   for (off = 0; off < sendq->len; off += sendq->segsize)
+      if (socks_sendto(sendq->s,
+                       &sendq->buf[off],
+                       MIN(sendq->segsize, sendq->len - off),
+                       0,
+                       sendq->hasto ? &sendq->to : NULL,
+                       sendq->hasto ? salen(sendq->to.ss_family) : 0,
+                       NULL,
+                       NULL) == -1)
+         slog(LOG_DEBUG, "%s: writing packet on fd %d failed: %s",
+              function, sendq->s, strerror(errno));
+}
+
+#endif /* HAVE_UDP_OFFLOAD */
+
+#else /* !HAVE_UDP_BATCHRECV */
+
+ssize_t
+udp_recvfrom(s, buf, len, from, fromlen, recvflags, auth)
+   const int s;
+   void *buf;
+   const size_t len;
+   struct sockaddr_storage *from;
+   socklen_t *fromlen;
+   recvfrom_info_t *recvflags;
+   authmethod_t *auth;
+{
+
+   return socks_recvfrom(s, buf, len, 0, from, fromlen, recvflags, auth);
+}
+
+size_t
+udp_recvpending(s)
+   const int s;
+{
+
+   return 0;
+}
+
+void
+udp_recvflush(void)
+{
+
+   return;
+}
+
+ssize_t
+udp_sendto(s, buf, len, to, tolen, sendtoflags, auth)
+   const int s;
+   const void *buf;
+   const size_t len;
+   const struct sockaddr_storage *to;
+   const socklen_t tolen;
+   sendto_info_t *sendtoflags;
+   authmethod_t *auth;
+{
+
+   return socks_sendto(s, buf, len, 0, to, tolen, sendtoflags, auth);
+}
+
+void
+udp_sendflush(void)
+{
+
+   return;
+}
+
+void
+udp_enableoffload(s)
+   const int s;
+{
+
+   return;
+}
+
+#endif /* !HAVE_UDP_BATCHRECV */
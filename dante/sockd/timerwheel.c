@@ -0,0 +1,378 @@
+/*
+ * Copyright (c) 2017
+ *      Inferno Nettverk A/S, Norway.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. The above copyright notice, this list of conditions and the following
+ *    disclaimer must appear in all copies of the software, derivative works
+ *    or modified versions, and any portions thereof, aswell as in all
+ *    supporting documentation.
+ * 2. All advertising materials mentioning features or use of this software
+ *    must display the following acknowledgement:
+ *      This product includes software developed by
+ *      Inferno Nettverk A/S, Norway.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Inferno Nettverk A/S requests users of this software to return to
+ *
+ *  Software Distribution Coordinator  or  sdc@inet.no
+ *  Inferno Nettverk A/S
+ *  Oslo Research Park
+ *  Gaustadallen 21
+ *  NO-0349 Oslo
+ *  Norway
+ *
+ * any improvements or extensions that they make and grant Inferno Nettverk A/S
+ * the rights to redistribute these changes.
+ *
+ */
+
+#include "common.h"
+
+/*
+ * Hierarchical timer wheel, used to keep track of when sessions time out
+ * without having to scan all of them each time we want to know.
+ *
+ * Level 0 has a slot for each of the next TIMERWHEEL_SLOTS seconds, and
+ * each level after that has slots covering TIMERWHEEL_SLOTS times as
+ * many seconds as a slot in the level before it.  As time moves on,
+ * timers in a higher level are moved ("cascaded") down into the lower
+ * levels, until they end up in level 0 and expire.  Arming, disarming
+ * and expiring a timer is therefore O(1), regardless of how many timers
+ * there are.
+ *
+ * Timers that expire further into the future than the wheel covers are
+ * put in the last slot of the highest level and re-added from there.
+ */
+
+static const char rcsid[] =
+"$Id$";
+
+#define TIMERWHEEL_SLOTMASK   (TIMERWHEEL_SLOTS - 1)
+#define TIMERWHEEL_SHIFT(level) ((level) * TIMERWHEEL_SLOTBITS)
+
+static void
+timerwheel_add(timerwheel_t *wheel, sockd_timer_t *timer);
+/*
+ * Adds the unarmed "timer" to the list in "wheel" corresponding to
+ * when "timer" expires.
+ */
+
+static void
+timerwheel_cascade(timerwheel_t *wheel, const size_t level,
+                   const size_t slot);
+/*
+ * Moves all timers in slot "slot" of level "level" in "wheel" to the
+ * lower level(s) they now belong in.
+ */
+
+static void
+timerwheel_tick(timerwheel_t *wheel);
+/*
+ * Advances "wheel" by one second, moving any timers that expire during
+ * that second to the list of expired timers.
+ */
+
+static void
+timer_link(sockd_timer_t **head, sockd_timer_t *timer, const int level);
+/*
+ * Links "timer" into the list "head", belonging to level "level".
+ */
+
+static void
+timer_unlink(sockd_timer_t *timer);
+/*
+ * Unlinks "timer" from the list it is on.
+ */
+
+void
+timerwheel_init(wheel, tnow)
+   timerwheel_t *wheel;
+   const time_t tnow;
+{
+
+   bzero(wheel, sizeof(*wheel));
+   wheel->now = tnow;
+}
+
+void
+timer_arm(wheel, timer, expires)
+   timerwheel_t *wheel;
+   sockd_timer_t *timer;
+   const time_t expires;
+{
+
+   if (timer->head != NULL) {
+      if (timer->expires == expires)
+         return;
+
+      timer_disarm(wheel, timer);
+   }
+
+   timer->expires = expires;
+   timerwheel_add(wheel, timer);
+
+   ++wheel->armedc;
+}
+
+void
+timer_disarm(wheel, timer)
+   timerwheel_t *wheel;
+   sockd_timer_t *timer;
+{
+
+   if (timer->head == NULL)
+      return;
+
+   if (timer->level != -1) {
+      SASSERTX(wheel->levelc[timer->level] > 0);
+      --wheel->levelc[timer->level];
+   }
+
+   timer_unlink(timer);
+
+   SASSERTX(wheel->armedc > 0);
+   --wheel->armedc;
+}
+
+time_t
+timerwheel_timeuntil(wheel, tnow)
+   const timerwheel_t *wheel;
+   const time_t tnow;
+{
+   time_t first;
+   size_t level;
+
+   if (wheel->expired != NULL)
+      return 0;
+
+   if (wheel->armedc == 0)
+      return -1;
+
+   /*
+    * For level 0 we find the exact time the first timer expires.  For the
+    * other levels we only know the earliest time the timers in the first
+    * used slot will be cascaded, so that is what we return if it is
+    * earlier.  By then we will know more.
+    */
+   for (level = 0, first = -1; level < TIMERWHEEL_LEVELS; ++level) {
+      const size_t shift = TIMERWHEEL_SHIFT(level);
+      const time_t base  = wheel->now >> shift;
+      size_t d, start;
+
+      if (wheel->levelc[level] == 0)
+         continue;
+
+      /*
+       * If wheel->now is not at the start of the current slot in this
+       * level, that slot has already been cascaded, and will not be
+       * again until the wheel has turned a full round.
+       */
+      if ((wheel->now & (((time_t)1 << shift) - 1)) == 0)
+         start = 0;
+      else
+         start = 1;
+
+      for (d = start; d < start + TIMERWHEEL_SLOTS; ++d) {
+         if (wheel->slotv[level][(base + d) & TIMERWHEEL_SLOTMASK] != NULL) {
+            const time_t t = (base + (time_t)d) << shift;
+
+            if (first == -1 || t < first)
+               first = t;
+
+            break;
+         }
+      }
+
+      SASSERTX(d < start + TIMERWHEEL_SLOTS);
+   }
+
+   SASSERTX(first != -1);
+   return MAX(0, socks_difftime(first, tnow));
+}
+
+sockd_timer_t *
+timerwheel_getexpired(wheel, tnow)
+   timerwheel_t *wheel;
+   const time_t tnow;
+{
+   sockd_timer_t *timer;
+
+   while (wheel->expired == NULL && wheel->now <= tnow) {
+      time_t next;
+      size_t level;
+
+      if (wheel->armedc == 0) {
+         wheel->now = tnow + 1;
+         break;
+      }
+
+      /*
+       * If the lowest levels are empty, nothing can happen until the
+       * next time a slot in the first non-empty level is cascaded, so
+       * skip directly to that.
+       */
+      for (level = 0; level < TIMERWHEEL_LEVELS; ++level)
+         if (wheel->levelc[level] != 0)
+            break;
+
+      if (level > 0 && level < TIMERWHEEL_LEVELS) {
+         const time_t align = (time_t)1 << TIMERWHEEL_SHIFT(level);
+
+         next = (wheel->now + align - 1) & ~(align - 1);
+
+         if (next > wheel->now) {
+            wheel->now = MIN(next, tnow + 1);
+            continue;
+         }
+      }
+
+      timerwheel_tick(wheel);
+   }
+
+   if ((timer = wheel->expired) == NULL)
+      return NULL;
+
+   timer_disarm(wheel, timer);
+   return timer;
+}
+
+static void
+timerwheel_add(wheel, timer)
+   timerwheel_t *wheel;
+   sockd_timer_t *timer;
+{
+   const time_t max = ((time_t)1 << TIMERWHEEL_SHIFT(TIMERWHEEL_LEVELS)) - 1;
+   time_t delta, expires;
+   size_t level;
+
+   SASSERTX(timer->head == NULL);
+
+   if ((delta = socks_difftime(timer->expires, wheel->now)) < 0) {
+      /* that second has already been processed. */
+      timer_link(&wheel->expired, timer, -1);
+      return;
+   }
+
+   if (delta > max) {
+      delta   = max;
+      expires = wheel->now + max;
+   }
+   else
+      expires = timer->expires;
+
+   for (level = 0; level < TIMERWHEEL_LEVELS - 1; ++level)
+      if (delta < ((time_t)1 << TIMERWHEEL_SHIFT(level + 1)))
+         break;
+
+   timer_link(&wheel->slotv[level][(expires >> TIMERWHEEL_SHIFT(level))
+                                   & TIMERWHEEL_SLOTMASK],
+              timer,
+              (int)level);
+
+   ++wheel->levelc[level];
+}
+
+static void
+timerwheel_cascade(wheel, level, slot)
+   timerwheel_t *wheel;
+   const size_t level;
+   const size_t slot;
+{
+   sockd_timer_t *timer;
+
+   while ((timer = wheel->slotv[level][slot]) != NULL) {
+      timer_unlink(timer);
+
+      SASSERTX(wheel->levelc[level] > 0);
+      --wheel->levelc[level];
+
+      timerwheel_add(wheel, timer);
+   }
+}
+
+static void
+timerwheel_tick(wheel)
+   timerwheel_t *wheel;
+{
+   sockd_timer_t *timer;
+   size_t level, slot;
+
+   /*
+    * When we get to the start of a slot in a higher level, move the
+    * timers in that slot down, starting with the lowest level.
+    */
+   for (level = 1; level < TIMERWHEEL_LEVELS; ++level) {
+      const size_t shift = TIMERWHEEL_SHIFT(level);
+
+      if ((wheel->now & (((time_t)1 << shift) - 1)) != 0)
+         break;
+
+      timerwheel_cascade(wheel,
+                         level,
+                         (size_t)(wheel->now >> shift) & TIMERWHEEL_SLOTMASK);
+   }
+
+   slot = (size_t)wheel->now & TIMERWHEEL_SLOTMASK;
+   while ((timer = wheel->slotv[0][slot]) != NULL) {
+      SASSERTX(timer->expires <= wheel->now);
+
+      timer_unlink(timer);
+
+      SASSERTX(wheel->levelc[0] > 0);
+      --wheel->levelc[0];
+
+      timer_link(&wheel->expired, timer, -1);
+   }
+
+   ++wheel->now;
+}
+
+static void
+timer_link(head, timer, level)
+   sockd_timer_t **head;
+   sockd_timer_t *timer;
+   const int level;
+{
+
+   timer->head  = head;
+   timer->level = level;
+   timer->prev  = NULL;
+   timer->next  = *head;
+
+   if (timer->next != NULL)
+      timer->next->prev = timer;
+
+   *head = timer;
+}
+
+static void
+timer_unlink(timer)
+   sockd_timer_t *timer;
+{
+
+   if (timer->prev == NULL)
+      *timer->head = timer->next;
+   else
+      timer->prev->next = timer->next;
+
+   if (timer->next != NULL)
+      timer->next->prev = timer->prev;
+
+   timer->next = timer->prev = NULL;
+   timer->head = NULL;
+}
@@ -43,7 +43,6 @@
 
 #include "common.h"
 
-#include <math.h> /* XXX */
 
 static const char rcsid[] =
 "$Id: bandwidth.c,v 1.32 2013/01/02 13:22:40 karls Exp $";
@@ -51,6 +50,28 @@ static const char rcsid[] =
 const char module_bandwidth_version[] =
 "$Id: bandwidth.c,v 1.32 2013/01/02 13:22:40 karls Exp $";
 
+/*
+ * The bucket holds at most this many microseconds worth of bytes.
+ */
+#define BW_BUCKETUSEC   ((int64_t)1000000)
+
+#define TIMEVAL2USEC(tv)                                                       \
+   ((int64_t)(tv)->tv_sec * 1000000 + (int64_t)(tv)->tv_usec)
+
+static int64_t
+bw_loadtat(const shmem_object_t *bw, const int lock);
+/*
+ * Returns the theoretical arrival time of the bucket in "bw".  If the
+ * bucket is not updated atomically, "lock" is taken for the read, so we
+ * never see a half-written value.
+ */
+
+static ssize_t
+bw_tokens(const bw_t *bw, const int64_t tat, const struct timeval *tnow);
+/*
+ * Returns the number of tokens (bytes) in the bucket "bw" at time "tnow",
+ * if its theoretical arrival time is "tat".  Negative if "bw" is in debt.
+ */
 
 void
 bw_use(bw, cinfo, lock)
@@ -58,8 +79,19 @@ bw_use(bw, cinfo, lock)
    const clientinfo_t *cinfo;
    const int lock;
 {
+   const char *function = "bw_use()";
+
+   SASSERTX(bw != NULL);
 
-   (void)bw;
+   slog(LOG_DEBUG, "%s: cinfo = %s, lock = %d, bw object %p, clients %lu.  "
+                   "Should become one more",
+                   function,
+                   clientinfo2string(cinfo, NULL, 0),
+                   lock,
+                   bw,
+                   (unsigned long)bw->mstate.clients);
+
+   shmem_use(bw, cinfo, lock, 0);
 }
 
 void
@@ -68,8 +100,20 @@ bw_unuse(bw, cinfo, lock)
    const clientinfo_t *cinfo;
    const int lock;
 {
+   const char *function = "bw_unuse()";
+
+   if (bw == NULL)
+      return;
+
+   slog(LOG_DEBUG, "%s: cinfo = %s, lock = %d, bw object %p, clients %lu.  "
+                   "Should become one less",
+                   function,
+                   clientinfo2string(cinfo, NULL, 0),
+                   lock,
+                   bw,
+                   (unsigned long)bw->mstate.clients);
 
-   (void)bw;
+   shmem_unuse(bw, cinfo, lock);
 }
 
 ssize_t
@@ -77,9 +121,14 @@ bw_left(bw, lock)
    const shmem_object_t *bw;
    const int lock;
 {
+   struct timeval tnow;
+   ssize_t left;
+
+   gettimeofday_monotonic(&tnow);
+
+   left = bw_tokens(&bw->object.bw, bw_loadtat(bw, lock), &tnow);
 
-   (void)bw;
-   return SOCKD_BUFSIZE;
+   return MAX(0, MIN(left, SOCKD_BUFSIZE));
 }
 
 void
@@ -89,10 +138,36 @@ bw_update(bw, bwused, bwusedtime, lock)
    const struct timeval *bwusedtime;
    const int lock;
 {
+   const char *function = "bw_update()";
+   bw_t *bucket = &bw->object.bw;
+   const int64_t tnow = TIMEVAL2USEC(bwusedtime);
+   int64_t cost, tat, newtat;
 
-   (void)bw;
-   (void)bwused;
-   (void)bwusedtime;
+   /*
+    * What transferring "bwused" bytes costs, in microseconds.
+    */
+   if (bucket->maxbps == 0)
+      cost = BW_BUCKETUSEC;
+   else
+      cost = (int64_t)((double)bwused * 1000000.0 / (double)bucket->maxbps);
+
+   if (!HAVE_SHMEM_ATOMICS)
+      socks_lock(lock, (off_t)bw->mstate.shmid, 1, 1, 1);
+
+   tat = SHMEM_ATOMIC_LOAD(&bucket->tat);
+   do
+      newtat = MAX(tat, tnow) + cost;
+   while (!SHMEM_ATOMIC_CAS(&bucket->tat, &tat, newtat));
+
+   if (!HAVE_SHMEM_ATOMICS)
+      socks_unlock(lock, (off_t)bw->mstate.shmid, 1);
+
+   slog(LOG_DEBUG, "%s: shmid %lu: %lu bytes used, %ld bytes left of %lu",
+        function,
+        (unsigned long)bw->mstate.shmid,
+        (unsigned long)bwused,
+        (long)bw_tokens(bucket, newtat, bwusedtime),
+        (unsigned long)bucket->maxbps);
 }
 
 int
@@ -101,6 +176,70 @@ bw_rulehasoverflown(rule, tnow, overflowok)
    const struct timeval *tnow;
    struct timeval *overflowok;
 {
+   const char *function = "bw_rulehasoverflown()";
+   const bw_t *bucket;
+   int64_t tat, tok;
+
+   SASSERTX(rule->bw != NULL);
+   bucket = &rule->bw->object.bw;
+
+   tat = bw_loadtat(rule->bw, sockscf.shmemfd);
+   if (tat - BW_BUCKETUSEC < TIMEVAL2USEC(tnow))
+      return 0;
+
+   /*
+    * Bucket is empty.  It will have tokens again one microsecond after
+    * having been paid for up to BW_BUCKETUSEC into the future.
+    */
+   tok = tat - BW_BUCKETUSEC + 1;
+   overflowok->tv_sec  = (time_t)(tok / 1000000);
+   overflowok->tv_usec = (long)(tok % 1000000);
+
+   slog(LOG_DEBUG, "%s: rule #%lu/bw_shmid %lu is %ld bytes in debt.  "
+                   "Must wait until %ld.%06ld",
+                   function,
+                   (unsigned long)rule->number,
+                   (unsigned long)rule->bw_shmid,
+                   (long)-bw_tokens(bucket, tat, tnow),
+                   (long)overflowok->tv_sec,
+                   (long)overflowok->tv_usec);
+
+   return 1;
+}
+
+static int64_t
+bw_loadtat(bw, lock)
+   const shmem_object_t *bw;
+   const int lock;
+{
+   int64_t tat;
+
+   if (HAVE_SHMEM_ATOMICS)
+      return SHMEM_ATOMIC_LOAD(&bw->object.bw.tat);
+
+   socks_lock(lock, (off_t)bw->mstate.shmid, 1, 0, 1);
+   tat = bw->object.bw.tat;
+   socks_unlock(lock, (off_t)bw->mstate.shmid, 1);
+
+   return tat;
+}
+
+static ssize_t
+bw_tokens(bw, tat, tnow)
+   const bw_t *bw;
+   const int64_t tat;
+   const struct timeval *tnow;
+{
+   double tokens;
+
+   tokens = (double)(TIMEVAL2USEC(tnow) + BW_BUCKETUSEC - tat)
+          * (double)bw->maxbps / 1000000.0;
+
+   if (tokens >= (double)bw->maxbps)
+      return (ssize_t)MIN(bw->maxbps, (size_t)SSIZE_MAX);
+
+   if (tokens <= -(double)SSIZE_MAX)
+      return -SSIZE_MAX;
 
-   return 0;
+   return (ssize_t)tokens;
 }